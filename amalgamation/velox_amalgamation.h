@@ -370,7 +370,7 @@ VELOX_RVT(Range) percentile_of_sorted(Range &&samples, const double percentile)
 #pragma GCC diagnostic pop
 #endif
   const auto len = last - first - 1;
-  const auto rank = (percentile / 100.0) * len;
+  const auto rank = (percentile / 100.0) * static_cast<double>(len);
   const auto lrank = std::floor(rank);
   const auto d = rank - lrank;
   const auto n = static_cast<std::uint32_t>(lrank);
@@ -431,7 +431,7 @@ VELOX_RVT(Range) variance(Range &&r) {
     v += x * x;
   }
 
-  return v / (len - 1);
+  return v / static_cast<double>(len - 1);
 }
 
 template <class Range>
@@ -456,6 +456,93 @@ VELOX_RVT(Range)
   return median_destructive(abs_devs_buffer) * 1.4826;
 }
 
+// Cumulative distribution function of the standard normal distribution
+inline double normal_cdf(const double x) {
+  return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+// Inverse of normal_cdf using Acklam's rational approximation followed by a step of Halley's
+// method, which is accurate to about 1e-15
+inline double normal_quantile(const double p) {
+  assert(p > 0.0 && p < 1.0 && "p must be between 0 and 1");
+
+  static const double a[] = {-3.969683028665376e+01,
+                             2.209460984245205e+02,
+                             -2.759285104469687e+02,
+                             1.383577518672690e+02,
+                             -3.066479806614716e+01,
+                             2.506628277459239e+00};
+  static const double b[] = {-5.447609879822406e+01,
+                             1.615858368580409e+02,
+                             -1.556989798598866e+02,
+                             6.680131188771972e+01,
+                             -1.328068155288572e+01};
+  static const double c[] = {-7.784894002430293e-03,
+                             -3.223964580411365e-01,
+                             -2.400758277161838e+00,
+                             -2.549732539343734e+00,
+                             4.374664141464968e+00,
+                             2.938163982698783e+00};
+  static const double d[] = {
+      7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00};
+
+  const auto p_low = 0.02425;
+
+  double x;
+  if (p < p_low) {
+    const auto q = std::sqrt(-2.0 * std::log(p));
+    x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+        ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+  } else if (p <= 1.0 - p_low) {
+    const auto q = p - 0.5;
+    const auto r = q * q;
+    x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+        (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+  } else {
+    const auto q = std::sqrt(-2.0 * std::log(1.0 - p));
+    x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+        ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+  }
+
+  // Don't require users to #define _USE_MATH_DEFINES when using msvc so ...
+  const auto PI = 3.14159265358979323846;
+  const auto e = normal_cdf(x) - p;
+  const auto u = e * std::sqrt(2.0 * PI) * std::exp(x * x / 2.0);
+  return x - u / (1.0 + x * u / 2.0);
+}
+
+// Quantile of Student's t distribution with df degrees of freedom using the Cornish-Fisher
+// expansion from Abramowitz & Stegun 26.7.5, which is accurate to about 1e-3 for df >= 4
+inline double student_t_quantile(const double p, const double df) {
+  assert(df > 0.0 && "Degrees of freedom must be positive");
+
+  const auto z = normal_quantile(p);
+  const auto z2 = z * z;
+  const auto g1 = (z2 + 1.0) * z / 4.0;
+  const auto g2 = ((5.0 * z2 + 16.0) * z2 + 3.0) * z / 96.0;
+  const auto g3 = (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) * z / 384.0;
+  const auto g4 = ((((79.0 * z2 + 776.0) * z2 + 1482.0) * z2 - 1920.0) * z2 - 945.0) * z / 92160.0;
+
+  return z + (g1 + (g2 + (g3 + g4 / df) / df) / df) / df;
+}
+
+// Quantile of the chi-squared distribution with df degrees of freedom using the Wilson-Hilferty
+// approximation
+inline double chi_squared_quantile(const double p, const double df) {
+  assert(df > 0.0 && "Degrees of freedom must be positive");
+
+  const auto v = 2.0 / (9.0 * df);
+  const auto c = 1.0 - v + normal_quantile(p) * std::sqrt(v);
+  return df * (std::max)(c, 0.0) * (std::max)(c, 0.0) * (std::max)(c, 0.0);
+}
+
+// Probability that a binomial(n, 1/2) variable is exactly k
+inline double binomial_half_pmf(const std::uint64_t k, const std::uint64_t n) {
+  const auto nd = static_cast<double>(n), kd = static_cast<double>(k);
+  return std::exp(std::lgamma(nd + 1.0) - std::lgamma(kd + 1.0) - std::lgamma(nd - kd + 1.0) +
+                  nd * std::log(0.5));
+}
+
 template <class T>
 struct Quartiles {
   Quartiles(T quartile1, T quartile2, T quartile3)
@@ -475,16 +562,21 @@ private:
   T q3_;
 };
 
+template <class Range>
+Quartiles<VELOX_RVT(Range)> quartiles_of_sorted(Range &&r) {
+  const auto q1 = percentile_of_sorted(r, 25);
+  const auto q2 = percentile_of_sorted(r, 50);
+  const auto q3 = percentile_of_sorted(r, 75);
+
+  return Quartiles<VELOX_RVT(Range)>(q1, q2, q3);
+}
+
 template <class Range>
 Quartiles<VELOX_RVT(Range)> quartiles(Range &&r) {
   std::vector<VELOX_RVT(Range)> temp(adl::adl_begin(r), adl::adl_end(r));
   std::sort(temp.begin(), temp.end());
 
-  const auto q1 = percentile_of_sorted(temp, 25);
-  const auto q2 = percentile_of_sorted(temp, 50);
-  const auto q3 = percentile_of_sorted(temp, 75);
-
-  return Quartiles<VELOX_RVT(Range)>(q1, q2, q3);
+  return quartiles_of_sorted(temp);
 }
 }
 
@@ -637,6 +729,36 @@ private:
 };
 
 using Points = std::vector<Point>;
+
+// Drops points of a curve, sorted by x, which lie within max_error (vertically) of the straight
+// line joining the points kept either side of them, so the curve draws the same with fewer points
+inline Points thin_points(const Points &points, const double max_error) {
+  if (points.size() < 3) {
+    return points;
+  }
+
+  Points thinned{points.front()};
+
+  // Extend a segment from the last kept point for as long as it passes close to every point it
+  // skips
+  std::size_t anchor = 0;
+  for (std::size_t end = 2; end < points.size(); ++end) {
+    const auto &a = points[anchor], &b = points[end];
+    const auto slope = (b.y() - a.y()) / (b.x() - a.x());
+
+    for (auto i = anchor + 1; i < end; ++i) {
+      const auto &p = points[i];
+      if (std::abs(a.y() + slope * (p.x() - a.x()) - p.y()) > max_error) {
+        anchor = end - 1;
+        thinned.push_back(points[anchor]);
+        break;
+      }
+    }
+  }
+
+  thinned.push_back(points.back());
+  return thinned;
+}
 }
 
 namespace velox {
@@ -678,538 +800,676 @@ inline double r_squared(const Points &points, const double slope) {
 
   return 1.0 - (residual_sum_of_squares / total_sum_of_squares);
 }
-}
 
-namespace velox {
+// Huber M-estimate of the slope through the origin found with iteratively reweighted least
+// squares.  Points whose residuals are more than k robust standard deviations (the scaled MAD of
+// the residuals) from the line are down-weighted instead of pulling the slope towards them.
+inline double huber_slope(const Points &points, const double k = 1.345) {
+  assert(!points.empty() && "Regression requires at least one point");
 
-struct Measurement {
+  auto ratios = vector_with_capacity<double>(points.size());
+  for (const auto &p : points) {
+    ratios.push_back(p.y() / p.x());
+  }
 
-  Measurement(std::uint64_t iterations, Ns time) : iters_(iterations), duration_(time) {}
+  // The median of the per point slopes is a robust starting point
+  auto b = median_destructive(ratios);
 
-  std::uint64_t iters() const { return iters_; }
+  auto abs_residuals = vector_with_capacity<double>(points.size());
+  for (int i = 0; i < 50; ++i) {
+    abs_residuals.clear();
+    for (const auto &p : points) {
+      abs_residuals.push_back(std::abs(p.y() - b * p.x()));
+    }
 
-  Ns duration() const { return duration_; }
+    const auto scale = 1.4826 * median_destructive(abs_residuals);
+    if (!(scale > 0.0)) {
+      return b;
+    }
 
-private:
-  std::uint64_t iters_;
-  Ns duration_;
-};
+    double wxy = 0.0, wxx = 0.0;
+    for (const auto &p : points) {
+      const auto r = std::abs(p.y() - b * p.x());
+      const auto w = r > k * scale ? k * scale / r : 1.0;
+      wxy += w * p.x() * p.y();
+      wxx += w * p.x() * p.x();
+    }
 
-using Measurements = std::vector<Measurement>;
+    const auto next = wxy / wxx;
+    const auto converged = std::abs(next - b) <= 1e-10 * std::abs(b);
+    b = next;
 
-inline Points measurements_to_points(const Measurements &measurements) {
-  auto ps = vector_with_capacity<Point>(measurements.size());
-  for (const auto &m : measurements) {
-    ps.emplace_back(static_cast<double>(m.iters()), static_cast<double>(m.duration().count()));
+    if (converged) {
+      break;
+    }
   }
 
-  return ps;
-}
+  return b;
 }
 
-#include <random>
-#include <future>
+// Theil-Sen estimate of the slope: the median of the slopes between every pair of points with
+// different x.  Up to ~29% of the points can be arbitrarily bad without affecting it, but it
+// costs O(n^2) per fit.
+inline double theil_sen_slope(const Points &points) {
+  assert(!points.empty() && "Regression requires at least one point");
 
-namespace velox {
+  std::vector<double> slopes;
+  slopes.reserve(points.size() * (points.size() - 1) / 2);
 
-template <class T>
-struct Estimate {
-  Estimate(const T p, const T sd, const T lb, const T ub, const double cl)
-      : point_(p), standard_error_(sd), lower_bound_(lb), upper_bound_(ub), confidence_level_(cl) {
-    assert(cl > 0.0 && cl < 1.0 && "Confidence level must be between 0 and 1");
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    for (std::size_t j = i + 1; j < points.size(); ++j) {
+      const auto dx = points[j].x() - points[i].x();
+      if (dx > 0.0 || dx < 0.0) {
+        slopes.push_back((points[j].y() - points[i].y()) / dx);
+      }
+    }
   }
 
-  T point() const { return point_; }
+  return slopes.empty() ? slope(points) : median_destructive(slopes);
+}
 
-  T standard_error() const { return standard_error_; }
+// Regression with an intercept
 
-  T lower_bound() const { return lower_bound_; }
+// y = intercept + slope * x
+struct Line {
+  Line(const double b0, const double b1) : intercept_(b0), slope_(b1) {}
 
-  T upper_bound() const { return upper_bound_; }
+  double intercept() const { return intercept_; }
 
-  double confidence_level() const { return confidence_level_; }
+  double slope() const { return slope_; }
+
+  double operator()(const double x) const { return intercept_ + slope_ * x; }
 
 private:
-  T point_;
-  T standard_error_;
-  T lower_bound_;
-  T upper_bound_;
-  double confidence_level_;
+  double intercept_;
+  double slope_;
 };
 
-inline Estimate<FpNs> make_estimate(const FpNs p, Times bootstrap, const double cl) {
-  std::sort(bootstrap.begin(), bootstrap.end());
-  const FpRange r(bootstrap);
+namespace detail {
+  // Weighted least squares with an intercept, falls back to a line through the origin when every
+  // x is the same
+  template <class W>
+  Line weighted_ols_line(const Points &points, W &&weight) {
+    double sw = 0.0, sx = 0.0, sy = 0.0;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      const auto w = weight(i);
+      sw += w;
+      sx += w * points[i].x();
+      sy += w * points[i].y();
+    }
 
-  return Estimate<FpNs>(p,
-                        FpNs(std_dev(r)),
-                        FpNs(percentile_of_sorted(r, 50.0 * (1.0 - cl))),
-                        FpNs(percentile_of_sorted(r, 50.0 * (1.0 + cl))),
-                        cl);
-}
+    const auto mx = sx / sw, my = sy / sw;
 
-inline Estimate<double>
-make_estimate(const double p, std::vector<double> bootstrap, const double cl) {
-  std::sort(bootstrap.begin(), bootstrap.end());
+    double sxx = 0.0, sxy = 0.0;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      const auto w = weight(i);
+      const auto dx = points[i].x() - mx;
+      sxx += w * dx * dx;
+      sxy += w * dx * (points[i].y() - my);
+    }
 
-  return Estimate<double>(p,
-                          std_dev(bootstrap),
-                          percentile_of_sorted(bootstrap, 50.0 * (1.0 - cl)),
-                          percentile_of_sorted(bootstrap, 50.0 * (1.0 + cl)),
-                          cl);
-}
+    if (!(sxx > 0.0)) {
+      return Line(0.0, slope(points));
+    }
 
-template <class T>
-struct EstimateAndDistribution {
-  EstimateAndDistribution(const Estimate<T> &est, std::vector<T> &&dist)
-      : estimate_(est), distribution_(std::move(dist)) {}
+    const auto b1 = sxy / sxx;
+    return Line(my - b1 * mx, b1);
+  }
+}
 
-  const Estimate<T> &estimate() const { return estimate_; }
+// Ordinary least squares.  The intercept is the fixed cost of each measurement (the Stopwatch,
+// clock reads, etc.) and the slope is the time per iteration without it.
+inline Line ols_line(const Points &points) {
+  assert(!points.empty() && "Regression requires at least one point");
+  return detail::weighted_ols_line(points, [](std::size_t) { return 1.0; });
+}
 
-  const std::vector<T> distribution() const { return distribution_; }
+// Huber M-estimate of the line found with iteratively reweighted least squares starting from
+// the OLS line
+inline Line huber_line(const Points &points, const double k = 1.345) {
+  assert(!points.empty() && "Regression requires at least one point");
 
-private:
-  Estimate<T> estimate_;
-  std::vector<T> distribution_;
-};
+  auto line = ols_line(points);
 
-struct EstimatedStatistics {
-  EstimatedStatistics(EstimateAndDistribution<FpNs> &&means,
-                      EstimateAndDistribution<FpNs> &&medians,
-                      EstimateAndDistribution<FpNs> &&std_devs,
-                      EstimateAndDistribution<FpNs> &&mads,
-                      EstimateAndDistribution<FpNs> &&lls,
-                      EstimateAndDistribution<double> &&r2s)
-      : mean_(std::move(means)), median_(std::move(medians)), std_dev_(std::move(std_devs)),
-        median_abs_dev_(std::move(mads)), linear_least_squares_(std::move(lls)),
-        r_squared_(std::move(r2s)) {}
+  std::vector<double> weights(points.size(), 1.0);
+  auto abs_residuals = vector_with_capacity<double>(points.size());
 
-  const EstimateAndDistribution<FpNs> &mean() const { return mean_; }
+  for (int i = 0; i < 50; ++i) {
+    abs_residuals.clear();
+    for (const auto &p : points) {
+      abs_residuals.push_back(std::abs(p.y() - line(p.x())));
+    }
 
-  const EstimateAndDistribution<FpNs> &median() const { return median_; }
+    const auto scale = 1.4826 * median_destructive(abs_residuals);
+    if (!(scale > 0.0)) {
+      break;
+    }
 
-  const EstimateAndDistribution<FpNs> &std_dev() const { return std_dev_; }
+    for (std::size_t j = 0; j < points.size(); ++j) {
+      const auto r = std::abs(points[j].y() - line(points[j].x()));
+      weights[j] = r > k * scale ? k * scale / r : 1.0;
+    }
 
-  const EstimateAndDistribution<FpNs> &median_abs_dev() const { return median_abs_dev_; }
+    const auto next = detail::weighted_ols_line(points, [&weights](std::size_t j) {
+      return weights[j];
+    });
+    const auto converged = std::abs(next.slope() - line.slope()) <=
+                               1e-10 * std::abs(line.slope()) &&
+                           std::abs(next.intercept() - line.intercept()) <=
+                               1e-10 * (std::abs(line.intercept()) + std::abs(line.slope()));
+    line = next;
 
-  const EstimateAndDistribution<FpNs> &linear_least_squares() const {
-    return linear_least_squares_;
+    if (converged) {
+      break;
+    }
   }
 
-  const EstimateAndDistribution<double> &r_squared() const { return r_squared_; }
+  return line;
+}
 
-private:
-  EstimateAndDistribution<FpNs> mean_;
-  EstimateAndDistribution<FpNs> median_;
-  EstimateAndDistribution<FpNs> std_dev_;
-  EstimateAndDistribution<FpNs> median_abs_dev_;
-  EstimateAndDistribution<FpNs> linear_least_squares_;
-  EstimateAndDistribution<double> r_squared_;
-};
+// theil_sen_slope with the median of the y - slope * x as the intercept
+inline Line theil_sen_line(const Points &points) {
+  const auto b1 = theil_sen_slope(points);
 
-template <template <class> class D, class T, class S, class F>
-void
-resample(const std::vector<T> &sample, const std::uint32_t num_resamples, const S seed, F &&f) {
-  std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
-  D<std::size_t> distribution(0, sample.size() - 1);
-  auto resample = sample;
+  auto intercepts = vector_with_capacity<double>(points.size());
+  for (const auto &p : points) {
+    intercepts.push_back(p.y() - b1 * p.x());
+  }
 
-  for (std::uint32_t i = 0; i < num_resamples; ++i) {
-    std::generate(resample.begin(), resample.end(), [&] { return sample[distribution(rng)]; });
+  return Line(median_destructive(intercepts), b1);
+}
 
-    f(resample);
+// The proportion of the variance of y around its mean explained by the line
+inline double r_squared(const Points &points, const Line &line) {
+  double my = 0.0;
+  for (const auto &p : points) {
+    my += p.y();
   }
-}
+  my /= static_cast<double>(points.size());
 
-template <template <class> class D = std::uniform_int_distribution>
-inline EstimatedStatistics estimate_statistics(const Measurements &measurements,
-                                               const Times &times,
-                                               const std::uint32_t num_resamples,
-                                               const double cl) {
-  auto means = vector_with_capacity<FpNs>(num_resamples);
-  auto medians = vector_with_capacity<FpNs>(num_resamples);
-  auto std_devs = vector_with_capacity<FpNs>(num_resamples);
-  auto mads = vector_with_capacity<FpNs>(num_resamples);
+  double residual_sum_of_squares = 0.0, total_sum_of_squares = 0.0;
+  for (const auto &p : points) {
+    const auto r = p.y() - line(p.x());
+    const auto d = p.y() - my;
+    residual_sum_of_squares += r * r;
+    total_sum_of_squares += d * d;
+  }
 
-  const auto points = measurements_to_points(measurements);
-  auto lls = vector_with_capacity<FpNs>(num_resamples);
-  auto r2s = vector_with_capacity<double>(num_resamples);
+  return 1.0 - (residual_sum_of_squares / total_sum_of_squares);
+}
+}
 
-  auto mad_buffer = vector_with_capacity<double>(times.size());
+namespace velox {
 
-  const auto seed = std::random_device{}();
+struct Measurement {
 
-  auto sorted_stat_calcs = std::async(std::launch::async, [&] {
-    resample<D>(times, num_resamples, seed, [&](Times &s) {
-      std::sort(s.begin(), s.end());
-      FpRange r(s);
+  Measurement(std::uint64_t iterations, Ns time, Ns start_time = Ns(0))
+      : iters_(iterations), duration_(time), start_(start_time) {}
 
-      medians.push_back(FpNs(median_of_sorted(r)));
-      mads.push_back(FpNs(median_abs_dev_of_sorted_destructive(r, mad_buffer)));
-    });
-  });
+  std::uint64_t iters() const { return iters_; }
 
-  auto stat_calcs = std::async(std::launch::async, [&] {
-    resample<D>(times, num_resamples, seed, [&](const Times &s) {
-      FpRange r(s);
-      means.push_back(FpNs(mean(r)));
-      std_devs.push_back(FpNs(std_dev(r)));
-    });
-  });
+  Ns duration() const { return duration_; }
 
-  resample<D>(points, num_resamples, seed, [&](const Points &ps) {
-    const auto s = slope(ps);
-    lls.push_back(FpNs{s});
-    r2s.push_back(r_squared(ps, s));
-  });
+  // When the measurement started, relative to the start of the first measurement
+  Ns start() const { return start_; }
 
-  sorted_stat_calcs.get();
-  stat_calcs.get();
+private:
+  std::uint64_t iters_;
+  Ns duration_;
+  Ns start_;
+};
 
-  const auto sorted_sample = [&times]() -> Times {
-    auto temp = times;
-    std::sort(temp.begin(), temp.end());
-    return temp;
-  }();
-  const FpRange r(sorted_sample);
-  const auto mean_point = FpNs{mean(r)};
-  const auto median_point = FpNs{median_of_sorted(r)};
-  const auto std_dev_point = FpNs{std_dev(r)};
-  const auto mad_point = FpNs{median_abs_dev_of_sorted_destructive(r, mad_buffer)};
+using Measurements = std::vector<Measurement>;
 
-  const auto lls_point = FpNs{slope(points)};
-  const auto r2_point = r_squared(points, lls_point.count());
+inline Points measurements_to_points(const Measurements &measurements) {
+  auto ps = vector_with_capacity<Point>(measurements.size());
+  for (const auto &m : measurements) {
+    ps.emplace_back(static_cast<double>(m.iters()), static_cast<double>(m.duration().count()));
+  }
 
-  return EstimatedStatistics(
-      EstimateAndDistribution<FpNs>(make_estimate(mean_point, means, cl), std::move(means)),
-      EstimateAndDistribution<FpNs>(make_estimate(median_point, medians, cl), std::move(medians)),
-      EstimateAndDistribution<FpNs>(make_estimate(std_dev_point, std_devs, cl),
-                                    std::move(std_devs)),
-      EstimateAndDistribution<FpNs>(make_estimate(mad_point, mads, cl), std::move(mads)),
-      EstimateAndDistribution<FpNs>(make_estimate(lls_point, lls, cl), std::move(lls)),
-      EstimateAndDistribution<double>(make_estimate(r2_point, r2s, cl), std::move(r2s)));
+  return ps;
+}
+
+// Whether every measurement ran the same number of iterations, as with flat sampling
+inline bool is_flat(const Measurements &measurements) {
+  return std::all_of(measurements.begin(), measurements.end(), [&](const Measurement &m) {
+    return m.iters() == measurements.front().iters();
+  });
 }
 }
 
 namespace velox {
 
-template <class D>
-struct ItersForDuration {
-  ItersForDuration(const std::uint64_t iterations, const D d) : iters_(iterations), duration_(d) {}
-
-  std::uint64_t iters() const { return iters_; }
-
-  D duration() const { return duration_; }
-
-private:
-  std::uint64_t iters_;
-  D duration_;
-};
+namespace {
+  const std::uint32_t DEFAULT_SKETCH_SIZE = 512;
+}
 
-using ItersForDurationNs = ItersForDuration<Ns>;
+inline double sketch_value(const FpNs ns) {
+  return ns.count();
 }
 
-namespace velox {
+inline double sketch_value(const double d) {
+  return d;
+}
 
-struct Thresholds {
-  Thresholds(const Quartiles<FpNs> &qs)
-      : high_severe_(qs.q3() + 3.0 * qs.iqr()), high_mild_(qs.q3() + 1.5 * qs.iqr()),
-        low_mild_(qs.q1() - 1.5 * qs.iqr()), low_severe_(qs.q1() - 3.0 * qs.iqr()) {}
+// A bounded memory summary of a stream of values.
+//
+// Values are buffered in a stack of compactors, each holding at most `size` values.  When a
+// compactor fills up it is sorted and every other value is promoted to the next compactor with
+// twice the weight, in the style of
+// https://en.wikipedia.org/wiki/Quantile_sketch (MRL/KLL sketches).  Until the first compaction
+// the sketch is exact, afterwards the rank error is roughly log2(n / size) / size.
+//
+// The mean and standard deviation are tracked separately and are always exact.
+template <class T>
+struct QuantileSketch {
+  QuantileSketch(const std::uint32_t size = DEFAULT_SKETCH_SIZE)
+      : size_(size), count_(0), mean_(0.0), m2_(0.0) {
+    assert(size_ >= 2 && "Sketch size must be at least 2");
+  }
 
-  FpNs high_severe() const { return high_severe_; }
+  void add(const T t) {
+    const auto v = sketch_value(t);
 
-  FpNs high_mild() const { return high_mild_; }
+    ++count_;
+    const auto delta = v - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    m2_ += delta * (v - mean_);
 
-  FpNs low_mild() const { return low_mild_; }
+    insert(0, v);
+  }
 
-  FpNs low_severe() const { return low_severe_; }
+  void merge(const QuantileSketch &rhs) {
+    if (rhs.count_ == 0) {
+      return;
+    }
 
-private:
-  FpNs high_severe_;
-  FpNs high_mild_;
-  FpNs low_mild_;
-  FpNs low_severe_;
-};
+    const auto n = static_cast<double>(count_ + rhs.count_);
+    const auto delta = rhs.mean_ - mean_;
+    m2_ += rhs.m2_ + delta * delta * static_cast<double>(count_) *
+                         static_cast<double>(rhs.count_) / n;
+    mean_ += delta * static_cast<double>(rhs.count_) / n;
+    count_ += rhs.count_;
 
-struct Outliers {
-  Outliers(const Times &times) : quartiles_(::velox::quartiles(times)), thresholds_(quartiles_) {
-    for (const auto &t : times) {
-      if (t < thresholds_.low_severe()) {
-        low_severe_.push_back(t);
-      } else if (t < thresholds_.low_mild()) {
-        low_mild_.push_back(t);
-      } else if (t > thresholds_.high_severe()) {
-        high_severe_.push_back(t);
-      } else if (t > thresholds_.high_mild()) {
-        high_mild_.push_back(t);
-      } else {
-        normal_.push_back(t);
+    for (std::size_t level = 0; level < rhs.levels_.size(); ++level) {
+      for (const auto v : rhs.levels_[level]) {
+        insert(level, v);
       }
     }
   }
 
-  const Times &high_severe() const { return high_severe_; }
+  std::uint64_t count() const { return count_; }
 
-  const Times &high_mild() const { return high_mild_; }
+  bool empty() const { return count_ == 0; }
 
-  const Times &low_mild() const { return low_mild_; }
+  std::uint32_t size() const { return size_; }
 
-  const Times &low_severe() const { return low_severe_; }
+  // Number of values actually retained by the sketch
+  std::size_t retained() const {
+    std::size_t n = 0;
+    for (const auto &l : levels_) {
+      n += l.size();
+    }
+    return n;
+  }
 
-  const Times &normal() const { return normal_; }
+  T mean() const {
+    assert(count_ && "Mean calculation requires at least one value");
+    return T(mean_);
+  }
 
-  const Quartiles<FpNs> &quartiles() const { return quartiles_; }
+  T std_dev() const {
+    if (count_ < 2) {
+      return T(0.0);
+    }
 
-  const Thresholds &thresholds() const { return thresholds_; }
+    return T(std::sqrt(m2_ / static_cast<double>(count_ - 1)));
+  }
 
-private:
-  Times high_severe_;
-  Times high_mild_;
-  Times low_mild_;
-  Times low_severe_;
-  Times normal_;
-  Quartiles<FpNs> quartiles_;
-  Thresholds thresholds_;
-};
-}
+  // Same interpolation as percentile_of_sorted, exact as long as no compaction has happened
+  T percentile(const double p) const {
+    assert(count_ && "Samples requires at least one value");
+    assert(p > 0.0 && p <= 100.0 && "Percentile must be between 0 and 100");
 
-namespace velox {
+    const auto items = weighted_items();
 
-namespace {
-  const std::uint32_t DEFAULT_KDE_POINTS = 400;
-}
+    std::uint64_t total = 0;
+    for (const auto &i : items) {
+      total += i.second;
+    }
 
-inline double snpdf(const double x) {
-  // Don't require users to #define _USE_MATH_DEFINES when using msvc so ...
-  const auto PI = 3.14159265358979323846;
-  return std::exp(-x * x / 2.0) / std::sqrt(2.0 * PI);
-}
+    if (total == 1) {
+      return T(items.front().first);
+    }
 
-template <class F>
-void linspace(const double start, const double stop, const std::uint32_t n, F &&f) {
-  if (n == 0) {
-    return;
-  } else if (n == 1) {
-    f(start);
-    return;
-  }
+    const auto rank = (p / 100.0) * static_cast<double>(total - 1);
+    const auto lrank = std::floor(rank);
+    const auto d = rank - lrank;
+    const auto n = static_cast<std::uint64_t>(lrank);
 
-  const auto step = (stop - start) / static_cast<double>(n - 1);
+    const auto lo = value_at_rank(items, n);
+    const auto hi = n + 1 < total ? value_at_rank(items, n + 1) : lo;
 
-  for (std::uint32_t i = 0; i < n - 1; ++i) {
-    f(i * step + start);
+    return T(lo + (hi - lo) * d);
   }
 
-  f(stop);
-}
+  // Fraction of the values less than t, with values equal to t counting as half
+  double proportion_below(const T t) const {
+    assert(count_ && "Samples requires at least one value");
 
-inline double bandwidth_scott(const Times &times) {
-  const auto sd = std_dev(FpRange(times));
-  const auto adjusted_iqr = quartiles(FpRange(times)).iqr() / 1.34;
-  return 1.06 * (std::min)(sd, adjusted_iqr) * std::pow(static_cast<double>(times.size()), -.2);
-}
+    const auto v = sketch_value(t);
+    std::uint64_t below = 0, equal = 0, weight = 1;
 
-inline Points kde(const Times &times, const std::uint32_t num_points) {
-  assert(!times.empty() && "times must not be empty");
+    for (const auto &l : levels_) {
+      for (const auto x : l) {
+        if (x < v) {
+          below += weight;
+        } else if (!(v < x)) {
+          equal += weight;
+        }
+      }
+      weight *= 2;
+    }
 
-  const auto n = static_cast<double>(times.size());
-  const auto bw = bandwidth_scott(times);
+    return (static_cast<double>(below) + static_cast<double>(equal) / 2.0) /
+           static_cast<double>(total_weight());
+  }
 
-  const auto adjustment = 3.0;
-  const auto mm = std::minmax_element(times.begin(), times.end());
-  const auto start = mm.first->count() - adjustment * bw;
-  const auto stop = mm.second->count() + adjustment * bw;
+private:
+  using WeightedItems = std::vector<std::pair<double, std::uint64_t>>;
 
-  const auto kde_calc = [&times, &n, &bw](double x) -> double {
-    double sum = 0.0;
-    for (const auto &t : times) {
-      sum += snpdf((x - t.count()) / bw);
+  void insert(const std::size_t level, const double v) {
+    if (levels_.size() <= level) {
+      levels_.resize(level + 1);
     }
 
-    return sum / n / bw;
-  };
+    levels_[level].push_back(v);
 
-  auto points = vector_with_capacity<Point>(num_points);
+    if (levels_[level].size() >= size_) {
+      compact(level);
+    }
+  }
 
-  linspace(start, stop, num_points, [&kde_calc, &points](double x) {
-    points.emplace_back(x, kde_calc(x));
-  });
+  void compact(const std::size_t level) {
+    auto buffer = std::move(levels_[level]);
+    levels_[level].clear();
 
-  return points;
-}
-}
+    std::sort(buffer.begin(), buffer.end());
 
-#include <ostream>
-#include <iomanip>
+    // An odd value out stays behind so every promoted value stands for exactly two
+    if (buffer.size() % 2 != 0) {
+      levels_[level].push_back(buffer.back());
+      buffer.pop_back();
+    }
 
-namespace velox {
+    // Alternate which half survives so the compaction error doesn't accumulate in one direction
+    const std::size_t offset = (count_ + level) % 2;
+    for (std::size_t i = offset; i < buffer.size(); i += 2) {
+      insert(level + 1, buffer[i]);
+    }
+  }
+
+  std::uint64_t total_weight() const {
+    std::uint64_t total = 0, weight = 1;
+    for (const auto &l : levels_) {
+      total += weight * l.size();
+      weight *= 2;
+    }
+    return total;
+  }
+
+  WeightedItems weighted_items() const {
+    WeightedItems items;
+    items.reserve(retained());
 
-struct StreamFormatRestorer {
-  StreamFormatRestorer(std::ostream &os)
-      : os_(os), flags_(os.flags()), precision_(os.precision()) {}
+    std::uint64_t weight = 1;
+    for (const auto &l : levels_) {
+      for (const auto v : l) {
+        items.emplace_back(v, weight);
+      }
+      weight *= 2;
+    }
+
+    std::sort(items.begin(), items.end());
+    return items;
+  }
 
-  StreamFormatRestorer &operator=(const StreamFormatRestorer &rhs) = delete;
+  static double value_at_rank(const WeightedItems &items, const std::uint64_t rank) {
+    std::uint64_t cumulative = 0;
+    for (const auto &i : items) {
+      cumulative += i.second;
+      if (rank < cumulative) {
+        return i.first;
+      }
+    }
 
-  ~StreamFormatRestorer() {
-    os_.flags(flags_);
-    os_.precision(precision_);
+    return items.back().first;
   }
 
 private:
-  std::ostream &os_;
-  std::ios_base::fmtflags flags_;
-  std::streamsize precision_;
+  std::uint32_t size_;
+  std::uint64_t count_;
+  double mean_;
+  double m2_;
+  std::vector<std::vector<double>> levels_;
 };
-
-inline void format_r2(std::ostream &os, const double n) {
-  const StreamFormatRestorer restorer(os);
-  os << std::setprecision(7) << n;
 }
 
-inline void format_short(std::ostream &os, const double n) {
-  const StreamFormatRestorer restorer(os);
+#include <functional>
 
-  os.setf(std::ios_base::fixed);
+namespace velox {
 
-  if (n < 10.0) {
-    os << std::setprecision(4) << n;
-  } else if (n < 100) {
-    os << std::setprecision(3) << n;
-  } else if (n < 1000) {
-    os << std::setprecision(2) << n;
-  } else {
-    os << std::setprecision(1) << n;
-  }
-}
+// How the value of a custom statistic is formatted by the reporters
+enum class StatisticUnit {
+  // A time in nanoseconds
+  time,
+  // A dimensionless number
+  ratio
+};
 
-inline void format_time(std::ostream &os, const FpNs ns) {
-  if (ns < Ns(1)) {
-    format_short(os, ns.count() * 1e3);
-    os << " ps";
-  } else if (ns < std::chrono::microseconds(1)) {
-    format_short(os, ns.count());
-    os << " ns";
-  } else if (ns < std::chrono::milliseconds(1)) {
-    format_short(os, ns.count() / 1e3);
-    os << " us";
-  } else if (ns < std::chrono::seconds(1)) {
-    format_short(os, ns.count() / 1e6);
-    os << " ms";
-  } else {
-    format_short(os, ns.count() / 1e9);
-    os << " s";
-  }
-}
+// A named statistic of the per iteration times which is bootstrapped along with the built in
+// statistics, using the same resamples.  The function is always given a sorted sample.
+struct CustomStatistic {
+  using Function = std::function<double(const Times &)>;
 
-struct TimeScaler {
-  TimeScaler(const std::string &time_units, const double scale_factor)
-      : units_(time_units), scale_(scale_factor) {}
+  CustomStatistic(const std::string &name, const StatisticUnit unit, Function f)
+      : name_(name), unit_(unit), f_(std::move(f)) {
+    assert(!name_.empty() && "Statistics must be named");
+    assert(f_ && "Statistics must have a function");
+  }
 
-  const std::string &units() const { return units_; }
+  const std::string &name() const { return name_; }
 
-  double scale() const { return scale_; }
+  StatisticUnit unit() const { return unit_; }
 
-  double scale(FpNs ns) const { return ns.count() * scale_; }
+  double operator()(const Times &sorted) const { return f_(sorted); }
 
 private:
-  std::string units_;
-  double scale_;
+  std::string name_;
+  StatisticUnit unit_;
+  Function f_;
 };
 
-inline TimeScaler scaler_for_time(const FpNs ns) {
-  if (ns < Ns(1)) {
-    return TimeScaler("ps", 1000.);
-  } else if (ns < std::chrono::microseconds(1)) {
-    return TimeScaler("ns", 1.);
-  } else if (ns < std::chrono::milliseconds(1)) {
-    return TimeScaler("us", .001);
-  } else if (ns < std::chrono::seconds(1)) {
-    return TimeScaler("ms", .000001);
-  } else {
-    return TimeScaler("s", .000000001);
+namespace detail {
+  // Sums times[first, last) with independent accumulators so the loop vectorises without
+  // needing to reassociate floating point additions
+  inline double sum_of_slice(const Times &times, const std::size_t first, const std::size_t last) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    auto i = first;
+    for (; i + 4 <= last; i += 4) {
+      s0 += times[i].count();
+      s1 += times[i + 1].count();
+      s2 += times[i + 2].count();
+      s3 += times[i + 3].count();
+    }
+    for (; i < last; ++i) {
+      s0 += times[i].count();
+    }
+    return (s0 + s1) + (s2 + s3);
   }
-}
-
-inline std::string js_string_escape(const std::string &s) {
-  std::string escaped;
-  escaped.reserve(s.size());
 
-  for (auto c : s) {
-    switch (c) {
-    case '\'':
-      escaped += "\\'";
-      break;
-    case '"':
-      escaped += "\\\"";
-      break;
-    case '\\':
-      escaped += "\\\\";
-      break;
-    default:
-      escaped += c;
-      break;
+  // The sum of the squared deviations from m of times[first, last)
+  inline double sum_of_squares_of_slice(const Times &times,
+                                        const std::size_t first,
+                                        const std::size_t last,
+                                        const double m) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    auto i = first;
+    for (; i + 4 <= last; i += 4) {
+      const auto d0 = times[i].count() - m, d1 = times[i + 1].count() - m;
+      const auto d2 = times[i + 2].count() - m, d3 = times[i + 3].count() - m;
+      s0 += d0 * d0;
+      s1 += d1 * d1;
+      s2 += d2 * d2;
+      s3 += d3 * d3;
     }
+    for (; i < last; ++i) {
+      const auto d = times[i].count() - m;
+      s0 += d * d;
+    }
+    return (s0 + s1) + (s2 + s3);
   }
-
-  return escaped;
-}
 }
 
-namespace velox {
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wweak-vtables"
-#endif
-struct Reporter {
-  virtual ~Reporter() = 0;
-
-  virtual void suite_starting(const std::string &clock, bool is_steady) {
-    unused(clock, is_steady);
-  }
+// The p-th percentile of the per iteration times, named like "p99"
+inline CustomStatistic percentile_statistic(const double p) {
+  assert(p > 0.0 && p <= 100.0 && "Percentile must be between 0 and 100");
 
-  virtual void estimate_clock_cost_starting() {}
-  virtual void estimate_clock_cost_ended(FpNs cost) { unused(cost); }
+  std::ostringstream name;
+  name << "p" << p;
 
-  virtual void warm_up_starting(Ms ms) { unused(ms); }
-  virtual void warm_up_ended(const ItersForDurationNs &wu) { unused(wu); }
-  virtual void warm_up_failed(const ItersForDurationNs &wu) { unused(wu); }
+  return CustomStatistic(name.str(), StatisticUnit::time, [p](const Times &sorted) {
+    return percentile_of_sorted(FpRange(sorted), p);
+  });
+}
 
-  virtual void benchmark_starting(const std::string &name) { unused(name); }
-  virtual void benchmark_ended() {}
+// The mean of the per iteration times after dropping the given proportion of the times from
+// each end
+inline CustomStatistic trimmed_mean_statistic(const double proportion) {
+  assert(proportion >= 0.0 && proportion < 0.5 && "Proportion must be between 0 and .5");
 
-  virtual void measurement_collection_starting(std::uint32_t num_measurements,
-                                               FpNs measurement_time) {
-    unused(num_measurements, measurement_time);
-  }
+  std::ostringstream name;
+  name << "trimmed mean " << proportion * 100 << "%";
 
-  virtual void measurement_collection_ended(const Measurements &measurements,
-                                            const Times &times,
-                                            const Outliers &outliers) {
-    unused(measurements, times, outliers);
-  }
+  return CustomStatistic(name.str(), StatisticUnit::time, [proportion](const Times &sorted) {
+    assert(!sorted.empty() && "Trimmed mean requires at least one value");
 
-  virtual void estimate_statistics_starting(std::uint32_t num_resamples) { unused(num_resamples); }
+    const auto n = sorted.size();
+    const auto k = static_cast<std::size_t>(std::floor(static_cast<double>(n) * proportion));
+    const auto first = (std::min)(k, (n - 1) / 2), last = n - first;
 
-  virtual void estimate_statistics_ended(const EstimatedStatistics &statistics) {
-    unused(statistics);
-  }
+    return detail::sum_of_slice(sorted, first, last) / static_cast<double>(last - first);
+  });
+}
 
-  virtual void suite_ended() {}
-};
+// The standard deviation of the per iteration times relative to their mean
+inline CustomStatistic coefficient_of_variation_statistic() {
+  return CustomStatistic("CV", StatisticUnit::ratio, [](const Times &sorted) {
+    const auto n = sorted.size();
+    if (n < 2) {
+      return 0.0;
+    }
 
-inline Reporter::~Reporter() {
+    const auto m = detail::sum_of_slice(sorted, 0, n) / static_cast<double>(n);
+    const auto ss = detail::sum_of_squares_of_slice(sorted, 0, n, m);
+    return std::sqrt(ss / static_cast<double>(n - 1)) / m;
+  });
 }
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
 }
 
 namespace velox {
 
+// How much of each statistic's bootstrap distribution is kept once its estimate has been made
+enum class DistributionStorage {
+  // Every resampled value
+  full,
+  // A fixed size QuantileSketch
+  sketch,
+  // Only the estimate.  A sketch is still used while the estimate is being made.
+  none
+};
+
+// How confidence intervals are calculated from the bootstrap distributions
+enum class IntervalMethod {
+  // The percentiles of the bootstrap distribution
+  percentile,
+  // Efron's bias-corrected and accelerated percentiles with the acceleration estimated by the
+  // jackknife.  These are accurate with far fewer resamples than percentile intervals.
+  bca
+};
+
+// How the measurements are resampled when bootstrapping
+enum class ResampleMethod {
+  // Each measurement is drawn independently, which assumes the measurements are iid
+  iid,
+  // Blocks of a fixed number of consecutive measurements, wrapping around at the end
+  moving_block,
+  // Blocks of consecutive measurements with geometrically distributed lengths
+  stationary
+};
+
+// What estimate_statistics does with the severe outliers (beyond Q1 - 3 * IQR or Q3 + 3 * IQR)
+enum class OutlierPolicy {
+  // Analyze every measurement
+  keep,
+  // Leave out the measurements whose times are severe outliers
+  exclude,
+  // Clamp the times of severe outliers to the severe thresholds
+  winsorize
+};
+
+// How lines are fit to the measurements, both through the origin for the LLS statistic and with
+// an intercept for the slope and overhead statistics
+enum class RegressionMethod {
+  // Least squares
+  least_squares,
+  // Huber M-estimation, which down-weights points far from the line
+  huber,
+  // The median of the slopes between every pair of measurements
+  theil_sen
+};
+
+// The order and number of iterations of the measurements
+enum class IterationSchedule {
+  // 2, 3, 4, ... times the base number of iterations in increasing order
+  linear,
+  // The linear iteration counts in a random order
+  shuffled_linear,
+  // Iteration counts growing by a constant factor, with the same total as linear
+  geometric,
+  // Iteration counts spread evenly over the linear range by a randomly offset golden ratio
+  // sequence, so consecutive measurements differ a lot in length
+  low_discrepancy
+};
+
+// How the number of iterations of each measurement is chosen
+enum class SamplingMode {
+  // Flat sampling when the warm up shows an iteration takes longer than the flat sampling
+  // threshold, linear sampling otherwise
+  automatic,
+  // The iteration counts follow the iteration schedule so the time per iteration can be found
+  // by regression
+  linear,
+  // Every measurement runs the same number of iterations, for functions too slow for the
+  // linear schedule to finish in a reasonable time
+  flat
+};
+
 struct VeloxConfig {
   VeloxConfig()
-      : confidence_level_(0.95), measurement_time_(10000), num_resamples_(100000),
-        num_measurements_(100), warm_up_time_(5000), estimate_clock_cost_(false) {}
+      : confidence_level_(0.95), measurement_time_(0), num_resamples_(0), num_measurements_(0),
+        warm_up_time_(0), verification_warm_up_time_(500),
+        warm_up_tolerance_(0.2), estimate_clock_cost_(false),
+        min_measurement_ticks_(1000),
+        distribution_storage_(DistributionStorage::full), sketch_size_(DEFAULT_SKETCH_SIZE),
+        interval_method_(IntervalMethod::percentile), resample_method_(ResampleMethod::iid),
+        block_length_(0.0), adaptive_resampling_(false), resample_tolerance_(0.01),
+        min_resamples_(2000), resample_chunk_size_(1000), outlier_policy_(OutlierPolicy::keep),
+        regression_method_(RegressionMethod::least_squares),
+        iteration_schedule_(IterationSchedule::linear), sampling_mode_(SamplingMode::automatic),
+        flat_sampling_threshold_(10), flat_num_measurements_(10), quick_mode_(false),
+        deferred_analysis_(false), resume_(false), shard_index_(0), shard_count_(1),
+        force_merge_(false) {}
 
   // Used when calculating the https://en.wikipedia.org/wiki/Confidence_interval
   // of the various statistics
@@ -1230,17 +1490,31 @@ struct VeloxConfig {
     return *this;
   }
 
-  std::chrono::milliseconds measurement_time() const { return measurement_time_; }
+  // If it isn't set the default depends on quick mode
+  std::chrono::milliseconds measurement_time() const {
+    if (measurement_time_.count()) {
+      return measurement_time_;
+    }
+
+    return Ms(quick_mode_ ? 1000 : 10000);
+  }
 
   // Number of resamples to use for
   // http://en.wikipedia.org/wiki/Bootstrapping_%28statistics%29
+  // If it isn't set the default depends on the interval method
   VeloxConfig &num_resamples(const std::uint32_t n) {
     assert(n && "Must resample at least once");
     num_resamples_ = n;
     return *this;
   }
 
-  std::uint32_t num_resamples() const { return num_resamples_; }
+  std::uint32_t num_resamples() const {
+    if (num_resamples_) {
+      return num_resamples_;
+    }
+
+    return interval_method_ == IntervalMethod::bca ? 10000 : 100000;
+  }
 
   // The number of measurements to take
   VeloxConfig &num_measurements(const std::uint32_t n) {
@@ -1249,7 +1523,14 @@ struct VeloxConfig {
     return *this;
   }
 
-  std::uint32_t num_measurements() const { return num_measurements_; }
+  // If it isn't set the default depends on quick mode
+  std::uint32_t num_measurements() const {
+    if (num_measurements_) {
+      return num_measurements_;
+    }
+
+    return quick_mode_ ? 20 : 100;
+  }
 
   // How long to warm up for
   VeloxConfig &warm_up_time(const Ms ms) {
@@ -1258,7 +1539,43 @@ struct VeloxConfig {
     return *this;
   }
 
-  std::chrono::milliseconds warm_up_time() const { return warm_up_time_; }
+  // If it isn't set the default depends on quick mode
+  std::chrono::milliseconds warm_up_time() const {
+    if (warm_up_time_.count()) {
+      return warm_up_time_;
+    }
+
+    return Ms(quick_mode_ ? 500 : 5000);
+  }
+
+  // A file which keeps each benchmark's warm up between runs.  A benchmark found in it only warms
+  // up for verification_warm_up_time, to check the time per iteration is still within
+  // warm_up_tolerance of the stored warm up's, instead of the full warm_up_time.  Empty (the
+  // default) disables it.
+  VeloxConfig &warm_up_cache(const std::string &path) {
+    warm_up_cache_ = path;
+    return *this;
+  }
+
+  const std::string &warm_up_cache() const { return warm_up_cache_; }
+
+  VeloxConfig &verification_warm_up_time(const Ms ms) {
+    assert(ms.count() > 0 && "Must warm up for at least 1 ms");
+    verification_warm_up_time_ = ms;
+    return *this;
+  }
+
+  Ms verification_warm_up_time() const { return verification_warm_up_time_; }
+
+  // How much the verification's time per iteration may differ from the stored one, as a fraction
+  // of the smaller of the two, for the stored warm up to be used.  The default is 0.2.
+  VeloxConfig &warm_up_tolerance(const double tolerance) {
+    assert(tolerance >= 0.0 && "Tolerance must not be negative");
+    warm_up_tolerance_ = tolerance;
+    return *this;
+  }
+
+  double warm_up_tolerance() const { return warm_up_tolerance_; }
 
   // Whether to estimate the clock cost
   // Currently the clock cost is only reported, it is not used in any
@@ -1270,1232 +1587,4543 @@ struct VeloxConfig {
 
   bool estimate_clock_cost() const { return estimate_clock_cost_; }
 
-private:
-  double confidence_level_;
-  Ms measurement_time_;
-  std::uint32_t num_resamples_;
-  std::uint32_t num_measurements_;
-  Ms warm_up_time_;
-  bool estimate_clock_cost_;
-};
-}
+  // The minimum length of each measurement, in multiples of the clock's resolution which is
+  // estimated when the suite starts.  The iteration counts are raised when needed so the clock's
+  // granularity adds at most about 1 / ticks relative error.  0 disables the minimum.
+  //
+  // The minimum is capped at measurement_time / num_measurements, so on a coarse clock the run
+  // takes at most about (num_measurements + 1) / 4 times the measurement time with the linear
+  // schedule, and measurement_time once flat sampling is used.  Measurements which are still
+  // shorter than the minimum are reported with Reporter::measurements_too_short; a longer
+  // measurement_time lets them reach it.
+  VeloxConfig &min_measurement_ticks(const std::uint32_t ticks) {
+    min_measurement_ticks_ = ticks;
+    return *this;
+  }
 
-namespace velox {
+  std::uint32_t min_measurement_ticks() const { return min_measurement_ticks_; }
 
-namespace detail {
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wweak-vtables"
-#endif
-  struct StopwatchConcept {
-    virtual ~StopwatchConcept() = default;
-    virtual void start() = 0;
-    virtual void stop() = 0;
-    virtual std::uint64_t iters() const = 0;
-  };
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
-  template <class C>
-  struct StopwatchModel final : StopwatchConcept {
+  // How much of the bootstrap distributions to keep.  Keeping every resample costs
+  // num_resamples values per statistic per benchmark which adds up quickly for large suites.
+  VeloxConfig &distribution_storage(const DistributionStorage storage) {
+    distribution_storage_ = storage;
+    return *this;
+  }
 
-    StopwatchModel(const std::uint64_t iterations) : iters_(iterations) {
-      assert(iters_ && "Must iterate at least once");
-    }
+  DistributionStorage distribution_storage() const { return distribution_storage_; }
 
-    void start() override { start_time_ = C::now(); }
+  // The number of values each level of a QuantileSketch holds when the bootstrap
+  // distributions aren't fully stored.  Larger sketches give more accurate confidence intervals.
+  VeloxConfig &sketch_size(const std::uint32_t n) {
+    assert(n >= 2 && "Sketch size must be at least 2");
+    sketch_size_ = n;
+    return *this;
+  }
 
-    void stop() override { stop_time_ = C::now(); }
+  std::uint32_t sketch_size() const { return sketch_size_; }
 
-    std::uint64_t iters() const override { return iters_; }
+  // How the confidence intervals are calculated from the bootstrap distributions
+  VeloxConfig &interval_method(const IntervalMethod method) {
+    interval_method_ = method;
+    return *this;
+  }
 
-    Ns elapsed() const { return std::chrono::duration_cast<Ns>(stop_time_ - start_time_); }
+  IntervalMethod interval_method() const { return interval_method_; }
 
-  private:
-    TimePoint<C> start_time_;
-    TimePoint<C> stop_time_;
-    std::uint64_t iters_;
-  };
-}
+  // How to resample the measurements.  The block bootstraps keep runs of consecutive
+  // measurements together so the confidence intervals account for autocorrelation.
+  VeloxConfig &resample_method(const ResampleMethod method) {
+    resample_method_ = method;
+    return *this;
+  }
 
-struct Stopwatch {
-  template <class F>
-  Stopwatch(detail::StopwatchConcept &sw, F &&f)
-      : sw_(sw)
-#ifndef NDEBUG
-        ,
-        measure_called_(false)
-#endif
-  {
-    run(std::forward<F>(f), IsCallable<F, Stopwatch &>());
+  ResampleMethod resample_method() const { return resample_method_; }
+
+  // The (mean) block length for the block bootstraps.  0 selects it automatically.
+  VeloxConfig &block_length(const double length) {
+    assert((length >= 1.0 || !(length > 0.0)) && "Block length must be 0 or at least 1");
+    block_length_ = length;
+    return *this;
   }
 
-  Stopwatch &operator=(const Stopwatch &rhs) = delete;
+  double block_length() const { return block_length_; }
 
-  template <class F>
-  void measure(F &&f) {
-#ifndef NDEBUG
-    assert(!measure_called_ && "Measure should only be called once");
-#endif
-    sw_.start();
-    for (auto i = sw_.iters(); i != 0; --i) {
-      f();
-    }
-    sw_.stop();
-#ifndef NDEBUG
-    measure_called_ = true;
-#endif
+  // Bootstrap in chunks and stop once the confidence intervals and standard errors of every
+  // statistic stop moving, instead of always using num_resamples.  num_resamples is then the
+  // maximum number of resamples.
+  VeloxConfig &adaptive_resampling(const bool adaptive) {
+    adaptive_resampling_ = adaptive;
+    return *this;
   }
 
-private:
-  template <class F>
-  void run(F &&f, std::false_type) {
-    sw_.start();
-    for (auto i = sw_.iters(); i != 0; --i) {
-      f();
-    }
-    sw_.stop();
-  }
+  bool adaptive_resampling() const { return adaptive_resampling_; }
 
-  template <class F>
-  void run(F &&f, std::true_type) {
-    std::forward<F>(f)(*this);
-#ifndef NDEBUG
-    assert(measure_called_ && "The callable being timed must call measure");
-#endif
+  // How much the estimates may change between chunks for adaptive resampling to stop, relative
+  // to the width of the confidence interval and the standard error
+  VeloxConfig &resample_tolerance(const double tolerance) {
+    assert(tolerance > 0.0 && "Tolerance must be positive");
+    resample_tolerance_ = tolerance;
+    return *this;
   }
 
-private:
-  detail::StopwatchConcept &sw_;
-#ifndef NDEBUG
-  bool measure_called_;
-#endif
-};
-}
+  double resample_tolerance() const { return resample_tolerance_; }
 
-namespace velox {
+  // The minimum number of resamples to use with adaptive resampling
+  VeloxConfig &min_resamples(const std::uint32_t n) {
+    min_resamples_ = n;
+    return *this;
+  }
 
-template <class C, class F>
-struct Benchmark {
-  Benchmark(F &f) : f_(f) {}
+  std::uint32_t min_resamples() const { return min_resamples_; }
 
-  Benchmark &operator=(const Benchmark &rhs) = delete;
+  // The number of resamples between convergence checks with adaptive resampling
+  VeloxConfig &resample_chunk_size(const std::uint32_t n) {
+    assert(n && "Chunks must contain at least one resample");
+    resample_chunk_size_ = n;
+    return *this;
+  }
 
-  std::pair<ItersForDurationNs, bool> warm_up(const Duration<C> duration) {
-    std::uint64_t iters = 1;
+  std::uint32_t resample_chunk_size() const { return resample_chunk_size_; }
 
-    const auto start = C::now();
+  // What to do with severe outliers before estimating statistics.  Excluding or winsorizing them
+  // keeps interrupts, page faults, etc. on noisy machines from inflating the mean, SD and LLS.
+  VeloxConfig &outlier_policy(const OutlierPolicy policy) {
+    outlier_policy_ = policy;
+    return *this;
+  }
 
-    for (;;) {
-      const auto elapsed = run(iters);
+  OutlierPolicy outlier_policy() const { return outlier_policy_; }
 
-      if (C::now() - start > duration) {
-        return {ItersForDurationNs(iters, elapsed), true};
-      }
+  // How lines are fit to the measurements for the LLS, slope and overhead statistics
+  VeloxConfig &regression_method(const RegressionMethod method) {
+    regression_method_ = method;
+    return *this;
+  }
 
-      const auto prev_iters = iters;
-      iters *= 2;
+  RegressionMethod regression_method() const { return regression_method_; }
 
-      if (iters == 0) {
-        return {ItersForDurationNs(prev_iters, elapsed), false};
-      }
-    }
+  // How many iterations each measurement runs, and in what order.  With the linear schedule
+  // periodic interference (timer ticks, housekeeping threads, etc.) can line up with the
+  // increasing measurement lengths and bias the regression.
+  VeloxConfig &iteration_schedule(const IterationSchedule schedule) {
+    iteration_schedule_ = schedule;
+    return *this;
   }
 
-  Ns run(const std::uint64_t iters) {
-    detail::StopwatchModel<C> sm(iters);
-    Stopwatch(sm, f_);
-    return sm.elapsed();
-  }
+  IterationSchedule iteration_schedule() const { return iteration_schedule_; }
 
-  Measurements bench(const std::uint32_t num_measurements, const std::uint64_t base_iters) {
-    auto measurements = vector_with_capacity<Measurement>(num_measurements);
+  // How the number of iterations of each measurement is chosen.  The regression statistics
+  // (LLS, slope, overhead and r^2) are meaningless with flat sampling so only the per iteration
+  // statistics are reported.
+  VeloxConfig &sampling_mode(const SamplingMode mode) {
+    sampling_mode_ = mode;
+    return *this;
+  }
 
-    std::uint64_t iters = base_iters;
-    std::generate_n(std::back_inserter(measurements), num_measurements, [this, base_iters, &iters] {
-      iters += base_iters;
-      return Measurement(iters, run(iters));
-    });
+  SamplingMode sampling_mode() const { return sampling_mode_; }
 
-    return measurements;
+  // With automatic sampling, flat sampling is used when an iteration takes longer than this
+  VeloxConfig &flat_sampling_threshold(const Ms ms) {
+    flat_sampling_threshold_ = ms;
+    return *this;
   }
 
-private:
-  F &f_;
-};
-
-inline Times times_from_measurements(const Measurements &measurements) {
-  auto ts = vector_with_capacity<FpNs>(measurements.size());
+  Ms flat_sampling_threshold() const { return flat_sampling_threshold_; }
 
-  for (const auto &m : measurements) {
-    ts.push_back(FpNs{static_cast<double>(m.duration().count()) / static_cast<double>(m.iters())});
+  // The number of measurements to take with flat sampling, used instead of num_measurements
+  VeloxConfig &flat_num_measurements(const std::uint32_t n) {
+    assert(n > 1 && "At least two samples must be taken");
+    flat_num_measurements_ = n;
+    return *this;
   }
 
-  return ts;
-}
-
-template <class C, class F>
-std::pair<Measurements, bool> measure(F &&f, const VeloxConfig &config, Reporter &reporter) {
-  reporter.warm_up_starting(config.warm_up_time());
+  std::uint32_t flat_num_measurements() const { return flat_num_measurements_; }
 
-  Benchmark<C, F> b(f);
+  // Quick mode trades accuracy for speed while iterating on a change: confidence intervals come
+  // from analytic approximations instead of the bootstrap and no KDE is computed.  Enabling it
+  // also shortens the default warm up (500 ms) and measurement time (1 s) and takes 20
+  // measurements by default.  Values which are set explicitly are kept, whatever the order.
+  VeloxConfig &quick_mode(const bool quick) {
+    quick_mode_ = quick;
+    return *this;
+  }
 
-  const auto wu_result = b.warm_up(config.warm_up_time());
-  const auto &wu = wu_result.first;
+  bool quick_mode() const { return quick_mode_; }
 
-  if (!wu_result.second || !wu.duration().count()) {
-    reporter.warm_up_failed(wu);
-    return {Measurements(), false};
+  // Deferred analysis measures every benchmark in the suite before analysing any of them, so the
+  // analysis can't disturb later measurements, and then analyses them in parallel.  Nothing is
+  // reported until the suite ends and custom statistics must be safe to call concurrently.
+  VeloxConfig &deferred_analysis(const bool deferred) {
+    deferred_analysis_ = deferred;
+    return *this;
   }
 
-  reporter.warm_up_ended(wu);
-
-  const auto mean_execution_time = static_cast<double>(wu.duration().count()) / wu.iters();
-  const auto mt =
-      static_cast<double>(std::chrono::duration_cast<Ns>(config.measurement_time()).count());
-  const auto nm = config.num_measurements();
-  const auto base_iters = static_cast<std::uint64_t>(
-      std::ceil(2.0 * mt / mean_execution_time / static_cast<double>(nm * (nm + 1))));
-  const auto total_iters = [&config, &base_iters]() -> std::uint64_t {
-    std::uint64_t sum = 0;
-    auto iters = base_iters;
-    for (std::uint32_t i = 0; i < config.num_measurements(); ++i) {
-      iters += base_iters;
-      sum += iters;
-    }
-    return sum;
-  }();
+  bool deferred_analysis() const { return deferred_analysis_; }
 
-  const auto estimated_time = FpNs{total_iters * mean_execution_time};
+  // Writes each benchmark's measurements and estimates to this file as soon as it has been
+  // analyzed, so a suite which is killed can be resumed.  With deferred analysis that is only
+  // when the suite ends.  Empty (the default) disables it.
+  VeloxConfig &checkpoint(const std::string &path) {
+    checkpoint_ = path;
+    return *this;
+  }
 
-  reporter.measurement_collection_starting(nm, estimated_time);
+  const std::string &checkpoint() const { return checkpoint_; }
 
-  return {b.bench(nm, base_iters), true};
-}
+  // Resuming skips the benchmarks already in the checkpoint file and reports them again from
+  // their stored measurements, so the reports cover the whole suite.  Otherwise the checkpoint
+  // file is started afresh.
+  VeloxConfig &resume(const bool r) {
+    resume_ = r;
+    return *this;
+  }
 
-template <class C, class F>
-void benchmark(const std::string &name, F &&f, const VeloxConfig &config, Reporter &reporter) {
-  reporter.benchmark_starting(name);
+  bool resume() const { return resume_; }
 
-  const auto measure_result = measure<C>(std::forward<F>(f), config, reporter);
-  if (!measure_result.second) {
-    return;
+  // Only runs the benchmarks in shard index of count (see in_shard), so a suite can be split
+  // between several identical machines.  Each shard should write a checkpoint which is merged
+  // afterwards.  The default of one shard runs every benchmark.
+  VeloxConfig &shard(const std::uint32_t index, const std::uint32_t count) {
+    assert(count > 0 && index < count && "Shard index must be less than the number of shards");
+    shard_index_ = index;
+    shard_count_ = count;
+    return *this;
   }
 
-  const auto &measurements = measure_result.first;
-  const auto times = times_from_measurements(measurements);
-  const Outliers outliers(times);
+  std::uint32_t shard_index() const { return shard_index_; }
 
-  reporter.measurement_collection_ended(measurements, times, outliers);
+  std::uint32_t shard_count() const { return shard_count_; }
 
-  reporter.estimate_statistics_starting(config.num_resamples());
+  // Reports the benchmarks in the checkpoints of the shards of a suite from their stored
+  // measurements instead of running them, in the order the benchmarks are registered, so the
+  // reports cover the whole suite.  Benchmarks which aren't in any of the checkpoints are run.
+  // The checkpoints must have been written in the same environment as the merging run (see
+  // environment_fingerprint).  Any other checkpoint is refused, which is reported with
+  // Reporter::merge_refused, and its benchmarks are left out rather than run.
+  VeloxConfig &merge(const std::vector<std::string> &shard_checkpoints) {
+    merge_ = shard_checkpoints;
+    return *this;
+  }
 
-  const auto statistics =
-      estimate_statistics(measurements, times, config.num_resamples(), config.confidence_level());
+  const std::vector<std::string> &merge() const { return merge_; }
 
-  reporter.estimate_statistics_ended(statistics);
-  reporter.benchmark_ended();
-}
+  // Merges the shard checkpoints even if they were written in other environments
+  VeloxConfig &force_merge(const bool f) {
+    force_merge_ = f;
+    return *this;
+  }
 
-template <class C>
-FpNs estimate_clock_cost(const VeloxConfig &config, Reporter &reporter) {
-  reporter.estimate_clock_cost_starting();
+  bool force_merge() const { return force_merge_; }
 
-  const auto measure_result = measure<C>([]() { C::now(); }, config, reporter);
-  const auto cost =
-      measure_result.second ? median(times_from_measurements(measure_result.first)) : FpNs{0.0};
+  // Adds a statistic to bootstrap along with the built in ones, e.g. percentile_statistic(99)
+  VeloxConfig &add_statistic(const CustomStatistic &statistic) {
+    statistics_.push_back(statistic);
+    return *this;
+  }
 
-  reporter.estimate_clock_cost_ended(cost);
+  const std::vector<CustomStatistic> &statistics() const { return statistics_; }
 
-  return cost;
-}
+private:
+  double confidence_level_;
+  Ms measurement_time_;
+  std::uint32_t num_resamples_;
+  std::uint32_t num_measurements_;
+  Ms warm_up_time_;
+  std::string warm_up_cache_;
+  Ms verification_warm_up_time_;
+  double warm_up_tolerance_;
+  bool estimate_clock_cost_;
+  std::uint32_t min_measurement_ticks_;
+  DistributionStorage distribution_storage_;
+  std::uint32_t sketch_size_;
+  IntervalMethod interval_method_;
+  ResampleMethod resample_method_;
+  double block_length_;
+  bool adaptive_resampling_;
+  double resample_tolerance_;
+  std::uint32_t min_resamples_;
+  std::uint32_t resample_chunk_size_;
+  OutlierPolicy outlier_policy_;
+  RegressionMethod regression_method_;
+  IterationSchedule iteration_schedule_;
+  SamplingMode sampling_mode_;
+  Ms flat_sampling_threshold_;
+  std::uint32_t flat_num_measurements_;
+  bool quick_mode_;
+  bool deferred_analysis_;
+  std::string checkpoint_;
+  bool resume_;
+  std::uint32_t shard_index_;
+  std::uint32_t shard_count_;
+  std::vector<std::string> merge_;
+  bool force_merge_;
+  std::vector<CustomStatistic> statistics_;
+};
 }
 
 namespace velox {
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wweak-vtables"
-#endif
-struct TextReporter : Reporter {
-  TextReporter(std::ostream &os) : os_(os) {}
 
-  TextReporter &operator=(const TextReporter &rhs) = delete;
+// Autocovariances of the series at lags 0 through max_lag (inclusive)
+inline std::vector<double> autocovariances(const Times &series, const std::size_t max_lag) {
+  const auto n = series.size();
+  assert(n && "Autocovariance calculation requires at least one value");
 
-  void suite_starting(const std::string &clock, bool is_steady) override {
-    os_ << "Benchmarking with `" << clock << "` which is " << (is_steady ? "steady" : "unsteady")
-        << "\n";
+  const auto m = mean(FpRange(series));
+  auto acv = vector_with_capacity<double>(max_lag + 1);
+
+  for (std::size_t k = 0; k <= max_lag; ++k) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i + k < n; ++i) {
+      sum += (series[i].count() - m) * (series[i + k].count() - m);
+    }
+    acv.push_back(sum / static_cast<double>(n));
   }
 
-  void estimate_clock_cost_starting() override { os_ << "Estimating the cost of the clock\n"; }
+  return acv;
+}
 
-  void estimate_clock_cost_ended(FpNs cost) override {
-    os_ << "> Median: " << cost.count() << " ns\n\n";
+namespace detail {
+  // Flat-top lag window from Politis & White (2004)
+  inline double flat_top(const double t) {
+    const auto a = std::abs(t);
+    if (a <= 0.5) {
+      return 1.0;
+    } else if (a <= 1.0) {
+      return 2.0 * (1.0 - a);
+    }
+    return 0.0;
   }
 
-  void benchmark_starting(const std::string &name) override {
-    os_ << "Benchmarking " << name << "\n";
-  }
+  // The long run variance and its weighted sum of |k| * R(k) using the flat-top window with the
+  // bandwidth picked by the rule of Politis & White (2004)
+  struct LongRunVariance {
+    LongRunVariance(const Times &series) : r0_(0.0), g0_(0.0), g_(0.0) {
+      const auto n = series.size();
+      const auto log_n = std::log10(static_cast<double>(n));
+      const auto kn = static_cast<std::size_t>((std::max)(5.0, std::ceil(std::sqrt(log_n))));
+      const auto m_max = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n)))) +
+                         kn;
+      const auto max_lag = (std::min)(m_max + kn, n - 1);
+
+      const auto acv = autocovariances(series, max_lag);
+      r0_ = acv[0];
+
+      if (!(r0_ > 0.0)) {
+        return;
+      }
 
-  void warm_up_starting(Ms ms) override { os_ << "> Warming up for " << ms.count() << " ms\n"; }
+      // The smallest lag after which kn autocorrelations in a row are insignificant
+      const auto threshold = 2.0 * std::sqrt(log_n / static_cast<double>(n));
+      std::size_t m_hat = 0, run = 0;
+      for (std::size_t k = 1; k <= max_lag && run < kn; ++k) {
+        if (std::abs(acv[k] / r0_) < threshold) {
+          ++run;
+        } else {
+          run = 0;
+          m_hat = k;
+        }
+      }
 
-  void warm_up_failed(const ItersForDurationNs &wu) override {
-    os_ << "> Warm up failed\n";
-    os_ << "  > " << wu.iters() << " iterations of the function took ";
-    format_time(os_, wu.duration());
-    os_ << "\n";
-    os_ << "  > The function is unable to be benchmarked because it takes so little time.\n";
-  }
+      const auto big_m = (std::min)((std::min)(2 * m_hat, m_max), max_lag);
 
-  void measurement_collection_starting(std::uint32_t num_measurements,
-                                       FpNs measurement_time) override {
-    os_ << "> Collecting " << num_measurements << " measurements in estimated ";
+      g0_ = r0_;
+      for (std::size_t k = 1; k <= big_m; ++k) {
+        const auto w =
+            flat_top(static_cast<double>(k) / static_cast<double>(big_m)) * acv[k];
+        g0_ += 2.0 * w;
+        g_ += 2.0 * static_cast<double>(k) * w;
+      }
+    }
 
-    format_time(os_, measurement_time);
-    os_ << "\n";
+    double r0() const { return r0_; }
+
+    double g0() const { return g0_; }
+
+    double g() const { return g_; }
+
+  private:
+    double r0_;
+    double g0_;
+    double g_;
+  };
+}
+
+// Automatic block length selection for the block bootstraps
+// Politis & White (2004) with the correction from Patton, Politis & White (2009)
+// Returns 1 for ResampleMethod::iid or when the series doesn't appear to be autocorrelated
+inline double optimal_block_length(const Times &series, const ResampleMethod method) {
+  const auto n = series.size();
+  if (method == ResampleMethod::iid || n < 4) {
+    return 1.0;
   }
 
-  void measurement_collection_ended(const Measurements &,
-                                    const Times &,
-                                    const Outliers &outliers) override {
-    const auto num_high_severe = outliers.high_severe().size();
-    const auto num_high_mild = outliers.high_mild().size();
-    const auto num_low_mild = outliers.low_mild().size();
-    const auto num_low_severe = outliers.low_severe().size();
-    const auto total = num_high_severe + num_high_mild + num_low_mild + num_low_severe;
+  const detail::LongRunVariance lrv(series);
+  if (!(lrv.g0() > 0.0)) {
+    return 1.0;
+  }
 
-    const auto sample_size = total + outliers.normal().size();
+  const auto d = (method == ResampleMethod::stationary ? 2.0 : 4.0 / 3.0) * lrv.g0() * lrv.g0();
+  const auto b = std::cbrt(2.0 * lrv.g() * lrv.g() / d * static_cast<double>(n));
 
-    const auto percent = [sample_size](decltype(total) n) {
-      return 100.0 * static_cast<double>(n) / static_cast<double>(sample_size);
-    };
+  const auto nd = static_cast<double>(n);
+  const auto b_max = std::ceil((std::min)(3.0 * std::sqrt(nd), nd / 3.0));
 
-    os_ << "> Found " << total << " outliers among " << sample_size << " measurements ("
-        << percent(total) << "%)\n";
+  return (std::min)((std::max)(b, 1.0), b_max);
+}
 
-    if (total == 0) {
+// A diagnostic of how badly the measurements violate the iid assumption of the ordinary
+// bootstrap.  Measurements are taken in order so drift from thermal throttling, frequency
+// scaling, etc. shows up as positive autocorrelation.
+struct Autocorrelation {
+  Autocorrelation(const Times &times, const VeloxConfig &config)
+      : sample_size_(times.size()), lag1_(0.0),
+        critical_value_(1.96 / std::sqrt(static_cast<double>(times.size()))),
+        effective_sample_size_(static_cast<double>(times.size())),
+        method_(config.resample_method()), block_length_(1.0) {
+    assert(!times.empty() && "times must not be empty");
+
+    if (times.size() < 2) {
       return;
     }
 
-    const auto print = [this, &percent](decltype(total) n, const char *const type) {
-      if (n == 0) {
-        return;
-      }
+    const detail::LongRunVariance lrv(times);
+    if (!(lrv.r0() > 0.0)) {
+      return;
+    }
 
-      os_ << "  > " << n << " (" << percent(n) << "%) " << type << "\n";
-    };
+    lag1_ = autocovariances(times, 1)[1] / lrv.r0();
 
-    print(num_low_severe, "low severe");
-    print(num_low_mild, "low mild");
-    print(num_high_mild, "high mild");
-    print(num_high_severe, "high severe");
-  }
+    if (lrv.g0() > 0.0) {
+      const auto n = static_cast<double>(sample_size_);
+      effective_sample_size_ = (std::min)((std::max)(n * lrv.r0() / lrv.g0(), 1.0), n);
+    }
 
-  void estimate_statistics_starting(std::uint32_t num_resamples) override {
-    os_ << "> estimating statistics\n";
-    os_ << "  > bootstrapping sample with " << num_resamples << " resamples\n";
+    block_length_ = config.block_length() > 0.0 ? config.block_length()
+                                                : optimal_block_length(times, method_);
   }
 
-  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
-    auto format_estimate = [this](const Estimate<FpNs> &e) { format(e, format_time); };
+  std::size_t sample_size() const { return sample_size_; }
 
-    os_ << "  > mean   ";
-    format_estimate(statistics.mean().estimate());
-    os_ << "  > median ";
-    format_estimate(statistics.median().estimate());
-    os_ << "  > SD     ";
-    format_estimate(statistics.std_dev().estimate());
-    os_ << "  > MAD    ";
-    format_estimate(statistics.median_abs_dev().estimate());
-    os_ << "  > LLS    ";
-    format_estimate(statistics.linear_least_squares().estimate());
-    os_ << "  > r^2    ";
-    format(statistics.r_squared().estimate(), format_r2);
-    os_ << "\n";
-  }
+  // The lag 1 autocorrelation of the per iteration times
+  double lag1() const { return lag1_; }
 
-private:
-  template <class E, class F>
-  void format(const E &e, F &&f) {
-    f(os_, e.point());
-    os_ << " +/- ";
-    f(os_, e.standard_error());
-    os_ << " [";
-    f(os_, e.lower_bound());
-    os_ << " ";
-    f(os_, e.upper_bound());
-    os_ << "] ";
-    os_ << e.confidence_level() * 100 << "% CI\n";
-  }
+  // Autocorrelations larger than this are significant at the 95% level for an iid sample
+  double critical_value() const { return critical_value_; }
+
+  bool significant() const { return std::abs(lag1_) > critical_value_; }
+
+  // The number of independent measurements the measurements are worth when estimating the mean
+  double effective_sample_size() const { return effective_sample_size_; }
+
+  ResampleMethod resample_method() const { return method_; }
+
+  // The block length used when resampling, 1 for ResampleMethod::iid
+  double block_length() const { return method_ == ResampleMethod::iid ? 1.0 : block_length_; }
 
 private:
-  std::ostream &os_;
+  std::size_t sample_size_;
+  double lag1_;
+  double critical_value_;
+  double effective_sample_size_;
+  ResampleMethod method_;
+  double block_length_;
 };
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
 }
 
 namespace velox {
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wweak-vtables"
-#endif
-struct HtmlReporter : Reporter {
-  HtmlReporter(std::ostream &os) : os_(os), num_benchmarks(0) {}
 
-  HtmlReporter &operator=(const HtmlReporter &rhs) = delete;
+// The order independent statistics of a benchmark's per iteration times.  The times are sorted
+// once here and everything which needs a sorted sample, its quartiles or its moments
+// (Outliers, kde, estimate_statistics and the reporters) shares this instead of making its own
+// sorted copy.
+struct SampleSummary {
+  SampleSummary(const Times &times)
+      : sorted_(sorted_copy(times)), quartiles_(quartiles_of_sorted(sorted_)),
+        mean_(::velox::mean(FpRange(sorted_))), std_dev_(::velox::std_dev(FpRange(sorted_))) {}
 
-  void suite_starting(const std::string &clock, bool is_steady) override {
-    os_ << template_begin() << "\n";
+  // The times in ascending order
+  const Times &sorted() const { return sorted_; }
 
-    os_ << "var clockInfo = {\n";
-    os_ << "    name : '" << js_string_escape(clock) << "',\n";
-    os_ << "    steadiness : '" << (is_steady ? "steady" : "unsteady") << "',\n";
-    os_ << "};\n\n";
+  std::size_t size() const { return sorted_.size(); }
 
-    os_ << "var benchmarkData = {\n";
-  }
-
-  void benchmark_starting(const std::string &name) override { current_benchmark_ = name; }
+  FpNs min() const { return sorted_.front(); }
 
-  void warm_up_ended(const ItersForDurationNs &) override {
-    os_ << "benchmark_" << ++num_benchmarks << " : {\n";
-    os_ << "    name : '" << js_string_escape(current_benchmark_) << "',\n";
-  }
+  FpNs max() const { return sorted_.back(); }
 
-  void measurement_collection_ended(const Measurements &measurements,
-                                    const Times &times,
-                                    const Outliers &outliers) override {
-    assert(!measurements.empty() && !times.empty() && "Measurements are required");
-    assert(measurements.size() == times.size() && "Times should be derived from measurements");
+  const Quartiles<FpNs> &quartiles() const { return quartiles_; }
 
-    output_summary(times, outliers);
-    output_kde(times);
-    output_times(times, outliers);
-    output_raw_measurements(measurements);
-  }
+  FpNs median() const { return quartiles_.q2(); }
 
-  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
-    os_ << "    confidence_level : '" << statistics.mean().estimate().confidence_level() * 100
-        << "% CI',\n";
+  FpNs mean() const { return FpNs(mean_); }
 
-    auto format_estimate =
-        [this](const char *const name, const Estimate<FpNs> &e) { format(name, e, format_time); };
+  FpNs std_dev() const { return FpNs(std_dev_); }
 
-    format_estimate("mean", statistics.mean().estimate());
-    format_estimate("median", statistics.median().estimate());
-    format_estimate("sd", statistics.std_dev().estimate());
-    format_estimate("mad", statistics.median_abs_dev().estimate());
-    format_estimate("lls", statistics.linear_least_squares().estimate());
-    format("r2", statistics.r_squared().estimate(), format_r2);
-    os_ << "},\n";
-  }
+private:
+  static Times sorted_copy(const Times &times) {
+    assert(!times.empty() && "times must not be empty");
 
-  void suite_ended() override {
-    os_ << "};\n";
-    os_ << template_end() << "\n";
+    auto sorted = times;
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
   }
 
 private:
-  template <class E, class F>
-  void format(const char *const name, const E &e, F &&f) {
-    os_ << "    " << name << " : {\n";
+  Times sorted_;
+  Quartiles<FpNs> quartiles_;
+  double mean_;
+  double std_dev_;
+};
+}
 
-    os_ << "        lowerBound : '";
-    f(os_, e.lower_bound());
-    os_ << "',\n";
+#include <array>
 
-    os_ << "        estimate : '";
-    f(os_, e.point());
-    os_ << " &plusmn; ";
-    f(os_, e.standard_error());
-    os_ << "',\n";
+namespace velox {
 
-    os_ << "        upperBound : '";
-    f(os_, e.upper_bound());
-    os_ << "'\n    },\n";
-  }
+struct Thresholds {
+  Thresholds(const Quartiles<FpNs> &qs)
+      : high_severe_(qs.q3() + 3.0 * qs.iqr()), high_mild_(qs.q3() + 1.5 * qs.iqr()),
+        low_mild_(qs.q1() - 1.5 * qs.iqr()), low_severe_(qs.q1() - 3.0 * qs.iqr()) {}
 
-  void output_summary(const Times &times, const Outliers &outliers) {
-    const auto mm = std::minmax_element(times.begin(), times.end());
+  FpNs high_severe() const { return high_severe_; }
 
-    os_ << "    summary : {\n";
+  FpNs high_mild() const { return high_mild_; }
 
-    os_ << "        min : '";
-    format_time(os_, *mm.first);
-    os_ << "',\n";
+  FpNs low_mild() const { return low_mild_; }
 
-    os_ << "        q1 : '";
-    format_time(os_, outliers.quartiles().q1());
-    os_ << "',\n";
+  FpNs low_severe() const { return low_severe_; }
 
-    os_ << "        mean : '";
-    format_time(os_, FpNs(mean(FpRange(times))));
-    os_ << "',\n";
+private:
+  FpNs high_severe_;
+  FpNs high_mild_;
+  FpNs low_mild_;
+  FpNs low_severe_;
+};
 
-    os_ << "        median : '";
-    format_time(os_, median(times));
-    os_ << "',\n";
+// Where a time falls relative to the Thresholds
+enum class OutlierSeverity : std::uint8_t { low_severe, low_mild, normal, high_mild, high_severe };
 
-    os_ << "        q3 : '";
-    format_time(os_, outliers.quartiles().q3());
-    os_ << "',\n";
+// The classification of every time, one byte per time in the same order as the times, along with
+// the number of times of each severity
+struct Outliers {
+  Outliers(const Times &times) : Outliers(times, SampleSummary(times)) {}
 
-    os_ << "        max : '";
-    format_time(os_, *mm.second);
-    os_ << "'\n";
+  Outliers(const Times &times, const SampleSummary &summary)
+      : quartiles_(summary.quartiles()), thresholds_(quartiles_) {
+    counts_.fill(0);
+    severities_.reserve(times.size());
 
-    os_ << "    },\n";
+    for (const auto &t : times) {
+      const auto severity = classify(t);
+      severities_.push_back(severity);
+      ++counts_[static_cast<std::size_t>(severity)];
+    }
   }
 
-  void output_kde(const Times &times) {
-    auto points = kde(times, DEFAULT_KDE_POINTS);
+  // The severity of times[i]
+  OutlierSeverity severity(const std::size_t i) const { return severities_[i]; }
 
-    const auto max_x =
-        std::max_element(points.begin(), points.end(), [](const Point &lhs, const Point &rhs) {
-                           return lhs.x() < rhs.x();
-                         })->x();
+  const std::vector<OutlierSeverity> &severities() const { return severities_; }
 
-    const auto scaler = scaler_for_time(FpNs(max_x));
-    const auto recip_scale = 1 / scaler.scale();
+  // The number of times with the given severity
+  std::size_t count(const OutlierSeverity severity) const {
+    return counts_[static_cast<std::size_t>(severity)];
+  }
 
-    for (auto &p : points) {
-      p = Point(p.x() * scaler.scale(), p.y() * recip_scale);
-    }
+  // The number of times which aren't OutlierSeverity::normal
+  std::size_t num_outliers() const { return size() - count(OutlierSeverity::normal); }
 
-    const auto min_max_y =
-        std::minmax_element(points.begin(), points.end(), [](const Point &lhs, const Point &rhs) {
-          return lhs.y() < rhs.y();
-        });
+  std::size_t size() const { return severities_.size(); }
 
-    const double min_y = min_max_y.first->y(), max_y = min_max_y.second->y();
-    const double mu = mean(FpRange(times)) * scaler.scale();
-    const double med = median(FpRange(times)) * scaler.scale();
+  const Quartiles<FpNs> &quartiles() const { return quartiles_; }
 
-    os_ << "    kde : {\n";
-    os_ << "        units : '" << scaler.units() << "',\n";
-    os_ << "        meanData : [[" << mu << ", " << min_y << "], [" << mu << ", " << max_y
-        << "]],\n";
-    os_ << "        medianData : [[" << med << ", " << min_y << "], [" << med << ", " << max_y
-        << "]],\n";
-    os_ << "        data : [";
+  const Thresholds &thresholds() const { return thresholds_; }
 
-    const char *sep = "";
-    for (const auto &p : points) {
-      os_ << sep << "[" << p.x() << "," << p.y() << "]";
-      sep = ", ";
+  OutlierSeverity classify(const FpNs t) const {
+    if (t < thresholds_.low_severe()) {
+      return OutlierSeverity::low_severe;
+    } else if (t < thresholds_.low_mild()) {
+      return OutlierSeverity::low_mild;
+    } else if (t > thresholds_.high_severe()) {
+      return OutlierSeverity::high_severe;
+    } else if (t > thresholds_.high_mild()) {
+      return OutlierSeverity::high_mild;
     }
-    os_ << "]\n    },\n";
+    return OutlierSeverity::normal;
   }
 
-  void output_times(const Times &times, const Outliers &outliers) {
-    const auto max_time = *std::max_element(times.begin(), times.end());
-    const auto scaler = scaler_for_time(max_time);
+private:
+  std::vector<OutlierSeverity> severities_;
+  std::array<std::size_t, 5> counts_;
+  Quartiles<FpNs> quartiles_;
+  Thresholds thresholds_;
+};
 
-    auto format_outlier_line =
-        [&](const char *const name, const Times &outs, const FpNs threshold) {
-      os_ << "        " << name << " : [";
-      if (!outs.empty()) {
-        os_ << "[1, " << scaler.scale(threshold) << "], ";
-        os_ << "[" << times.size() << ", " << scaler.scale(threshold) << "]";
-      }
-      os_ << "],\n";
-    };
+// How much the outliers inflate the variance of the sample, as categorized by criterion
+enum class OutlierEffect { unaffected, slight, moderate, severe };
+
+inline const char *outlier_effect_name(const OutlierEffect effect) {
+  switch (effect) {
+  case OutlierEffect::unaffected:
+    break;
+  case OutlierEffect::slight:
+    return "slight";
+  case OutlierEffect::moderate:
+    return "moderate";
+  case OutlierEffect::severe:
+    return "severe";
+  }
 
-    os_ << "    samples : {\n";
-    os_ << "        units : '" << scaler.units() << "',\n";
-    format_outlier_line(
-        "highSevereData", outliers.high_severe(), outliers.thresholds().high_severe());
-    format_outlier_line("highMildData", outliers.high_mild(), outliers.thresholds().high_mild());
-    format_outlier_line("lowMildData", outliers.low_mild(), outliers.thresholds().low_mild());
-    format_outlier_line("lowSevereData", outliers.low_severe(), outliers.thresholds().low_severe());
-    os_ << "        data : [";
+  return "unaffected";
+}
 
-    const char *sep = "";
-    for (std::size_t i = 0; i < times.size(); ++i) {
-      os_ << sep << "[" << i + 1 << "," << scaler.scale(times[i]) << "]";
-      sep = ", ";
+// The proportion of the sample's variance which is explained by outliers rather than by the
+// function's own variation, using the model from Haskell's criterion library.  The sample is
+// treated as a normal "good" distribution contaminated by a uniform distribution of outliers and
+// the fraction is the smallest share of the variance the contamination could account for.
+struct OutlierVariance {
+  OutlierVariance(const FpNs mean, const FpNs std_dev, const std::size_t sample_size)
+      : fraction_(0.0) {
+    const auto a = static_cast<double>(sample_size);
+    const auto sb2 = std_dev.count() * std_dev.count();
+
+    if (!(sb2 > 0.0) || sample_size == 0) {
+      return;
     }
-    os_ << "]\n    },\n";
-  }
 
-  void output_raw_measurements(const Measurements &measurements) {
-    const auto scaler = scaler_for_time(measurements.back().duration());
-    const auto points = measurements_to_points(measurements);
+    const auto ua = mean.count() / a;
+    const auto ug_min = ua / 2.0;
+    const auto sg = (std::min)(ug_min / 4.0, std_dev.count() / std::sqrt(a));
+    const auto sg2 = sg * sg;
 
-    const auto sl = slope(points);
+    const auto var_out = [=](const double c) {
+      const auto ac = a - c;
+      return (ac / a) * (sb2 - ac * sg2);
+    };
 
-    os_ << "    rawMeasurements : {\n";
-    os_ << "        units : '" << scaler.units() << "',\n";
-    os_ << "        regression : [[0, 0], [" << measurements.back().iters() << ", "
-        << scaler.scale(FpNs{static_cast<double>(measurements.back().iters()) * sl}) << "]],\n";
-    os_ << "        data : [";
+    const auto c_max = [=](const double x) {
+      const auto k = ua - x;
+      const auto ad = a * k * k;
+      const auto k0 = -a * ad;
+      const auto k1 = sb2 - a * sg2 + ad;
+      const auto det = k1 * k1 - 4.0 * sg2 * k0;
+      return std::floor(-2.0 * k0 / (k1 + std::sqrt(det)));
+    };
 
-    const char *sep = "";
-    for (const auto &m : measurements) {
-      os_ << sep << "[" << m.iters() << "," << scaler.scale(m.duration()) << "]";
-      sep = ", ";
-    }
-    os_ << "]\n    },\n";
+    const auto c = (std::min)(c_max(0.0), c_max(ug_min));
+    fraction_ = (std::min)((std::max)((std::min)(var_out(1.0), var_out(c)) / sb2, 0.0), 1.0);
   }
 
-private:
-  template <std::size_t N>
-  static std::string string_from_cstrs(const char *const (&cstrs)[N]) {
-    std::string s;
-    for (auto cstr : cstrs) {
-      s += cstr;
+  explicit OutlierVariance(const SampleSummary &summary)
+      : OutlierVariance(summary.mean(), summary.std_dev(), summary.size()) {}
+
+  // Between 0 and 1
+  double fraction() const { return fraction_; }
+
+  OutlierEffect effect() const {
+    if (fraction_ < 0.01) {
+      return OutlierEffect::unaffected;
+    } else if (fraction_ < 0.1) {
+      return OutlierEffect::slight;
+    } else if (fraction_ < 0.5) {
+      return OutlierEffect::moderate;
     }
-    return s;
+    return OutlierEffect::severe;
   }
 
-  static const std::string &template_begin() {
-    static const char *const pieces[] = {
-R"***^***(<!doctype html>
-<html lang="">
-    <head>
-        <meta charset="utf-8">
-        <meta http-equiv="X-UA-Compatible" content="IE=edge">
-        <title>Benchmark Results - generated by velox</title>
-        <meta name="description" content="">
-        <meta name="viewport" content="width=device-width, initial-scale=1">
-
-        <style>
-            /*! normalize.css v3.0.1 | MIT License | git.io/normalize */
+private:
+  double fraction_;
+};
+}
 
-            /**
-             * 1. Set default font family to sans-serif.
-             * 2. Prevent iOS text size adjust after orientation change, without disabling
-             *    user zoom.
-             */
+namespace velox {
 
-            html {
-              font-family: sans-serif; /* 1 */
-              -ms-text-size-adjust: 100%; /* 2 */
-              -webkit-text-size-adjust: 100%; /* 2 */
-            }
+// The measurements and times statistics are estimated from once VeloxConfig::outlier_policy has
+// been applied
+struct AnalyzedSample {
+  AnalyzedSample(Measurements &&ms, Times &&ts, const std::size_t num_adjusted)
+      : measurements_(std::move(ms)), times_(std::move(ts)), num_adjusted_(num_adjusted) {}
 
-            /**
-             * Remove default margin.
-             */
+  const Measurements &measurements() const { return measurements_; }
 
-            body {
-              margin: 0;
-            }
+  const Times &times() const { return times_; }
 
-            /* HTML5 display definitions
-               ========================================================================== */
+  // The number of measurements which were excluded or winsorized
+  std::size_t num_adjusted() const { return num_adjusted_; }
 
-            /**
-             * Correct `block` display not defined for any HTML5 element in IE 8/9.
-             * Correct `block` display not defined for `details` or `summary` in IE 10/11 and Firefox.
-             * Correct `block` display not defined for `main` in IE 11.
-             */
+private:
+  Measurements measurements_;
+  Times times_;
+  std::size_t num_adjusted_;
+};
 
-            article,
-            aside,
-            details,
-            figcaption,
-            figure,
-            footer,
-            header,
-            hgroup,
-            main,
-            nav,
-            section,
-            summary {
-              display: block;
-            }
+inline AnalyzedSample apply_outlier_policy(const Measurements &measurements,
+                                           const Times &times,
+                                           const Outliers &outliers,
+                                           const OutlierPolicy policy) {
+  assert(measurements.size() == times.size() && "Times should be derived from measurements");
+  assert(outliers.size() == times.size() && "Outliers should be classified from times");
 
-            /**
-             * 1. Correct `inline-block` display not defined in IE 8/9.
-             * 2. Normalize vertical alignment of `progress` in Chrome, Firefox, and Opera.
-             */
+  auto ms = vector_with_capacity<Measurement>(measurements.size());
+  auto ts = vector_with_capacity<FpNs>(times.size());
+  std::size_t num_adjusted = 0;
 
-            audio,
-            canvas,
-            progress,
-            video {
-              display: inline-block; /* 1 */
-              vertical-align: baseline; /* 2 */
-            }
+  const auto &thresholds = outliers.thresholds();
 
-            /**
-             * Prevent modern browsers from displaying `audio` without controls.
-             * Remove excess height in iOS 5 devices.
-             */
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    const auto severity = outliers.severity(i);
+    const auto severe =
+        severity == OutlierSeverity::low_severe || severity == OutlierSeverity::high_severe;
 
-            audio:not([controls]) {
-              display: none;
-              height: 0;
-            }
+    if (!severe || policy == OutlierPolicy::keep) {
+      ms.push_back(measurements[i]);
+      ts.push_back(times[i]);
+      continue;
+    }
 
-            /**
-             * Address `[hidden]` styling not present in IE 8/9/10.
-             * Hide the `template` element in IE 8/9/11, Safari, and Firefox < 22.
-             */
+    ++num_adjusted;
 
-            [hidden],
-            template {
-              display: none;
-            }
+    if (policy == OutlierPolicy::winsorize) {
+      const auto t = severity == OutlierSeverity::low_severe ? thresholds.low_severe()
+                                                              : thresholds.high_severe();
+      const auto iters = measurements[i].iters();
+      ms.emplace_back(iters,
+                      Ns(static_cast<Ns::rep>(std::round(t.count() * static_cast<double>(iters)))),
+                      measurements[i].start());
+      ts.push_back(t);
+    }
+  }
 
-            /* Links
-               ========================================================================== */
+  return AnalyzedSample(std::move(ms), std::move(ts), num_adjusted);
+}
 
-            /**
-             * Remove the gray background color from active links in IE 10.
-             */
+// The slope fit by the given method
+inline double fit_slope(const Points &points, const RegressionMethod method) {
+  switch (method) {
+  case RegressionMethod::least_squares:
+    break;
+  case RegressionMethod::huber:
+    return huber_slope(points);
+  case RegressionMethod::theil_sen:
+    return theil_sen_slope(points);
+  }
 
-            a {
-              background: transparent;
-            }
+  return slope(points);
+}
 
-            /**
-             * Improve readability when focused and also mouse hovered in all browsers.
-             */
+// The line with an intercept fit by the given method
+inline Line fit_line(const Points &points, const RegressionMethod method) {
+  switch (method) {
+  case RegressionMethod::least_squares:
+    break;
+  case RegressionMethod::huber:
+    return huber_line(points);
+  case RegressionMethod::theil_sen:
+    return theil_sen_line(points);
+  }
 
-            a:active,
-            a:hover {
-              outline: 0;
-            }
+  return ols_line(points);
+}
+}
 
-            /* Text-level semantics
-               ========================================================================== */
+#include <random>
+#include <future>
 
-            /**
-             * Address styling not present in IE 8/9/10/11, Safari, and Chrome.
-             */
+namespace velox {
 
-            abbr[title] {
-              border-bottom: 1px dotted;
-            }
+template <class T>
+struct Estimate {
+  Estimate(const T p, const T sd, const T lb, const T ub, const double cl)
+      : point_(p), standard_error_(sd), lower_bound_(lb), upper_bound_(ub), confidence_level_(cl) {
+    assert(cl > 0.0 && cl < 1.0 && "Confidence level must be between 0 and 1");
+  }
 
-            /**
-             * Address style set to `bolder` in Firefox 4+, Safari, and Chrome.
-             */
+  T point() const { return point_; }
 
-            b,
-            strong {
-              font-weight: bold;
-            }
+  T standard_error() const { return standard_error_; }
 
-            /**
-             * Address styling not present in Safari and Chrome.
-             */
+  T lower_bound() const { return lower_bound_; }
 
-            dfn {
-              font-style: italic;
-            }
+  T upper_bound() const { return upper_bound_; }
 
-            /**
-             * Address variable `h1` font-size and margin within `section` and `article`
-             * contexts in Firefox 4+, Safari, and Chrome.
-             */
+  double confidence_level() const { return confidence_level_; }
 
-            h1 {
-              font-size: 2em;
-              margin: 0.67em 0;
-            }
+private:
+  T point_;
+  T standard_error_;
+  T lower_bound_;
+  T upper_bound_;
+  double confidence_level_;
+};
 
-            /**
-             * Address styling not present in IE 8/9.
-             */
+// The percentiles of a bootstrap distribution which bound a confidence interval
+struct IntervalPercentiles {
+  IntervalPercentiles(const double lower_p, const double upper_p)
+      : lower_(lower_p), upper_(upper_p) {}
 
-            mark {
-              background: #ff0;
-              color: #000;
-            }
+  double lower() const { return lower_; }
 
-            /**
-             * Address inconsistent and variable font size in all browsers.
-             */
+  double upper() const { return upper_; }
 
-            small {
-              font-size: 80%;
-            }
+private:
+  double lower_;
+  double upper_;
+};
 
-            /**
-             * Prevent `sub` and `sup` affecting `line-height` in all browsers.
-             */
+inline IntervalPercentiles percentile_interval(const double cl) {
+  return IntervalPercentiles(50.0 * (1.0 - cl), 50.0 * (1.0 + cl));
+}
 
-            sub,
-            sup {
-              font-size: 75%;
-              line-height: 0;
-              position: relative;
-              vertical-align: baseline;
-            }
+// Efron's bias-corrected and accelerated interval
+// http://en.wikipedia.org/wiki/Bootstrapping_%28statistics%29#Methods_for_bootstrap_confidence_intervals
+// proportion_below is the fraction of the bootstrap distribution below the point estimate and
+// acceleration is usually calculated with jackknife_acceleration
+inline IntervalPercentiles bca_interval(const double proportion_below,
+                                        const double acceleration,
+                                        const std::uint64_t num_resamples,
+                                        const double cl) {
+  // Keep the bias correction finite when the point estimate is outside the bootstrap
+  // distribution
+  const auto half = 0.5 / static_cast<double>(num_resamples);
+  const auto z0 = normal_quantile((std::min)((std::max)(proportion_below, half), 1.0 - half));
+
+  const auto adjust = [z0, acceleration](const double alpha) -> double {
+    const auto z = z0 + normal_quantile(alpha);
+    const auto p = 100.0 * normal_cdf(z0 + z / (1.0 - acceleration * z));
+    return (std::min)((std::max)(p, 1e-9), 100.0);
+  };
 
-            sup {
-              top: -0.5em;
-            }
+  return IntervalPercentiles(adjust(0.5 * (1.0 - cl)), adjust(0.5 * (1.0 + cl)));
+}
 
-            sub {
-              bottom: -0.25em;
-            }
+// Acceleration for bca_interval estimated from the leave one out values of the statistic
+template <class T, class F>
+double jackknife_acceleration(const std::vector<T> &sample, F &&statistic) {
+  if (sample.size() < 3) {
+    return 0.0;
+  }
 
-            /* Embedded content
-               ========================================================================== */
+  auto buffer = vector_with_capacity<T>(sample.size() - 1);
+  auto estimates = vector_with_capacity<double>(sample.size());
 
-            /**
-             * Remove border when inside `a` element in IE 8/9/10.
-             */
+  for (auto it = sample.begin(); it != sample.end(); ++it) {
+    buffer.assign(sample.begin(), it);
+    buffer.insert(buffer.end(), it + 1, sample.end());
+    estimates.push_back(statistic(static_cast<const std::vector<T> &>(buffer)));
+  }
 
-            img {
-              border: 0;
-            }
+  const auto m = mean(estimates);
+  double num = 0.0, den = 0.0;
+  for (const auto e : estimates) {
+    const auto d = m - e;
+    num += d * d * d;
+    den += d * d;
+  }
 
-            /**
-             * Correct overflow not hidden in IE 9/10/11.
-             */
+  if (!(den > 0.0)) {
+    return 0.0;
+  }
 
-            svg:not(:root) {
-              overflow: hidden;
-            }
+  return num / (6.0 * std::pow(den, 1.5));
+}
 
-            /* Grouping content
-               ========================================================================== */
+// Fraction of the sorted values less than t, with values equal to t counting as half
+template <class T>
+double proportion_below_of_sorted(const std::vector<T> &sorted, const T t) {
+  assert(!sorted.empty() && "Samples requires at least one value");
 
-            /**
-             * Address margin not present in IE 8/9 and Safari.
-             */
+  const auto range = std::equal_range(sorted.begin(), sorted.end(), t);
+  const auto below = range.first - sorted.begin();
+  const auto equal = range.second - range.first;
 
-            figure {
-              margin: 1em 40px;
-            }
+  return (static_cast<double>(below) + static_cast<double>(equal) / 2.0) /
+         static_cast<double>(sorted.size());
+}
 
-            /**
-             * Address differences between Firefox and other browsers.
-             */
+inline Estimate<FpNs> make_estimate_of_sorted(const FpNs p,
+                                              const Times &bootstrap,
+                                              const IntervalPercentiles &interval,
+                                              const double cl) {
+  const FpRange r(bootstrap);
 
-            hr {
-              -moz-box-sizing: content-box;
-              box-sizing: content-box;
-              height: 0;
-            }
+  return Estimate<FpNs>(p,
+                        FpNs(std_dev(r)),
+                        FpNs(percentile_of_sorted(r, interval.lower())),
+                        FpNs(percentile_of_sorted(r, interval.upper())),
+                        cl);
+}
 
-            /**
-             * Contain overflow in all browsers.
-             */
+inline Estimate<double> make_estimate_of_sorted(const double p,
+                                                const std::vector<double> &bootstrap,
+                                                const IntervalPercentiles &interval,
+                                                const double cl) {
+  return Estimate<double>(p,
+                          std_dev(bootstrap),
+                          percentile_of_sorted(bootstrap, interval.lower()),
+                          percentile_of_sorted(bootstrap, interval.upper()),
+                          cl);
+}
 
-            pre {
-              overflow: auto;
-            }
+inline Estimate<FpNs> make_estimate(const FpNs p, Times bootstrap, const double cl) {
+  std::sort(bootstrap.begin(), bootstrap.end());
+  return make_estimate_of_sorted(p, bootstrap, percentile_interval(cl), cl);
+}
 
-            /**
-             * Address odd `em`-unit font size rendering in all browsers.
-             */
+inline Estimate<double>
+make_estimate(const double p, std::vector<double> bootstrap, const double cl) {
+  std::sort(bootstrap.begin(), bootstrap.end());
+  return make_estimate_of_sorted(p, bootstrap, percentile_interval(cl), cl);
+}
 
-            code,
-            kbd,
-            pre,
-            samp {
-              font-family: monospace, monospace;
-              font-size: 1em;
-            }
+template <class T>
+Estimate<T> make_estimate(const T p,
+                          const QuantileSketch<T> &bootstrap,
+                          const IntervalPercentiles &interval,
+                          const double cl) {
+  return Estimate<T>(p,
+                     bootstrap.std_dev(),
+                     bootstrap.percentile(interval.lower()),
+                     bootstrap.percentile(interval.upper()),
+                     cl);
+}
 
-            /* Forms
-               ========================================================================== */
+template <class T>
+Estimate<T> make_estimate(const T p, const QuantileSketch<T> &bootstrap, const double cl) {
+  return make_estimate(p, bootstrap, percentile_interval(cl), cl);
+}
 
-            /**
-             * Known limitation: by default, Chrome and Safari on OS X allow very limited
-             * styling of `select`, unless a `border` property is set.
-             */
+template <class T>
+struct EstimateAndDistribution {
+  EstimateAndDistribution(const Estimate<T> &est, std::vector<T> &&dist)
+      : estimate_(est), storage_(DistributionStorage::full), distribution_(std::move(dist)) {}
 
-            /**
-             * 1. Correct color not being inherited.
-             *    Known issue: affects color of disabled elements.
-             * 2. Correct font properties not being inherited.
-             * 3. Address margins set differently in Firefox 4+, Safari, and Chrome.
-             */
+  EstimateAndDistribution(const Estimate<T> &est, QuantileSketch<T> &&sk)
+      : estimate_(est), storage_(DistributionStorage::sketch), sketch_(std::move(sk)) {}
 
-            button,
-            input,
-            optgroup,
-            select,
-            textarea {
-              color: inherit; /* 1 */
-              font: inherit; /* 2 */
-              margin: 0; /* 3 */
-            }
+  EstimateAndDistribution(const Estimate<T> &est)
+      : estimate_(est), storage_(DistributionStorage::none) {}
 
-            /**
-             * Address `overflow` set to `hidden` in IE 8/9/10/11.
-             */
+  const Estimate<T> &estimate() const { return estimate_; }
 
-            button {
-              overflow: visible;
-            }
+  DistributionStorage storage() const { return storage_; }
 
-            /**
-             * Address inconsistent `text-transform` inheritance for `button` and `select`.
-             * All other form control elements do not inherit `text-transform` values.
-             * Correct `button` style inheritance in Firefox, IE 8/9/10/11, and Opera.
-             * Correct `select` style inheritance in Firefox.
-             */
+  // Every resampled value, empty unless the storage is DistributionStorage::full
+  const std::vector<T> &distribution() const { return distribution_; }
 
-            button,
-            select {
-              text-transform: none;
-            }
+  // Empty unless the storage is DistributionStorage::sketch
+  const QuantileSketch<T> &sketch() const { return sketch_; }
 
-            /**
-             * 1. Avoid the WebKit bug in Android 4.0.* where (2) destroys native `audio`
-             *    and `video` controls.
-             * 2. Correct inability to style clickable `input` types in iOS.
-             * 3. Improve usability and consistency of cursor style between image-type
-             *    `input` and others.
-             */
+private:
+  Estimate<T> estimate_;
+  DistributionStorage storage_;
+  std::vector<T> distribution_;
+  QuantileSketch<T> sketch_;
+};
 
-            button,
-            html input[type="button"], /* 1 */
-            input[type="reset"],
-            input[type="submit"] {
-              -webkit-appearance: button; /* 2 */
-              cursor: pointer; /* 3 */
-            }
+// Collects the bootstrap distribution of a statistic in the representation chosen by
+// VeloxConfig::distribution_storage and turns it into an estimate using
+// VeloxConfig::interval_method
+template <class T>
+struct BootstrapDistribution {
+  BootstrapDistribution(const VeloxConfig &config)
+      : storage_(config.distribution_storage()), method_(config.interval_method()),
+        cl_(config.confidence_level()), sketch_(config.sketch_size()), num_sorted_(0),
+        acceleration_(0.0), has_acceleration_(false) {
+    if (storage_ == DistributionStorage::full) {
+      values_.reserve(config.num_resamples());
+    }
+  }
 
-            /**
-             * Re-set default cursor for disabled elements.
-             */
+  void add(const T t) {
+    if (storage_ == DistributionStorage::full) {
+      values_.push_back(t);
+    } else {
+      sketch_.add(t);
+    }
+  }
 
-            button[disabled],
-            html input[disabled] {
-              cursor: default;
-            }
+  // The estimate from the resamples added so far.  acceleration is only called for
+  // IntervalMethod::bca, and only once.
+  template <class F>
+  Estimate<T> estimate(const T point, F &&acceleration) {
+    if (storage_ == DistributionStorage::full) {
+      const auto &sorted = sorted_values();
+      const auto interval =
+          make_interval(proportion_below_of_sorted(sorted, point), sorted.size(), acceleration);
+      return make_estimate_of_sorted(point, sorted, interval, cl_);
+    }
 
-            /**
-             * Remove inner padding and border in Firefox 4+.
-             */
+    const auto interval =
+        make_interval(sketch_.proportion_below(point), sketch_.count(), acceleration);
+    return make_estimate(point, sketch_, interval, cl_);
+  }
 
-            button::-moz-focus-inner,
-            input::-moz-focus-inner {
-              border: 0;
-              padding: 0;
-            }
+  template <class F>
+  EstimateAndDistribution<T> finish(const T point, F &&acceleration) {
+    const auto e = estimate(point, acceleration);
+
+    switch (storage_) {
+    case DistributionStorage::full:
+      sorted_.clear();
+      sorted_.shrink_to_fit();
+      return EstimateAndDistribution<T>(e, std::move(values_));
+    case DistributionStorage::sketch:
+      return EstimateAndDistribution<T>(e, std::move(sketch_));
+    case DistributionStorage::none:
+      break;
+    }
 
-            /**
-             * Address Firefox 4+ setting `line-height` on `input` using `!important` in
-             * the UA stylesheet.
-             */
+    return EstimateAndDistribution<T>(e);
+  }
 
-            input {
-              line-height: normal;
-            }
+private:
+  // values_ has to stay in resample order so a sorted copy is kept up to date by merging in
+  // the values added since the last estimate
+  const std::vector<T> &sorted_values() {
+    using Diff = typename std::vector<T>::difference_type;
+    const auto old_size = static_cast<Diff>(sorted_.size());
+
+    sorted_.insert(sorted_.end(), values_.begin() + static_cast<Diff>(num_sorted_), values_.end());
+    std::sort(sorted_.begin() + old_size, sorted_.end());
+    std::inplace_merge(sorted_.begin(), sorted_.begin() + old_size, sorted_.end());
+    num_sorted_ = values_.size();
+    return sorted_;
+  }
 
-            /**
-             * It's recommended that you don't attempt to style these elements.
-             * Firefox's implementation doesn't respect box-sizing, padding, or width.
-             *
-             * 1. Address box sizing set to `content-box` in IE 8/9/10.
-             * 2. Remove excess padding in IE 8/9/10.
-             */
+  template <class F>
+  IntervalPercentiles
+  make_interval(const double proportion_below, const std::uint64_t n, F &&acceleration) {
+    switch (method_) {
+    case IntervalMethod::percentile:
+      break;
+    case IntervalMethod::bca:
+      if (!has_acceleration_) {
+        acceleration_ = acceleration();
+        has_acceleration_ = true;
+      }
+      return bca_interval(proportion_below, acceleration_, n, cl_);
+    }
 
-            input[type="checkbox"],
-            input[type="radio"] {
-              box-sizing: border-box; /* 1 */
-              padding: 0; /* 2 */
-            }
+    return percentile_interval(cl_);
+  }
 
-            /**
-             * Fix the cursor style for Chrome's increment/decrement buttons. For certain
-             * `font-size` values of the `input`, it causes the cursor style of the
-             * decrement button to change from `default` to `text`.
-             */
+private:
+  DistributionStorage storage_;
+  IntervalMethod method_;
+  double cl_;
+  std::vector<T> values_;
+  QuantileSketch<T> sketch_;
+  std::vector<T> sorted_;
+  std::size_t num_sorted_;
+  double acceleration_;
+  bool has_acceleration_;
+};
 
-            input[type="number"]::-webkit-inner-spin-button,
-            input[type="number"]::-webkit-outer-spin-button {
-              height: auto;
-            }
+// Decides when adaptive resampling can stop.  The estimates of every statistic are compared
+// after each chunk of resamples and the bootstrap has converged once none of the confidence
+// interval endpoints moved by more than the tolerance (relative to the interval's width) and none
+// of the standard errors changed by more than the tolerance (relative to the standard error).
+struct ConvergenceCheck {
+  ConvergenceCheck(const double tolerance) : tolerance_(tolerance), has_previous_(false) {}
 
-            /**
-             * 1. Address `appearance` set to `searchfield` in Safari and Chrome.
-   )***^***",
-R"***^***(          * 2. Address `box-sizing` set to `border-box` in Safari and Chrome
-             *    (include `-moz` to future-proof).
-             */
+  template <class T>
+  void add(const Estimate<T> &e) {
+    current_.push_back(sketch_value(e.lower_bound()));
+    current_.push_back(sketch_value(e.upper_bound()));
+    current_.push_back(sketch_value(e.standard_error()));
+  }
 
-            input[type="search"] {
-              -webkit-appearance: textfield; /* 1 */
-              -moz-box-sizing: content-box;
-              -webkit-box-sizing: content-box; /* 2 */
-              box-sizing: content-box;
-            }
+  // Compares the estimates added since the last call to the previous ones
+  bool converged() {
+    const auto tiny = 1e-300;
+    auto result = has_previous_ && previous_.size() == current_.size();
 
-            /**
-             * Remove inner padding and search cancel button in Safari and Chrome on OS X.
-             * Safari (but not Chrome) clips the cancel button when the search input has
-             * padding (and `textfield` appearance).
-             */
+    for (std::size_t i = 0; result && i < current_.size(); i += 3) {
+      const auto width = (std::max)(std::abs(current_[i + 1] - current_[i]), tiny);
+      const auto se = (std::max)(std::abs(current_[i + 2]), tiny);
 
-            input[type="search"]::-webkit-search-cancel-button,
-            input[type="search"]::-webkit-search-decoration {
-              -webkit-appearance: none;
-            }
+      result = std::abs(current_[i] - previous_[i]) / width <= tolerance_ &&
+               std::abs(current_[i + 1] - previous_[i + 1]) / width <= tolerance_ &&
+               std::abs(current_[i + 2] - previous_[i + 2]) / se <= tolerance_;
+    }
 
-            /**
-             * Define consistent border, margin, and padding.
-             */
+    previous_.swap(current_);
+    current_.clear();
+    has_previous_ = true;
 
-            fieldset {
-              border: 1px solid #c0c0c0;
-              margin: 0 2px;
-              padding: 0.35em 0.625em 0.75em;
-            }
+    return result;
+  }
 
-            /**
-             * 1. Correct `color` not being inherited in IE 8/9/10/11.
-             * 2. Remove padding so people aren't caught out if they zero out fieldsets.
-             */
+private:
+  double tolerance_;
+  bool has_previous_;
+  std::vector<double> previous_;
+  std::vector<double> current_;
+};
 
-            legend {
-              border: 0; /* 1 */
-              padding: 0; /* 2 */
-            }
+// The estimate of a statistic added with VeloxConfig::add_statistic
+struct CustomEstimate : EstimateAndDistribution<double> {
+  CustomEstimate(const CustomStatistic &statistic, EstimateAndDistribution<double> &&ed)
+      : EstimateAndDistribution<double>(std::move(ed)), name_(statistic.name()),
+        unit_(statistic.unit()) {}
 
-            /**
-             * Remove default vertical scrollbar in IE 8/9/10/11.
-             */
+  const std::string &name() const { return name_; }
 
-            textarea {
-              overflow: auto;
-            }
+  StatisticUnit unit() const { return unit_; }
 
-            /**
-             * Don't inherit the `font-weight` (applied by a rule above).
-             * NOTE: the default cannot safely be changed in Chrome and Safari on OS X.
-             */
+private:
+  std::string name_;
+  StatisticUnit unit_;
+};
 
-            optgroup {
-              font-weight: bold;
-            }
+struct EstimatedStatistics {
+  EstimatedStatistics(EstimateAndDistribution<FpNs> &&means,
+                      EstimateAndDistribution<FpNs> &&medians,
+                      EstimateAndDistribution<FpNs> &&std_devs,
+                      EstimateAndDistribution<FpNs> &&mads,
+                      EstimateAndDistribution<FpNs> &&lls,
+                      EstimateAndDistribution<double> &&r2s,
+                      EstimateAndDistribution<FpNs> &&slopes,
+                      EstimateAndDistribution<FpNs> &&overheads,
+                      const OutlierVariance &ov,
+                      const std::uint32_t resamples,
+                      const bool flat,
+                      const bool analytic,
+                      std::vector<CustomEstimate> &&customs = std::vector<CustomEstimate>())
+      : mean_(std::move(means)), median_(std::move(medians)), std_dev_(std::move(std_devs)),
+        median_abs_dev_(std::move(mads)), linear_least_squares_(std::move(lls)),
+        r_squared_(std::move(r2s)), slope_(std::move(slopes)), overhead_(std::move(overheads)),
+        outlier_variance_(ov), num_resamples_(resamples), flat_sampling_(flat),
+        analytic_(analytic), custom_(std::move(customs)) {}
 
-            /* Tables
-               ========================================================================== */
+  const EstimateAndDistribution<FpNs> &mean() const { return mean_; }
 
-            /**
-             * Remove most spacing between table cells.
-             */
+  const EstimateAndDistribution<FpNs> &median() const { return median_; }
 
-            table {
-              border-collapse: collapse;
-              border-spacing: 0;
-            }
+  const EstimateAndDistribution<FpNs> &std_dev() const { return std_dev_; }
 
-            td,
-            th {
-              padding: 0;
-            }
-        </style>
+  const EstimateAndDistribution<FpNs> &median_abs_dev() const { return median_abs_dev_; }
 
-        <script>
-        /*! jQuery v2.1.1 | (c) 2005, 2014 jQuery Foundation, Inc. | jquery.org/license */
-!function(a,b){"object"==typeof module&&"object"==typeof module.exports?module.exports=a.document?b(a,!0):function(a){if(!a.document)throw new Error("jQuery requires a window with a document");return b(a)}:b(a)}("undefined"!=typeof window?window:this,function(a,b){var c=[],d=c.slice,e=c.concat,f=c.push,g=c.indexOf,h={},i=h.toString,j=h.hasOwnProperty,k={},l=a.document,m="2.1.1",n=function(a,b){return new n.fn.init(a,b)},o=/^[\s\uFEFF\xA0]+|[\s\uFEFF\xA0]+$/g,p=/^-ms-/,q=/-([\da-z])/gi,r=function(a,b){return b.toUpperCase()};n.fn=n.prototype={jquery:m,constructor:n,selector:"",length:0,toArray:function(){return d.call(this)},get:function(a){return null!=a?0>a?this[a+this.length]:this[a]:d.call(this)},pushStack:function(a){var b=n.merge(this.constructor(),a);return b.prevObject=this,b.context=this.context,b},each:function(a,b){return n.each(this,a,b)},map:function(a){return this.pushStack(n.map(this,function(b,c){return a.call(b,c,b)}))},slice:function(){return this.pushStack(d.apply(this,arguments))},first:function(){return this.eq(0)},last:function(){return this.eq(-1)},eq:function(a){var b=this.length,c=+a+(0>a?b:0);return this.pushStack(c>=0&&b>c?[this[c]]:[])},end:function(){return this.prevObject||this.constructor(null)},push:f,sort:c.sort,splice:c.splice},n.extend=n.fn.extend=function(){var a,b,c,d,e,f,g=arguments[0]||{},h=1,i=arguments.length,j=!1;for("boolean"==typeof g&&(j=g,g=arguments[h]||{},h++),"object"==typeof g||n.isFunction(g)||(g={}),h===i&&(g=this,h--);i>h;h++)if(null!=(a=arguments[h]))for(b in a)c=g[b],d=a[b],g!==d&&(j&&d&&(n.isPlainObject(d)||(e=n.isArray(d)))?(e?(e=!1,f=c&&n.isArray(c)?c:[]):f=c&&n.isPlainObject(c)?c:{},g[b]=n.extend(j,f,d)):void 0!==d&&(g[b]=d));return g},n.extend({expando:"jQuery"+(m+Math.random()).replace(/\D/g,""),isReady:!0,error:function(a){throw new Error(a)},noop:function(){},isFunction:function(a){return"function"===n.type(a)},isArray:Array.isArray,isWindow:function(a){return null!=a&&a===a.window},isNumeric:function(a){return!n.isArray(a)&&a-parseFloat(a)>=0},isPlainObject:function(a){return"object"!==n.type(a)||a.nodeType||n.isWindow(a)?!1:a.constructor&&!j.call(a.constructor.prototype,"isPrototypeOf")?!1:!0},isEmptyObject:function(a){var b;for(b in a)return!1;return!0},type:function(a){return null==a?a+"":"object"==typeof a||"function"==typeof a?h[i.call(a)]||"object":typeof a},globalEval:function(a){var b,c=eval;a=n.trim(a),a&&(1===a.indexOf("use strict")?(b=l.createElement("script"),b.text=a,l.head.appendChild(b).parentNode.removeChild(b)):c(a))},camelCase:function(a){return a.replace(p,"ms-").replace(q,r)},nodeName:function(a,b){return a.nodeName&&a.nodeName.toLowerCase()===b.toLowerCase()},each:function(a,b,c){var d,e=0,f=a.length,g=s(a);if(c){if(g){for(;f>e;e++)if(d=b.apply(a[e],c),d===!1)break}else for(e in a)if(d=b.apply(a[e],c),d===!1)break}else if(g){for(;f>e;e++)if(d=b.call(a[e],e,a[e]),d===!1)break}else for(e in a)if(d=b.call(a[e],e,a[e]),d===!1)break;return a},trim:function(a){return null==a?"":(a+"").replace(o,"")},makeArray:function(a,b){var c=b||[];return null!=a&&(s(Object(a))?n.merge(c,"string"==typeof a?[a]:a):f.call(c,a)),c},inArray:function(a,b,c){return null==b?-1:g.call(b,a,c)},merge:function(a,b){for(var c=+b.length,d=0,e=a.length;c>d;d++)a[e++]=b[d];return a.length=e,a},grep:function(a,b,c){for(var d,e=[],f=0,g=a.length,h=!c;g>f;f++)d=!b(a[f],f),d!==h&&e.push(a[f]);return e},map:function(a,b,c){var d,f=0,g=a.length,h=s(a),i=[];if(h)for(;g>f;f++)d=b(a[f],f,c),null!=d&&i.push(d);else for(f in a)d=b(a[f],f,c),null!=d&&i.push(d);return e.apply([],i)},guid:1,proxy:function(a,b){var c,e,f;return"string"==typeof b&&(c=a[b],b=a,a=c),n.isFunction(a)?(e=d.call(arguments,2),f=function(){return a.apply(b||this,e.concat(d.call(arguments)))},f.guid=a.guid=a.guid||n.guid++,f):void 0},now:Date.now,support:k}),n.each("Boolean Number String Function Array Date RegExp Object Error".split(" "),function(a,b){h["[object "+b+"]"]=b.toLowerCase()});function s(a){var b=a.length,c=n.type(a);return"function"===c||n.isWindow(a)?!1:1===a.nodeType&&b?!0:"array"===c||0===b||"number"==typeof b&&b>0&&b-1 in a}var t=function(a){var b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u="sizzle"+-new Date,v=a.document,w=0,x=0,y=gb(),z=gb(),A=gb(),B=function(a,b){return a===b&&(l=!0),0},C="undefined",D=1<<31,E={}.hasOwnProperty,F=[],G=F.pop,H=F.push,I=F.push,J=F.slice,K=F.indexOf||function(a){for(var b=0,c=this.length;c>b;b++)if(this[b]===a)return b;return-1},L="checked|selected|async|autofocus|autoplay|controls|defer|disabled|hidden|ismap|loop|multiple|open|readonly|required|scoped",M="[\\x20\\t\\r\\n\\f]",N="(?:\\\\.|[\\w-]|[^\\x00-\\xa0])+",O=N.replace("w","w#"),P="\\["+M+"*("+N+")(?:"+M+"*([*^$|!~]?=)"+M+"*(?:'((?:\\\\.|[^\\\\'])*)'|\"((?:\\\\.|[^\\\\\"])*)\"|("+O+"))|)"+M+"*\\]",Q=":("+N+")(?:\\((('((?:\\\\.|[^\\\\'])*)'|\"((?:\\\\.|[^\\\\\"])*)\")|((?:\\\\.|[^\\\\()[\\]]|"+P+")*)|.*)\\)|)",R=new RegExp("^"+M+"+|((?:^|[^\\\\])(?:\\\\.)*)"+M+"+$","g"),S=new RegExp("^"+M+"*,"+M+"*"),T=new RegExp("^"+M+"*([>+~]|"+M+")"+M+"*"),U=new RegExp("="+M+"*([^\\]'\"]*?)"+M+"*\\]","g"),V=new RegExp(Q),W=new RegExp("^"+O+"$"),X={ID:new RegExp("^#("+N+")"),CLASS:new RegExp("^\\.("+N+")"),TAG:new RegExp("^("+N.replace("w","w*")+")"),ATTR:new RegExp("^"+P),PSEUDO:new RegExp("^"+Q),CHILD:new RegExp("^:(only|first|last|nth|nth-last)-(child|of-type)(?:\\("+M+"*(even|odd|(([+-]|)(\\d*)n|)"+M+"*(?:([+-]|)"+M+"*(\\d+)|))"+M+"*\\)|)","i"),bool:new RegExp("^(?:"+L+")$","i"),needsContext:new RegExp("^"+M+"*[>+~]|:(even|odd|eq|gt|lt|nth|first|last)(?:\\("+M+"*((?:-\\d)?\\d*)"+M+"*\\)|)(?=[^-]|$)","i")},Y=/^(?:input|select|textarea|button)$/i,Z=/^h\d$/i,$=/^[^{]+\{\s*\[native \w/,_=/^(?:#([\w-]+)|(\w+)|\.([\w-]+))$/,ab=/[+~]/,bb=/'|\\/g,cb=new RegExp("\\\\([\\da-f]{1,6}"+M+"?|("+M+")|.)","ig"),db=function(a,b,c){var d="0x"+b-65536;return d!==d||c?b:0>d?String.fromCharCode(d+65536):String.fromCharCode(d>>10|55296,1023&d|56320)};try{I.apply(F=J.call(v.childNodes),v.childNodes),F[v.childNodes.length].nodeType}catch(eb){I={apply:F.length?function(a,b){H.apply(a,J.call(b))}:function(a,b){var c=a.length,d=0;while(a[c++]=b[d++]);a.length=c-1}}}function fb(a,b,d,e){var f,h,j,k,l,o,r,s,w,x;if((b?b.ownerDocument||b:v)!==n&&m(b),b=b||n,d=d||[],!a||"string"!=typeof a)return d;if(1!==(k=b.nodeType)&&9!==k)return[];if(p&&!e){if(f=_.exec(a))if(j=f[1]){if(9===k){if(h=b.getElementById(j),!h||!h.parentNode)return d;if(h.id===j)return d.push(h),d}else if(b.ownerDocument&&(h=b.ownerDocument.getElementById(j))&&t(b,h)&&h.id===j)return d.push(h),d}else{if(f[2])return I.apply(d,b.getElementsByTagName(a)),d;if((j=f[3])&&c.getElementsByClassName&&b.getElementsByClassName)return I.apply(d,b.getElementsByClassName(j)),d}if(c.qsa&&(!q||!q.test(a))){if(s=r=u,w=b,x=9===k&&a,1===k&&"object"!==b.nodeName.toLowerCase()){o=g(a),(r=b.getAttribute("id"))?s=r.replace(bb,"\\$&"):b.setAttribute("id",s),s="[id='"+s+"'] ",l=o.length;while(l--)o[l]=s+qb(o[l]);w=ab.test(a)&&ob(b.parentNode)||b,x=o.join(",")}if(x)try{return I.apply(d,w.querySelectorAll(x)),d}catch(y){}finally{r||b.removeAttribute("id")}}}return i(a.replace(R,"$1"),b,d,e)}function gb(){var a=[];function b(c,e){return a.push(c+" ")>d.cacheLength&&delete b[a.shift()],b[c+" "]=e}return b}function hb(a){return a[u]=!0,a}function ib(a){var b=n.createElement("div");try{return!!a(b)}catch(c){return!1}finally{b.parentNode&&b.parentNode.removeChild(b),b=null}}function jb(a,b){var c=a.split("|"),e=a.length;while(e--)d.attrHandle[c[e]]=b}function kb(a,b){var c=b&&a,d=c&&1===a.nodeType&&1===b.nodeType&&(~b.sourceIndex||D)-(~a.sourceIndex||D);if(d)return d;if(c)while(c=c.nextSibling)if(c===b)return-1;return a?1:-1)***^***",
-R"***^***(}function lb(a){return function(b){var c=b.nodeName.toLowerCase();return"input"===c&&b.type===a}}function mb(a){return function(b){var c=b.nodeName.toLowerCase();return("input"===c||"button"===c)&&b.type===a}}function nb(a){return hb(function(b){return b=+b,hb(function(c,d){var e,f=a([],c.length,b),g=f.length;while(g--)c[e=f[g]]&&(c[e]=!(d[e]=c[e]))})})}function ob(a){return a&&typeof a.getElementsByTagName!==C&&a}c=fb.support={},f=fb.isXML=function(a){var b=a&&(a.ownerDocument||a).documentElement;return b?"HTML"!==b.nodeName:!1},m=fb.setDocument=function(a){var b,e=a?a.ownerDocument||a:v,g=e.defaultView;return e!==n&&9===e.nodeType&&e.documentElement?(n=e,o=e.documentElement,p=!f(e),g&&g!==g.top&&(g.addEventListener?g.addEventListener("unload",function(){m()},!1):g.attachEvent&&g.attachEvent("onunload",function(){m()})),c.attributes=ib(function(a){return a.className="i",!a.getAttribute("className")}),c.getElementsByTagName=ib(function(a){return a.appendChild(e.createComment("")),!a.getElementsByTagName("*").length}),c.getElementsByClassName=$.test(e.getElementsByClassName)&&ib(function(a){return a.innerHTML="<div class='a'></div><div class='a i'></div>",a.firstChild.className="i",2===a.getElementsByClassName("i").length}),c.getById=ib(function(a){return o.appendChild(a).id=u,!e.getElementsByName||!e.getElementsByName(u).length}),c.getById?(d.find.ID=function(a,b){if(typeof b.getElementById!==C&&p){var c=b.getElementById(a);return c&&c.parentNode?[c]:[]}},d.filter.ID=function(a){var b=a.replace(cb,db);return function(a){return a.getAttribute("id")===b}}):(delete d.find.ID,d.filter.ID=function(a){var b=a.replace(cb,db);return function(a){var c=typeof a.getAttributeNode!==C&&a.getAttributeNode("id");return c&&c.value===b}}),d.find.TAG=c.getElementsByTagName?function(a,b){return typeof b.getElementsByTagName!==C?b.getElementsByTagName(a):void 0}:function(a,b){var c,d=[],e=0,f=b.getElementsByTagName(a);if("*"===a){while(c=f[e++])1===c.nodeType&&d.push(c);return d}return f},d.find.CLASS=c.getElementsByClassName&&function(a,b){return typeof b.getElementsByClassName!==C&&p?b.getElementsByClassName(a):void 0},r=[],q=[],(c.qsa=$.test(e.querySelectorAll))&&(ib(function(a){a.innerHTML="<select msallowclip=''><option selected=''></option></select>",a.querySelectorAll("[msallowclip^='']").length&&q.push("[*^$]="+M+"*(?:''|\"\")"),a.querySelectorAll("[selected]").length||q.push("\\["+M+"*(?:value|"+L+")"),a.querySelectorAll(":checked").length||q.push(":checked")}),ib(function(a){var b=e.createElement("input");b.setAttribute("type","hidden"),a.appendChild(b).setAttribute("name","D"),a.querySelectorAll("[name=d]").length&&q.push("name"+M+"*[*^$|!~]?="),a.querySelectorAll(":enabled").length||q.push(":enabled",":disabled"),a.querySelectorAll("*,:x"),q.push(",.*:")})),(c.matchesSelector=$.test(s=o.matches||o.webkitMatchesSelector||o.mozMatchesSelector||o.oMatchesSelector||o.msMatchesSelector))&&ib(function(a){c.disconnectedMatch=s.call(a,"div"),s.call(a,"[s!='']:x"),r.push("!=",Q)}),q=q.length&&new RegExp(q.join("|")),r=r.length&&new RegExp(r.join("|")),b=$.test(o.compareDocumentPosition),t=b||$.test(o.contains)?function(a,b){var c=9===a.nodeType?a.documentElement:a,d=b&&b.parentNode;return a===d||!(!d||1!==d.nodeType||!(c.contains?c.contains(d):a.compareDocumentPosition&&16&a.compareDocumentPosition(d)))}:function(a,b){if(b)while(b=b.parentNode)if(b===a)return!0;return!1},B=b?function(a,b){if(a===b)return l=!0,0;var d=!a.compareDocumentPosition-!b.compareDocumentPosition;return d?d:(d=(a.ownerDocument||a)===(b.ownerDocument||b)?a.compareDocumentPosition(b):1,1&d||!c.sortDetached&&b.compareDocumentPosition(a)===d?a===e||a.ownerDocument===v&&t(v,a)?-1:b===e||b.ownerDocument===v&&t(v,b)?1:k?K.call(k,a)-K.call(k,b):0:4&d?-1:1)}:function(a,b){if(a===b)return l=!0,0;var c,d=0,f=a.parentNode,g=b.parentNode,h=[a],i=[b];if(!f||!g)return a===e?-1:b===e?1:f?-1:g?1:k?K.call(k,a)-K.call(k,b):0;if(f===g)return kb(a,b);c=a;while(c=c.parentNode)h.unshift(c);c=b;while(c=c.parentNode)i.unshift(c);while(h[d]===i[d])d++;return d?kb(h[d],i[d]):h[d]===v?-1:i[d]===v?1:0},e):n},fb.matches=function(a,b){return fb(a,null,null,b)},fb.matchesSelector=function(a,b){if((a.ownerDocument||a)!==n&&m(a),b=b.replace(U,"='$1']"),!(!c.matchesSelector||!p||r&&r.test(b)||q&&q.test(b)))try{var d=s.call(a,b);if(d||c.disconnectedMatch||a.document&&11!==a.document.nodeType)return d}catch(e){}return fb(b,n,null,[a]).length>0},fb.contains=function(a,b){return(a.ownerDocument||a)!==n&&m(a),t(a,b)},fb.attr=function(a,b){(a.ownerDocument||a)!==n&&m(a);var e=d.attrHandle[b.toLowerCase()],f=e&&E.call(d.attrHandle,b.toLowerCase())?e(a,b,!p):void 0;return void 0!==f?f:c.attributes||!p?a.getAttribute(b):(f=a.getAttributeNode(b))&&f.specified?f.value:null},fb.error=function(a){throw new Error("Syntax error, unrecognized expression: "+a)},fb.uniqueSort=function(a){var b,d=[],e=0,f=0;if(l=!c.detectDuplicates,k=!c.sortStable&&a.slice(0),a.sort(B),l){while(b=a[f++])b===a[f]&&(e=d.push(f));while(e--)a.splice(d[e],1)}return k=null,a},e=fb.getText=function(a){var b,c="",d=0,f=a.nodeType;if(f){if(1===f||9===f||11===f){if("string"==typeof a.textContent)return a.textContent;for(a=a.firstChild;a;a=a.nextSibling)c+=e(a)}else if(3===f||4===f)return a.nodeValue}else while(b=a[d++])c+=e(b);return c},d=fb.selectors={cacheLength:50,createPseudo:hb,match:X,attrHandle:{},find:{},relative:{">":{dir:"parentNode",first:!0}," ":{dir:"parentNode"},"+":{dir:"previousSibling",first:!0},"~":{dir:"previousSibling"}},preFilter:{ATTR:function(a){return a[1]=a[1].replace(cb,db),a[3]=(a[3]||a[4]||a[5]||"").replace(cb,db),"~="===a[2]&&(a[3]=" "+a[3]+" "),a.slice(0,4)},CHILD:function(a){return a[1]=a[1].toLowerCase(),"nth"===a[1].slice(0,3)?(a[3]||fb.error(a[0]),a[4]=+(a[4]?a[5]+(a[6]||1):2*("even"===a[3]||"odd"===a[3])),a[5]=+(a[7]+a[8]||"odd"===a[3])):a[3]&&fb.error(a[0]),a},PSEUDO:function(a){var b,c=!a[6]&&a[2];return X.CHILD.test(a[0])?null:(a[3]?a[2]=a[4]||a[5]||"":c&&V.test(c)&&(b=g(c,!0))&&(b=c.indexOf(")",c.length-b)-c.length)&&(a[0]=a[0].slice(0,b),a[2]=c.slice(0,b)),a.slice(0,3))}},filter:{TAG:function(a){var b=a.replace(cb,db).toLowerCase();return"*"===a?function(){return!0}:function(a){return a.nodeName&&a.nodeName.toLowerCase()===b}},CLASS:function(a){var b=y[a+" "];return b||(b=new RegExp("(^|"+M+")"+a+"("+M+"|$)"))&&y(a,function(a){return b.test("string"==typeof a.className&&a.className||typeof a.getAttribute!==C&&a.getAttribute("class")||"")})},ATTR:function(a,b,c){return function(d){var e=fb.attr(d,a);return null==e?"!="===b:b?(e+="","="===b?e===c:"!="===b?e!==c:"^="===b?c&&0===e.indexOf(c):"*="===b?c&&e.indexOf(c)>-1:"$="===b?c&&e.slice(-c.length)===c:"~="===b?(" "+e+" ").indexOf(c)>-1:"|="===b?e===c||e.slice(0,c.length+1)===c+"-":!1):!0}},CHILD:function(a,b,c,d,e){var f="nth"!==a.slice(0,3),g="last"!==a.slice(-4),h="of-type"===b;return 1===d&&0===e?function(a){return!!a.parentNode}:function(b,c,i){var j,k,l,m,n,o,p=f!==g?"nextSibling":"previousSibling",q=b.parentNode,r=h&&b.nodeName.toLowerCase(),s=!i&&!h;if(q){if(f){while(p){l=b;while(l=l[p])if(h?l.nodeName.toLowerCase()===r:1===l.nodeType)return!1;o=p="only"===a&&!o&&"nextSibling"}return!0}if(o=[g?q.firstChild:q.lastChild],g&&s){k=q[u]||(q[u]={}),j=k[a]||[],n=j[0]===w&&j[1],m=j[0]===w&&j[2],l=n&&q.childNodes[n];while(l=++n&&l&&l[p]||(m=n=0)||o.pop())if(1===l.nodeType&&++m&&l===b){k[a]=[w,n,m];break}}else if(s&&(j=(b[u]||(b[u]={}))[a])&&j[0]===w)m=j[1];else while(l=++n&&l&&l[p]||(m=n=0)||o.pop())if((h?l.nodeName.toLowerCase()===r:1===l.nodeType)&&++m&&(s&&((l[u]||(l[u]={}))[a]=[w,m]),l===b))break;return m-=e,m===d||m%d===0&&m/d>=0}}},PSEUDO:function(a,b){var c,e=d.pseudos[a]||d.setFilters[a.toLowerCase()]||fb.error("unsupported pseudo: "+a);return e[u]?e(b):e.length>1?(c=[a,a,"",b],d.setFilters.hasOwnProperty(a.toLowerCase())?hb(function(a,c){var d,f=e(a,b),g=f.length;while(g--)d=K.call(a,f[g]),a[d]=!(c[d]=f[g])}):function(a){return e(a,0,c)}):e}},pseudos:{not:hb(function(a){var b=[],c=[],d=h(a.replace(R,"$1"));return d[u]?hb(function(a,b,c,e){var f,g=d(a,null,e,[]),h=a.length;while(h--)(f=g[h])&&(a[h]=!(b[h]=f))}):function(a,e,f){return b[0]=a,d(b,null,f,c),!c.pop()}}),has:hb(function(a){return function(b){return fb(a,b).length>0}}),contains:hb(function(a){return function(b){return(b.textContent||b.innerText||e(b)).indexOf(a)>-1}}),lang:hb(function(a){return W.test(a||"")||fb.error("unsupported lang: "+a),a=a.replace(cb,db).toLowerCase(),function(b){var c;do if(c=p?b.lang:b.getAttribute("xml:lang")||b.getAttribute("lang"))return c=c.toLowerCase(),c===a||0===c.indexOf(a+"-");while((b=b.parentNode)&&1===b.nodeType);return!1}}),target:function(b){var c=a.location&&a.location.hash;return c&&c.slice(1)===b.id},root:function(a){return a===o},focus:function(a){return a===n.activeElement&&(!n.hasFocus||n.hasFocus())&&!!(a.type||a.href||~a.tabIndex)},enabled:function(a){return a.disabled===!1},disabled:function(a){return a.disabled===!0},checked:function(a){var b=a.nodeName.toLowerCase();return"input"===b&&!!a.checked||"option"===b&&!!a.selected},selected:function(a){return a.parentNode&&a.parentNode.selectedIndex,a.selected===!0},empty:function(a){for(a=a.firstChild;a;a=a.nextSibling)if(a.nodeType<6)return!1;return!0},parent:function(a){return!d.pseudos.empty(a)},header:function(a){return Z.test(a.nodeName)},input:function(a){return Y.test(a.nodeName)},button:function(a){var b=a.nodeName.toLowerCase();return"input"===b&&"button"===a.type||"button"===b},text:function(a){var b;return"input"===a.nodeName.toLowerCase()&&"text"===a.type&&(null==(b=a.getAttribute("type"))||"text"===b.toLowerCase())},first:nb(function(){return[0]}),last:nb(function(a,b){return[b-1]}),eq:nb(function(a,b,c){return[0>c?c+b:c]}),even:nb(function(a,b){for(var c=0;b>c;c+=2)a.push(c);return a}),odd:nb(function(a,b){for(var c=1;b>c;c+=2)a.push(c);return a}),lt:nb(function(a,b,c){for(var d=0>c?c+b:c;--d>=0;)a.push(d);return a}),gt:nb(function(a,b,c){for(var d=0>c?c+b:c;++d<b;)a.pus)***^***",
-R"***^***(h(d);return a})}},d.pseudos.nth=d.pseudos.eq;for(b in{radio:!0,checkbox:!0,file:!0,password:!0,image:!0})d.pseudos[b]=lb(b);for(b in{submit:!0,reset:!0})d.pseudos[b]=mb(b);function pb(){}pb.prototype=d.filters=d.pseudos,d.setFilters=new pb,g=fb.tokenize=function(a,b){var c,e,f,g,h,i,j,k=z[a+" "];if(k)return b?0:k.slice(0);h=a,i=[],j=d.preFilter;while(h){(!c||(e=S.exec(h)))&&(e&&(h=h.slice(e[0].length)||h),i.push(f=[])),c=!1,(e=T.exec(h))&&(c=e.shift(),f.push({value:c,type:e[0].replace(R," ")}),h=h.slice(c.length));for(g in d.filter)!(e=X[g].exec(h))||j[g]&&!(e=j[g](e))||(c=e.shift(),f.push({value:c,type:g,matches:e}),h=h.slice(c.length));if(!c)break}return b?h.length:h?fb.error(a):z(a,i).slice(0)};function qb(a){for(var b=0,c=a.length,d="";c>b;b++)d+=a[b].value;return d}function rb(a,b,c){var d=b.dir,e=c&&"parentNode"===d,f=x++;return b.first?function(b,c,f){while(b=b[d])if(1===b.nodeType||e)return a(b,c,f)}:function(b,c,g){var h,i,j=[w,f];if(g){while(b=b[d])if((1===b.nodeType||e)&&a(b,c,g))return!0}else while(b=b[d])if(1===b.nodeType||e){if(i=b[u]||(b[u]={}),(h=i[d])&&h[0]===w&&h[1]===f)return j[2]=h[2];if(i[d]=j,j[2]=a(b,c,g))return!0}}}function sb(a){return a.length>1?function(b,c,d){var e=a.length;while(e--)if(!a[e](b,c,d))return!1;return!0}:a[0]}function tb(a,b,c){for(var d=0,e=b.length;e>d;d++)fb(a,b[d],c);return c}function ub(a,b,c,d,e){for(var f,g=[],h=0,i=a.length,j=null!=b;i>h;h++)(f=a[h])&&(!c||c(f,d,e))&&(g.push(f),j&&b.push(h));return g}function vb(a,b,c,d,e,f){return d&&!d[u]&&(d=vb(d)),e&&!e[u]&&(e=vb(e,f)),hb(function(f,g,h,i){var j,k,l,m=[],n=[],o=g.length,p=f||tb(b||"*",h.nodeType?[h]:h,[]),q=!a||!f&&b?p:ub(p,m,a,h,i),r=c?e||(f?a:o||d)?[]:g:q;if(c&&c(q,r,h,i),d){j=ub(r,n),d(j,[],h,i),k=j.length;while(k--)(l=j[k])&&(r[n[k]]=!(q[n[k]]=l))}if(f){if(e||a){if(e){j=[],k=r.length;while(k--)(l=r[k])&&j.push(q[k]=l);e(null,r=[],j,i)}k=r.length;while(k--)(l=r[k])&&(j=e?K.call(f,l):m[k])>-1&&(f[j]=!(g[j]=l))}}else r=ub(r===g?r.splice(o,r.length):r),e?e(null,g,r,i):I.apply(g,r)})}function wb(a){for(var b,c,e,f=a.length,g=d.relative[a[0].type],h=g||d.relative[" "],i=g?1:0,k=rb(function(a){return a===b},h,!0),l=rb(function(a){return K.call(b,a)>-1},h,!0),m=[function(a,c,d){return!g&&(d||c!==j)||((b=c).nodeType?k(a,c,d):l(a,c,d))}];f>i;i++)if(c=d.relative[a[i].type])m=[rb(sb(m),c)];else{if(c=d.filter[a[i].type].apply(null,a[i].matches),c[u]){for(e=++i;f>e;e++)if(d.relative[a[e].type])break;return vb(i>1&&sb(m),i>1&&qb(a.slice(0,i-1).concat({value:" "===a[i-2].type?"*":""})).replace(R,"$1"),c,e>i&&wb(a.slice(i,e)),f>e&&wb(a=a.slice(e)),f>e&&qb(a))}m.push(c)}return sb(m)}function xb(a,b){var c=b.length>0,e=a.length>0,f=function(f,g,h,i,k){var l,m,o,p=0,q="0",r=f&&[],s=[],t=j,u=f||e&&d.find.TAG("*",k),v=w+=null==t?1:Math.random()||.1,x=u.length;for(k&&(j=g!==n&&g);q!==x&&null!=(l=u[q]);q++){if(e&&l){m=0;while(o=a[m++])if(o(l,g,h)){i.push(l);break}k&&(w=v)}c&&((l=!o&&l)&&p--,f&&r.push(l))}if(p+=q,c&&q!==p){m=0;while(o=b[m++])o(r,s,g,h);if(f){if(p>0)while(q--)r[q]||s[q]||(s[q]=G.call(i));s=ub(s)}I.apply(i,s),k&&!f&&s.length>0&&p+b.length>1&&fb.uniqueSort(i)}return k&&(w=v,j=t),r};return c?hb(f):f}return h=fb.compile=function(a,b){var c,d=[],e=[],f=A[a+" "];if(!f){b||(b=g(a)),c=b.length;while(c--)f=wb(b[c]),f[u]?d.push(f):e.push(f);f=A(a,xb(e,d)),f.selector=a}return f},i=fb.select=function(a,b,e,f){var i,j,k,l,m,n="function"==typeof a&&a,o=!f&&g(a=n.selector||a);if(e=e||[],1===o.length){if(j=o[0]=o[0].slice(0),j.length>2&&"ID"===(k=j[0]).type&&c.getById&&9===b.nodeType&&p&&d.relative[j[1].type]){if(b=(d.find.ID(k.matches[0].replace(cb,db),b)||[])[0],!b)return e;n&&(b=b.parentNode),a=a.slice(j.shift().value.length)}i=X.needsContext.test(a)?0:j.length;while(i--){if(k=j[i],d.relative[l=k.type])break;if((m=d.find[l])&&(f=m(k.matches[0].replace(cb,db),ab.test(j[0].type)&&ob(b.parentNode)||b))){if(j.splice(i,1),a=f.length&&qb(j),!a)return I.apply(e,f),e;break}}}return(n||h(a,o))(f,b,!p,e,ab.test(a)&&ob(b.parentNode)||b),e},c.sortStable=u.split("").sort(B).join("")===u,c.detectDuplicates=!!l,m(),c.sortDetached=ib(function(a){return 1&a.compareDocumentPosition(n.createElement("div"))}),ib(function(a){return a.innerHTML="<a href='#'></a>","#"===a.firstChild.getAttribute("href")})||jb("type|href|height|width",function(a,b,c){return c?void 0:a.getAttribute(b,"type"===b.toLowerCase()?1:2)}),c.attributes&&ib(function(a){return a.innerHTML="<input/>",a.firstChild.setAttribute("value",""),""===a.firstChild.getAttribute("value")})||jb("value",function(a,b,c){return c||"input"!==a.nodeName.toLowerCase()?void 0:a.defaultValue}),ib(function(a){return null==a.getAttribute("disabled")})||jb(L,function(a,b,c){var d;return c?void 0:a[b]===!0?b.toLowerCase():(d=a.getAttributeNode(b))&&d.specified?d.value:null}),fb}(a);n.find=t,n.expr=t.selectors,n.expr[":"]=n.expr.pseudos,n.unique=t.uniqueSort,n.text=t.getText,n.isXMLDoc=t.isXML,n.contains=t.contains;var u=n.expr.match.needsContext,v=/^<(\w+)\s*\/?>(?:<\/\1>|)$/,w=/^.[^:#\[\.,]*$/;function x(a,b,c){if(n.isFunction(b))return n.grep(a,function(a,d){return!!b.call(a,d,a)!==c});if(b.nodeType)return n.grep(a,function(a){return a===b!==c});if("string"==typeof b){if(w.test(b))return n.filter(b,a,c);b=n.filter(b,a)}return n.grep(a,function(a){return g.call(b,a)>=0!==c})}n.filter=function(a,b,c){var d=b[0];return c&&(a=":not("+a+")"),1===b.length&&1===d.nodeType?n.find.matchesSelector(d,a)?[d]:[]:n.find.matches(a,n.grep(b,function(a){return 1===a.nodeType}))},n.fn.extend({find:function(a){var b,c=this.length,d=[],e=this;if("string"!=typeof a)return this.pushStack(n(a).filter(function(){for(b=0;c>b;b++)if(n.contains(e[b],this))return!0}));for(b=0;c>b;b++)n.find(a,e[b],d);return d=this.pushStack(c>1?n.unique(d):d),d.selector=this.selector?this.selector+" "+a:a,d},filter:function(a){return this.pushStack(x(this,a||[],!1))},not:function(a){return this.pushStack(x(this,a||[],!0))},is:function(a){return!!x(this,"string"==typeof a&&u.test(a)?n(a):a||[],!1).length}});var y,z=/^(?:\s*(<[\w\W]+>)[^>]*|#([\w-]*))$/,A=n.fn.init=function(a,b){var c,d;if(!a)return this;if("string"==typeof a){if(c="<"===a[0]&&">"===a[a.length-1]&&a.length>=3?[null,a,null]:z.exec(a),!c||!c[1]&&b)return!b||b.jquery?(b||y).find(a):this.constructor(b).find(a);if(c[1]){if(b=b instanceof n?b[0]:b,n.merge(this,n.parseHTML(c[1],b&&b.nodeType?b.ownerDocument||b:l,!0)),v.test(c[1])&&n.isPlainObject(b))for(c in b)n.isFunction(this[c])?this[c](b[c]):this.attr(c,b[c]);return this}return d=l.getElementById(c[2]),d&&d.parentNode&&(this.length=1,this[0]=d),this.context=l,this.selector=a,this}return a.nodeType?(this.context=this[0]=a,this.length=1,this):n.isFunction(a)?"undefined"!=typeof y.ready?y.ready(a):a(n):(void 0!==a.selector&&(this.selector=a.selector,this.context=a.context),n.makeArray(a,this))};A.prototype=n.fn,y=n(l);var B=/^(?:parents|prev(?:Until|All))/,C={children:!0,contents:!0,next:!0,prev:!0};n.extend({dir:function(a,b,c){var d=[],e=void 0!==c;while((a=a[b])&&9!==a.nodeType)if(1===a.nodeType){if(e&&n(a).is(c))break;d.push(a)}return d},sibling:function(a,b){for(var c=[];a;a=a.nextSibling)1===a.nodeType&&a!==b&&c.push(a);return c}}),n.fn.extend({has:function(a){var b=n(a,this),c=b.length;return this.filter(function(){for(var a=0;c>a;a++)if(n.contains(this,b[a]))return!0})},closest:function(a,b){for(var c,d=0,e=this.length,f=[],g=u.test(a)||"string"!=typeof a?n(a,b||this.context):0;e>d;d++)for(c=this[d];c&&c!==b;c=c.parentNode)if(c.nodeType<11&&(g?g.index(c)>-1:1===c.nodeType&&n.find.matchesSelector(c,a))){f.push(c);break}return this.pushStack(f.length>1?n.unique(f):f)},index:function(a){return a?"string"==typeof a?g.call(n(a),this[0]):g.call(this,a.jquery?a[0]:a):this[0]&&this[0].parentNode?this.first().prevAll().length:-1},add:function(a,b){return this.pushStack(n.unique(n.merge(this.get(),n(a,b))))},addBack:function(a){return this.add(null==a?this.prevObject:this.prevObject.filter(a))}});function D(a,b){while((a=a[b])&&1!==a.nodeType);return a}n.each({parent:function(a){var b=a.parentNode;return b&&11!==b.nodeType?b:null},parents:function(a){return n.dir(a,"parentNode")},parentsUntil:function(a,b,c){return n.dir(a,"parentNode",c)},next:function(a){return D(a,"nextSibling")},prev:function(a){return D(a,"previousSibling")},nextAll:function(a){return n.dir(a,"nextSibling")},prevAll:function(a){return n.dir(a,"previousSibling")},nextUntil:function(a,b,c){return n.dir(a,"nextSibling",c)},prevUntil:function(a,b,c){return n.dir(a,"previousSibling",c)},siblings:function(a){return n.sibling((a.parentNode||{}).firstChild,a)},children:function(a){return n.sibling(a.firstChild)},contents:function(a){return a.contentDocument||n.merge([],a.childNodes)}},function(a,b){n.fn[a]=function(c,d){var e=n.map(this,b,c);return"Until"!==a.slice(-5)&&(d=c),d&&"string"==typeof d&&(e=n.filter(d,e)),this.length>1&&(C[a]||n.unique(e),B.test(a)&&e.reverse()),this.pushStack(e)}});var E=/\S+/g,F={};function G(a){var b=F[a]={};return n.each(a.match(E)||[],function(a,c){b[c]=!0}),b}n.Callbacks=function(a){a="string"==typeof a?F[a]||G(a):n.extend({},a);var b,c,d,e,f,g,h=[],i=!a.once&&[],j=function(l){for(b=a.memory&&l,c=!0,g=e||0,e=0,f=h.length,d=!0;h&&f>g;g++)if(h[g].apply(l[0],l[1])===!1&&a.stopOnFalse){b=!1;break}d=!1,h&&(i?i.length&&j(i.shift()):b?h=[]:k.disable())},k={add:function(){if(h){var c=h.length;!function g(b){n.each(b,function(b,c){var d=n.type(c);"function"===d?a.unique&&k.has(c)||h.push(c):c&&c.length&&"string"!==d&&g(c)})}(arguments),d?f=h.length:b&&(e=c,j(b))}return this},remove:function(){return h&&n.each(arguments,function(a,b){var c;while((c=n.inArray(b,h,c))>-1)h.splice(c,1),d&&(f>=c&&f--,g>=c&&g--)}),this},has:function(a){return a?n.inArray(a,h)>-1:!(!h||!h.length)},empty:function(){return h=[],f=0,this},disable:function(){return h=i=b=void 0,this},disabled:function(){return!h},lock:function(){return i=void 0,b||k.disable(),this},locked:function(){return!i},fireWith:function(a,b){return!h||c&&!i||(b=b||[],b=[a,b.slice?b.slice():b],d?i.pus)***^***",
-R"***^***(h(b):j(b)),this},fire:function(){return k.fireWith(this,arguments),this},fired:function(){return!!c}};return k},n.extend({Deferred:function(a){var b=[["resolve","done",n.Callbacks("once memory"),"resolved"],["reject","fail",n.Callbacks("once memory"),"rejected"],["notify","progress",n.Callbacks("memory")]],c="pending",d={state:function(){return c},always:function(){return e.done(arguments).fail(arguments),this},then:function(){var a=arguments;return n.Deferred(function(c){n.each(b,function(b,f){var g=n.isFunction(a[b])&&a[b];e[f[1]](function(){var a=g&&g.apply(this,arguments);a&&n.isFunction(a.promise)?a.promise().done(c.resolve).fail(c.reject).progress(c.notify):c[f[0]+"With"](this===d?c.promise():this,g?[a]:arguments)})}),a=null}).promise()},promise:function(a){return null!=a?n.extend(a,d):d}},e={};return d.pipe=d.then,n.each(b,function(a,f){var g=f[2],h=f[3];d[f[1]]=g.add,h&&g.add(function(){c=h},b[1^a][2].disable,b[2][2].lock),e[f[0]]=function(){return e[f[0]+"With"](this===e?d:this,arguments),this},e[f[0]+"With"]=g.fireWith}),d.promise(e),a&&a.call(e,e),e},when:function(a){var b=0,c=d.call(arguments),e=c.length,f=1!==e||a&&n.isFunction(a.promise)?e:0,g=1===f?a:n.Deferred(),h=function(a,b,c){return function(e){b[a]=this,c[a]=arguments.length>1?d.call(arguments):e,c===i?g.notifyWith(b,c):--f||g.resolveWith(b,c)}},i,j,k;if(e>1)for(i=new Array(e),j=new Array(e),k=new Array(e);e>b;b++)c[b]&&n.isFunction(c[b].promise)?c[b].promise().done(h(b,k,c)).fail(g.reject).progress(h(b,j,i)):--f;return f||g.resolveWith(k,c),g.promise()}});var H;n.fn.ready=function(a){return n.ready.promise().done(a),this},n.extend({isReady:!1,readyWait:1,holdReady:function(a){a?n.readyWait++:n.ready(!0)},ready:function(a){(a===!0?--n.readyWait:n.isReady)||(n.isReady=!0,a!==!0&&--n.readyWait>0||(H.resolveWith(l,[n]),n.fn.triggerHandler&&(n(l).triggerHandler("ready"),n(l).off("ready"))))}});function I(){l.removeEventListener("DOMContentLoaded",I,!1),a.removeEventListener("load",I,!1),n.ready()}n.ready.promise=function(b){return H||(H=n.Deferred(),"complete"===l.readyState?setTimeout(n.ready):(l.addEventListener("DOMContentLoaded",I,!1),a.addEventListener("load",I,!1))),H.promise(b)},n.ready.promise();var J=n.access=function(a,b,c,d,e,f,g){var h=0,i=a.length,j=null==c;if("object"===n.type(c)){e=!0;for(h in c)n.access(a,b,h,c[h],!0,f,g)}else if(void 0!==d&&(e=!0,n.isFunction(d)||(g=!0),j&&(g?(b.call(a,d),b=null):(j=b,b=function(a,b,c){return j.call(n(a),c)})),b))for(;i>h;h++)b(a[h],c,g?d:d.call(a[h],h,b(a[h],c)));return e?a:j?b.call(a):i?b(a[0],c):f};n.acceptData=function(a){return 1===a.nodeType||9===a.nodeType||!+a.nodeType};function K(){Object.defineProperty(this.cache={},0,{get:function(){return{}}}),this.expando=n.expando+Math.random()}K.uid=1,K.accepts=n.acceptData,K.prototype={key:function(a){if(!K.accepts(a))return 0;var b={},c=a[this.expando];if(!c){c=K.uid++;try{b[this.expando]={value:c},Object.defineProperties(a,b)}catch(d){b[this.expando]=c,n.extend(a,b)}}return this.cache[c]||(this.cache[c]={}),c},set:function(a,b,c){var d,e=this.key(a),f=this.cache[e];if("string"==typeof b)f[b]=c;else if(n.isEmptyObject(f))n.extend(this.cache[e],b);else for(d in b)f[d]=b[d];return f},get:function(a,b){var c=this.cache[this.key(a)];return void 0===b?c:c[b]},access:function(a,b,c){var d;return void 0===b||b&&"string"==typeof b&&void 0===c?(d=this.get(a,b),void 0!==d?d:this.get(a,n.camelCase(b))):(this.set(a,b,c),void 0!==c?c:b)},remove:function(a,b){var c,d,e,f=this.key(a),g=this.cache[f];if(void 0===b)this.cache[f]={};else{n.isArray(b)?d=b.concat(b.map(n.camelCase)):(e=n.camelCase(b),b in g?d=[b,e]:(d=e,d=d in g?[d]:d.match(E)||[])),c=d.length;while(c--)delete g[d[c]]}},hasData:function(a){return!n.isEmptyObject(this.cache[a[this.expando]]||{})},discard:function(a){a[this.expando]&&delete this.cache[a[this.expando]]}};var L=new K,M=new K,N=/^(?:\{[\w\W]*\}|\[[\w\W]*\])$/,O=/([A-Z])/g;function P(a,b,c){var d;if(void 0===c&&1===a.nodeType)if(d="data-"+b.replace(O,"-$1").toLowerCase(),c=a.getAttribute(d),"string"==typeof c){try{c="true"===c?!0:"false"===c?!1:"null"===c?null:+c+""===c?+c:N.test(c)?n.parseJSON(c):c}catch(e){}M.set(a,b,c)}else c=void 0;return c}n.extend({hasData:function(a){return M.hasData(a)||L.hasData(a)},data:function(a,b,c){return M.access(a,b,c)},removeData:function(a,b){M.remove(a,b)
-},_data:function(a,b,c){return L.access(a,b,c)},_removeData:function(a,b){L.remove(a,b)}}),n.fn.extend({data:function(a,b){var c,d,e,f=this[0],g=f&&f.attributes;if(void 0===a){if(this.length&&(e=M.get(f),1===f.nodeType&&!L.get(f,"hasDataAttrs"))){c=g.length;while(c--)g[c]&&(d=g[c].name,0===d.indexOf("data-")&&(d=n.camelCase(d.slice(5)),P(f,d,e[d])));L.set(f,"hasDataAttrs",!0)}return e}return"object"==typeof a?this.each(function(){M.set(this,a)}):J(this,function(b){var c,d=n.camelCase(a);if(f&&void 0===b){if(c=M.get(f,a),void 0!==c)return c;if(c=M.get(f,d),void 0!==c)return c;if(c=P(f,d,void 0),void 0!==c)return c}else this.each(function(){var c=M.get(this,d);M.set(this,d,b),-1!==a.indexOf("-")&&void 0!==c&&M.set(this,a,b)})},null,b,arguments.length>1,null,!0)},removeData:function(a){return this.each(function(){M.remove(this,a)})}}),n.extend({queue:function(a,b,c){var d;return a?(b=(b||"fx")+"queue",d=L.get(a,b),c&&(!d||n.isArray(c)?d=L.access(a,b,n.makeArray(c)):d.push(c)),d||[]):void 0},dequeue:function(a,b){b=b||"fx";var c=n.queue(a,b),d=c.length,e=c.shift(),f=n._queueHooks(a,b),g=function(){n.dequeue(a,b)};"inprogress"===e&&(e=c.shift(),d--),e&&("fx"===b&&c.unshift("inprogress"),delete f.stop,e.call(a,g,f)),!d&&f&&f.empty.fire()},_queueHooks:function(a,b){var c=b+"queueHooks";return L.get(a,c)||L.access(a,c,{empty:n.Callbacks("once memory").add(function(){L.remove(a,[b+"queue",c])})})}}),n.fn.extend({queue:function(a,b){var c=2;return"string"!=typeof a&&(b=a,a="fx",c--),arguments.length<c?n.queue(this[0],a):void 0===b?this:this.each(function(){var c=n.queue(this,a,b);n._queueHooks(this,a),"fx"===a&&"inprogress"!==c[0]&&n.dequeue(this,a)})},dequeue:function(a){return this.each(function(){n.dequeue(this,a)})},clearQueue:function(a){return this.queue(a||"fx",[])},promise:function(a,b){var c,d=1,e=n.Deferred(),f=this,g=this.length,h=function(){--d||e.resolveWith(f,[f])};"string"!=typeof a&&(b=a,a=void 0),a=a||"fx";while(g--)c=L.get(f[g],a+"queueHooks"),c&&c.empty&&(d++,c.empty.add(h));return h(),e.promise(b)}});var Q=/[+-]?(?:\d*\.|)\d+(?:[eE][+-]?\d+|)/.source,R=["Top","Right","Bottom","Left"],S=function(a,b){return a=b||a,"none"===n.css(a,"display")||!n.contains(a.ownerDocument,a)},T=/^(?:checkbox|radio)$/i;!function(){var a=l.createDocumentFragment(),b=a.appendChild(l.createElement("div")),c=l.createElement("input");c.setAttribute("type","radio"),c.setAttribute("checked","checked"),c.setAttribute("name","t"),b.appendChild(c),k.checkClone=b.cloneNode(!0).cloneNode(!0).lastChild.checked,b.innerHTML="<textarea>x</textarea>",k.noCloneChecked=!!b.cloneNode(!0).lastChild.defaultValue}();var U="undefined";k.focusinBubbles="onfocusin"in a;var V=/^key/,W=/^(?:mouse|pointer|contextmenu)|click/,X=/^(?:focusinfocus|focusoutblur)$/,Y=/^([^.]*)(?:\.(.+)|)$/;function Z(){return!0}function $(){return!1}function _(){try{return l.activeElement}catch(a){}}n.event={global:{},add:function(a,b,c,d,e){var f,g,h,i,j,k,l,m,o,p,q,r=L.get(a);if(r){c.handler&&(f=c,c=f.handler,e=f.selector),c.guid||(c.guid=n.guid++),(i=r.events)||(i=r.events={}),(g=r.handle)||(g=r.handle=function(b){return typeof n!==U&&n.event.triggered!==b.type?n.event.dispatch.apply(a,arguments):void 0}),b=(b||"").match(E)||[""],j=b.length;while(j--)h=Y.exec(b[j])||[],o=q=h[1],p=(h[2]||"").split(".").sort(),o&&(l=n.event.special[o]||{},o=(e?l.delegateType:l.bindType)||o,l=n.event.special[o]||{},k=n.extend({type:o,origType:q,data:d,handler:c,guid:c.guid,selector:e,needsContext:e&&n.expr.match.needsContext.test(e),namespace:p.join(".")},f),(m=i[o])||(m=i[o]=[],m.delegateCount=0,l.setup&&l.setup.call(a,d,p,g)!==!1||a.addEventListener&&a.addEventListener(o,g,!1)),l.add&&(l.add.call(a,k),k.handler.guid||(k.handler.guid=c.guid)),e?m.splice(m.delegateCount++,0,k):m.push(k),n.event.global[o]=!0)}},remove:function(a,b,c,d,e){var f,g,h,i,j,k,l,m,o,p,q,r=L.hasData(a)&&L.get(a);if(r&&(i=r.events)){b=(b||"").match(E)||[""],j=b.length;while(j--)if(h=Y.exec(b[j])||[],o=q=h[1],p=(h[2]||"").split(".").sort(),o){l=n.event.special[o]||{},o=(d?l.delegateType:l.bindType)||o,m=i[o]||[],h=h[2]&&new RegExp("(^|\\.)"+p.join("\\.(?:.*\\.|)")+"(\\.|$)"),g=f=m.length;while(f--)k=m[f],!e&&q!==k.origType||c&&c.guid!==k.guid||h&&!h.test(k.namespace)||d&&d!==k.selector&&("**"!==d||!k.selector)||(m.splice(f,1),k.selector&&m.delegateCount--,l.remove&&l.remove.call(a,k));g&&!m.length&&(l.teardown&&l.teardown.call(a,p,r.handle)!==!1||n.removeEvent(a,o,r.handle),delete i[o])}else for(o in i)n.event.remove(a,o+b[j],c,d,!0);n.isEmptyObject(i)&&(delete r.handle,L.remove(a,"events"))}},trigger:function(b,c,d,e){var f,g,h,i,k,m,o,p=[d||l],q=j.call(b,"type")?b.type:b,r=j.call(b,"namespace")?b.namespace.split("."):[];if(g=h=d=d||l,3!==d.nodeType&&8!==d.nodeType&&!X.test(q+n.event.triggered)&&(q.indexOf(".")>=0&&(r=q.split("."),q=r.shift(),r.sort()),k=q.indexOf(":")<0&&"on"+q,b=b[n.expando]?b:new n.Event(q,"object"==typeof b&&b),b.isTrigger=e?2:3,b.namespace=r.join("."),b.namespace_re=b.namespace?new RegExp("(^|\\.)"+r.join("\\.(?:.*\\.|)")+"(\\.|$)"):null,b.result=void 0,b.target||(b.target=d),c=null==c?[b]:n.makeArray(c,[b]),o=n.event.special[q]||{},e||!o.trigger||o.trigger.apply(d,c)!==!1)){if(!e&&!o.noBubble&&!n.isWindow(d)){for(i=o.delegateType||q,X.test(i+q)||(g=g.parentNode);g;g=g.parentNode)p.push(g),h=g;h===(d.ownerDocument||l)&&p.push(h.defaultView||h.parentWindow||a)}f=0;while((g=p[f++])&&!b.isPropagationStopped())b.type=f>1?i:o.bindType||q,m=(L.get(g,"events")||{})[b.type]&&L.get(g,"handle"),m&&m.apply(g,c),m=k&&g[k],m&&m.apply&&n.acceptData(g)&&(b.result=m.apply(g,c),b.result===!1&&b.preventDefault());return b.type=q,e||b.isDefaultPreve)***^***",
-R"***^***(nted()||o._default&&o._default.apply(p.pop(),c)!==!1||!n.acceptData(d)||k&&n.isFunction(d[q])&&!n.isWindow(d)&&(h=d[k],h&&(d[k]=null),n.event.triggered=q,d[q](),n.event.triggered=void 0,h&&(d[k]=h)),b.result}},dispatch:function(a){a=n.event.fix(a);var b,c,e,f,g,h=[],i=d.call(arguments),j=(L.get(this,"events")||{})[a.type]||[],k=n.event.special[a.type]||{};if(i[0]=a,a.delegateTarget=this,!k.preDispatch||k.preDispatch.call(this,a)!==!1){h=n.event.handlers.call(this,a,j),b=0;while((f=h[b++])&&!a.isPropagationStopped()){a.currentTarget=f.elem,c=0;while((g=f.handlers[c++])&&!a.isImmediatePropagationStopped())(!a.namespace_re||a.namespace_re.test(g.namespace))&&(a.handleObj=g,a.data=g.data,e=((n.event.special[g.origType]||{}).handle||g.handler).apply(f.elem,i),void 0!==e&&(a.result=e)===!1&&(a.preventDefault(),a.stopPropagation()))}return k.postDispatch&&k.postDispatch.call(this,a),a.result}},handlers:function(a,b){var c,d,e,f,g=[],h=b.delegateCount,i=a.target;if(h&&i.nodeType&&(!a.button||"click"!==a.type))for(;i!==this;i=i.parentNode||this)if(i.disabled!==!0||"click"!==a.type){for(d=[],c=0;h>c;c++)f=b[c],e=f.selector+" ",void 0===d[e]&&(d[e]=f.needsContext?n(e,this).index(i)>=0:n.find(e,this,null,[i]).length),d[e]&&d.push(f);d.length&&g.push({elem:i,handlers:d})}return h<b.length&&g.push({elem:this,handlers:b.slice(h)}),g},props:"altKey bubbles cancelable ctrlKey currentTarget eventPhase metaKey relatedTarget shiftKey target timeStamp view which".split(" "),fixHooks:{},keyHooks:{props:"char charCode key keyCode".split(" "),filter:function(a,b){return null==a.which&&(a.which=null!=b.charCode?b.charCode:b.keyCode),a}},mouseHooks:{props:"button buttons clientX clientY offsetX offsetY pageX pageY screenX screenY toElement".split(" "),filter:function(a,b){var c,d,e,f=b.button;return null==a.pageX&&null!=b.clientX&&(c=a.target.ownerDocument||l,d=c.documentElement,e=c.body,a.pageX=b.clientX+(d&&d.scrollLeft||e&&e.scrollLeft||0)-(d&&d.clientLeft||e&&e.clientLeft||0),a.pageY=b.clientY+(d&&d.scrollTop||e&&e.scrollTop||0)-(d&&d.clientTop||e&&e.clientTop||0)),a.which||void 0===f||(a.which=1&f?1:2&f?3:4&f?2:0),a}},fix:function(a){if(a[n.expando])return a;var b,c,d,e=a.type,f=a,g=this.fixHooks[e];g||(this.fixHooks[e]=g=W.test(e)?this.mouseHooks:V.test(e)?this.keyHooks:{}),d=g.props?this.props.concat(g.props):this.props,a=new n.Event(f),b=d.length;while(b--)c=d[b],a[c]=f[c];return a.target||(a.target=l),3===a.target.nodeType&&(a.target=a.target.parentNode),g.filter?g.filter(a,f):a},special:{load:{noBubble:!0},focus:{trigger:function(){return this!==_()&&this.focus?(this.focus(),!1):void 0},delegateType:"focusin"},blur:{trigger:function(){return this===_()&&this.blur?(this.blur(),!1):void 0},delegateType:"focusout"},click:{trigger:function(){return"checkbox"===this.type&&this.click&&n.nodeName(this,"input")?(this.click(),!1):void 0},_default:function(a){return n.nodeName(a.target,"a")}},beforeunload:{postDispatch:function(a){void 0!==a.result&&a.originalEvent&&(a.originalEvent.returnValue=a.result)}}},simulate:function(a,b,c,d){var e=n.extend(new n.Event,c,{type:a,isSimulated:!0,originalEvent:{}});d?n.event.trigger(e,null,b):n.event.dispatch.call(b,e),e.isDefaultPrevented()&&c.preventDefault()}},n.removeEvent=function(a,b,c){a.removeEventListener&&a.removeEventListener(b,c,!1)},n.Event=function(a,b){return this instanceof n.Event?(a&&a.type?(this.originalEvent=a,this.type=a.type,this.isDefaultPrevented=a.defaultPrevented||void 0===a.defaultPrevented&&a.returnValue===!1?Z:$):this.type=a,b&&n.extend(this,b),this.timeStamp=a&&a.timeStamp||n.now(),void(this[n.expando]=!0)):new n.Event(a,b)},n.Event.prototype={isDefaultPrevented:$,isPropagationStopped:$,isImmediatePropagationStopped:$,preventDefault:function(){var a=this.originalEvent;this.isDefaultPrevented=Z,a&&a.preventDefault&&a.preventDefault()},stopPropagation:function(){var a=this.originalEvent;this.isPropagationStopped=Z,a&&a.stopPropagation&&a.stopPropagation()},stopImmediatePropagation:function(){var a=this.originalEvent;this.isImmediatePropagationStopped=Z,a&&a.stopImmediatePropagation&&a.stopImmediatePropagation(),this.stopPropagation()}},n.each({mouseenter:"mouseover",mouseleave:"mouseout",pointerenter:"pointerover",pointerleave:"pointerout"},function(a,b){n.event.special[a]={delegateType:b,bindType:b,handle:function(a){var c,d=this,e=a.relatedTarget,f=a.handleObj;return(!e||e!==d&&!n.contains(d,e))&&(a.type=f.origType,c=f.handler.apply(this,arguments),a.type=b),c}}}),k.focusinBubbles||n.each({focus:"focusin",blur:"focusout"},function(a,b){var c=function(a){n.event.simulate(b,a.target,n.event.fix(a),!0)};n.event.special[b]={setup:function(){var d=this.ownerDocument||this,e=L.access(d,b);e||d.addEventListener(a,c,!0),L.access(d,b,(e||0)+1)},teardown:function(){var d=this.ownerDocument||this,e=L.access(d,b)-1;e?L.access(d,b,e):(d.removeEventListener(a,c,!0),L.remove(d,b))}}}),n.fn.extend({on:function(a,b,c,d,e){var f,g;if("object"==typeof a){"string"!=typeof b&&(c=c||b,b=void 0);for(g in a)this.on(g,b,c,a[g],e);return this}if(null==c&&null==d?(d=b,c=b=void 0):null==d&&("string"==typeof b?(d=c,c=void 0):(d=c,c=b,b=void 0)),d===!1)d=$;else if(!d)return this;return 1===e&&(f=d,d=function(a){return n().off(a),f.apply(this,arguments)},d.guid=f.guid||(f.guid=n.guid++)),this.each(function(){n.event.add(this,a,d,c,b)})},one:function(a,b,c,d){return this.on(a,b,c,d,1)},off:function(a,b,c){var d,e;if(a&&a.preventDefault&&a.handleObj)return d=a.handleObj,n(a.delegateTarget).off(d.namespace?d.origType+"."+d.namespace:d.origType,d.selector,d.handler),this;if("object"==typeof a){for(e in a)this.off(e,b,a[e]);return this}return(b===!1||"function"==typeof b)&&(c=b,b=void 0),c===!1&&(c=$),this.each(function(){n.event.remove(this,a,c,b)})},trigger:function(a,b){return this.each(function(){n.event.trigger(a,b,this)})},triggerHandler:function(a,b){var c=this[0];return c?n.event.trigger(a,b,c,!0):void 0}});var ab=/<(?!area|br|col|embed|hr|img|input|link|meta|param)(([\w:]+)[^>]*)\/>/gi,bb=/<([\w:]+)/,cb=/<|&#?\w+;/,db=/<(?:script|style|link)/i,eb=/checked\s*(?:[^=]|=\s*.checked.)/i,fb=/^$|\/(?:java|ecma)script/i,gb=/^true\/(.*)/,hb=/^\s*<!(?:\[CDATA\[|--)|(?:\]\]|--)>\s*$/g,ib={option:[1,"<select multiple='multiple'>","</select>"],thead:[1,"<table>","</table>"],col:[2,"<table><colgroup>","</colgroup></table>"],tr:[2,"<table><tbody>","</tbody></table>"],td:[3,"<table><tbody><tr>","</tr></tbody></table>"],_default:[0,"",""]};ib.optgroup=ib.option,ib.tbody=ib.tfoot=ib.colgroup=ib.caption=ib.thead,ib.th=ib.td;function jb(a,b){return n.nodeName(a,"table")&&n.nodeName(11!==b.nodeType?b:b.firstChild,"tr")?a.getElementsByTagName("tbody")[0]||a.appendChild(a.ownerDocument.createElement("tbody")):a}function kb(a){return a.type=(null!==a.getAttribute("type"))+"/"+a.type,a}function lb(a){var b=gb.exec(a.type);return b?a.type=b[1]:a.removeAttribute("type"),a}function mb(a,b){for(var c=0,d=a.length;d>c;c++)L.set(a[c],"globalEval",!b||L.get(b[c],"globalEval"))}function nb(a,b){var c,d,e,f,g,h,i,j;if(1===b.nodeType){if(L.hasData(a)&&(f=L.access(a),g=L.set(b,f),j=f.events)){delete g.handle,g.events={};for(e in j)for(c=0,d=j[e].length;d>c;c++)n.event.add(b,e,j[e][c])}M.hasData(a)&&(h=M.access(a),i=n.extend({},h),M.set(b,i))}}function ob(a,b){var c=a.getElementsByTagName?a.getElementsByTagName(b||"*"):a.querySelectorAll?a.querySelectorAll(b||"*"):[];return void 0===b||b&&n.nodeName(a,b)?n.merge([a],c):c}function pb(a,b){var c=b.nodeName.toLowerCase();"input"===c&&T.test(a.type)?b.checked=a.checked:("input"===c||"textarea"===c)&&(b.defaultValue=a.defaultValue)}n.extend({clone:function(a,b,c){var d,e,f,g,h=a.cloneNode(!0),i=n.contains(a.ownerDocument,a);if(!(k.noCloneChecked||1!==a.nodeType&&11!==a.nodeType||n.isXMLDoc(a)))for(g=ob(h),f=ob(a),d=0,e=f.length;e>d;d++)pb(f[d],g[d]);if(b)if(c)for(f=f||ob(a),g=g||ob(h),d=0,e=f.length;e>d;d++)nb(f[d],g[d]);else nb(a,h);return g=ob(h,"script"),g.length>0&&mb(g,!i&&ob(a,"script")),h},buildFragment:function(a,b,c,d){for(var e,f,g,h,i,j,k=b.createDocumentFragment(),l=[],m=0,o=a.length;o>m;m++)if(e=a[m],e||0===e)if("object"===n.type(e))n.merge(l,e.nodeType?[e]:e);else if(cb.test(e)){f=f||k.appendChild(b.createElement("div")),g=(bb.exec(e)||["",""])[1].toLowerCase(),h=ib[g]||ib._default,f.innerHTML=h[1]+e.replace(ab,"<$1></$2>")+h[2],j=h[0];while(j--)f=f.lastChild;n.merge(l,f.childNodes),f=k.firstChild,f.textContent=""}else l.push(b.createTextNode(e));k.textContent="",m=0;while(e=l[m++])if((!d||-1===n.inArray(e,d))&&(i=n.contains(e.ownerDocument,e),f=ob(k.appendChild(e),"script"),i&&mb(f),c)){j=0;while(e=f[j++])fb.test(e.type||"")&&c.push(e)}return k},cleanData:function(a){for(var b,c,d,e,f=n.event.special,g=0;void 0!==(c=a[g]);g++){if(n.acceptData(c)&&(e=c[L.expando],e&&(b=L.cache[e]))){if(b.events)for(d in b.events)f[d]?n.event.remove(c,d):n.removeEvent(c,d,b.handle);L.cache[e]&&delete L.cache[e]}delete M.cache[c[M.expando]]}}}),n.fn.extend({text:function(a){return J(this,function(a){return void 0===a?n.text(this):this.empty().each(function(){(1===this.nodeType||11===this.nodeType||9===this.nodeType)&&(this.textContent=a)})},null,a,arguments.length)},append:function(){return this.domManip(arguments,function(a){if(1===this.nodeType||11===this.nodeType||9===this.nodeType){var b=jb(this,a);b.appendChild(a)}})},prepend:function(){return this.domManip(arguments,function(a){if(1===this.nodeType||11===this.nodeType||9===this.nodeType){var b=jb(this,a);b.insertBefore(a,b.firstChild)}})},before:function(){return this.domManip(arguments,function(a){this.parentNode&&this.parentNode.insertBefore(a,this)})},after:function(){return this.domManip(arguments,function(a){this.parentNode&&this.parentNode.insertBefore(a,this.nextSibling)})},remove:function(a,b){for(var c,d=a?n.filter(a,this):this,e=0;null!=(c=d[e]);e++)b||1!==c.nodeType||n.cleanData(ob(c)),c.parentNode&&(b&&n.contains(c.ownerDocument,c)&&mb(ob(c,"script")),c.parentNode.removeChild(c));return this},empty:function(){for(var a,b=)***^***",
-R"***^***(0;null!=(a=this[b]);b++)1===a.nodeType&&(n.cleanData(ob(a,!1)),a.textContent="");return this},clone:function(a,b){return a=null==a?!1:a,b=null==b?a:b,this.map(function(){return n.clone(this,a,b)})},html:function(a){return J(this,function(a){var b=this[0]||{},c=0,d=this.length;if(void 0===a&&1===b.nodeType)return b.innerHTML;if("string"==typeof a&&!db.test(a)&&!ib[(bb.exec(a)||["",""])[1].toLowerCase()]){a=a.replace(ab,"<$1></$2>");try{for(;d>c;c++)b=this[c]||{},1===b.nodeType&&(n.cleanData(ob(b,!1)),b.innerHTML=a);b=0}catch(e){}}b&&this.empty().append(a)},null,a,arguments.length)},replaceWith:function(){var a=arguments[0];return this.domManip(arguments,function(b){a=this.parentNode,n.cleanData(ob(this)),a&&a.replaceChild(b,this)}),a&&(a.length||a.nodeType)?this:this.remove()},detach:function(a){return this.remove(a,!0)},domManip:function(a,b){a=e.apply([],a);var c,d,f,g,h,i,j=0,l=this.length,m=this,o=l-1,p=a[0],q=n.isFunction(p);if(q||l>1&&"string"==typeof p&&!k.checkClone&&eb.test(p))return this.each(function(c){var d=m.eq(c);q&&(a[0]=p.call(this,c,d.html())),d.domManip(a,b)});if(l&&(c=n.buildFragment(a,this[0].ownerDocument,!1,this),d=c.firstChild,1===c.childNodes.length&&(c=d),d)){for(f=n.map(ob(c,"script"),kb),g=f.length;l>j;j++)h=c,j!==o&&(h=n.clone(h,!0,!0),g&&n.merge(f,ob(h,"script"))),b.call(this[j],h,j);if(g)for(i=f[f.length-1].ownerDocument,n.map(f,lb),j=0;g>j;j++)h=f[j],fb.test(h.type||"")&&!L.access(h,"globalEval")&&n.contains(i,h)&&(h.src?n._evalUrl&&n._evalUrl(h.src):n.globalEval(h.textContent.replace(hb,"")))}return this}}),n.each({appendTo:"append",prependTo:"prepend",insertBefore:"before",insertAfter:"after",replaceAll:"replaceWith"},function(a,b){n.fn[a]=function(a){for(var c,d=[],e=n(a),g=e.length-1,h=0;g>=h;h++)c=h===g?this:this.clone(!0),n(e[h])[b](c),f.apply(d,c.get());return this.pushStack(d)}});var qb,rb={};function sb(b,c){var d,e=n(c.createElement(b)).appendTo(c.body),f=a.getDefaultComputedStyle&&(d=a.getDefaultComputedStyle(e[0]))?d.display:n.css(e[0],"display");return e.detach(),f}function tb(a){var b=l,c=rb[a];return c||(c=sb(a,b),"none"!==c&&c||(qb=(qb||n("<iframe frameborder='0' width='0' height='0'/>")).appendTo(b.documentElement),b=qb[0].contentDocument,b.write(),b.close(),c=sb(a,b),qb.detach()),rb[a]=c),c}var ub=/^margin/,vb=new RegExp("^("+Q+")(?!px)[a-z%]+$","i"),wb=function(a){return a.ownerDocument.defaultView.getComputedStyle(a,null)};function xb(a,b,c){var d,e,f,g,h=a.style;return c=c||wb(a),c&&(g=c.getPropertyValue(b)||c[b]),c&&(""!==g||n.contains(a.ownerDocument,a)||(g=n.style(a,b)),vb.test(g)&&ub.test(b)&&(d=h.width,e=h.minWidth,f=h.maxWidth,h.minWidth=h.maxWidth=h.width=g,g=c.width,h.width=d,h.minWidth=e,h.maxWidth=f)),void 0!==g?g+"":g}function yb(a,b){return{get:function(){return a()?void delete this.get:(this.get=b).apply(this,arguments)}}}!function(){var b,c,d=l.documentElement,e=l.createElement("div"),f=l.createElement("div");if(f.style){f.style.backgroundClip="content-box",f.cloneNode(!0).style.backgroundClip="",k.clearCloneStyle="content-box"===f.style.backgroundClip,e.style.cssText="border:0;width:0;height:0;top:0;left:-9999px;margin-top:1px;position:absolute",e.appendChild(f);function g(){f.style.cssText="-webkit-box-sizing:border-box;-moz-box-sizing:border-box;box-sizing:border-box;display:block;margin-top:1%;top:1%;border:1px;padding:1px;width:4px;position:absolute",f.innerHTML="",d.appendChild(e);var g=a.getComputedStyle(f,null);b="1%"!==g.top,c="4px"===g.width,d.removeChild(e)}a.getComputedStyle&&n.extend(k,{pixelPosition:function(){return g(),b},boxSizingReliable:function(){return null==c&&g(),c},reliableMarginRight:function(){var b,c=f.appendChild(l.createElement("div"));return c.style.cssText=f.style.cssText="-webkit-box-sizing:content-box;-moz-box-sizing:content-box;box-sizing:content-box;display:block;margin:0;border:0;padding:0",c.style.marginRight=c.style.width="0",f.style.width="1px",d.appendChild(e),b=!parseFloat(a.getComputedStyle(c,null).marginRight),d.removeChild(e),b}})}}(),n.swap=function(a,b,c,d){var e,f,g={};for(f in b)g[f]=a.style[f],a.style[f]=b[f];e=c.apply(a,d||[]);for(f in b)a.style[f]=g[f];return e};var zb=/^(none|table(?!-c[ea]).+)/,Ab=new RegExp("^("+Q+")(.*)$","i"),Bb=new RegExp("^([+-])=("+Q+")","i"),Cb={position:"absolute",visibility:"hidden",display:"block"},Db={letterSpacing:"0",fontWeight:"400"},Eb=["Webkit","O","Moz","ms"];function Fb(a,b){if(b in a)return b;var c=b[0].toUpperCase()+b.slice(1),d=b,e=Eb.length;while(e--)if(b=Eb[e]+c,b in a)return b;return d}function Gb(a,b,c){var d=Ab.exec(b);return d?Math.max(0,d[1]-(c||0))+(d[2]||"px"):b}function Hb(a,b,c,d,e){for(var f=c===(d?"border":"content")?4:"width"===b?1:0,g=0;4>f;f+=2)"margin"===c&&(g+=n.css(a,c+R[f],!0,e)),d?("content"===c&&(g-=n.css(a,"padding"+R[f],!0,e)),"margin"!==c&&(g-=n.css(a,"border"+R[f]+"Width",!0,e))):(g+=n.css(a,"padding"+R[f],!0,e),"padding"!==c&&(g+=n.css(a,"border"+R[f]+"Width",!0,e)));return g}function Ib(a,b,c){var d=!0,e="width"===b?a.offsetWidth:a.offsetHeight,f=wb(a),g="border-box"===n.css(a,"boxSizing",!1,f);if(0>=e||null==e){if(e=xb(a,b,f),(0>e||null==e)&&(e=a.style[b]),vb.test(e))return e;d=g&&(k.boxSizingReliable()||e===a.style[b]),e=parseFloat(e)||0}return e+Hb(a,b,c||(g?"border":"content"),d,f)+"px"}function Jb(a,b){for(var c,d,e,f=[],g=0,h=a.length;h>g;g++)d=a[g],d.style&&(f[g]=L.get(d,"olddisplay"),c=d.style.display,b?(f[g]||"none"!==c||(d.style.display=""),""===d.style.display&&S(d)&&(f[g]=L.access(d,"olddisplay",tb(d.nodeName)))):(e=S(d),"none"===c&&e||L.set(d,"olddisplay",e?c:n.css(d,"display"))));for(g=0;h>g;g++)d=a[g],d.style&&(b&&"none"!==d.style.display&&""!==d.style.display||(d.style.display=b?f[g]||"":"none"));return a}n.extend({cssHooks:{opacity:{get:function(a,b){if(b){var c=xb(a,"opacity");return""===c?"1":c}}}},cssNumber:{columnCount:!0,fillOpacity:!0,flexGrow:!0,flexShrink:!0,fontWeight:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,widows:!0,zIndex:!0,zoom:!0},cssProps:{"float":"cssFloat"},style:function(a,b,c,d){if(a&&3!==a.nodeType&&8!==a.nodeType&&a.style){var e,f,g,h=n.camelCase(b),i=a.style;return b=n.cssProps[h]||(n.cssProps[h]=Fb(i,h)),g=n.cssHooks[b]||n.cssHooks[h],void 0===c?g&&"get"in g&&void 0!==(e=g.get(a,!1,d))?e:i[b]:(f=typeof c,"string"===f&&(e=Bb.exec(c))&&(c=(e[1]+1)*e[2]+parseFloat(n.css(a,b)),f="number"),null!=c&&c===c&&("number"!==f||n.cssNumber[h]||(c+="px"),k.clearCloneStyle||""!==c||0!==b.indexOf("background")||(i[b]="inherit"),g&&"set"in g&&void 0===(c=g.set(a,c,d))||(i[b]=c)),void 0)}},css:function(a,b,c,d){var e,f,g,h=n.camelCase(b);return b=n.cssProps[h]||(n.cssProps[h]=Fb(a.style,h)),g=n.cssHooks[b]||n.cssHooks[h],g&&"get"in g&&(e=g.get(a,!0,c)),void 0===e&&(e=xb(a,b,d)),"normal"===e&&b in Db&&(e=Db[b]),""===c||c?(f=parseFloat(e),c===!0||n.isNumeric(f)?f||0:e):e}}),n.each(["height","width"],function(a,b){n.cssHooks[b]={get:function(a,c,d){return c?zb.test(n.css(a,"display"))&&0===a.offsetWidth?n.swap(a,Cb,function(){return Ib(a,b,d)}):Ib(a,b,d):void 0},set:function(a,c,d){var e=d&&wb(a);return Gb(a,c,d?Hb(a,b,d,"border-box"===n.css(a,"boxSizing",!1,e),e):0)}}}),n.cssHooks.marginRight=yb(k.reliableMarginRight,function(a,b){return b?n.swap(a,{display:"inline-block"},xb,[a,"marginRight"]):void 0}),n.each({margin:"",padding:"",border:"Width"},function(a,b){n.cssHooks[a+b]={expand:function(c){for(var d=0,e={},f="string"==typeof c?c.split(" "):[c];4>d;d++)e[a+R[d]+b]=f[d]||f[d-2]||f[0];return e}},ub.test(a)||(n.cssHooks[a+b].set=Gb)}),n.fn.extend({css:function(a,b){return J(this,function(a,b,c){var d,e,f={},g=0;if(n.isArray(b)){for(d=wb(a),e=b.length;e>g;g++)f[b[g]]=n.css(a,b[g],!1,d);return f}return void 0!==c?n.style(a,b,c):n.css(a,b)},a,b,arguments.length>1)},show:function(){return Jb(this,!0)},hide:function(){return Jb(this)},toggle:function(a){return"boolean"==typeof a?a?this.show():this.hide():this.each(function(){S(this)?n(this).show():n(this).hide()})}});function Kb(a,b,c,d,e){return new Kb.prototype.init(a,b,c,d,e)}n.Tween=Kb,Kb.prototype={constructor:Kb,init:function(a,b,c,d,e,f){this.elem=a,this.prop=c,this.easing=e||"swing",this.options=b,this.start=this.now=this.cur(),this.end=d,this.unit=f||(n.cssNumber[c]?"":"px")},cur:function(){var a=Kb.propHooks[this.prop];return a&&a.get?a.get(this):Kb.propHooks._default.get(this)},run:function(a){var b,c=Kb.propHooks[this.prop];return this.pos=b=this.options.duration?n.easing[this.easing](a,this.options.duration*a,0,1,this.options.duration):a,this.now=(this.end-this.start)*b+this.start,this.options.step&&this.options.step.call(this.elem,this.now,this),c&&c.set?c.set(this):Kb.propHooks._default.set(this),this}},Kb.prototype.init.prototype=Kb.prototype,Kb.propHooks={_default:{get:function(a){var b;return null==a.elem[a.prop]||a.elem.style&&null!=a.elem.style[a.prop]?(b=n.css(a.elem,a.prop,""),b&&"auto"!==b?b:0):a.elem[a.prop]},set:function(a){n.fx.step[a.prop]?n.fx.step[a.prop](a):a.elem.style&&(null!=a.elem.style[n.cssProps[a.prop]]||n.cssHooks[a.prop])?n.style(a.elem,a.prop,a.now+a.unit):a.elem[a.prop]=a.now}}},Kb.propHooks.scrollTop=Kb.propHooks.scrollLeft={set:function(a){a.elem.nodeType&&a.elem.parentNode&&(a.elem[a.prop]=a.now)}},n.easing={linear:function(a){return a},swing:function(a){return.5-Math.cos(a*Math.PI)/2}},n.fx=Kb.prototype.init,n.fx.step={};var Lb,Mb,Nb=/^(?:toggle|show|hide)$/,Ob=new RegExp("^(?:([+-])=|)("+Q+")([a-z%]*)$","i"),Pb=/queueHooks$/,Qb=[Vb],Rb={"*":[function(a,b){var c=this.createTween(a,b),d=c.cur(),e=Ob.exec(b),f=e&&e[3]||(n.cssNumber[a]?"":"px"),g=(n.cssNumber[a]||"px"!==f&&+d)&&Ob.exec(n.css(c.elem,a)),h=1,i=20;if(g&&g[3]!==f){f=f||g[3],e=e||[],g=+d||1;do h=h||".5",g/=h,n.style(c.elem,a,g+f);while(h!==(h=c.cur()/d)&&1!==h&&--i)}return e&&(g=c.start=+g||+d||0,c.unit=f,c.end=e[1]?g+(e[1]+1)*e[2]:+e[2]),c}]};function Sb(){return setTimeout(function(){Lb=void 0}),Lb=n.now()}function Tb(a,b){var c,d=0,e={height:a};for(b=b?1:0;4>d;d+=2-b)c=R[d],e["margin"+c]=e["padding"+c]=a;return b&&(e.opacity=e.width=a),e}function)***^***",
-R"***^***( Ub(a,b,c){for(var d,e=(Rb[b]||[]).concat(Rb["*"]),f=0,g=e.length;g>f;f++)if(d=e[f].call(c,b,a))return d}function Vb(a,b,c){var d,e,f,g,h,i,j,k,l=this,m={},o=a.style,p=a.nodeType&&S(a),q=L.get(a,"fxshow");c.queue||(h=n._queueHooks(a,"fx"),null==h.unqueued&&(h.unqueued=0,i=h.empty.fire,h.empty.fire=function(){h.unqueued||i()}),h.unqueued++,l.always(function(){l.always(function(){h.unqueued--,n.queue(a,"fx").length||h.empty.fire()})})),1===a.nodeType&&("height"in b||"width"in b)&&(c.overflow=[o.overflow,o.overflowX,o.overflowY],j=n.css(a,"display"),k="none"===j?L.get(a,"olddisplay")||tb(a.nodeName):j,"inline"===k&&"none"===n.css(a,"float")&&(o.display="inline-block")),c.overflow&&(o.overflow="hidden",l.always(function(){o.overflow=c.overflow[0],o.overflowX=c.overflow[1],o.overflowY=c.overflow[2]}));for(d in b)if(e=b[d],Nb.exec(e)){if(delete b[d],f=f||"toggle"===e,e===(p?"hide":"show")){if("show"!==e||!q||void 0===q[d])continue;p=!0}m[d]=q&&q[d]||n.style(a,d)}else j=void 0;if(n.isEmptyObject(m))"inline"===("none"===j?tb(a.nodeName):j)&&(o.display=j);else{q?"hidden"in q&&(p=q.hidden):q=L.access(a,"fxshow",{}),f&&(q.hidden=!p),p?n(a).show():l.done(function(){n(a).hide()}),l.done(function(){var b;L.remove(a,"fxshow");for(b in m)n.style(a,b,m[b])});for(d in m)g=Ub(p?q[d]:0,d,l),d in q||(q[d]=g.start,p&&(g.end=g.start,g.start="width"===d||"height"===d?1:0))}}function Wb(a,b){var c,d,e,f,g;for(c in a)if(d=n.camelCase(c),e=b[d],f=a[c],n.isArray(f)&&(e=f[1],f=a[c]=f[0]),c!==d&&(a[d]=f,delete a[c]),g=n.cssHooks[d],g&&"expand"in g){f=g.expand(f),delete a[d];for(c in f)c in a||(a[c]=f[c],b[c]=e)}else b[d]=e}function Xb(a,b,c){var d,e,f=0,g=Qb.length,h=n.Deferred().always(function(){delete i.elem}),i=function(){if(e)return!1;for(var b=Lb||Sb(),c=Math.max(0,j.startTime+j.duration-b),d=c/j.duration||0,f=1-d,g=0,i=j.tweens.length;i>g;g++)j.tweens[g].run(f);return h.notifyWith(a,[j,f,c]),1>f&&i?c:(h.resolveWith(a,[j]),!1)},j=h.promise({elem:a,props:n.extend({},b),opts:n.extend(!0,{specialEasing:{}},c),originalProperties:b,originalOptions:c,startTime:Lb||Sb(),duration:c.duration,tweens:[],createTween:function(b,c){var d=n.Tween(a,j.opts,b,c,j.opts.specialEasing[b]||j.opts.easing);return j.tweens.push(d),d},stop:function(b){var c=0,d=b?j.tweens.length:0;if(e)return this;for(e=!0;d>c;c++)j.tweens[c].run(1);return b?h.resolveWith(a,[j,b]):h.rejectWith(a,[j,b]),this}}),k=j.props;for(Wb(k,j.opts.specialEasing);g>f;f++)if(d=Qb[f].call(j,a,k,j.opts))return d;return n.map(k,Ub,j),n.isFunction(j.opts.start)&&j.opts.start.call(a,j),n.fx.timer(n.extend(i,{elem:a,anim:j,queue:j.opts.queue})),j.progress(j.opts.progress).done(j.opts.done,j.opts.complete).fail(j.opts.fail).always(j.opts.always)}n.Animation=n.extend(Xb,{tweener:function(a,b){n.isFunction(a)?(b=a,a=["*"]):a=a.split(" ");for(var c,d=0,e=a.length;e>d;d++)c=a[d],Rb[c]=Rb[c]||[],Rb[c].unshift(b)},prefilter:function(a,b){b?Qb.unshift(a):Qb.push(a)}}),n.speed=function(a,b,c){var d=a&&"object"==typeof a?n.extend({},a):{complete:c||!c&&b||n.isFunction(a)&&a,duration:a,easing:c&&b||b&&!n.isFunction(b)&&b};return d.duration=n.fx.off?0:"number"==typeof d.duration?d.duration:d.duration in n.fx.speeds?n.fx.speeds[d.duration]:n.fx.speeds._default,(null==d.queue||d.queue===!0)&&(d.queue="fx"),d.old=d.complete,d.complete=function(){n.isFunction(d.old)&&d.old.call(this),d.queue&&n.dequeue(this,d.queue)},d},n.fn.extend({fadeTo:function(a,b,c,d){return this.filter(S).css("opacity",0).show().end().animate({opacity:b},a,c,d)},animate:function(a,b,c,d){var e=n.isEmptyObject(a),f=n.speed(b,c,d),g=function(){var b=Xb(this,n.extend({},a),f);(e||L.get(this,"finish"))&&b.stop(!0)};return g.finish=g,e||f.queue===!1?this.each(g):this.queue(f.queue,g)},stop:function(a,b,c){var d=function(a){var b=a.stop;delete a.stop,b(c)};return"string"!=typeof a&&(c=b,b=a,a=void 0),b&&a!==!1&&this.queue(a||"fx",[]),this.each(function(){var b=!0,e=null!=a&&a+"queueHooks",f=n.timers,g=L.get(this);if(e)g[e]&&g[e].stop&&d(g[e]);else for(e in g)g[e]&&g[e].stop&&Pb.test(e)&&d(g[e]);for(e=f.length;e--;)f[e].elem!==this||null!=a&&f[e].queue!==a||(f[e].anim.stop(c),b=!1,f.splice(e,1));(b||!c)&&n.dequeue(this,a)})},finish:function(a){return a!==!1&&(a=a||"fx"),this.each(function(){var b,c=L.get(this),d=c[a+"queue"],e=c[a+"queueHooks"],f=n.timers,g=d?d.length:0;for(c.finish=!0,n.queue(this,a,[]),e&&e.stop&&e.stop.call(this,!0),b=f.length;b--;)f[b].elem===this&&f[b].queue===a&&(f[b].anim.stop(!0),f.splice(b,1));for(b=0;g>b;b++)d[b]&&d[b].finish&&d[b].finish.call(this);delete c.finish})}}),n.each(["toggle","show","hide"],function(a,b){var c=n.fn[b];n.fn[b]=function(a,d,e){return null==a||"boolean"==typeof a?c.apply(this,arguments):this.animate(Tb(b,!0),a,d,e)}}),n.each({slideDown:Tb("show"),slideUp:Tb("hide"),slideToggle:Tb("toggle"),fadeIn:{opacity:"show"},fadeOut:{opacity:"hide"},fadeToggle:{opacity:"toggle"}},function(a,b){n.fn[a]=function(a,c,d){return this.animate(b,a,c,d)}}),n.timers=[],n.fx.tick=function(){var a,b=0,c=n.timers;for(Lb=n.now();b<c.length;b++)a=c[b],a()||c[b]!==a||c.splice(b--,1);c.length||n.fx.stop(),Lb=void 0},n.fx.timer=function(a){n.timers.push(a),a()?n.fx.start():n.timers.pop()},n.fx.interval=13,n.fx.start=function(){Mb||(Mb=setInterval(n.fx.tick,n.fx.interval))},n.fx.stop=function(){clearInterval(Mb),Mb=null},n.fx.speeds={slow:600,fast:200,_default:400},n.fn.delay=function(a,b){return a=n.fx?n.fx.speeds[a]||a:a,b=b||"fx",this.queue(b,function(b,c){var d=setTimeout(b,a);c.stop=function(){clearTimeout(d)}})},function(){var a=l.createElement("input"),b=l.createElement("select"),c=b.appendChild(l.createElement("option"));a.type="checkbox",k.checkOn=""!==a.value,k.optSelected=c.selected,b.disabled=!0,k.optDisabled=!c.disabled,a=l.createElement("input"),a.value="t",a.type="radio",k.radioValue="t"===a.value}();var Yb,Zb,$b=n.expr.attrHandle;n.fn.extend({attr:function(a,b){return J(this,n.attr,a,b,arguments.length>1)},removeAttr:function(a){return this.each(function(){n.removeAttr(this,a)})}}),n.extend({attr:function(a,b,c){var d,e,f=a.nodeType;if(a&&3!==f&&8!==f&&2!==f)return typeof a.getAttribute===U?n.prop(a,b,c):(1===f&&n.isXMLDoc(a)||(b=b.toLowerCase(),d=n.attrHooks[b]||(n.expr.match.bool.test(b)?Zb:Yb)),void 0===c?d&&"get"in d&&null!==(e=d.get(a,b))?e:(e=n.find.attr(a,b),null==e?void 0:e):null!==c?d&&"set"in d&&void 0!==(e=d.set(a,c,b))?e:(a.setAttribute(b,c+""),c):void n.removeAttr(a,b))
-},removeAttr:function(a,b){var c,d,e=0,f=b&&b.match(E);if(f&&1===a.nodeType)while(c=f[e++])d=n.propFix[c]||c,n.expr.match.bool.test(c)&&(a[d]=!1),a.removeAttribute(c)},attrHooks:{type:{set:function(a,b){if(!k.radioValue&&"radio"===b&&n.nodeName(a,"input")){var c=a.value;return a.setAttribute("type",b),c&&(a.value=c),b}}}}}),Zb={set:function(a,b,c){return b===!1?n.removeAttr(a,c):a.setAttribute(c,c),c}},n.each(n.expr.match.bool.source.match(/\w+/g),function(a,b){var c=$b[b]||n.find.attr;$b[b]=function(a,b,d){var e,f;return d||(f=$b[b],$b[b]=e,e=null!=c(a,b,d)?b.toLowerCase():null,$b[b]=f),e}});var _b=/^(?:input|select|textarea|button)$/i;n.fn.extend({prop:function(a,b){return J(this,n.prop,a,b,arguments.length>1)},removeProp:function(a){return this.each(function(){delete this[n.propFix[a]||a]})}}),n.extend({propFix:{"for":"htmlFor","class":"className"},prop:function(a,b,c){var d,e,f,g=a.nodeType;if(a&&3!==g&&8!==g&&2!==g)return f=1!==g||!n.isXMLDoc(a),f&&(b=n.propFix[b]||b,e=n.propHooks[b]),void 0!==c?e&&"set"in e&&void 0!==(d=e.set(a,c,b))?d:a[b]=c:e&&"get"in e&&null!==(d=e.get(a,b))?d:a[b]},propHooks:{tabIndex:{get:function(a){return a.hasAttribute("tabindex")||_b.test(a.nodeName)||a.href?a.tabIndex:-1}}}}),k.optSelected||(n.propHooks.selected={get:function(a){var b=a.parentNode;return b&&b.parentNode&&b.parentNode.selectedIndex,null}}),n.each(["tabIndex","readOnly","maxLength","cellSpacing","cellPadding","rowSpan","colSpan","useMap","frameBorder","contentEditable"],function(){n.propFix[this.toLowerCase()]=this});var ac=/[\t\r\n\f]/g;n.fn.extend({addClass:function(a){var b,c,d,e,f,g,h="string"==typeof a&&a,i=0,j=this.length;if(n.isFunction(a))return this.each(function(b){n(this).addClass(a.call(this,b,this.className))});if(h)for(b=(a||"").match(E)||[];j>i;i++)if(c=this[i],d=1===c.nodeType&&(c.className?(" "+c.className+" ").replace(ac," "):" ")){f=0;while(e=b[f++])d.indexOf(" "+e+" ")<0&&(d+=e+" ");g=n.trim(d),c.className!==g&&(c.className=g)}return this},removeClass:function(a){var b,c,d,e,f,g,h=0===arguments.length||"string"==typeof a&&a,i=0,j=this.length;if(n.isFunction(a))return this.each(function(b){n(this).removeClass(a.call(this,b,this.className))});if(h)for(b=(a||"").match(E)||[];j>i;i++)if(c=this[i],d=1===c.nodeType&&(c.className?(" "+c.className+" ").replace(ac," "):"")){f=0;while(e=b[f++])while(d.indexOf(" "+e+" ")>=0)d=d.replace(" "+e+" "," ");g=a?n.trim(d):"",c.className!==g&&(c.className=g)}return this},toggleClass:function(a,b){var c=typeof a;return"boolean"==typeof b&&"string"===c?b?this.addClass(a):this.removeClass(a):this.each(n.isFunction(a)?function(c){n(this).toggleClass(a.call(this,c,this.className,b),b)}:function(){if("string"===c){var b,d=0,e=n(this),f=a.match(E)||[];while(b=f[d++])e.hasClass(b)?e.removeClass(b):e.addClass(b)}else(c===U||"boolean"===c)&&(this.className&&L.set(this,"__className__",this.className),this.className=this.className||a===!1?"":L.get(this,"__className__")||"")})},hasClass:function(a){for(var b=" "+a+" ",c=0,d=this.length;d>c;c++)if(1===this[c].nodeType&&(" "+this[c].className+" ").replace(ac," ").indexOf(b)>=0)return!0;return!1}});var bc=/\r/g;n.fn.extend({val:function(a){var b,c,d,e=this[0];{if(arguments.length)return d=n.isFunction(a),this.each(function(c){var e;1===this.nodeType&&(e=d?a.call(this,c,n(this).val()):a,null==e?e="":"number"==typeof e?e+="":n.isArray(e)&&(e=n.map(e,function(a){return null==a?"":a+""})),b=n.valHooks[this.type]||n.valHooks[this.nodeName.toLowerCase()],b&&"set"in b&&void 0!==b.set(this,e,"value")||(this.value=e))});if(e)return b=n.valHooks[e.type]||)***^***",
-R"***^***(n.valHooks[e.nodeName.toLowerCase()],b&&"get"in b&&void 0!==(c=b.get(e,"value"))?c:(c=e.value,"string"==typeof c?c.replace(bc,""):null==c?"":c)}}}),n.extend({valHooks:{option:{get:function(a){var b=n.find.attr(a,"value");return null!=b?b:n.trim(n.text(a))}},select:{get:function(a){for(var b,c,d=a.options,e=a.selectedIndex,f="select-one"===a.type||0>e,g=f?null:[],h=f?e+1:d.length,i=0>e?h:f?e:0;h>i;i++)if(c=d[i],!(!c.selected&&i!==e||(k.optDisabled?c.disabled:null!==c.getAttribute("disabled"))||c.parentNode.disabled&&n.nodeName(c.parentNode,"optgroup"))){if(b=n(c).val(),f)return b;g.push(b)}return g},set:function(a,b){var c,d,e=a.options,f=n.makeArray(b),g=e.length;while(g--)d=e[g],(d.selected=n.inArray(d.value,f)>=0)&&(c=!0);return c||(a.selectedIndex=-1),f}}}}),n.each(["radio","checkbox"],function(){n.valHooks[this]={set:function(a,b){return n.isArray(b)?a.checked=n.inArray(n(a).val(),b)>=0:void 0}},k.checkOn||(n.valHooks[this].get=function(a){return null===a.getAttribute("value")?"on":a.value})}),n.each("blur focus focusin focusout load resize scroll unload click dblclick mousedown mouseup mousemove mouseover mouseout mouseenter mouseleave change select submit keydown keypress keyup error contextmenu".split(" "),function(a,b){n.fn[b]=function(a,c){return arguments.length>0?this.on(b,null,a,c):this.trigger(b)}}),n.fn.extend({hover:function(a,b){return this.mouseenter(a).mouseleave(b||a)},bind:function(a,b,c){return this.on(a,null,b,c)},unbind:function(a,b){return this.off(a,null,b)},delegate:function(a,b,c,d){return this.on(b,a,c,d)},undelegate:function(a,b,c){return 1===arguments.length?this.off(a,"**"):this.off(b,a||"**",c)}});var cc=n.now(),dc=/\?/;n.parseJSON=function(a){return JSON.parse(a+"")},n.parseXML=function(a){var b,c;if(!a||"string"!=typeof a)return null;try{c=new DOMParser,b=c.parseFromString(a,"text/xml")}catch(d){b=void 0}return(!b||b.getElementsByTagName("parsererror").length)&&n.error("Invalid XML: "+a),b};var ec,fc,gc=/#.*$/,hc=/([?&])_=[^&]*/,ic=/^(.*?):[ \t]*([^\r\n]*)$/gm,jc=/^(?:about|app|app-storage|.+-extension|file|res|widget):$/,kc=/^(?:GET|HEAD)$/,lc=/^\/\//,mc=/^([\w.+-]+:)(?:\/\/(?:[^\/?#]*@|)([^\/?#:]*)(?::(\d+)|)|)/,nc={},oc={},pc="*/".concat("*");try{fc=location.href}catch(qc){fc=l.createElement("a"),fc.href="",fc=fc.href}ec=mc.exec(fc.toLowerCase())||[];function rc(a){return function(b,c){"string"!=typeof b&&(c=b,b="*");var d,e=0,f=b.toLowerCase().match(E)||[];if(n.isFunction(c))while(d=f[e++])"+"===d[0]?(d=d.slice(1)||"*",(a[d]=a[d]||[]).unshift(c)):(a[d]=a[d]||[]).push(c)}}function sc(a,b,c,d){var e={},f=a===oc;function g(h){var i;return e[h]=!0,n.each(a[h]||[],function(a,h){var j=h(b,c,d);return"string"!=typeof j||f||e[j]?f?!(i=j):void 0:(b.dataTypes.unshift(j),g(j),!1)}),i}return g(b.dataTypes[0])||!e["*"]&&g("*")}function tc(a,b){var c,d,e=n.ajaxSettings.flatOptions||{};for(c in b)void 0!==b[c]&&((e[c]?a:d||(d={}))[c]=b[c]);return d&&n.extend(!0,a,d),a}function uc(a,b,c){var d,e,f,g,h=a.contents,i=a.dataTypes;while("*"===i[0])i.shift(),void 0===d&&(d=a.mimeType||b.getResponseHeader("Content-Type"));if(d)for(e in h)if(h[e]&&h[e].test(d)){i.unshift(e);break}if(i[0]in c)f=i[0];else{for(e in c){if(!i[0]||a.converters[e+" "+i[0]]){f=e;break}g||(g=e)}f=f||g}return f?(f!==i[0]&&i.unshift(f),c[f]):void 0}function vc(a,b,c,d){var e,f,g,h,i,j={},k=a.dataTypes.slice();if(k[1])for(g in a.converters)j[g.toLowerCase()]=a.converters[g];f=k.shift();while(f)if(a.responseFields[f]&&(c[a.responseFields[f]]=b),!i&&d&&a.dataFilter&&(b=a.dataFilter(b,a.dataType)),i=f,f=k.shift())if("*"===f)f=i;else if("*"!==i&&i!==f){if(g=j[i+" "+f]||j["* "+f],!g)for(e in j)if(h=e.split(" "),h[1]===f&&(g=j[i+" "+h[0]]||j["* "+h[0]])){g===!0?g=j[e]:j[e]!==!0&&(f=h[0],k.unshift(h[1]));break}if(g!==!0)if(g&&a["throws"])b=g(b);else try{b=g(b)}catch(l){return{state:"parsererror",error:g?l:"No conversion from "+i+" to "+f}}}return{state:"success",data:b}}n.extend({active:0,lastModified:{},etag:{},ajaxSettings:{url:fc,type:"GET",isLocal:jc.test(ec[1]),global:!0,processData:!0,async:!0,contentType:"application/x-www-form-urlencoded; charset=UTF-8",accepts:{"*":pc,text:"text/plain",html:"text/html",xml:"application/xml, text/xml",json:"application/json, text/javascript"},contents:{xml:/xml/,html:/html/,json:/json/},responseFields:{xml:"responseXML",text:"responseText",json:"responseJSON"},converters:{"* text":String,"text html":!0,"text json":n.parseJSON,"text xml":n.parseXML},flatOptions:{url:!0,context:!0}},ajaxSetup:function(a,b){return b?tc(tc(a,n.ajaxSettings),b):tc(n.ajaxSettings,a)},ajaxPrefilter:rc(nc),ajaxTransport:rc(oc),ajax:function(a,b){"object"==typeof a&&(b=a,a=void 0),b=b||{};var c,d,e,f,g,h,i,j,k=n.ajaxSetup({},b),l=k.context||k,m=k.context&&(l.nodeType||l.jquery)?n(l):n.event,o=n.Deferred(),p=n.Callbacks("once memory"),q=k.statusCode||{},r={},s={},t=0,u="canceled",v={readyState:0,getResponseHeader:function(a){var b;if(2===t){if(!f){f={};while(b=ic.exec(e))f[b[1].toLowerCase()]=b[2]}b=f[a.toLowerCase()]}return null==b?null:b},getAllResponseHeaders:function(){return 2===t?e:null},setRequestHeader:function(a,b){var c=a.toLowerCase();return t||(a=s[c]=s[c]||a,r[a]=b),this},overrideMimeType:function(a){return t||(k.mimeType=a),this},statusCode:function(a){var b;if(a)if(2>t)for(b in a)q[b]=[q[b],a[b]];else v.always(a[v.status]);return this},abort:function(a){var b=a||u;return c&&c.abort(b),x(0,b),this}};if(o.promise(v).complete=p.add,v.success=v.done,v.error=v.fail,k.url=((a||k.url||fc)+"").replace(gc,"").replace(lc,ec[1]+"//"),k.type=b.method||b.type||k.method||k.type,k.dataTypes=n.trim(k.dataType||"*").toLowerCase().match(E)||[""],null==k.crossDomain&&(h=mc.exec(k.url.toLowerCase()),k.crossDomain=!(!h||h[1]===ec[1]&&h[2]===ec[2]&&(h[3]||("http:"===h[1]?"80":"443"))===(ec[3]||("http:"===ec[1]?"80":"443")))),k.data&&k.processData&&"string"!=typeof k.data&&(k.data=n.param(k.data,k.traditional)),sc(nc,k,b,v),2===t)return v;i=k.global,i&&0===n.active++&&n.event.trigger("ajaxStart"),k.type=k.type.toUpperCase(),k.hasContent=!kc.test(k.type),d=k.url,k.hasContent||(k.data&&(d=k.url+=(dc.test(d)?"&":"?")+k.data,delete k.data),k.cache===!1&&(k.url=hc.test(d)?d.replace(hc,"$1_="+cc++):d+(dc.test(d)?"&":"?")+"_="+cc++)),k.ifModified&&(n.lastModified[d]&&v.setRequestHeader("If-Modified-Since",n.lastModified[d]),n.etag[d]&&v.setRequestHeader("If-None-Match",n.etag[d])),(k.data&&k.hasContent&&k.contentType!==!1||b.contentType)&&v.setRequestHeader("Content-Type",k.contentType),v.setRequestHeader("Accept",k.dataTypes[0]&&k.accepts[k.dataTypes[0]]?k.accepts[k.dataTypes[0]]+("*"!==k.dataTypes[0]?", "+pc+"; q=0.01":""):k.accepts["*"]);for(j in k.headers)v.setRequestHeader(j,k.headers[j]);if(k.beforeSend&&(k.beforeSend.call(l,v,k)===!1||2===t))return v.abort();u="abort";for(j in{success:1,error:1,complete:1})v[j](k[j]);if(c=sc(oc,k,b,v)){v.readyState=1,i&&m.trigger("ajaxSend",[v,k]),k.async&&k.timeout>0&&(g=setTimeout(function(){v.abort("timeout")},k.timeout));try{t=1,c.send(r,x)}catch(w){if(!(2>t))throw w;x(-1,w)}}else x(-1,"No Transport");function x(a,b,f,h){var j,r,s,u,w,x=b;2!==t&&(t=2,g&&clearTimeout(g),c=void 0,e=h||"",v.readyState=a>0?4:0,j=a>=200&&300>a||304===a,f&&(u=uc(k,v,f)),u=vc(k,u,v,j),j?(k.ifModified&&(w=v.getResponseHeader("Last-Modified"),w&&(n.lastModified[d]=w),w=v.getResponseHeader("etag"),w&&(n.etag[d]=w)),204===a||"HEAD"===k.type?x="nocontent":304===a?x="notmodified":(x=u.state,r=u.data,s=u.error,j=!s)):(s=x,(a||!x)&&(x="error",0>a&&(a=0))),v.status=a,v.statusText=(b||x)+"",j?o.resolveWith(l,[r,x,v]):o.rejectWith(l,[v,x,s]),v.statusCode(q),q=void 0,i&&m.trigger(j?"ajaxSuccess":"ajaxError",[v,k,j?r:s]),p.fireWith(l,[v,x]),i&&(m.trigger("ajaxComplete",[v,k]),--n.active||n.event.trigger("ajaxStop")))}return v},getJSON:function(a,b,c){return n.get(a,b,c,"json")},getScript:function(a,b){return n.get(a,void 0,b,"script")}}),n.each(["get","post"],function(a,b){n[b]=function(a,c,d,e){return n.isFunction(c)&&(e=e||d,d=c,c=void 0),n.ajax({url:a,type:b,dataType:e,data:c,success:d})}}),n.each(["ajaxStart","ajaxStop","ajaxComplete","ajaxError","ajaxSuccess","ajaxSend"],function(a,b){n.fn[b]=function(a){return this.on(b,a)}}),n._evalUrl=function(a){return n.ajax({url:a,type:"GET",dataType:"script",async:!1,global:!1,"throws":!0})},n.fn.extend({wrapAll:function(a){var b;return n.isFunction(a)?this.each(function(b){n(this).wrapAll(a.call(this,b))}):(this[0]&&(b=n(a,this[0].ownerDocument).eq(0).clone(!0),this[0].parentNode&&b.insertBefore(this[0]),b.map(function(){var a=this;while(a.firstElementChild)a=a.firstElementChild;return a}).append(this)),this)},wrapInner:function(a){return this.each(n.isFunction(a)?function(b){n(this).wrapInner(a.call(this,b))}:function(){var b=n(this),c=b.contents();c.length?c.wrapAll(a):b.append(a)})},wrap:function(a){var b=n.isFunction(a);return this.each(function(c){n(this).wrapAll(b?a.call(this,c):a)})},unwrap:function(){return this.parent().each(function(){n.nodeName(this,"body")||n(this).replaceWith(this.childNodes)}).end()}}),n.expr.filters.hidden=function(a){return a.offsetWidth<=0&&a.offsetHeight<=0},n.expr.filters.visible=function(a){return!n.expr.filters.hidden(a)};var wc=/%20/g,xc=/\[\]$/,yc=/\r?\n/g,zc=/^(?:submit|button|image|reset|file)$/i,Ac=/^(?:input|select|textarea|keygen)/i;function Bc(a,b,c,d){var e;if(n.isArray(b))n.each(b,function(b,e){c||xc.test(a)?d(a,e):Bc(a+"["+("object"==typeof e?b:"")+"]",e,c,d)});else if(c||"object"!==n.type(b))d(a,b);else for(e in b)Bc(a+"["+e+"]",b[e],c,d)}n.param=function(a,b){var c,d=[],e=function(a,b){b=n.isFunction(b)?b():null==b?"":b,d[d.length]=encodeURIComponent(a)+"="+encodeURIComponent(b)};if(void 0===b&&(b=n.ajaxSettings&&n.ajaxSettings.traditional),n.isArray(a)||a.jquery&&!n.isPlainObject(a))n.each(a,function(){e(this.name,this.value)});else for(c in a)Bc(c,a[c],b,e);return d.join("&").replace(wc,"+")},n.fn.extend({serialize:function(){return n.param(this.serializeArray())},serializeArray:function(){return this.map(function(){var a=n.)***^***",
-R"***^***(prop(this,"elements");return a?n.makeArray(a):this}).filter(function(){var a=this.type;return this.name&&!n(this).is(":disabled")&&Ac.test(this.nodeName)&&!zc.test(a)&&(this.checked||!T.test(a))}).map(function(a,b){var c=n(this).val();return null==c?null:n.isArray(c)?n.map(c,function(a){return{name:b.name,value:a.replace(yc,"\r\n")}}):{name:b.name,value:c.replace(yc,"\r\n")}}).get()}}),n.ajaxSettings.xhr=function(){try{return new XMLHttpRequest}catch(a){}};var Cc=0,Dc={},Ec={0:200,1223:204},Fc=n.ajaxSettings.xhr();a.ActiveXObject&&n(a).on("unload",function(){for(var a in Dc)Dc[a]()}),k.cors=!!Fc&&"withCredentials"in Fc,k.ajax=Fc=!!Fc,n.ajaxTransport(function(a){var b;return k.cors||Fc&&!a.crossDomain?{send:function(c,d){var e,f=a.xhr(),g=++Cc;if(f.open(a.type,a.url,a.async,a.username,a.password),a.xhrFields)for(e in a.xhrFields)f[e]=a.xhrFields[e];a.mimeType&&f.overrideMimeType&&f.overrideMimeType(a.mimeType),a.crossDomain||c["X-Requested-With"]||(c["X-Requested-With"]="XMLHttpRequest");for(e in c)f.setRequestHeader(e,c[e]);b=function(a){return function(){b&&(delete Dc[g],b=f.onload=f.onerror=null,"abort"===a?f.abort():"error"===a?d(f.status,f.statusText):d(Ec[f.status]||f.status,f.statusText,"string"==typeof f.responseText?{text:f.responseText}:void 0,f.getAllResponseHeaders()))}},f.onload=b(),f.onerror=b("error"),b=Dc[g]=b("abort");try{f.send(a.hasContent&&a.data||null)}catch(h){if(b)throw h}},abort:function(){b&&b()}}:void 0}),n.ajaxSetup({accepts:{script:"text/javascript, application/javascript, application/ecmascript, application/x-ecmascript"},contents:{script:/(?:java|ecma)script/},converters:{"text script":function(a){return n.globalEval(a),a}}}),n.ajaxPrefilter("script",function(a){void 0===a.cache&&(a.cache=!1),a.crossDomain&&(a.type="GET")}),n.ajaxTransport("script",function(a){if(a.crossDomain){var b,c;return{send:function(d,e){b=n("<script>").prop({async:!0,charset:a.scriptCharset,src:a.url}).on("load error",c=function(a){b.remove(),c=null,a&&e("error"===a.type?404:200,a.type)}),l.head.appendChild(b[0])},abort:function(){c&&c()}}}});var Gc=[],Hc=/(=)\?(?=&|$)|\?\?/;n.ajaxSetup({jsonp:"callback",jsonpCallback:function(){var a=Gc.pop()||n.expando+"_"+cc++;return this[a]=!0,a}}),n.ajaxPrefilter("json jsonp",function(b,c,d){var e,f,g,h=b.jsonp!==!1&&(Hc.test(b.url)?"url":"string"==typeof b.data&&!(b.contentType||"").indexOf("application/x-www-form-urlencoded")&&Hc.test(b.data)&&"data");return h||"jsonp"===b.dataTypes[0]?(e=b.jsonpCallback=n.isFunction(b.jsonpCallback)?b.jsonpCallback():b.jsonpCallback,h?b[h]=b[h].replace(Hc,"$1"+e):b.jsonp!==!1&&(b.url+=(dc.test(b.url)?"&":"?")+b.jsonp+"="+e),b.converters["script json"]=function(){return g||n.error(e+" was not called"),g[0]},b.dataTypes[0]="json",f=a[e],a[e]=function(){g=arguments},d.always(function(){a[e]=f,b[e]&&(b.jsonpCallback=c.jsonpCallback,Gc.push(e)),g&&n.isFunction(f)&&f(g[0]),g=f=void 0}),"script"):void 0}),n.parseHTML=function(a,b,c){if(!a||"string"!=typeof a)return null;"boolean"==typeof b&&(c=b,b=!1),b=b||l;var d=v.exec(a),e=!c&&[];return d?[b.createElement(d[1])]:(d=n.buildFragment([a],b,e),e&&e.length&&n(e).remove(),n.merge([],d.childNodes))};var Ic=n.fn.load;n.fn.load=function(a,b,c){if("string"!=typeof a&&Ic)return Ic.apply(this,arguments);var d,e,f,g=this,h=a.indexOf(" ");return h>=0&&(d=n.trim(a.slice(h)),a=a.slice(0,h)),n.isFunction(b)?(c=b,b=void 0):b&&"object"==typeof b&&(e="POST"),g.length>0&&n.ajax({url:a,type:e,dataType:"html",data:b}).done(function(a){f=arguments,g.html(d?n("<div>").append(n.parseHTML(a)).find(d):a)}).complete(c&&function(a,b){g.each(c,f||[a.responseText,b,a])}),this},n.expr.filters.animated=function(a){return n.grep(n.timers,function(b){return a===b.elem}).length};var Jc=a.document.documentElement;function Kc(a){return n.isWindow(a)?a:9===a.nodeType&&a.defaultView}n.offset={setOffset:function(a,b,c){var d,e,f,g,h,i,j,k=n.css(a,"position"),l=n(a),m={};"static"===k&&(a.style.position="relative"),h=l.offset(),f=n.css(a,"top"),i=n.css(a,"left"),j=("absolute"===k||"fixed"===k)&&(f+i).indexOf("auto")>-1,j?(d=l.position(),g=d.top,e=d.left):(g=parseFloat(f)||0,e=parseFloat(i)||0),n.isFunction(b)&&(b=b.call(a,c,h)),null!=b.top&&(m.top=b.top-h.top+g),null!=b.left&&(m.left=b.left-h.left+e),"using"in b?b.using.call(a,m):l.css(m)}},n.fn.extend({offset:function(a){if(arguments.length)return void 0===a?this:this.each(function(b){n.offset.setOffset(this,a,b)});var b,c,d=this[0],e={top:0,left:0},f=d&&d.ownerDocument;if(f)return b=f.documentElement,n.contains(b,d)?(typeof d.getBoundingClientRect!==U&&(e=d.getBoundingClientRect()),c=Kc(f),{top:e.top+c.pageYOffset-b.clientTop,left:e.left+c.pageXOffset-b.clientLeft}):e},position:function(){if(this[0]){var a,b,c=this[0],d={top:0,left:0};return"fixed"===n.css(c,"position")?b=c.getBoundingClientRect():(a=this.offsetParent(),b=this.offset(),n.nodeName(a[0],"html")||(d=a.offset()),d.top+=n.css(a[0],"borderTopWidth",!0),d.left+=n.css(a[0],"borderLeftWidth",!0)),{top:b.top-d.top-n.css(c,"marginTop",!0),left:b.left-d.left-n.css(c,"marginLeft",!0)}}},offsetParent:function(){return this.map(function(){var a=this.offsetParent||Jc;while(a&&!n.nodeName(a,"html")&&"static"===n.css(a,"position"))a=a.offsetParent;return a||Jc})}}),n.each({scrollLeft:"pageXOffset",scrollTop:"pageYOffset"},function(b,c){var d="pageYOffset"===c;n.fn[b]=function(e){return J(this,function(b,e,f){var g=Kc(b);return void 0===f?g?g[c]:b[e]:void(g?g.scrollTo(d?a.pageXOffset:f,d?f:a.pageYOffset):b[e]=f)},b,e,arguments.length,null)}}),n.each(["top","left"],function(a,b){n.cssHooks[b]=yb(k.pixelPosition,function(a,c){return c?(c=xb(a,b),vb.test(c)?n(a).position()[b]+"px":c):void 0})}),n.each({Height:"height",Width:"width"},function(a,b){n.each({padding:"inner"+a,content:b,"":"outer"+a},function(c,d){n.fn[d]=function(d,e){var f=arguments.length&&(c||"boolean"!=typeof d),g=c||(d===!0||e===!0?"margin":"border");return J(this,function(b,c,d){var e;return n.isWindow(b)?b.document.documentElement["client"+a]:9===b.nodeType?(e=b.documentElement,Math.max(b.body["scroll"+a],e["scroll"+a],b.body["offset"+a],e["offset"+a],e["client"+a])):void 0===d?n.css(b,c,g):n.style(b,c,d,g)},b,f?d:void 0,f,null)}})}),n.fn.size=function(){return this.length},n.fn.andSelf=n.fn.addBack,"function"==typeof define&&define.amd&&define("jquery",[],function(){return n});var Lc=a.jQuery,Mc=a.$;return n.noConflict=function(b){return a.$===n&&(a.$=Mc),b&&a.jQuery===n&&(a.jQuery=Lc),n},typeof b===U&&(a.jQuery=a.$=n),n});
+  const EstimateAndDistribution<FpNs> &linear_least_squares() const {
+    return linear_least_squares_;
+  }
 
-        </script>
+  const EstimateAndDistribution<double> &r_squared() const { return r_squared_; }
 
-        <script>
-/*
- Highcharts JS v4.0.4 (2014-09-02)
+  // The time per iteration from a regression with an intercept
+  const EstimateAndDistribution<FpNs> &slope() const { return slope_; }
 
- (c) 2009-2014 Torstein Honsi
+  // The intercept of that regression, the fixed cost of each measurement
+  const EstimateAndDistribution<FpNs> &overhead() const { return overhead_; }
 
- License: www.highcharts.com/license
-*/
-(function(){function r(a,b){var c;a||(a={});for(c in b)a[c]=b[c];return a}function w(){var a,b=arguments,c,d={},e=function(a,b){var c,d;typeof a!=="object"&&(a={});for(d in b)b.hasOwnProperty(d)&&(c=b[d],a[d]=c&&typeof c==="object"&&Object.prototype.toString.call(c)!=="[object Array]"&&d!=="renderTo"&&typeof c.nodeType!=="number"?e(a[d]||{},c):b[d]);return a};b[0]===!0&&(d=b[1],b=Array.prototype.slice.call(b,2));c=b.length;for(a=0;a<c;a++)d=e(d,b[a]);return d}function y(a,b){return parseInt(a,b||
-10)}function Ga(a){return typeof a==="string"}function da(a){return a&&typeof a==="object"}function Ha(a){return Object.prototype.toString.call(a)==="[object Array]"}function ja(a){return typeof a==="number"}function za(a){return V.log(a)/V.LN10}function ka(a){return V.pow(10,a)}function la(a,b){for(var c=a.length;c--;)if(a[c]===b){a.splice(c,1);break}}function s(a){return a!==u&&a!==null}function F(a,b,c){var d,e;if(Ga(b))s(c)?a.setAttribute(b,c):a&&a.getAttribute&&(e=a.getAttribute(b));else if(s(b)&&
-da(b))for(d in b)a.setAttribute(d,b[d]);return e}function ra(a){return Ha(a)?a:[a]}function p(){var a=arguments,b,c,d=a.length;for(b=0;b<d;b++)if(c=a[b],c!==u&&c!==null)return c}function B(a,b){if(Aa&&!ba&&b&&b.opacity!==u)b.filter="alpha(opacity="+b.opacity*100+")";r(a.style,b)}function $(a,b,c,d,e){a=x.createElement(a);b&&r(a,b);e&&B(a,{padding:0,border:P,margin:0});c&&B(a,c);d&&d.appendChild(a);return a}function ma(a,b){var c=function(){return u};c.prototype=new a;r(c.prototype,b);return c}function Ba(a,
-b,c,d){var e=K.numberFormat,f=E.lang,g=+a||0,h=b===-1?(g.toString().split(".")[1]||"").length:isNaN(b=Q(b))?2:b,i=c===void 0?f.decimalPoint:c,f=d===void 0?f.thousandsSep:d,j=g<0?"-":"",k=String(y(g=Q(g).toFixed(h))),l=k.length>3?k.length%3:0;return e!==Ba?e(a,b,c,d):j+(l?k.substr(0,l)+f:"")+k.substr(l).replace(/(\d{3})(?=\d)/g,"$1"+f)+(h?i+Q(g-k).toFixed(h).slice(2):"")}function Ia(a,b){return Array((b||2)+1-String(a).length).join(0)+a}function Na(a,b,c){var d=a[b];a[b]=function(){var a=Array.prototype.slice.call(arguments);
-a.unshift(d);return c.apply(this,a)}}function Ja(a,b){for(var c="{",d=!1,e,f,g,h,i,j=[];(c=a.indexOf(c))!==-1;){e=a.slice(0,c);if(d){f=e.split(":");g=f.shift().split(".");i=g.length;e=b;for(h=0;h<i;h++)e=e[g[h]];if(f.length)f=f.join(":"),g=/\.([0-9])/,h=E.lang,i=void 0,/f$/.test(f)?(i=(i=f.match(g))?i[1]:-1,e!==null&&(e=Ba(e,i,h.decimalPoint,f.indexOf(",")>-1?h.thousandsSep:""))):e=cb(f,e)}j.push(e);a=a.slice(c+1);c=(d=!d)?"}":"{"}j.push(a);return j.join("")}function mb(a){return V.pow(10,U(V.log(a)/
-V.LN10))}function nb(a,b,c,d){var e,c=p(c,1);e=a/c;b||(b=[1,2,2.5,5,10],d===!1&&(c===1?b=[1,2,5,10]:c<=0.1&&(b=[1/c])));for(d=0;d<b.length;d++)if(a=b[d],e<=(b[d]+(b[d+1]||b[d]))/2)break;a*=c;return a}function ob(a,b){var c=a.length,d,e;for(e=0;e<c;e++)a[e].ss_i=e;a.sort(function(a,c){d=b(a,c);return d===0?a.ss_i-c.ss_i:d});for(e=0;e<c;e++)delete a[e].ss_i}function Oa(a){for(var b=a.length,c=a[0];b--;)a[b]<c&&(c=a[b]);return c}function Ca(a){for(var b=a.length,c=a[0];b--;)a[b]>c&&(c=a[b]);return c}
-function Pa(a,b){for(var c in a)a[c]&&a[c]!==b&&a[c].destroy&&a[c].destroy(),delete a[c]}function Qa(a){db||(db=$(Ka));a&&db.appendChild(a);db.innerHTML=""}function ea(a){return parseFloat(a.toPrecision(14))}function Ra(a,b){va=p(a,b.animation)}function Bb(){var a=E.global.useUTC,b=a?"g)***^***",
-R"***^***(etUTC":"get",c=a?"setUTC":"set";Da=E.global.Date||window.Date;Sa=(a&&E.global.timezoneOffset||0)*6E4;eb=a?Da.UTC:function(a,b,c,g,h,i){return(new Da(a,b,p(c,1),p(g,0),p(h,0),p(i,0))).getTime()};pb=b+"Minutes";qb=b+
-"Hours";rb=b+"Day";Xa=b+"Date";fb=b+"Month";gb=b+"FullYear";Cb=c+"Minutes";Db=c+"Hours";sb=c+"Date";Eb=c+"Month";Fb=c+"FullYear"}function S(){}function Ta(a,b,c,d){this.axis=a;this.pos=b;this.type=c||"";this.isNew=!0;!c&&!d&&this.addLabel()}function na(){this.init.apply(this,arguments)}function Ya(){this.init.apply(this,arguments)}function Gb(a,b,c,d,e){var f=a.chart.inverted;this.axis=a;this.isNegative=c;this.options=b;this.x=d;this.total=null;this.points={};this.stack=e;this.alignOptions={align:b.align||
-(f?c?"left":"right":"center"),verticalAlign:b.verticalAlign||(f?"middle":c?"bottom":"top"),y:p(b.y,f?4:c?14:-6),x:p(b.x,f?c?-6:6:0)};this.textAlign=b.textAlign||(f?c?"right":"left":"center")}var u,x=document,G=window,V=Math,v=V.round,U=V.floor,La=V.ceil,t=V.max,L=V.min,Q=V.abs,aa=V.cos,fa=V.sin,oa=V.PI,Ea=oa*2/360,wa=navigator.userAgent,Hb=G.opera,Aa=/msie/i.test(wa)&&!Hb,hb=x.documentMode===8,tb=/AppleWebKit/.test(wa),Ua=/Firefox/.test(wa),Ib=/(Mobile|Android|Windows Phone)/.test(wa),xa="http://www.w3.org/2000/svg",
-ba=!!x.createElementNS&&!!x.createElementNS(xa,"svg").createSVGRect,Ob=Ua&&parseInt(wa.split("Firefox/")[1],10)<4,ga=!ba&&!Aa&&!!x.createElement("canvas").getContext,Za,$a,Jb={},ub=0,db,E,cb,va,vb,A,ha,sa=function(){return u},W=[],ab=0,Ka="div",P="none",Pb=/^[0-9]+$/,Qb="stroke-width",Da,eb,Sa,pb,qb,rb,Xa,fb,gb,Cb,Db,sb,Eb,Fb,H={},K;G.Highcharts?ha(16,!0):K=G.Highcharts={};cb=function(a,b,c){if(!s(b)||isNaN(b))return"Invalid date";var a=p(a,"%Y-%m-%d %H:%M:%S"),d=new Da(b-Sa),e,f=d[qb](),g=d[rb](),
-h=d[Xa](),i=d[fb](),j=d[gb](),k=E.lang,l=k.weekdays,d=r({a:l[g].substr(0,3),A:l[g],d:Ia(h),e:h,b:k.shortMonths[i],B:k.months[i],m:Ia(i+1),y:j.toString().substr(2,2),Y:j,H:Ia(f),I:Ia(f%12||12),l:f%12||12,M:Ia(d[pb]()),p:f<12?"AM":"PM",P:f<12?"am":"pm",S:Ia(d.getSeconds()),L:Ia(v(b%1E3),3)},K.dateFormats);for(e in d)for(;a.indexOf("%"+e)!==-1;)a=a.replace("%"+e,typeof d[e]==="function"?d[e](b):d[e]);return c?a.substr(0,1).toUpperCase()+a.substr(1):a};ha=function(a,b){var c="Highcharts error #"+a+": www.highcharts.com/errors/"+
-a;if(b)throw c;G.console&&console.log(c)};A={millisecond:1,second:1E3,minute:6E4,hour:36E5,day:864E5,week:6048E5,month:26784E5,year:31556952E3};vb={init:function(a,b,c){var b=b||"",d=a.shift,e=b.indexOf("C")>-1,f=e?7:3,g,b=b.split(" "),c=[].concat(c),h,i,j=function(a){for(g=a.length;g--;)a[g]==="M"&&a.splice(g+1,0,a[g+1],a[g+2],a[g+1],a[g+2])};e&&(j(b),j(c));a.isArea&&(h=b.splice(b.length-6,6),i=c.splice(c.length-6,6));if(d<=c.length/f&&b.length===c.length)for(;d--;)c=[].concat(c).splice(0,f).concat(c);
-a.shift=0;if(b.length)for(a=c.length;b.length<a;)d=[].concat(b).splice(b.length-f,f),e&&(d[f-6]=d[f-2],d[f-5]=d[f-1]),b=b.concat(d);h&&(b=b.concat(h),c=c.concat(i));return[b,c]},step:function(a,b,c,d){var e=[],f=a.length;if(c===1)e=d;else if(f===b.length&&c<1)for(;f--;)d=parseFloat(a[f]),e[f]=isNaN(d)?a[f]:c*parseFloat(b[f]-d)+d;else e=b;return e}};(function(a){G.HighchartsAdapter=G.HighchartsAdapter||a&&{init:function(b){var c=a.fx;a.extend(a.easing,{easeOutQuad:function(a,b,c,g,h){return-g*(b/=
-h)*(b-2)+c}});a.each(["cur","_default","width","height","opacity"],function(b,e){var f=c.step,g;e==="cur"?f=c.prototype:e==="_default"&&a.Tween&&(f=a.Tween.propHooks[e],e="set");(g=f[e])&&(f[e]=function(a){var c,a=b?a:this;if(a.prop!=="align")return c=a.elem,c.attr?c.attr(a.prop,e==="cur"?u:a.now):g.apply(this,arguments)})});Na(a.cssHooks.opacity,"get",function(a,b,c){return b.attr?b.opacity||0:a.call(this,b,c)});this.addAnimSetter("d",function(a){var c=a.elem,f;if(!a.started)f=b.init(c,c.d,c.toD),
-a.start=f[0],a.end=f[1],a.started=!0;c.attr("d",b.step(a.start,a.end,a.pos,c.toD))});this.each=Array.prototype.forEach?function(a,b){return Array.prototype.forEach.call(a,b)}:function(a,b){var c,g=a.length;for(c=0;c<g;c++)if(b.call(a[c],a[c],c,a)===!1)return c};a.fn.highcharts=function(){var a="Chart",b=arguments,c,g;if(this[0]){Ga(b[0])&&(a=b[0],b=Array.prototype.slice.call(b,1));c=b[0];if(c!==u)c.chart=c.chart||{},c.chart.renderTo=this[0],new K[a](c,b[1]),g=this;c===u&&(g=W[F(this[0],"data-highcharts-chart")])}return g}},
-addAnimSetter:function(b,c){a.Tween?a.Tween.propHooks[b]={set:c}:a.fx.step[b]=c},getScript:a.getScript,inArray:a.inArray,adapterRun:function(b,c){return a(b)[c]()},grep:a.grep,map:function(a,c){for(var d=[],e=0,f=a.length;e<f;e++)d[e]=c.call(a[e],a[e],e,a);return d},offset:function(b){return a(b).offset()},addEvent:function(b,c,d){a(b).bind(c,d)},removeEvent:function(b,c,d){var e=x.removeEventListener?"removeEventListener":"detachEvent";x[e]&&b&&!b[e]&&(b[e]=function(){});a(b).unbind(c,d)},fireEvent:function(b,
-c,d,e){var f=a.Event(c),g="detached"+c,h;!Aa&&d&&(delete d.layerX,delete d.layerY,delete d.returnValue);r(f,d);b[c]&&(b[g]=b[c],b[c]=null);a.each(["preventDefault","stopPropagation"],function(a,b){var c=f[b];f[b]=function(){try{c.call(f)}catch(a){b==="preventDefault"&&(h=!0)}}});a(b).trigger(f);b[g]&&(b[c]=b[g],b[g]=null);e&&!f.isDefaultPrevented()&&!h&&e(f)},washMouseEvent:function(a){var c=a.originalEvent||a;if(c.pageX===u)c.pageX=a.pageX,c.pageY=a.pageY;return c},animate:function(b,c,d){var e=
-a(b);if(!b.style)b.style={};if(c.d)b.toD=c.d,c.d=1;e.stop();c.opacity!==u&&b.attr&&(c.opacity+="px");b.hasAnim=1;e.animate(c,d)},stop:function(b){b.hasAnim&&a(b).stop()}}})(G.jQuery);var T=G.HighchartsAdapter,M=T||{};T&&T.init.call(T,vb);var ib=M.adapterRun,Rb=M.getScript,Ma=M.inArray,q=M.each,wb=M.grep,Sb=M.offset,Va=M.map,N=M.addEvent,X=M.removeEvent,I=M.fireEvent,Tb=M.washMouseEvent,jb=M.animate,bb=M.stop,M={enabled:!0,x:0,y:15,style:{color:"#606060",cursor:"default",fontSize:"11px"}};E={colors:"#7cb5ec,#434348,#90ed7d,#f7a35c,#8085e9,#f15c80,#e4d354,#8085e8,#8d4653,#91e8e1".split(","),
-symbols:["circle","diamond","square","triangle","triangle-down"],lang:{loading:"Loading...",months:"January,February,March,April,May,June,July,August,September,October,November,December".split(","),shortMonths:"Jan,Feb,Mar,Apr,May,Jun,Jul,Aug,Sep,Oct,Nov,Dec".split(","),weekdays:"Sunday,Monday,Tuesday,Wednesday,Thursday,Friday,Saturday".split(","),decimalPoint:".",numericSymbols:"k,M,G,T,P,E".split(","),resetZoom:"Reset zoom",resetZoomTitle:"Reset zoom level 1:1",thousandsSep:","},global:{useUTC:!0,
-canvasToolsURL:"http://code.highcharts.com/4.0.4/modules/canvas-tools.js",VMLRadialGradientURL:"http://code.highcharts.com/4.0.4/gfx/vml-radial-gradient.png"},chart:{borderColor:"#4572A7",borderRadius:0,defaultSeriesType:"line",ignoreHiddenSeries:!0,spacing:[10,10,15,10],backgroundColor:"#FFFFFF",plotBorderColor:"#C0C0C0",resetZoomButton:{theme:{zIndex:20},position:{align:"right",x:-10,y:10}}},title:{text:"Chart title",align:"center",margin:15,style:{color:"#333333",fontSize:"18px"}},subtitle:{text:"",
-align:"center",style:{color:"#555555"}},plotOptions:{line:{allowPointSelect:!1,showCheckbox:!1,animation:{duration:1E3},events:{},lineWidth:2,marker:{lineWidth:0,radius:4,lineColor:"#FFFFFF",states:{hover:{enabled:!0,lineWidthPlus:1,radiusPlus:2},select:{fillColor:"#FFFFFF",lineColor:"#000000",lineWidth:2}}},point:{events:{}},dataLabels:w(M,{align:"center",enabled:!1,formatter:function(){return this.y===null?"":Ba(this.y,-1)},verticalAlign:"bottom",y:0}),cropThreshold:300,pointRange:0,states:{hover:{lineWidthPlus:1,
-marker:{},halo:{size:10,opacity:0.25}},select:{marker:{}}},stickyTracking:!0,turboThreshold:1E3}},labels:{style:{position:"absolute",color:"#3E576F"}},legend:{enabled:!0,align:"center",layout:"horizontal",labelFormatter:function(){return this.name},borderColor:"#909090",borderRadius:0,navigation:{activeColor:"#274b6d",inactiveColor:"#CCC"},shadow:!1,itemStyle:{color:"#333333",fontSize:"12px",fontWeight:"bold"},itemHoverStyle:{color:"#000"},itemHiddenStyle:{color:"#CCC"},itemCheckboxStyle:{position:"absolute",
-width:"13px",height:"13px"},symbolPadding:5,verticalAlign:"bottom",x:0,y:0,title:{style:{fontWeight:"bold"}}},loading:{labelStyle:{fontWeight:"bold",position:"relative",top:"45%"},style:{position:"absolute",backgroundColor:"white",opacity:0.5,textAlign:"center"}},tooltip:{enabled:!0,animation:ba,backgroundColor:"rgba(249, 249, 249, .85)",borderWidth:1,borderRadius:3,dateTimeLabelFormats:{millisecond:"%A, %b %e, %H:%M:%S.%L",second:"%A, %b %e, %H:%M:%S",minute:"%A, %b %e, %H:%M",hour:"%A, %b %e, %H:%M",
-day:"%A, %b %e, %Y",week:"Week from %A, %b %e, %Y",month:"%B %Y",year:"%Y"},headerFormat:'<span style="font-size: 10px">{point.key}</span><br/>',pointFormat:'<span style="color:{series.color}">â—</span> {series.name}: <b>{point.y}</b><br/>',shadow:!0,snap:Ib?25:10,style:{color:"#333333",cursor:"default",fontSize:"12px",padding:"8px",whiteSpace:"nowrap"}},credits:{enabled:!0,text:"Highcharts.com",href:"http://www.highcharts.com",position:{align:"right",x:-10,verticalAlign:"bottom",y:-5},style:{cursor:"pointer",
-color:"#909090",fontSize:"9px"}}};var ca=E.plotOptions,T=ca.line;Bb();var Ub=/rgba\(\s*([0-9]{1,3})\s*,\s*([0-9]{1,3})\s*,\s*([0-9]{1,3})\s*,\s*([0-9]?(?:\.[0-9]+)?)\s*\)/,Vb=/#([a-fA-F0-9]{2})([a-fA-F0-9]{2})([a-fA-F0-9]{2})/,Wb=/rgb\(\s*([0-9]{1,3})\s*,\s*([0-9]{1,3})\s*,\s*([0-9]{1,3})\s*\)/,ya=function(a){var b=[],c,d;(function(a){a&&a.stops?d=Va(a.stops,function(a){return ya(a[1])}):(c=Ub.exec(a))?b=[y(c[1]),y(c[2]),y(c[3]),parseFloat(c[4],10)]:(c=Vb.exec(a))?b=[y(c[1],16),y(c[2],16),y(c[3],
-16),1]:(c=Wb.exec(a))&&(b=[y(c[1]),y(c[2]),y(c[3]),1])})(a);return{get:function(c){var f;d?(f=w(a),f.stops=[].concat(f.stops),q(d,function(a,b){f.stops[b]=[f.stops[b][0],a.get(c)]})):f=b&&!isNaN(b[0])?c==="rgb"?"rgb("+b[0]+","+b[1]+","+b[2]+")":c==="a"?b[3]:"rgba("+b.join(",")+")":a;return f},brighten:function(a){if(d)q(d,function(b){b.brighten(a)});else if(ja(a)&&a!==0){var c;for(c=0;c<3;c++)b[c]+=y(a*255),b[c]<0&&(b[c]=0),b[c]>255&&(b[c]=255)}return this},rgba:b,setO)***^***",
-R"***^***(pacity:function(a){b[3]=a;return this}}};
-S.prototype={opacity:1,textProps:"fontSize,fontWeight,fontFamily,color,lineHeight,width,textDecoration,textShadow,HcTextStroke".split(","),init:function(a,b){this.element=b==="span"?$(b):x.createElementNS(xa,b);this.renderer=a},animate:function(a,b,c){b=p(b,va,!0);bb(this);if(b){b=w(b,{});if(c)b.complete=c;jb(this,a,b)}else this.attr(a),c&&c();return this},colorGradient:function(a,b,c){var d=this.renderer,e,f,g,h,i,j,k,l,n,m,o=[];a.linearGradient?f="linearGradient":a.radialGradient&&(f="radialGradient");
-if(f){g=a[f];h=d.gradients;j=a.stops;n=c.radialReference;Ha(g)&&(a[f]=g={x1:g[0],y1:g[1],x2:g[2],y2:g[3],gradientUnits:"userSpaceOnUse"});f==="radialGradient"&&n&&!s(g.gradientUnits)&&(g=w(g,{cx:n[0]-n[2]/2+g.cx*n[2],cy:n[1]-n[2]/2+g.cy*n[2],r:g.r*n[2],gradientUnits:"userSpaceOnUse"}));for(m in g)m!=="id"&&o.push(m,g[m]);for(m in j)o.push(j[m]);o=o.join(",");h[o]?a=h[o].attr("id"):(g.id=a="highcharts-"+ub++,h[o]=i=d.createElement(f).attr(g).add(d.defs),i.stops=[],q(j,function(a){a[1].indexOf("rgba")===
-0?(e=ya(a[1]),k=e.get("rgb"),l=e.get("a")):(k=a[1],l=1);a=d.createElement("stop").attr({offset:a[0],"stop-color":k,"stop-opacity":l}).add(i);i.stops.push(a)}));c.setAttribute(b,"url("+d.url+"#"+a+")")}},attr:function(a,b){var c,d,e=this.element,f,g=this,h;typeof a==="string"&&b!==u&&(c=a,a={},a[c]=b);if(typeof a==="string")g=(this[a+"Getter"]||this._defaultGetter).call(this,a,e);else{for(c in a){d=a[c];h=!1;this.symbolName&&/^(x|y|width|height|r|start|end|innerR|anchorX|anchorY)/.test(c)&&(f||(this.symbolAttr(a),
-f=!0),h=!0);if(this.rotation&&(c==="x"||c==="y"))this.doTransform=!0;h||(this[c+"Setter"]||this._defaultSetter).call(this,d,c,e);this.shadows&&/^(width|height|visibility|x|y|d|transform|cx|cy|r)$/.test(c)&&this.updateShadows(c,d)}if(this.doTransform)this.updateTransform(),this.doTransform=!1}return g},updateShadows:function(a,b){for(var c=this.shadows,d=c.length;d--;)c[d].setAttribute(a,a==="height"?t(b-(c[d].cutHeight||0),0):a==="d"?this.d:b)},addClass:function(a){var b=this.element,c=F(b,"class")||
-"";c.indexOf(a)===-1&&F(b,"class",c+" "+a);return this},symbolAttr:function(a){var b=this;q("x,y,r,start,end,width,height,innerR,anchorX,anchorY".split(","),function(c){b[c]=p(a[c],b[c])});b.attr({d:b.renderer.symbols[b.symbolName](b.x,b.y,b.width,b.height,b)})},clip:function(a){return this.attr("clip-path",a?"url("+this.renderer.url+"#"+a.id+")":P)},crisp:function(a){var b,c={},d,e=a.strokeWidth||this.strokeWidth||0;d=v(e)%2/2;a.x=U(a.x||this.x||0)+d;a.y=U(a.y||this.y||0)+d;a.width=U((a.width||this.width||
-0)-2*d);a.height=U((a.height||this.height||0)-2*d);a.strokeWidth=e;for(b in a)this[b]!==a[b]&&(this[b]=c[b]=a[b]);return c},css:function(a){var b=this.styles,c={},d=this.element,e,f,g="";e=!b;if(a&&a.color)a.fill=a.color;if(b)for(f in a)a[f]!==b[f]&&(c[f]=a[f],e=!0);if(e){e=this.textWidth=a&&a.width&&d.nodeName.toLowerCase()==="text"&&y(a.width);b&&(a=r(b,c));this.styles=a;e&&(ga||!ba&&this.renderer.forExport)&&delete a.width;if(Aa&&!ba)B(this.element,a);else{b=function(a,b){return"-"+b.toLowerCase()};
-for(f in a)g+=f.replace(/([A-Z])/g,b)+":"+a[f]+";";F(d,"style",g)}e&&this.added&&this.renderer.buildText(this)}return this},on:function(a,b){var c=this,d=c.element;$a&&a==="click"?(d.ontouchstart=function(a){c.touchEventFired=Da.now();a.preventDefault();b.call(d,a)},d.onclick=function(a){(wa.indexOf("Android")===-1||Da.now()-(c.touchEventFired||0)>1100)&&b.call(d,a)}):d["on"+a]=b;return this},setRadialReference:function(a){this.element.radialReference=a;return this},translate:function(a,b){return this.attr({translateX:a,
-translateY:b})},invert:function(){this.inverted=!0;this.updateTransform();return this},updateTransform:function(){var a=this.translateX||0,b=this.translateY||0,c=this.scaleX,d=this.scaleY,e=this.inverted,f=this.rotation,g=this.element;e&&(a+=this.attr("width"),b+=this.attr("height"));a=["translate("+a+","+b+")"];e?a.push("rotate(90) scale(-1,1)"):f&&a.push("rotate("+f+" "+(g.getAttribute("x")||0)+" "+(g.getAttribute("y")||0)+")");(s(c)||s(d))&&a.push("scale("+p(c,1)+" "+p(d,1)+")");a.length&&g.setAttribute("transform",
-a.join(" "))},toFront:function(){var a=this.element;a.parentNode.appendChild(a);return this},align:function(a,b,c){var d,e,f,g,h={};e=this.renderer;f=e.alignedObjects;if(a){if(this.alignOptions=a,this.alignByTranslate=b,!c||Ga(c))this.alignTo=d=c||"renderer",la(f,this),f.push(this),c=null}else a=this.alignOptions,b=this.alignByTranslate,d=this.alignTo;c=p(c,e[d],e);d=a.align;e=a.verticalAlign;f=(c.x||0)+(a.x||0);g=(c.y||0)+(a.y||0);if(d==="right"||d==="center")f+=(c.width-(a.width||0))/{right:1,center:2}[d];
-h[b?"translateX":"x"]=v(f);if(e==="bottom"||e==="middle")g+=(c.height-(a.height||0))/({bottom:1,middle:2}[e]||1);h[b?"translateY":"y"]=v(g);this[this.placed?"animate":"attr"](h);this.placed=!0;this.alignAttr=h;return this},getBBox:function(){var a=this.bBox,b=this.renderer,c,d,e=this.rotation;c=this.element;var f=this.styles,g=e*Ea;d=this.textStr;var h;if(d===""||Pb.test(d))h="num."+d.toString().length+(f?"|"+f.fontSize+"|"+f.fontFamily:"");h&&(a=b.cache[h]);if(!a){if(c.namespaceURI===xa||b.forExport){try{a=
-c.getBBox?r({},c.getBBox()):{width:c.offsetWidth,height:c.offsetHeight}}catch(i){}if(!a||a.width<0)a={width:0,height:0}}else a=this.htmlGetBBox();if(b.isSVG){c=a.width;d=a.height;if(Aa&&f&&f.fontSize==="11px"&&d.toPrecision(3)==="16.9")a.height=d=14;if(e)a.width=Q(d*fa(g))+Q(c*aa(g)),a.height=Q(d*aa(g))+Q(c*fa(g))}this.bBox=a;h&&(b.cache[h]=a)}return a},show:function(a){a&&this.element.namespaceURI===xa?this.element.removeAttribute("visibility"):this.attr({visibility:a?"inherit":"visible"});return this},
-hide:function(){return this.attr({visibility:"hidden"})},fadeOut:function(a){var b=this;b.animate({opacity:0},{duration:a||150,complete:function(){b.attr({y:-9999})}})},add:function(a){var b=this.renderer,c=a||b,d=c.element||b.box,e=this.element,f=this.zIndex,g,h;if(a)this.parentGroup=a;this.parentInverted=a&&a.inverted;this.textStr!==void 0&&b.buildText(this);if(f)c.handleZ=!0,f=y(f);if(c.handleZ){a=d.childNodes;for(g=0;g<a.length;g++)if(b=a[g],c=F(b,"zIndex"),b!==e&&(y(c)>f||!s(f)&&s(c))){d.insertBefore(e,
-b);h=!0;break}}h||d.appendChild(e);this.added=!0;if(this.onAdd)this.onAdd();return this},safeRemoveChild:function(a){var b=a.parentNode;b&&b.removeChild(a)},destroy:function(){var a=this,b=a.element||{},c=a.shadows,d=a.renderer.isSVG&&b.nodeName==="SPAN"&&a.parentGroup,e,f;b.onclick=b.onmouseout=b.onmouseover=b.onmousemove=b.point=null;bb(a);if(a.clipPath)a.clipPath=a.clipPath.destroy();if(a.stops){for(f=0;f<a.stops.length;f++)a.stops[f]=a.stops[f].destroy();a.stops=null}a.safeRemoveChild(b);for(c&&
-q(c,function(b){a.safeRemoveChild(b)});d&&d.div&&d.div.childNodes.length===0;)b=d.parentGroup,a.safeRemoveChild(d.div),delete d.div,d=b;a.alignTo&&la(a.renderer.alignedObjects,a);for(e in a)delete a[e];return null},shadow:function(a,b,c){var d=[],e,f,g=this.element,h,i,j,k;if(a){i=p(a.width,3);j=(a.opacity||0.15)/i;k=this.parentInverted?"(-1,-1)":"("+p(a.offsetX,1)+", "+p(a.offsetY,1)+")";for(e=1;e<=i;e++){f=g.cloneNode(0);h=i*2+1-2*e;F(f,{isShadow:"true",stroke:a.color||"black","stroke-opacity":j*
-e,"stroke-width":h,transform:"translate"+k,fill:P});if(c)F(f,"height",t(F(f,"height")-h,0)),f.cutHeight=h;b?b.element.appendChild(f):g.parentNode.insertBefore(f,g);d.push(f)}this.shadows=d}return this},xGetter:function(a){this.element.nodeName==="circle"&&(a={x:"cx",y:"cy"}[a]||a);return this._defaultGetter(a)},_defaultGetter:function(a){a=p(this[a],this.element?this.element.getAttribute(a):null,0);/^[\-0-9\.]+$/.test(a)&&(a=parseFloat(a));return a},dSetter:function(a,b,c){a&&a.join&&(a=a.join(" "));
-/(NaN| {2}|^$)/.test(a)&&(a="M 0 0");c.setAttribute(b,a);this[b]=a},dashstyleSetter:function(a){var b;if(a=a&&a.toLowerCase()){a=a.replace("shortdashdotdot","3,1,1,1,1,1,").replace("shortdashdot","3,1,1,1").replace("shortdot","1,1,").replace("shortdash","3,1,").replace("longdash","8,3,").replace(/dot/g,"1,3,").replace("dash","4,3,").replace(/,$/,"").split(",");for(b=a.length;b--;)a[b]=y(a[b])*this["stroke-width"];a=a.join(",").replace("NaN","none");this.element.setAttribute("stroke-dasharray",a)}},
-alignSetter:function(a){this.element.setAttribute("text-anchor",{left:"start",center:"middle",right:"end"}[a])},opacitySetter:function(a,b,c){this[b]=a;c.setAttribute(b,a)},titleSetter:function(a){var b=this.element.getElementsByTagName("title")[0];b||(b=x.createElementNS(xa,"title"),this.element.appendChild(b));b.textContent=p(a,"").replace(/<[^>]*>/g,"")},textSetter:function(a){if(a!==this.textStr)delete this.bBox,this.textStr=a,this.added&&this.renderer.buildText(this)},fillSetter:function(a,b,
-c){typeof a==="string"?c.setAttribute(b,a):a&&this.colorGradient(a,b,c)},zIndexSetter:function(a,b,c){c.setAttribute(b,a);this[b]=a},_defaultSetter:function(a,b,c){c.setAttribute(b,a)}};S.prototype.yGetter=S.prototype.xGetter;S.prototype.translateXSetter=S.prototype.translateYSetter=S.prototype.rotationSetter=S.prototype.verticalAlignSetter=S.prototype.scaleXSetter=S.prototype.scaleYSetter=function(a,b){this[b]=a;this.doTransform=!0};S.prototype["stroke-widthSetter"]=S.prototype.strokeSetter=function(a,
-b,c){this[b]=a;if(this.stroke&&this["stroke-width"])this.strokeWidth=this["stroke-width"],S.prototype.fillSetter.call(this,this.stroke,"stroke",c),c.setAttribute("stroke-width",this["stroke-width"]),this.hasStroke=!0;else if(b==="stroke-width"&&a===0&&this.hasStroke)c.removeAttribute("stroke"),this.hasStroke=!1};var ta=function(){this.init.apply(this,arguments)};ta.prototype={Element:S,init:function(a,b,c,d,e){var f=location,g,d=this.createElement("svg").attr({version:"1.1"}).css(this.getStyle(d));
-g=d.element;a.appendChild(g);a.innerHTML.indexOf("xmlns")===-1&&F(g,"xmlns",xa);this.isSVG=!0;this.box=g;this.boxWrapper=d;this.alignedObjects=[];this.url=(Ua||tb)&&x.getElementsByTagName("base").length?f.href.replace(/#.*?$/,"").replace(/([\('\)])/g,"\\$)***^***",
-R"***^***(1").replace(/ /g,"%20"):"";this.createElement("desc").add().element.appendChild(x.createTextNode("Created with Highcharts 4.0.4"));this.defs=this.createElement("defs").add();this.forExport=e;this.gradients={};this.cache={};this.setSize(b,c,!1);var h;
-if(Ua&&a.getBoundingClientRect)this.subPixelFix=b=function(){B(a,{left:0,top:0});h=a.getBoundingClientRect();B(a,{left:La(h.left)-h.left+"px",top:La(h.top)-h.top+"px"})},b(),N(G,"resize",b)},getStyle:function(a){return this.style=r({fontFamily:'"Lucida Grande", "Lucida Sans Unicode", Arial, Helvetica, sans-serif',fontSize:"12px"},a)},isHidden:function(){return!this.boxWrapper.getBBox().width},destroy:function(){var a=this.defs;this.box=null;this.boxWrapper=this.boxWrapper.destroy();Pa(this.gradients||
-{});this.gradients=null;if(a)this.defs=a.destroy();this.subPixelFix&&X(G,"resize",this.subPixelFix);return this.alignedObjects=null},createElement:function(a){var b=new this.Element;b.init(this,a);return b},draw:function(){},buildText:function(a){for(var b=a.element,c=this,d=c.forExport,e=p(a.textStr,"").toString(),f=e.indexOf("<")!==-1,g=b.childNodes,h,i,j=F(b,"x"),k=a.styles,l=a.textWidth,n=k&&k.lineHeight,m=k&&k.HcTextStroke,o=g.length,Y=function(a){return n?y(n):c.fontMetrics(/(px|em)$/.test(a&&
-a.style.fontSize)?a.style.fontSize:k&&k.fontSize||c.style.fontSize||12,a).h};o--;)b.removeChild(g[o]);!f&&!m&&e.indexOf(" ")===-1?b.appendChild(x.createTextNode(e)):(h=/<.*style="([^"]+)".*>/,i=/<.*href="(http[^"]+)".*>/,l&&!a.added&&this.box.appendChild(b),e=f?e.replace(/<(b|strong)>/g,'<span style="font-weight:bold">').replace(/<(i|em)>/g,'<span style="font-style:italic">').replace(/<a/g,"<span").replace(/<\/(b|strong|i|em|a)>/g,"</span>").split(/<br.*?>/g):[e],e[e.length-1]===""&&e.pop(),q(e,function(e,
-f){var g,n=0,e=e.replace(/<span/g,"|||<span").replace(/<\/span>/g,"</span>|||");g=e.split("|||");q(g,function(e){if(e!==""||g.length===1){var m={},o=x.createElementNS(xa,"tspan"),p;h.test(e)&&(p=e.match(h)[1].replace(/(;| |^)color([ :])/,"$1fill$2"),F(o,"style",p));i.test(e)&&!d&&(F(o,"onclick",'location.href="'+e.match(i)[1]+'"'),B(o,{cursor:"pointer"}));e=(e.replace(/<(.|\n)*?>/g,"")||" ").replace(/&lt;/g,"<").replace(/&gt;/g,">");if(e!==" "){o.appendChild(x.createTextNode(e));if(n)m.dx=0;else if(f&&
-j!==null)m.x=j;F(o,m);b.appendChild(o);!n&&f&&(!ba&&d&&B(o,{display:"block"}),F(o,"dy",Y(o)));if(l)for(var e=e.replace(/([^\^])-/g,"$1- ").split(" "),m=g.length>1||e.length>1&&k.whiteSpace!=="nowrap",q,D,s=k.HcHeight,t=[],u=Y(o),Lb=1;m&&(e.length||t.length);)delete a.bBox,q=a.getBBox(),D=q.width,!ba&&c.forExport&&(D=c.measureSpanWidth(o.firstChild.data,a.styles)),q=D>l,!q||e.length===1?(e=t,t=[],e.length&&(Lb++,s&&Lb*u>s?(e=["..."],a.attr("title",a.textStr)):(o=x.createElementNS(xa,"tspan"),F(o,{dy:u,
-x:j}),p&&F(o,"style",p),b.appendChild(o))),D>l&&(l=D)):(o.removeChild(o.firstChild),t.unshift(e.pop())),e.length&&o.appendChild(x.createTextNode(e.join(" ").replace(/- /g,"-")));n++}}})}))},button:function(a,b,c,d,e,f,g,h,i){var j=this.label(a,b,c,i,null,null,null,null,"button"),k=0,l,n,m,o,p,q,a={x1:0,y1:0,x2:0,y2:1},e=w({"stroke-width":1,stroke:"#CCCCCC",fill:{linearGradient:a,stops:[[0,"#FEFEFE"],[1,"#F6F6F6"]]},r:2,padding:5,style:{color:"black"}},e);m=e.style;delete e.style;f=w(e,{stroke:"#68A",
-fill:{linearGradient:a,stops:[[0,"#FFF"],[1,"#ACF"]]}},f);o=f.style;delete f.style;g=w(e,{stroke:"#68A",fill:{linearGradient:a,stops:[[0,"#9BD"],[1,"#CDF"]]}},g);p=g.style;delete g.style;h=w(e,{style:{color:"#CCC"}},h);q=h.style;delete h.style;N(j.element,Aa?"mouseover":"mouseenter",function(){k!==3&&j.attr(f).css(o)});N(j.element,Aa?"mouseout":"mouseleave",function(){k!==3&&(l=[e,f,g][k],n=[m,o,p][k],j.attr(l).css(n))});j.setState=function(a){(j.state=k=a)?a===2?j.attr(g).css(p):a===3&&j.attr(h).css(q):
-j.attr(e).css(m)};return j.on("click",function(){k!==3&&d.call(j)}).attr(e).css(r({cursor:"default"},m))},crispLine:function(a,b){a[1]===a[4]&&(a[1]=a[4]=v(a[1])-b%2/2);a[2]===a[5]&&(a[2]=a[5]=v(a[2])+b%2/2);return a},path:function(a){var b={fill:P};Ha(a)?b.d=a:da(a)&&r(b,a);return this.createElement("path").attr(b)},circle:function(a,b,c){a=da(a)?a:{x:a,y:b,r:c};b=this.createElement("circle");b.xSetter=function(a){this.element.setAttribute("cx",a)};b.ySetter=function(a){this.element.setAttribute("cy",
-a)};return b.attr(a)},arc:function(a,b,c,d,e,f){if(da(a))b=a.y,c=a.r,d=a.innerR,e=a.start,f=a.end,a=a.x;a=this.symbol("arc",a||0,b||0,c||0,c||0,{innerR:d||0,start:e||0,end:f||0});a.r=c;return a},rect:function(a,b,c,d,e,f){var e=da(a)?a.r:e,g=this.createElement("rect"),a=da(a)?a:a===u?{}:{x:a,y:b,width:t(c,0),height:t(d,0)};if(f!==u)a.strokeWidth=f,a=g.crisp(a);if(e)a.r=e;g.rSetter=function(a){F(this.element,{rx:a,ry:a})};return g.attr(a)},setSize:function(a,b,c){var d=this.alignedObjects,e=d.length;
-this.width=a;this.height=b;for(this.boxWrapper[p(c,!0)?"animate":"attr"]({width:a,height:b});e--;)d[e].align()},g:function(a){var b=this.createElement("g");return s(a)?b.attr({"class":"highcharts-"+a}):b},image:function(a,b,c,d,e){var f={preserveAspectRatio:P};arguments.length>1&&r(f,{x:b,y:c,width:d,height:e});f=this.createElement("image").attr(f);f.element.setAttributeNS?f.element.setAttributeNS("http://www.w3.org/1999/xlink","href",a):f.element.setAttribute("hc-svg-href",a);return f},symbol:function(a,
-b,c,d,e,f){var g,h=this.symbols[a],h=h&&h(v(b),v(c),d,e,f),i=/^url\((.*?)\)$/,j,k;if(h)g=this.path(h),r(g,{symbolName:a,x:b,y:c,width:d,height:e}),f&&r(g,f);else if(i.test(a))k=function(a,b){a.element&&(a.attr({width:b[0],height:b[1]}),a.alignByTranslate||a.translate(v((d-b[0])/2),v((e-b[1])/2)))},j=a.match(i)[1],a=Jb[j]||f&&f.width&&f.height&&[f.width,f.height],g=this.image(j).attr({x:b,y:c}),g.isImg=!0,a?k(g,a):(g.attr({width:0,height:0}),$("img",{onload:function(){k(g,Jb[j]=[this.width,this.height])},
-src:j}));return g},symbols:{circle:function(a,b,c,d){var e=0.166*c;return["M",a+c/2,b,"C",a+c+e,b,a+c+e,b+d,a+c/2,b+d,"C",a-e,b+d,a-e,b,a+c/2,b,"Z"]},square:function(a,b,c,d){return["M",a,b,"L",a+c,b,a+c,b+d,a,b+d,"Z"]},triangle:function(a,b,c,d){return["M",a+c/2,b,"L",a+c,b+d,a,b+d,"Z"]},"triangle-down":function(a,b,c,d){return["M",a,b,"L",a+c,b,a+c/2,b+d,"Z"]},diamond:function(a,b,c,d){return["M",a+c/2,b,"L",a+c,b+d/2,a+c/2,b+d,a,b+d/2,"Z"]},arc:function(a,b,c,d,e){var f=e.start,c=e.r||c||d,g=e.end-
-0.001,d=e.innerR,h=e.open,i=aa(f),j=fa(f),k=aa(g),g=fa(g),e=e.end-f<oa?0:1;return["M",a+c*i,b+c*j,"A",c,c,0,e,1,a+c*k,b+c*g,h?"M":"L",a+d*k,b+d*g,"A",d,d,0,e,0,a+d*i,b+d*j,h?"":"Z"]},callout:function(a,b,c,d,e){var f=L(e&&e.r||0,c,d),g=f+6,h=e&&e.anchorX,i=e&&e.anchorY,e=v(e.strokeWidth||0)%2/2;a+=e;b+=e;e=["M",a+f,b,"L",a+c-f,b,"C",a+c,b,a+c,b,a+c,b+f,"L",a+c,b+d-f,"C",a+c,b+d,a+c,b+d,a+c-f,b+d,"L",a+f,b+d,"C",a,b+d,a,b+d,a,b+d-f,"L",a,b+f,"C",a,b,a,b,a+f,b];h&&h>c&&i>b+g&&i<b+d-g?e.splice(13,3,
-"L",a+c,i-6,a+c+6,i,a+c,i+6,a+c,b+d-f):h&&h<0&&i>b+g&&i<b+d-g?e.splice(33,3,"L",a,i+6,a-6,i,a,i-6,a,b+f):i&&i>d&&h>a+g&&h<a+c-g?e.splice(23,3,"L",h+6,b+d,h,b+d+6,h-6,b+d,a+f,b+d):i&&i<0&&h>a+g&&h<a+c-g&&e.splice(3,3,"L",h-6,b,h,b-6,h+6,b,c-f,b);return e}},clipRect:function(a,b,c,d){var e="highcharts-"+ub++,f=this.createElement("clipPath").attr({id:e}).add(this.defs),a=this.rect(a,b,c,d,0).add(f);a.id=e;a.clipPath=f;return a},text:function(a,b,c,d){var e=ga||!ba&&this.forExport,f={};if(d&&!this.forExport)return this.html(a,
-b,c);f.x=Math.round(b||0);if(c)f.y=Math.round(c);if(a||a===0)f.text=a;a=this.createElement("text").attr(f);e&&a.css({position:"absolute"});if(!d)a.xSetter=function(a,b,c){var d=c.getElementsByTagName("tspan"),e,f=c.getAttribute(b),n;for(n=0;n<d.length;n++)e=d[n],e.getAttribute(b)===f&&e.setAttribute(b,a);c.setAttribute(b,a)};return a},fontMetrics:function(a,b){a=a||this.style.fontSize;if(b&&G.getComputedStyle)b=b.element||b,a=G.getComputedStyle(b,"").fontSize;var a=/px/.test(a)?y(a):/em/.test(a)?
-parseFloat(a)*12:12,c=a<24?a+4:v(a*1.2),d=v(c*0.8);return{h:c,b:d,f:a}},label:function(a,b,c,d,e,f,g,h,i){function j(){var a,b;a=o.element.style;D=(t===void 0||xb===void 0||m.styles.textAlign)&&o.textStr&&o.getBBox();m.width=(t||D.width||0)+2*C+kb;m.height=(xb||D.height||0)+2*C;R=C+n.fontMetrics(a&&a.fontSize,o).b;if(y){if(!p)a=v(-J*C),b=h?-R:0,m.box=p=d?n.symbol(d,a,b,m.width,m.height,z):n.rect(a,b,m.width,m.height,0,z[Qb]),p.attr("fill",P).add(m);p.isImg||p.attr(r({width:v(m.width),height:v(m.height)},
-z));z=null}}function k(){var a=m.styles,a=a&&a.textAlign,b=kb+C*(1-J),c;c=h?0:R;if(s(t)&&D&&(a==="center"||a==="right"))b+={center:0.5,right:1}[a]*(t-D.width);if(b!==o.x||c!==o.y)o.attr("x",b),c!==u&&o.attr("y",c);o.x=b;o.y=c}function l(a,b){p?p.attr(a,b):z[a]=b}var n=this,m=n.g(i),o=n.text("",0,0,g).attr({zIndex:1}),p,D,J=0,C=3,kb=0,t,xb,yb,x,Kb=0,z={},R,y;m.onAdd=function(){o.add(m);m.attr({text:a||a===0?a:"",x:b,y:c});p&&s(e)&&m.attr({anchorX:e,anchorY:f})};m.widthSetter=function(a){t=a};m.heightSetter=
-function(a){xb=a};m.paddingSetter=function(a){s(a)&&a!==C&&(C=a,k())};m.paddingLeftSetter=function(a){s(a)&&a!==kb&&(kb=a,k())};m.alignSetter=function(a){J={left:0,center:0.5,right:1}[a]};m.textSetter=function(a){a!==u&&o.textSetter(a);j();k()};m["stroke-widthSetter"]=function(a,b){a&&(y=!0);Kb=a%2/2;l(b,a)};m.strokeSetter=m.fillSetter=m.rSetter=function(a,b){b==="fill"&&a&&(y=!0);l(b,a)};m.anchorXSetter=function(a,b){e=a;l(b,a+Kb-yb)};m.anchorYSetter=function(a,b){f=a;l(b,a-x)};m.xSetter=function(a){m.x=
-a;J&&(a-=J*((t||D.width)+C));yb=v(a);m.attr("translateX",yb)};m.ySetter=function(a){x=m.y=v(a);m.attr("translateY",x)};var A=m.css;return r(m,{css:function(a){if(a){var b={},a=w(a);q(m.textProps,function(c){a[c]!==u&&(b[c]=a[c],delete a[c])});o.css(b)}return A.call(m,a)},getBBox:function(){return{width:D.width+2*C,height:D.height+2*C,x:D.x-C,y:D.y-C}},shadow:function(a){p&&p.shadow(a);return m},destroy:function(){X(m.element,"mouseenter");X(m.element,"mouseleave");o&&(o=o.destroy());p&&(p=p.destroy());
-S.prototype.destroy.call(m);m=n=j=k=l=null}})}};Za=ta;r(S.prototype,{htmlCss:fu)***^***",
-R"***^***(nction(a){var b=this.element;if(b=a&&b.tagName==="SPAN"&&a.width)delete a.width,this.textWidth=b,this.updateTransform();this.styles=r(this.styles,a);B(this.element,a);return this},htmlGetBBox:function(){var a=this.element,b=this.bBox;if(!b){if(a.nodeName==="text")a.style.position="absolute";b=this.bBox={x:a.offsetLeft,y:a.offsetTop,width:a.offsetWidth,height:a.offsetHeight}}return b},htmlUpdateTransform:function(){if(this.added){var a=
-this.renderer,b=this.element,c=this.translateX||0,d=this.translateY||0,e=this.x||0,f=this.y||0,g=this.textAlign||"left",h={left:0,center:0.5,right:1}[g],i=this.shadows;B(b,{marginLeft:c,marginTop:d});i&&q(i,function(a){B(a,{marginLeft:c+1,marginTop:d+1})});this.inverted&&q(b.childNodes,function(c){a.invertChild(c,b)});if(b.tagName==="SPAN"){var j=this.rotation,k,l=y(this.textWidth),n=[j,g,b.innerHTML,this.textWidth].join(",");if(n!==this.cTT){k=a.fontMetrics(b.style.fontSize).b;s(j)&&this.setSpanRotation(j,
-h,k);i=p(this.elemWidth,b.offsetWidth);if(i>l&&/[ \-]/.test(b.textContent||b.innerText))B(b,{width:l+"px",display:"block",whiteSpace:"normal"}),i=l;this.getSpanCorrection(i,k,h,j,g)}B(b,{left:e+(this.xCorr||0)+"px",top:f+(this.yCorr||0)+"px"});if(tb)k=b.offsetHeight;this.cTT=n}}else this.alignOnAdd=!0},setSpanRotation:function(a,b,c){var d={},e=Aa?"-ms-transform":tb?"-webkit-transform":Ua?"MozTransform":Hb?"-o-transform":"";d[e]=d.transform="rotate("+a+"deg)";d[e+(Ua?"Origin":"-origin")]=d.transformOrigin=
-b*100+"% "+c+"px";B(this.element,d)},getSpanCorrection:function(a,b,c){this.xCorr=-a*c;this.yCorr=-b}});r(ta.prototype,{html:function(a,b,c){var d=this.createElement("span"),e=d.element,f=d.renderer;d.textSetter=function(a){a!==e.innerHTML&&delete this.bBox;e.innerHTML=this.textStr=a};d.xSetter=d.ySetter=d.alignSetter=d.rotationSetter=function(a,b){b==="align"&&(b="textAlign");d[b]=a;d.htmlUpdateTransform()};d.attr({text:a,x:v(b),y:v(c)}).css({position:"absolute",whiteSpace:"nowrap",fontFamily:this.style.fontFamily,
-fontSize:this.style.fontSize});d.css=d.htmlCss;if(f.isSVG)d.add=function(a){var b,c=f.box.parentNode,j=[];if(this.parentGroup=a){if(b=a.div,!b){for(;a;)j.push(a),a=a.parentGroup;q(j.reverse(),function(a){var d;b=a.div=a.div||$(Ka,{className:F(a.element,"class")},{position:"absolute",left:(a.translateX||0)+"px",top:(a.translateY||0)+"px"},b||c);d=b.style;r(a,{translateXSetter:function(b,c){d.left=b+"px";a[c]=b;a.doTransform=!0},translateYSetter:function(b,c){d.top=b+"px";a[c]=b;a.doTransform=!0},visibilitySetter:function(a,
-b){d[b]=a}})})}}else b=c;b.appendChild(e);d.added=!0;d.alignOnAdd&&d.htmlUpdateTransform();return d};return d}});var Z;if(!ba&&!ga){Z={init:function(a,b){var c=["<",b,' filled="f" stroked="f"'],d=["position: ","absolute",";"],e=b===Ka;(b==="shape"||e)&&d.push("left:0;top:0;width:1px;height:1px;");d.push("visibility: ",e?"hidden":"visible");c.push(' style="',d.join(""),'"/>');if(b)c=e||b==="span"||b==="img"?c.join(""):a.prepVML(c),this.element=$(c);this.renderer=a},add:function(a){var b=this.renderer,
-c=this.element,d=b.box,d=a?a.element||a:d;a&&a.inverted&&b.invertChild(c,d);d.appendChild(c);this.added=!0;this.alignOnAdd&&!this.deferUpdateTransform&&this.updateTransform();if(this.onAdd)this.onAdd();return this},updateTransform:S.prototype.htmlUpdateTransform,setSpanRotation:function(){var a=this.rotation,b=aa(a*Ea),c=fa(a*Ea);B(this.element,{filter:a?["progid:DXImageTransform.Microsoft.Matrix(M11=",b,", M12=",-c,", M21=",c,", M22=",b,", sizingMethod='auto expand')"].join(""):P})},getSpanCorrection:function(a,
-b,c,d,e){var f=d?aa(d*Ea):1,g=d?fa(d*Ea):0,h=p(this.elemHeight,this.element.offsetHeight),i;this.xCorr=f<0&&-a;this.yCorr=g<0&&-h;i=f*g<0;this.xCorr+=g*b*(i?1-c:c);this.yCorr-=f*b*(d?i?c:1-c:1);e&&e!=="left"&&(this.xCorr-=a*c*(f<0?-1:1),d&&(this.yCorr-=h*c*(g<0?-1:1)),B(this.element,{textAlign:e}))},pathToVML:function(a){for(var b=a.length,c=[];b--;)if(ja(a[b]))c[b]=v(a[b]*10)-5;else if(a[b]==="Z")c[b]="x";else if(c[b]=a[b],a.isArc&&(a[b]==="wa"||a[b]==="at"))c[b+5]===c[b+7]&&(c[b+7]+=a[b+7]>a[b+
-5]?1:-1),c[b+6]===c[b+8]&&(c[b+8]+=a[b+8]>a[b+6]?1:-1);return c.join(" ")||"x"},clip:function(a){var b=this,c;a?(c=a.members,la(c,b),c.push(b),b.destroyClip=function(){la(c,b)},a=a.getCSS(b)):(b.destroyClip&&b.destroyClip(),a={clip:hb?"inherit":"rect(auto)"});return b.css(a)},css:S.prototype.htmlCss,safeRemoveChild:function(a){a.parentNode&&Qa(a)},destroy:function(){this.destroyClip&&this.destroyClip();return S.prototype.destroy.apply(this)},on:function(a,b){this.element["on"+a]=function(){var a=
-G.event;a.target=a.srcElement;b(a)};return this},cutOffPath:function(a,b){var c,a=a.split(/[ ,]/);c=a.length;if(c===9||c===11)a[c-4]=a[c-2]=y(a[c-2])-10*b;return a.join(" ")},shadow:function(a,b,c){var d=[],e,f=this.element,g=this.renderer,h,i=f.style,j,k=f.path,l,n,m,o;k&&typeof k.value!=="string"&&(k="x");n=k;if(a){m=p(a.width,3);o=(a.opacity||0.15)/m;for(e=1;e<=3;e++){l=m*2+1-2*e;c&&(n=this.cutOffPath(k.value,l+0.5));j=['<shape isShadow="true" strokeweight="',l,'" filled="false" path="',n,'" coordsize="10 10" style="',
-f.style.cssText,'" />'];h=$(g.prepVML(j),null,{left:y(i.left)+p(a.offsetX,1),top:y(i.top)+p(a.offsetY,1)});if(c)h.cutOff=l+1;j=['<stroke color="',a.color||"black",'" opacity="',o*e,'"/>'];$(g.prepVML(j),null,null,h);b?b.element.appendChild(h):f.parentNode.insertBefore(h,f);d.push(h)}this.shadows=d}return this},updateShadows:sa,setAttr:function(a,b){hb?this.element[a]=b:this.element.setAttribute(a,b)},classSetter:function(a){this.element.className=a},dashstyleSetter:function(a,b,c){(c.getElementsByTagName("stroke")[0]||
-$(this.renderer.prepVML(["<stroke/>"]),null,null,c))[b]=a||"solid";this[b]=a},dSetter:function(a,b,c){var d=this.shadows,a=a||[];this.d=a.join&&a.join(" ");c.path=a=this.pathToVML(a);if(d)for(c=d.length;c--;)d[c].path=d[c].cutOff?this.cutOffPath(a,d[c].cutOff):a;this.setAttr(b,a)},fillSetter:function(a,b,c){var d=c.nodeName;if(d==="SPAN")c.style.color=a;else if(d!=="IMG")c.filled=a!==P,this.setAttr("fillcolor",this.renderer.color(a,c,b,this))},opacitySetter:sa,rotationSetter:function(a,b,c){c=c.style;
-this[b]=c[b]=a;c.left=-v(fa(a*Ea)+1)+"px";c.top=v(aa(a*Ea))+"px"},strokeSetter:function(a,b,c){this.setAttr("strokecolor",this.renderer.color(a,c,b))},"stroke-widthSetter":function(a,b,c){c.stroked=!!a;this[b]=a;ja(a)&&(a+="px");this.setAttr("strokeweight",a)},titleSetter:function(a,b){this.setAttr(b,a)},visibilitySetter:function(a,b,c){a==="inherit"&&(a="visible");this.shadows&&q(this.shadows,function(c){c.style[b]=a});c.nodeName==="DIV"&&(a=a==="hidden"?"-999em":0,hb||(c.style[b]=a?"visible":"hidden"),
-b="top");c.style[b]=a},xSetter:function(a,b,c){this[b]=a;b==="x"?b="left":b==="y"&&(b="top");this.updateClipping?(this[b]=a,this.updateClipping()):c.style[b]=a},zIndexSetter:function(a,b,c){c.style[b]=a}};K.VMLElement=Z=ma(S,Z);Z.prototype.ySetter=Z.prototype.widthSetter=Z.prototype.heightSetter=Z.prototype.xSetter;var ia={Element:Z,isIE8:wa.indexOf("MSIE 8.0")>-1,init:function(a,b,c,d){var e;this.alignedObjects=[];d=this.createElement(Ka).css(r(this.getStyle(d),{position:"relative"}));e=d.element;
-a.appendChild(d.element);this.isVML=!0;this.box=e;this.boxWrapper=d;this.cache={};this.setSize(b,c,!1);if(!x.namespaces.hcv){x.namespaces.add("hcv","urn:schemas-microsoft-com:vml");try{x.createStyleSheet().cssText="hcv\\:fill, hcv\\:path, hcv\\:shape, hcv\\:stroke{ behavior:url(#default#VML); display: inline-block; } "}catch(f){x.styleSheets[0].cssText+="hcv\\:fill, hcv\\:path, hcv\\:shape, hcv\\:stroke{ behavior:url(#default#VML); display: inline-block; } "}}},isHidden:function(){return!this.box.offsetWidth},
-clipRect:function(a,b,c,d){var e=this.createElement(),f=da(a);return r(e,{members:[],left:(f?a.x:a)+1,top:(f?a.y:b)+1,width:(f?a.width:c)-1,height:(f?a.height:d)-1,getCSS:function(a){var b=a.element,c=b.nodeName,a=a.inverted,d=this.top-(c==="shape"?b.offsetTop:0),e=this.left,b=e+this.width,f=d+this.height,d={clip:"rect("+v(a?e:d)+"px,"+v(a?f:b)+"px,"+v(a?b:f)+"px,"+v(a?d:e)+"px)"};!a&&hb&&c==="DIV"&&r(d,{width:b+"px",height:f+"px"});return d},updateClipping:function(){q(e.members,function(a){a.element&&
-a.css(e.getCSS(a))})}})},color:function(a,b,c,d){var e=this,f,g=/^rgba/,h,i,j=P;a&&a.linearGradient?i="gradient":a&&a.radialGradient&&(i="pattern");if(i){var k,l,n=a.linearGradient||a.radialGradient,m,o,p,D,J,C="",a=a.stops,t,s=[],u=function(){h=['<fill colors="'+s.join(",")+'" opacity="',p,'" o:opacity2="',o,'" type="',i,'" ',C,'focus="100%" method="any" />'];$(e.prepVML(h),null,null,b)};m=a[0];t=a[a.length-1];m[0]>0&&a.unshift([0,m[1]]);t[0]<1&&a.push([1,t[1]]);q(a,function(a,b){g.test(a[1])?(f=
-ya(a[1]),k=f.get("rgb"),l=f.get("a")):(k=a[1],l=1);s.push(a[0]*100+"% "+k);b?(p=l,D=k):(o=l,J=k)});if(c==="fill")if(i==="gradient")c=n.x1||n[0]||0,a=n.y1||n[1]||0,m=n.x2||n[2]||0,n=n.y2||n[3]||0,C='angle="'+(90-V.atan((n-a)/(m-c))*180/oa)+'"',u();else{var j=n.r,r=j*2,v=j*2,x=n.cx,z=n.cy,R=b.radialReference,w,j=function(){R&&(w=d.getBBox(),x+=(R[0]-w.x)/w.width-0.5,z+=(R[1]-w.y)/w.height-0.5,r*=R[2]/w.width,v*=R[2]/w.height);C='src="'+E.global.VMLRadialGradientURL+'" size="'+r+","+v+'" origin="0.5,0.5" position="'+
-x+","+z+'" color2="'+J+'" ';u()};d.added?j():d.onAdd=j;j=D}else j=k}else if(g.test(a)&&b.tagName!=="IMG")f=ya(a),h=["<",c,' opacity="',f.get("a"),'"/>'],$(this.prepVML(h),null,null,b),j=f.get("rgb");else{j=b.getElementsByTagName(c);if(j.length)j[0].opacity=1,j[0].type="solid";j=a}return j},prepVML:function(a){var b=this.isIE8,a=a.join("");b?(a=a.replace("/>",' xmlns="urn:schemas-microsoft-com:vml" />'),a=a.indexOf('style="')===-1?a.replace("/>",' style="display:inline-block;behavior:url(#default#VML);" />'):
-a.replace('style="','style="display:inline-block;behavior:url(#default#VML);')):a=a.replace("<","<hcv:");return a},text:ta.prototype.html,path:function(a){var b={coordsize:"10 10"};Ha(a)?b.d=a:da(a)&&r(b,a);return this.createElement("shape").attr(b)},circle:function(a,b,c){var d=this.symbol("circle");if(da(a))c=a.r,b=)***^***",
-R"***^***(a.y,a=a.x;d.isCircle=!0;d.r=c;return d.attr({x:a,y:b})},g:function(a){var b;a&&(b={className:"highcharts-"+a,"class":"highcharts-"+a});return this.createElement(Ka).attr(b)},image:function(a,
-b,c,d,e){var f=this.createElement("img").attr({src:a});arguments.length>1&&f.attr({x:b,y:c,width:d,height:e});return f},createElement:function(a){return a==="rect"?this.symbol(a):ta.prototype.createElement.call(this,a)},invertChild:function(a,b){var c=this,d=b.style,e=a.tagName==="IMG"&&a.style;B(a,{flip:"x",left:y(d.width)-(e?y(e.top):1),top:y(d.height)-(e?y(e.left):1),rotation:-90});q(a.childNodes,function(b){c.invertChild(b,a)})},symbols:{arc:function(a,b,c,d,e){var f=e.start,g=e.end,h=e.r||c||
-d,c=e.innerR,d=aa(f),i=fa(f),j=aa(g),k=fa(g);if(g-f===0)return["x"];f=["wa",a-h,b-h,a+h,b+h,a+h*d,b+h*i,a+h*j,b+h*k];e.open&&!c&&f.push("e","M",a,b);f.push("at",a-c,b-c,a+c,b+c,a+c*j,b+c*k,a+c*d,b+c*i,"x","e");f.isArc=!0;return f},circle:function(a,b,c,d,e){e&&(c=d=2*e.r);e&&e.isCircle&&(a-=c/2,b-=d/2);return["wa",a,b,a+c,b+d,a+c,b+d/2,a+c,b+d/2,"e"]},rect:function(a,b,c,d,e){return ta.prototype.symbols[!s(e)||!e.r?"square":"callout"].call(0,a,b,c,d,e)}}};K.VMLRenderer=Z=function(){this.init.apply(this,
-arguments)};Z.prototype=w(ta.prototype,ia);Za=Z}ta.prototype.measureSpanWidth=function(a,b){var c=x.createElement("span"),d;d=x.createTextNode(a);c.appendChild(d);B(c,b);this.box.appendChild(c);d=c.offsetWidth;Qa(c);return d};var Mb;if(ga)K.CanVGRenderer=Z=function(){xa="http://www.w3.org/1999/xhtml"},Z.prototype.symbols={},Mb=function(){function a(){var a=b.length,d;for(d=0;d<a;d++)b[d]();b=[]}var b=[];return{push:function(c,d){b.length===0&&Rb(d,a);b.push(c)}}}(),Za=Z;Ta.prototype={addLabel:function(){var a=
-this.axis,b=a.options,c=a.chart,d=a.horiz,e=a.categories,f=a.names,g=this.pos,h=b.labels,i=h.rotation,j=a.tickPositions,d=d&&e&&!h.step&&!h.staggerLines&&!h.rotation&&c.plotWidth/j.length||!d&&(c.margin[3]||c.chartWidth*0.33),k=g===j[0],l=g===j[j.length-1],n,f=e?p(e[g],f[g],g):g,e=this.label,m=j.info;a.isDatetimeAxis&&m&&(n=b.dateTimeLabelFormats[m.higherRanks[g]||m.unitName]);this.isFirst=k;this.isLast=l;b=a.labelFormatter.call({axis:a,chart:c,isFirst:k,isLast:l,dateTimeLabelFormat:n,value:a.isLog?
-ea(ka(f)):f});g=d&&{width:t(1,v(d-2*(h.padding||10)))+"px"};if(s(e))e&&e.attr({text:b}).css(g);else{n={align:a.labelAlign};if(ja(i))n.rotation=i;if(d&&h.ellipsis)g.HcHeight=a.len/j.length;this.label=e=s(b)&&h.enabled?c.renderer.text(b,0,0,h.useHTML).attr(n).css(r(g,h.style)).add(a.labelGroup):null;a.tickBaseline=c.renderer.fontMetrics(h.style.fontSize,e).b;i&&a.side===2&&(a.tickBaseline*=aa(i*Ea))}this.yOffset=e?p(h.y,a.tickBaseline+(a.side===2?8:-(e.getBBox().height/2))):0},getLabelSize:function(){var a=
-this.label,b=this.axis;return a?a.getBBox()[b.horiz?"height":"width"]:0},getLabelSides:function(){var a=this.label.getBBox(),b=this.axis,c=b.horiz,d=b.options.labels,a=c?a.width:a.height,b=c?d.x-a*{left:0,center:0.5,right:1}[b.labelAlign]:0;return[b,c?a+b:a]},handleOverflow:function(a,b){var c=!0,d=this.axis,e=this.isFirst,f=this.isLast,g=d.horiz?b.x:b.y,h=d.reversed,i=d.tickPositions,j=this.getLabelSides(),k=j[0],j=j[1],l,n,m,o=this.label.line;l=o||0;n=d.labelEdge;m=d.justifyLabels&&(e||f);n[l]===
-u||g+k>n[l]?n[l]=g+j:m||(c=!1);if(m){l=(n=d.justifyToPlot)?d.pos:0;n=n?l+d.len:d.chart.chartWidth;do a+=e?1:-1,m=d.ticks[i[a]];while(i[a]&&(!m||!m.label||m.label.line!==o));d=m&&m.label.xy&&m.label.xy.x+m.getLabelSides()[e?0:1];e&&!h||f&&h?g+k<l&&(g=l-k,m&&g+j>d&&(c=!1)):g+j>n&&(g=n-j,m&&g+k<d&&(c=!1));b.x=g}return c},getPosition:function(a,b,c,d){var e=this.axis,f=e.chart,g=d&&f.oldChartHeight||f.chartHeight;return{x:a?e.translate(b+c,null,null,d)+e.transB:e.left+e.offset+(e.opposite?(d&&f.oldChartWidth||
-f.chartWidth)-e.right-e.left:0),y:a?g-e.bottom+e.offset-(e.opposite?e.height:0):g-e.translate(b+c,null,null,d)-e.transB}},getLabelPosition:function(a,b,c,d,e,f,g,h){var i=this.axis,j=i.transA,k=i.reversed,l=i.staggerLines,a=a+e.x-(f&&d?f*j*(k?-1:1):0),b=b+this.yOffset-(f&&!d?f*j*(k?1:-1):0);if(l)c.line=g/(h||1)%l,b+=c.line*(i.labelOffset/l);return{x:a,y:b}},getMarkPath:function(a,b,c,d,e,f){return f.crispLine(["M",a,b,"L",a+(e?0:-c),b+(e?c:0)],d)},render:function(a,b,c){var d=this.axis,e=d.options,
-f=d.chart.renderer,g=d.horiz,h=this.type,i=this.label,j=this.pos,k=e.labels,l=this.gridLine,n=h?h+"Grid":"grid",m=h?h+"Tick":"tick",o=e[n+"LineWidth"],q=e[n+"LineColor"],D=e[n+"LineDashStyle"],J=e[m+"Length"],n=e[m+"Width"]||0,C=e[m+"Color"],t=e[m+"Position"],m=this.mark,s=k.step,r=!0,v=d.tickmarkOffset,w=this.getPosition(g,j,v,b),x=w.x,w=w.y,z=g&&x===d.pos+d.len||!g&&w===d.pos?-1:1,c=p(c,1);this.isActive=!0;if(o){j=d.getPlotLinePath(j+v,o*z,b,!0);if(l===u){l={stroke:q,"stroke-width":o};if(D)l.dashstyle=
-D;if(!h)l.zIndex=1;if(b)l.opacity=0;this.gridLine=l=o?f.path(j).attr(l).add(d.gridGroup):null}if(!b&&l&&j)l[this.isNew?"attr":"animate"]({d:j,opacity:c})}if(n&&J)t==="inside"&&(J=-J),d.opposite&&(J=-J),h=this.getMarkPath(x,w,J,n*z,g,f),m?m.animate({d:h,opacity:c}):this.mark=f.path(h).attr({stroke:C,"stroke-width":n,opacity:c}).add(d.axisGroup);if(i&&!isNaN(x))i.xy=w=this.getLabelPosition(x,w,i,g,k,v,a,s),this.isFirst&&!this.isLast&&!p(e.showFirstLabel,1)||this.isLast&&!this.isFirst&&!p(e.showLastLabel,
-1)?r=!1:!d.isRadial&&!k.step&&!k.rotation&&!b&&c!==0&&(r=this.handleOverflow(a,w)),s&&a%s&&(r=!1),r&&!isNaN(w.y)?(w.opacity=c,i[this.isNew?"attr":"animate"](w),this.isNew=!1):i.attr("y",-9999)},destroy:function(){Pa(this,this.axis)}};K.PlotLineOrBand=function(a,b){this.axis=a;if(b)this.options=b,this.id=b.id};K.PlotLineOrBand.prototype={render:function(){var a=this,b=a.axis,c=b.horiz,d=(b.pointRange||0)/2,e=a.options,f=e.label,g=a.label,h=e.width,i=e.to,j=e.from,k=s(j)&&s(i),l=e.value,n=e.dashStyle,
-m=a.svgElem,o=[],p,q=e.color,J=e.zIndex,C=e.events,r={},u=b.chart.renderer;b.isLog&&(j=za(j),i=za(i),l=za(l));if(h){if(o=b.getPlotLinePath(l,h),r={stroke:q,"stroke-width":h},n)r.dashstyle=n}else if(k){j=t(j,b.min-d);i=L(i,b.max+d);o=b.getPlotBandPath(j,i,e);if(q)r.fill=q;if(e.borderWidth)r.stroke=e.borderColor,r["stroke-width"]=e.borderWidth}else return;if(s(J))r.zIndex=J;if(m)if(o)m.animate({d:o},null,m.onGetPath);else{if(m.hide(),m.onGetPath=function(){m.show()},g)a.label=g=g.destroy()}else if(o&&
-o.length&&(a.svgElem=m=u.path(o).attr(r).add(),C))for(p in d=function(b){m.on(b,function(c){C[b].apply(a,[c])})},C)d(p);if(f&&s(f.text)&&o&&o.length&&b.width>0&&b.height>0){f=w({align:c&&k&&"center",x:c?!k&&4:10,verticalAlign:!c&&k&&"middle",y:c?k?16:10:k?6:-4,rotation:c&&!k&&90},f);if(!g){r={align:f.textAlign||f.align,rotation:f.rotation};if(s(J))r.zIndex=J;a.label=g=u.text(f.text,0,0,f.useHTML).attr(r).css(f.style).add()}b=[o[1],o[4],k?o[6]:o[1]];k=[o[2],o[5],k?o[7]:o[2]];o=Oa(b);c=Oa(k);g.align(f,
-!1,{x:o,y:c,width:Ca(b)-o,height:Ca(k)-c});g.show()}else g&&g.hide();return a},destroy:function(){la(this.axis.plotLinesAndBands,this);delete this.axis;Pa(this)}};na.prototype={defaultOptions:{dateTimeLabelFormats:{millisecond:"%H:%M:%S.%L",second:"%H:%M:%S",minute:"%H:%M",hour:"%H:%M",day:"%e. %b",week:"%e. %b",month:"%b '%y",year:"%Y"},endOnTick:!1,gridLineColor:"#C0C0C0",labels:M,lineColor:"#C0D0E0",lineWidth:1,minPadding:0.01,maxPadding:0.01,minorGridLineColor:"#E0E0E0",minorGridLineWidth:1,minorTickColor:"#A0A0A0",
-minorTickLength:2,minorTickPosition:"outside",startOfWeek:1,startOnTick:!1,tickColor:"#C0D0E0",tickLength:10,tickmarkPlacement:"between",tickPixelInterval:100,tickPosition:"outside",tickWidth:1,title:{align:"middle",style:{color:"#707070"}},type:"linear"},defaultYAxisOptions:{endOnTick:!0,gridLineWidth:1,tickPixelInterval:72,showLastLabel:!0,labels:{x:-8,y:3},lineWidth:0,maxPadding:0.05,minPadding:0.05,startOnTick:!0,tickWidth:0,title:{rotation:270,text:"Values"},stackLabels:{enabled:!1,formatter:function(){return Ba(this.total,
--1)},style:M.style}},defaultLeftAxisOptions:{labels:{x:-15,y:null},title:{rotation:270}},defaultRightAxisOptions:{labels:{x:15,y:null},title:{rotation:90}},defaultBottomAxisOptions:{labels:{x:0,y:null},title:{rotation:0}},defaultTopAxisOptions:{labels:{x:0,y:-15},title:{rotation:0}},init:function(a,b){var c=b.isX;this.horiz=a.inverted?!c:c;this.coll=(this.isXAxis=c)?"xAxis":"yAxis";this.opposite=b.opposite;this.side=b.side||(this.horiz?this.opposite?0:2:this.opposite?1:3);this.setOptions(b);var d=
-this.options,e=d.type;this.labelFormatter=d.labels.formatter||this.defaultLabelFormatter;this.userOptions=b;this.minPixelPadding=0;this.chart=a;this.reversed=d.reversed;this.zoomEnabled=d.zoomEnabled!==!1;this.categories=d.categories||e==="category";this.names=[];this.isLog=e==="logarithmic";this.isDatetimeAxis=e==="datetime";this.isLinked=s(d.linkedTo);this.tickmarkOffset=this.categories&&d.tickmarkPlacement==="between"&&p(d.tickInterval,1)===1?0.5:0;this.ticks={};this.labelEdge=[];this.minorTicks=
-{};this.plotLinesAndBands=[];this.alternateBands={};this.len=0;this.minRange=this.userMinRange=d.minRange||d.maxZoom;this.range=d.range;this.offset=d.offset||0;this.stacks={};this.oldStacks={};this.min=this.max=null;this.crosshair=p(d.crosshair,ra(a.options.tooltip.crosshairs)[c?0:1],!1);var f,d=this.options.events;Ma(this,a.axes)===-1&&(c&&!this.isColorAxis?a.axes.splice(a.xAxis.length,0,this):a.axes.push(this),a[this.coll].push(this));this.series=this.series||[];if(a.inverted&&c&&this.reversed===
-u)this.reversed=!0;this.removePlotLine=this.removePlotBand=this.removePlotBandOrLine;for(f in d)N(this,f,d[f]);if(this.isLog)this.val2lin=za,this.lin2val=ka},setOptions:function(a){this.options=w(this.defaultOptions,this.isXAxis?{}:this.defaultYAxisOptions,[this.defaultTopAxisOptions,this.defaultRightAxisOptions,this.defaultBottomAxisOptions,this.defaultLeftAxisOptions][this.side],w(E[this.coll],a))},defaultLabelFormatter:function(){var a=this.axis,b=this.value,c=a.categories,d=this.dateTimeLabelFormat,
-e=E.lang.numericSymbols,f=e&&e.length,g,h=a.options.labels.format,a=a.isLog?b:a.tickInterval;if(h)g=Ja(h,this);else if(c)g=b;els)***^***",
-R"***^***(e if(d)g=cb(d,b);else if(f&&a>=1E3)for(;f--&&g===u;)c=Math.pow(1E3,f+1),a>=c&&e[f]!==null&&(g=Ba(b/c,-1)+e[f]);g===u&&(g=Q(b)>=1E4?Ba(b,0):Ba(b,-1,u,""));return g},getSeriesExtremes:function(){var a=this,b=a.chart;a.hasVisibleSeries=!1;a.dataMin=a.dataMax=a.ignoreMinPadding=a.ignoreMaxPadding=null;a.buildStacks&&a.buildStacks();q(a.series,function(c){if(c.visible||!b.options.chart.ignoreHiddenSeries){var d;
-d=c.options.threshold;var e;a.hasVisibleSeries=!0;a.isLog&&d<=0&&(d=null);if(a.isXAxis){if(d=c.xData,d.length)a.dataMin=L(p(a.dataMin,d[0]),Oa(d)),a.dataMax=t(p(a.dataMax,d[0]),Ca(d))}else{c.getExtremes();e=c.dataMax;c=c.dataMin;if(s(c)&&s(e))a.dataMin=L(p(a.dataMin,c),c),a.dataMax=t(p(a.dataMax,e),e);if(s(d))if(a.dataMin>=d)a.dataMin=d,a.ignoreMinPadding=!0;else if(a.dataMax<d)a.dataMax=d,a.ignoreMaxPadding=!0}}})},translate:function(a,b,c,d,e,f){var g=1,h=0,i=d?this.oldTransA:this.transA,d=d?this.oldMin:
-this.min,j=this.minPixelPadding,e=(this.options.ordinal||this.isLog&&e)&&this.lin2val;if(!i)i=this.transA;if(c)g*=-1,h=this.len;this.reversed&&(g*=-1,h-=g*(this.sector||this.len));b?(a=a*g+h,a-=j,a=a/i+d,e&&(a=this.lin2val(a))):(e&&(a=this.val2lin(a)),f==="between"&&(f=0.5),a=g*(a-d)*i+h+g*j+(ja(f)?i*f*this.pointRange:0));return a},toPixels:function(a,b){return this.translate(a,!1,!this.horiz,null,!0)+(b?0:this.pos)},toValue:function(a,b){return this.translate(a-(b?0:this.pos),!0,!this.horiz,null,
-!0)},getPlotLinePath:function(a,b,c,d,e){var f=this.chart,g=this.left,h=this.top,i,j,k=c&&f.oldChartHeight||f.chartHeight,l=c&&f.oldChartWidth||f.chartWidth,n;i=this.transB;e=p(e,this.translate(a,null,null,c));a=c=v(e+i);i=j=v(k-e-i);if(isNaN(e))n=!0;else if(this.horiz){if(i=h,j=k-this.bottom,a<g||a>g+this.width)n=!0}else if(a=g,c=l-this.right,i<h||i>h+this.height)n=!0;return n&&!d?null:f.renderer.crispLine(["M",a,i,"L",c,j],b||1)},getLinearTickPositions:function(a,b,c){var d,e=ea(U(b/a)*a),f=ea(La(c/
-a)*a),g=[];if(b===c&&ja(b))return[b];for(b=e;b<=f;){g.push(b);b=ea(b+a);if(b===d)break;d=b}return g},getMinorTickPositions:function(){var a=this.options,b=this.tickPositions,c=this.minorTickInterval,d=[],e;if(this.isLog){e=b.length;for(a=1;a<e;a++)d=d.concat(this.getLogTickPositions(c,b[a-1],b[a],!0))}else if(this.isDatetimeAxis&&a.minorTickInterval==="auto")d=d.concat(this.getTimeTicks(this.normalizeTimeTickInterval(c),this.min,this.max,a.startOfWeek)),d[0]<this.min&&d.shift();else for(b=this.min+
-(b[0]-this.min)%c;b<=this.max;b+=c)d.push(b);return d},adjustForMinRange:function(){var a=this.options,b=this.min,c=this.max,d,e=this.dataMax-this.dataMin>=this.minRange,f,g,h,i,j;if(this.isXAxis&&this.minRange===u&&!this.isLog)s(a.min)||s(a.max)?this.minRange=null:(q(this.series,function(a){i=a.xData;for(g=j=a.xIncrement?1:i.length-1;g>0;g--)if(h=i[g]-i[g-1],f===u||h<f)f=h}),this.minRange=L(f*5,this.dataMax-this.dataMin));if(c-b<this.minRange){var k=this.minRange;d=(k-c+b)/2;d=[b-d,p(a.min,b-d)];
-if(e)d[2]=this.dataMin;b=Ca(d);c=[b+k,p(a.max,b+k)];if(e)c[2]=this.dataMax;c=Oa(c);c-b<k&&(d[0]=c-k,d[1]=p(a.min,c-k),b=Ca(d))}this.min=b;this.max=c},setAxisTranslation:function(a){var b=this,c=b.max-b.min,d=b.axisPointRange||0,e,f=0,g=0,h=b.linkedParent,i=!!b.categories,j=b.transA;if(b.isXAxis||i||d)h?(f=h.minPointOffset,g=h.pointRangePadding):q(b.series,function(a){var h=i?1:b.isXAxis?a.pointRange:b.axisPointRange||0,j=a.options.pointPlacement,m=a.closestPointRange;h>c&&(h=0);d=t(d,h);f=t(f,Ga(j)?
-0:h/2);g=t(g,j==="on"?0:h);!a.noSharedTooltip&&s(m)&&(e=s(e)?L(e,m):m)}),h=b.ordinalSlope&&e?b.ordinalSlope/e:1,b.minPointOffset=f*=h,b.pointRangePadding=g*=h,b.pointRange=L(d,c),b.closestPointRange=e;if(a)b.oldTransA=j;b.translationSlope=b.transA=j=b.len/(c+g||1);b.transB=b.horiz?b.left:b.bottom;b.minPixelPadding=j*f},setTickPositions:function(a){var b=this,c=b.chart,d=b.options,e=d.startOnTick,f=d.endOnTick,g=b.isLog,h=b.isDatetimeAxis,i=b.isXAxis,j=b.isLinked,k=b.options.tickPositioner,l=d.maxPadding,
-n=d.minPadding,m=d.tickInterval,o=d.minTickInterval,Y=d.tickPixelInterval,D,J=b.categories;j?(b.linkedParent=c[b.coll][d.linkedTo],c=b.linkedParent.getExtremes(),b.min=p(c.min,c.dataMin),b.max=p(c.max,c.dataMax),d.type!==b.linkedParent.options.type&&ha(11,1)):(b.min=p(b.userMin,d.min,b.dataMin),b.max=p(b.userMax,d.max,b.dataMax));if(g)!a&&L(b.min,p(b.dataMin,b.min))<=0&&ha(10,1),b.min=ea(za(b.min)),b.max=ea(za(b.max));if(b.range&&s(b.max))b.userMin=b.min=t(b.min,b.max-b.range),b.userMax=b.max,b.range=
-null;b.beforePadding&&b.beforePadding();b.adjustForMinRange();if(!J&&!b.axisPointRange&&!b.usePercentage&&!j&&s(b.min)&&s(b.max)&&(c=b.max-b.min)){if(!s(d.min)&&!s(b.userMin)&&n&&(b.dataMin<0||!b.ignoreMinPadding))b.min-=c*n;if(!s(d.max)&&!s(b.userMax)&&l&&(b.dataMax>0||!b.ignoreMaxPadding))b.max+=c*l}if(ja(d.floor))b.min=t(b.min,d.floor);if(ja(d.ceiling))b.max=L(b.max,d.ceiling);b.min===b.max||b.min===void 0||b.max===void 0?b.tickInterval=1:j&&!m&&Y===b.linkedParent.options.tickPixelInterval?b.tickInterval=
-b.linkedParent.tickInterval:(b.tickInterval=p(m,J?1:(b.max-b.min)*Y/t(b.len,Y)),!s(m)&&b.len<Y&&!this.isRadial&&!this.isLog&&!J&&e&&f&&(D=!0,b.tickInterval/=4));i&&!a&&q(b.series,function(a){a.processData(b.min!==b.oldMin||b.max!==b.oldMax)});b.setAxisTranslation(!0);b.beforeSetTickPositions&&b.beforeSetTickPositions();if(b.postProcessTickInterval)b.tickInterval=b.postProcessTickInterval(b.tickInterval);if(b.pointRange)b.tickInterval=t(b.pointRange,b.tickInterval);if(!m&&b.tickInterval<o)b.tickInterval=
-o;if(!h&&!g&&!m)b.tickInterval=nb(b.tickInterval,null,mb(b.tickInterval),p(d.allowDecimals,!(b.tickInterval>1&&b.tickInterval<5&&b.max>1E3&&b.max<9999)));b.minorTickInterval=d.minorTickInterval==="auto"&&b.tickInterval?b.tickInterval/5:d.minorTickInterval;b.tickPositions=a=d.tickPositions?[].concat(d.tickPositions):k&&k.apply(b,[b.min,b.max]);if(!a)!b.ordinalPositions&&(b.max-b.min)/b.tickInterval>t(2*b.len,200)&&ha(19,!0),a=h?b.getTimeTicks(b.normalizeTimeTickInterval(b.tickInterval,d.units),b.min,
-b.max,d.startOfWeek,b.ordinalPositions,b.closestPointRange,!0):g?b.getLogTickPositions(b.tickInterval,b.min,b.max):b.getLinearTickPositions(b.tickInterval,b.min,b.max),D&&a.splice(1,a.length-2),b.tickPositions=a;if(!j)d=a[0],g=a[a.length-1],h=b.minPointOffset||0,e?b.min=d:b.min-h>d&&a.shift(),f?b.max=g:b.max+h<g&&a.pop(),a.length===0&&s(d)&&a.push((g+d)/2),a.length===1&&(e=Q(b.max)>1E13?1:0.001,b.min-=e,b.max+=e)},setMaxTicks:function(){var a=this.chart,b=a.maxTicks||{},c=this.tickPositions,d=this._maxTicksKey=
-[this.coll,this.pos,this.len].join("-");if(!this.isLinked&&!this.isDatetimeAxis&&c&&c.length>(b[d]||0)&&this.options.alignTicks!==!1)b[d]=c.length;a.maxTicks=b},adjustTickAmount:function(){var a=this._maxTicksKey,b=this.tickPositions,c=this.chart.maxTicks;if(c&&c[a]&&!this.isDatetimeAxis&&!this.categories&&!this.isLinked&&this.options.alignTicks!==!1&&this.min!==u){var d=this.tickAmount,e=b.length;this.tickAmount=a=c[a];if(e<a){for(;b.length<a;)b.push(ea(b[b.length-1]+this.tickInterval));this.transA*=
-(e-1)/(a-1);this.max=b[b.length-1]}if(s(d)&&a!==d)this.isDirty=!0}},setScale:function(){var a=this.stacks,b,c,d,e;this.oldMin=this.min;this.oldMax=this.max;this.oldAxisLength=this.len;this.setAxisSize();e=this.len!==this.oldAxisLength;q(this.series,function(a){if(a.isDirtyData||a.isDirty||a.xAxis.isDirty)d=!0});if(e||d||this.isLinked||this.forceRedraw||this.userMin!==this.oldUserMin||this.userMax!==this.oldUserMax){if(!this.isXAxis)for(b in a)for(c in a[b])a[b][c].total=null,a[b][c].cum=0;this.forceRedraw=
-!1;this.getSeriesExtremes();this.setTickPositions();this.oldUserMin=this.userMin;this.oldUserMax=this.userMax;if(!this.isDirty)this.isDirty=e||this.min!==this.oldMin||this.max!==this.oldMax}else if(!this.isXAxis){if(this.oldStacks)a=this.stacks=this.oldStacks;for(b in a)for(c in a[b])a[b][c].cum=a[b][c].total}this.setMaxTicks()},setExtremes:function(a,b,c,d,e){var f=this,g=f.chart,c=p(c,!0),e=r(e,{min:a,max:b});I(f,"setExtremes",e,function(){f.userMin=a;f.userMax=b;f.eventArgs=e;f.isDirtyExtremes=
-!0;c&&g.redraw(d)})},zoom:function(a,b){var c=this.dataMin,d=this.dataMax,e=this.options;this.allowZoomOutside||(s(c)&&a<=L(c,p(e.min,c))&&(a=u),s(d)&&b>=t(d,p(e.max,d))&&(b=u));this.displayBtn=a!==u||b!==u;this.setExtremes(a,b,!1,u,{trigger:"zoom"});return!0},setAxisSize:function(){var a=this.chart,b=this.options,c=b.offsetLeft||0,d=this.horiz,e=p(b.width,a.plotWidth-c+(b.offsetRight||0)),f=p(b.height,a.plotHeight),g=p(b.top,a.plotTop),b=p(b.left,a.plotLeft+c),c=/%$/;c.test(f)&&(f=parseInt(f,10)/
-100*a.plotHeight);c.test(g)&&(g=parseInt(g,10)/100*a.plotHeight+a.plotTop);this.left=b;this.top=g;this.width=e;this.height=f;this.bottom=a.chartHeight-f-g;this.right=a.chartWidth-e-b;this.len=t(d?e:f,0);this.pos=d?b:g},getExtremes:function(){var a=this.isLog;return{min:a?ea(ka(this.min)):this.min,max:a?ea(ka(this.max)):this.max,dataMin:this.dataMin,dataMax:this.dataMax,userMin:this.userMin,userMax:this.userMax}},getThreshold:function(a){var b=this.isLog,c=b?ka(this.min):this.min,b=b?ka(this.max):
-this.max;c>a||a===null?a=c:b<a&&(a=b);return this.translate(a,0,1,0,1)},autoLabelAlign:function(a){a=(p(a,0)-this.side*90+720)%360;return a>15&&a<165?"right":a>195&&a<345?"left":"center"},getOffset:function(){var a=this,b=a.chart,c=b.renderer,d=a.options,e=a.tickPositions,f=a.ticks,g=a.horiz,h=a.side,i=b.inverted?[1,0,3,2][h]:h,j,k,l=0,n,m=0,o=d.title,Y=d.labels,D=0,J=b.axisOffset,b=b.clipOffset,C=[-1,1,1,-1][h],r,v=1,w=p(Y.maxStaggerLines,5),x,y,A,z,R;a.hasData=j=a.hasVisibleSeries||s(a.min)&&s(a.max)&&
-!!e;a.showAxis=k=j||p(d.showEmpty,!0);a.staggerLines=a.horiz&&Y.staggerLines;if(!a.axisGroup)a.gridGroup=c.g("grid").attr({zIndex:d.gridZIndex||1}).add(),a.axisGroup=c.g("axis").attr({zIndex:d.zIndex||2}).add(),a.labelGroup=c.g("axis-labels").attr({zIndex:Y.zIndex||7}).addClass("highcharts-"+a.coll.toLowerCase()+"-labels").add();if(j||a.isLinked){a.labelAlign=p(Y.align||a.autoLabelAlign(Y.rotation));q(e,function(b){f[b]?f[b].addLabel():f[b]=new Ta(a,b))***^***",
-R"***^***(});if(a.horiz&&!a.staggerLines&&w&&!Y.rotation){for(j=
-a.reversed?[].concat(e).reverse():e;v<w;){x=[];y=!1;for(r=0;r<j.length;r++)A=j[r],z=(z=f[A].label&&f[A].label.getBBox())?z.width:0,R=r%v,z&&(A=a.translate(A),x[R]!==u&&A<x[R]&&(y=!0),x[R]=A+z);if(y)v++;else break}if(v>1)a.staggerLines=v}q(e,function(b){if(h===0||h===2||{1:"left",3:"right"}[h]===a.labelAlign)D=t(f[b].getLabelSize(),D)});if(a.staggerLines)D*=a.staggerLines,a.labelOffset=D}else for(r in f)f[r].destroy(),delete f[r];if(o&&o.text&&o.enabled!==!1){if(!a.axisTitle)a.axisTitle=c.text(o.text,
-0,0,o.useHTML).attr({zIndex:7,rotation:o.rotation||0,align:o.textAlign||{low:"left",middle:"center",high:"right"}[o.align]}).addClass("highcharts-"+this.coll.toLowerCase()+"-title").css(o.style).add(a.axisGroup),a.axisTitle.isNew=!0;if(k)l=a.axisTitle.getBBox()[g?"height":"width"],n=o.offset,m=s(n)?0:p(o.margin,g?5:10);a.axisTitle[k?"show":"hide"]()}a.offset=C*p(d.offset,J[h]);c=h===2?a.tickBaseline:0;g=D+m+(D&&C*(g?p(Y.y,a.tickBaseline+8):Y.x)-c);a.axisTitleMargin=p(n,g);J[h]=t(J[h],a.axisTitleMargin+
-l+C*a.offset,g);b[i]=t(b[i],U(d.lineWidth/2)*2)},getLinePath:function(a){var b=this.chart,c=this.opposite,d=this.offset,e=this.horiz,f=this.left+(c?this.width:0)+d,d=b.chartHeight-this.bottom-(c?this.height:0)+d;c&&(a*=-1);return b.renderer.crispLine(["M",e?this.left:f,e?d:this.top,"L",e?b.chartWidth-this.right:f,e?d:b.chartHeight-this.bottom],a)},getTitlePosition:function(){var a=this.horiz,b=this.left,c=this.top,d=this.len,e=this.options.title,f=a?b:c,g=this.opposite,h=this.offset,i=y(e.style.fontSize||
-12),d={low:f+(a?0:d),middle:f+d/2,high:f+(a?d:0)}[e.align],b=(a?c+this.height:b)+(a?1:-1)*(g?-1:1)*this.axisTitleMargin+(this.side===2?i:0);return{x:a?d:b+(g?this.width:0)+h+(e.x||0),y:a?b-(g?this.height:0)+h:d+(e.y||0)}},render:function(){var a=this,b=a.horiz,c=a.reversed,d=a.chart,e=d.renderer,f=a.options,g=a.isLog,h=a.isLinked,i=a.tickPositions,j,k=a.axisTitle,l=a.ticks,n=a.minorTicks,m=a.alternateBands,o=f.stackLabels,p=f.alternateGridColor,D=a.tickmarkOffset,J=f.lineWidth,C=d.hasRendered&&s(a.oldMin)&&
-!isNaN(a.oldMin),r=a.hasData,t=a.showAxis,v,w=f.labels.overflow,x=a.justifyLabels=b&&w!==!1,A;a.labelEdge.length=0;a.justifyToPlot=w==="justify";q([l,n,m],function(a){for(var b in a)a[b].isActive=!1});if(r||h)if(a.minorTickInterval&&!a.categories&&q(a.getMinorTickPositions(),function(b){n[b]||(n[b]=new Ta(a,b,"minor"));C&&n[b].isNew&&n[b].render(null,!0);n[b].render(null,!1,1)}),i.length&&(j=i.slice(),(b&&c||!b&&!c)&&j.reverse(),x&&(j=j.slice(1).concat([j[0]])),q(j,function(b,c){x&&(c=c===j.length-
-1?0:c+1);if(!h||b>=a.min&&b<=a.max)l[b]||(l[b]=new Ta(a,b)),C&&l[b].isNew&&l[b].render(c,!0,0.1),l[b].render(c)}),D&&a.min===0&&(l[-1]||(l[-1]=new Ta(a,-1,null,!0)),l[-1].render(-1))),p&&q(i,function(b,c){if(c%2===0&&b<a.max)m[b]||(m[b]=new K.PlotLineOrBand(a)),v=b+D,A=i[c+1]!==u?i[c+1]+D:a.max,m[b].options={from:g?ka(v):v,to:g?ka(A):A,color:p},m[b].render(),m[b].isActive=!0}),!a._addedPlotLB)q((f.plotLines||[]).concat(f.plotBands||[]),function(b){a.addPlotBandOrLine(b)}),a._addedPlotLB=!0;q([l,n,
-m],function(a){var b,c,e=[],f=va?va.duration||500:0,g=function(){for(c=e.length;c--;)a[e[c]]&&!a[e[c]].isActive&&(a[e[c]].destroy(),delete a[e[c]])};for(b in a)if(!a[b].isActive)a[b].render(b,!1,0),a[b].isActive=!1,e.push(b);a===m||!d.hasRendered||!f?g():f&&setTimeout(g,f)});if(J)b=a.getLinePath(J),a.axisLine?a.axisLine.animate({d:b}):a.axisLine=e.path(b).attr({stroke:f.lineColor,"stroke-width":J,zIndex:7}).add(a.axisGroup),a.axisLine[t?"show":"hide"]();if(k&&t)k[k.isNew?"attr":"animate"](a.getTitlePosition()),
-k.isNew=!1;o&&o.enabled&&a.renderStackTotals();a.isDirty=!1},redraw:function(){this.render();q(this.plotLinesAndBands,function(a){a.render()});q(this.series,function(a){a.isDirty=!0})},destroy:function(a){var b=this,c=b.stacks,d,e=b.plotLinesAndBands;a||X(b);for(d in c)Pa(c[d]),c[d]=null;q([b.ticks,b.minorTicks,b.alternateBands],function(a){Pa(a)});for(a=e.length;a--;)e[a].destroy();q("stackTotalGroup,axisLine,axisTitle,axisGroup,cross,gridGroup,labelGroup".split(","),function(a){b[a]&&(b[a]=b[a].destroy())});
-this.cross&&this.cross.destroy()},drawCrosshair:function(a,b){if(this.crosshair)if((s(b)||!p(this.crosshair.snap,!0))===!1)this.hideCrosshair();else{var c,d=this.crosshair,e=d.animation;p(d.snap,!0)?s(b)&&(c=this.chart.inverted!=this.horiz?b.plotX:this.len-b.plotY):c=this.horiz?a.chartX-this.pos:this.len-a.chartY+this.pos;c=this.isRadial?this.getPlotLinePath(this.isXAxis?b.x:p(b.stackY,b.y)):this.getPlotLinePath(null,null,null,null,c);if(c===null)this.hideCrosshair();else if(this.cross)this.cross.attr({visibility:"visible"})[e?
-"animate":"attr"]({d:c},e);else{e={"stroke-width":d.width||1,stroke:d.color||"#C0C0C0",zIndex:d.zIndex||2};if(d.dashStyle)e.dashstyle=d.dashStyle;this.cross=this.chart.renderer.path(c).attr(e).add()}}},hideCrosshair:function(){this.cross&&this.cross.hide()}};r(na.prototype,{getPlotBandPath:function(a,b){var c=this.getPlotLinePath(b),d=this.getPlotLinePath(a);d&&c?d.push(c[4],c[5],c[1],c[2]):d=null;return d},addPlotBand:function(a){return this.addPlotBandOrLine(a,"plotBands")},addPlotLine:function(a){return this.addPlotBandOrLine(a,
-"plotLines")},addPlotBandOrLine:function(a,b){var c=(new K.PlotLineOrBand(this,a)).render(),d=this.userOptions;c&&(b&&(d[b]=d[b]||[],d[b].push(a)),this.plotLinesAndBands.push(c));return c},removePlotBandOrLine:function(a){for(var b=this.plotLinesAndBands,c=this.options,d=this.userOptions,e=b.length;e--;)b[e].id===a&&b[e].destroy();q([c.plotLines||[],d.plotLines||[],c.plotBands||[],d.plotBands||[]],function(b){for(e=b.length;e--;)b[e].id===a&&la(b,b[e])})}});na.prototype.getTimeTicks=function(a,b,
-c,d){var e=[],f={},g=E.global.useUTC,h,i=new Da(b-Sa),j=a.unitRange,k=a.count;if(s(b)){j>=A.second&&(i.setMilliseconds(0),i.setSeconds(j>=A.minute?0:k*U(i.getSeconds()/k)));if(j>=A.minute)i[Cb](j>=A.hour?0:k*U(i[pb]()/k));if(j>=A.hour)i[Db](j>=A.day?0:k*U(i[qb]()/k));if(j>=A.day)i[sb](j>=A.month?1:k*U(i[Xa]()/k));j>=A.month&&(i[Eb](j>=A.year?0:k*U(i[fb]()/k)),h=i[gb]());j>=A.year&&(h-=h%k,i[Fb](h));if(j===A.week)i[sb](i[Xa]()-i[rb]()+p(d,1));b=1;Sa&&(i=new Da(i.getTime()+Sa));h=i[gb]();for(var d=
-i.getTime(),l=i[fb](),n=i[Xa](),m=(A.day+(g?Sa:i.getTimezoneOffset()*6E4))%A.day;d<c;)e.push(d),j===A.year?d=eb(h+b*k,0):j===A.month?d=eb(h,l+b*k):!g&&(j===A.day||j===A.week)?d=eb(h,l,n+b*k*(j===A.day?1:7)):d+=j*k,b++;e.push(d);q(wb(e,function(a){return j<=A.hour&&a%A.day===m}),function(a){f[a]="day"})}e.info=r(a,{higherRanks:f,totalRange:j*k});return e};na.prototype.normalizeTimeTickInterval=function(a,b){var c=b||[["millisecond",[1,2,5,10,20,25,50,100,200,500]],["second",[1,2,5,10,15,30]],["minute",
-[1,2,5,10,15,30]],["hour",[1,2,3,4,6,8,12]],["day",[1,2]],["week",[1,2]],["month",[1,2,3,4,6]],["year",null]],d=c[c.length-1],e=A[d[0]],f=d[1],g;for(g=0;g<c.length;g++)if(d=c[g],e=A[d[0]],f=d[1],c[g+1]&&a<=(e*f[f.length-1]+A[c[g+1][0]])/2)break;e===A.year&&a<5*e&&(f=[1,2,5]);c=nb(a/e,f,d[0]==="year"?t(mb(a/e),1):1);return{unitRange:e,count:c,unitName:d[0]}};na.prototype.getLogTickPositions=function(a,b,c,d){var e=this.options,f=this.len,g=[];if(!d)this._minorAutoInterval=null;if(a>=0.5)a=v(a),g=this.getLinearTickPositions(a,
-b,c);else if(a>=0.08)for(var f=U(b),h,i,j,k,l,e=a>0.3?[1,2,4]:a>0.15?[1,2,4,6,8]:[1,2,3,4,5,6,7,8,9];f<c+1&&!l;f++){i=e.length;for(h=0;h<i&&!l;h++)j=za(ka(f)*e[h]),j>b&&(!d||k<=c)&&k!==u&&g.push(k),k>c&&(l=!0),k=j}else if(b=ka(b),c=ka(c),a=e[d?"minorTickInterval":"tickInterval"],a=p(a==="auto"?null:a,this._minorAutoInterval,(c-b)*(e.tickPixelInterval/(d?5:1))/((d?f/this.tickPositions.length:f)||1)),a=nb(a,null,mb(a)),g=Va(this.getLinearTickPositions(a,b,c),za),!d)this._minorAutoInterval=a/5;if(!d)this.tickInterval=
-a;return g};var Nb=K.Tooltip=function(){this.init.apply(this,arguments)};Nb.prototype={init:function(a,b){var c=b.borderWidth,d=b.style,e=y(d.padding);this.chart=a;this.options=b;this.crosshairs=[];this.now={x:0,y:0};this.isHidden=!0;this.label=a.renderer.label("",0,0,b.shape||"callout",null,null,b.useHTML,null,"tooltip").attr({padding:e,fill:b.backgroundColor,"stroke-width":c,r:b.borderRadius,zIndex:8}).css(d).css({padding:0}).add().attr({y:-9999});ga||this.label.shadow(b.shadow);this.shared=b.shared},
-destroy:function(){if(this.label)this.label=this.label.destroy();clearTimeout(this.hideTimer);clearTimeout(this.tooltipTimeout)},move:function(a,b,c,d){var e=this,f=e.now,g=e.options.animation!==!1&&!e.isHidden&&(Q(a-f.x)>1||Q(b-f.y)>1),h=e.followPointer||e.len>1;r(f,{x:g?(2*f.x+a)/3:a,y:g?(f.y+b)/2:b,anchorX:h?u:g?(2*f.anchorX+c)/3:c,anchorY:h?u:g?(f.anchorY+d)/2:d});e.label.attr(f);if(g)clearTimeout(this.tooltipTimeout),this.tooltipTimeout=setTimeout(function(){e&&e.move(a,b,c,d)},32)},hide:function(a){var b=
-this,c;clearTimeout(this.hideTimer);if(!this.isHidden)c=this.chart.hoverPoints,this.hideTimer=setTimeout(function(){b.label.fadeOut();b.isHidden=!0},p(a,this.options.hideDelay,500)),c&&q(c,function(a){a.setState()}),this.chart.hoverPoints=null},getAnchor:function(a,b){var c,d=this.chart,e=d.inverted,f=d.plotTop,g=0,h=0,i,a=ra(a);c=a[0].tooltipPos;this.followPointer&&b&&(b.chartX===u&&(b=d.pointer.normalize(b)),c=[b.chartX-d.plotLeft,b.chartY-f]);c||(q(a,function(a){i=a.series.yAxis;g+=a.plotX;h+=
-(a.plotLow?(a.plotLow+a.plotHigh)/2:a.plotY)+(!e&&i?i.top-f:0)}),g/=a.length,h/=a.length,c=[e?d.plotWidth-h:g,this.shared&&!e&&a.length>1&&b?b.chartY-f:e?d.plotHeight-g:h]);return Va(c,v)},getPosition:function(a,b,c){var d=this.chart,e=this.distance,f={},g,h=["y",d.chartHeight,b,c.plotY+d.plotTop],i=["x",d.chartWidth,a,c.plotX+d.plotLeft],j=c.ttBelow||d.inverted&&!c.negative||!d.inverted&&c.negative,k=function(a,b,c,d){var g=c<d-e,b=d+e+c<b,c=d-e-c;d+=e;if(j&&b)f[a]=d;else if(!j&&g)f[a]=c;else if(g)f[a]=
-c;else if(b)f[a]=d;else return!1},l=function(a,b,c,d){if(d<e||d>b-e)return!1;else f[a]=d<c/2?1:d>b-c/2?b-c-2:d-c/2},n=function(a){var b=h;h=i;i=b;g=a},m=function(){k.apply(0,h)!==!1?l.apply(0,i))***^***",
-R"***^***(===!1&&!g&&(n(!0),m()):g?f.x=f.y=0:(n(!0),m())};(d.inverted||this.len>1)&&n();m();return f},defaultFormatter:function(a){var b=this.points||ra(this),c=b[0].series,d;d=[a.tooltipHeaderFormatter(b[0])];q(b,function(a){c=a.series;d.push(c.tooltipFormatter&&c.tooltipFormatter(a)||a.point.tooltipFormatter(c.tooltipOptions.pointFormat))});
-d.push(a.options.footerFormat||"");return d.join("")},refresh:function(a,b){var c=this.chart,d=this.label,e=this.options,f,g,h={},i,j=[];i=e.formatter||this.defaultFormatter;var h=c.hoverPoints,k,l=this.shared;clearTimeout(this.hideTimer);this.followPointer=ra(a)[0].series.tooltipOptions.followPointer;g=this.getAnchor(a,b);f=g[0];g=g[1];l&&(!a.series||!a.series.noSharedTooltip)?(c.hoverPoints=a,h&&q(h,function(a){a.setState()}),q(a,function(a){a.setState("hover");j.push(a.getLabelConfig())}),h={x:a[0].category,
-y:a[0].y},h.points=j,this.len=j.length,a=a[0]):h=a.getLabelConfig();i=i.call(h,this);h=a.series;this.distance=p(h.tooltipOptions.distance,16);i===!1?this.hide():(this.isHidden&&(bb(d),d.attr("opacity",1).show()),d.attr({text:i}),k=e.borderColor||a.color||h.color||"#606060",d.attr({stroke:k}),this.updatePosition({plotX:f,plotY:g,negative:a.negative,ttBelow:a.ttBelow}),this.isHidden=!1);I(c,"tooltipRefresh",{text:i,x:f+c.plotLeft,y:g+c.plotTop,borderColor:k})},updatePosition:function(a){var b=this.chart,
-c=this.label,c=(this.options.positioner||this.getPosition).call(this,c.width,c.height,a);this.move(v(c.x),v(c.y),a.plotX+b.plotLeft,a.plotY+b.plotTop)},tooltipHeaderFormatter:function(a){var b=a.series,c=b.tooltipOptions,d=c.dateTimeLabelFormats,e=c.xDateFormat,f=b.xAxis,g=f&&f.options.type==="datetime"&&ja(a.key),c=c.headerFormat,f=f&&f.closestPointRange,h;if(g&&!e){if(f)for(h in A){if(A[h]>=f||A[h]<=A.day&&a.key%A[h]>0){e=d[h];break}}else e=d.day;e=e||d.year}g&&e&&(c=c.replace("{point.key}","{point.key:"+
-e+"}"));return Ja(c,{point:a,series:b})}};var pa;$a=x.documentElement.ontouchstart!==u;var Wa=K.Pointer=function(a,b){this.init(a,b)};Wa.prototype={init:function(a,b){var c=b.chart,d=c.events,e=ga?"":c.zoomType,c=a.inverted,f;this.options=b;this.chart=a;this.zoomX=f=/x/.test(e);this.zoomY=e=/y/.test(e);this.zoomHor=f&&!c||e&&c;this.zoomVert=e&&!c||f&&c;this.hasZoom=f||e;this.runChartClick=d&&!!d.click;this.pinchDown=[];this.lastValidTouch={};if(K.Tooltip&&b.tooltip.enabled)a.tooltip=new Nb(a,b.tooltip),
-this.followTouchMove=b.tooltip.followTouchMove;this.setDOMEvents()},normalize:function(a,b){var c,d,a=a||window.event,a=Tb(a);if(!a.target)a.target=a.srcElement;d=a.touches?a.touches.length?a.touches.item(0):a.changedTouches[0]:a;if(!b)this.chartPosition=b=Sb(this.chart.container);d.pageX===u?(c=t(a.x,a.clientX-b.left),d=a.y):(c=d.pageX-b.left,d=d.pageY-b.top);return r(a,{chartX:v(c),chartY:v(d)})},getCoordinates:function(a){var b={xAxis:[],yAxis:[]};q(this.chart.axes,function(c){b[c.isXAxis?"xAxis":
-"yAxis"].push({axis:c,value:c.toValue(a[c.horiz?"chartX":"chartY"])})});return b},getIndex:function(a){var b=this.chart;return b.inverted?b.plotHeight+b.plotTop-a.chartY:a.chartX-b.plotLeft},runPointActions:function(a){var b=this.chart,c=b.series,d=b.tooltip,e,f,g=b.hoverPoint,h=b.hoverSeries,i,j,k=b.chartWidth,l=this.getIndex(a);if(d&&this.options.tooltip.shared&&(!h||!h.noSharedTooltip)){f=[];i=c.length;for(j=0;j<i;j++)if(c[j].visible&&c[j].options.enableMouseTracking!==!1&&!c[j].noSharedTooltip&&
-c[j].singularTooltips!==!0&&c[j].tooltipPoints.length&&(e=c[j].tooltipPoints[l])&&e.series)e._dist=Q(l-e.clientX),k=L(k,e._dist),f.push(e);for(i=f.length;i--;)f[i]._dist>k&&f.splice(i,1);if(f.length&&f[0].clientX!==this.hoverX)d.refresh(f,a),this.hoverX=f[0].clientX}c=h&&h.tooltipOptions.followPointer;if(h&&h.tracker&&!c){if((e=h.tooltipPoints[l])&&e!==g)e.onMouseOver(a)}else d&&c&&!d.isHidden&&(h=d.getAnchor([{}],a),d.updatePosition({plotX:h[0],plotY:h[1]}));if(d&&!this._onDocumentMouseMove)this._onDocumentMouseMove=
-function(a){if(W[pa])W[pa].pointer.onDocumentMouseMove(a)},N(x,"mousemove",this._onDocumentMouseMove);q(b.axes,function(b){b.drawCrosshair(a,p(e,g))})},reset:function(a,b){var c=this.chart,d=c.hoverSeries,e=c.hoverPoint,f=c.tooltip,g=f&&f.shared?c.hoverPoints:e;(a=a&&f&&g)&&ra(g)[0].plotX===u&&(a=!1);if(a)f.refresh(g),e&&e.setState(e.state,!0);else{if(e)e.onMouseOut();if(d)d.onMouseOut();f&&f.hide(b);if(this._onDocumentMouseMove)X(x,"mousemove",this._onDocumentMouseMove),this._onDocumentMouseMove=
-null;q(c.axes,function(a){a.hideCrosshair()});this.hoverX=null}},scaleGroups:function(a,b){var c=this.chart,d;q(c.series,function(e){d=a||e.getPlotBox();e.xAxis&&e.xAxis.zoomEnabled&&(e.group.attr(d),e.markerGroup&&(e.markerGroup.attr(d),e.markerGroup.clip(b?c.clipRect:null)),e.dataLabelsGroup&&e.dataLabelsGroup.attr(d))});c.clipRect.attr(b||c.clipBox)},dragStart:function(a){var b=this.chart;b.mouseIsDown=a.type;b.cancelClick=!1;b.mouseDownX=this.mouseDownX=a.chartX;b.mouseDownY=this.mouseDownY=a.chartY},
-drag:function(a){var b=this.chart,c=b.options.chart,d=a.chartX,e=a.chartY,f=this.zoomHor,g=this.zoomVert,h=b.plotLeft,i=b.plotTop,j=b.plotWidth,k=b.plotHeight,l,n=this.mouseDownX,m=this.mouseDownY,o=c.panKey&&a[c.panKey+"Key"];d<h?d=h:d>h+j&&(d=h+j);e<i?e=i:e>i+k&&(e=i+k);this.hasDragged=Math.sqrt(Math.pow(n-d,2)+Math.pow(m-e,2));if(this.hasDragged>10){l=b.isInsidePlot(n-h,m-i);if(b.hasCartesianSeries&&(this.zoomX||this.zoomY)&&l&&!o&&!this.selectionMarker)this.selectionMarker=b.renderer.rect(h,i,
-f?1:j,g?1:k,0).attr({fill:c.selectionMarkerFill||"rgba(69,114,167,0.25)",zIndex:7}).add();this.selectionMarker&&f&&(d-=n,this.selectionMarker.attr({width:Q(d),x:(d>0?0:d)+n}));this.selectionMarker&&g&&(d=e-m,this.selectionMarker.attr({height:Q(d),y:(d>0?0:d)+m}));l&&!this.selectionMarker&&c.panning&&b.pan(a,c.panning)}},drop:function(a){var b=this.chart,c=this.hasPinched;if(this.selectionMarker){var d={xAxis:[],yAxis:[],originalEvent:a.originalEvent||a},e=this.selectionMarker,f=e.attr?e.attr("x"):
-e.x,g=e.attr?e.attr("y"):e.y,h=e.attr?e.attr("width"):e.width,i=e.attr?e.attr("height"):e.height,j;if(this.hasDragged||c)q(b.axes,function(b){if(b.zoomEnabled){var c=b.horiz,e=a.type==="touchend"?b.minPixelPadding:0,m=b.toValue((c?f:g)+e),c=b.toValue((c?f+h:g+i)-e);!isNaN(m)&&!isNaN(c)&&(d[b.coll].push({axis:b,min:L(m,c),max:t(m,c)}),j=!0)}}),j&&I(b,"selection",d,function(a){b.zoom(r(a,c?{animation:!1}:null))});this.selectionMarker=this.selectionMarker.destroy();c&&this.scaleGroups()}if(b)B(b.container,
-{cursor:b._cursor}),b.cancelClick=this.hasDragged>10,b.mouseIsDown=this.hasDragged=this.hasPinched=!1,this.pinchDown=[]},onContainerMouseDown:function(a){a=this.normalize(a);a.preventDefault&&a.preventDefault();this.dragStart(a)},onDocumentMouseUp:function(a){W[pa]&&W[pa].pointer.drop(a)},onDocumentMouseMove:function(a){var b=this.chart,c=this.chartPosition,d=b.hoverSeries,a=this.normalize(a,c);c&&d&&!this.inClass(a.target,"highcharts-tracker")&&!b.isInsidePlot(a.chartX-b.plotLeft,a.chartY-b.plotTop)&&
-this.reset()},onContainerMouseLeave:function(){var a=W[pa];if(a)a.pointer.reset(),a.pointer.chartPosition=null},onContainerMouseMove:function(a){var b=this.chart;pa=b.index;a=this.normalize(a);a.returnValue=!1;b.mouseIsDown==="mousedown"&&this.drag(a);(this.inClass(a.target,"highcharts-tracker")||b.isInsidePlot(a.chartX-b.plotLeft,a.chartY-b.plotTop))&&!b.openMenu&&this.runPointActions(a)},inClass:function(a,b){for(var c;a;){if(c=F(a,"class"))if(c.indexOf(b)!==-1)return!0;else if(c.indexOf("highcharts-container")!==
--1)return!1;a=a.parentNode}},onTrackerMouseOut:function(a){var b=this.chart.hoverSeries,c=(a=a.relatedTarget||a.toElement)&&a.point&&a.point.series;if(b&&!b.options.stickyTracking&&!this.inClass(a,"highcharts-tooltip")&&c!==b)b.onMouseOut()},onContainerClick:function(a){var b=this.chart,c=b.hoverPoint,d=b.plotLeft,e=b.plotTop,a=this.normalize(a);a.cancelBubble=!0;b.cancelClick||(c&&this.inClass(a.target,"highcharts-tracker")?(I(c.series,"click",r(a,{point:c})),b.hoverPoint&&c.firePointEvent("click",
-a)):(r(a,this.getCoordinates(a)),b.isInsidePlot(a.chartX-d,a.chartY-e)&&I(b,"click",a)))},setDOMEvents:function(){var a=this,b=a.chart.container;b.onmousedown=function(b){a.onContainerMouseDown(b)};b.onmousemove=function(b){a.onContainerMouseMove(b)};b.onclick=function(b){a.onContainerClick(b)};N(b,"mouseleave",a.onContainerMouseLeave);ab===1&&N(x,"mouseup",a.onDocumentMouseUp);if($a)b.ontouchstart=function(b){a.onContainerTouchStart(b)},b.ontouchmove=function(b){a.onContainerTouchMove(b)},ab===1&&
-N(x,"touchend",a.onDocumentTouchEnd)},destroy:function(){var a;X(this.chart.container,"mouseleave",this.onContainerMouseLeave);ab||(X(x,"mouseup",this.onDocumentMouseUp),X(x,"touchend",this.onDocumentTouchEnd));clearInterval(this.tooltipTimeout);for(a in this)this[a]=null}};r(K.Pointer.prototype,{pinchTranslate:function(a,b,c,d,e,f){(this.zoomHor||this.pinchHor)&&this.pinchTranslateDirection(!0,a,b,c,d,e,f);(this.zoomVert||this.pinchVert)&&this.pinchTranslateDirection(!1,a,b,c,d,e,f)},pinchTranslateDirection:function(a,
-b,c,d,e,f,g,h){var i=this.chart,j=a?"x":"y",k=a?"X":"Y",l="chart"+k,n=a?"width":"height",m=i["plot"+(a?"Left":"Top")],o,p,q=h||1,r=i.inverted,C=i.bounds[a?"h":"v"],t=b.length===1,s=b[0][l],v=c[0][l],u=!t&&b[1][l],w=!t&&c[1][l],x,c=function(){!t&&Q(s-u)>20&&(q=h||Q(v-w)/Q(s-u));p=(m-v)/q+s;o=i["plot"+(a?"Width":"Height")]/q};c();b=p;b<C.min?(b=C.min,x=!0):b+o>C.max&&(b=C.max-o,x=!0);x?(v-=0.8*(v-g[j][0]),t||(w-=0.8*(w-g[j][1])),c()):g[j]=[v,w];r||(f[j]=p-m,f[n]=o);f=r?1/q:q;e[n]=o;e[j]=b;d[r?a?"scaleY":
-"scaleX":"scale"+k]=q;d["translate"+k]=f*m+(v-f*s)},pinch:function(a){var b=this,c=b.chart,d=b.pinchDown,e=b.followTouchMove,f=a.touches,g=f.length,h=b.lastValidTouch,i=b.hasZoom,j=b.selectionMarker,k={},l=g===1&&(b.inClass(a.target,"highcharts-tracker")&&c.runTrackerClick||b.runChartClick),n={};(i||e)&&!l&&a.preventDefault();Va(f,function(a){return b.normalize(a)});if(a.type==="touchstart")q(f,function(a,b){d[b]={chartX:a.chartX,chartY:a.chartY}}),h.x=[d[0].chartX,d[1]&&d[1])***^***",
-R"***^***(.chartX],h.y=[d[0].chartY,
-d[1]&&d[1].chartY],q(c.axes,function(a){if(a.zoomEnabled){var b=c.bounds[a.horiz?"h":"v"],d=a.minPixelPadding,e=a.toPixels(p(a.options.min,a.dataMin)),f=a.toPixels(p(a.options.max,a.dataMax)),g=L(e,f),e=t(e,f);b.min=L(a.pos,g-d);b.max=t(a.pos+a.len,e+d)}}),b.res=!0;else if(d.length){if(!j)b.selectionMarker=j=r({destroy:sa},c.plotBox);b.pinchTranslate(d,f,k,j,n,h);b.hasPinched=i;b.scaleGroups(k,n);if(!i&&e&&g===1)this.runPointActions(b.normalize(a));else if(b.res)b.res=!1,this.reset(!1,0)}},onContainerTouchStart:function(a){var b=
-this.chart;pa=b.index;a.touches.length===1?(a=this.normalize(a),b.isInsidePlot(a.chartX-b.plotLeft,a.chartY-b.plotTop)?(this.runPointActions(a),this.pinch(a)):this.reset()):a.touches.length===2&&this.pinch(a)},onContainerTouchMove:function(a){(a.touches.length===1||a.touches.length===2)&&this.pinch(a)},onDocumentTouchEnd:function(a){W[pa]&&W[pa].pointer.drop(a)}});if(G.PointerEvent||G.MSPointerEvent){var ua={},zb=!!G.PointerEvent,Xb=function(){var a,b=[];b.item=function(a){return this[a]};for(a in ua)ua.hasOwnProperty(a)&&
-b.push({pageX:ua[a].pageX,pageY:ua[a].pageY,target:ua[a].target});return b},Ab=function(a,b,c,d){a=a.originalEvent||a;if((a.pointerType==="touch"||a.pointerType===a.MSPOINTER_TYPE_TOUCH)&&W[pa])d(a),d=W[pa].pointer,d[b]({type:c,target:a.currentTarget,preventDefault:sa,touches:Xb()})};r(Wa.prototype,{onContainerPointerDown:function(a){Ab(a,"onContainerTouchStart","touchstart",function(a){ua[a.pointerId]={pageX:a.pageX,pageY:a.pageY,target:a.currentTarget}})},onContainerPointerMove:function(a){Ab(a,
-"onContainerTouchMove","touchmove",function(a){ua[a.pointerId]={pageX:a.pageX,pageY:a.pageY};if(!ua[a.pointerId].target)ua[a.pointerId].target=a.currentTarget})},onDocumentPointerUp:function(a){Ab(a,"onContainerTouchEnd","touchend",function(a){delete ua[a.pointerId]})},batchMSEvents:function(a){a(this.chart.container,zb?"pointerdown":"MSPointerDown",this.onContainerPointerDown);a(this.chart.container,zb?"pointermove":"MSPointerMove",this.onContainerPointerMove);a(x,zb?"pointerup":"MSPointerUp",this.onDocumentPointerUp)}});
-Na(Wa.prototype,"init",function(a,b,c){a.call(this,b,c);(this.hasZoom||this.followTouchMove)&&B(b.container,{"-ms-touch-action":P,"touch-action":P})});Na(Wa.prototype,"setDOMEvents",function(a){a.apply(this);(this.hasZoom||this.followTouchMove)&&this.batchMSEvents(N)});Na(Wa.prototype,"destroy",function(a){this.batchMSEvents(X);a.call(this)})}var lb=K.Legend=function(a,b){this.init(a,b)};lb.prototype={init:function(a,b){var c=this,d=b.itemStyle,e=p(b.padding,8),f=b.itemMarginTop||0;this.options=b;
-if(b.enabled)c.itemStyle=d,c.itemHiddenStyle=w(d,b.itemHiddenStyle),c.itemMarginTop=f,c.padding=e,c.initialItemX=e,c.initialItemY=e-5,c.maxItemWidth=0,c.chart=a,c.itemHeight=0,c.lastLineHeight=0,c.symbolWidth=p(b.symbolWidth,16),c.pages=[],c.render(),N(c.chart,"endResize",function(){c.positionCheckboxes()})},colorizeItem:function(a,b){var c=this.options,d=a.legendItem,e=a.legendLine,f=a.legendSymbol,g=this.itemHiddenStyle.color,c=b?c.itemStyle.color:g,h=b?a.legendColor||a.color||"#CCC":g,g=a.options&&
-a.options.marker,i={fill:h},j;d&&d.css({fill:c,color:c});e&&e.attr({stroke:h});if(f){if(g&&f.isMarker)for(j in i.stroke=h,g=a.convertAttribs(g),g)d=g[j],d!==u&&(i[j]=d);f.attr(i)}},positionItem:function(a){var b=this.options,c=b.symbolPadding,b=!b.rtl,d=a._legendItemPos,e=d[0],d=d[1],f=a.checkbox;a.legendGroup&&a.legendGroup.translate(b?e:this.legendWidth-e-2*c-4,d);if(f)f.x=e,f.y=d},destroyItem:function(a){var b=a.checkbox;q(["legendItem","legendLine","legendSymbol","legendGroup"],function(b){a[b]&&
-(a[b]=a[b].destroy())});b&&Qa(a.checkbox)},destroy:function(){var a=this.group,b=this.box;if(b)this.box=b.destroy();if(a)this.group=a.destroy()},positionCheckboxes:function(a){var b=this.group.alignAttr,c,d=this.clipHeight||this.legendHeight;if(b)c=b.translateY,q(this.allItems,function(e){var f=e.checkbox,g;f&&(g=c+f.y+(a||0)+3,B(f,{left:b.translateX+e.checkboxOffset+f.x-20+"px",top:g+"px",display:g>c-6&&g<c+d-6?"":P}))})},renderTitle:function(){var a=this.padding,b=this.options.title,c=0;if(b.text){if(!this.title)this.title=
-this.chart.renderer.label(b.text,a-3,a-4,null,null,null,null,null,"legend-title").attr({zIndex:1}).css(b.style).add(this.group);a=this.title.getBBox();c=a.height;this.offsetWidth=a.width;this.contentGroup.attr({translateY:c})}this.titleHeight=c},renderItem:function(a){var b=this.chart,c=b.renderer,d=this.options,e=d.layout==="horizontal",f=this.symbolWidth,g=d.symbolPadding,h=this.itemStyle,i=this.itemHiddenStyle,j=this.padding,k=e?p(d.itemDistance,20):0,l=!d.rtl,n=d.width,m=d.itemMarginBottom||0,
-o=this.itemMarginTop,q=this.initialItemX,r=a.legendItem,s=a.series&&a.series.drawLegendSymbol?a.series:a,C=s.options,C=this.createCheckboxForItem&&C&&C.showCheckbox,u=d.useHTML;if(!r){a.legendGroup=c.g("legend-item").attr({zIndex:1}).add(this.scrollGroup);a.legendItem=r=c.text(d.labelFormat?Ja(d.labelFormat,a):d.labelFormatter.call(a),l?f+g:-g,this.baseline||0,u).css(w(a.visible?h:i)).attr({align:l?"left":"right",zIndex:2}).add(a.legendGroup);if(!this.baseline)this.baseline=c.fontMetrics(h.fontSize,
-r).f+3+o,r.attr("y",this.baseline);s.drawLegendSymbol(this,a);this.setItemEvents&&this.setItemEvents(a,r,u,h,i);this.colorizeItem(a,a.visible);C&&this.createCheckboxForItem(a)}c=r.getBBox();f=a.checkboxOffset=d.itemWidth||a.legendItemWidth||f+g+c.width+k+(C?20:0);this.itemHeight=g=v(a.legendItemHeight||c.height);if(e&&this.itemX-q+f>(n||b.chartWidth-2*j-q-d.x))this.itemX=q,this.itemY+=o+this.lastLineHeight+m,this.lastLineHeight=0;this.maxItemWidth=t(this.maxItemWidth,f);this.lastItemY=o+this.itemY+
+  // How much of the variance of the sample is caused by outliers
+  const OutlierVariance &outlier_variance() const { return outlier_variance_; }
+
+  // The number of resamples which were actually used, which may be less than
+  // VeloxConfig::num_resamples with adaptive resampling
+  std::uint32_t num_resamples() const { return num_resamples_; }
+
+  // Whether every measurement ran the same number of iterations.  The regression statistics are
+  // meaningless then: LLS and slope reduce to the mean of the measurements' times per iteration,
+  // the overhead is 0 and r^2 is 0.
+  bool flat_sampling() const { return flat_sampling_; }
+
+  // Whether the intervals are quick mode's analytic approximations rather than bootstrapped, in
+  // which case num_resamples is 0
+  bool analytic() const { return analytic_; }
+
+  // The statistics added with VeloxConfig::add_statistic, in the order they were added
+  const std::vector<CustomEstimate> &custom() const { return custom_; }
+
+private:
+  EstimateAndDistribution<FpNs> mean_;
+  EstimateAndDistribution<FpNs> median_;
+  EstimateAndDistribution<FpNs> std_dev_;
+  EstimateAndDistribution<FpNs> median_abs_dev_;
+  EstimateAndDistribution<FpNs> linear_least_squares_;
+  EstimateAndDistribution<double> r_squared_;
+  EstimateAndDistribution<FpNs> slope_;
+  EstimateAndDistribution<FpNs> overhead_;
+  OutlierVariance outlier_variance_;
+  std::uint32_t num_resamples_;
+  bool flat_sampling_;
+  bool analytic_;
+  std::vector<CustomEstimate> custom_;
+};
+
+template <template <class> class D, class T, class S, class F>
+void
+resample(const std::vector<T> &sample, const std::uint32_t num_resamples, const S seed, F &&f) {
+  std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+  D<std::size_t> distribution(0, sample.size() - 1);
+  auto resample = sample;
+
+  for (std::uint32_t i = 0; i < num_resamples; ++i) {
+    std::generate(resample.begin(), resample.end(), [&] { return sample[distribution(rng)]; });
+
+    f(resample);
+  }
+}
+
+// Resamples blocks of consecutive values so the resamples keep the autocorrelation of the sample.
+// Blocks wrap around at the end of the sample.
+template <template <class> class D, class T, class S, class F>
+void resample_blocks(const std::vector<T> &sample,
+                     const std::uint32_t num_resamples,
+                     const S seed,
+                     const ResampleMethod method,
+                     const double block_length,
+                     F &&f) {
+  assert(block_length >= 1.0 && "Block length must be at least 1");
+
+  std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+  D<std::size_t> distribution(0, sample.size() - 1);
+  std::geometric_distribution<std::size_t> extra_length(1.0 / block_length);
+
+  const auto n = sample.size();
+  const auto fixed_length = static_cast<std::size_t>(std::round(block_length));
+  auto resample = sample;
+
+  for (std::uint32_t i = 0; i < num_resamples; ++i) {
+    std::size_t pos = 0, left_in_block = 0;
+
+    for (auto &r : resample) {
+      if (left_in_block == 0) {
+        pos = distribution(rng);
+        left_in_block =
+            method == ResampleMethod::stationary ? 1 + extra_length(rng) : fixed_length;
+      }
+
+      r = sample[pos];
+      pos = pos + 1 == n ? 0 : pos + 1;
+      --left_in_block;
+    }
+
+    f(resample);
+  }
+}
+
+template <template <class> class D, class T, class S, class F>
+void resample(const std::vector<T> &sample,
+              const std::uint32_t num_resamples,
+              const S seed,
+              const ResampleMethod method,
+              const double block_length,
+              F &&f) {
+  switch (method) {
+  case ResampleMethod::iid:
+    break;
+  case ResampleMethod::moving_block:
+  case ResampleMethod::stationary:
+    if (block_length > 1.0) {
+      resample_blocks<D>(sample, num_resamples, seed, method, block_length, std::forward<F>(f));
+      return;
+    }
+    break;
+  }
+
+  resample<D>(sample, num_resamples, seed, std::forward<F>(f));
+}
+
+// The outlier variance is passed in so it can describe the whole sample when the statistics are
+// estimated from what apply_outlier_policy left of it
+template <template <class> class D = std::uniform_int_distribution>
+inline EstimatedStatistics estimate_statistics(const Measurements &measurements,
+                                               const Times &times,
+                                               const SampleSummary &summary,
+                                               const VeloxConfig &config,
+                                               const OutlierVariance &outlier_variance) {
+  const auto max_resamples = config.num_resamples();
+  const auto method = config.resample_method();
+  const auto block_length = config.block_length() > 0.0 ? config.block_length()
+                                                        : optimal_block_length(times, method);
+
+  BootstrapDistribution<FpNs> means(config), medians(config), std_devs(config), mads(config);
+
+  const auto points = measurements_to_points(measurements);
+  BootstrapDistribution<FpNs> lls(config);
+  BootstrapDistribution<double> r2s(config);
+  BootstrapDistribution<FpNs> slopes(config), overheads(config);
+
+  auto mad_buffer = vector_with_capacity<double>(times.size());
+
+  const auto &sorted_sample = summary.sorted();
+  const FpRange r(sorted_sample);
+  const auto mean_point = summary.mean();
+  const auto median_point = summary.median();
+  const auto std_dev_point = summary.std_dev();
+  const auto mad_point = FpNs{median_abs_dev_of_sorted_destructive(r, mad_buffer)};
+
+  const auto flat = is_flat(measurements);
+
+  const auto regression = config.regression_method();
+  const auto lls_point = FpNs{fit_slope(points, regression)};
+  const auto r2_point = r_squared(points, lls_point.count());
+  const auto line = fit_line(points, regression);
+  const auto slope_point = FpNs{line.slope()};
+  const auto overhead_point = FpNs{line.intercept()};
+
+  // Leaving a value out of a sorted sample leaves it sorted so the jackknife can use the
+  // *_of_sorted functions
+  const auto jackknife = [&sorted_sample](double (*f)(const Times &)) {
+    return [&sorted_sample, f] { return jackknife_acceleration(sorted_sample, f); };
+  };
+
+  const auto mean_acceleration =
+      jackknife([](const Times &s) -> double { return mean(FpRange(s)); });
+  const auto median_acceleration =
+      jackknife([](const Times &s) -> double { return median_of_sorted(FpRange(s)); });
+  const auto std_dev_acceleration =
+      jackknife([](const Times &s) -> double { return std_dev(FpRange(s)); });
+  const auto mad_acceleration = jackknife([](const Times &s) -> double {
+    std::vector<double> buffer;
+    return median_abs_dev_of_sorted_destructive(FpRange(s), buffer);
+  });
+  const auto lls_acceleration = [&points, regression] {
+    return jackknife_acceleration(
+        points, [regression](const Points &ps) { return fit_slope(ps, regression); });
+  };
+  const auto r2_acceleration = [&points, regression] {
+    return jackknife_acceleration(points, [regression](const Points &ps) {
+      return r_squared(ps, fit_slope(ps, regression));
+    });
+  };
+  const auto slope_acceleration = [&points, regression] {
+    return jackknife_acceleration(
+        points, [regression](const Points &ps) { return fit_line(ps, regression).slope(); });
+  };
+  const auto overhead_acceleration = [&points, regression] {
+    return jackknife_acceleration(
+        points, [regression](const Points &ps) { return fit_line(ps, regression).intercept(); });
+  };
+
+  const auto &customs = config.statistics();
+  auto custom_points = vector_with_capacity<double>(customs.size());
+  std::vector<BootstrapDistribution<double>> custom_distributions;
+  std::vector<std::function<double()>> custom_accelerations;
+  for (const auto &c : customs) {
+    custom_points.push_back(c(sorted_sample));
+    custom_distributions.emplace_back(config);
+    custom_accelerations.emplace_back(
+        [&sorted_sample, &c] { return jackknife_acceleration(sorted_sample, c); });
+  }
+
+  const auto seed = std::random_device{}();
+
+  // Without adaptive resampling everything is done in a single chunk
+  const auto chunk_size =
+      config.adaptive_resampling() ? (std::min)(config.resample_chunk_size(), max_resamples)
+                                   : max_resamples;
+  ConvergenceCheck convergence(config.resample_tolerance());
+  std::uint32_t num_resamples = 0;
+
+  for (std::uint32_t chunk = 0; num_resamples < max_resamples; ++chunk) {
+    const auto n = (std::min)(chunk_size, max_resamples - num_resamples);
+    const auto chunk_seed = seed + chunk;
+
+    auto sorted_stat_calcs = std::async(std::launch::async, [&] {
+      resample<D>(times, n, chunk_seed, method, block_length, [&](Times &s) {
+        std::sort(s.begin(), s.end());
+        FpRange sr(s);
+
+        for (std::size_t i = 0; i < customs.size(); ++i) {
+          custom_distributions[i].add(customs[i](s));
+        }
+
+        medians.add(FpNs(median_of_sorted(sr)));
+        mads.add(FpNs(median_abs_dev_of_sorted_destructive(sr, mad_buffer)));
+      });
+    });
+
+    auto stat_calcs = std::async(std::launch::async, [&] {
+      resample<D>(times, n, chunk_seed, method, block_length, [&](const Times &s) {
+        FpRange sr(s);
+        means.add(FpNs(mean(sr)));
+        std_devs.add(FpNs(std_dev(sr)));
+      });
+    });
+
+    resample<D>(points, n, chunk_seed, method, block_length, [&](const Points &ps) {
+      const auto s = fit_slope(ps, regression);
+      lls.add(FpNs{s});
+      r2s.add(r_squared(ps, s));
+
+      const auto l = fit_line(ps, regression);
+      slopes.add(FpNs{l.slope()});
+      overheads.add(FpNs{l.intercept()});
+    });
+
+    sorted_stat_calcs.get();
+    stat_calcs.get();
+
+    num_resamples += n;
+
+    if (num_resamples >= max_resamples || num_resamples < config.min_resamples()) {
+      continue;
+    }
+
+    convergence.add(means.estimate(mean_point, mean_acceleration));
+    convergence.add(medians.estimate(median_point, median_acceleration));
+    convergence.add(std_devs.estimate(std_dev_point, std_dev_acceleration));
+    convergence.add(mads.estimate(mad_point, mad_acceleration));
+    convergence.add(lls.estimate(lls_point, lls_acceleration));
+    convergence.add(r2s.estimate(r2_point, r2_acceleration));
+    convergence.add(slopes.estimate(slope_point, slope_acceleration));
+    convergence.add(overheads.estimate(overhead_point, overhead_acceleration));
+    for (std::size_t i = 0; i < customs.size(); ++i) {
+      convergence.add(custom_distributions[i].estimate(custom_points[i], custom_accelerations[i]));
+    }
+
+    if (convergence.converged()) {
+      break;
+    }
+  }
+
+  auto custom_estimates = vector_with_capacity<CustomEstimate>(customs.size());
+  for (std::size_t i = 0; i < customs.size(); ++i) {
+    custom_estimates.emplace_back(
+        customs[i], custom_distributions[i].finish(custom_points[i], custom_accelerations[i]));
+  }
+
+  return EstimatedStatistics(means.finish(mean_point, mean_acceleration),
+                             medians.finish(median_point, median_acceleration),
+                             std_devs.finish(std_dev_point, std_dev_acceleration),
+                             mads.finish(mad_point, mad_acceleration),
+                             lls.finish(lls_point, lls_acceleration),
+                             r2s.finish(r2_point, r2_acceleration),
+                             slopes.finish(slope_point, slope_acceleration),
+                             overheads.finish(overhead_point, overhead_acceleration),
+                             outlier_variance,
+                             num_resamples,
+                             flat,
+                             false,
+                             std::move(custom_estimates));
+}
+
+template <template <class> class D = std::uniform_int_distribution>
+inline EstimatedStatistics estimate_statistics(const Measurements &measurements,
+                                               const Times &times,
+                                               const SampleSummary &summary,
+                                               const VeloxConfig &config) {
+  return estimate_statistics<D>(measurements, times, summary, config, OutlierVariance(summary));
+}
+
+template <template <class> class D = std::uniform_int_distribution>
+inline EstimatedStatistics estimate_statistics(const Measurements &measurements,
+                                               const Times &times,
+                                               const VeloxConfig &config) {
+  return estimate_statistics<D>(measurements, times, SampleSummary(times), config);
+}
+
+template <template <class> class D = std::uniform_int_distribution>
+inline EstimatedStatistics estimate_statistics(const Measurements &measurements,
+                                               const Times &times,
+                                               const std::uint32_t num_resamples,
+                                               const double cl) {
+  return estimate_statistics<D>(
+      measurements, times, VeloxConfig().num_resamples(num_resamples).confidence_level(cl));
+}
+}
+
+namespace velox {
+
+template <class D>
+struct ItersForDuration {
+  ItersForDuration(const std::uint64_t iterations, const D d) : iters_(iterations), duration_(d) {}
+
+  std::uint64_t iters() const { return iters_; }
+
+  D duration() const { return duration_; }
+
+private:
+  std::uint64_t iters_;
+  D duration_;
+};
+
+using ItersForDurationNs = ItersForDuration<Ns>;
+}
+
+#include <complex>
+#include <cstring>
+
+namespace velox {
+
+namespace {
+  const std::uint32_t DEFAULT_KDE_POINTS = 400;
+
+  // kde picks kde_exact when times.size() * num_points is at most this
+  const std::uint64_t KDE_EXACT_MAX_WORK = 1 << 17;
+
+  // and kde_binned once there are at least this many times, kde_truncated otherwise
+  const std::size_t KDE_BINNED_MIN_SIZE = 10000;
+
+  // Kernels are treated as 0 beyond this many bandwidths, where they are below 1e-14
+  const double KDE_TRUNCATION = 8.0;
+
+  // The grid used by kde_binned is at least this fine, up to KDE_MAX_GRID_SIZE points
+  const double KDE_BINS_PER_BANDWIDTH = 8.0;
+  const std::size_t KDE_MAX_GRID_SIZE = 1 << 16;
+}
+
+inline double snpdf(const double x) {
+  // Don't require users to #define _USE_MATH_DEFINES when using msvc so ...
+  const auto PI = 3.14159265358979323846;
+  return std::exp(-x * x / 2.0) / std::sqrt(2.0 * PI);
+}
+
+template <class F>
+void linspace(const double start, const double stop, const std::uint32_t n, F &&f) {
+  if (n == 0) {
+    return;
+  } else if (n == 1) {
+    f(start);
+    return;
+  }
+
+  const auto step = (stop - start) / static_cast<double>(n - 1);
+
+  for (std::uint32_t i = 0; i < n - 1; ++i) {
+    f(i * step + start);
+  }
+
+  f(stop);
+}
+
+inline double bandwidth_scott(const SampleSummary &summary) {
+  const auto sd = summary.std_dev().count();
+  const auto adjusted_iqr = summary.quartiles().iqr().count() / 1.34;
+  return 1.06 * (std::min)(sd, adjusted_iqr) * std::pow(static_cast<double>(summary.size()), -.2);
+}
+
+inline double bandwidth_scott(const Times &times) {
+  return bandwidth_scott(SampleSummary(times));
+}
+
+namespace detail {
+  // The range the density is evaluated over, shared by every kde implementation
+  struct KdeRange {
+    KdeRange(const SampleSummary &summary) : bw_(bandwidth_scott(summary)) {
+      const auto adjustment = 3.0;
+      start_ = summary.min().count() - adjustment * bw_;
+      stop_ = summary.max().count() + adjustment * bw_;
+    }
+
+    double bandwidth() const { return bw_; }
+
+    double start() const { return start_; }
+
+    double stop() const { return stop_; }
+
+  private:
+    double bw_;
+    double start_;
+    double stop_;
+  };
+
+  // exp(x) for -700 <= x <= 0 without branches or calls into libm so loops over it vectorise.
+  // The relative error is about 1e-14.
+  inline double exp_nonpositive(const double x) {
+    const auto log2e = 1.4426950408889634;
+    const auto ln2_hi = 6.93147180369123816490e-01;
+    const auto ln2_lo = 1.90821492927058770002e-10;
+
+    const auto clamped = (std::max)(x, -700.0);
+
+    // x = k ln(2) + r with |r| <= ln(2) / 2.  Truncating rounds towards 0 so subtracting .5
+    // rounds to the nearest integer for x <= 0.
+    const auto k = static_cast<std::int64_t>(clamped * log2e - 0.5);
+    const auto kd = static_cast<double>(k);
+    const auto r = (clamped - kd * ln2_hi) - kd * ln2_lo;
+
+    // Taylor series, the first omitted term is below 1e-14
+    auto p = 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+
+    // 2^k built directly from its exponent bits
+    const auto bits = static_cast<std::uint64_t>(k + 1023) << 52;
+    double scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+
+    return p * scale;
+  }
+
+  // In place iterative radix-2 FFT, data.size() must be a power of 2
+  inline void fft(std::vector<std::complex<double>> &data, const bool inverse) {
+    const auto n = data.size();
+    assert(n && (n & (n - 1)) == 0 && "FFT size must be a power of 2");
+
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+      auto bit = n >> 1;
+      for (; j & bit; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
+
+      if (i < j) {
+        std::swap(data[i], data[j]);
+      }
+    }
+
+    const auto PI = 3.14159265358979323846;
+    for (std::size_t len = 2; len <= n; len <<= 1) {
+      const auto angle = (inverse ? 2.0 : -2.0) * PI / static_cast<double>(len);
+      const std::complex<double> step(std::cos(angle), std::sin(angle));
+
+      for (std::size_t i = 0; i < n; i += len) {
+        std::complex<double> w(1.0, 0.0);
+        for (std::size_t j = 0; j < len / 2; ++j) {
+          const auto u = data[i + j];
+          const auto v = data[i + j + len / 2] * w;
+          data[i + j] = u + v;
+          data[i + j + len / 2] = u - v;
+          w *= step;
+        }
+      }
+    }
+
+    if (inverse) {
+      for (auto &d : data) {
+        d /= static_cast<double>(n);
+      }
+    }
+  }
+}
+
+// The kernels are evaluated for every pair of time and output point
+inline Points kde_exact(const SampleSummary &summary, const std::uint32_t num_points) {
+  const auto &times = summary.sorted();
+  const auto n = static_cast<double>(times.size());
+  const detail::KdeRange range(summary);
+  const auto bw = range.bandwidth();
+
+  const auto kde_calc = [&times, &n, &bw](double x) -> double {
+    double sum = 0.0;
+    for (const auto &t : times) {
+      sum += snpdf((x - t.count()) / bw);
+    }
+
+    return sum / n / bw;
+  };
+
+  auto points = vector_with_capacity<Point>(num_points);
+
+  linspace(range.start(), range.stop(), num_points, [&kde_calc, &points](double x) {
+    points.emplace_back(x, kde_calc(x));
+  });
+
+  return points;
+}
+
+// Sorts the times so each output point only evaluates the kernels of the times within
+// KDE_TRUNCATION bandwidths of it, using detail::exp_nonpositive over the window
+inline Points kde_truncated(const SampleSummary &summary, const std::uint32_t num_points) {
+  const detail::KdeRange range(summary);
+  const auto bw = range.bandwidth();
+  if (!(bw > 0.0)) {
+    return kde_exact(summary, num_points);
+  }
+
+  const auto &sorted = summary.sorted();
+
+  const auto PI = 3.14159265358979323846;
+  const auto norm = 1.0 / std::sqrt(2.0 * PI) / static_cast<double>(sorted.size()) / bw;
+  const auto cutoff = KDE_TRUNCATION * bw;
+  const auto recip_bw = 1.0 / bw;
+
+  std::size_t lo = 0, hi = 0;
+  auto points = vector_with_capacity<Point>(num_points);
+
+  linspace(range.start(), range.stop(), num_points, [&](double x) {
+    while (lo < sorted.size() && sorted[lo].count() < x - cutoff) {
+      ++lo;
+    }
+    hi = (std::max)(hi, lo);
+    while (hi < sorted.size() && sorted[hi].count() <= x + cutoff) {
+      ++hi;
+    }
+
+    double sum = 0.0;
+    for (auto i = lo; i < hi; ++i) {
+      const auto z = (x - sorted[i].count()) * recip_bw;
+      sum += detail::exp_nonpositive(-0.5 * z * z);
+    }
+
+    points.emplace_back(x, sum * norm);
+  });
+
+  return points;
+}
+
+// Linearly bins the times onto a grid at least KDE_BINS_PER_BANDWIDTH times finer than the
+// bandwidth which contains the output points, then convolves the bin counts with the kernel
+// using an FFT.  The cost no longer depends on the product of the number of times and points.
+inline Points kde_binned(const SampleSummary &summary, const std::uint32_t num_points) {
+  const detail::KdeRange range(summary);
+  const auto bw = range.bandwidth();
+  if (!(bw > 0.0) || num_points < 2) {
+    return kde_exact(summary, num_points);
+  }
+
+  const auto &times = summary.sorted();
+
+  const auto start = range.start(), stop = range.stop();
+  const auto intervals = static_cast<std::size_t>(num_points - 1);
+
+  // Every output point is a grid point
+  const auto step_per_point = (stop - start) / static_cast<double>(intervals);
+  const auto max_refinement = (std::max)(KDE_MAX_GRID_SIZE / intervals, std::size_t(1));
+  const auto refinement = (std::min)(
+      static_cast<std::size_t>(std::ceil(step_per_point / (bw / KDE_BINS_PER_BANDWIDTH))),
+      max_refinement);
+  const auto grid_size = intervals * (std::max)(refinement, std::size_t(1)) + 1;
+  const auto delta = (stop - start) / static_cast<double>(grid_size - 1);
+
+  // Kernel values beyond KDE_TRUNCATION bandwidths are negligible
+  const auto kernel_radius = (std::min)(
+      static_cast<std::size_t>(std::ceil(KDE_TRUNCATION * bw / delta)), grid_size - 1);
+
+  std::size_t fft_size = 1;
+  while (fft_size < grid_size + kernel_radius) {
+    fft_size <<= 1;
+  }
+
+  std::vector<std::complex<double>> bins(fft_size), kernel(fft_size);
+
+  for (const auto &t : times) {
+    const auto pos = (t.count() - start) / delta;
+    const auto i = (std::min)(static_cast<std::size_t>((std::max)(pos, 0.0)), grid_size - 2);
+    const auto f = (std::min)((std::max)(pos - static_cast<double>(i), 0.0), 1.0);
+    bins[i] += 1.0 - f;
+    bins[i + 1] += f;
+  }
+
+  for (std::size_t j = 0; j <= kernel_radius; ++j) {
+    const auto k = snpdf(static_cast<double>(j) * delta / bw);
+    kernel[j] = k;
+    if (j) {
+      kernel[fft_size - j] = k;
+    }
+  }
+
+  detail::fft(bins, false);
+  detail::fft(kernel, false);
+  for (std::size_t i = 0; i < fft_size; ++i) {
+    bins[i] *= kernel[i];
+  }
+  detail::fft(bins, true);
+
+  const auto norm = 1.0 / static_cast<double>(times.size()) / bw;
+  const auto grid_step = (grid_size - 1) / intervals;
+
+  auto points = vector_with_capacity<Point>(num_points);
+  std::size_t i = 0;
+  linspace(start, stop, num_points, [&](double x) {
+    // Rounding in the FFT can leave tiny negative densities far from the data
+    points.emplace_back(x, (std::max)(bins[i * grid_step].real() * norm, 0.0));
+    ++i;
+  });
+
+  return points;
+}
+
+// Picks the kde implementation by the amount of work the exact one would do
+inline Points kde(const SampleSummary &summary, const std::uint32_t num_points) {
+  const auto work = std::uint64_t{summary.size()} * num_points;
+
+  if (work <= KDE_EXACT_MAX_WORK) {
+    return kde_exact(summary, num_points);
+  } else if (summary.size() < KDE_BINNED_MIN_SIZE) {
+    return kde_truncated(summary, num_points);
+  }
+
+  return kde_binned(summary, num_points);
+}
+
+inline Points kde_exact(const Times &times, const std::uint32_t num_points) {
+  return kde_exact(SampleSummary(times), num_points);
+}
+
+inline Points kde_truncated(const Times &times, const std::uint32_t num_points) {
+  return kde_truncated(SampleSummary(times), num_points);
+}
+
+inline Points kde_binned(const Times &times, const std::uint32_t num_points) {
+  return kde_binned(SampleSummary(times), num_points);
+}
+
+inline Points kde(const Times &times, const std::uint32_t num_points) {
+  return kde(SampleSummary(times), num_points);
+}
+}
+
+#include <cstdio>
+
+namespace velox {
+
+namespace {
+  // Enough for any double written by write_shortest or write_fixed
+  const std::size_t DOUBLE_BUFFER_SIZE = 352;
+}
+
+namespace detail {
+  // A floating point number f * 2^e with a 64-bit significand, from Loitsch's "Printing
+  // Floating-Point Numbers Quickly and Accurately with Integers" (2010)
+  struct DiyFp {
+    DiyFp(const std::uint64_t f_, const int e_) : f(f_), e(e_) {}
+
+    // The product, with the low 64 bits of the significand rounded away
+    static DiyFp mul(const DiyFp &x, const DiyFp &y) {
+      const auto x_lo = x.f & 0xFFFFFFFFu, x_hi = x.f >> 32;
+      const auto y_lo = y.f & 0xFFFFFFFFu, y_hi = y.f >> 32;
+
+      const auto p0 = x_lo * y_lo, p1 = x_lo * y_hi, p2 = x_hi * y_lo, p3 = x_hi * y_hi;
+
+      auto q = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+      q += std::uint64_t(1) << 31;
+
+      return DiyFp(p3 + (p2 >> 32) + (p1 >> 32) + (q >> 32), x.e + y.e + 64);
+    }
+
+    static DiyFp normalize(DiyFp x) {
+      while ((x.f >> 63) == 0) {
+        x.f <<= 1;
+        --x.e;
+      }
+      return x;
+    }
+
+    std::uint64_t f;
+    int e;
+  };
+
+  // A double along with the midpoints between it and its neighbours, all normalized to the
+  // exponent of the upper midpoint
+  struct Boundaries {
+    Boundaries(const double value) : w(0, 0), minus(0, 0), plus(0, 0) {
+      const std::uint64_t hidden_bit = std::uint64_t(1) << 52;
+      const int bias = 1023 + 52;
+
+      std::uint64_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(bits));
+
+      const auto biased_e = static_cast<int>(bits >> 52);
+      const auto fraction = bits & (hidden_bit - 1);
+
+      const auto v = biased_e == 0 ? DiyFp(fraction, 1 - bias)
+                                   : DiyFp(fraction + hidden_bit, biased_e - bias);
+
+      // The gap below a power of two is half the gap above it
+      const auto lower_is_closer = fraction == 0 && biased_e > 1;
+
+      plus = DiyFp::normalize(DiyFp(2 * v.f + 1, v.e - 1));
+
+      const auto m_minus =
+          lower_is_closer ? DiyFp(4 * v.f - 1, v.e - 2) : DiyFp(2 * v.f - 1, v.e - 1);
+      minus = DiyFp(m_minus.f << (m_minus.e - plus.e), plus.e);
+
+      w = DiyFp::normalize(v);
+    }
+
+    DiyFp w;
+    DiyFp minus;
+    DiyFp plus;
+  };
+
+  // The scaled products must have binary exponents in [ALPHA, GAMMA] so their integral parts
+  // fit in 32 bits
+  const int ALPHA = -60;
+  const int GAMMA = -32;
+
+  struct CachedPower {
+    std::uint64_t f;
+    int e;
+    int k;
+  };
+
+  // 10^k normalized to a 64-bit significand and binary exponent for a suitable k
+  inline CachedPower cached_power_for_binary_exponent(const int e) {
+    // 10^k for k = -300, -292, ..., 324
+    static const CachedPower powers[] = {
+        {0xAB70FE17C79AC6CA, -1060, -300},
+        {0xFF77B1FCBEBCDC4F, -1034, -292},
+        {0xBE5691EF416BD60C, -1007, -284},
+        {0x8DD01FAD907FFC3C, -980, -276},
+        {0xD3515C2831559A83, -954, -268},
+        {0x9D71AC8FADA6C9B5, -927, -260},
+        {0xEA9C227723EE8BCB, -901, -252},
+        {0xAECC49914078536D, -874, -244},
+        {0x823C12795DB6CE57, -847, -236},
+        {0xC21094364DFB5637, -821, -228},
+        {0x9096EA6F3848984F, -794, -220},
+        {0xD77485CB25823AC7, -768, -212},
+        {0xA086CFCD97BF97F4, -741, -204},
+        {0xEF340A98172AACE5, -715, -196},
+        {0xB23867FB2A35B28E, -688, -188},
+        {0x84C8D4DFD2C63F3B, -661, -180},
+        {0xC5DD44271AD3CDBA, -635, -172},
+        {0x936B9FCEBB25C996, -608, -164},
+        {0xDBAC6C247D62A584, -582, -156},
+        {0xA3AB66580D5FDAF6, -555, -148},
+        {0xF3E2F893DEC3F126, -529, -140},
+        {0xB5B5ADA8AAFF80B8, -502, -132},
+        {0x87625F056C7C4A8B, -475, -124},
+        {0xC9BCFF6034C13053, -449, -116},
+        {0x964E858C91BA2655, -422, -108},
+        {0xDFF9772470297EBD, -396, -100},
+        {0xA6DFBD9FB8E5B88F, -369, -92},
+        {0xF8A95FCF88747D94, -343, -84},
+        {0xB94470938FA89BCF, -316, -76},
+        {0x8A08F0F8BF0F156B, -289, -68},
+        {0xCDB02555653131B6, -263, -60},
+        {0x993FE2C6D07B7FAC, -236, -52},
+        {0xE45C10C42A2B3B06, -210, -44},
+        {0xAA242499697392D3, -183, -36},
+        {0xFD87B5F28300CA0E, -157, -28},
+        {0xBCE5086492111AEB, -130, -20},
+        {0x8CBCCC096F5088CC, -103, -12},
+        {0xD1B71758E219652C, -77, -4},
+        {0x9C40000000000000, -50, 4},
+        {0xE8D4A51000000000, -24, 12},
+        {0xAD78EBC5AC620000, 3, 20},
+        {0x813F3978F8940984, 30, 28},
+        {0xC097CE7BC90715B3, 56, 36},
+        {0x8F7E32CE7BEA5C70, 83, 44},
+        {0xD5D238A4ABE98068, 109, 52},
+        {0x9F4F2726179A2245, 136, 60},
+        {0xED63A231D4C4FB27, 162, 68},
+        {0xB0DE65388CC8ADA8, 189, 76},
+        {0x83C7088E1AAB65DB, 216, 84},
+        {0xC45D1DF942711D9A, 242, 92},
+        {0x924D692CA61BE758, 269, 100},
+        {0xDA01EE641A708DEA, 295, 108},
+        {0xA26DA3999AEF774A, 322, 116},
+        {0xF209787BB47D6B85, 348, 124},
+        {0xB454E4A179DD1877, 375, 132},
+        {0x865B86925B9BC5C2, 402, 140},
+        {0xC83553C5C8965D3D, 428, 148},
+        {0x952AB45CFA97A0B3, 455, 156},
+        {0xDE469FBD99A05FE3, 481, 164},
+        {0xA59BC234DB398C25, 508, 172},
+        {0xF6C69A72A3989F5C, 534, 180},
+        {0xB7DCBF5354E9BECE, 561, 188},
+        {0x88FCF317F22241E2, 588, 196},
+        {0xCC20CE9BD35C78A5, 614, 204},
+        {0x98165AF37B2153DF, 641, 212},
+        {0xE2A0B5DC971F303A, 667, 220},
+        {0xA8D9D1535CE3B396, 694, 228},
+        {0xFB9B7CD9A4A7443C, 720, 236},
+        {0xBB764C4CA7A44410, 747, 244},
+        {0x8BAB8EEFB6409C1A, 774, 252},
+        {0xD01FEF10A657842C, 800, 260},
+        {0x9B10A4E5E9913129, 827, 268},
+        {0xE7109BFBA19C0C9D, 853, 276},
+        {0xAC2820D9623BF429, 880, 284},
+        {0x80444B5E7AA7CF85, 907, 292},
+        {0xBF21E44003ACDD2D, 933, 300},
+        {0x8E679C2F5E44FF8F, 960, 308},
+        {0xD433179D9C8CB841, 986, 316},
+        {0x9E19DB92B4E31BA9, 1013, 324},
+    };
+
+    const int min_decimal_exponent = -300, decimal_step = 8;
+
+    // k = ceil((ALPHA - e - 1) * log10(2))
+    const auto f = ALPHA - e - 1;
+    const auto k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0);
+
+    const auto index = static_cast<std::size_t>(
+        (-min_decimal_exponent + k + (decimal_step - 1)) / decimal_step);
+    assert(index < sizeof(powers) / sizeof(powers[0]) && "Exponent is out of range");
+
+    const auto &cached = powers[index];
+    assert(ALPHA <= cached.e + e + 64 && cached.e + e + 64 <= GAMMA && "Bad cached power");
+    return cached;
+  }
+
+  inline std::uint32_t largest_power_of_ten_not_above(const std::uint32_t n, int &digits) {
+    std::uint32_t p = 1;
+    digits = 1;
+    while (digits < 10 && n / 10 >= p) {
+      p *= 10;
+      ++digits;
+    }
+    return p;
+  }
+
+  // Moves the last digit towards w while the result stays within the rounding interval
+  inline void grisu2_round(char *const buffer,
+                           const std::size_t length,
+                           const std::uint64_t dist,
+                           const std::uint64_t delta,
+                           std::uint64_t rest,
+                           const std::uint64_t ten_k) {
+    while (rest < dist && delta - rest >= ten_k &&
+           (rest + ten_k < dist || dist - rest > rest + ten_k - dist)) {
+      --buffer[length - 1];
+      rest += ten_k;
+    }
+  }
+
+  // Generates the shortest digits of a number in [m_minus, m_plus] closest to w
+  inline void grisu2_digits(char *const buffer,
+                            std::size_t &length,
+                            int &decimal_exponent,
+                            const DiyFp &m_minus,
+                            const DiyFp &w,
+                            const DiyFp &m_plus) {
+    auto delta = m_plus.f - m_minus.f;
+    auto dist = m_plus.f - w.f;
+
+    const auto shift = static_cast<unsigned>(-m_plus.e);
+    const auto one = std::uint64_t(1) << shift;
+
+    auto p1 = static_cast<std::uint32_t>(m_plus.f >> shift);
+    auto p2 = m_plus.f & (one - 1);
+
+    int n = 0;
+    auto pow10 = largest_power_of_ten_not_above(p1, n);
+
+    while (n > 0) {
+      buffer[length++] = static_cast<char>('0' + p1 / pow10);
+      p1 %= pow10;
+      --n;
+
+      const auto rest = (std::uint64_t(p1) << shift) + p2;
+      if (rest <= delta) {
+        decimal_exponent += n;
+        grisu2_round(buffer, length, dist, delta, rest, std::uint64_t(pow10) << shift);
+        return;
+      }
+
+      pow10 /= 10;
+    }
+
+    int m = 0;
+    for (;;) {
+      p2 *= 10;
+      buffer[length++] = static_cast<char>('0' + (p2 >> shift));
+      p2 &= one - 1;
+      ++m;
+
+      delta *= 10;
+      dist *= 10;
+      if (p2 <= delta) {
+        break;
+      }
+    }
+
+    decimal_exponent -= m;
+    grisu2_round(buffer, length, dist, delta, p2, one);
+  }
+
+  // The digits and decimal exponent of the shortest decimal which rounds to value, which must
+  // be finite and positive.  Grisu2 finds the shortest representation for all but about 0.1% of
+  // doubles and for those it finds one a digit longer which still round trips.
+  inline void grisu2(char *const buffer,
+                     std::size_t &length,
+                     int &decimal_exponent,
+                     const double value) {
+    const Boundaries b(value);
+    const auto cached = cached_power_for_binary_exponent(b.plus.e);
+    const DiyFp c(cached.f, cached.e);
+
+    const auto w = DiyFp::mul(b.w, c);
+    const auto w_minus = DiyFp::mul(b.minus, c);
+    const auto w_plus = DiyFp::mul(b.plus, c);
+
+    // Shrink the interval by an ulp on each side to allow for the error of the products
+    const DiyFp m_minus(w_minus.f + 1, w_minus.e);
+    const DiyFp m_plus(w_plus.f - 1, w_plus.e);
+
+    length = 0;
+    decimal_exponent = -cached.k;
+    grisu2_digits(buffer, length, decimal_exponent, m_minus, w, m_plus);
+  }
+
+  inline char *write_digits(char *out, const char *const digits, const std::size_t n) {
+    std::memcpy(out, digits, n);
+    return out + n;
+  }
+
+  inline char *write_zeros(char *out, const int n) {
+    for (int i = 0; i < n; ++i) {
+      *out++ = '0';
+    }
+    return out;
+  }
+
+  inline char *write_non_finite(char *out, const double value) {
+    if (std::isnan(value)) {
+      return write_digits(out, "nan", 3);
+    }
+
+    if (value < 0.0) {
+      *out++ = '-';
+    }
+    return write_digits(out, "inf", 3);
+  }
+}
+
+// Writes the shortest decimal which reads back as value, laid out the way JavaScript's
+// Number.prototype.toString would, and returns the end of what was written.  out must have room
+// for DOUBLE_BUFFER_SIZE characters.
+inline char *write_shortest(char *out, const double value) {
+  if (!std::isfinite(value)) {
+    return detail::write_non_finite(out, value);
+  }
+
+  if (std::signbit(value)) {
+    *out++ = '-';
+  }
+
+  if (std::fpclassify(value) == FP_ZERO) {
+    *out++ = '0';
+    return out;
+  }
+
+  char digits[20];
+  std::size_t length = 0;
+  int decimal_exponent = 0;
+  detail::grisu2(digits, length, decimal_exponent, std::abs(value));
+
+  // The value is 0.digits * 10^point
+  const auto len = static_cast<int>(length);
+  const auto point = len + decimal_exponent;
+
+  if (len <= point && point <= 21) {
+    out = detail::write_digits(out, digits, length);
+    return detail::write_zeros(out, point - len);
+  }
+
+  if (0 < point && point <= 21) {
+    const auto integral = static_cast<std::size_t>(point);
+    out = detail::write_digits(out, digits, integral);
+    *out++ = '.';
+    return detail::write_digits(out, digits + integral, length - integral);
+  }
+
+  if (-6 < point && point <= 0) {
+    *out++ = '0';
+    *out++ = '.';
+    out = detail::write_zeros(out, -point);
+    return detail::write_digits(out, digits, length);
+  }
+
+  *out++ = digits[0];
+  if (length > 1) {
+    *out++ = '.';
+    out = detail::write_digits(out, digits + 1, length - 1);
+  }
+
+  auto exponent = point - 1;
+  *out++ = 'e';
+  *out++ = exponent < 0 ? '-' : '+';
+  exponent = std::abs(exponent);
+  if (exponent >= 100) {
+    *out++ = static_cast<char>('0' + exponent / 100);
+    exponent %= 100;
+    *out++ = static_cast<char>('0' + exponent / 10);
+  } else if (exponent >= 10) {
+    *out++ = static_cast<char>('0' + exponent / 10);
+  }
+  *out++ = static_cast<char>('0' + exponent % 10);
+  return out;
+}
+
+// Writes value with precision digits after the decimal point, exactly as printf's "%.*f" would,
+// and returns the end of what was written.  Values which fit in 53 bits once scaled are converted
+// with integer arithmetic unless they are too close to a tie to round reliably.  out must have
+// room for DOUBLE_BUFFER_SIZE characters.
+inline char *write_fixed(char *out, const double value, const int precision) {
+  assert(precision >= 0 && precision <= 9 && "Precision must be between 0 and 9");
+
+  static const double powers_of_ten[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+  if (!std::isfinite(value)) {
+    return detail::write_non_finite(out, value);
+  }
+
+  const auto scale = powers_of_ten[precision];
+  const auto scaled = std::abs(value) * scale;
+  const auto integral = std::floor(scaled);
+  const auto fraction = scaled - integral;
+
+  // The product is within half an ulp of the exact value, which only matters near a tie
+  if (scaled >= 9007199254740992.0 || std::abs(fraction - 0.5) <= scaled * 1e-15) {
+    const auto n = std::snprintf(out, DOUBLE_BUFFER_SIZE, "%.*f", precision, value);
+    assert(n > 0 && static_cast<std::size_t>(n) < DOUBLE_BUFFER_SIZE && "Buffer too small");
+    return out + n;
+  }
+
+  const auto units = static_cast<std::uint64_t>(integral) + (fraction > 0.5 ? 1u : 0u);
+
+  if (std::signbit(value)) {
+    *out++ = '-';
+  }
+
+  const auto divisor = static_cast<std::uint64_t>(scale);
+  auto whole = units / divisor;
+  auto fractional = units % divisor;
+
+  char digits[20];
+  std::size_t n = 0;
+  do {
+    digits[n++] = static_cast<char>('0' + whole % 10);
+    whole /= 10;
+  } while (whole);
+
+  while (n) {
+    *out++ = digits[--n];
+  }
+
+  if (precision > 0) {
+    *out++ = '.';
+    for (auto i = precision; i > 0; --i) {
+      out[i - 1] = static_cast<char>('0' + fractional % 10);
+      fractional /= 10;
+    }
+    out += precision;
+  }
+
+  return out;
+}
+}
+
+#include <ostream>
+#include <type_traits>
+
+namespace velox {
+
+namespace {
+  const std::size_t DEFAULT_WRITER_BUFFER_SIZE = 64 * 1024;
+}
+
+// Collects output in a buffer and hands it to a stream in large blocks.  Numbers are converted
+// without going through the stream so no locale, flags or precision are involved: doubles are
+// written as the shortest decimal which reads back as the same double, or with a fixed number
+// of decimals by write_fixed.
+//
+// The buffer is written to the stream by flush and the destructor.
+struct BufferedWriter {
+  explicit BufferedWriter(std::ostream &os, const std::size_t size = DEFAULT_WRITER_BUFFER_SIZE)
+      : os_(os), buffer_((std::max)(size, DOUBLE_BUFFER_SIZE)), used_(0) {}
+
+  BufferedWriter &operator=(const BufferedWriter &rhs) = delete;
+
+  ~BufferedWriter() { flush(); }
+
+  void flush() {
+    if (used_) {
+      os_.write(buffer_.data(), static_cast<std::streamsize>(used_));
+      used_ = 0;
+    }
+  }
+
+  void write(const char *const s, const std::size_t n) {
+    if (n > buffer_.size() - used_) {
+      flush();
+
+      if (n >= buffer_.size()) {
+        os_.write(s, static_cast<std::streamsize>(n));
+        return;
+      }
+    }
+
+    std::memcpy(buffer_.data() + used_, s, n);
+    used_ += n;
+  }
+
+  // Writes n with precision digits after the decimal point, like printf's "%.*f"
+  void write_fixed(const double n, const int precision) {
+    reserve(DOUBLE_BUFFER_SIZE);
+    used_ = end_offset(velox::write_fixed(buffer_.data() + used_, n, precision));
+  }
+
+  // Writes n with precision significant digits, like a stream's default floating point format
+  void write_general(const double n, const int precision) {
+    reserve(DOUBLE_BUFFER_SIZE);
+    const auto written =
+        std::snprintf(buffer_.data() + used_, DOUBLE_BUFFER_SIZE, "%.*g", precision, n);
+    assert(written > 0 && "Formatting failed");
+    used_ += static_cast<std::size_t>(written);
+  }
+
+  BufferedWriter &operator<<(const char *const s) {
+    write(s, std::strlen(s));
+    return *this;
+  }
+
+  BufferedWriter &operator<<(const std::string &s) {
+    write(s.data(), s.size());
+    return *this;
+  }
+
+  BufferedWriter &operator<<(const char c) {
+    reserve(1);
+    buffer_[used_++] = c;
+    return *this;
+  }
+
+  BufferedWriter &operator<<(const double n) {
+    reserve(DOUBLE_BUFFER_SIZE);
+    used_ = end_offset(write_shortest(buffer_.data() + used_, n));
+    return *this;
+  }
+
+  template <class T>
+  typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value,
+                          BufferedWriter &>::type
+  operator<<(const T n) {
+    write_unsigned(n, false);
+    return *this;
+  }
+
+  template <class T>
+  typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+                          BufferedWriter &>::type
+  operator<<(const T n) {
+    // Negated in unsigned arithmetic so the most negative value doesn't overflow
+    const auto magnitude = static_cast<std::uint64_t>(n);
+    write_unsigned(n < 0 ? ~magnitude + 1 : magnitude, n < 0);
+    return *this;
+  }
+
+private:
+  void reserve(const std::size_t n) {
+    if (n > buffer_.size() - used_) {
+      flush();
+    }
+  }
+
+  std::size_t end_offset(const char *const end) const {
+    return static_cast<std::size_t>(end - buffer_.data());
+  }
+
+  void write_unsigned(std::uint64_t n, const bool negative) {
+    char digits[21];
+    auto first = digits + sizeof(digits);
+    do {
+      *--first = static_cast<char>('0' + n % 10);
+      n /= 10;
+    } while (n);
+
+    if (negative) {
+      *--first = '-';
+    }
+
+    write(first, static_cast<std::size_t>(digits + sizeof(digits) - first));
+  }
+
+private:
+  std::ostream &os_;
+  std::vector<char> buffer_;
+  std::size_t used_;
+};
+}
+
+namespace velox {
+
+inline void format_r2(BufferedWriter &out, const double n) {
+  out.write_general(n, 7);
+}
+
+inline void format_short(BufferedWriter &out, const double n) {
+  if (n < 10.0) {
+    out.write_fixed(n, 4);
+  } else if (n < 100) {
+    out.write_fixed(n, 3);
+  } else if (n < 1000) {
+    out.write_fixed(n, 2);
+  } else {
+    out.write_fixed(n, 1);
+  }
+}
+
+inline void format_time(BufferedWriter &out, const FpNs ns) {
+  // Differences such as the overhead of a regression can be negative
+  if (ns < FpNs(0)) {
+    out << "-";
+    format_time(out, -ns);
+  } else if (ns < Ns(1)) {
+    format_short(out, ns.count() * 1e3);
+    out << " ps";
+  } else if (ns < std::chrono::microseconds(1)) {
+    format_short(out, ns.count());
+    out << " ns";
+  } else if (ns < std::chrono::milliseconds(1)) {
+    format_short(out, ns.count() / 1e3);
+    out << " us";
+  } else if (ns < std::chrono::seconds(1)) {
+    format_short(out, ns.count() / 1e6);
+    out << " ms";
+  } else {
+    format_short(out, ns.count() / 1e9);
+    out << " s";
+  }
+}
+
+// Stream versions of the above for output which isn't otherwise buffered
+inline void format_r2(std::ostream &os, const double n) {
+  BufferedWriter out(os, 0);
+  format_r2(out, n);
+}
+
+inline void format_short(std::ostream &os, const double n) {
+  BufferedWriter out(os, 0);
+  format_short(out, n);
+}
+
+inline void format_time(std::ostream &os, const FpNs ns) {
+  BufferedWriter out(os, 0);
+  format_time(out, ns);
+}
+
+struct TimeScaler {
+  TimeScaler(const std::string &time_units, const double scale_factor)
+      : units_(time_units), scale_(scale_factor) {}
+
+  const std::string &units() const { return units_; }
+
+  double scale() const { return scale_; }
+
+  double scale(FpNs ns) const { return ns.count() * scale_; }
+
+private:
+  std::string units_;
+  double scale_;
+};
+
+inline TimeScaler scaler_for_time(const FpNs ns) {
+  if (ns < Ns(1)) {
+    return TimeScaler("ps", 1000.);
+  } else if (ns < std::chrono::microseconds(1)) {
+    return TimeScaler("ns", 1.);
+  } else if (ns < std::chrono::milliseconds(1)) {
+    return TimeScaler("us", .001);
+  } else if (ns < std::chrono::seconds(1)) {
+    return TimeScaler("ms", .000001);
+  } else {
+    return TimeScaler("s", .000000001);
+  }
+}
+
+// The number of decimals which keeps digits significant digits of values no larger than max,
+// negative when the last significant digit is to the left of the decimal point
+inline int decimals_for_significant_digits(const double max, const int digits) {
+  if (!(max > 0.0)) {
+    return 0;
+  }
+
+  return digits - 1 - static_cast<int>(std::floor(std::log10(max)));
+}
+
+// Writes values rounded to a number of decimals as a JavaScript array of integers: the first
+// value and then the difference from each value to the next, all multiplied by 10^decimals.
+// Successive samples are similar so the differences are much shorter than the values.
+template <class Values, class F>
+void write_deltas(BufferedWriter &out, const Values &values, const int decimals, F &&value) {
+  const auto scale = std::pow(10.0, decimals);
+
+  out << "[";
+  const char *sep = "";
+  long long previous = 0;
+  for (const auto &v : values) {
+    const auto current = std::llround(value(v) * scale);
+    out << sep << current - previous;
+    previous = current;
+    sep = ",";
+  }
+  out << "]";
+}
+
+inline std::string js_string_escape(const std::string &s) {
+  std::string escaped;
+  escaped.reserve(s.size());
+
+  for (auto c : s) {
+    switch (c) {
+    case '\'':
+      escaped += "\\'";
+      break;
+    case '"':
+      escaped += "\\\"";
+      break;
+    case '\\':
+      escaped += "\\\\";
+      break;
+    default:
+      escaped += c;
+      break;
+    }
+  }
+
+  return escaped;
+}
+}
+
+namespace velox {
+
+// The number of iterations of each measurement, in the order they are taken
+using Schedule = std::vector<std::uint64_t>;
+
+namespace detail {
+  inline Schedule linear_schedule(const std::uint32_t num_measurements,
+                                  const std::uint64_t base_iters) {
+    auto schedule = vector_with_capacity<std::uint64_t>(num_measurements);
+
+    auto iters = base_iters;
+    for (std::uint32_t i = 0; i < num_measurements; ++i) {
+      iters += base_iters;
+      schedule.push_back(iters);
+    }
+
+    return schedule;
+  }
+
+  // Grows by the factor which keeps the total number of iterations the same as the linear
+  // schedule's
+  inline Schedule geometric_schedule(const std::uint32_t num_measurements,
+                                     const std::uint64_t base_iters) {
+    const auto n = static_cast<double>(num_measurements);
+    const auto first = 2.0 * static_cast<double>(base_iters);
+    const auto total = static_cast<double>(base_iters) * (n * (n + 3.0) / 2.0);
+
+    const auto sum_for = [&](const double r) {
+      double sum = 0.0, term = first;
+      for (std::uint32_t i = 0; i < num_measurements; ++i) {
+        sum += term;
+        term *= r;
+      }
+      return sum;
+    };
+
+    double lo = 1.0, hi = 2.0;
+    while (sum_for(hi) < total) {
+      hi *= 2.0;
+    }
+    for (int i = 0; i < 100; ++i) {
+      const auto mid = (lo + hi) / 2.0;
+      (sum_for(mid) < total ? lo : hi) = mid;
+    }
+
+    auto schedule = vector_with_capacity<std::uint64_t>(num_measurements);
+
+    auto term = first;
+    for (std::uint32_t i = 0; i < num_measurements; ++i) {
+      const auto iters = static_cast<std::uint64_t>(std::llround(term));
+      schedule.push_back(schedule.empty() ? iters : (std::max)(iters, schedule.back() + 1));
+      term *= lo;
+    }
+
+    return schedule;
+  }
+
+  inline Schedule low_discrepancy_schedule(const std::uint32_t num_measurements,
+                                           const std::uint64_t base_iters,
+                                           const std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> offset(0.0, 1.0);
+
+    const auto golden = 0.6180339887498949;
+    const auto first = 2.0 * static_cast<double>(base_iters);
+    const auto range = static_cast<double>(num_measurements - 1) * static_cast<double>(base_iters);
+
+    auto schedule = vector_with_capacity<std::uint64_t>(num_measurements);
+
+    auto u = offset(rng);
+    for (std::uint32_t i = 0; i < num_measurements; ++i) {
+      schedule.push_back((std::max)(
+          static_cast<std::uint64_t>(std::llround(first + u * range)), std::uint64_t(1)));
+      u += golden;
+      u -= std::floor(u);
+    }
+
+    return schedule;
+  }
+}
+
+// The iteration counts for the measurements of a benchmark
+inline Schedule iteration_schedule(const std::uint32_t num_measurements,
+                                   const std::uint64_t base_iters,
+                                   const IterationSchedule schedule,
+                                   const std::uint32_t seed) {
+  assert(num_measurements && "At least one measurement must be taken");
+  assert(base_iters && "Must iterate at least once");
+
+  switch (schedule) {
+  case IterationSchedule::linear:
+    break;
+  case IterationSchedule::shuffled_linear: {
+    auto s = detail::linear_schedule(num_measurements, base_iters);
+    std::shuffle(s.begin(), s.end(), std::mt19937(seed));
+    return s;
+  }
+  case IterationSchedule::geometric:
+    return detail::geometric_schedule(num_measurements, base_iters);
+  case IterationSchedule::low_discrepancy:
+    return detail::low_discrepancy_schedule(num_measurements, base_iters, seed);
+  }
+
+  return detail::linear_schedule(num_measurements, base_iters);
+}
+
+// Whether to take every measurement with the same number of iterations, given how long an
+// iteration took during the warm up
+inline bool use_flat_sampling(const VeloxConfig &config, const FpNs mean_execution_time) {
+  switch (config.sampling_mode()) {
+  case SamplingMode::automatic:
+    break;
+  case SamplingMode::linear:
+    return false;
+  case SamplingMode::flat:
+    return true;
+  }
+
+  return mean_execution_time > config.flat_sampling_threshold();
+}
+
+// Looks for interference which repeats with a fixed period by regressing the residuals of the
+// measurements around the line with an intercept against sinusoids of their start times.  The
+// strongest period is reported along with the share of the residual variance it explains and
+// the probability white noise would explain as much at some period (Bonferroni corrected).
+struct PeriodicInterference {
+  PeriodicInterference(const Measurements &measurements)
+      : period_(0.0), amplitude_(0.0), variance_explained_(0.0), p_value_(1.0),
+        sequential_schedule_(
+            !measurements.empty() &&
+            measurements.front().iters() < measurements.back().iters() &&
+            std::is_sorted(measurements.begin(),
+                           measurements.end(),
+                           [](const Measurement &a, const Measurement &b) {
+                             return a.iters() < b.iters();
+                           })) {
+    const auto n = measurements.size();
+    if (n < 8) {
+      return;
+    }
+
+    const auto points = measurements_to_points(measurements);
+    const auto line = ols_line(points);
+
+    auto residuals = vector_with_capacity<double>(n);
+    auto starts = vector_with_capacity<double>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      residuals.push_back(points[i].y() - line(points[i].x()));
+      starts.push_back(static_cast<double>(measurements[i].start().count()));
+    }
+
+    const auto mm = std::minmax_element(starts.begin(), starts.end());
+    const auto span = *mm.second - *mm.first;
+    if (!(span > 0.0)) {
+      return;
+    }
+
+    const auto mr = mean(residuals);
+    double total = 0.0;
+    for (auto &r : residuals) {
+      r -= mr;
+      total += r * r;
+    }
+    if (!(total > 0.0)) {
+      return;
+    }
+
+    // Frequencies from one cycle over the whole run up to about one cycle per two measurements,
+    // oversampled so peaks between the independent frequencies aren't missed
+    const auto PI = 3.14159265358979323846;
+    const std::size_t oversampling = 4;
+    const auto num_independent = n / 2;
+
+    for (std::size_t j = oversampling; j <= num_independent * oversampling; ++j) {
+      const auto w = 2.0 * PI * static_cast<double>(j) / (static_cast<double>(oversampling) * span);
+
+      double cc = 0.0, cs = 0.0, ss = 0.0, rc = 0.0, rs = 0.0;
+      for (std::size_t i = 0; i < n; ++i) {
+        const auto c = std::cos(w * starts[i]), s = std::sin(w * starts[i]);
+        cc += c * c;
+        cs += c * s;
+        ss += s * s;
+        rc += residuals[i] * c;
+        rs += residuals[i] * s;
+      }
+
+      const auto det = cc * ss - cs * cs;
+      if (!(det > 0.0)) {
+        continue;
+      }
+
+      const auto a = (rc * ss - rs * cs) / det;
+      const auto b = (rs * cc - rc * cs) / det;
+      const auto explained = (a * rc + b * rs) / total;
+
+      if (explained > variance_explained_) {
+        variance_explained_ = explained;
+        period_ = FpNs(2.0 * PI / w);
+        amplitude_ = FpNs(std::sqrt(a * a + b * b));
+      }
+    }
+
+    // For white noise the share explained by two regressors at a single frequency is
+    // Beta(1, (n - 3) / 2) distributed
+    const auto single = std::pow(1.0 - (std::min)(variance_explained_, 1.0),
+                                 (static_cast<double>(n) - 3.0) / 2.0);
+    p_value_ = (std::min)(1.0, single * static_cast<double>(num_independent));
+  }
+
+  // The period of the strongest sinusoid in the residuals
+  FpNs period() const { return period_; }
+
+  // The amplitude of that sinusoid, in time per measurement
+  FpNs amplitude() const { return amplitude_; }
+
+  // The share of the residual variance explained by it
+  double variance_explained() const { return variance_explained_; }
+
+  double p_value() const { return p_value_; }
+
+  bool significant() const { return p_value_ < 0.01; }
+
+  // Whether the measurements ran increasing numbers of iterations in the order they were taken,
+  // as with the linear and geometric schedules, so the interference can line up with them
+  bool sequential_schedule() const { return sequential_schedule_; }
+
+private:
+  FpNs period_;
+  FpNs amplitude_;
+  double variance_explained_;
+  double p_value_;
+  bool sequential_schedule_;
+};
+}
+
+#include <thread>
+
+namespace velox {
+
+// When the requests of a load test are issued
+enum class ArrivalProcess {
+  // Evenly spaced at the target rate
+  fixed,
+  // Exponentially distributed gaps with the target rate as the mean, like independent users
+  poisson
+};
+
+// Settings for Velox::load
+struct LoadConfig {
+  LoadConfig()
+      : duration_(1000), num_threads_(1), arrival_process_(ArrivalProcess::poisson),
+        seed_(std::random_device{}()) {}
+
+  // The request rates to sweep, in requests per second
+  LoadConfig &rates(const std::vector<double> &rates) {
+    assert(std::all_of(rates.begin(), rates.end(), [](double r) { return r > 0.0; }) &&
+           "Rates must be positive");
+    rates_ = rates;
+    return *this;
+  }
+
+  const std::vector<double> &rates() const { return rates_; }
+
+  // How long to issue requests for at each rate
+  LoadConfig &duration(const Ms ms) {
+    assert(ms.count() > 0 && "Duration must be positive");
+    duration_ = ms;
+    return *this;
+  }
+
+  Ms duration() const { return duration_; }
+
+  // The number of threads issuing requests.  The function must be safe to call concurrently when
+  // there is more than one.
+  LoadConfig &num_threads(const std::uint32_t n) {
+    assert(n && "At least one thread is required");
+    num_threads_ = n;
+    return *this;
+  }
+
+  std::uint32_t num_threads() const { return num_threads_; }
+
+  LoadConfig &arrival_process(const ArrivalProcess process) {
+    arrival_process_ = process;
+    return *this;
+  }
+
+  ArrivalProcess arrival_process() const { return arrival_process_; }
+
+  // Seed for the Poisson arrivals, random by default
+  LoadConfig &seed(const std::uint32_t s) {
+    seed_ = s;
+    return *this;
+  }
+
+  std::uint32_t seed() const { return seed_; }
+
+private:
+  std::vector<double> rates_;
+  Ms duration_;
+  std::uint32_t num_threads_;
+  ArrivalProcess arrival_process_;
+  std::uint32_t seed_;
+};
+
+// When each request should start, relative to the start of the load test
+inline std::vector<Ns> arrival_offsets(const double rate,
+                                       const Ms duration,
+                                       const ArrivalProcess process,
+                                       const std::uint32_t seed) {
+  assert(rate > 0.0 && "Rate must be positive");
+
+  const auto end = std::chrono::duration_cast<FpNs>(duration).count();
+  const auto gap = 1e9 / rate;
+
+  std::mt19937 rng(seed);
+  std::exponential_distribution<double> exponential(1.0);
+
+  auto offsets = vector_with_capacity<Ns>(static_cast<std::size_t>(end / gap) + 1);
+  for (auto t = 0.0; t < end;) {
+    offsets.push_back(Ns(static_cast<Ns::rep>(t)));
+    t += process == ArrivalProcess::fixed ? gap : gap * exponential(rng);
+  }
+
+  return offsets;
+}
+
+// The results of issuing requests at one rate.  Latencies are measured from when each request
+// was supposed to start so requests which were held up by slow earlier requests count the time
+// they waited, which corrects for coordinated omission.  Service times are measured from when
+// the requests actually started, which is what closed loop timing sees.
+struct LoadPoint {
+  LoadPoint(const double target_rate, const double throughput, Times latencies, Times service_times)
+      : target_rate_(target_rate), throughput_(throughput), latencies_(std::move(latencies)),
+        service_times_(std::move(service_times)) {
+    std::sort(latencies_.begin(), latencies_.end());
+    std::sort(service_times_.begin(), service_times_.end());
+  }
+
+  // Requests per second
+  double target_rate() const { return target_rate_; }
+
+  // Completed requests per second
+  double throughput() const { return throughput_; }
+
+  std::size_t num_requests() const { return latencies_.size(); }
+
+  FpNs latency(const double p) const { return percentile_of_sorted(latencies_, p); }
+
+  FpNs service_time(const double p) const { return percentile_of_sorted(service_times_, p); }
+
+  FpNs max_latency() const { return latencies_.back(); }
+
+  // Sorted
+  const Times &latencies() const { return latencies_; }
+
+  // Sorted
+  const Times &service_times() const { return service_times_; }
+
+private:
+  double target_rate_;
+  double throughput_;
+  Times latencies_;
+  Times service_times_;
+};
+
+namespace detail {
+  // Clocks can provide their own wait_until, such as a simulated clock which jumps straight to t
+  template <class C>
+  auto wait_until(const TimePoint<C> t, int) -> decltype(C::wait_until(t), void()) {
+    C::wait_until(t);
+  }
+
+  // Sleeps until shortly before t then spins, sleeping is too coarse to hit t on its own
+  template <class C>
+  void wait_until(const TimePoint<C> t, long) {
+    const auto spin = std::chrono::microseconds(200);
+
+    auto now = C::now();
+    if (t - now > spin) {
+      std::this_thread::sleep_for(t - now - spin);
+    }
+
+    while (C::now() < t) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+// Issues requests at the given rate, calling f once per request.  The threads share one
+// schedule and each picks the next request when it is done with its previous one, so when f
+// can't keep up the requests queue rather than being dropped.
+template <class C, class F>
+LoadPoint run_load(F &&f, const double rate, const LoadConfig &config) {
+  const auto offsets =
+      arrival_offsets(rate, config.duration(), config.arrival_process(), config.seed());
+  const auto n = offsets.size();
+
+  Times latencies(n), service_times(n);
+  std::atomic<std::size_t> next(0);
+  std::vector<TimePoint<C>> last_completions(config.num_threads());
+
+  const auto start = C::now();
+
+  const auto worker = [&](const std::size_t thread) {
+    for (auto i = next++; i < n; i = next++) {
+      const auto intended = start + std::chrono::duration_cast<Duration<C>>(offsets[i]);
+      detail::wait_until<C>(intended, 0);
+
+      const auto actual = C::now();
+      f();
+      const auto done = C::now();
+
+      latencies[i] = std::chrono::duration_cast<FpNs>(done - intended);
+      service_times[i] = std::chrono::duration_cast<FpNs>(done - actual);
+      last_completions[thread] = done;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 1; t < config.num_threads(); ++t) {
+    threads.emplace_back(worker, t);
+  }
+  worker(0);
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  // Poisson arrivals can finish early, so the test lasts at least the configured duration
+  const auto end = *std::max_element(last_completions.begin(), last_completions.end());
+  const auto elapsed = (std::max)(std::chrono::duration_cast<FpNs>(end - start),
+                                  std::chrono::duration_cast<FpNs>(config.duration()));
+  const auto throughput = static_cast<double>(n) / (elapsed.count() / 1e9);
+
+  return LoadPoint(rate, throughput, std::move(latencies), std::move(service_times));
+}
+}
+
+namespace velox {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+struct Reporter {
+  virtual ~Reporter() = 0;
+
+  virtual void suite_starting(const std::string &clock, bool is_steady) {
+    unused(clock, is_steady);
+  }
+
+  virtual void estimate_clock_cost_starting() {}
+  virtual void estimate_clock_cost_ended(FpNs cost) { unused(cost); }
+
+  virtual void clock_resolution_estimated(FpNs resolution) { unused(resolution); }
+
+  virtual void quick_mode_enabled() {}
+
+  // A shard checkpoint to merge wasn't written in this run's environment, so its benchmarks are
+  // neither merged nor run again
+  virtual void merge_refused(const std::string &checkpoint,
+                             const std::string &checkpoint_environment,
+                             const std::string &environment) {
+    unused(checkpoint, checkpoint_environment, environment);
+  }
+
+  virtual void warm_up_starting(Ms ms) { unused(ms); }
+  virtual void warm_up_ended(const ItersForDurationNs &wu) { unused(wu); }
+  virtual void warm_up_failed(const ItersForDurationNs &wu) { unused(wu); }
+
+  virtual void benchmark_starting(const std::string &name) { unused(name); }
+  virtual void benchmark_ended() {}
+
+  virtual void measurement_collection_starting(std::uint32_t num_measurements,
+                                               FpNs measurement_time) {
+    unused(num_measurements, measurement_time);
+  }
+
+  virtual void measurements_too_short(std::size_t num_short,
+                                      std::size_t num_measurements,
+                                      FpNs min_duration) {
+    unused(num_short, num_measurements, min_duration);
+  }
+
+  virtual void measurement_collection_ended(const Measurements &measurements,
+                                            const Times &times,
+                                            const SampleSummary &summary,
+                                            const Outliers &outliers) {
+    unused(measurements, times, summary, outliers);
+  }
+
+  virtual void autocorrelation_estimated(const Autocorrelation &autocorrelation) {
+    unused(autocorrelation);
+  }
+
+  virtual void periodic_interference_estimated(const PeriodicInterference &interference) {
+    unused(interference);
+  }
+
+  virtual void estimate_statistics_starting(std::uint32_t num_resamples) { unused(num_resamples); }
+
+  virtual void estimate_statistics_ended(const EstimatedStatistics &statistics) {
+    unused(statistics);
+  }
+
+  virtual void load_test_starting(const std::string &name, const LoadConfig &config) {
+    unused(name, config);
+  }
+
+  virtual void load_point_measured(const LoadPoint &point) { unused(point); }
+
+  virtual void load_test_ended() {}
+
+  virtual void suite_ended() {}
+};
+
+inline Reporter::~Reporter() {
+}
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+namespace velox {
+
+namespace detail {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+  struct StopwatchConcept {
+    virtual ~StopwatchConcept() = default;
+    virtual void start() = 0;
+    virtual void stop() = 0;
+    virtual void record(Ns elapsed) = 0;
+    virtual std::uint64_t iters() const = 0;
+  };
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+  template <class C>
+  struct StopwatchModel final : StopwatchConcept {
+
+    StopwatchModel(const std::uint64_t iterations)
+        : iters_(iterations), recorded_(0), has_recorded_(false) {
+      assert(iters_ && "Must iterate at least once");
+    }
+
+    void start() override { start_time_ = C::now(); }
+
+    void stop() override { stop_time_ = C::now(); }
+
+    void record(const Ns elapsed) override {
+      recorded_ = elapsed;
+      has_recorded_ = true;
+    }
+
+    std::uint64_t iters() const override { return iters_; }
+
+    Ns elapsed() const {
+      return has_recorded_ ? recorded_
+                           : std::chrono::duration_cast<Ns>(stop_time_ - start_time_);
+    }
+
+  private:
+    TimePoint<C> start_time_;
+    TimePoint<C> stop_time_;
+    std::uint64_t iters_;
+    Ns recorded_;
+    bool has_recorded_;
+  };
+}
+
+struct Stopwatch {
+  template <class F>
+  Stopwatch(detail::StopwatchConcept &sw, F &&f)
+      : sw_(sw)
+#ifndef NDEBUG
+        ,
+        measure_called_(false)
+#endif
+  {
+    run(std::forward<F>(f), IsCallable<F, Stopwatch &>());
+  }
+
+  Stopwatch &operator=(const Stopwatch &rhs) = delete;
+
+  template <class F>
+  void measure(F &&f) {
+#ifndef NDEBUG
+    assert(!measure_called_ && "Measure should only be called once");
+#endif
+    sw_.start();
+    for (auto i = sw_.iters(); i != 0; --i) {
+      f();
+    }
+    sw_.stop();
+#ifndef NDEBUG
+    measure_called_ = true;
+#endif
+  }
+
+  // For work the Stopwatch can't time itself, such as work finishing on another thread or
+  // batches where only part of each call should count.  f is given the number of iterations to
+  // run and returns how long they took as a std::chrono::duration, measured however it likes.
+  template <class F>
+  void measure_custom(F &&f) {
+#ifndef NDEBUG
+    assert(!measure_called_ && "Measure should only be called once");
+#endif
+    sw_.record(std::chrono::duration_cast<Ns>(std::forward<F>(f)(sw_.iters())));
+#ifndef NDEBUG
+    measure_called_ = true;
+#endif
+  }
+
+private:
+  template <class F>
+  void run(F &&f, std::false_type) {
+    sw_.start();
+    for (auto i = sw_.iters(); i != 0; --i) {
+      f();
+    }
+    sw_.stop();
+  }
+
+  template <class F>
+  void run(F &&f, std::true_type) {
+    std::forward<F>(f)(*this);
+#ifndef NDEBUG
+    assert(measure_called_ && "The callable being timed must call measure");
+#endif
+  }
+
+private:
+  detail::StopwatchConcept &sw_;
+#ifndef NDEBUG
+  bool measure_called_;
+#endif
+};
+}
+
+namespace velox {
+
+// Confidence intervals from textbook formulas instead of the bootstrap.  They assume roughly
+// normal, independent measurements so they are only approximate for benchmarks, but cost next
+// to nothing which makes them useful for VeloxConfig::quick_mode.
+
+namespace detail {
+  // An estimate without an interval, for statistics with no cheap analytic one
+  template <class T>
+  Estimate<T> point_estimate(const T p, const double cl) {
+    return Estimate<T>(p, T(0), p, p, cl);
+  }
+
+  inline Estimate<FpNs>
+  t_estimate(const FpNs p, const FpNs se, const double df, const double cl) {
+    if (!(df > 0.0)) {
+      return point_estimate(p, cl);
+    }
+
+    const auto t = student_t_quantile(0.5 * (1.0 + cl), df);
+    return Estimate<FpNs>(p, se, p - se * t, p + se * t, cl);
+  }
+}
+
+// Student's t interval for the mean
+inline Estimate<FpNs> mean_t_interval(const SampleSummary &summary, const double cl) {
+  const auto n = static_cast<double>(summary.size());
+  return detail::t_estimate(summary.mean(), summary.std_dev() / std::sqrt(n), n - 1.0, cl);
+}
+
+// Distribution free interval for the median between the order statistics whose ranks are
+// binomial(n, 1/2) quantiles.  The standard error is the width of the interval scaled to a
+// normal one.
+inline Estimate<FpNs> median_order_statistic_interval(const SampleSummary &summary,
+                                                      const double cl) {
+  const auto &sorted = summary.sorted();
+  const auto n = sorted.size();
+  const auto alpha = 0.5 * (1.0 - cl);
+
+  // The largest count j with P(B < j) <= alpha, the interval is [x(j), x(n - j + 1)].  The
+  // cumulative probability is summed as j grows so large samples stay linear.
+  std::size_t j = 0;
+  auto below_next = binomial_half_pmf(0, n);
+  while (j + 1 <= n / 2 && below_next <= alpha) {
+    ++j;
+    below_next += binomial_half_pmf(j, n);
+  }
+
+  const auto lb = sorted[j ? j - 1 : 0], ub = sorted[n - (j ? j : 1)];
+  const auto z = normal_quantile(0.5 * (1.0 + cl));
+  return Estimate<FpNs>(summary.median(), (ub - lb) / (2.0 * z), lb, ub, cl);
+}
+
+// Chi-squared interval for the standard deviation
+inline Estimate<FpNs> std_dev_chi_squared_interval(const SampleSummary &summary,
+                                                   const double cl) {
+  const auto sd = summary.std_dev();
+  const auto df = static_cast<double>(summary.size()) - 1.0;
+  if (!(df > 0.0)) {
+    return detail::point_estimate(sd, cl);
+  }
+
+  const auto lo = chi_squared_quantile(0.5 * (1.0 + cl), df);
+  const auto hi = chi_squared_quantile(0.5 * (1.0 - cl), df);
+  return Estimate<FpNs>(sd,
+                        sd / std::sqrt(2.0 * df),
+                        sd * std::sqrt(df / lo),
+                        hi > 0.0 ? sd * std::sqrt(df / hi) : sd * 1e9,
+                        cl);
+}
+
+// Quick mode's replacement for estimate_statistics.  Means, medians and standard deviations get
+// t, order statistic and chi-squared intervals, LLS, slope and overhead get t intervals from the
+// residuals around the fitted lines and the other statistics are points without intervals.  As
+// with estimate_statistics the outlier variance comes from the sample before any outlier policy.
+inline EstimatedStatistics estimate_statistics_analytic(const Measurements &measurements,
+                                                        const SampleSummary &summary,
+                                                        const VeloxConfig &config,
+                                                        const OutlierVariance &outlier_variance) {
+  const auto cl = config.confidence_level();
+  const auto regression = config.regression_method();
+  const auto points = measurements_to_points(measurements);
+  const auto n = static_cast<double>(points.size());
+
+  const auto flat = is_flat(measurements);
+
+  const auto mean = mean_t_interval(summary, cl);
+
+  std::vector<double> buffer;
+  const auto mad = FpNs(median_abs_dev_of_sorted_destructive(FpRange(summary.sorted()), buffer));
+
+  const auto lls_point = fit_slope(points, regression);
+  const auto line = fit_line(points, regression);
+
+  double sx = 0.0, sxx = 0.0;
+  for (const auto &p : points) {
+    sx += p.x();
+    sxx += p.x() * p.x();
+  }
+  const auto mx = sx / n;
+  const auto centred_sxx = sxx - n * mx * mx;
+
+  double sse_origin = 0.0, sse_line = 0.0;
+  for (const auto &p : points) {
+    const auto e0 = p.y() - lls_point * p.x(), e1 = p.y() - line(p.x());
+    sse_origin += e0 * e0;
+    sse_line += e1 * e1;
+  }
+
+  const auto lls = detail::t_estimate(
+      FpNs(lls_point), FpNs(std::sqrt(sse_origin / (n - 1.0) / sxx)), n - 1.0, cl);
+
+  const auto line_valid = !flat && n > 2.0 && centred_sxx > 0.0;
+  const auto s2 = line_valid ? sse_line / (n - 2.0) : 0.0;
+  const auto slope =
+      line_valid ? detail::t_estimate(
+                       FpNs(line.slope()), FpNs(std::sqrt(s2 / centred_sxx)), n - 2.0, cl)
+                 : lls;
+  const auto overhead =
+      line_valid ? detail::t_estimate(FpNs(line.intercept()),
+                                      FpNs(std::sqrt(s2 * (1.0 / n + mx * mx / centred_sxx))),
+                                      n - 2.0,
+                                      cl)
+                 : detail::point_estimate(FpNs(line.intercept()), cl);
+
+  const auto &customs = config.statistics();
+  auto custom_estimates = vector_with_capacity<CustomEstimate>(customs.size());
+  for (const auto &c : customs) {
+    custom_estimates.emplace_back(c, detail::point_estimate(c(summary.sorted()), cl));
+  }
+
+  return EstimatedStatistics(mean,
+                             median_order_statistic_interval(summary, cl),
+                             std_dev_chi_squared_interval(summary, cl),
+                             detail::point_estimate(mad, cl),
+                             lls,
+                             detail::point_estimate(r_squared(points, lls_point), cl),
+                             slope,
+                             overhead,
+                             outlier_variance,
+                             0,
+                             flat,
+                             true,
+                             std::move(custom_estimates));
+}
+
+inline EstimatedStatistics estimate_statistics_analytic(const Measurements &measurements,
+                                                        const SampleSummary &summary,
+                                                        const VeloxConfig &config) {
+  return estimate_statistics_analytic(measurements, summary, config, OutlierVariance(summary));
+}
+}
+
+namespace velox {
+
+namespace {
+  const std::uint32_t CLOCK_RESOLUTION_SAMPLES = 1000;
+  const Ms CLOCK_RESOLUTION_MAX_TIME(200);
+}
+
+namespace detail {
+  template <class C>
+  TimePoint<C> next_tick(const TimePoint<C> t) {
+    auto next = C::now();
+    while (next == t) {
+      next = C::now();
+    }
+    return next;
+  }
+}
+
+// The effective granularity of the clock: the median time between the clock's readings
+// changing.  For fine grained clocks this is dominated by the cost of reading the clock, for
+// coarse clocks by the tick length.  Sampling stops early for very coarse clocks.
+template <class C>
+FpNs estimate_clock_resolution() {
+  auto deltas = vector_with_capacity<FpNs>(CLOCK_RESOLUTION_SAMPLES);
+
+  // Start on a tick boundary so the first delta is a whole tick
+  const auto start = detail::next_tick<C>(C::now());
+  auto prev = start;
+
+  while (deltas.size() < CLOCK_RESOLUTION_SAMPLES) {
+    const auto next = detail::next_tick<C>(prev);
+    deltas.push_back(std::chrono::duration_cast<FpNs>(next - prev));
+    prev = next;
+
+    if (next - start > CLOCK_RESOLUTION_MAX_TIME) {
+      break;
+    }
+  }
+
+  return median(deltas);
+}
+
+// The smallest number of iterations which take at least min_duration, given how long one
+// iteration takes
+inline std::uint64_t min_iters_for_duration(const FpNs min_duration,
+                                            const FpNs mean_execution_time) {
+  if (!(mean_execution_time.count() > 0.0)) {
+    return 1;
+  }
+
+  return (std::max)(
+      static_cast<std::uint64_t>(std::ceil(min_duration.count() / mean_execution_time.count())),
+      std::uint64_t(1));
+}
+
+// The number of measurements which took less than min_duration
+inline std::size_t count_short_measurements(const Measurements &measurements,
+                                            const FpNs min_duration) {
+  return static_cast<std::size_t>(
+      std::count_if(measurements.begin(), measurements.end(), [min_duration](const Measurement &m) {
+        return std::chrono::duration_cast<FpNs>(m.duration()) < min_duration;
+      }));
+}
+}
+
+namespace velox {
+
+template <class C, class F>
+struct Benchmark {
+  Benchmark(F &f) : f_(f) {}
+
+  Benchmark &operator=(const Benchmark &rhs) = delete;
+
+  std::pair<ItersForDurationNs, bool> warm_up(const Duration<C> duration) {
+    std::uint64_t iters = 1;
+
+    const auto start = C::now();
+
+    for (;;) {
+      const auto elapsed = run(iters);
+
+      if (C::now() - start > duration) {
+        return {ItersForDurationNs(iters, elapsed), true};
+      }
+
+      const auto prev_iters = iters;
+      iters *= 2;
+
+      if (iters == 0) {
+        return {ItersForDurationNs(prev_iters, elapsed), false};
+      }
+    }
+  }
+
+  Ns run(const std::uint64_t iters) {
+    detail::StopwatchModel<C> sm(iters);
+    Stopwatch(sm, f_);
+    return sm.elapsed();
+  }
+
+  Measurements bench(const Schedule &schedule) {
+    auto measurements = vector_with_capacity<Measurement>(schedule.size());
+
+    const auto first = C::now();
+    for (const auto iters : schedule) {
+      const auto start = std::chrono::duration_cast<Ns>(C::now() - first);
+      measurements.emplace_back(iters, run(iters), start);
+    }
+
+    return measurements;
+  }
+
+private:
+  F &f_;
+};
+
+inline Times times_from_measurements(const Measurements &measurements) {
+  auto ts = vector_with_capacity<FpNs>(measurements.size());
+
+  for (const auto &m : measurements) {
+    ts.push_back(FpNs{static_cast<double>(m.duration().count()) / static_cast<double>(m.iters())});
+  }
+
+  return ts;
+}
+
+// The time per iteration of a warm up
+inline double time_per_iteration(const ItersForDurationNs &wu) {
+  return static_cast<double>(wu.duration().count()) / static_cast<double>(wu.iters());
+}
+
+// Warms up for the configured time, or when cached, the warm up of an earlier run, is given only
+// long enough to check it still holds
+template <class C, class F>
+std::pair<ItersForDurationNs, bool> warm_up(Benchmark<C, F> &b,
+                                            const VeloxConfig &config,
+                                            const ItersForDurationNs *const cached,
+                                            Reporter &reporter) {
+  if (cached && cached->iters() && cached->duration().count()) {
+    reporter.warm_up_starting(config.verification_warm_up_time());
+
+    const auto verification = b.warm_up(config.verification_warm_up_time());
+    if (verification.second && verification.first.duration().count()) {
+      // Compared as a ratio so faster and slower functions are treated alike
+      const auto stored = time_per_iteration(*cached);
+      const auto verified = time_per_iteration(verification.first);
+      if ((std::max)(stored, verified) <=
+          (1.0 + config.warm_up_tolerance()) * (std::min)(stored, verified)) {
+        return {*cached, true};
+      }
+    }
+  }
+
+  reporter.warm_up_starting(config.warm_up_time());
+  return b.warm_up(config.warm_up_time());
+}
+
+template <class C, class F>
+std::pair<Measurements, bool> measure(F &&f,
+                                      const VeloxConfig &config,
+                                      const FpNs clock_resolution,
+                                      Reporter &reporter,
+                                      const ItersForDurationNs *const cached = nullptr) {
+  Benchmark<C, F> b(f);
+
+  const auto wu_result = warm_up(b, config, cached, reporter);
+  const auto &wu = wu_result.first;
+
+  if (!wu_result.second || !wu.duration().count()) {
+    reporter.warm_up_failed(wu);
+    return {Measurements(), false};
+  }
+
+  reporter.warm_up_ended(wu);
+
+  const auto mean_execution_time = time_per_iteration(wu);
+  const auto mt =
+      static_cast<double>(std::chrono::duration_cast<Ns>(config.measurement_time()).count());
+  const auto flat = use_flat_sampling(config, FpNs(mean_execution_time));
+  const auto nm = flat ? config.flat_num_measurements() : config.num_measurements();
+  // The minimum is capped at each measurement's even share of the measurement time so a coarse
+  // clock can't stretch the run without bound.  Measurements which are still too short are
+  // reported below.
+  const auto min_duration = clock_resolution * config.min_measurement_ticks();
+  const auto min_iters = min_iters_for_duration((std::min)(min_duration, FpNs(mt / nm)),
+                                                FpNs(mean_execution_time));
+
+  const auto schedule = [&]() -> Schedule {
+    if (flat) {
+      // The measurement time split evenly between the measurements
+      const auto iters = static_cast<std::uint64_t>(mt / mean_execution_time / nm);
+      return Schedule(nm, (std::max)(iters, min_iters));
+    }
+
+    // Every schedule's shortest measurement is at least twice the base iterations
+    const auto base_iters = (std::max)(
+        static_cast<std::uint64_t>(
+            std::ceil(2.0 * mt / mean_execution_time / static_cast<double>(nm * (nm + 1)))),
+        (min_iters + 1) / 2);
+    return iteration_schedule(nm, base_iters, config.iteration_schedule(), std::random_device{}());
+  }();
+  const auto total_iters = std::accumulate(schedule.begin(), schedule.end(), std::uint64_t(0));
+
+  const auto estimated_time = FpNs{static_cast<double>(total_iters) * mean_execution_time};
+
+  reporter.measurement_collection_starting(nm, estimated_time);
+
+  auto measurements = b.bench(schedule);
+
+  const auto num_short = count_short_measurements(measurements, min_duration);
+  if (num_short) {
+    reporter.measurements_too_short(num_short, measurements.size(), min_duration);
+  }
+
+  return {std::move(measurements), true};
+}
+
+// Everything after the measurements have been collected, which doesn't need a quiet machine
+inline void
+analyze(const Measurements &measurements, const VeloxConfig &config, Reporter &reporter) {
+  const auto times = times_from_measurements(measurements);
+  const SampleSummary summary(times);
+  const Outliers outliers(times, summary);
+
+  reporter.measurement_collection_ended(measurements, times, summary, outliers);
+
+  reporter.autocorrelation_estimated(Autocorrelation(times, config));
+  reporter.periodic_interference_estimated(PeriodicInterference(measurements));
+
+  reporter.estimate_statistics_starting(config.quick_mode() ? 0 : config.num_resamples());
+
+  // How much the outliers affect the sample is judged before the policy removes them
+  const OutlierVariance outlier_variance(summary);
+  const auto statistics = [&]() -> EstimatedStatistics {
+    if (config.outlier_policy() == OutlierPolicy::keep) {
+      return config.quick_mode()
+                 ? estimate_statistics_analytic(measurements, summary, config, outlier_variance)
+                 : estimate_statistics(measurements, times, summary, config, outlier_variance);
+    }
+
+    const auto analyzed =
+        apply_outlier_policy(measurements, times, outliers, config.outlier_policy());
+    const SampleSummary analyzed_summary(analyzed.times());
+    return config.quick_mode()
+               ? estimate_statistics_analytic(
+                     analyzed.measurements(), analyzed_summary, config, outlier_variance)
+               : estimate_statistics(analyzed.measurements(),
+                                     analyzed.times(),
+                                     analyzed_summary,
+                                     config,
+                                     outlier_variance);
+  }();
+
+  reporter.estimate_statistics_ended(statistics);
+  reporter.benchmark_ended();
+}
+
+template <class C, class F>
+void benchmark(const std::string &name,
+               F &&f,
+               const VeloxConfig &config,
+               const FpNs clock_resolution,
+               Reporter &reporter,
+               const ItersForDurationNs *const cached = nullptr) {
+  reporter.benchmark_starting(name);
+
+  const auto measure_result =
+      measure<C>(std::forward<F>(f), config, clock_resolution, reporter, cached);
+  if (!measure_result.second) {
+    return;
+  }
+
+  analyze(measure_result.first, config, reporter);
+}
+
+template <class C, class F>
+void load_test(const std::string &name, F &&f, const LoadConfig &config, Reporter &reporter) {
+  reporter.load_test_starting(name, config);
+
+  for (const auto rate : config.rates()) {
+    reporter.load_point_measured(run_load<C>(f, rate, config));
+  }
+
+  reporter.load_test_ended();
+}
+
+template <class C>
+FpNs estimate_clock_cost(const VeloxConfig &config,
+                         const FpNs clock_resolution,
+                         Reporter &reporter) {
+  reporter.estimate_clock_cost_starting();
+
+  const auto measure_result = measure<C>([]() { C::now(); }, config, clock_resolution, reporter);
+  const auto cost =
+      measure_result.second ? median(times_from_measurements(measure_result.first)) : FpNs{0.0};
+
+  reporter.estimate_clock_cost_ended(cost);
+
+  return cost;
+}
+}
+
+namespace velox {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+struct TextReporter : Reporter {
+  TextReporter(std::ostream &os) : os_(os), num_resamples_(0) {}
+
+  TextReporter &operator=(const TextReporter &rhs) = delete;
+
+  void suite_starting(const std::string &clock, bool is_steady) override {
+    os_ << "Benchmarking with `" << clock << "` which is " << (is_steady ? "steady" : "unsteady")
+        << "\n";
+  }
+
+  void quick_mode_enabled() override {
+    os_ << "Quick mode: short samples and approximate analytic confidence intervals\n";
+  }
+
+  void merge_refused(const std::string &checkpoint,
+                     const std::string &checkpoint_environment,
+                     const std::string &environment) override {
+    os_ << "Not merging the shards: " << checkpoint << " was written in a different environment\n";
+    os_ << "  > Checkpoint: "
+        << (checkpoint_environment.empty() ? "unknown" : checkpoint_environment) << "\n";
+    os_ << "  > This run:   " << environment << "\n";
+    os_ << "  > Its benchmarks are left out of the report\n\n";
+  }
+
+  void estimate_clock_cost_starting() override {
+    os_ << "Estimating the cost of the clock\n";
+    os_.flush();
+  }
+
+  void estimate_clock_cost_ended(FpNs cost) override {
+    os_ << "> Median: ";
+    os_.write_general(cost.count(), 6);
+    os_ << " ns\n\n";
+  }
+
+  void clock_resolution_estimated(FpNs resolution) override {
+    os_ << "> Clock resolution: ";
+    format_time(os_, resolution);
+    os_ << "\n\n";
+  }
+
+  void benchmark_starting(const std::string &name) override {
+    os_ << "Benchmarking " << name << "\n";
+  }
+
+  void warm_up_starting(Ms ms) override {
+    os_ << "> Warming up for " << ms.count() << " ms\n";
+    os_.flush();
+  }
+
+  void warm_up_failed(const ItersForDurationNs &wu) override {
+    os_ << "> Warm up failed\n";
+    os_ << "  > " << wu.iters() << " iterations of the function took ";
+    format_time(os_, wu.duration());
+    os_ << "\n";
+    os_ << "  > The function is unable to be benchmarked because it takes so little time.\n";
+    os_.flush();
+  }
+
+  void measurement_collection_starting(std::uint32_t num_measurements,
+                                       FpNs measurement_time) override {
+    os_ << "> Collecting " << num_measurements << " measurements in estimated ";
+
+    format_time(os_, measurement_time);
+    os_ << "\n";
+    os_.flush();
+  }
+
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    os_ << "> Warning: " << num_short << " of " << num_measurements
+        << " measurements were shorter than ";
+    format_time(os_, min_duration);
+    os_ << ", the clock's resolution may distort them\n";
+  }
+
+  void measurement_collection_ended(const Measurements &,
+                                    const Times &,
+                                    const SampleSummary &,
+                                    const Outliers &outliers) override {
+    const auto num_high_severe = outliers.count(OutlierSeverity::high_severe);
+    const auto num_high_mild = outliers.count(OutlierSeverity::high_mild);
+    const auto num_low_mild = outliers.count(OutlierSeverity::low_mild);
+    const auto num_low_severe = outliers.count(OutlierSeverity::low_severe);
+    const auto total = outliers.num_outliers();
+
+    const auto sample_size = outliers.size();
+
+    const auto percent = [sample_size](decltype(total) n) {
+      return 100.0 * static_cast<double>(n) / static_cast<double>(sample_size);
+    };
+
+    os_ << "> Found " << total << " outliers among " << sample_size << " measurements (";
+    os_.write_general(percent(total), 6);
+    os_ << "%)\n";
+
+    if (total == 0) {
+      return;
+    }
+
+    const auto print = [this, &percent](decltype(total) n, const char *const type) {
+      if (n == 0) {
+        return;
+      }
+
+      os_ << "  > " << n << " (";
+      os_.write_general(percent(n), 6);
+      os_ << "%) " << type << "\n";
+    };
+
+    print(num_low_severe, "low severe");
+    print(num_low_mild, "low mild");
+    print(num_high_mild, "high mild");
+    print(num_high_severe, "high severe");
+  }
+
+  void autocorrelation_estimated(const Autocorrelation &autocorrelation) override {
+    if (!autocorrelation.significant()) {
+      return;
+    }
+
+    os_ << "> Measurements are autocorrelated (lag 1: ";
+    format_short(os_, autocorrelation.lag1());
+    os_ << ") and are worth about "
+        << static_cast<std::uint64_t>(std::round(autocorrelation.effective_sample_size()))
+        << " independent measurements\n";
+
+    if (autocorrelation.resample_method() == ResampleMethod::iid) {
+      os_ << "  > Confidence intervals are likely too narrow, consider a block bootstrap\n";
+    } else {
+      os_ << "  > Resampling blocks of ";
+      format_short(os_, autocorrelation.block_length());
+      os_ << " measurements\n";
+    }
+  }
+
+  void periodic_interference_estimated(const PeriodicInterference &interference) override {
+    if (!interference.significant()) {
+      return;
+    }
+
+    os_ << "> Measurements show periodic interference every ";
+    format_time(os_, interference.period());
+    os_ << " (";
+    format_short(os_, interference.variance_explained() * 100.0);
+    os_ << "% of the residual variance)\n";
+    if (interference.sequential_schedule()) {
+      os_ << "  > Consider a shuffled or low discrepancy iteration schedule\n";
+    }
+  }
+
+  void estimate_statistics_starting(std::uint32_t num_resamples) override {
+    os_ << "> estimating statistics\n";
+    if (num_resamples) {
+      os_ << "  > bootstrapping sample with " << num_resamples << " resamples\n";
+    } else {
+      os_ << "  > approximate analytic intervals (quick mode)\n";
+    }
+    num_resamples_ = num_resamples;
+    os_.flush();
+  }
+
+  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
+    if (statistics.num_resamples() != num_resamples_) {
+      os_ << "  > converged after " << statistics.num_resamples() << " resamples\n";
+    }
+
+    const auto time = [](BufferedWriter &out, const FpNs t) { format_time(out, t); };
+    auto format_estimate = [this, &time](const Estimate<FpNs> &e) { format(e, time); };
+
+    os_ << "  > mean     ";
+    format_estimate(statistics.mean().estimate());
+    os_ << "  > median   ";
+    format_estimate(statistics.median().estimate());
+    os_ << "  > SD       ";
+    format_estimate(statistics.std_dev().estimate());
+    os_ << "  > MAD      ";
+    format_estimate(statistics.median_abs_dev().estimate());
+    if (statistics.flat_sampling()) {
+      os_ << "  > flat sampling, no regression statistics\n";
+    } else {
+      os_ << "  > LLS      ";
+      format_estimate(statistics.linear_least_squares().estimate());
+      os_ << "  > slope    ";
+      format_estimate(statistics.slope().estimate());
+      os_ << "  > overhead ";
+      format_estimate(statistics.overhead().estimate());
+      os_ << "  > r^2      ";
+      format(statistics.r_squared().estimate(),
+             [](BufferedWriter &out, const double r2) { format_r2(out, r2); });
+    }
+
+    for (const auto &c : statistics.custom()) {
+      os_ << "  > " << c.name() << std::string(c.name().size() < 8 ? 8 - c.name().size() : 0, ' ')
+          << " ";
+      if (c.unit() == StatisticUnit::time) {
+        format(c.estimate(),
+               [](BufferedWriter &out, const double v) { format_time(out, FpNs(v)); });
+      } else {
+        format(c.estimate(), [](BufferedWriter &out, const double v) { format_short(out, v); });
+      }
+    }
+
+    const auto &ov = statistics.outlier_variance();
+    os_ << "  > variance introduced by outliers: ";
+    format_short(os_, ov.fraction() * 100.0);
+    os_ << "% (" << outlier_effect_name(ov.effect()) << ")\n";
+    os_ << "\n";
+  }
+
+  void benchmark_ended() override { os_.flush(); }
+
+  void load_test_starting(const std::string &name, const LoadConfig &config) override {
+    os_ << "Load testing " << name << "\n";
+    os_ << "> " << (config.arrival_process() == ArrivalProcess::fixed ? "Fixed" : "Poisson")
+        << " arrivals from " << config.num_threads() << " thread"
+        << (config.num_threads() == 1 ? "" : "s") << " for " << config.duration().count()
+        << " ms per rate\n";
+    os_.flush();
+  }
+
+  void load_point_measured(const LoadPoint &point) override {
+    os_ << "> ";
+    format_short(os_, point.target_rate());
+    os_ << " req/s: ";
+    format_short(os_, point.throughput());
+    os_ << " req/s completed\n";
+
+    os_ << "  > latency p50 ";
+    format_time(os_, point.latency(50));
+    os_ << ", p90 ";
+    format_time(os_, point.latency(90));
+    os_ << ", p99 ";
+    format_time(os_, point.latency(99));
+    os_ << ", p99.9 ";
+    format_time(os_, point.latency(99.9));
+    os_ << ", max ";
+    format_time(os_, point.max_latency());
+    os_ << "\n";
+
+    os_ << "  > service time p50 ";
+    format_time(os_, point.service_time(50));
+    os_ << ", p99 ";
+    format_time(os_, point.service_time(99));
+    os_ << "\n";
+
+    if (point.throughput() < 0.9 * point.target_rate()) {
+      os_ << "  > Unable to keep up with the target rate, requests are queueing\n";
+    }
+    os_.flush();
+  }
+
+  void load_test_ended() override {
+    os_ << "\n";
+    os_.flush();
+  }
+
+  void suite_ended() override { os_.flush(); }
+
+private:
+  template <class E, class F>
+  void format(const E &e, F &&f) {
+    f(os_, e.point());
+
+    // Quick mode has no interval for some statistics
+    if (!num_resamples_ && !(e.lower_bound() < e.upper_bound())) {
+      os_ << " (no interval)\n";
+      return;
+    }
+
+    os_ << " +/- ";
+    f(os_, e.standard_error());
+    os_ << " [";
+    f(os_, e.lower_bound());
+    os_ << " ";
+    f(os_, e.upper_bound());
+    os_ << "] ";
+    os_.write_general(e.confidence_level() * 100, 6);
+    os_ << (num_resamples_ ? "% CI\n" : "% CI (approximate)\n");
+  }
+
+private:
+  // Flushed before each phase which takes a while so progress can be followed
+  BufferedWriter os_;
+  std::uint32_t num_resamples_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+namespace velox {
+
+namespace detail {
+  template <std::size_t N>
+  std::string string_from_cstrs(const char *const (&cstrs)[N]) {
+    std::string s;
+    for (auto cstr : cstrs) {
+      s += cstr;
+    }
+    return s;
+  }
+
+  // The start of every HTML page velox writes, up to and including the scripts for jQuery and
+  // Highcharts
+  inline const std::string &html_template_libraries() {
+    static const char *const pieces[] = {
+R"***^***(<!doctype html>
+<html lang="">
+    <head>
+        <meta charset="utf-8">
+        <meta http-equiv="X-UA-Compatible" content="IE=edge">
+        <title>Benchmark Results - generated by velox</title>
+        <meta name="description" content="">
+        <meta name="viewport" content="width=device-width, initial-scale=1">
+
+        <style>
+            /*! normalize.css v3.0.1 | MIT License | git.io/normalize */
+
+            /**
+             * 1. Set default font family to sans-serif.
+             * 2. Prevent iOS text size adjust after orientation change, without disabling
+             *    user zoom.
+             */
+
+            html {
+              font-family: sans-serif; /* 1 */
+              -ms-text-size-adjust: 100%; /* 2 */
+              -webkit-text-size-adjust: 100%; /* 2 */
+            }
+
+            /**
+             * Remove default margin.
+             */
+
+            body {
+              margin: 0;
+            }
+
+            /* HTML5 display definitions
+               ========================================================================== */
+
+            /**
+             * Correct `block` display not defined for any HTML5 element in IE 8/9.
+             * Correct `block` display not defined for `details` or `summary` in IE 10/11 and Firefox.
+             * Correct `block` display not defined for `main` in IE 11.
+             */
+
+            article,
+            aside,
+            details,
+            figcaption,
+            figure,
+            footer,
+            header,
+            hgroup,
+            main,
+            nav,
+            section,
+            summary {
+              display: block;
+            }
+
+            /**
+             * 1. Correct `inline-block` display not defined in IE 8/9.
+             * 2. Normalize vertical alignment of `progress` in Chrome, Firefox, and Opera.
+             */
+
+            audio,
+            canvas,
+            progress,
+            video {
+              display: inline-block; /* 1 */
+              vertical-align: baseline; /* 2 */
+            }
+
+            /**
+             * Prevent modern browsers from displaying `audio` without controls.
+             * Remove excess height in iOS 5 devices.
+             */
+
+            audio:not([controls]) {
+              display: none;
+              height: 0;
+            }
+
+            /**
+             * Address `[hidden]` styling not present in IE 8/9/10.
+             * Hide the `template` element in IE 8/9/11, Safari, and Firefox < 22.
+             */
+
+            [hidden],
+            template {
+              display: none;
+            }
+
+            /* Links
+               ========================================================================== */
+
+            /**
+             * Remove the gray background color from active links in IE 10.
+             */
+
+            a {
+              background: transparent;
+            }
+
+            /**
+             * Improve readability when focused and also mouse hovered in all browsers.
+             */
+
+            a:active,
+            a:hover {
+              outline: 0;
+            }
+
+            /* Text-level semantics
+               ========================================================================== */
+
+            /**
+             * Address styling not present in IE 8/9/10/11, Safari, and Chrome.
+             */
+
+            abbr[title] {
+              border-bottom: 1px dotted;
+            }
+
+            /**
+             * Address style set to `bolder` in Firefox 4+, Safari, and Chrome.
+             */
+
+            b,
+            strong {
+              font-weight: bold;
+            }
+
+            /**
+             * Address styling not present in Safari and Chrome.
+             */
+
+            dfn {
+              font-style: italic;
+            }
+
+            /**
+             * Address variable `h1` font-size and margin within `section` and `article`
+             * contexts in Firefox 4+, Safari, and Chrome.
+             */
+
+            h1 {
+              font-size: 2em;
+              margin: 0.67em 0;
+            }
+
+            /**
+             * Address styling not present in IE 8/9.
+             */
+
+            mark {
+              background: #ff0;
+              color: #000;
+            }
+
+            /**
+             * Address inconsistent and variable font size in all browsers.
+             */
+
+            small {
+              font-size: 80%;
+            }
+
+            /**
+             * Prevent `sub` and `sup` affecting `line-height` in all browsers.
+             */
+
+            sub,
+            sup {
+              font-size: 75%;
+              line-height: 0;
+              position: relative;
+              vertical-align: baseline;
+            }
+
+            sup {
+              top: -0.5em;
+            }
+
+            sub {
+              bottom: -0.25em;
+            }
+
+            /* Embedded content
+               ========================================================================== */
+
+            /**
+             * Remove border when inside `a` element in IE 8/9/10.
+             */
+
+            img {
+              border: 0;
+            }
+
+            /**
+             * Correct overflow not hidden in IE 9/10/11.
+             */
+
+            svg:not(:root) {
+              overflow: hidden;
+            }
+
+            /* Grouping content
+               ========================================================================== */
+
+            /**
+             * Address margin not present in IE 8/9 and Safari.
+             */
+
+            figure {
+              margin: 1em 40px;
+            }
+
+            /**
+             * Address differences between Firefox and other browsers.
+             */
+
+            hr {
+              -moz-box-sizing: content-box;
+              box-sizing: content-box;
+              height: 0;
+            }
+
+            /**
+             * Contain overflow in all browsers.
+             */
+
+            pre {
+              overflow: auto;
+            }
+
+            /**
+             * Address odd `em`-unit font size rendering in all browsers.
+             */
+
+            code,
+            kbd,
+            pre,
+            samp {
+              font-family: monospace, monospace;
+              font-size: 1em;
+            }
+
+            /* Forms
+               ========================================================================== */
+
+            /**
+             * Known limitation: by default, Chrome and Safari on OS X allow very limited
+             * styling of `select`, unless a `border` property is set.
+             */
+
+            /**
+             * 1. Correct color not being inherited.
+             *    Known issue: affects color of disabled elements.
+             * 2. Correct font properties not being inherited.
+             * 3. Address margins set differently in Firefox 4+, Safari, and Chrome.
+             */
+
+            button,
+            input,
+            optgroup,
+            select,
+            textarea {
+              color: inherit; /* 1 */
+              font: inherit; /* 2 */
+              margin: 0; /* 3 */
+            }
+
+            /**
+             * Address `overflow` set to `hidden` in IE 8/9/10/11.
+             */
+
+            button {
+              overflow: visible;
+            }
+
+            /**
+             * Address inconsistent `text-transform` inheritance for `button` and `select`.
+             * All other form control elements do not inherit `text-transform` values.
+             * Correct `button` style inheritance in Firefox, IE 8/9/10/11, and Opera.
+             * Correct `select` style inheritance in Firefox.
+             */
+
+            button,
+            select {
+              text-transform: none;
+            }
+
+            /**
+             * 1. Avoid the WebKit bug in Android 4.0.* where (2) destroys native `audio`
+             *    and `video` controls.
+             * 2. Correct inability to style clickable `input` types in iOS.
+             * 3. Improve usability and consistency of cursor style between image-type
+             *    `input` and others.
+             */
+
+            button,
+            html input[type="button"], /* 1 */
+            input[type="reset"],
+            input[type="submit"] {
+              -webkit-appearance: button; /* 2 */
+              cursor: pointer; /* 3 */
+            }
+
+            /**
+             * Re-set default cursor for disabled elements.
+             */
+
+            button[disabled],
+            html input[disabled] {
+              cursor: default;
+            }
+
+            /**
+             * Remove inner padding and border in Firefox 4+.
+             */
+
+            button::-moz-focus-inner,
+            input::-moz-focus-inner {
+              border: 0;
+              padding: 0;
+            }
+
+            /**
+             * Address Firefox 4+ setting `line-height` on `input` using `!important` in
+             * the UA stylesheet.
+             */
+
+            input {
+              line-height: normal;
+            }
+
+            /**
+             * It's recommended that you don't attempt to style these elements.
+             * Firefox's implementation doesn't respect box-sizing, padding, or width.
+             *
+             * 1. Address box sizing set to `content-box` in IE 8/9/10.
+             * 2. Remove excess padding in IE 8/9/10.
+             */
+
+            input[type="checkbox"],
+            input[type="radio"] {
+              box-sizing: border-box; /* 1 */
+              padding: 0; /* 2 */
+            }
+
+            /**
+             * Fix the cursor style for Chrome's increment/decrement buttons. For certain
+             * `font-size` values of the `input`, it causes the cursor style of the
+             * decrement button to change from `default` to `text`.
+             */
+
+            input[type="number"]::-webkit-inner-spin-button,
+            input[type="number"]::-webkit-outer-spin-button {
+              height: auto;
+            }
+
+            /**
+             * 1. Address `appearance` set to `searchfield` in Safari and Chrome.
+   )***^***",
+R"***^***(          * 2. Address `box-sizing` set to `border-box` in Safari and Chrome
+             *    (include `-moz` to future-proof).
+             */
+
+            input[type="search"] {
+              -webkit-appearance: textfield; /* 1 */
+              -moz-box-sizing: content-box;
+              -webkit-box-sizing: content-box; /* 2 */
+              box-sizing: content-box;
+            }
+
+            /**
+             * Remove inner padding and search cancel button in Safari and Chrome on OS X.
+             * Safari (but not Chrome) clips the cancel button when the search input has
+             * padding (and `textfield` appearance).
+             */
+
+            input[type="search"]::-webkit-search-cancel-button,
+            input[type="search"]::-webkit-search-decoration {
+              -webkit-appearance: none;
+            }
+
+            /**
+             * Define consistent border, margin, and padding.
+             */
+
+            fieldset {
+              border: 1px solid #c0c0c0;
+              margin: 0 2px;
+              padding: 0.35em 0.625em 0.75em;
+            }
+
+            /**
+             * 1. Correct `color` not being inherited in IE 8/9/10/11.
+             * 2. Remove padding so people aren't caught out if they zero out fieldsets.
+             */
+
+            legend {
+              border: 0; /* 1 */
+              padding: 0; /* 2 */
+            }
+
+            /**
+             * Remove default vertical scrollbar in IE 8/9/10/11.
+             */
+
+            textarea {
+              overflow: auto;
+            }
+
+            /**
+             * Don't inherit the `font-weight` (applied by a rule above).
+             * NOTE: the default cannot safely be changed in Chrome and Safari on OS X.
+             */
+
+            optgroup {
+              font-weight: bold;
+            }
+
+            /* Tables
+               ========================================================================== */
+
+            /**
+             * Remove most spacing between table cells.
+             */
+
+            table {
+              border-collapse: collapse;
+              border-spacing: 0;
+            }
+
+            td,
+            th {
+              padding: 0;
+            }
+        </style>
+
+        <script>
+        /*! jQuery v2.1.1 | (c) 2005, 2014 jQuery Foundation, Inc. | jquery.org/license */
+!function(a,b){"object"==typeof module&&"object"==typeof module.exports?module.exports=a.document?b(a,!0):function(a){if(!a.document)throw new Error("jQuery requires a window with a document");return b(a)}:b(a)}("undefined"!=typeof window?window:this,function(a,b){var c=[],d=c.slice,e=c.concat,f=c.push,g=c.indexOf,h={},i=h.toString,j=h.hasOwnProperty,k={},l=a.document,m="2.1.1",n=function(a,b){return new n.fn.init(a,b)},o=/^[\s\uFEFF\xA0]+|[\s\uFEFF\xA0]+$/g,p=/^-ms-/,q=/-([\da-z])/gi,r=function(a,b){return b.toUpperCase()};n.fn=n.prototype={jquery:m,constructor:n,selector:"",length:0,toArray:function(){return d.call(this)},get:function(a){return null!=a?0>a?this[a+this.length]:this[a]:d.call(this)},pushStack:function(a){var b=n.merge(this.constructor(),a);return b.prevObject=this,b.context=this.context,b},each:function(a,b){return n.each(this,a,b)},map:function(a){return this.pushStack(n.map(this,function(b,c){return a.call(b,c,b)}))},slice:function(){return this.pushStack(d.apply(this,arguments))},first:function(){return this.eq(0)},last:function(){return this.eq(-1)},eq:function(a){var b=this.length,c=+a+(0>a?b:0);return this.pushStack(c>=0&&b>c?[this[c]]:[])},end:function(){return this.prevObject||this.constructor(null)},push:f,sort:c.sort,splice:c.splice},n.extend=n.fn.extend=function(){var a,b,c,d,e,f,g=arguments[0]||{},h=1,i=arguments.length,j=!1;for("boolean"==typeof g&&(j=g,g=arguments[h]||{},h++),"object"==typeof g||n.isFunction(g)||(g={}),h===i&&(g=this,h--);i>h;h++)if(null!=(a=arguments[h]))for(b in a)c=g[b],d=a[b],g!==d&&(j&&d&&(n.isPlainObject(d)||(e=n.isArray(d)))?(e?(e=!1,f=c&&n.isArray(c)?c:[]):f=c&&n.isPlainObject(c)?c:{},g[b]=n.extend(j,f,d)):void 0!==d&&(g[b]=d));return g},n.extend({expando:"jQuery"+(m+Math.random()).replace(/\D/g,""),isReady:!0,error:function(a){throw new Error(a)},noop:function(){},isFunction:function(a){return"function"===n.type(a)},isArray:Array.isArray,isWindow:function(a){return null!=a&&a===a.window},isNumeric:function(a){return!n.isArray(a)&&a-parseFloat(a)>=0},isPlainObject:function(a){return"object"!==n.type(a)||a.nodeType||n.isWindow(a)?!1:a.constructor&&!j.call(a.constructor.prototype,"isPrototypeOf")?!1:!0},isEmptyObject:function(a){var b;for(b in a)return!1;return!0},type:function(a){return null==a?a+"":"object"==typeof a||"function"==typeof a?h[i.call(a)]||"object":typeof a},globalEval:function(a){var b,c=eval;a=n.trim(a),a&&(1===a.indexOf("use strict")?(b=l.createElement("script"),b.text=a,l.head.appendChild(b).parentNode.removeChild(b)):c(a))},camelCase:function(a){return a.replace(p,"ms-").replace(q,r)},nodeName:function(a,b){return a.nodeName&&a.nodeName.toLowerCase()===b.toLowerCase()},each:function(a,b,c){var d,e=0,f=a.length,g=s(a);if(c){if(g){for(;f>e;e++)if(d=b.apply(a[e],c),d===!1)break}else for(e in a)if(d=b.apply(a[e],c),d===!1)break}else if(g){for(;f>e;e++)if(d=b.call(a[e],e,a[e]),d===!1)break}else for(e in a)if(d=b.call(a[e],e,a[e]),d===!1)break;return a},trim:function(a){return null==a?"":(a+"").replace(o,"")},makeArray:function(a,b){var c=b||[];return null!=a&&(s(Object(a))?n.merge(c,"string"==typeof a?[a]:a):f.call(c,a)),c},inArray:function(a,b,c){return null==b?-1:g.call(b,a,c)},merge:function(a,b){for(var c=+b.length,d=0,e=a.length;c>d;d++)a[e++]=b[d];return a.length=e,a},grep:function(a,b,c){for(var d,e=[],f=0,g=a.length,h=!c;g>f;f++)d=!b(a[f],f),d!==h&&e.push(a[f]);return e},map:function(a,b,c){var d,f=0,g=a.length,h=s(a),i=[];if(h)for(;g>f;f++)d=b(a[f],f,c),null!=d&&i.push(d);else for(f in a)d=b(a[f],f,c),null!=d&&i.push(d);return e.apply([],i)},guid:1,proxy:function(a,b){var c,e,f;return"string"==typeof b&&(c=a[b],b=a,a=c),n.isFunction(a)?(e=d.call(arguments,2),f=function(){return a.apply(b||this,e.concat(d.call(arguments)))},f.guid=a.guid=a.guid||n.guid++,f):void 0},now:Date.now,support:k}),n.each("Boolean Number String Function Array Date RegExp Object Error".split(" "),function(a,b){h["[object "+b+"]"]=b.toLowerCase()});function s(a){var b=a.length,c=n.type(a);return"function"===c||n.isWindow(a)?!1:1===a.nodeType&&b?!0:"array"===c||0===b||"number"==typeof b&&b>0&&b-1 in a}var t=function(a){var b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u="sizzle"+-new Date,v=a.document,w=0,x=0,y=gb(),z=gb(),A=gb(),B=function(a,b){return a===b&&(l=!0),0},C="undefined",D=1<<31,E={}.hasOwnProperty,F=[],G=F.pop,H=F.push,I=F.push,J=F.slice,K=F.indexOf||function(a){for(var b=0,c=this.length;c>b;b++)if(this[b]===a)return b;return-1},L="checked|selected|async|autofocus|autoplay|controls|defer|disabled|hidden|ismap|loop|multiple|open|readonly|required|scoped",M="[\\x20\\t\\r\\n\\f]",N="(?:\\\\.|[\\w-]|[^\\x00-\\xa0])+",O=N.replace("w","w#"),P="\\["+M+"*("+N+")(?:"+M+"*([*^$|!~]?=)"+M+"*(?:'((?:\\\\.|[^\\\\'])*)'|\"((?:\\\\.|[^\\\\\"])*)\"|("+O+"))|)"+M+"*\\]",Q=":("+N+")(?:\\((('((?:\\\\.|[^\\\\'])*)'|\"((?:\\\\.|[^\\\\\"])*)\")|((?:\\\\.|[^\\\\()[\\]]|"+P+")*)|.*)\\)|)",R=new RegExp("^"+M+"+|((?:^|[^\\\\])(?:\\\\.)*)"+M+"+$","g"),S=new RegExp("^"+M+"*,"+M+"*"),T=new RegExp("^"+M+"*([>+~]|"+M+")"+M+"*"),U=new RegExp("="+M+"*([^\\]'\"]*?)"+M+"*\\]","g"),V=new RegExp(Q),W=new RegExp("^"+O+"$"),X={ID:new RegExp("^#("+N+")"),CLASS:new RegExp("^\\.("+N+")"),TAG:new RegExp("^("+N.replace("w","w*")+")"),ATTR:new RegExp("^"+P),PSEUDO:new RegExp("^"+Q),CHILD:new RegExp("^:(only|first|last|nth|nth-last)-(child|of-type)(?:\\("+M+"*(even|odd|(([+-]|)(\\d*)n|)"+M+"*(?:([+-]|)"+M+"*(\\d+)|))"+M+"*\\)|)","i"),bool:new RegExp("^(?:"+L+")$","i"),needsContext:new RegExp("^"+M+"*[>+~]|:(even|odd|eq|gt|lt|nth|first|last)(?:\\("+M+"*((?:-\\d)?\\d*)"+M+"*\\)|)(?=[^-]|$)","i")},Y=/^(?:input|select|textarea|button)$/i,Z=/^h\d$/i,$=/^[^{]+\{\s*\[native \w/,_=/^(?:#([\w-]+)|(\w+)|\.([\w-]+))$/,ab=/[+~]/,bb=/'|\\/g,cb=new RegExp("\\\\([\\da-f]{1,6}"+M+"?|("+M+")|.)","ig"),db=function(a,b,c){var d="0x"+b-65536;return d!==d||c?b:0>d?String.fromCharCode(d+65536):String.fromCharCode(d>>10|55296,1023&d|56320)};try{I.apply(F=J.call(v.childNodes),v.childNodes),F[v.childNodes.length].nodeType}catch(eb){I={apply:F.length?function(a,b){H.apply(a,J.call(b))}:function(a,b){var c=a.length,d=0;while(a[c++]=b[d++]);a.length=c-1}}}function fb(a,b,d,e){var f,h,j,k,l,o,r,s,w,x;if((b?b.ownerDocument||b:v)!==n&&m(b),b=b||n,d=d||[],!a||"string"!=typeof a)return d;if(1!==(k=b.nodeType)&&9!==k)return[];if(p&&!e){if(f=_.exec(a))if(j=f[1]){if(9===k){if(h=b.getElementById(j),!h||!h.parentNode)return d;if(h.id===j)return d.push(h),d}else if(b.ownerDocument&&(h=b.ownerDocument.getElementById(j))&&t(b,h)&&h.id===j)return d.push(h),d}else{if(f[2])return I.apply(d,b.getElementsByTagName(a)),d;if((j=f[3])&&c.getElementsByClassName&&b.getElementsByClassName)return I.apply(d,b.getElementsByClassName(j)),d}if(c.qsa&&(!q||!q.test(a))){if(s=r=u,w=b,x=9===k&&a,1===k&&"object"!==b.nodeName.toLowerCase()){o=g(a),(r=b.getAttribute("id"))?s=r.replace(bb,"\\$&"):b.setAttribute("id",s),s="[id='"+s+"'] ",l=o.length;while(l--)o[l]=s+qb(o[l]);w=ab.test(a)&&ob(b.parentNode)||b,x=o.join(",")}if(x)try{return I.apply(d,w.querySelectorAll(x)),d}catch(y){}finally{r||b.removeAttribute("id")}}}return i(a.replace(R,"$1"),b,d,e)}function gb(){var a=[];function b(c,e){return a.push(c+" ")>d.cacheLength&&delete b[a.shift()],b[c+" "]=e}return b}function hb(a){return a[u]=!0,a}function ib(a){var b=n.createElement("div");try{return!!a(b)}catch(c){return!1}finally{b.parentNode&&b.parentNode.removeChild(b),b=null}}function jb(a,b){var c=a.split("|"),e=a.length;while(e--)d.attrHandle[c[e]]=b}function kb(a,b){var c=b&&a,d=c&&1===a.nodeType&&1===b.nodeType&&(~b.sourceIndex||D)-(~a.sourceIndex||D);if(d)return d;if(c)while(c=c.nextSibling)if(c===b)return-1;return a?1:-1)***^***",
+R"***^***(}function lb(a){return function(b){var c=b.nodeName.toLowerCase();return"input"===c&&b.type===a}}function mb(a){return function(b){var c=b.nodeName.toLowerCase();return("input"===c||"button"===c)&&b.type===a}}function nb(a){return hb(function(b){return b=+b,hb(function(c,d){var e,f=a([],c.length,b),g=f.length;while(g--)c[e=f[g]]&&(c[e]=!(d[e]=c[e]))})})}function ob(a){return a&&typeof a.getElementsByTagName!==C&&a}c=fb.support={},f=fb.isXML=function(a){var b=a&&(a.ownerDocument||a).documentElement;return b?"HTML"!==b.nodeName:!1},m=fb.setDocument=function(a){var b,e=a?a.ownerDocument||a:v,g=e.defaultView;return e!==n&&9===e.nodeType&&e.documentElement?(n=e,o=e.documentElement,p=!f(e),g&&g!==g.top&&(g.addEventListener?g.addEventListener("unload",function(){m()},!1):g.attachEvent&&g.attachEvent("onunload",function(){m()})),c.attributes=ib(function(a){return a.className="i",!a.getAttribute("className")}),c.getElementsByTagName=ib(function(a){return a.appendChild(e.createComment("")),!a.getElementsByTagName("*").length}),c.getElementsByClassName=$.test(e.getElementsByClassName)&&ib(function(a){return a.innerHTML="<div class='a'></div><div class='a i'></div>",a.firstChild.className="i",2===a.getElementsByClassName("i").length}),c.getById=ib(function(a){return o.appendChild(a).id=u,!e.getElementsByName||!e.getElementsByName(u).length}),c.getById?(d.find.ID=function(a,b){if(typeof b.getElementById!==C&&p){var c=b.getElementById(a);return c&&c.parentNode?[c]:[]}},d.filter.ID=function(a){var b=a.replace(cb,db);return function(a){return a.getAttribute("id")===b}}):(delete d.find.ID,d.filter.ID=function(a){var b=a.replace(cb,db);return function(a){var c=typeof a.getAttributeNode!==C&&a.getAttributeNode("id");return c&&c.value===b}}),d.find.TAG=c.getElementsByTagName?function(a,b){return typeof b.getElementsByTagName!==C?b.getElementsByTagName(a):void 0}:function(a,b){var c,d=[],e=0,f=b.getElementsByTagName(a);if("*"===a){while(c=f[e++])1===c.nodeType&&d.push(c);return d}return f},d.find.CLASS=c.getElementsByClassName&&function(a,b){return typeof b.getElementsByClassName!==C&&p?b.getElementsByClassName(a):void 0},r=[],q=[],(c.qsa=$.test(e.querySelectorAll))&&(ib(function(a){a.innerHTML="<select msallowclip=''><option selected=''></option></select>",a.querySelectorAll("[msallowclip^='']").length&&q.push("[*^$]="+M+"*(?:''|\"\")"),a.querySelectorAll("[selected]").length||q.push("\\["+M+"*(?:value|"+L+")"),a.querySelectorAll(":checked").length||q.push(":checked")}),ib(function(a){var b=e.createElement("input");b.setAttribute("type","hidden"),a.appendChild(b).setAttribute("name","D"),a.querySelectorAll("[name=d]").length&&q.push("name"+M+"*[*^$|!~]?="),a.querySelectorAll(":enabled").length||q.push(":enabled",":disabled"),a.querySelectorAll("*,:x"),q.push(",.*:")})),(c.matchesSelector=$.test(s=o.matches||o.webkitMatchesSelector||o.mozMatchesSelector||o.oMatchesSelector||o.msMatchesSelector))&&ib(function(a){c.disconnectedMatch=s.call(a,"div"),s.call(a,"[s!='']:x"),r.push("!=",Q)}),q=q.length&&new RegExp(q.join("|")),r=r.length&&new RegExp(r.join("|")),b=$.test(o.compareDocumentPosition),t=b||$.test(o.contains)?function(a,b){var c=9===a.nodeType?a.documentElement:a,d=b&&b.parentNode;return a===d||!(!d||1!==d.nodeType||!(c.contains?c.contains(d):a.compareDocumentPosition&&16&a.compareDocumentPosition(d)))}:function(a,b){if(b)while(b=b.parentNode)if(b===a)return!0;return!1},B=b?function(a,b){if(a===b)return l=!0,0;var d=!a.compareDocumentPosition-!b.compareDocumentPosition;return d?d:(d=(a.ownerDocument||a)===(b.ownerDocument||b)?a.compareDocumentPosition(b):1,1&d||!c.sortDetached&&b.compareDocumentPosition(a)===d?a===e||a.ownerDocument===v&&t(v,a)?-1:b===e||b.ownerDocument===v&&t(v,b)?1:k?K.call(k,a)-K.call(k,b):0:4&d?-1:1)}:function(a,b){if(a===b)return l=!0,0;var c,d=0,f=a.parentNode,g=b.parentNode,h=[a],i=[b];if(!f||!g)return a===e?-1:b===e?1:f?-1:g?1:k?K.call(k,a)-K.call(k,b):0;if(f===g)return kb(a,b);c=a;while(c=c.parentNode)h.unshift(c);c=b;while(c=c.parentNode)i.unshift(c);while(h[d]===i[d])d++;return d?kb(h[d],i[d]):h[d]===v?-1:i[d]===v?1:0},e):n},fb.matches=function(a,b){return fb(a,null,null,b)},fb.matchesSelector=function(a,b){if((a.ownerDocument||a)!==n&&m(a),b=b.replace(U,"='$1']"),!(!c.matchesSelector||!p||r&&r.test(b)||q&&q.test(b)))try{var d=s.call(a,b);if(d||c.disconnectedMatch||a.document&&11!==a.document.nodeType)return d}catch(e){}return fb(b,n,null,[a]).length>0},fb.contains=function(a,b){return(a.ownerDocument||a)!==n&&m(a),t(a,b)},fb.attr=function(a,b){(a.ownerDocument||a)!==n&&m(a);var e=d.attrHandle[b.toLowerCase()],f=e&&E.call(d.attrHandle,b.toLowerCase())?e(a,b,!p):void 0;return void 0!==f?f:c.attributes||!p?a.getAttribute(b):(f=a.getAttributeNode(b))&&f.specified?f.value:null},fb.error=function(a){throw new Error("Syntax error, unrecognized expression: "+a)},fb.uniqueSort=function(a){var b,d=[],e=0,f=0;if(l=!c.detectDuplicates,k=!c.sortStable&&a.slice(0),a.sort(B),l){while(b=a[f++])b===a[f]&&(e=d.push(f));while(e--)a.splice(d[e],1)}return k=null,a},e=fb.getText=function(a){var b,c="",d=0,f=a.nodeType;if(f){if(1===f||9===f||11===f){if("string"==typeof a.textContent)return a.textContent;for(a=a.firstChild;a;a=a.nextSibling)c+=e(a)}else if(3===f||4===f)return a.nodeValue}else while(b=a[d++])c+=e(b);return c},d=fb.selectors={cacheLength:50,createPseudo:hb,match:X,attrHandle:{},find:{},relative:{">":{dir:"parentNode",first:!0}," ":{dir:"parentNode"},"+":{dir:"previousSibling",first:!0},"~":{dir:"previousSibling"}},preFilter:{ATTR:function(a){return a[1]=a[1].replace(cb,db),a[3]=(a[3]||a[4]||a[5]||"").replace(cb,db),"~="===a[2]&&(a[3]=" "+a[3]+" "),a.slice(0,4)},CHILD:function(a){return a[1]=a[1].toLowerCase(),"nth"===a[1].slice(0,3)?(a[3]||fb.error(a[0]),a[4]=+(a[4]?a[5]+(a[6]||1):2*("even"===a[3]||"odd"===a[3])),a[5]=+(a[7]+a[8]||"odd"===a[3])):a[3]&&fb.error(a[0]),a},PSEUDO:function(a){var b,c=!a[6]&&a[2];return X.CHILD.test(a[0])?null:(a[3]?a[2]=a[4]||a[5]||"":c&&V.test(c)&&(b=g(c,!0))&&(b=c.indexOf(")",c.length-b)-c.length)&&(a[0]=a[0].slice(0,b),a[2]=c.slice(0,b)),a.slice(0,3))}},filter:{TAG:function(a){var b=a.replace(cb,db).toLowerCase();return"*"===a?function(){return!0}:function(a){return a.nodeName&&a.nodeName.toLowerCase()===b}},CLASS:function(a){var b=y[a+" "];return b||(b=new RegExp("(^|"+M+")"+a+"("+M+"|$)"))&&y(a,function(a){return b.test("string"==typeof a.className&&a.className||typeof a.getAttribute!==C&&a.getAttribute("class")||"")})},ATTR:function(a,b,c){return function(d){var e=fb.attr(d,a);return null==e?"!="===b:b?(e+="","="===b?e===c:"!="===b?e!==c:"^="===b?c&&0===e.indexOf(c):"*="===b?c&&e.indexOf(c)>-1:"$="===b?c&&e.slice(-c.length)===c:"~="===b?(" "+e+" ").indexOf(c)>-1:"|="===b?e===c||e.slice(0,c.length+1)===c+"-":!1):!0}},CHILD:function(a,b,c,d,e){var f="nth"!==a.slice(0,3),g="last"!==a.slice(-4),h="of-type"===b;return 1===d&&0===e?function(a){return!!a.parentNode}:function(b,c,i){var j,k,l,m,n,o,p=f!==g?"nextSibling":"previousSibling",q=b.parentNode,r=h&&b.nodeName.toLowerCase(),s=!i&&!h;if(q){if(f){while(p){l=b;while(l=l[p])if(h?l.nodeName.toLowerCase()===r:1===l.nodeType)return!1;o=p="only"===a&&!o&&"nextSibling"}return!0}if(o=[g?q.firstChild:q.lastChild],g&&s){k=q[u]||(q[u]={}),j=k[a]||[],n=j[0]===w&&j[1],m=j[0]===w&&j[2],l=n&&q.childNodes[n];while(l=++n&&l&&l[p]||(m=n=0)||o.pop())if(1===l.nodeType&&++m&&l===b){k[a]=[w,n,m];break}}else if(s&&(j=(b[u]||(b[u]={}))[a])&&j[0]===w)m=j[1];else while(l=++n&&l&&l[p]||(m=n=0)||o.pop())if((h?l.nodeName.toLowerCase()===r:1===l.nodeType)&&++m&&(s&&((l[u]||(l[u]={}))[a]=[w,m]),l===b))break;return m-=e,m===d||m%d===0&&m/d>=0}}},PSEUDO:function(a,b){var c,e=d.pseudos[a]||d.setFilters[a.toLowerCase()]||fb.error("unsupported pseudo: "+a);return e[u]?e(b):e.length>1?(c=[a,a,"",b],d.setFilters.hasOwnProperty(a.toLowerCase())?hb(function(a,c){var d,f=e(a,b),g=f.length;while(g--)d=K.call(a,f[g]),a[d]=!(c[d]=f[g])}):function(a){return e(a,0,c)}):e}},pseudos:{not:hb(function(a){var b=[],c=[],d=h(a.replace(R,"$1"));return d[u]?hb(function(a,b,c,e){var f,g=d(a,null,e,[]),h=a.length;while(h--)(f=g[h])&&(a[h]=!(b[h]=f))}):function(a,e,f){return b[0]=a,d(b,null,f,c),!c.pop()}}),has:hb(function(a){return function(b){return fb(a,b).length>0}}),contains:hb(function(a){return function(b){return(b.textContent||b.innerText||e(b)).indexOf(a)>-1}}),lang:hb(function(a){return W.test(a||"")||fb.error("unsupported lang: "+a),a=a.replace(cb,db).toLowerCase(),function(b){var c;do if(c=p?b.lang:b.getAttribute("xml:lang")||b.getAttribute("lang"))return c=c.toLowerCase(),c===a||0===c.indexOf(a+"-");while((b=b.parentNode)&&1===b.nodeType);return!1}}),target:function(b){var c=a.location&&a.location.hash;return c&&c.slice(1)===b.id},root:function(a){return a===o},focus:function(a){return a===n.activeElement&&(!n.hasFocus||n.hasFocus())&&!!(a.type||a.href||~a.tabIndex)},enabled:function(a){return a.disabled===!1},disabled:function(a){return a.disabled===!0},checked:function(a){var b=a.nodeName.toLowerCase();return"input"===b&&!!a.checked||"option"===b&&!!a.selected},selected:function(a){return a.parentNode&&a.parentNode.selectedIndex,a.selected===!0},empty:function(a){for(a=a.firstChild;a;a=a.nextSibling)if(a.nodeType<6)return!1;return!0},parent:function(a){return!d.pseudos.empty(a)},header:function(a){return Z.test(a.nodeName)},input:function(a){return Y.test(a.nodeName)},button:function(a){var b=a.nodeName.toLowerCase();return"input"===b&&"button"===a.type||"button"===b},text:function(a){var b;return"input"===a.nodeName.toLowerCase()&&"text"===a.type&&(null==(b=a.getAttribute("type"))||"text"===b.toLowerCase())},first:nb(function(){return[0]}),last:nb(function(a,b){return[b-1]}),eq:nb(function(a,b,c){return[0>c?c+b:c]}),even:nb(function(a,b){for(var c=0;b>c;c+=2)a.push(c);return a}),odd:nb(function(a,b){for(var c=1;b>c;c+=2)a.push(c);return a}),lt:nb(function(a,b,c){for(var d=0>c?c+b:c;--d>=0;)a.push(d);return a}),gt:nb(function(a,b,c){for(var d=0>c?c+b:c;++d<b;)a.pus)***^***",
+R"***^***(h(d);return a})}},d.pseudos.nth=d.pseudos.eq;for(b in{radio:!0,checkbox:!0,file:!0,password:!0,image:!0})d.pseudos[b]=lb(b);for(b in{submit:!0,reset:!0})d.pseudos[b]=mb(b);function pb(){}pb.prototype=d.filters=d.pseudos,d.setFilters=new pb,g=fb.tokenize=function(a,b){var c,e,f,g,h,i,j,k=z[a+" "];if(k)return b?0:k.slice(0);h=a,i=[],j=d.preFilter;while(h){(!c||(e=S.exec(h)))&&(e&&(h=h.slice(e[0].length)||h),i.push(f=[])),c=!1,(e=T.exec(h))&&(c=e.shift(),f.push({value:c,type:e[0].replace(R," ")}),h=h.slice(c.length));for(g in d.filter)!(e=X[g].exec(h))||j[g]&&!(e=j[g](e))||(c=e.shift(),f.push({value:c,type:g,matches:e}),h=h.slice(c.length));if(!c)break}return b?h.length:h?fb.error(a):z(a,i).slice(0)};function qb(a){for(var b=0,c=a.length,d="";c>b;b++)d+=a[b].value;return d}function rb(a,b,c){var d=b.dir,e=c&&"parentNode"===d,f=x++;return b.first?function(b,c,f){while(b=b[d])if(1===b.nodeType||e)return a(b,c,f)}:function(b,c,g){var h,i,j=[w,f];if(g){while(b=b[d])if((1===b.nodeType||e)&&a(b,c,g))return!0}else while(b=b[d])if(1===b.nodeType||e){if(i=b[u]||(b[u]={}),(h=i[d])&&h[0]===w&&h[1]===f)return j[2]=h[2];if(i[d]=j,j[2]=a(b,c,g))return!0}}}function sb(a){return a.length>1?function(b,c,d){var e=a.length;while(e--)if(!a[e](b,c,d))return!1;return!0}:a[0]}function tb(a,b,c){for(var d=0,e=b.length;e>d;d++)fb(a,b[d],c);return c}function ub(a,b,c,d,e){for(var f,g=[],h=0,i=a.length,j=null!=b;i>h;h++)(f=a[h])&&(!c||c(f,d,e))&&(g.push(f),j&&b.push(h));return g}function vb(a,b,c,d,e,f){return d&&!d[u]&&(d=vb(d)),e&&!e[u]&&(e=vb(e,f)),hb(function(f,g,h,i){var j,k,l,m=[],n=[],o=g.length,p=f||tb(b||"*",h.nodeType?[h]:h,[]),q=!a||!f&&b?p:ub(p,m,a,h,i),r=c?e||(f?a:o||d)?[]:g:q;if(c&&c(q,r,h,i),d){j=ub(r,n),d(j,[],h,i),k=j.length;while(k--)(l=j[k])&&(r[n[k]]=!(q[n[k]]=l))}if(f){if(e||a){if(e){j=[],k=r.length;while(k--)(l=r[k])&&j.push(q[k]=l);e(null,r=[],j,i)}k=r.length;while(k--)(l=r[k])&&(j=e?K.call(f,l):m[k])>-1&&(f[j]=!(g[j]=l))}}else r=ub(r===g?r.splice(o,r.length):r),e?e(null,g,r,i):I.apply(g,r)})}function wb(a){for(var b,c,e,f=a.length,g=d.relative[a[0].type],h=g||d.relative[" "],i=g?1:0,k=rb(function(a){return a===b},h,!0),l=rb(function(a){return K.call(b,a)>-1},h,!0),m=[function(a,c,d){return!g&&(d||c!==j)||((b=c).nodeType?k(a,c,d):l(a,c,d))}];f>i;i++)if(c=d.relative[a[i].type])m=[rb(sb(m),c)];else{if(c=d.filter[a[i].type].apply(null,a[i].matches),c[u]){for(e=++i;f>e;e++)if(d.relative[a[e].type])break;return vb(i>1&&sb(m),i>1&&qb(a.slice(0,i-1).concat({value:" "===a[i-2].type?"*":""})).replace(R,"$1"),c,e>i&&wb(a.slice(i,e)),f>e&&wb(a=a.slice(e)),f>e&&qb(a))}m.push(c)}return sb(m)}function xb(a,b){var c=b.length>0,e=a.length>0,f=function(f,g,h,i,k){var l,m,o,p=0,q="0",r=f&&[],s=[],t=j,u=f||e&&d.find.TAG("*",k),v=w+=null==t?1:Math.random()||.1,x=u.length;for(k&&(j=g!==n&&g);q!==x&&null!=(l=u[q]);q++){if(e&&l){m=0;while(o=a[m++])if(o(l,g,h)){i.push(l);break}k&&(w=v)}c&&((l=!o&&l)&&p--,f&&r.push(l))}if(p+=q,c&&q!==p){m=0;while(o=b[m++])o(r,s,g,h);if(f){if(p>0)while(q--)r[q]||s[q]||(s[q]=G.call(i));s=ub(s)}I.apply(i,s),k&&!f&&s.length>0&&p+b.length>1&&fb.uniqueSort(i)}return k&&(w=v,j=t),r};return c?hb(f):f}return h=fb.compile=function(a,b){var c,d=[],e=[],f=A[a+" "];if(!f){b||(b=g(a)),c=b.length;while(c--)f=wb(b[c]),f[u]?d.push(f):e.push(f);f=A(a,xb(e,d)),f.selector=a}return f},i=fb.select=function(a,b,e,f){var i,j,k,l,m,n="function"==typeof a&&a,o=!f&&g(a=n.selector||a);if(e=e||[],1===o.length){if(j=o[0]=o[0].slice(0),j.length>2&&"ID"===(k=j[0]).type&&c.getById&&9===b.nodeType&&p&&d.relative[j[1].type]){if(b=(d.find.ID(k.matches[0].replace(cb,db),b)||[])[0],!b)return e;n&&(b=b.parentNode),a=a.slice(j.shift().value.length)}i=X.needsContext.test(a)?0:j.length;while(i--){if(k=j[i],d.relative[l=k.type])break;if((m=d.find[l])&&(f=m(k.matches[0].replace(cb,db),ab.test(j[0].type)&&ob(b.parentNode)||b))){if(j.splice(i,1),a=f.length&&qb(j),!a)return I.apply(e,f),e;break}}}return(n||h(a,o))(f,b,!p,e,ab.test(a)&&ob(b.parentNode)||b),e},c.sortStable=u.split("").sort(B).join("")===u,c.detectDuplicates=!!l,m(),c.sortDetached=ib(function(a){return 1&a.compareDocumentPosition(n.createElement("div"))}),ib(function(a){return a.innerHTML="<a href='#'></a>","#"===a.firstChild.getAttribute("href")})||jb("type|href|height|width",function(a,b,c){return c?void 0:a.getAttribute(b,"type"===b.toLowerCase()?1:2)}),c.attributes&&ib(function(a){return a.innerHTML="<input/>",a.firstChild.setAttribute("value",""),""===a.firstChild.getAttribute("value")})||jb("value",function(a,b,c){return c||"input"!==a.nodeName.toLowerCase()?void 0:a.defaultValue}),ib(function(a){return null==a.getAttribute("disabled")})||jb(L,function(a,b,c){var d;return c?void 0:a[b]===!0?b.toLowerCase():(d=a.getAttributeNode(b))&&d.specified?d.value:null}),fb}(a);n.find=t,n.expr=t.selectors,n.expr[":"]=n.expr.pseudos,n.unique=t.uniqueSort,n.text=t.getText,n.isXMLDoc=t.isXML,n.contains=t.contains;var u=n.expr.match.needsContext,v=/^<(\w+)\s*\/?>(?:<\/\1>|)$/,w=/^.[^:#\[\.,]*$/;function x(a,b,c){if(n.isFunction(b))return n.grep(a,function(a,d){return!!b.call(a,d,a)!==c});if(b.nodeType)return n.grep(a,function(a){return a===b!==c});if("string"==typeof b){if(w.test(b))return n.filter(b,a,c);b=n.filter(b,a)}return n.grep(a,function(a){return g.call(b,a)>=0!==c})}n.filter=function(a,b,c){var d=b[0];return c&&(a=":not("+a+")"),1===b.length&&1===d.nodeType?n.find.matchesSelector(d,a)?[d]:[]:n.find.matches(a,n.grep(b,function(a){return 1===a.nodeType}))},n.fn.extend({find:function(a){var b,c=this.length,d=[],e=this;if("string"!=typeof a)return this.pushStack(n(a).filter(function(){for(b=0;c>b;b++)if(n.contains(e[b],this))return!0}));for(b=0;c>b;b++)n.find(a,e[b],d);return d=this.pushStack(c>1?n.unique(d):d),d.selector=this.selector?this.selector+" "+a:a,d},filter:function(a){return this.pushStack(x(this,a||[],!1))},not:function(a){return this.pushStack(x(this,a||[],!0))},is:function(a){return!!x(this,"string"==typeof a&&u.test(a)?n(a):a||[],!1).length}});var y,z=/^(?:\s*(<[\w\W]+>)[^>]*|#([\w-]*))$/,A=n.fn.init=function(a,b){var c,d;if(!a)return this;if("string"==typeof a){if(c="<"===a[0]&&">"===a[a.length-1]&&a.length>=3?[null,a,null]:z.exec(a),!c||!c[1]&&b)return!b||b.jquery?(b||y).find(a):this.constructor(b).find(a);if(c[1]){if(b=b instanceof n?b[0]:b,n.merge(this,n.parseHTML(c[1],b&&b.nodeType?b.ownerDocument||b:l,!0)),v.test(c[1])&&n.isPlainObject(b))for(c in b)n.isFunction(this[c])?this[c](b[c]):this.attr(c,b[c]);return this}return d=l.getElementById(c[2]),d&&d.parentNode&&(this.length=1,this[0]=d),this.context=l,this.selector=a,this}return a.nodeType?(this.context=this[0]=a,this.length=1,this):n.isFunction(a)?"undefined"!=typeof y.ready?y.ready(a):a(n):(void 0!==a.selector&&(this.selector=a.selector,this.context=a.context),n.makeArray(a,this))};A.prototype=n.fn,y=n(l);var B=/^(?:parents|prev(?:Until|All))/,C={children:!0,contents:!0,next:!0,prev:!0};n.extend({dir:function(a,b,c){var d=[],e=void 0!==c;while((a=a[b])&&9!==a.nodeType)if(1===a.nodeType){if(e&&n(a).is(c))break;d.push(a)}return d},sibling:function(a,b){for(var c=[];a;a=a.nextSibling)1===a.nodeType&&a!==b&&c.push(a);return c}}),n.fn.extend({has:function(a){var b=n(a,this),c=b.length;return this.filter(function(){for(var a=0;c>a;a++)if(n.contains(this,b[a]))return!0})},closest:function(a,b){for(var c,d=0,e=this.length,f=[],g=u.test(a)||"string"!=typeof a?n(a,b||this.context):0;e>d;d++)for(c=this[d];c&&c!==b;c=c.parentNode)if(c.nodeType<11&&(g?g.index(c)>-1:1===c.nodeType&&n.find.matchesSelector(c,a))){f.push(c);break}return this.pushStack(f.length>1?n.unique(f):f)},index:function(a){return a?"string"==typeof a?g.call(n(a),this[0]):g.call(this,a.jquery?a[0]:a):this[0]&&this[0].parentNode?this.first().prevAll().length:-1},add:function(a,b){return this.pushStack(n.unique(n.merge(this.get(),n(a,b))))},addBack:function(a){return this.add(null==a?this.prevObject:this.prevObject.filter(a))}});function D(a,b){while((a=a[b])&&1!==a.nodeType);return a}n.each({parent:function(a){var b=a.parentNode;return b&&11!==b.nodeType?b:null},parents:function(a){return n.dir(a,"parentNode")},parentsUntil:function(a,b,c){return n.dir(a,"parentNode",c)},next:function(a){return D(a,"nextSibling")},prev:function(a){return D(a,"previousSibling")},nextAll:function(a){return n.dir(a,"nextSibling")},prevAll:function(a){return n.dir(a,"previousSibling")},nextUntil:function(a,b,c){return n.dir(a,"nextSibling",c)},prevUntil:function(a,b,c){return n.dir(a,"previousSibling",c)},siblings:function(a){return n.sibling((a.parentNode||{}).firstChild,a)},children:function(a){return n.sibling(a.firstChild)},contents:function(a){return a.contentDocument||n.merge([],a.childNodes)}},function(a,b){n.fn[a]=function(c,d){var e=n.map(this,b,c);return"Until"!==a.slice(-5)&&(d=c),d&&"string"==typeof d&&(e=n.filter(d,e)),this.length>1&&(C[a]||n.unique(e),B.test(a)&&e.reverse()),this.pushStack(e)}});var E=/\S+/g,F={};function G(a){var b=F[a]={};return n.each(a.match(E)||[],function(a,c){b[c]=!0}),b}n.Callbacks=function(a){a="string"==typeof a?F[a]||G(a):n.extend({},a);var b,c,d,e,f,g,h=[],i=!a.once&&[],j=function(l){for(b=a.memory&&l,c=!0,g=e||0,e=0,f=h.length,d=!0;h&&f>g;g++)if(h[g].apply(l[0],l[1])===!1&&a.stopOnFalse){b=!1;break}d=!1,h&&(i?i.length&&j(i.shift()):b?h=[]:k.disable())},k={add:function(){if(h){var c=h.length;!function g(b){n.each(b,function(b,c){var d=n.type(c);"function"===d?a.unique&&k.has(c)||h.push(c):c&&c.length&&"string"!==d&&g(c)})}(arguments),d?f=h.length:b&&(e=c,j(b))}return this},remove:function(){return h&&n.each(arguments,function(a,b){var c;while((c=n.inArray(b,h,c))>-1)h.splice(c,1),d&&(f>=c&&f--,g>=c&&g--)}),this},has:function(a){return a?n.inArray(a,h)>-1:!(!h||!h.length)},empty:function(){return h=[],f=0,this},disable:function(){return h=i=b=void 0,this},disabled:function(){return!h},lock:function(){return i=void 0,b||k.disable(),this},locked:function(){return!i},fireWith:function(a,b){return!h||c&&!i||(b=b||[],b=[a,b.slice?b.slice():b],d?i.pus)***^***",
+R"***^***(h(b):j(b)),this},fire:function(){return k.fireWith(this,arguments),this},fired:function(){return!!c}};return k},n.extend({Deferred:function(a){var b=[["resolve","done",n.Callbacks("once memory"),"resolved"],["reject","fail",n.Callbacks("once memory"),"rejected"],["notify","progress",n.Callbacks("memory")]],c="pending",d={state:function(){return c},always:function(){return e.done(arguments).fail(arguments),this},then:function(){var a=arguments;return n.Deferred(function(c){n.each(b,function(b,f){var g=n.isFunction(a[b])&&a[b];e[f[1]](function(){var a=g&&g.apply(this,arguments);a&&n.isFunction(a.promise)?a.promise().done(c.resolve).fail(c.reject).progress(c.notify):c[f[0]+"With"](this===d?c.promise():this,g?[a]:arguments)})}),a=null}).promise()},promise:function(a){return null!=a?n.extend(a,d):d}},e={};return d.pipe=d.then,n.each(b,function(a,f){var g=f[2],h=f[3];d[f[1]]=g.add,h&&g.add(function(){c=h},b[1^a][2].disable,b[2][2].lock),e[f[0]]=function(){return e[f[0]+"With"](this===e?d:this,arguments),this},e[f[0]+"With"]=g.fireWith}),d.promise(e),a&&a.call(e,e),e},when:function(a){var b=0,c=d.call(arguments),e=c.length,f=1!==e||a&&n.isFunction(a.promise)?e:0,g=1===f?a:n.Deferred(),h=function(a,b,c){return function(e){b[a]=this,c[a]=arguments.length>1?d.call(arguments):e,c===i?g.notifyWith(b,c):--f||g.resolveWith(b,c)}},i,j,k;if(e>1)for(i=new Array(e),j=new Array(e),k=new Array(e);e>b;b++)c[b]&&n.isFunction(c[b].promise)?c[b].promise().done(h(b,k,c)).fail(g.reject).progress(h(b,j,i)):--f;return f||g.resolveWith(k,c),g.promise()}});var H;n.fn.ready=function(a){return n.ready.promise().done(a),this},n.extend({isReady:!1,readyWait:1,holdReady:function(a){a?n.readyWait++:n.ready(!0)},ready:function(a){(a===!0?--n.readyWait:n.isReady)||(n.isReady=!0,a!==!0&&--n.readyWait>0||(H.resolveWith(l,[n]),n.fn.triggerHandler&&(n(l).triggerHandler("ready"),n(l).off("ready"))))}});function I(){l.removeEventListener("DOMContentLoaded",I,!1),a.removeEventListener("load",I,!1),n.ready()}n.ready.promise=function(b){return H||(H=n.Deferred(),"complete"===l.readyState?setTimeout(n.ready):(l.addEventListener("DOMContentLoaded",I,!1),a.addEventListener("load",I,!1))),H.promise(b)},n.ready.promise();var J=n.access=function(a,b,c,d,e,f,g){var h=0,i=a.length,j=null==c;if("object"===n.type(c)){e=!0;for(h in c)n.access(a,b,h,c[h],!0,f,g)}else if(void 0!==d&&(e=!0,n.isFunction(d)||(g=!0),j&&(g?(b.call(a,d),b=null):(j=b,b=function(a,b,c){return j.call(n(a),c)})),b))for(;i>h;h++)b(a[h],c,g?d:d.call(a[h],h,b(a[h],c)));return e?a:j?b.call(a):i?b(a[0],c):f};n.acceptData=function(a){return 1===a.nodeType||9===a.nodeType||!+a.nodeType};function K(){Object.defineProperty(this.cache={},0,{get:function(){return{}}}),this.expando=n.expando+Math.random()}K.uid=1,K.accepts=n.acceptData,K.prototype={key:function(a){if(!K.accepts(a))return 0;var b={},c=a[this.expando];if(!c){c=K.uid++;try{b[this.expando]={value:c},Object.defineProperties(a,b)}catch(d){b[this.expando]=c,n.extend(a,b)}}return this.cache[c]||(this.cache[c]={}),c},set:function(a,b,c){var d,e=this.key(a),f=this.cache[e];if("string"==typeof b)f[b]=c;else if(n.isEmptyObject(f))n.extend(this.cache[e],b);else for(d in b)f[d]=b[d];return f},get:function(a,b){var c=this.cache[this.key(a)];return void 0===b?c:c[b]},access:function(a,b,c){var d;return void 0===b||b&&"string"==typeof b&&void 0===c?(d=this.get(a,b),void 0!==d?d:this.get(a,n.camelCase(b))):(this.set(a,b,c),void 0!==c?c:b)},remove:function(a,b){var c,d,e,f=this.key(a),g=this.cache[f];if(void 0===b)this.cache[f]={};else{n.isArray(b)?d=b.concat(b.map(n.camelCase)):(e=n.camelCase(b),b in g?d=[b,e]:(d=e,d=d in g?[d]:d.match(E)||[])),c=d.length;while(c--)delete g[d[c]]}},hasData:function(a){return!n.isEmptyObject(this.cache[a[this.expando]]||{})},discard:function(a){a[this.expando]&&delete this.cache[a[this.expando]]}};var L=new K,M=new K,N=/^(?:\{[\w\W]*\}|\[[\w\W]*\])$/,O=/([A-Z])/g;function P(a,b,c){var d;if(void 0===c&&1===a.nodeType)if(d="data-"+b.replace(O,"-$1").toLowerCase(),c=a.getAttribute(d),"string"==typeof c){try{c="true"===c?!0:"false"===c?!1:"null"===c?null:+c+""===c?+c:N.test(c)?n.parseJSON(c):c}catch(e){}M.set(a,b,c)}else c=void 0;return c}n.extend({hasData:function(a){return M.hasData(a)||L.hasData(a)},data:function(a,b,c){return M.access(a,b,c)},removeData:function(a,b){M.remove(a,b)
+},_data:function(a,b,c){return L.access(a,b,c)},_removeData:function(a,b){L.remove(a,b)}}),n.fn.extend({data:function(a,b){var c,d,e,f=this[0],g=f&&f.attributes;if(void 0===a){if(this.length&&(e=M.get(f),1===f.nodeType&&!L.get(f,"hasDataAttrs"))){c=g.length;while(c--)g[c]&&(d=g[c].name,0===d.indexOf("data-")&&(d=n.camelCase(d.slice(5)),P(f,d,e[d])));L.set(f,"hasDataAttrs",!0)}return e}return"object"==typeof a?this.each(function(){M.set(this,a)}):J(this,function(b){var c,d=n.camelCase(a);if(f&&void 0===b){if(c=M.get(f,a),void 0!==c)return c;if(c=M.get(f,d),void 0!==c)return c;if(c=P(f,d,void 0),void 0!==c)return c}else this.each(function(){var c=M.get(this,d);M.set(this,d,b),-1!==a.indexOf("-")&&void 0!==c&&M.set(this,a,b)})},null,b,arguments.length>1,null,!0)},removeData:function(a){return this.each(function(){M.remove(this,a)})}}),n.extend({queue:function(a,b,c){var d;return a?(b=(b||"fx")+"queue",d=L.get(a,b),c&&(!d||n.isArray(c)?d=L.access(a,b,n.makeArray(c)):d.push(c)),d||[]):void 0},dequeue:function(a,b){b=b||"fx";var c=n.queue(a,b),d=c.length,e=c.shift(),f=n._queueHooks(a,b),g=function(){n.dequeue(a,b)};"inprogress"===e&&(e=c.shift(),d--),e&&("fx"===b&&c.unshift("inprogress"),delete f.stop,e.call(a,g,f)),!d&&f&&f.empty.fire()},_queueHooks:function(a,b){var c=b+"queueHooks";return L.get(a,c)||L.access(a,c,{empty:n.Callbacks("once memory").add(function(){L.remove(a,[b+"queue",c])})})}}),n.fn.extend({queue:function(a,b){var c=2;return"string"!=typeof a&&(b=a,a="fx",c--),arguments.length<c?n.queue(this[0],a):void 0===b?this:this.each(function(){var c=n.queue(this,a,b);n._queueHooks(this,a),"fx"===a&&"inprogress"!==c[0]&&n.dequeue(this,a)})},dequeue:function(a){return this.each(function(){n.dequeue(this,a)})},clearQueue:function(a){return this.queue(a||"fx",[])},promise:function(a,b){var c,d=1,e=n.Deferred(),f=this,g=this.length,h=function(){--d||e.resolveWith(f,[f])};"string"!=typeof a&&(b=a,a=void 0),a=a||"fx";while(g--)c=L.get(f[g],a+"queueHooks"),c&&c.empty&&(d++,c.empty.add(h));return h(),e.promise(b)}});var Q=/[+-]?(?:\d*\.|)\d+(?:[eE][+-]?\d+|)/.source,R=["Top","Right","Bottom","Left"],S=function(a,b){return a=b||a,"none"===n.css(a,"display")||!n.contains(a.ownerDocument,a)},T=/^(?:checkbox|radio)$/i;!function(){var a=l.createDocumentFragment(),b=a.appendChild(l.createElement("div")),c=l.createElement("input");c.setAttribute("type","radio"),c.setAttribute("checked","checked"),c.setAttribute("name","t"),b.appendChild(c),k.checkClone=b.cloneNode(!0).cloneNode(!0).lastChild.checked,b.innerHTML="<textarea>x</textarea>",k.noCloneChecked=!!b.cloneNode(!0).lastChild.defaultValue}();var U="undefined";k.focusinBubbles="onfocusin"in a;var V=/^key/,W=/^(?:mouse|pointer|contextmenu)|click/,X=/^(?:focusinfocus|focusoutblur)$/,Y=/^([^.]*)(?:\.(.+)|)$/;function Z(){return!0}function $(){return!1}function _(){try{return l.activeElement}catch(a){}}n.event={global:{},add:function(a,b,c,d,e){var f,g,h,i,j,k,l,m,o,p,q,r=L.get(a);if(r){c.handler&&(f=c,c=f.handler,e=f.selector),c.guid||(c.guid=n.guid++),(i=r.events)||(i=r.events={}),(g=r.handle)||(g=r.handle=function(b){return typeof n!==U&&n.event.triggered!==b.type?n.event.dispatch.apply(a,arguments):void 0}),b=(b||"").match(E)||[""],j=b.length;while(j--)h=Y.exec(b[j])||[],o=q=h[1],p=(h[2]||"").split(".").sort(),o&&(l=n.event.special[o]||{},o=(e?l.delegateType:l.bindType)||o,l=n.event.special[o]||{},k=n.extend({type:o,origType:q,data:d,handler:c,guid:c.guid,selector:e,needsContext:e&&n.expr.match.needsContext.test(e),namespace:p.join(".")},f),(m=i[o])||(m=i[o]=[],m.delegateCount=0,l.setup&&l.setup.call(a,d,p,g)!==!1||a.addEventListener&&a.addEventListener(o,g,!1)),l.add&&(l.add.call(a,k),k.handler.guid||(k.handler.guid=c.guid)),e?m.splice(m.delegateCount++,0,k):m.push(k),n.event.global[o]=!0)}},remove:function(a,b,c,d,e){var f,g,h,i,j,k,l,m,o,p,q,r=L.hasData(a)&&L.get(a);if(r&&(i=r.events)){b=(b||"").match(E)||[""],j=b.length;while(j--)if(h=Y.exec(b[j])||[],o=q=h[1],p=(h[2]||"").split(".").sort(),o){l=n.event.special[o]||{},o=(d?l.delegateType:l.bindType)||o,m=i[o]||[],h=h[2]&&new RegExp("(^|\\.)"+p.join("\\.(?:.*\\.|)")+"(\\.|$)"),g=f=m.length;while(f--)k=m[f],!e&&q!==k.origType||c&&c.guid!==k.guid||h&&!h.test(k.namespace)||d&&d!==k.selector&&("**"!==d||!k.selector)||(m.splice(f,1),k.selector&&m.delegateCount--,l.remove&&l.remove.call(a,k));g&&!m.length&&(l.teardown&&l.teardown.call(a,p,r.handle)!==!1||n.removeEvent(a,o,r.handle),delete i[o])}else for(o in i)n.event.remove(a,o+b[j],c,d,!0);n.isEmptyObject(i)&&(delete r.handle,L.remove(a,"events"))}},trigger:function(b,c,d,e){var f,g,h,i,k,m,o,p=[d||l],q=j.call(b,"type")?b.type:b,r=j.call(b,"namespace")?b.namespace.split("."):[];if(g=h=d=d||l,3!==d.nodeType&&8!==d.nodeType&&!X.test(q+n.event.triggered)&&(q.indexOf(".")>=0&&(r=q.split("."),q=r.shift(),r.sort()),k=q.indexOf(":")<0&&"on"+q,b=b[n.expando]?b:new n.Event(q,"object"==typeof b&&b),b.isTrigger=e?2:3,b.namespace=r.join("."),b.namespace_re=b.namespace?new RegExp("(^|\\.)"+r.join("\\.(?:.*\\.|)")+"(\\.|$)"):null,b.result=void 0,b.target||(b.target=d),c=null==c?[b]:n.makeArray(c,[b]),o=n.event.special[q]||{},e||!o.trigger||o.trigger.apply(d,c)!==!1)){if(!e&&!o.noBubble&&!n.isWindow(d)){for(i=o.delegateType||q,X.test(i+q)||(g=g.parentNode);g;g=g.parentNode)p.push(g),h=g;h===(d.ownerDocument||l)&&p.push(h.defaultView||h.parentWindow||a)}f=0;while((g=p[f++])&&!b.isPropagationStopped())b.type=f>1?i:o.bindType||q,m=(L.get(g,"events")||{})[b.type]&&L.get(g,"handle"),m&&m.apply(g,c),m=k&&g[k],m&&m.apply&&n.acceptData(g)&&(b.result=m.apply(g,c),b.result===!1&&b.preventDefault());return b.type=q,e||b.isDefaultPreve)***^***",
+R"***^***(nted()||o._default&&o._default.apply(p.pop(),c)!==!1||!n.acceptData(d)||k&&n.isFunction(d[q])&&!n.isWindow(d)&&(h=d[k],h&&(d[k]=null),n.event.triggered=q,d[q](),n.event.triggered=void 0,h&&(d[k]=h)),b.result}},dispatch:function(a){a=n.event.fix(a);var b,c,e,f,g,h=[],i=d.call(arguments),j=(L.get(this,"events")||{})[a.type]||[],k=n.event.special[a.type]||{};if(i[0]=a,a.delegateTarget=this,!k.preDispatch||k.preDispatch.call(this,a)!==!1){h=n.event.handlers.call(this,a,j),b=0;while((f=h[b++])&&!a.isPropagationStopped()){a.currentTarget=f.elem,c=0;while((g=f.handlers[c++])&&!a.isImmediatePropagationStopped())(!a.namespace_re||a.namespace_re.test(g.namespace))&&(a.handleObj=g,a.data=g.data,e=((n.event.special[g.origType]||{}).handle||g.handler).apply(f.elem,i),void 0!==e&&(a.result=e)===!1&&(a.preventDefault(),a.stopPropagation()))}return k.postDispatch&&k.postDispatch.call(this,a),a.result}},handlers:function(a,b){var c,d,e,f,g=[],h=b.delegateCount,i=a.target;if(h&&i.nodeType&&(!a.button||"click"!==a.type))for(;i!==this;i=i.parentNode||this)if(i.disabled!==!0||"click"!==a.type){for(d=[],c=0;h>c;c++)f=b[c],e=f.selector+" ",void 0===d[e]&&(d[e]=f.needsContext?n(e,this).index(i)>=0:n.find(e,this,null,[i]).length),d[e]&&d.push(f);d.length&&g.push({elem:i,handlers:d})}return h<b.length&&g.push({elem:this,handlers:b.slice(h)}),g},props:"altKey bubbles cancelable ctrlKey currentTarget eventPhase metaKey relatedTarget shiftKey target timeStamp view which".split(" "),fixHooks:{},keyHooks:{props:"char charCode key keyCode".split(" "),filter:function(a,b){return null==a.which&&(a.which=null!=b.charCode?b.charCode:b.keyCode),a}},mouseHooks:{props:"button buttons clientX clientY offsetX offsetY pageX pageY screenX screenY toElement".split(" "),filter:function(a,b){var c,d,e,f=b.button;return null==a.pageX&&null!=b.clientX&&(c=a.target.ownerDocument||l,d=c.documentElement,e=c.body,a.pageX=b.clientX+(d&&d.scrollLeft||e&&e.scrollLeft||0)-(d&&d.clientLeft||e&&e.clientLeft||0),a.pageY=b.clientY+(d&&d.scrollTop||e&&e.scrollTop||0)-(d&&d.clientTop||e&&e.clientTop||0)),a.which||void 0===f||(a.which=1&f?1:2&f?3:4&f?2:0),a}},fix:function(a){if(a[n.expando])return a;var b,c,d,e=a.type,f=a,g=this.fixHooks[e];g||(this.fixHooks[e]=g=W.test(e)?this.mouseHooks:V.test(e)?this.keyHooks:{}),d=g.props?this.props.concat(g.props):this.props,a=new n.Event(f),b=d.length;while(b--)c=d[b],a[c]=f[c];return a.target||(a.target=l),3===a.target.nodeType&&(a.target=a.target.parentNode),g.filter?g.filter(a,f):a},special:{load:{noBubble:!0},focus:{trigger:function(){return this!==_()&&this.focus?(this.focus(),!1):void 0},delegateType:"focusin"},blur:{trigger:function(){return this===_()&&this.blur?(this.blur(),!1):void 0},delegateType:"focusout"},click:{trigger:function(){return"checkbox"===this.type&&this.click&&n.nodeName(this,"input")?(this.click(),!1):void 0},_default:function(a){return n.nodeName(a.target,"a")}},beforeunload:{postDispatch:function(a){void 0!==a.result&&a.originalEvent&&(a.originalEvent.returnValue=a.result)}}},simulate:function(a,b,c,d){var e=n.extend(new n.Event,c,{type:a,isSimulated:!0,originalEvent:{}});d?n.event.trigger(e,null,b):n.event.dispatch.call(b,e),e.isDefaultPrevented()&&c.preventDefault()}},n.removeEvent=function(a,b,c){a.removeEventListener&&a.removeEventListener(b,c,!1)},n.Event=function(a,b){return this instanceof n.Event?(a&&a.type?(this.originalEvent=a,this.type=a.type,this.isDefaultPrevented=a.defaultPrevented||void 0===a.defaultPrevented&&a.returnValue===!1?Z:$):this.type=a,b&&n.extend(this,b),this.timeStamp=a&&a.timeStamp||n.now(),void(this[n.expando]=!0)):new n.Event(a,b)},n.Event.prototype={isDefaultPrevented:$,isPropagationStopped:$,isImmediatePropagationStopped:$,preventDefault:function(){var a=this.originalEvent;this.isDefaultPrevented=Z,a&&a.preventDefault&&a.preventDefault()},stopPropagation:function(){var a=this.originalEvent;this.isPropagationStopped=Z,a&&a.stopPropagation&&a.stopPropagation()},stopImmediatePropagation:function(){var a=this.originalEvent;this.isImmediatePropagationStopped=Z,a&&a.stopImmediatePropagation&&a.stopImmediatePropagation(),this.stopPropagation()}},n.each({mouseenter:"mouseover",mouseleave:"mouseout",pointerenter:"pointerover",pointerleave:"pointerout"},function(a,b){n.event.special[a]={delegateType:b,bindType:b,handle:function(a){var c,d=this,e=a.relatedTarget,f=a.handleObj;return(!e||e!==d&&!n.contains(d,e))&&(a.type=f.origType,c=f.handler.apply(this,arguments),a.type=b),c}}}),k.focusinBubbles||n.each({focus:"focusin",blur:"focusout"},function(a,b){var c=function(a){n.event.simulate(b,a.target,n.event.fix(a),!0)};n.event.special[b]={setup:function(){var d=this.ownerDocument||this,e=L.access(d,b);e||d.addEventListener(a,c,!0),L.access(d,b,(e||0)+1)},teardown:function(){var d=this.ownerDocument||this,e=L.access(d,b)-1;e?L.access(d,b,e):(d.removeEventListener(a,c,!0),L.remove(d,b))}}}),n.fn.extend({on:function(a,b,c,d,e){var f,g;if("object"==typeof a){"string"!=typeof b&&(c=c||b,b=void 0);for(g in a)this.on(g,b,c,a[g],e);return this}if(null==c&&null==d?(d=b,c=b=void 0):null==d&&("string"==typeof b?(d=c,c=void 0):(d=c,c=b,b=void 0)),d===!1)d=$;else if(!d)return this;return 1===e&&(f=d,d=function(a){return n().off(a),f.apply(this,arguments)},d.guid=f.guid||(f.guid=n.guid++)),this.each(function(){n.event.add(this,a,d,c,b)})},one:function(a,b,c,d){return this.on(a,b,c,d,1)},off:function(a,b,c){var d,e;if(a&&a.preventDefault&&a.handleObj)return d=a.handleObj,n(a.delegateTarget).off(d.namespace?d.origType+"."+d.namespace:d.origType,d.selector,d.handler),this;if("object"==typeof a){for(e in a)this.off(e,b,a[e]);return this}return(b===!1||"function"==typeof b)&&(c=b,b=void 0),c===!1&&(c=$),this.each(function(){n.event.remove(this,a,c,b)})},trigger:function(a,b){return this.each(function(){n.event.trigger(a,b,this)})},triggerHandler:function(a,b){var c=this[0];return c?n.event.trigger(a,b,c,!0):void 0}});var ab=/<(?!area|br|col|embed|hr|img|input|link|meta|param)(([\w:]+)[^>]*)\/>/gi,bb=/<([\w:]+)/,cb=/<|&#?\w+;/,db=/<(?:script|style|link)/i,eb=/checked\s*(?:[^=]|=\s*.checked.)/i,fb=/^$|\/(?:java|ecma)script/i,gb=/^true\/(.*)/,hb=/^\s*<!(?:\[CDATA\[|--)|(?:\]\]|--)>\s*$/g,ib={option:[1,"<select multiple='multiple'>","</select>"],thead:[1,"<table>","</table>"],col:[2,"<table><colgroup>","</colgroup></table>"],tr:[2,"<table><tbody>","</tbody></table>"],td:[3,"<table><tbody><tr>","</tr></tbody></table>"],_default:[0,"",""]};ib.optgroup=ib.option,ib.tbody=ib.tfoot=ib.colgroup=ib.caption=ib.thead,ib.th=ib.td;function jb(a,b){return n.nodeName(a,"table")&&n.nodeName(11!==b.nodeType?b:b.firstChild,"tr")?a.getElementsByTagName("tbody")[0]||a.appendChild(a.ownerDocument.createElement("tbody")):a}function kb(a){return a.type=(null!==a.getAttribute("type"))+"/"+a.type,a}function lb(a){var b=gb.exec(a.type);return b?a.type=b[1]:a.removeAttribute("type"),a}function mb(a,b){for(var c=0,d=a.length;d>c;c++)L.set(a[c],"globalEval",!b||L.get(b[c],"globalEval"))}function nb(a,b){var c,d,e,f,g,h,i,j;if(1===b.nodeType){if(L.hasData(a)&&(f=L.access(a),g=L.set(b,f),j=f.events)){delete g.handle,g.events={};for(e in j)for(c=0,d=j[e].length;d>c;c++)n.event.add(b,e,j[e][c])}M.hasData(a)&&(h=M.access(a),i=n.extend({},h),M.set(b,i))}}function ob(a,b){var c=a.getElementsByTagName?a.getElementsByTagName(b||"*"):a.querySelectorAll?a.querySelectorAll(b||"*"):[];return void 0===b||b&&n.nodeName(a,b)?n.merge([a],c):c}function pb(a,b){var c=b.nodeName.toLowerCase();"input"===c&&T.test(a.type)?b.checked=a.checked:("input"===c||"textarea"===c)&&(b.defaultValue=a.defaultValue)}n.extend({clone:function(a,b,c){var d,e,f,g,h=a.cloneNode(!0),i=n.contains(a.ownerDocument,a);if(!(k.noCloneChecked||1!==a.nodeType&&11!==a.nodeType||n.isXMLDoc(a)))for(g=ob(h),f=ob(a),d=0,e=f.length;e>d;d++)pb(f[d],g[d]);if(b)if(c)for(f=f||ob(a),g=g||ob(h),d=0,e=f.length;e>d;d++)nb(f[d],g[d]);else nb(a,h);return g=ob(h,"script"),g.length>0&&mb(g,!i&&ob(a,"script")),h},buildFragment:function(a,b,c,d){for(var e,f,g,h,i,j,k=b.createDocumentFragment(),l=[],m=0,o=a.length;o>m;m++)if(e=a[m],e||0===e)if("object"===n.type(e))n.merge(l,e.nodeType?[e]:e);else if(cb.test(e)){f=f||k.appendChild(b.createElement("div")),g=(bb.exec(e)||["",""])[1].toLowerCase(),h=ib[g]||ib._default,f.innerHTML=h[1]+e.replace(ab,"<$1></$2>")+h[2],j=h[0];while(j--)f=f.lastChild;n.merge(l,f.childNodes),f=k.firstChild,f.textContent=""}else l.push(b.createTextNode(e));k.textContent="",m=0;while(e=l[m++])if((!d||-1===n.inArray(e,d))&&(i=n.contains(e.ownerDocument,e),f=ob(k.appendChild(e),"script"),i&&mb(f),c)){j=0;while(e=f[j++])fb.test(e.type||"")&&c.push(e)}return k},cleanData:function(a){for(var b,c,d,e,f=n.event.special,g=0;void 0!==(c=a[g]);g++){if(n.acceptData(c)&&(e=c[L.expando],e&&(b=L.cache[e]))){if(b.events)for(d in b.events)f[d]?n.event.remove(c,d):n.removeEvent(c,d,b.handle);L.cache[e]&&delete L.cache[e]}delete M.cache[c[M.expando]]}}}),n.fn.extend({text:function(a){return J(this,function(a){return void 0===a?n.text(this):this.empty().each(function(){(1===this.nodeType||11===this.nodeType||9===this.nodeType)&&(this.textContent=a)})},null,a,arguments.length)},append:function(){return this.domManip(arguments,function(a){if(1===this.nodeType||11===this.nodeType||9===this.nodeType){var b=jb(this,a);b.appendChild(a)}})},prepend:function(){return this.domManip(arguments,function(a){if(1===this.nodeType||11===this.nodeType||9===this.nodeType){var b=jb(this,a);b.insertBefore(a,b.firstChild)}})},before:function(){return this.domManip(arguments,function(a){this.parentNode&&this.parentNode.insertBefore(a,this)})},after:function(){return this.domManip(arguments,function(a){this.parentNode&&this.parentNode.insertBefore(a,this.nextSibling)})},remove:function(a,b){for(var c,d=a?n.filter(a,this):this,e=0;null!=(c=d[e]);e++)b||1!==c.nodeType||n.cleanData(ob(c)),c.parentNode&&(b&&n.contains(c.ownerDocument,c)&&mb(ob(c,"script")),c.parentNode.removeChild(c));return this},empty:function(){for(var a,b=)***^***",
+R"***^***(0;null!=(a=this[b]);b++)1===a.nodeType&&(n.cleanData(ob(a,!1)),a.textContent="");return this},clone:function(a,b){return a=null==a?!1:a,b=null==b?a:b,this.map(function(){return n.clone(this,a,b)})},html:function(a){return J(this,function(a){var b=this[0]||{},c=0,d=this.length;if(void 0===a&&1===b.nodeType)return b.innerHTML;if("string"==typeof a&&!db.test(a)&&!ib[(bb.exec(a)||["",""])[1].toLowerCase()]){a=a.replace(ab,"<$1></$2>");try{for(;d>c;c++)b=this[c]||{},1===b.nodeType&&(n.cleanData(ob(b,!1)),b.innerHTML=a);b=0}catch(e){}}b&&this.empty().append(a)},null,a,arguments.length)},replaceWith:function(){var a=arguments[0];return this.domManip(arguments,function(b){a=this.parentNode,n.cleanData(ob(this)),a&&a.replaceChild(b,this)}),a&&(a.length||a.nodeType)?this:this.remove()},detach:function(a){return this.remove(a,!0)},domManip:function(a,b){a=e.apply([],a);var c,d,f,g,h,i,j=0,l=this.length,m=this,o=l-1,p=a[0],q=n.isFunction(p);if(q||l>1&&"string"==typeof p&&!k.checkClone&&eb.test(p))return this.each(function(c){var d=m.eq(c);q&&(a[0]=p.call(this,c,d.html())),d.domManip(a,b)});if(l&&(c=n.buildFragment(a,this[0].ownerDocument,!1,this),d=c.firstChild,1===c.childNodes.length&&(c=d),d)){for(f=n.map(ob(c,"script"),kb),g=f.length;l>j;j++)h=c,j!==o&&(h=n.clone(h,!0,!0),g&&n.merge(f,ob(h,"script"))),b.call(this[j],h,j);if(g)for(i=f[f.length-1].ownerDocument,n.map(f,lb),j=0;g>j;j++)h=f[j],fb.test(h.type||"")&&!L.access(h,"globalEval")&&n.contains(i,h)&&(h.src?n._evalUrl&&n._evalUrl(h.src):n.globalEval(h.textContent.replace(hb,"")))}return this}}),n.each({appendTo:"append",prependTo:"prepend",insertBefore:"before",insertAfter:"after",replaceAll:"replaceWith"},function(a,b){n.fn[a]=function(a){for(var c,d=[],e=n(a),g=e.length-1,h=0;g>=h;h++)c=h===g?this:this.clone(!0),n(e[h])[b](c),f.apply(d,c.get());return this.pushStack(d)}});var qb,rb={};function sb(b,c){var d,e=n(c.createElement(b)).appendTo(c.body),f=a.getDefaultComputedStyle&&(d=a.getDefaultComputedStyle(e[0]))?d.display:n.css(e[0],"display");return e.detach(),f}function tb(a){var b=l,c=rb[a];return c||(c=sb(a,b),"none"!==c&&c||(qb=(qb||n("<iframe frameborder='0' width='0' height='0'/>")).appendTo(b.documentElement),b=qb[0].contentDocument,b.write(),b.close(),c=sb(a,b),qb.detach()),rb[a]=c),c}var ub=/^margin/,vb=new RegExp("^("+Q+")(?!px)[a-z%]+$","i"),wb=function(a){return a.ownerDocument.defaultView.getComputedStyle(a,null)};function xb(a,b,c){var d,e,f,g,h=a.style;return c=c||wb(a),c&&(g=c.getPropertyValue(b)||c[b]),c&&(""!==g||n.contains(a.ownerDocument,a)||(g=n.style(a,b)),vb.test(g)&&ub.test(b)&&(d=h.width,e=h.minWidth,f=h.maxWidth,h.minWidth=h.maxWidth=h.width=g,g=c.width,h.width=d,h.minWidth=e,h.maxWidth=f)),void 0!==g?g+"":g}function yb(a,b){return{get:function(){return a()?void delete this.get:(this.get=b).apply(this,arguments)}}}!function(){var b,c,d=l.documentElement,e=l.createElement("div"),f=l.createElement("div");if(f.style){f.style.backgroundClip="content-box",f.cloneNode(!0).style.backgroundClip="",k.clearCloneStyle="content-box"===f.style.backgroundClip,e.style.cssText="border:0;width:0;height:0;top:0;left:-9999px;margin-top:1px;position:absolute",e.appendChild(f);function g(){f.style.cssText="-webkit-box-sizing:border-box;-moz-box-sizing:border-box;box-sizing:border-box;display:block;margin-top:1%;top:1%;border:1px;padding:1px;width:4px;position:absolute",f.innerHTML="",d.appendChild(e);var g=a.getComputedStyle(f,null);b="1%"!==g.top,c="4px"===g.width,d.removeChild(e)}a.getComputedStyle&&n.extend(k,{pixelPosition:function(){return g(),b},boxSizingReliable:function(){return null==c&&g(),c},reliableMarginRight:function(){var b,c=f.appendChild(l.createElement("div"));return c.style.cssText=f.style.cssText="-webkit-box-sizing:content-box;-moz-box-sizing:content-box;box-sizing:content-box;display:block;margin:0;border:0;padding:0",c.style.marginRight=c.style.width="0",f.style.width="1px",d.appendChild(e),b=!parseFloat(a.getComputedStyle(c,null).marginRight),d.removeChild(e),b}})}}(),n.swap=function(a,b,c,d){var e,f,g={};for(f in b)g[f]=a.style[f],a.style[f]=b[f];e=c.apply(a,d||[]);for(f in b)a.style[f]=g[f];return e};var zb=/^(none|table(?!-c[ea]).+)/,Ab=new RegExp("^("+Q+")(.*)$","i"),Bb=new RegExp("^([+-])=("+Q+")","i"),Cb={position:"absolute",visibility:"hidden",display:"block"},Db={letterSpacing:"0",fontWeight:"400"},Eb=["Webkit","O","Moz","ms"];function Fb(a,b){if(b in a)return b;var c=b[0].toUpperCase()+b.slice(1),d=b,e=Eb.length;while(e--)if(b=Eb[e]+c,b in a)return b;return d}function Gb(a,b,c){var d=Ab.exec(b);return d?Math.max(0,d[1]-(c||0))+(d[2]||"px"):b}function Hb(a,b,c,d,e){for(var f=c===(d?"border":"content")?4:"width"===b?1:0,g=0;4>f;f+=2)"margin"===c&&(g+=n.css(a,c+R[f],!0,e)),d?("content"===c&&(g-=n.css(a,"padding"+R[f],!0,e)),"margin"!==c&&(g-=n.css(a,"border"+R[f]+"Width",!0,e))):(g+=n.css(a,"padding"+R[f],!0,e),"padding"!==c&&(g+=n.css(a,"border"+R[f]+"Width",!0,e)));return g}function Ib(a,b,c){var d=!0,e="width"===b?a.offsetWidth:a.offsetHeight,f=wb(a),g="border-box"===n.css(a,"boxSizing",!1,f);if(0>=e||null==e){if(e=xb(a,b,f),(0>e||null==e)&&(e=a.style[b]),vb.test(e))return e;d=g&&(k.boxSizingReliable()||e===a.style[b]),e=parseFloat(e)||0}return e+Hb(a,b,c||(g?"border":"content"),d,f)+"px"}function Jb(a,b){for(var c,d,e,f=[],g=0,h=a.length;h>g;g++)d=a[g],d.style&&(f[g]=L.get(d,"olddisplay"),c=d.style.display,b?(f[g]||"none"!==c||(d.style.display=""),""===d.style.display&&S(d)&&(f[g]=L.access(d,"olddisplay",tb(d.nodeName)))):(e=S(d),"none"===c&&e||L.set(d,"olddisplay",e?c:n.css(d,"display"))));for(g=0;h>g;g++)d=a[g],d.style&&(b&&"none"!==d.style.display&&""!==d.style.display||(d.style.display=b?f[g]||"":"none"));return a}n.extend({cssHooks:{opacity:{get:function(a,b){if(b){var c=xb(a,"opacity");return""===c?"1":c}}}},cssNumber:{columnCount:!0,fillOpacity:!0,flexGrow:!0,flexShrink:!0,fontWeight:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,widows:!0,zIndex:!0,zoom:!0},cssProps:{"float":"cssFloat"},style:function(a,b,c,d){if(a&&3!==a.nodeType&&8!==a.nodeType&&a.style){var e,f,g,h=n.camelCase(b),i=a.style;return b=n.cssProps[h]||(n.cssProps[h]=Fb(i,h)),g=n.cssHooks[b]||n.cssHooks[h],void 0===c?g&&"get"in g&&void 0!==(e=g.get(a,!1,d))?e:i[b]:(f=typeof c,"string"===f&&(e=Bb.exec(c))&&(c=(e[1]+1)*e[2]+parseFloat(n.css(a,b)),f="number"),null!=c&&c===c&&("number"!==f||n.cssNumber[h]||(c+="px"),k.clearCloneStyle||""!==c||0!==b.indexOf("background")||(i[b]="inherit"),g&&"set"in g&&void 0===(c=g.set(a,c,d))||(i[b]=c)),void 0)}},css:function(a,b,c,d){var e,f,g,h=n.camelCase(b);return b=n.cssProps[h]||(n.cssProps[h]=Fb(a.style,h)),g=n.cssHooks[b]||n.cssHooks[h],g&&"get"in g&&(e=g.get(a,!0,c)),void 0===e&&(e=xb(a,b,d)),"normal"===e&&b in Db&&(e=Db[b]),""===c||c?(f=parseFloat(e),c===!0||n.isNumeric(f)?f||0:e):e}}),n.each(["height","width"],function(a,b){n.cssHooks[b]={get:function(a,c,d){return c?zb.test(n.css(a,"display"))&&0===a.offsetWidth?n.swap(a,Cb,function(){return Ib(a,b,d)}):Ib(a,b,d):void 0},set:function(a,c,d){var e=d&&wb(a);return Gb(a,c,d?Hb(a,b,d,"border-box"===n.css(a,"boxSizing",!1,e),e):0)}}}),n.cssHooks.marginRight=yb(k.reliableMarginRight,function(a,b){return b?n.swap(a,{display:"inline-block"},xb,[a,"marginRight"]):void 0}),n.each({margin:"",padding:"",border:"Width"},function(a,b){n.cssHooks[a+b]={expand:function(c){for(var d=0,e={},f="string"==typeof c?c.split(" "):[c];4>d;d++)e[a+R[d]+b]=f[d]||f[d-2]||f[0];return e}},ub.test(a)||(n.cssHooks[a+b].set=Gb)}),n.fn.extend({css:function(a,b){return J(this,function(a,b,c){var d,e,f={},g=0;if(n.isArray(b)){for(d=wb(a),e=b.length;e>g;g++)f[b[g]]=n.css(a,b[g],!1,d);return f}return void 0!==c?n.style(a,b,c):n.css(a,b)},a,b,arguments.length>1)},show:function(){return Jb(this,!0)},hide:function(){return Jb(this)},toggle:function(a){return"boolean"==typeof a?a?this.show():this.hide():this.each(function(){S(this)?n(this).show():n(this).hide()})}});function Kb(a,b,c,d,e){return new Kb.prototype.init(a,b,c,d,e)}n.Tween=Kb,Kb.prototype={constructor:Kb,init:function(a,b,c,d,e,f){this.elem=a,this.prop=c,this.easing=e||"swing",this.options=b,this.start=this.now=this.cur(),this.end=d,this.unit=f||(n.cssNumber[c]?"":"px")},cur:function(){var a=Kb.propHooks[this.prop];return a&&a.get?a.get(this):Kb.propHooks._default.get(this)},run:function(a){var b,c=Kb.propHooks[this.prop];return this.pos=b=this.options.duration?n.easing[this.easing](a,this.options.duration*a,0,1,this.options.duration):a,this.now=(this.end-this.start)*b+this.start,this.options.step&&this.options.step.call(this.elem,this.now,this),c&&c.set?c.set(this):Kb.propHooks._default.set(this),this}},Kb.prototype.init.prototype=Kb.prototype,Kb.propHooks={_default:{get:function(a){var b;return null==a.elem[a.prop]||a.elem.style&&null!=a.elem.style[a.prop]?(b=n.css(a.elem,a.prop,""),b&&"auto"!==b?b:0):a.elem[a.prop]},set:function(a){n.fx.step[a.prop]?n.fx.step[a.prop](a):a.elem.style&&(null!=a.elem.style[n.cssProps[a.prop]]||n.cssHooks[a.prop])?n.style(a.elem,a.prop,a.now+a.unit):a.elem[a.prop]=a.now}}},Kb.propHooks.scrollTop=Kb.propHooks.scrollLeft={set:function(a){a.elem.nodeType&&a.elem.parentNode&&(a.elem[a.prop]=a.now)}},n.easing={linear:function(a){return a},swing:function(a){return.5-Math.cos(a*Math.PI)/2}},n.fx=Kb.prototype.init,n.fx.step={};var Lb,Mb,Nb=/^(?:toggle|show|hide)$/,Ob=new RegExp("^(?:([+-])=|)("+Q+")([a-z%]*)$","i"),Pb=/queueHooks$/,Qb=[Vb],Rb={"*":[function(a,b){var c=this.createTween(a,b),d=c.cur(),e=Ob.exec(b),f=e&&e[3]||(n.cssNumber[a]?"":"px"),g=(n.cssNumber[a]||"px"!==f&&+d)&&Ob.exec(n.css(c.elem,a)),h=1,i=20;if(g&&g[3]!==f){f=f||g[3],e=e||[],g=+d||1;do h=h||".5",g/=h,n.style(c.elem,a,g+f);while(h!==(h=c.cur()/d)&&1!==h&&--i)}return e&&(g=c.start=+g||+d||0,c.unit=f,c.end=e[1]?g+(e[1]+1)*e[2]:+e[2]),c}]};function Sb(){return setTimeout(function(){Lb=void 0}),Lb=n.now()}function Tb(a,b){var c,d=0,e={height:a};for(b=b?1:0;4>d;d+=2-b)c=R[d],e["margin"+c]=e["padding"+c]=a;return b&&(e.opacity=e.width=a),e}function)***^***",
+R"***^***( Ub(a,b,c){for(var d,e=(Rb[b]||[]).concat(Rb["*"]),f=0,g=e.length;g>f;f++)if(d=e[f].call(c,b,a))return d}function Vb(a,b,c){var d,e,f,g,h,i,j,k,l=this,m={},o=a.style,p=a.nodeType&&S(a),q=L.get(a,"fxshow");c.queue||(h=n._queueHooks(a,"fx"),null==h.unqueued&&(h.unqueued=0,i=h.empty.fire,h.empty.fire=function(){h.unqueued||i()}),h.unqueued++,l.always(function(){l.always(function(){h.unqueued--,n.queue(a,"fx").length||h.empty.fire()})})),1===a.nodeType&&("height"in b||"width"in b)&&(c.overflow=[o.overflow,o.overflowX,o.overflowY],j=n.css(a,"display"),k="none"===j?L.get(a,"olddisplay")||tb(a.nodeName):j,"inline"===k&&"none"===n.css(a,"float")&&(o.display="inline-block")),c.overflow&&(o.overflow="hidden",l.always(function(){o.overflow=c.overflow[0],o.overflowX=c.overflow[1],o.overflowY=c.overflow[2]}));for(d in b)if(e=b[d],Nb.exec(e)){if(delete b[d],f=f||"toggle"===e,e===(p?"hide":"show")){if("show"!==e||!q||void 0===q[d])continue;p=!0}m[d]=q&&q[d]||n.style(a,d)}else j=void 0;if(n.isEmptyObject(m))"inline"===("none"===j?tb(a.nodeName):j)&&(o.display=j);else{q?"hidden"in q&&(p=q.hidden):q=L.access(a,"fxshow",{}),f&&(q.hidden=!p),p?n(a).show():l.done(function(){n(a).hide()}),l.done(function(){var b;L.remove(a,"fxshow");for(b in m)n.style(a,b,m[b])});for(d in m)g=Ub(p?q[d]:0,d,l),d in q||(q[d]=g.start,p&&(g.end=g.start,g.start="width"===d||"height"===d?1:0))}}function Wb(a,b){var c,d,e,f,g;for(c in a)if(d=n.camelCase(c),e=b[d],f=a[c],n.isArray(f)&&(e=f[1],f=a[c]=f[0]),c!==d&&(a[d]=f,delete a[c]),g=n.cssHooks[d],g&&"expand"in g){f=g.expand(f),delete a[d];for(c in f)c in a||(a[c]=f[c],b[c]=e)}else b[d]=e}function Xb(a,b,c){var d,e,f=0,g=Qb.length,h=n.Deferred().always(function(){delete i.elem}),i=function(){if(e)return!1;for(var b=Lb||Sb(),c=Math.max(0,j.startTime+j.duration-b),d=c/j.duration||0,f=1-d,g=0,i=j.tweens.length;i>g;g++)j.tweens[g].run(f);return h.notifyWith(a,[j,f,c]),1>f&&i?c:(h.resolveWith(a,[j]),!1)},j=h.promise({elem:a,props:n.extend({},b),opts:n.extend(!0,{specialEasing:{}},c),originalProperties:b,originalOptions:c,startTime:Lb||Sb(),duration:c.duration,tweens:[],createTween:function(b,c){var d=n.Tween(a,j.opts,b,c,j.opts.specialEasing[b]||j.opts.easing);return j.tweens.push(d),d},stop:function(b){var c=0,d=b?j.tweens.length:0;if(e)return this;for(e=!0;d>c;c++)j.tweens[c].run(1);return b?h.resolveWith(a,[j,b]):h.rejectWith(a,[j,b]),this}}),k=j.props;for(Wb(k,j.opts.specialEasing);g>f;f++)if(d=Qb[f].call(j,a,k,j.opts))return d;return n.map(k,Ub,j),n.isFunction(j.opts.start)&&j.opts.start.call(a,j),n.fx.timer(n.extend(i,{elem:a,anim:j,queue:j.opts.queue})),j.progress(j.opts.progress).done(j.opts.done,j.opts.complete).fail(j.opts.fail).always(j.opts.always)}n.Animation=n.extend(Xb,{tweener:function(a,b){n.isFunction(a)?(b=a,a=["*"]):a=a.split(" ");for(var c,d=0,e=a.length;e>d;d++)c=a[d],Rb[c]=Rb[c]||[],Rb[c].unshift(b)},prefilter:function(a,b){b?Qb.unshift(a):Qb.push(a)}}),n.speed=function(a,b,c){var d=a&&"object"==typeof a?n.extend({},a):{complete:c||!c&&b||n.isFunction(a)&&a,duration:a,easing:c&&b||b&&!n.isFunction(b)&&b};return d.duration=n.fx.off?0:"number"==typeof d.duration?d.duration:d.duration in n.fx.speeds?n.fx.speeds[d.duration]:n.fx.speeds._default,(null==d.queue||d.queue===!0)&&(d.queue="fx"),d.old=d.complete,d.complete=function(){n.isFunction(d.old)&&d.old.call(this),d.queue&&n.dequeue(this,d.queue)},d},n.fn.extend({fadeTo:function(a,b,c,d){return this.filter(S).css("opacity",0).show().end().animate({opacity:b},a,c,d)},animate:function(a,b,c,d){var e=n.isEmptyObject(a),f=n.speed(b,c,d),g=function(){var b=Xb(this,n.extend({},a),f);(e||L.get(this,"finish"))&&b.stop(!0)};return g.finish=g,e||f.queue===!1?this.each(g):this.queue(f.queue,g)},stop:function(a,b,c){var d=function(a){var b=a.stop;delete a.stop,b(c)};return"string"!=typeof a&&(c=b,b=a,a=void 0),b&&a!==!1&&this.queue(a||"fx",[]),this.each(function(){var b=!0,e=null!=a&&a+"queueHooks",f=n.timers,g=L.get(this);if(e)g[e]&&g[e].stop&&d(g[e]);else for(e in g)g[e]&&g[e].stop&&Pb.test(e)&&d(g[e]);for(e=f.length;e--;)f[e].elem!==this||null!=a&&f[e].queue!==a||(f[e].anim.stop(c),b=!1,f.splice(e,1));(b||!c)&&n.dequeue(this,a)})},finish:function(a){return a!==!1&&(a=a||"fx"),this.each(function(){var b,c=L.get(this),d=c[a+"queue"],e=c[a+"queueHooks"],f=n.timers,g=d?d.length:0;for(c.finish=!0,n.queue(this,a,[]),e&&e.stop&&e.stop.call(this,!0),b=f.length;b--;)f[b].elem===this&&f[b].queue===a&&(f[b].anim.stop(!0),f.splice(b,1));for(b=0;g>b;b++)d[b]&&d[b].finish&&d[b].finish.call(this);delete c.finish})}}),n.each(["toggle","show","hide"],function(a,b){var c=n.fn[b];n.fn[b]=function(a,d,e){return null==a||"boolean"==typeof a?c.apply(this,arguments):this.animate(Tb(b,!0),a,d,e)}}),n.each({slideDown:Tb("show"),slideUp:Tb("hide"),slideToggle:Tb("toggle"),fadeIn:{opacity:"show"},fadeOut:{opacity:"hide"},fadeToggle:{opacity:"toggle"}},function(a,b){n.fn[a]=function(a,c,d){return this.animate(b,a,c,d)}}),n.timers=[],n.fx.tick=function(){var a,b=0,c=n.timers;for(Lb=n.now();b<c.length;b++)a=c[b],a()||c[b]!==a||c.splice(b--,1);c.length||n.fx.stop(),Lb=void 0},n.fx.timer=function(a){n.timers.push(a),a()?n.fx.start():n.timers.pop()},n.fx.interval=13,n.fx.start=function(){Mb||(Mb=setInterval(n.fx.tick,n.fx.interval))},n.fx.stop=function(){clearInterval(Mb),Mb=null},n.fx.speeds={slow:600,fast:200,_default:400},n.fn.delay=function(a,b){return a=n.fx?n.fx.speeds[a]||a:a,b=b||"fx",this.queue(b,function(b,c){var d=setTimeout(b,a);c.stop=function(){clearTimeout(d)}})},function(){var a=l.createElement("input"),b=l.createElement("select"),c=b.appendChild(l.createElement("option"));a.type="checkbox",k.checkOn=""!==a.value,k.optSelected=c.selected,b.disabled=!0,k.optDisabled=!c.disabled,a=l.createElement("input"),a.value="t",a.type="radio",k.radioValue="t"===a.value}();var Yb,Zb,$b=n.expr.attrHandle;n.fn.extend({attr:function(a,b){return J(this,n.attr,a,b,arguments.length>1)},removeAttr:function(a){return this.each(function(){n.removeAttr(this,a)})}}),n.extend({attr:function(a,b,c){var d,e,f=a.nodeType;if(a&&3!==f&&8!==f&&2!==f)return typeof a.getAttribute===U?n.prop(a,b,c):(1===f&&n.isXMLDoc(a)||(b=b.toLowerCase(),d=n.attrHooks[b]||(n.expr.match.bool.test(b)?Zb:Yb)),void 0===c?d&&"get"in d&&null!==(e=d.get(a,b))?e:(e=n.find.attr(a,b),null==e?void 0:e):null!==c?d&&"set"in d&&void 0!==(e=d.set(a,c,b))?e:(a.setAttribute(b,c+""),c):void n.removeAttr(a,b))
+},removeAttr:function(a,b){var c,d,e=0,f=b&&b.match(E);if(f&&1===a.nodeType)while(c=f[e++])d=n.propFix[c]||c,n.expr.match.bool.test(c)&&(a[d]=!1),a.removeAttribute(c)},attrHooks:{type:{set:function(a,b){if(!k.radioValue&&"radio"===b&&n.nodeName(a,"input")){var c=a.value;return a.setAttribute("type",b),c&&(a.value=c),b}}}}}),Zb={set:function(a,b,c){return b===!1?n.removeAttr(a,c):a.setAttribute(c,c),c}},n.each(n.expr.match.bool.source.match(/\w+/g),function(a,b){var c=$b[b]||n.find.attr;$b[b]=function(a,b,d){var e,f;return d||(f=$b[b],$b[b]=e,e=null!=c(a,b,d)?b.toLowerCase():null,$b[b]=f),e}});var _b=/^(?:input|select|textarea|button)$/i;n.fn.extend({prop:function(a,b){return J(this,n.prop,a,b,arguments.length>1)},removeProp:function(a){return this.each(function(){delete this[n.propFix[a]||a]})}}),n.extend({propFix:{"for":"htmlFor","class":"className"},prop:function(a,b,c){var d,e,f,g=a.nodeType;if(a&&3!==g&&8!==g&&2!==g)return f=1!==g||!n.isXMLDoc(a),f&&(b=n.propFix[b]||b,e=n.propHooks[b]),void 0!==c?e&&"set"in e&&void 0!==(d=e.set(a,c,b))?d:a[b]=c:e&&"get"in e&&null!==(d=e.get(a,b))?d:a[b]},propHooks:{tabIndex:{get:function(a){return a.hasAttribute("tabindex")||_b.test(a.nodeName)||a.href?a.tabIndex:-1}}}}),k.optSelected||(n.propHooks.selected={get:function(a){var b=a.parentNode;return b&&b.parentNode&&b.parentNode.selectedIndex,null}}),n.each(["tabIndex","readOnly","maxLength","cellSpacing","cellPadding","rowSpan","colSpan","useMap","frameBorder","contentEditable"],function(){n.propFix[this.toLowerCase()]=this});var ac=/[\t\r\n\f]/g;n.fn.extend({addClass:function(a){var b,c,d,e,f,g,h="string"==typeof a&&a,i=0,j=this.length;if(n.isFunction(a))return this.each(function(b){n(this).addClass(a.call(this,b,this.className))});if(h)for(b=(a||"").match(E)||[];j>i;i++)if(c=this[i],d=1===c.nodeType&&(c.className?(" "+c.className+" ").replace(ac," "):" ")){f=0;while(e=b[f++])d.indexOf(" "+e+" ")<0&&(d+=e+" ");g=n.trim(d),c.className!==g&&(c.className=g)}return this},removeClass:function(a){var b,c,d,e,f,g,h=0===arguments.length||"string"==typeof a&&a,i=0,j=this.length;if(n.isFunction(a))return this.each(function(b){n(this).removeClass(a.call(this,b,this.className))});if(h)for(b=(a||"").match(E)||[];j>i;i++)if(c=this[i],d=1===c.nodeType&&(c.className?(" "+c.className+" ").replace(ac," "):"")){f=0;while(e=b[f++])while(d.indexOf(" "+e+" ")>=0)d=d.replace(" "+e+" "," ");g=a?n.trim(d):"",c.className!==g&&(c.className=g)}return this},toggleClass:function(a,b){var c=typeof a;return"boolean"==typeof b&&"string"===c?b?this.addClass(a):this.removeClass(a):this.each(n.isFunction(a)?function(c){n(this).toggleClass(a.call(this,c,this.className,b),b)}:function(){if("string"===c){var b,d=0,e=n(this),f=a.match(E)||[];while(b=f[d++])e.hasClass(b)?e.removeClass(b):e.addClass(b)}else(c===U||"boolean"===c)&&(this.className&&L.set(this,"__className__",this.className),this.className=this.className||a===!1?"":L.get(this,"__className__")||"")})},hasClass:function(a){for(var b=" "+a+" ",c=0,d=this.length;d>c;c++)if(1===this[c].nodeType&&(" "+this[c].className+" ").replace(ac," ").indexOf(b)>=0)return!0;return!1}});var bc=/\r/g;n.fn.extend({val:function(a){var b,c,d,e=this[0];{if(arguments.length)return d=n.isFunction(a),this.each(function(c){var e;1===this.nodeType&&(e=d?a.call(this,c,n(this).val()):a,null==e?e="":"number"==typeof e?e+="":n.isArray(e)&&(e=n.map(e,function(a){return null==a?"":a+""})),b=n.valHooks[this.type]||n.valHooks[this.nodeName.toLowerCase()],b&&"set"in b&&void 0!==b.set(this,e,"value")||(this.value=e))});if(e)return b=n.valHooks[e.type]||)***^***",
+R"***^***(n.valHooks[e.nodeName.toLowerCase()],b&&"get"in b&&void 0!==(c=b.get(e,"value"))?c:(c=e.value,"string"==typeof c?c.replace(bc,""):null==c?"":c)}}}),n.extend({valHooks:{option:{get:function(a){var b=n.find.attr(a,"value");return null!=b?b:n.trim(n.text(a))}},select:{get:function(a){for(var b,c,d=a.options,e=a.selectedIndex,f="select-one"===a.type||0>e,g=f?null:[],h=f?e+1:d.length,i=0>e?h:f?e:0;h>i;i++)if(c=d[i],!(!c.selected&&i!==e||(k.optDisabled?c.disabled:null!==c.getAttribute("disabled"))||c.parentNode.disabled&&n.nodeName(c.parentNode,"optgroup"))){if(b=n(c).val(),f)return b;g.push(b)}return g},set:function(a,b){var c,d,e=a.options,f=n.makeArray(b),g=e.length;while(g--)d=e[g],(d.selected=n.inArray(d.value,f)>=0)&&(c=!0);return c||(a.selectedIndex=-1),f}}}}),n.each(["radio","checkbox"],function(){n.valHooks[this]={set:function(a,b){return n.isArray(b)?a.checked=n.inArray(n(a).val(),b)>=0:void 0}},k.checkOn||(n.valHooks[this].get=function(a){return null===a.getAttribute("value")?"on":a.value})}),n.each("blur focus focusin focusout load resize scroll unload click dblclick mousedown mouseup mousemove mouseover mouseout mouseenter mouseleave change select submit keydown keypress keyup error contextmenu".split(" "),function(a,b){n.fn[b]=function(a,c){return arguments.length>0?this.on(b,null,a,c):this.trigger(b)}}),n.fn.extend({hover:function(a,b){return this.mouseenter(a).mouseleave(b||a)},bind:function(a,b,c){return this.on(a,null,b,c)},unbind:function(a,b){return this.off(a,null,b)},delegate:function(a,b,c,d){return this.on(b,a,c,d)},undelegate:function(a,b,c){return 1===arguments.length?this.off(a,"**"):this.off(b,a||"**",c)}});var cc=n.now(),dc=/\?/;n.parseJSON=function(a){return JSON.parse(a+"")},n.parseXML=function(a){var b,c;if(!a||"string"!=typeof a)return null;try{c=new DOMParser,b=c.parseFromString(a,"text/xml")}catch(d){b=void 0}return(!b||b.getElementsByTagName("parsererror").length)&&n.error("Invalid XML: "+a),b};var ec,fc,gc=/#.*$/,hc=/([?&])_=[^&]*/,ic=/^(.*?):[ \t]*([^\r\n]*)$/gm,jc=/^(?:about|app|app-storage|.+-extension|file|res|widget):$/,kc=/^(?:GET|HEAD)$/,lc=/^\/\//,mc=/^([\w.+-]+:)(?:\/\/(?:[^\/?#]*@|)([^\/?#:]*)(?::(\d+)|)|)/,nc={},oc={},pc="*/".concat("*");try{fc=location.href}catch(qc){fc=l.createElement("a"),fc.href="",fc=fc.href}ec=mc.exec(fc.toLowerCase())||[];function rc(a){return function(b,c){"string"!=typeof b&&(c=b,b="*");var d,e=0,f=b.toLowerCase().match(E)||[];if(n.isFunction(c))while(d=f[e++])"+"===d[0]?(d=d.slice(1)||"*",(a[d]=a[d]||[]).unshift(c)):(a[d]=a[d]||[]).push(c)}}function sc(a,b,c,d){var e={},f=a===oc;function g(h){var i;return e[h]=!0,n.each(a[h]||[],function(a,h){var j=h(b,c,d);return"string"!=typeof j||f||e[j]?f?!(i=j):void 0:(b.dataTypes.unshift(j),g(j),!1)}),i}return g(b.dataTypes[0])||!e["*"]&&g("*")}function tc(a,b){var c,d,e=n.ajaxSettings.flatOptions||{};for(c in b)void 0!==b[c]&&((e[c]?a:d||(d={}))[c]=b[c]);return d&&n.extend(!0,a,d),a}function uc(a,b,c){var d,e,f,g,h=a.contents,i=a.dataTypes;while("*"===i[0])i.shift(),void 0===d&&(d=a.mimeType||b.getResponseHeader("Content-Type"));if(d)for(e in h)if(h[e]&&h[e].test(d)){i.unshift(e);break}if(i[0]in c)f=i[0];else{for(e in c){if(!i[0]||a.converters[e+" "+i[0]]){f=e;break}g||(g=e)}f=f||g}return f?(f!==i[0]&&i.unshift(f),c[f]):void 0}function vc(a,b,c,d){var e,f,g,h,i,j={},k=a.dataTypes.slice();if(k[1])for(g in a.converters)j[g.toLowerCase()]=a.converters[g];f=k.shift();while(f)if(a.responseFields[f]&&(c[a.responseFields[f]]=b),!i&&d&&a.dataFilter&&(b=a.dataFilter(b,a.dataType)),i=f,f=k.shift())if("*"===f)f=i;else if("*"!==i&&i!==f){if(g=j[i+" "+f]||j["* "+f],!g)for(e in j)if(h=e.split(" "),h[1]===f&&(g=j[i+" "+h[0]]||j["* "+h[0]])){g===!0?g=j[e]:j[e]!==!0&&(f=h[0],k.unshift(h[1]));break}if(g!==!0)if(g&&a["throws"])b=g(b);else try{b=g(b)}catch(l){return{state:"parsererror",error:g?l:"No conversion from "+i+" to "+f}}}return{state:"success",data:b}}n.extend({active:0,lastModified:{},etag:{},ajaxSettings:{url:fc,type:"GET",isLocal:jc.test(ec[1]),global:!0,processData:!0,async:!0,contentType:"application/x-www-form-urlencoded; charset=UTF-8",accepts:{"*":pc,text:"text/plain",html:"text/html",xml:"application/xml, text/xml",json:"application/json, text/javascript"},contents:{xml:/xml/,html:/html/,json:/json/},responseFields:{xml:"responseXML",text:"responseText",json:"responseJSON"},converters:{"* text":String,"text html":!0,"text json":n.parseJSON,"text xml":n.parseXML},flatOptions:{url:!0,context:!0}},ajaxSetup:function(a,b){return b?tc(tc(a,n.ajaxSettings),b):tc(n.ajaxSettings,a)},ajaxPrefilter:rc(nc),ajaxTransport:rc(oc),ajax:function(a,b){"object"==typeof a&&(b=a,a=void 0),b=b||{};var c,d,e,f,g,h,i,j,k=n.ajaxSetup({},b),l=k.context||k,m=k.context&&(l.nodeType||l.jquery)?n(l):n.event,o=n.Deferred(),p=n.Callbacks("once memory"),q=k.statusCode||{},r={},s={},t=0,u="canceled",v={readyState:0,getResponseHeader:function(a){var b;if(2===t){if(!f){f={};while(b=ic.exec(e))f[b[1].toLowerCase()]=b[2]}b=f[a.toLowerCase()]}return null==b?null:b},getAllResponseHeaders:function(){return 2===t?e:null},setRequestHeader:function(a,b){var c=a.toLowerCase();return t||(a=s[c]=s[c]||a,r[a]=b),this},overrideMimeType:function(a){return t||(k.mimeType=a),this},statusCode:function(a){var b;if(a)if(2>t)for(b in a)q[b]=[q[b],a[b]];else v.always(a[v.status]);return this},abort:function(a){var b=a||u;return c&&c.abort(b),x(0,b),this}};if(o.promise(v).complete=p.add,v.success=v.done,v.error=v.fail,k.url=((a||k.url||fc)+"").replace(gc,"").replace(lc,ec[1]+"//"),k.type=b.method||b.type||k.method||k.type,k.dataTypes=n.trim(k.dataType||"*").toLowerCase().match(E)||[""],null==k.crossDomain&&(h=mc.exec(k.url.toLowerCase()),k.crossDomain=!(!h||h[1]===ec[1]&&h[2]===ec[2]&&(h[3]||("http:"===h[1]?"80":"443"))===(ec[3]||("http:"===ec[1]?"80":"443")))),k.data&&k.processData&&"string"!=typeof k.data&&(k.data=n.param(k.data,k.traditional)),sc(nc,k,b,v),2===t)return v;i=k.global,i&&0===n.active++&&n.event.trigger("ajaxStart"),k.type=k.type.toUpperCase(),k.hasContent=!kc.test(k.type),d=k.url,k.hasContent||(k.data&&(d=k.url+=(dc.test(d)?"&":"?")+k.data,delete k.data),k.cache===!1&&(k.url=hc.test(d)?d.replace(hc,"$1_="+cc++):d+(dc.test(d)?"&":"?")+"_="+cc++)),k.ifModified&&(n.lastModified[d]&&v.setRequestHeader("If-Modified-Since",n.lastModified[d]),n.etag[d]&&v.setRequestHeader("If-None-Match",n.etag[d])),(k.data&&k.hasContent&&k.contentType!==!1||b.contentType)&&v.setRequestHeader("Content-Type",k.contentType),v.setRequestHeader("Accept",k.dataTypes[0]&&k.accepts[k.dataTypes[0]]?k.accepts[k.dataTypes[0]]+("*"!==k.dataTypes[0]?", "+pc+"; q=0.01":""):k.accepts["*"]);for(j in k.headers)v.setRequestHeader(j,k.headers[j]);if(k.beforeSend&&(k.beforeSend.call(l,v,k)===!1||2===t))return v.abort();u="abort";for(j in{success:1,error:1,complete:1})v[j](k[j]);if(c=sc(oc,k,b,v)){v.readyState=1,i&&m.trigger("ajaxSend",[v,k]),k.async&&k.timeout>0&&(g=setTimeout(function(){v.abort("timeout")},k.timeout));try{t=1,c.send(r,x)}catch(w){if(!(2>t))throw w;x(-1,w)}}else x(-1,"No Transport");function x(a,b,f,h){var j,r,s,u,w,x=b;2!==t&&(t=2,g&&clearTimeout(g),c=void 0,e=h||"",v.readyState=a>0?4:0,j=a>=200&&300>a||304===a,f&&(u=uc(k,v,f)),u=vc(k,u,v,j),j?(k.ifModified&&(w=v.getResponseHeader("Last-Modified"),w&&(n.lastModified[d]=w),w=v.getResponseHeader("etag"),w&&(n.etag[d]=w)),204===a||"HEAD"===k.type?x="nocontent":304===a?x="notmodified":(x=u.state,r=u.data,s=u.error,j=!s)):(s=x,(a||!x)&&(x="error",0>a&&(a=0))),v.status=a,v.statusText=(b||x)+"",j?o.resolveWith(l,[r,x,v]):o.rejectWith(l,[v,x,s]),v.statusCode(q),q=void 0,i&&m.trigger(j?"ajaxSuccess":"ajaxError",[v,k,j?r:s]),p.fireWith(l,[v,x]),i&&(m.trigger("ajaxComplete",[v,k]),--n.active||n.event.trigger("ajaxStop")))}return v},getJSON:function(a,b,c){return n.get(a,b,c,"json")},getScript:function(a,b){return n.get(a,void 0,b,"script")}}),n.each(["get","post"],function(a,b){n[b]=function(a,c,d,e){return n.isFunction(c)&&(e=e||d,d=c,c=void 0),n.ajax({url:a,type:b,dataType:e,data:c,success:d})}}),n.each(["ajaxStart","ajaxStop","ajaxComplete","ajaxError","ajaxSuccess","ajaxSend"],function(a,b){n.fn[b]=function(a){return this.on(b,a)}}),n._evalUrl=function(a){return n.ajax({url:a,type:"GET",dataType:"script",async:!1,global:!1,"throws":!0})},n.fn.extend({wrapAll:function(a){var b;return n.isFunction(a)?this.each(function(b){n(this).wrapAll(a.call(this,b))}):(this[0]&&(b=n(a,this[0].ownerDocument).eq(0).clone(!0),this[0].parentNode&&b.insertBefore(this[0]),b.map(function(){var a=this;while(a.firstElementChild)a=a.firstElementChild;return a}).append(this)),this)},wrapInner:function(a){return this.each(n.isFunction(a)?function(b){n(this).wrapInner(a.call(this,b))}:function(){var b=n(this),c=b.contents();c.length?c.wrapAll(a):b.append(a)})},wrap:function(a){var b=n.isFunction(a);return this.each(function(c){n(this).wrapAll(b?a.call(this,c):a)})},unwrap:function(){return this.parent().each(function(){n.nodeName(this,"body")||n(this).replaceWith(this.childNodes)}).end()}}),n.expr.filters.hidden=function(a){return a.offsetWidth<=0&&a.offsetHeight<=0},n.expr.filters.visible=function(a){return!n.expr.filters.hidden(a)};var wc=/%20/g,xc=/\[\]$/,yc=/\r?\n/g,zc=/^(?:submit|button|image|reset|file)$/i,Ac=/^(?:input|select|textarea|keygen)/i;function Bc(a,b,c,d){var e;if(n.isArray(b))n.each(b,function(b,e){c||xc.test(a)?d(a,e):Bc(a+"["+("object"==typeof e?b:"")+"]",e,c,d)});else if(c||"object"!==n.type(b))d(a,b);else for(e in b)Bc(a+"["+e+"]",b[e],c,d)}n.param=function(a,b){var c,d=[],e=function(a,b){b=n.isFunction(b)?b():null==b?"":b,d[d.length]=encodeURIComponent(a)+"="+encodeURIComponent(b)};if(void 0===b&&(b=n.ajaxSettings&&n.ajaxSettings.traditional),n.isArray(a)||a.jquery&&!n.isPlainObject(a))n.each(a,function(){e(this.name,this.value)});else for(c in a)Bc(c,a[c],b,e);return d.join("&").replace(wc,"+")},n.fn.extend({serialize:function(){return n.param(this.serializeArray())},serializeArray:function(){return this.map(function(){var a=n.)***^***",
+R"***^***(prop(this,"elements");return a?n.makeArray(a):this}).filter(function(){var a=this.type;return this.name&&!n(this).is(":disabled")&&Ac.test(this.nodeName)&&!zc.test(a)&&(this.checked||!T.test(a))}).map(function(a,b){var c=n(this).val();return null==c?null:n.isArray(c)?n.map(c,function(a){return{name:b.name,value:a.replace(yc,"\r\n")}}):{name:b.name,value:c.replace(yc,"\r\n")}}).get()}}),n.ajaxSettings.xhr=function(){try{return new XMLHttpRequest}catch(a){}};var Cc=0,Dc={},Ec={0:200,1223:204},Fc=n.ajaxSettings.xhr();a.ActiveXObject&&n(a).on("unload",function(){for(var a in Dc)Dc[a]()}),k.cors=!!Fc&&"withCredentials"in Fc,k.ajax=Fc=!!Fc,n.ajaxTransport(function(a){var b;return k.cors||Fc&&!a.crossDomain?{send:function(c,d){var e,f=a.xhr(),g=++Cc;if(f.open(a.type,a.url,a.async,a.username,a.password),a.xhrFields)for(e in a.xhrFields)f[e]=a.xhrFields[e];a.mimeType&&f.overrideMimeType&&f.overrideMimeType(a.mimeType),a.crossDomain||c["X-Requested-With"]||(c["X-Requested-With"]="XMLHttpRequest");for(e in c)f.setRequestHeader(e,c[e]);b=function(a){return function(){b&&(delete Dc[g],b=f.onload=f.onerror=null,"abort"===a?f.abort():"error"===a?d(f.status,f.statusText):d(Ec[f.status]||f.status,f.statusText,"string"==typeof f.responseText?{text:f.responseText}:void 0,f.getAllResponseHeaders()))}},f.onload=b(),f.onerror=b("error"),b=Dc[g]=b("abort");try{f.send(a.hasContent&&a.data||null)}catch(h){if(b)throw h}},abort:function(){b&&b()}}:void 0}),n.ajaxSetup({accepts:{script:"text/javascript, application/javascript, application/ecmascript, application/x-ecmascript"},contents:{script:/(?:java|ecma)script/},converters:{"text script":function(a){return n.globalEval(a),a}}}),n.ajaxPrefilter("script",function(a){void 0===a.cache&&(a.cache=!1),a.crossDomain&&(a.type="GET")}),n.ajaxTransport("script",function(a){if(a.crossDomain){var b,c;return{send:function(d,e){b=n("<script>").prop({async:!0,charset:a.scriptCharset,src:a.url}).on("load error",c=function(a){b.remove(),c=null,a&&e("error"===a.type?404:200,a.type)}),l.head.appendChild(b[0])},abort:function(){c&&c()}}}});var Gc=[],Hc=/(=)\?(?=&|$)|\?\?/;n.ajaxSetup({jsonp:"callback",jsonpCallback:function(){var a=Gc.pop()||n.expando+"_"+cc++;return this[a]=!0,a}}),n.ajaxPrefilter("json jsonp",function(b,c,d){var e,f,g,h=b.jsonp!==!1&&(Hc.test(b.url)?"url":"string"==typeof b.data&&!(b.contentType||"").indexOf("application/x-www-form-urlencoded")&&Hc.test(b.data)&&"data");return h||"jsonp"===b.dataTypes[0]?(e=b.jsonpCallback=n.isFunction(b.jsonpCallback)?b.jsonpCallback():b.jsonpCallback,h?b[h]=b[h].replace(Hc,"$1"+e):b.jsonp!==!1&&(b.url+=(dc.test(b.url)?"&":"?")+b.jsonp+"="+e),b.converters["script json"]=function(){return g||n.error(e+" was not called"),g[0]},b.dataTypes[0]="json",f=a[e],a[e]=function(){g=arguments},d.always(function(){a[e]=f,b[e]&&(b.jsonpCallback=c.jsonpCallback,Gc.push(e)),g&&n.isFunction(f)&&f(g[0]),g=f=void 0}),"script"):void 0}),n.parseHTML=function(a,b,c){if(!a||"string"!=typeof a)return null;"boolean"==typeof b&&(c=b,b=!1),b=b||l;var d=v.exec(a),e=!c&&[];return d?[b.createElement(d[1])]:(d=n.buildFragment([a],b,e),e&&e.length&&n(e).remove(),n.merge([],d.childNodes))};var Ic=n.fn.load;n.fn.load=function(a,b,c){if("string"!=typeof a&&Ic)return Ic.apply(this,arguments);var d,e,f,g=this,h=a.indexOf(" ");return h>=0&&(d=n.trim(a.slice(h)),a=a.slice(0,h)),n.isFunction(b)?(c=b,b=void 0):b&&"object"==typeof b&&(e="POST"),g.length>0&&n.ajax({url:a,type:e,dataType:"html",data:b}).done(function(a){f=arguments,g.html(d?n("<div>").append(n.parseHTML(a)).find(d):a)}).complete(c&&function(a,b){g.each(c,f||[a.responseText,b,a])}),this},n.expr.filters.animated=function(a){return n.grep(n.timers,function(b){return a===b.elem}).length};var Jc=a.document.documentElement;function Kc(a){return n.isWindow(a)?a:9===a.nodeType&&a.defaultView}n.offset={setOffset:function(a,b,c){var d,e,f,g,h,i,j,k=n.css(a,"position"),l=n(a),m={};"static"===k&&(a.style.position="relative"),h=l.offset(),f=n.css(a,"top"),i=n.css(a,"left"),j=("absolute"===k||"fixed"===k)&&(f+i).indexOf("auto")>-1,j?(d=l.position(),g=d.top,e=d.left):(g=parseFloat(f)||0,e=parseFloat(i)||0),n.isFunction(b)&&(b=b.call(a,c,h)),null!=b.top&&(m.top=b.top-h.top+g),null!=b.left&&(m.left=b.left-h.left+e),"using"in b?b.using.call(a,m):l.css(m)}},n.fn.extend({offset:function(a){if(arguments.length)return void 0===a?this:this.each(function(b){n.offset.setOffset(this,a,b)});var b,c,d=this[0],e={top:0,left:0},f=d&&d.ownerDocument;if(f)return b=f.documentElement,n.contains(b,d)?(typeof d.getBoundingClientRect!==U&&(e=d.getBoundingClientRect()),c=Kc(f),{top:e.top+c.pageYOffset-b.clientTop,left:e.left+c.pageXOffset-b.clientLeft}):e},position:function(){if(this[0]){var a,b,c=this[0],d={top:0,left:0};return"fixed"===n.css(c,"position")?b=c.getBoundingClientRect():(a=this.offsetParent(),b=this.offset(),n.nodeName(a[0],"html")||(d=a.offset()),d.top+=n.css(a[0],"borderTopWidth",!0),d.left+=n.css(a[0],"borderLeftWidth",!0)),{top:b.top-d.top-n.css(c,"marginTop",!0),left:b.left-d.left-n.css(c,"marginLeft",!0)}}},offsetParent:function(){return this.map(function(){var a=this.offsetParent||Jc;while(a&&!n.nodeName(a,"html")&&"static"===n.css(a,"position"))a=a.offsetParent;return a||Jc})}}),n.each({scrollLeft:"pageXOffset",scrollTop:"pageYOffset"},function(b,c){var d="pageYOffset"===c;n.fn[b]=function(e){return J(this,function(b,e,f){var g=Kc(b);return void 0===f?g?g[c]:b[e]:void(g?g.scrollTo(d?a.pageXOffset:f,d?f:a.pageYOffset):b[e]=f)},b,e,arguments.length,null)}}),n.each(["top","left"],function(a,b){n.cssHooks[b]=yb(k.pixelPosition,function(a,c){return c?(c=xb(a,b),vb.test(c)?n(a).position()[b]+"px":c):void 0})}),n.each({Height:"height",Width:"width"},function(a,b){n.each({padding:"inner"+a,content:b,"":"outer"+a},function(c,d){n.fn[d]=function(d,e){var f=arguments.length&&(c||"boolean"!=typeof d),g=c||(d===!0||e===!0?"margin":"border");return J(this,function(b,c,d){var e;return n.isWindow(b)?b.document.documentElement["client"+a]:9===b.nodeType?(e=b.documentElement,Math.max(b.body["scroll"+a],e["scroll"+a],b.body["offset"+a],e["offset"+a],e["client"+a])):void 0===d?n.css(b,c,g):n.style(b,c,d,g)},b,f?d:void 0,f,null)}})}),n.fn.size=function(){return this.length},n.fn.andSelf=n.fn.addBack,"function"==typeof define&&define.amd&&define("jquery",[],function(){return n});var Lc=a.jQuery,Mc=a.$;return n.noConflict=function(b){return a.$===n&&(a.$=Mc),b&&a.jQuery===n&&(a.jQuery=Lc),n},typeof b===U&&(a.jQuery=a.$=n),n});
+
+        </script>
+
+        <script>
+/*
+ Highcharts JS v4.0.4 (2014-09-02)
+
+ (c) 2009-2014 Torstein Honsi
+
+ License: www.highcharts.com/license
+*/
+(function(){function r(a,b){var c;a||(a={});for(c in b)a[c]=b[c];return a}function w(){var a,b=arguments,c,d={},e=function(a,b){var c,d;typeof a!=="object"&&(a={});for(d in b)b.hasOwnProperty(d)&&(c=b[d],a[d]=c&&typeof c==="object"&&Object.prototype.toString.call(c)!=="[object Array]"&&d!=="renderTo"&&typeof c.nodeType!=="number"?e(a[d]||{},c):b[d]);return a};b[0]===!0&&(d=b[1],b=Array.prototype.slice.call(b,2));c=b.length;for(a=0;a<c;a++)d=e(d,b[a]);return d}function y(a,b){return parseInt(a,b||
+10)}function Ga(a){return typeof a==="string"}function da(a){return a&&typeof a==="object"}function Ha(a){return Object.prototype.toString.call(a)==="[object Array]"}function ja(a){return typeof a==="number"}function za(a){return V.log(a)/V.LN10}function ka(a){return V.pow(10,a)}function la(a,b){for(var c=a.length;c--;)if(a[c]===b){a.splice(c,1);break}}function s(a){return a!==u&&a!==null}function F(a,b,c){var d,e;if(Ga(b))s(c)?a.setAttribute(b,c):a&&a.getAttribute&&(e=a.getAttribute(b));else if(s(b)&&
+da(b))for(d in b)a.setAttribute(d,b[d]);return e}function ra(a){return Ha(a)?a:[a]}function p(){var a=arguments,b,c,d=a.length;for(b=0;b<d;b++)if(c=a[b],c!==u&&c!==null)return c}function B(a,b){if(Aa&&!ba&&b&&b.opacity!==u)b.filter="alpha(opacity="+b.opacity*100+")";r(a.style,b)}function $(a,b,c,d,e){a=x.createElement(a);b&&r(a,b);e&&B(a,{padding:0,border:P,margin:0});c&&B(a,c);d&&d.appendChild(a);return a}function ma(a,b){var c=function(){return u};c.prototype=new a;r(c.prototype,b);return c}function Ba(a,
+b,c,d){var e=K.numberFormat,f=E.lang,g=+a||0,h=b===-1?(g.toString().split(".")[1]||"").length:isNaN(b=Q(b))?2:b,i=c===void 0?f.decimalPoint:c,f=d===void 0?f.thousandsSep:d,j=g<0?"-":"",k=String(y(g=Q(g).toFixed(h))),l=k.length>3?k.length%3:0;return e!==Ba?e(a,b,c,d):j+(l?k.substr(0,l)+f:"")+k.substr(l).replace(/(\d{3})(?=\d)/g,"$1"+f)+(h?i+Q(g-k).toFixed(h).slice(2):"")}function Ia(a,b){return Array((b||2)+1-String(a).length).join(0)+a}function Na(a,b,c){var d=a[b];a[b]=function(){var a=Array.prototype.slice.call(arguments);
+a.unshift(d);return c.apply(this,a)}}function Ja(a,b){for(var c="{",d=!1,e,f,g,h,i,j=[];(c=a.indexOf(c))!==-1;){e=a.slice(0,c);if(d){f=e.split(":");g=f.shift().split(".");i=g.length;e=b;for(h=0;h<i;h++)e=e[g[h]];if(f.length)f=f.join(":"),g=/\.([0-9])/,h=E.lang,i=void 0,/f$/.test(f)?(i=(i=f.match(g))?i[1]:-1,e!==null&&(e=Ba(e,i,h.decimalPoint,f.indexOf(",")>-1?h.thousandsSep:""))):e=cb(f,e)}j.push(e);a=a.slice(c+1);c=(d=!d)?"}":"{"}j.push(a);return j.join("")}function mb(a){return V.pow(10,U(V.log(a)/
+V.LN10))}function nb(a,b,c,d){var e,c=p(c,1);e=a/c;b||(b=[1,2,2.5,5,10],d===!1&&(c===1?b=[1,2,5,10]:c<=0.1&&(b=[1/c])));for(d=0;d<b.length;d++)if(a=b[d],e<=(b[d]+(b[d+1]||b[d]))/2)break;a*=c;return a}function ob(a,b){var c=a.length,d,e;for(e=0;e<c;e++)a[e].ss_i=e;a.sort(function(a,c){d=b(a,c);return d===0?a.ss_i-c.ss_i:d});for(e=0;e<c;e++)delete a[e].ss_i}function Oa(a){for(var b=a.length,c=a[0];b--;)a[b]<c&&(c=a[b]);return c}function Ca(a){for(var b=a.length,c=a[0];b--;)a[b]>c&&(c=a[b]);return c}
+function Pa(a,b){for(var c in a)a[c]&&a[c]!==b&&a[c].destroy&&a[c].destroy(),delete a[c]}function Qa(a){db||(db=$(Ka));a&&db.appendChild(a);db.innerHTML=""}function ea(a){return parseFloat(a.toPrecision(14))}function Ra(a,b){va=p(a,b.animation)}function Bb(){var a=E.global.useUTC,b=a?"g)***^***",
+R"***^***(etUTC":"get",c=a?"setUTC":"set";Da=E.global.Date||window.Date;Sa=(a&&E.global.timezoneOffset||0)*6E4;eb=a?Da.UTC:function(a,b,c,g,h,i){return(new Da(a,b,p(c,1),p(g,0),p(h,0),p(i,0))).getTime()};pb=b+"Minutes";qb=b+
+"Hours";rb=b+"Day";Xa=b+"Date";fb=b+"Month";gb=b+"FullYear";Cb=c+"Minutes";Db=c+"Hours";sb=c+"Date";Eb=c+"Month";Fb=c+"FullYear"}function S(){}function Ta(a,b,c,d){this.axis=a;this.pos=b;this.type=c||"";this.isNew=!0;!c&&!d&&this.addLabel()}function na(){this.init.apply(this,arguments)}function Ya(){this.init.apply(this,arguments)}function Gb(a,b,c,d,e){var f=a.chart.inverted;this.axis=a;this.isNegative=c;this.options=b;this.x=d;this.total=null;this.points={};this.stack=e;this.alignOptions={align:b.align||
+(f?c?"left":"right":"center"),verticalAlign:b.verticalAlign||(f?"middle":c?"bottom":"top"),y:p(b.y,f?4:c?14:-6),x:p(b.x,f?c?-6:6:0)};this.textAlign=b.textAlign||(f?c?"right":"left":"center")}var u,x=document,G=window,V=Math,v=V.round,U=V.floor,La=V.ceil,t=V.max,L=V.min,Q=V.abs,aa=V.cos,fa=V.sin,oa=V.PI,Ea=oa*2/360,wa=navigator.userAgent,Hb=G.opera,Aa=/msie/i.test(wa)&&!Hb,hb=x.documentMode===8,tb=/AppleWebKit/.test(wa),Ua=/Firefox/.test(wa),Ib=/(Mobile|Android|Windows Phone)/.test(wa),xa="http://www.w3.org/2000/svg",
+ba=!!x.createElementNS&&!!x.createElementNS(xa,"svg").createSVGRect,Ob=Ua&&parseInt(wa.split("Firefox/")[1],10)<4,ga=!ba&&!Aa&&!!x.createElement("canvas").getContext,Za,$a,Jb={},ub=0,db,E,cb,va,vb,A,ha,sa=function(){return u},W=[],ab=0,Ka="div",P="none",Pb=/^[0-9]+$/,Qb="stroke-width",Da,eb,Sa,pb,qb,rb,Xa,fb,gb,Cb,Db,sb,Eb,Fb,H={},K;G.Highcharts?ha(16,!0):K=G.Highcharts={};cb=function(a,b,c){if(!s(b)||isNaN(b))return"Invalid date";var a=p(a,"%Y-%m-%d %H:%M:%S"),d=new Da(b-Sa),e,f=d[qb](),g=d[rb](),
+h=d[Xa](),i=d[fb](),j=d[gb](),k=E.lang,l=k.weekdays,d=r({a:l[g].substr(0,3),A:l[g],d:Ia(h),e:h,b:k.shortMonths[i],B:k.months[i],m:Ia(i+1),y:j.toString().substr(2,2),Y:j,H:Ia(f),I:Ia(f%12||12),l:f%12||12,M:Ia(d[pb]()),p:f<12?"AM":"PM",P:f<12?"am":"pm",S:Ia(d.getSeconds()),L:Ia(v(b%1E3),3)},K.dateFormats);for(e in d)for(;a.indexOf("%"+e)!==-1;)a=a.replace("%"+e,typeof d[e]==="function"?d[e](b):d[e]);return c?a.substr(0,1).toUpperCase()+a.substr(1):a};ha=function(a,b){var c="Highcharts error #"+a+": www.highcharts.com/errors/"+
+a;if(b)throw c;G.console&&console.log(c)};A={millisecond:1,second:1E3,minute:6E4,hour:36E5,day:864E5,week:6048E5,month:26784E5,year:31556952E3};vb={init:function(a,b,c){var b=b||"",d=a.shift,e=b.indexOf("C")>-1,f=e?7:3,g,b=b.split(" "),c=[].concat(c),h,i,j=function(a){for(g=a.length;g--;)a[g]==="M"&&a.splice(g+1,0,a[g+1],a[g+2],a[g+1],a[g+2])};e&&(j(b),j(c));a.isArea&&(h=b.splice(b.length-6,6),i=c.splice(c.length-6,6));if(d<=c.length/f&&b.length===c.length)for(;d--;)c=[].concat(c).splice(0,f).concat(c);
+a.shift=0;if(b.length)for(a=c.length;b.length<a;)d=[].concat(b).splice(b.length-f,f),e&&(d[f-6]=d[f-2],d[f-5]=d[f-1]),b=b.concat(d);h&&(b=b.concat(h),c=c.concat(i));return[b,c]},step:function(a,b,c,d){var e=[],f=a.length;if(c===1)e=d;else if(f===b.length&&c<1)for(;f--;)d=parseFloat(a[f]),e[f]=isNaN(d)?a[f]:c*parseFloat(b[f]-d)+d;else e=b;return e}};(function(a){G.HighchartsAdapter=G.HighchartsAdapter||a&&{init:function(b){var c=a.fx;a.extend(a.easing,{easeOutQuad:function(a,b,c,g,h){return-g*(b/=
+h)*(b-2)+c}});a.each(["cur","_default","width","height","opacity"],function(b,e){var f=c.step,g;e==="cur"?f=c.prototype:e==="_default"&&a.Tween&&(f=a.Tween.propHooks[e],e="set");(g=f[e])&&(f[e]=function(a){var c,a=b?a:this;if(a.prop!=="align")return c=a.elem,c.attr?c.attr(a.prop,e==="cur"?u:a.now):g.apply(this,arguments)})});Na(a.cssHooks.opacity,"get",function(a,b,c){return b.attr?b.opacity||0:a.call(this,b,c)});this.addAnimSetter("d",function(a){var c=a.elem,f;if(!a.started)f=b.init(c,c.d,c.toD),
+a.start=f[0],a.end=f[1],a.started=!0;c.attr("d",b.step(a.start,a.end,a.pos,c.toD))});this.each=Array.prototype.forEach?function(a,b){return Array.prototype.forEach.call(a,b)}:function(a,b){var c,g=a.length;for(c=0;c<g;c++)if(b.call(a[c],a[c],c,a)===!1)return c};a.fn.highcharts=function(){var a="Chart",b=arguments,c,g;if(this[0]){Ga(b[0])&&(a=b[0],b=Array.prototype.slice.call(b,1));c=b[0];if(c!==u)c.chart=c.chart||{},c.chart.renderTo=this[0],new K[a](c,b[1]),g=this;c===u&&(g=W[F(this[0],"data-highcharts-chart")])}return g}},
+addAnimSetter:function(b,c){a.Tween?a.Tween.propHooks[b]={set:c}:a.fx.step[b]=c},getScript:a.getScript,inArray:a.inArray,adapterRun:function(b,c){return a(b)[c]()},grep:a.grep,map:function(a,c){for(var d=[],e=0,f=a.length;e<f;e++)d[e]=c.call(a[e],a[e],e,a);return d},offset:function(b){return a(b).offset()},addEvent:function(b,c,d){a(b).bind(c,d)},removeEvent:function(b,c,d){var e=x.removeEventListener?"removeEventListener":"detachEvent";x[e]&&b&&!b[e]&&(b[e]=function(){});a(b).unbind(c,d)},fireEvent:function(b,
+c,d,e){var f=a.Event(c),g="detached"+c,h;!Aa&&d&&(delete d.layerX,delete d.layerY,delete d.returnValue);r(f,d);b[c]&&(b[g]=b[c],b[c]=null);a.each(["preventDefault","stopPropagation"],function(a,b){var c=f[b];f[b]=function(){try{c.call(f)}catch(a){b==="preventDefault"&&(h=!0)}}});a(b).trigger(f);b[g]&&(b[c]=b[g],b[g]=null);e&&!f.isDefaultPrevented()&&!h&&e(f)},washMouseEvent:function(a){var c=a.originalEvent||a;if(c.pageX===u)c.pageX=a.pageX,c.pageY=a.pageY;return c},animate:function(b,c,d){var e=
+a(b);if(!b.style)b.style={};if(c.d)b.toD=c.d,c.d=1;e.stop();c.opacity!==u&&b.attr&&(c.opacity+="px");b.hasAnim=1;e.animate(c,d)},stop:function(b){b.hasAnim&&a(b).stop()}}})(G.jQuery);var T=G.HighchartsAdapter,M=T||{};T&&T.init.call(T,vb);var ib=M.adapterRun,Rb=M.getScript,Ma=M.inArray,q=M.each,wb=M.grep,Sb=M.offset,Va=M.map,N=M.addEvent,X=M.removeEvent,I=M.fireEvent,Tb=M.washMouseEvent,jb=M.animate,bb=M.stop,M={enabled:!0,x:0,y:15,style:{color:"#606060",cursor:"default",fontSize:"11px"}};E={colors:"#7cb5ec,#434348,#90ed7d,#f7a35c,#8085e9,#f15c80,#e4d354,#8085e8,#8d4653,#91e8e1".split(","),
+symbols:["circle","diamond","square","triangle","triangle-down"],lang:{loading:"Loading...",months:"January,February,March,April,May,June,July,August,September,October,November,December".split(","),shortMonths:"Jan,Feb,Mar,Apr,May,Jun,Jul,Aug,Sep,Oct,Nov,Dec".split(","),weekdays:"Sunday,Monday,Tuesday,Wednesday,Thursday,Friday,Saturday".split(","),decimalPoint:".",numericSymbols:"k,M,G,T,P,E".split(","),resetZoom:"Reset zoom",resetZoomTitle:"Reset zoom level 1:1",thousandsSep:","},global:{useUTC:!0,
+canvasToolsURL:"http://code.highcharts.com/4.0.4/modules/canvas-tools.js",VMLRadialGradientURL:"http://code.highcharts.com/4.0.4/gfx/vml-radial-gradient.png"},chart:{borderColor:"#4572A7",borderRadius:0,defaultSeriesType:"line",ignoreHiddenSeries:!0,spacing:[10,10,15,10],backgroundColor:"#FFFFFF",plotBorderColor:"#C0C0C0",resetZoomButton:{theme:{zIndex:20},position:{align:"right",x:-10,y:10}}},title:{text:"Chart title",align:"center",margin:15,style:{color:"#333333",fontSize:"18px"}},subtitle:{text:"",
+align:"center",style:{color:"#555555"}},plotOptions:{line:{allowPointSelect:!1,showCheckbox:!1,animation:{duration:1E3},events:{},lineWidth:2,marker:{lineWidth:0,radius:4,lineColor:"#FFFFFF",states:{hover:{enabled:!0,lineWidthPlus:1,radiusPlus:2},select:{fillColor:"#FFFFFF",lineColor:"#000000",lineWidth:2}}},point:{events:{}},dataLabels:w(M,{align:"center",enabled:!1,formatter:function(){return this.y===null?"":Ba(this.y,-1)},verticalAlign:"bottom",y:0}),cropThreshold:300,pointRange:0,states:{hover:{lineWidthPlus:1,
+marker:{},halo:{size:10,opacity:0.25}},select:{marker:{}}},stickyTracking:!0,turboThreshold:1E3}},labels:{style:{position:"absolute",color:"#3E576F"}},legend:{enabled:!0,align:"center",layout:"horizontal",labelFormatter:function(){return this.name},borderColor:"#909090",borderRadius:0,navigation:{activeColor:"#274b6d",inactiveColor:"#CCC"},shadow:!1,itemStyle:{color:"#333333",fontSize:"12px",fontWeight:"bold"},itemHoverStyle:{color:"#000"},itemHiddenStyle:{color:"#CCC"},itemCheckboxStyle:{position:"absolute",
+width:"13px",height:"13px"},symbolPadding:5,verticalAlign:"bottom",x:0,y:0,title:{style:{fontWeight:"bold"}}},loading:{labelStyle:{fontWeight:"bold",position:"relative",top:"45%"},style:{position:"absolute",backgroundColor:"white",opacity:0.5,textAlign:"center"}},tooltip:{enabled:!0,animation:ba,backgroundColor:"rgba(249, 249, 249, .85)",borderWidth:1,borderRadius:3,dateTimeLabelFormats:{millisecond:"%A, %b %e, %H:%M:%S.%L",second:"%A, %b %e, %H:%M:%S",minute:"%A, %b %e, %H:%M",hour:"%A, %b %e, %H:%M",
+day:"%A, %b %e, %Y",week:"Week from %A, %b %e, %Y",month:"%B %Y",year:"%Y"},headerFormat:'<span style="font-size: 10px">{point.key}</span><br/>',pointFormat:'<span style="color:{series.color}">â—</span> {series.name}: <b>{point.y}</b><br/>',shadow:!0,snap:Ib?25:10,style:{color:"#333333",cursor:"default",fontSize:"12px",padding:"8px",whiteSpace:"nowrap"}},credits:{enabled:!0,text:"Highcharts.com",href:"http://www.highcharts.com",position:{align:"right",x:-10,verticalAlign:"bottom",y:-5},style:{cursor:"pointer",
+color:"#909090",fontSize:"9px"}}};var ca=E.plotOptions,T=ca.line;Bb();var Ub=/rgba\(\s*([0-9]{1,3})\s*,\s*([0-9]{1,3})\s*,\s*([0-9]{1,3})\s*,\s*([0-9]?(?:\.[0-9]+)?)\s*\)/,Vb=/#([a-fA-F0-9]{2})([a-fA-F0-9]{2})([a-fA-F0-9]{2})/,Wb=/rgb\(\s*([0-9]{1,3})\s*,\s*([0-9]{1,3})\s*,\s*([0-9]{1,3})\s*\)/,ya=function(a){var b=[],c,d;(function(a){a&&a.stops?d=Va(a.stops,function(a){return ya(a[1])}):(c=Ub.exec(a))?b=[y(c[1]),y(c[2]),y(c[3]),parseFloat(c[4],10)]:(c=Vb.exec(a))?b=[y(c[1],16),y(c[2],16),y(c[3],
+16),1]:(c=Wb.exec(a))&&(b=[y(c[1]),y(c[2]),y(c[3]),1])})(a);return{get:function(c){var f;d?(f=w(a),f.stops=[].concat(f.stops),q(d,function(a,b){f.stops[b]=[f.stops[b][0],a.get(c)]})):f=b&&!isNaN(b[0])?c==="rgb"?"rgb("+b[0]+","+b[1]+","+b[2]+")":c==="a"?b[3]:"rgba("+b.join(",")+")":a;return f},brighten:function(a){if(d)q(d,function(b){b.brighten(a)});else if(ja(a)&&a!==0){var c;for(c=0;c<3;c++)b[c]+=y(a*255),b[c]<0&&(b[c]=0),b[c]>255&&(b[c]=255)}return this},rgba:b,setOpaci)***^***",
+R"***^***(ty:function(a){b[3]=a;return this}}};
+S.prototype={opacity:1,textProps:"fontSize,fontWeight,fontFamily,color,lineHeight,width,textDecoration,textShadow,HcTextStroke".split(","),init:function(a,b){this.element=b==="span"?$(b):x.createElementNS(xa,b);this.renderer=a},animate:function(a,b,c){b=p(b,va,!0);bb(this);if(b){b=w(b,{});if(c)b.complete=c;jb(this,a,b)}else this.attr(a),c&&c();return this},colorGradient:function(a,b,c){var d=this.renderer,e,f,g,h,i,j,k,l,n,m,o=[];a.linearGradient?f="linearGradient":a.radialGradient&&(f="radialGradient");
+if(f){g=a[f];h=d.gradients;j=a.stops;n=c.radialReference;Ha(g)&&(a[f]=g={x1:g[0],y1:g[1],x2:g[2],y2:g[3],gradientUnits:"userSpaceOnUse"});f==="radialGradient"&&n&&!s(g.gradientUnits)&&(g=w(g,{cx:n[0]-n[2]/2+g.cx*n[2],cy:n[1]-n[2]/2+g.cy*n[2],r:g.r*n[2],gradientUnits:"userSpaceOnUse"}));for(m in g)m!=="id"&&o.push(m,g[m]);for(m in j)o.push(j[m]);o=o.join(",");h[o]?a=h[o].attr("id"):(g.id=a="highcharts-"+ub++,h[o]=i=d.createElement(f).attr(g).add(d.defs),i.stops=[],q(j,function(a){a[1].indexOf("rgba")===
+0?(e=ya(a[1]),k=e.get("rgb"),l=e.get("a")):(k=a[1],l=1);a=d.createElement("stop").attr({offset:a[0],"stop-color":k,"stop-opacity":l}).add(i);i.stops.push(a)}));c.setAttribute(b,"url("+d.url+"#"+a+")")}},attr:function(a,b){var c,d,e=this.element,f,g=this,h;typeof a==="string"&&b!==u&&(c=a,a={},a[c]=b);if(typeof a==="string")g=(this[a+"Getter"]||this._defaultGetter).call(this,a,e);else{for(c in a){d=a[c];h=!1;this.symbolName&&/^(x|y|width|height|r|start|end|innerR|anchorX|anchorY)/.test(c)&&(f||(this.symbolAttr(a),
+f=!0),h=!0);if(this.rotation&&(c==="x"||c==="y"))this.doTransform=!0;h||(this[c+"Setter"]||this._defaultSetter).call(this,d,c,e);this.shadows&&/^(width|height|visibility|x|y|d|transform|cx|cy|r)$/.test(c)&&this.updateShadows(c,d)}if(this.doTransform)this.updateTransform(),this.doTransform=!1}return g},updateShadows:function(a,b){for(var c=this.shadows,d=c.length;d--;)c[d].setAttribute(a,a==="height"?t(b-(c[d].cutHeight||0),0):a==="d"?this.d:b)},addClass:function(a){var b=this.element,c=F(b,"class")||
+"";c.indexOf(a)===-1&&F(b,"class",c+" "+a);return this},symbolAttr:function(a){var b=this;q("x,y,r,start,end,width,height,innerR,anchorX,anchorY".split(","),function(c){b[c]=p(a[c],b[c])});b.attr({d:b.renderer.symbols[b.symbolName](b.x,b.y,b.width,b.height,b)})},clip:function(a){return this.attr("clip-path",a?"url("+this.renderer.url+"#"+a.id+")":P)},crisp:function(a){var b,c={},d,e=a.strokeWidth||this.strokeWidth||0;d=v(e)%2/2;a.x=U(a.x||this.x||0)+d;a.y=U(a.y||this.y||0)+d;a.width=U((a.width||this.width||
+0)-2*d);a.height=U((a.height||this.height||0)-2*d);a.strokeWidth=e;for(b in a)this[b]!==a[b]&&(this[b]=c[b]=a[b]);return c},css:function(a){var b=this.styles,c={},d=this.element,e,f,g="";e=!b;if(a&&a.color)a.fill=a.color;if(b)for(f in a)a[f]!==b[f]&&(c[f]=a[f],e=!0);if(e){e=this.textWidth=a&&a.width&&d.nodeName.toLowerCase()==="text"&&y(a.width);b&&(a=r(b,c));this.styles=a;e&&(ga||!ba&&this.renderer.forExport)&&delete a.width;if(Aa&&!ba)B(this.element,a);else{b=function(a,b){return"-"+b.toLowerCase()};
+for(f in a)g+=f.replace(/([A-Z])/g,b)+":"+a[f]+";";F(d,"style",g)}e&&this.added&&this.renderer.buildText(this)}return this},on:function(a,b){var c=this,d=c.element;$a&&a==="click"?(d.ontouchstart=function(a){c.touchEventFired=Da.now();a.preventDefault();b.call(d,a)},d.onclick=function(a){(wa.indexOf("Android")===-1||Da.now()-(c.touchEventFired||0)>1100)&&b.call(d,a)}):d["on"+a]=b;return this},setRadialReference:function(a){this.element.radialReference=a;return this},translate:function(a,b){return this.attr({translateX:a,
+translateY:b})},invert:function(){this.inverted=!0;this.updateTransform();return this},updateTransform:function(){var a=this.translateX||0,b=this.translateY||0,c=this.scaleX,d=this.scaleY,e=this.inverted,f=this.rotation,g=this.element;e&&(a+=this.attr("width"),b+=this.attr("height"));a=["translate("+a+","+b+")"];e?a.push("rotate(90) scale(-1,1)"):f&&a.push("rotate("+f+" "+(g.getAttribute("x")||0)+" "+(g.getAttribute("y")||0)+")");(s(c)||s(d))&&a.push("scale("+p(c,1)+" "+p(d,1)+")");a.length&&g.setAttribute("transform",
+a.join(" "))},toFront:function(){var a=this.element;a.parentNode.appendChild(a);return this},align:function(a,b,c){var d,e,f,g,h={};e=this.renderer;f=e.alignedObjects;if(a){if(this.alignOptions=a,this.alignByTranslate=b,!c||Ga(c))this.alignTo=d=c||"renderer",la(f,this),f.push(this),c=null}else a=this.alignOptions,b=this.alignByTranslate,d=this.alignTo;c=p(c,e[d],e);d=a.align;e=a.verticalAlign;f=(c.x||0)+(a.x||0);g=(c.y||0)+(a.y||0);if(d==="right"||d==="center")f+=(c.width-(a.width||0))/{right:1,center:2}[d];
+h[b?"translateX":"x"]=v(f);if(e==="bottom"||e==="middle")g+=(c.height-(a.height||0))/({bottom:1,middle:2}[e]||1);h[b?"translateY":"y"]=v(g);this[this.placed?"animate":"attr"](h);this.placed=!0;this.alignAttr=h;return this},getBBox:function(){var a=this.bBox,b=this.renderer,c,d,e=this.rotation;c=this.element;var f=this.styles,g=e*Ea;d=this.textStr;var h;if(d===""||Pb.test(d))h="num."+d.toString().length+(f?"|"+f.fontSize+"|"+f.fontFamily:"");h&&(a=b.cache[h]);if(!a){if(c.namespaceURI===xa||b.forExport){try{a=
+c.getBBox?r({},c.getBBox()):{width:c.offsetWidth,height:c.offsetHeight}}catch(i){}if(!a||a.width<0)a={width:0,height:0}}else a=this.htmlGetBBox();if(b.isSVG){c=a.width;d=a.height;if(Aa&&f&&f.fontSize==="11px"&&d.toPrecision(3)==="16.9")a.height=d=14;if(e)a.width=Q(d*fa(g))+Q(c*aa(g)),a.height=Q(d*aa(g))+Q(c*fa(g))}this.bBox=a;h&&(b.cache[h]=a)}return a},show:function(a){a&&this.element.namespaceURI===xa?this.element.removeAttribute("visibility"):this.attr({visibility:a?"inherit":"visible"});return this},
+hide:function(){return this.attr({visibility:"hidden"})},fadeOut:function(a){var b=this;b.animate({opacity:0},{duration:a||150,complete:function(){b.attr({y:-9999})}})},add:function(a){var b=this.renderer,c=a||b,d=c.element||b.box,e=this.element,f=this.zIndex,g,h;if(a)this.parentGroup=a;this.parentInverted=a&&a.inverted;this.textStr!==void 0&&b.buildText(this);if(f)c.handleZ=!0,f=y(f);if(c.handleZ){a=d.childNodes;for(g=0;g<a.length;g++)if(b=a[g],c=F(b,"zIndex"),b!==e&&(y(c)>f||!s(f)&&s(c))){d.insertBefore(e,
+b);h=!0;break}}h||d.appendChild(e);this.added=!0;if(this.onAdd)this.onAdd();return this},safeRemoveChild:function(a){var b=a.parentNode;b&&b.removeChild(a)},destroy:function(){var a=this,b=a.element||{},c=a.shadows,d=a.renderer.isSVG&&b.nodeName==="SPAN"&&a.parentGroup,e,f;b.onclick=b.onmouseout=b.onmouseover=b.onmousemove=b.point=null;bb(a);if(a.clipPath)a.clipPath=a.clipPath.destroy();if(a.stops){for(f=0;f<a.stops.length;f++)a.stops[f]=a.stops[f].destroy();a.stops=null}a.safeRemoveChild(b);for(c&&
+q(c,function(b){a.safeRemoveChild(b)});d&&d.div&&d.div.childNodes.length===0;)b=d.parentGroup,a.safeRemoveChild(d.div),delete d.div,d=b;a.alignTo&&la(a.renderer.alignedObjects,a);for(e in a)delete a[e];return null},shadow:function(a,b,c){var d=[],e,f,g=this.element,h,i,j,k;if(a){i=p(a.width,3);j=(a.opacity||0.15)/i;k=this.parentInverted?"(-1,-1)":"("+p(a.offsetX,1)+", "+p(a.offsetY,1)+")";for(e=1;e<=i;e++){f=g.cloneNode(0);h=i*2+1-2*e;F(f,{isShadow:"true",stroke:a.color||"black","stroke-opacity":j*
+e,"stroke-width":h,transform:"translate"+k,fill:P});if(c)F(f,"height",t(F(f,"height")-h,0)),f.cutHeight=h;b?b.element.appendChild(f):g.parentNode.insertBefore(f,g);d.push(f)}this.shadows=d}return this},xGetter:function(a){this.element.nodeName==="circle"&&(a={x:"cx",y:"cy"}[a]||a);return this._defaultGetter(a)},_defaultGetter:function(a){a=p(this[a],this.element?this.element.getAttribute(a):null,0);/^[\-0-9\.]+$/.test(a)&&(a=parseFloat(a));return a},dSetter:function(a,b,c){a&&a.join&&(a=a.join(" "));
+/(NaN| {2}|^$)/.test(a)&&(a="M 0 0");c.setAttribute(b,a);this[b]=a},dashstyleSetter:function(a){var b;if(a=a&&a.toLowerCase()){a=a.replace("shortdashdotdot","3,1,1,1,1,1,").replace("shortdashdot","3,1,1,1").replace("shortdot","1,1,").replace("shortdash","3,1,").replace("longdash","8,3,").replace(/dot/g,"1,3,").replace("dash","4,3,").replace(/,$/,"").split(",");for(b=a.length;b--;)a[b]=y(a[b])*this["stroke-width"];a=a.join(",").replace("NaN","none");this.element.setAttribute("stroke-dasharray",a)}},
+alignSetter:function(a){this.element.setAttribute("text-anchor",{left:"start",center:"middle",right:"end"}[a])},opacitySetter:function(a,b,c){this[b]=a;c.setAttribute(b,a)},titleSetter:function(a){var b=this.element.getElementsByTagName("title")[0];b||(b=x.createElementNS(xa,"title"),this.element.appendChild(b));b.textContent=p(a,"").replace(/<[^>]*>/g,"")},textSetter:function(a){if(a!==this.textStr)delete this.bBox,this.textStr=a,this.added&&this.renderer.buildText(this)},fillSetter:function(a,b,
+c){typeof a==="string"?c.setAttribute(b,a):a&&this.colorGradient(a,b,c)},zIndexSetter:function(a,b,c){c.setAttribute(b,a);this[b]=a},_defaultSetter:function(a,b,c){c.setAttribute(b,a)}};S.prototype.yGetter=S.prototype.xGetter;S.prototype.translateXSetter=S.prototype.translateYSetter=S.prototype.rotationSetter=S.prototype.verticalAlignSetter=S.prototype.scaleXSetter=S.prototype.scaleYSetter=function(a,b){this[b]=a;this.doTransform=!0};S.prototype["stroke-widthSetter"]=S.prototype.strokeSetter=function(a,
+b,c){this[b]=a;if(this.stroke&&this["stroke-width"])this.strokeWidth=this["stroke-width"],S.prototype.fillSetter.call(this,this.stroke,"stroke",c),c.setAttribute("stroke-width",this["stroke-width"]),this.hasStroke=!0;else if(b==="stroke-width"&&a===0&&this.hasStroke)c.removeAttribute("stroke"),this.hasStroke=!1};var ta=function(){this.init.apply(this,arguments)};ta.prototype={Element:S,init:function(a,b,c,d,e){var f=location,g,d=this.createElement("svg").attr({version:"1.1"}).css(this.getStyle(d));
+g=d.element;a.appendChild(g);a.innerHTML.indexOf("xmlns")===-1&&F(g,"xmlns",xa);this.isSVG=!0;this.box=g;this.boxWrapper=d;this.alignedObjects=[];this.url=(Ua||tb)&&x.getElementsByTagName("base").length?f.href.replace(/#.*?$/,"").replace(/([\('\)])/g,"\\$1").)***^***",
+R"***^***(replace(/ /g,"%20"):"";this.createElement("desc").add().element.appendChild(x.createTextNode("Created with Highcharts 4.0.4"));this.defs=this.createElement("defs").add();this.forExport=e;this.gradients={};this.cache={};this.setSize(b,c,!1);var h;
+if(Ua&&a.getBoundingClientRect)this.subPixelFix=b=function(){B(a,{left:0,top:0});h=a.getBoundingClientRect();B(a,{left:La(h.left)-h.left+"px",top:La(h.top)-h.top+"px"})},b(),N(G,"resize",b)},getStyle:function(a){return this.style=r({fontFamily:'"Lucida Grande", "Lucida Sans Unicode", Arial, Helvetica, sans-serif',fontSize:"12px"},a)},isHidden:function(){return!this.boxWrapper.getBBox().width},destroy:function(){var a=this.defs;this.box=null;this.boxWrapper=this.boxWrapper.destroy();Pa(this.gradients||
+{});this.gradients=null;if(a)this.defs=a.destroy();this.subPixelFix&&X(G,"resize",this.subPixelFix);return this.alignedObjects=null},createElement:function(a){var b=new this.Element;b.init(this,a);return b},draw:function(){},buildText:function(a){for(var b=a.element,c=this,d=c.forExport,e=p(a.textStr,"").toString(),f=e.indexOf("<")!==-1,g=b.childNodes,h,i,j=F(b,"x"),k=a.styles,l=a.textWidth,n=k&&k.lineHeight,m=k&&k.HcTextStroke,o=g.length,Y=function(a){return n?y(n):c.fontMetrics(/(px|em)$/.test(a&&
+a.style.fontSize)?a.style.fontSize:k&&k.fontSize||c.style.fontSize||12,a).h};o--;)b.removeChild(g[o]);!f&&!m&&e.indexOf(" ")===-1?b.appendChild(x.createTextNode(e)):(h=/<.*style="([^"]+)".*>/,i=/<.*href="(http[^"]+)".*>/,l&&!a.added&&this.box.appendChild(b),e=f?e.replace(/<(b|strong)>/g,'<span style="font-weight:bold">').replace(/<(i|em)>/g,'<span style="font-style:italic">').replace(/<a/g,"<span").replace(/<\/(b|strong|i|em|a)>/g,"</span>").split(/<br.*?>/g):[e],e[e.length-1]===""&&e.pop(),q(e,function(e,
+f){var g,n=0,e=e.replace(/<span/g,"|||<span").replace(/<\/span>/g,"</span>|||");g=e.split("|||");q(g,function(e){if(e!==""||g.length===1){var m={},o=x.createElementNS(xa,"tspan"),p;h.test(e)&&(p=e.match(h)[1].replace(/(;| |^)color([ :])/,"$1fill$2"),F(o,"style",p));i.test(e)&&!d&&(F(o,"onclick",'location.href="'+e.match(i)[1]+'"'),B(o,{cursor:"pointer"}));e=(e.replace(/<(.|\n)*?>/g,"")||" ").replace(/&lt;/g,"<").replace(/&gt;/g,">");if(e!==" "){o.appendChild(x.createTextNode(e));if(n)m.dx=0;else if(f&&
+j!==null)m.x=j;F(o,m);b.appendChild(o);!n&&f&&(!ba&&d&&B(o,{display:"block"}),F(o,"dy",Y(o)));if(l)for(var e=e.replace(/([^\^])-/g,"$1- ").split(" "),m=g.length>1||e.length>1&&k.whiteSpace!=="nowrap",q,D,s=k.HcHeight,t=[],u=Y(o),Lb=1;m&&(e.length||t.length);)delete a.bBox,q=a.getBBox(),D=q.width,!ba&&c.forExport&&(D=c.measureSpanWidth(o.firstChild.data,a.styles)),q=D>l,!q||e.length===1?(e=t,t=[],e.length&&(Lb++,s&&Lb*u>s?(e=["..."],a.attr("title",a.textStr)):(o=x.createElementNS(xa,"tspan"),F(o,{dy:u,
+x:j}),p&&F(o,"style",p),b.appendChild(o))),D>l&&(l=D)):(o.removeChild(o.firstChild),t.unshift(e.pop())),e.length&&o.appendChild(x.createTextNode(e.join(" ").replace(/- /g,"-")));n++}}})}))},button:function(a,b,c,d,e,f,g,h,i){var j=this.label(a,b,c,i,null,null,null,null,"button"),k=0,l,n,m,o,p,q,a={x1:0,y1:0,x2:0,y2:1},e=w({"stroke-width":1,stroke:"#CCCCCC",fill:{linearGradient:a,stops:[[0,"#FEFEFE"],[1,"#F6F6F6"]]},r:2,padding:5,style:{color:"black"}},e);m=e.style;delete e.style;f=w(e,{stroke:"#68A",
+fill:{linearGradient:a,stops:[[0,"#FFF"],[1,"#ACF"]]}},f);o=f.style;delete f.style;g=w(e,{stroke:"#68A",fill:{linearGradient:a,stops:[[0,"#9BD"],[1,"#CDF"]]}},g);p=g.style;delete g.style;h=w(e,{style:{color:"#CCC"}},h);q=h.style;delete h.style;N(j.element,Aa?"mouseover":"mouseenter",function(){k!==3&&j.attr(f).css(o)});N(j.element,Aa?"mouseout":"mouseleave",function(){k!==3&&(l=[e,f,g][k],n=[m,o,p][k],j.attr(l).css(n))});j.setState=function(a){(j.state=k=a)?a===2?j.attr(g).css(p):a===3&&j.attr(h).css(q):
+j.attr(e).css(m)};return j.on("click",function(){k!==3&&d.call(j)}).attr(e).css(r({cursor:"default"},m))},crispLine:function(a,b){a[1]===a[4]&&(a[1]=a[4]=v(a[1])-b%2/2);a[2]===a[5]&&(a[2]=a[5]=v(a[2])+b%2/2);return a},path:function(a){var b={fill:P};Ha(a)?b.d=a:da(a)&&r(b,a);return this.createElement("path").attr(b)},circle:function(a,b,c){a=da(a)?a:{x:a,y:b,r:c};b=this.createElement("circle");b.xSetter=function(a){this.element.setAttribute("cx",a)};b.ySetter=function(a){this.element.setAttribute("cy",
+a)};return b.attr(a)},arc:function(a,b,c,d,e,f){if(da(a))b=a.y,c=a.r,d=a.innerR,e=a.start,f=a.end,a=a.x;a=this.symbol("arc",a||0,b||0,c||0,c||0,{innerR:d||0,start:e||0,end:f||0});a.r=c;return a},rect:function(a,b,c,d,e,f){var e=da(a)?a.r:e,g=this.createElement("rect"),a=da(a)?a:a===u?{}:{x:a,y:b,width:t(c,0),height:t(d,0)};if(f!==u)a.strokeWidth=f,a=g.crisp(a);if(e)a.r=e;g.rSetter=function(a){F(this.element,{rx:a,ry:a})};return g.attr(a)},setSize:function(a,b,c){var d=this.alignedObjects,e=d.length;
+this.width=a;this.height=b;for(this.boxWrapper[p(c,!0)?"animate":"attr"]({width:a,height:b});e--;)d[e].align()},g:function(a){var b=this.createElement("g");return s(a)?b.attr({"class":"highcharts-"+a}):b},image:function(a,b,c,d,e){var f={preserveAspectRatio:P};arguments.length>1&&r(f,{x:b,y:c,width:d,height:e});f=this.createElement("image").attr(f);f.element.setAttributeNS?f.element.setAttributeNS("http://www.w3.org/1999/xlink","href",a):f.element.setAttribute("hc-svg-href",a);return f},symbol:function(a,
+b,c,d,e,f){var g,h=this.symbols[a],h=h&&h(v(b),v(c),d,e,f),i=/^url\((.*?)\)$/,j,k;if(h)g=this.path(h),r(g,{symbolName:a,x:b,y:c,width:d,height:e}),f&&r(g,f);else if(i.test(a))k=function(a,b){a.element&&(a.attr({width:b[0],height:b[1]}),a.alignByTranslate||a.translate(v((d-b[0])/2),v((e-b[1])/2)))},j=a.match(i)[1],a=Jb[j]||f&&f.width&&f.height&&[f.width,f.height],g=this.image(j).attr({x:b,y:c}),g.isImg=!0,a?k(g,a):(g.attr({width:0,height:0}),$("img",{onload:function(){k(g,Jb[j]=[this.width,this.height])},
+src:j}));return g},symbols:{circle:function(a,b,c,d){var e=0.166*c;return["M",a+c/2,b,"C",a+c+e,b,a+c+e,b+d,a+c/2,b+d,"C",a-e,b+d,a-e,b,a+c/2,b,"Z"]},square:function(a,b,c,d){return["M",a,b,"L",a+c,b,a+c,b+d,a,b+d,"Z"]},triangle:function(a,b,c,d){return["M",a+c/2,b,"L",a+c,b+d,a,b+d,"Z"]},"triangle-down":function(a,b,c,d){return["M",a,b,"L",a+c,b,a+c/2,b+d,"Z"]},diamond:function(a,b,c,d){return["M",a+c/2,b,"L",a+c,b+d/2,a+c/2,b+d,a,b+d/2,"Z"]},arc:function(a,b,c,d,e){var f=e.start,c=e.r||c||d,g=e.end-
+0.001,d=e.innerR,h=e.open,i=aa(f),j=fa(f),k=aa(g),g=fa(g),e=e.end-f<oa?0:1;return["M",a+c*i,b+c*j,"A",c,c,0,e,1,a+c*k,b+c*g,h?"M":"L",a+d*k,b+d*g,"A",d,d,0,e,0,a+d*i,b+d*j,h?"":"Z"]},callout:function(a,b,c,d,e){var f=L(e&&e.r||0,c,d),g=f+6,h=e&&e.anchorX,i=e&&e.anchorY,e=v(e.strokeWidth||0)%2/2;a+=e;b+=e;e=["M",a+f,b,"L",a+c-f,b,"C",a+c,b,a+c,b,a+c,b+f,"L",a+c,b+d-f,"C",a+c,b+d,a+c,b+d,a+c-f,b+d,"L",a+f,b+d,"C",a,b+d,a,b+d,a,b+d-f,"L",a,b+f,"C",a,b,a,b,a+f,b];h&&h>c&&i>b+g&&i<b+d-g?e.splice(13,3,
+"L",a+c,i-6,a+c+6,i,a+c,i+6,a+c,b+d-f):h&&h<0&&i>b+g&&i<b+d-g?e.splice(33,3,"L",a,i+6,a-6,i,a,i-6,a,b+f):i&&i>d&&h>a+g&&h<a+c-g?e.splice(23,3,"L",h+6,b+d,h,b+d+6,h-6,b+d,a+f,b+d):i&&i<0&&h>a+g&&h<a+c-g&&e.splice(3,3,"L",h-6,b,h,b-6,h+6,b,c-f,b);return e}},clipRect:function(a,b,c,d){var e="highcharts-"+ub++,f=this.createElement("clipPath").attr({id:e}).add(this.defs),a=this.rect(a,b,c,d,0).add(f);a.id=e;a.clipPath=f;return a},text:function(a,b,c,d){var e=ga||!ba&&this.forExport,f={};if(d&&!this.forExport)return this.html(a,
+b,c);f.x=Math.round(b||0);if(c)f.y=Math.round(c);if(a||a===0)f.text=a;a=this.createElement("text").attr(f);e&&a.css({position:"absolute"});if(!d)a.xSetter=function(a,b,c){var d=c.getElementsByTagName("tspan"),e,f=c.getAttribute(b),n;for(n=0;n<d.length;n++)e=d[n],e.getAttribute(b)===f&&e.setAttribute(b,a);c.setAttribute(b,a)};return a},fontMetrics:function(a,b){a=a||this.style.fontSize;if(b&&G.getComputedStyle)b=b.element||b,a=G.getComputedStyle(b,"").fontSize;var a=/px/.test(a)?y(a):/em/.test(a)?
+parseFloat(a)*12:12,c=a<24?a+4:v(a*1.2),d=v(c*0.8);return{h:c,b:d,f:a}},label:function(a,b,c,d,e,f,g,h,i){function j(){var a,b;a=o.element.style;D=(t===void 0||xb===void 0||m.styles.textAlign)&&o.textStr&&o.getBBox();m.width=(t||D.width||0)+2*C+kb;m.height=(xb||D.height||0)+2*C;R=C+n.fontMetrics(a&&a.fontSize,o).b;if(y){if(!p)a=v(-J*C),b=h?-R:0,m.box=p=d?n.symbol(d,a,b,m.width,m.height,z):n.rect(a,b,m.width,m.height,0,z[Qb]),p.attr("fill",P).add(m);p.isImg||p.attr(r({width:v(m.width),height:v(m.height)},
+z));z=null}}function k(){var a=m.styles,a=a&&a.textAlign,b=kb+C*(1-J),c;c=h?0:R;if(s(t)&&D&&(a==="center"||a==="right"))b+={center:0.5,right:1}[a]*(t-D.width);if(b!==o.x||c!==o.y)o.attr("x",b),c!==u&&o.attr("y",c);o.x=b;o.y=c}function l(a,b){p?p.attr(a,b):z[a]=b}var n=this,m=n.g(i),o=n.text("",0,0,g).attr({zIndex:1}),p,D,J=0,C=3,kb=0,t,xb,yb,x,Kb=0,z={},R,y;m.onAdd=function(){o.add(m);m.attr({text:a||a===0?a:"",x:b,y:c});p&&s(e)&&m.attr({anchorX:e,anchorY:f})};m.widthSetter=function(a){t=a};m.heightSetter=
+function(a){xb=a};m.paddingSetter=function(a){s(a)&&a!==C&&(C=a,k())};m.paddingLeftSetter=function(a){s(a)&&a!==kb&&(kb=a,k())};m.alignSetter=function(a){J={left:0,center:0.5,right:1}[a]};m.textSetter=function(a){a!==u&&o.textSetter(a);j();k()};m["stroke-widthSetter"]=function(a,b){a&&(y=!0);Kb=a%2/2;l(b,a)};m.strokeSetter=m.fillSetter=m.rSetter=function(a,b){b==="fill"&&a&&(y=!0);l(b,a)};m.anchorXSetter=function(a,b){e=a;l(b,a+Kb-yb)};m.anchorYSetter=function(a,b){f=a;l(b,a-x)};m.xSetter=function(a){m.x=
+a;J&&(a-=J*((t||D.width)+C));yb=v(a);m.attr("translateX",yb)};m.ySetter=function(a){x=m.y=v(a);m.attr("translateY",x)};var A=m.css;return r(m,{css:function(a){if(a){var b={},a=w(a);q(m.textProps,function(c){a[c]!==u&&(b[c]=a[c],delete a[c])});o.css(b)}return A.call(m,a)},getBBox:function(){return{width:D.width+2*C,height:D.height+2*C,x:D.x-C,y:D.y-C}},shadow:function(a){p&&p.shadow(a);return m},destroy:function(){X(m.element,"mouseenter");X(m.element,"mouseleave");o&&(o=o.destroy());p&&(p=p.destroy());
+S.prototype.destroy.call(m);m=n=j=k=l=null}})}};Za=ta;r(S.prototype,{htmlCss:functi)***^***",
+R"***^***(on(a){var b=this.element;if(b=a&&b.tagName==="SPAN"&&a.width)delete a.width,this.textWidth=b,this.updateTransform();this.styles=r(this.styles,a);B(this.element,a);return this},htmlGetBBox:function(){var a=this.element,b=this.bBox;if(!b){if(a.nodeName==="text")a.style.position="absolute";b=this.bBox={x:a.offsetLeft,y:a.offsetTop,width:a.offsetWidth,height:a.offsetHeight}}return b},htmlUpdateTransform:function(){if(this.added){var a=
+this.renderer,b=this.element,c=this.translateX||0,d=this.translateY||0,e=this.x||0,f=this.y||0,g=this.textAlign||"left",h={left:0,center:0.5,right:1}[g],i=this.shadows;B(b,{marginLeft:c,marginTop:d});i&&q(i,function(a){B(a,{marginLeft:c+1,marginTop:d+1})});this.inverted&&q(b.childNodes,function(c){a.invertChild(c,b)});if(b.tagName==="SPAN"){var j=this.rotation,k,l=y(this.textWidth),n=[j,g,b.innerHTML,this.textWidth].join(",");if(n!==this.cTT){k=a.fontMetrics(b.style.fontSize).b;s(j)&&this.setSpanRotation(j,
+h,k);i=p(this.elemWidth,b.offsetWidth);if(i>l&&/[ \-]/.test(b.textContent||b.innerText))B(b,{width:l+"px",display:"block",whiteSpace:"normal"}),i=l;this.getSpanCorrection(i,k,h,j,g)}B(b,{left:e+(this.xCorr||0)+"px",top:f+(this.yCorr||0)+"px"});if(tb)k=b.offsetHeight;this.cTT=n}}else this.alignOnAdd=!0},setSpanRotation:function(a,b,c){var d={},e=Aa?"-ms-transform":tb?"-webkit-transform":Ua?"MozTransform":Hb?"-o-transform":"";d[e]=d.transform="rotate("+a+"deg)";d[e+(Ua?"Origin":"-origin")]=d.transformOrigin=
+b*100+"% "+c+"px";B(this.element,d)},getSpanCorrection:function(a,b,c){this.xCorr=-a*c;this.yCorr=-b}});r(ta.prototype,{html:function(a,b,c){var d=this.createElement("span"),e=d.element,f=d.renderer;d.textSetter=function(a){a!==e.innerHTML&&delete this.bBox;e.innerHTML=this.textStr=a};d.xSetter=d.ySetter=d.alignSetter=d.rotationSetter=function(a,b){b==="align"&&(b="textAlign");d[b]=a;d.htmlUpdateTransform()};d.attr({text:a,x:v(b),y:v(c)}).css({position:"absolute",whiteSpace:"nowrap",fontFamily:this.style.fontFamily,
+fontSize:this.style.fontSize});d.css=d.htmlCss;if(f.isSVG)d.add=function(a){var b,c=f.box.parentNode,j=[];if(this.parentGroup=a){if(b=a.div,!b){for(;a;)j.push(a),a=a.parentGroup;q(j.reverse(),function(a){var d;b=a.div=a.div||$(Ka,{className:F(a.element,"class")},{position:"absolute",left:(a.translateX||0)+"px",top:(a.translateY||0)+"px"},b||c);d=b.style;r(a,{translateXSetter:function(b,c){d.left=b+"px";a[c]=b;a.doTransform=!0},translateYSetter:function(b,c){d.top=b+"px";a[c]=b;a.doTransform=!0},visibilitySetter:function(a,
+b){d[b]=a}})})}}else b=c;b.appendChild(e);d.added=!0;d.alignOnAdd&&d.htmlUpdateTransform();return d};return d}});var Z;if(!ba&&!ga){Z={init:function(a,b){var c=["<",b,' filled="f" stroked="f"'],d=["position: ","absolute",";"],e=b===Ka;(b==="shape"||e)&&d.push("left:0;top:0;width:1px;height:1px;");d.push("visibility: ",e?"hidden":"visible");c.push(' style="',d.join(""),'"/>');if(b)c=e||b==="span"||b==="img"?c.join(""):a.prepVML(c),this.element=$(c);this.renderer=a},add:function(a){var b=this.renderer,
+c=this.element,d=b.box,d=a?a.element||a:d;a&&a.inverted&&b.invertChild(c,d);d.appendChild(c);this.added=!0;this.alignOnAdd&&!this.deferUpdateTransform&&this.updateTransform();if(this.onAdd)this.onAdd();return this},updateTransform:S.prototype.htmlUpdateTransform,setSpanRotation:function(){var a=this.rotation,b=aa(a*Ea),c=fa(a*Ea);B(this.element,{filter:a?["progid:DXImageTransform.Microsoft.Matrix(M11=",b,", M12=",-c,", M21=",c,", M22=",b,", sizingMethod='auto expand')"].join(""):P})},getSpanCorrection:function(a,
+b,c,d,e){var f=d?aa(d*Ea):1,g=d?fa(d*Ea):0,h=p(this.elemHeight,this.element.offsetHeight),i;this.xCorr=f<0&&-a;this.yCorr=g<0&&-h;i=f*g<0;this.xCorr+=g*b*(i?1-c:c);this.yCorr-=f*b*(d?i?c:1-c:1);e&&e!=="left"&&(this.xCorr-=a*c*(f<0?-1:1),d&&(this.yCorr-=h*c*(g<0?-1:1)),B(this.element,{textAlign:e}))},pathToVML:function(a){for(var b=a.length,c=[];b--;)if(ja(a[b]))c[b]=v(a[b]*10)-5;else if(a[b]==="Z")c[b]="x";else if(c[b]=a[b],a.isArc&&(a[b]==="wa"||a[b]==="at"))c[b+5]===c[b+7]&&(c[b+7]+=a[b+7]>a[b+
+5]?1:-1),c[b+6]===c[b+8]&&(c[b+8]+=a[b+8]>a[b+6]?1:-1);return c.join(" ")||"x"},clip:function(a){var b=this,c;a?(c=a.members,la(c,b),c.push(b),b.destroyClip=function(){la(c,b)},a=a.getCSS(b)):(b.destroyClip&&b.destroyClip(),a={clip:hb?"inherit":"rect(auto)"});return b.css(a)},css:S.prototype.htmlCss,safeRemoveChild:function(a){a.parentNode&&Qa(a)},destroy:function(){this.destroyClip&&this.destroyClip();return S.prototype.destroy.apply(this)},on:function(a,b){this.element["on"+a]=function(){var a=
+G.event;a.target=a.srcElement;b(a)};return this},cutOffPath:function(a,b){var c,a=a.split(/[ ,]/);c=a.length;if(c===9||c===11)a[c-4]=a[c-2]=y(a[c-2])-10*b;return a.join(" ")},shadow:function(a,b,c){var d=[],e,f=this.element,g=this.renderer,h,i=f.style,j,k=f.path,l,n,m,o;k&&typeof k.value!=="string"&&(k="x");n=k;if(a){m=p(a.width,3);o=(a.opacity||0.15)/m;for(e=1;e<=3;e++){l=m*2+1-2*e;c&&(n=this.cutOffPath(k.value,l+0.5));j=['<shape isShadow="true" strokeweight="',l,'" filled="false" path="',n,'" coordsize="10 10" style="',
+f.style.cssText,'" />'];h=$(g.prepVML(j),null,{left:y(i.left)+p(a.offsetX,1),top:y(i.top)+p(a.offsetY,1)});if(c)h.cutOff=l+1;j=['<stroke color="',a.color||"black",'" opacity="',o*e,'"/>'];$(g.prepVML(j),null,null,h);b?b.element.appendChild(h):f.parentNode.insertBefore(h,f);d.push(h)}this.shadows=d}return this},updateShadows:sa,setAttr:function(a,b){hb?this.element[a]=b:this.element.setAttribute(a,b)},classSetter:function(a){this.element.className=a},dashstyleSetter:function(a,b,c){(c.getElementsByTagName("stroke")[0]||
+$(this.renderer.prepVML(["<stroke/>"]),null,null,c))[b]=a||"solid";this[b]=a},dSetter:function(a,b,c){var d=this.shadows,a=a||[];this.d=a.join&&a.join(" ");c.path=a=this.pathToVML(a);if(d)for(c=d.length;c--;)d[c].path=d[c].cutOff?this.cutOffPath(a,d[c].cutOff):a;this.setAttr(b,a)},fillSetter:function(a,b,c){var d=c.nodeName;if(d==="SPAN")c.style.color=a;else if(d!=="IMG")c.filled=a!==P,this.setAttr("fillcolor",this.renderer.color(a,c,b,this))},opacitySetter:sa,rotationSetter:function(a,b,c){c=c.style;
+this[b]=c[b]=a;c.left=-v(fa(a*Ea)+1)+"px";c.top=v(aa(a*Ea))+"px"},strokeSetter:function(a,b,c){this.setAttr("strokecolor",this.renderer.color(a,c,b))},"stroke-widthSetter":function(a,b,c){c.stroked=!!a;this[b]=a;ja(a)&&(a+="px");this.setAttr("strokeweight",a)},titleSetter:function(a,b){this.setAttr(b,a)},visibilitySetter:function(a,b,c){a==="inherit"&&(a="visible");this.shadows&&q(this.shadows,function(c){c.style[b]=a});c.nodeName==="DIV"&&(a=a==="hidden"?"-999em":0,hb||(c.style[b]=a?"visible":"hidden"),
+b="top");c.style[b]=a},xSetter:function(a,b,c){this[b]=a;b==="x"?b="left":b==="y"&&(b="top");this.updateClipping?(this[b]=a,this.updateClipping()):c.style[b]=a},zIndexSetter:function(a,b,c){c.style[b]=a}};K.VMLElement=Z=ma(S,Z);Z.prototype.ySetter=Z.prototype.widthSetter=Z.prototype.heightSetter=Z.prototype.xSetter;var ia={Element:Z,isIE8:wa.indexOf("MSIE 8.0")>-1,init:function(a,b,c,d){var e;this.alignedObjects=[];d=this.createElement(Ka).css(r(this.getStyle(d),{position:"relative"}));e=d.element;
+a.appendChild(d.element);this.isVML=!0;this.box=e;this.boxWrapper=d;this.cache={};this.setSize(b,c,!1);if(!x.namespaces.hcv){x.namespaces.add("hcv","urn:schemas-microsoft-com:vml");try{x.createStyleSheet().cssText="hcv\\:fill, hcv\\:path, hcv\\:shape, hcv\\:stroke{ behavior:url(#default#VML); display: inline-block; } "}catch(f){x.styleSheets[0].cssText+="hcv\\:fill, hcv\\:path, hcv\\:shape, hcv\\:stroke{ behavior:url(#default#VML); display: inline-block; } "}}},isHidden:function(){return!this.box.offsetWidth},
+clipRect:function(a,b,c,d){var e=this.createElement(),f=da(a);return r(e,{members:[],left:(f?a.x:a)+1,top:(f?a.y:b)+1,width:(f?a.width:c)-1,height:(f?a.height:d)-1,getCSS:function(a){var b=a.element,c=b.nodeName,a=a.inverted,d=this.top-(c==="shape"?b.offsetTop:0),e=this.left,b=e+this.width,f=d+this.height,d={clip:"rect("+v(a?e:d)+"px,"+v(a?f:b)+"px,"+v(a?b:f)+"px,"+v(a?d:e)+"px)"};!a&&hb&&c==="DIV"&&r(d,{width:b+"px",height:f+"px"});return d},updateClipping:function(){q(e.members,function(a){a.element&&
+a.css(e.getCSS(a))})}})},color:function(a,b,c,d){var e=this,f,g=/^rgba/,h,i,j=P;a&&a.linearGradient?i="gradient":a&&a.radialGradient&&(i="pattern");if(i){var k,l,n=a.linearGradient||a.radialGradient,m,o,p,D,J,C="",a=a.stops,t,s=[],u=function(){h=['<fill colors="'+s.join(",")+'" opacity="',p,'" o:opacity2="',o,'" type="',i,'" ',C,'focus="100%" method="any" />'];$(e.prepVML(h),null,null,b)};m=a[0];t=a[a.length-1];m[0]>0&&a.unshift([0,m[1]]);t[0]<1&&a.push([1,t[1]]);q(a,function(a,b){g.test(a[1])?(f=
+ya(a[1]),k=f.get("rgb"),l=f.get("a")):(k=a[1],l=1);s.push(a[0]*100+"% "+k);b?(p=l,D=k):(o=l,J=k)});if(c==="fill")if(i==="gradient")c=n.x1||n[0]||0,a=n.y1||n[1]||0,m=n.x2||n[2]||0,n=n.y2||n[3]||0,C='angle="'+(90-V.atan((n-a)/(m-c))*180/oa)+'"',u();else{var j=n.r,r=j*2,v=j*2,x=n.cx,z=n.cy,R=b.radialReference,w,j=function(){R&&(w=d.getBBox(),x+=(R[0]-w.x)/w.width-0.5,z+=(R[1]-w.y)/w.height-0.5,r*=R[2]/w.width,v*=R[2]/w.height);C='src="'+E.global.VMLRadialGradientURL+'" size="'+r+","+v+'" origin="0.5,0.5" position="'+
+x+","+z+'" color2="'+J+'" ';u()};d.added?j():d.onAdd=j;j=D}else j=k}else if(g.test(a)&&b.tagName!=="IMG")f=ya(a),h=["<",c,' opacity="',f.get("a"),'"/>'],$(this.prepVML(h),null,null,b),j=f.get("rgb");else{j=b.getElementsByTagName(c);if(j.length)j[0].opacity=1,j[0].type="solid";j=a}return j},prepVML:function(a){var b=this.isIE8,a=a.join("");b?(a=a.replace("/>",' xmlns="urn:schemas-microsoft-com:vml" />'),a=a.indexOf('style="')===-1?a.replace("/>",' style="display:inline-block;behavior:url(#default#VML);" />'):
+a.replace('style="','style="display:inline-block;behavior:url(#default#VML);')):a=a.replace("<","<hcv:");return a},text:ta.prototype.html,path:function(a){var b={coordsize:"10 10"};Ha(a)?b.d=a:da(a)&&r(b,a);return this.createElement("shape").attr(b)},circle:function(a,b,c){var d=this.symbol("circle");if(da(a))c=a.r,b=a.y,)***^***",
+R"***^***(a=a.x;d.isCircle=!0;d.r=c;return d.attr({x:a,y:b})},g:function(a){var b;a&&(b={className:"highcharts-"+a,"class":"highcharts-"+a});return this.createElement(Ka).attr(b)},image:function(a,
+b,c,d,e){var f=this.createElement("img").attr({src:a});arguments.length>1&&f.attr({x:b,y:c,width:d,height:e});return f},createElement:function(a){return a==="rect"?this.symbol(a):ta.prototype.createElement.call(this,a)},invertChild:function(a,b){var c=this,d=b.style,e=a.tagName==="IMG"&&a.style;B(a,{flip:"x",left:y(d.width)-(e?y(e.top):1),top:y(d.height)-(e?y(e.left):1),rotation:-90});q(a.childNodes,function(b){c.invertChild(b,a)})},symbols:{arc:function(a,b,c,d,e){var f=e.start,g=e.end,h=e.r||c||
+d,c=e.innerR,d=aa(f),i=fa(f),j=aa(g),k=fa(g);if(g-f===0)return["x"];f=["wa",a-h,b-h,a+h,b+h,a+h*d,b+h*i,a+h*j,b+h*k];e.open&&!c&&f.push("e","M",a,b);f.push("at",a-c,b-c,a+c,b+c,a+c*j,b+c*k,a+c*d,b+c*i,"x","e");f.isArc=!0;return f},circle:function(a,b,c,d,e){e&&(c=d=2*e.r);e&&e.isCircle&&(a-=c/2,b-=d/2);return["wa",a,b,a+c,b+d,a+c,b+d/2,a+c,b+d/2,"e"]},rect:function(a,b,c,d,e){return ta.prototype.symbols[!s(e)||!e.r?"square":"callout"].call(0,a,b,c,d,e)}}};K.VMLRenderer=Z=function(){this.init.apply(this,
+arguments)};Z.prototype=w(ta.prototype,ia);Za=Z}ta.prototype.measureSpanWidth=function(a,b){var c=x.createElement("span"),d;d=x.createTextNode(a);c.appendChild(d);B(c,b);this.box.appendChild(c);d=c.offsetWidth;Qa(c);return d};var Mb;if(ga)K.CanVGRenderer=Z=function(){xa="http://www.w3.org/1999/xhtml"},Z.prototype.symbols={},Mb=function(){function a(){var a=b.length,d;for(d=0;d<a;d++)b[d]();b=[]}var b=[];return{push:function(c,d){b.length===0&&Rb(d,a);b.push(c)}}}(),Za=Z;Ta.prototype={addLabel:function(){var a=
+this.axis,b=a.options,c=a.chart,d=a.horiz,e=a.categories,f=a.names,g=this.pos,h=b.labels,i=h.rotation,j=a.tickPositions,d=d&&e&&!h.step&&!h.staggerLines&&!h.rotation&&c.plotWidth/j.length||!d&&(c.margin[3]||c.chartWidth*0.33),k=g===j[0],l=g===j[j.length-1],n,f=e?p(e[g],f[g],g):g,e=this.label,m=j.info;a.isDatetimeAxis&&m&&(n=b.dateTimeLabelFormats[m.higherRanks[g]||m.unitName]);this.isFirst=k;this.isLast=l;b=a.labelFormatter.call({axis:a,chart:c,isFirst:k,isLast:l,dateTimeLabelFormat:n,value:a.isLog?
+ea(ka(f)):f});g=d&&{width:t(1,v(d-2*(h.padding||10)))+"px"};if(s(e))e&&e.attr({text:b}).css(g);else{n={align:a.labelAlign};if(ja(i))n.rotation=i;if(d&&h.ellipsis)g.HcHeight=a.len/j.length;this.label=e=s(b)&&h.enabled?c.renderer.text(b,0,0,h.useHTML).attr(n).css(r(g,h.style)).add(a.labelGroup):null;a.tickBaseline=c.renderer.fontMetrics(h.style.fontSize,e).b;i&&a.side===2&&(a.tickBaseline*=aa(i*Ea))}this.yOffset=e?p(h.y,a.tickBaseline+(a.side===2?8:-(e.getBBox().height/2))):0},getLabelSize:function(){var a=
+this.label,b=this.axis;return a?a.getBBox()[b.horiz?"height":"width"]:0},getLabelSides:function(){var a=this.label.getBBox(),b=this.axis,c=b.horiz,d=b.options.labels,a=c?a.width:a.height,b=c?d.x-a*{left:0,center:0.5,right:1}[b.labelAlign]:0;return[b,c?a+b:a]},handleOverflow:function(a,b){var c=!0,d=this.axis,e=this.isFirst,f=this.isLast,g=d.horiz?b.x:b.y,h=d.reversed,i=d.tickPositions,j=this.getLabelSides(),k=j[0],j=j[1],l,n,m,o=this.label.line;l=o||0;n=d.labelEdge;m=d.justifyLabels&&(e||f);n[l]===
+u||g+k>n[l]?n[l]=g+j:m||(c=!1);if(m){l=(n=d.justifyToPlot)?d.pos:0;n=n?l+d.len:d.chart.chartWidth;do a+=e?1:-1,m=d.ticks[i[a]];while(i[a]&&(!m||!m.label||m.label.line!==o));d=m&&m.label.xy&&m.label.xy.x+m.getLabelSides()[e?0:1];e&&!h||f&&h?g+k<l&&(g=l-k,m&&g+j>d&&(c=!1)):g+j>n&&(g=n-j,m&&g+k<d&&(c=!1));b.x=g}return c},getPosition:function(a,b,c,d){var e=this.axis,f=e.chart,g=d&&f.oldChartHeight||f.chartHeight;return{x:a?e.translate(b+c,null,null,d)+e.transB:e.left+e.offset+(e.opposite?(d&&f.oldChartWidth||
+f.chartWidth)-e.right-e.left:0),y:a?g-e.bottom+e.offset-(e.opposite?e.height:0):g-e.translate(b+c,null,null,d)-e.transB}},getLabelPosition:function(a,b,c,d,e,f,g,h){var i=this.axis,j=i.transA,k=i.reversed,l=i.staggerLines,a=a+e.x-(f&&d?f*j*(k?-1:1):0),b=b+this.yOffset-(f&&!d?f*j*(k?1:-1):0);if(l)c.line=g/(h||1)%l,b+=c.line*(i.labelOffset/l);return{x:a,y:b}},getMarkPath:function(a,b,c,d,e,f){return f.crispLine(["M",a,b,"L",a+(e?0:-c),b+(e?c:0)],d)},render:function(a,b,c){var d=this.axis,e=d.options,
+f=d.chart.renderer,g=d.horiz,h=this.type,i=this.label,j=this.pos,k=e.labels,l=this.gridLine,n=h?h+"Grid":"grid",m=h?h+"Tick":"tick",o=e[n+"LineWidth"],q=e[n+"LineColor"],D=e[n+"LineDashStyle"],J=e[m+"Length"],n=e[m+"Width"]||0,C=e[m+"Color"],t=e[m+"Position"],m=this.mark,s=k.step,r=!0,v=d.tickmarkOffset,w=this.getPosition(g,j,v,b),x=w.x,w=w.y,z=g&&x===d.pos+d.len||!g&&w===d.pos?-1:1,c=p(c,1);this.isActive=!0;if(o){j=d.getPlotLinePath(j+v,o*z,b,!0);if(l===u){l={stroke:q,"stroke-width":o};if(D)l.dashstyle=
+D;if(!h)l.zIndex=1;if(b)l.opacity=0;this.gridLine=l=o?f.path(j).attr(l).add(d.gridGroup):null}if(!b&&l&&j)l[this.isNew?"attr":"animate"]({d:j,opacity:c})}if(n&&J)t==="inside"&&(J=-J),d.opposite&&(J=-J),h=this.getMarkPath(x,w,J,n*z,g,f),m?m.animate({d:h,opacity:c}):this.mark=f.path(h).attr({stroke:C,"stroke-width":n,opacity:c}).add(d.axisGroup);if(i&&!isNaN(x))i.xy=w=this.getLabelPosition(x,w,i,g,k,v,a,s),this.isFirst&&!this.isLast&&!p(e.showFirstLabel,1)||this.isLast&&!this.isFirst&&!p(e.showLastLabel,
+1)?r=!1:!d.isRadial&&!k.step&&!k.rotation&&!b&&c!==0&&(r=this.handleOverflow(a,w)),s&&a%s&&(r=!1),r&&!isNaN(w.y)?(w.opacity=c,i[this.isNew?"attr":"animate"](w),this.isNew=!1):i.attr("y",-9999)},destroy:function(){Pa(this,this.axis)}};K.PlotLineOrBand=function(a,b){this.axis=a;if(b)this.options=b,this.id=b.id};K.PlotLineOrBand.prototype={render:function(){var a=this,b=a.axis,c=b.horiz,d=(b.pointRange||0)/2,e=a.options,f=e.label,g=a.label,h=e.width,i=e.to,j=e.from,k=s(j)&&s(i),l=e.value,n=e.dashStyle,
+m=a.svgElem,o=[],p,q=e.color,J=e.zIndex,C=e.events,r={},u=b.chart.renderer;b.isLog&&(j=za(j),i=za(i),l=za(l));if(h){if(o=b.getPlotLinePath(l,h),r={stroke:q,"stroke-width":h},n)r.dashstyle=n}else if(k){j=t(j,b.min-d);i=L(i,b.max+d);o=b.getPlotBandPath(j,i,e);if(q)r.fill=q;if(e.borderWidth)r.stroke=e.borderColor,r["stroke-width"]=e.borderWidth}else return;if(s(J))r.zIndex=J;if(m)if(o)m.animate({d:o},null,m.onGetPath);else{if(m.hide(),m.onGetPath=function(){m.show()},g)a.label=g=g.destroy()}else if(o&&
+o.length&&(a.svgElem=m=u.path(o).attr(r).add(),C))for(p in d=function(b){m.on(b,function(c){C[b].apply(a,[c])})},C)d(p);if(f&&s(f.text)&&o&&o.length&&b.width>0&&b.height>0){f=w({align:c&&k&&"center",x:c?!k&&4:10,verticalAlign:!c&&k&&"middle",y:c?k?16:10:k?6:-4,rotation:c&&!k&&90},f);if(!g){r={align:f.textAlign||f.align,rotation:f.rotation};if(s(J))r.zIndex=J;a.label=g=u.text(f.text,0,0,f.useHTML).attr(r).css(f.style).add()}b=[o[1],o[4],k?o[6]:o[1]];k=[o[2],o[5],k?o[7]:o[2]];o=Oa(b);c=Oa(k);g.align(f,
+!1,{x:o,y:c,width:Ca(b)-o,height:Ca(k)-c});g.show()}else g&&g.hide();return a},destroy:function(){la(this.axis.plotLinesAndBands,this);delete this.axis;Pa(this)}};na.prototype={defaultOptions:{dateTimeLabelFormats:{millisecond:"%H:%M:%S.%L",second:"%H:%M:%S",minute:"%H:%M",hour:"%H:%M",day:"%e. %b",week:"%e. %b",month:"%b '%y",year:"%Y"},endOnTick:!1,gridLineColor:"#C0C0C0",labels:M,lineColor:"#C0D0E0",lineWidth:1,minPadding:0.01,maxPadding:0.01,minorGridLineColor:"#E0E0E0",minorGridLineWidth:1,minorTickColor:"#A0A0A0",
+minorTickLength:2,minorTickPosition:"outside",startOfWeek:1,startOnTick:!1,tickColor:"#C0D0E0",tickLength:10,tickmarkPlacement:"between",tickPixelInterval:100,tickPosition:"outside",tickWidth:1,title:{align:"middle",style:{color:"#707070"}},type:"linear"},defaultYAxisOptions:{endOnTick:!0,gridLineWidth:1,tickPixelInterval:72,showLastLabel:!0,labels:{x:-8,y:3},lineWidth:0,maxPadding:0.05,minPadding:0.05,startOnTick:!0,tickWidth:0,title:{rotation:270,text:"Values"},stackLabels:{enabled:!1,formatter:function(){return Ba(this.total,
+-1)},style:M.style}},defaultLeftAxisOptions:{labels:{x:-15,y:null},title:{rotation:270}},defaultRightAxisOptions:{labels:{x:15,y:null},title:{rotation:90}},defaultBottomAxisOptions:{labels:{x:0,y:null},title:{rotation:0}},defaultTopAxisOptions:{labels:{x:0,y:-15},title:{rotation:0}},init:function(a,b){var c=b.isX;this.horiz=a.inverted?!c:c;this.coll=(this.isXAxis=c)?"xAxis":"yAxis";this.opposite=b.opposite;this.side=b.side||(this.horiz?this.opposite?0:2:this.opposite?1:3);this.setOptions(b);var d=
+this.options,e=d.type;this.labelFormatter=d.labels.formatter||this.defaultLabelFormatter;this.userOptions=b;this.minPixelPadding=0;this.chart=a;this.reversed=d.reversed;this.zoomEnabled=d.zoomEnabled!==!1;this.categories=d.categories||e==="category";this.names=[];this.isLog=e==="logarithmic";this.isDatetimeAxis=e==="datetime";this.isLinked=s(d.linkedTo);this.tickmarkOffset=this.categories&&d.tickmarkPlacement==="between"&&p(d.tickInterval,1)===1?0.5:0;this.ticks={};this.labelEdge=[];this.minorTicks=
+{};this.plotLinesAndBands=[];this.alternateBands={};this.len=0;this.minRange=this.userMinRange=d.minRange||d.maxZoom;this.range=d.range;this.offset=d.offset||0;this.stacks={};this.oldStacks={};this.min=this.max=null;this.crosshair=p(d.crosshair,ra(a.options.tooltip.crosshairs)[c?0:1],!1);var f,d=this.options.events;Ma(this,a.axes)===-1&&(c&&!this.isColorAxis?a.axes.splice(a.xAxis.length,0,this):a.axes.push(this),a[this.coll].push(this));this.series=this.series||[];if(a.inverted&&c&&this.reversed===
+u)this.reversed=!0;this.removePlotLine=this.removePlotBand=this.removePlotBandOrLine;for(f in d)N(this,f,d[f]);if(this.isLog)this.val2lin=za,this.lin2val=ka},setOptions:function(a){this.options=w(this.defaultOptions,this.isXAxis?{}:this.defaultYAxisOptions,[this.defaultTopAxisOptions,this.defaultRightAxisOptions,this.defaultBottomAxisOptions,this.defaultLeftAxisOptions][this.side],w(E[this.coll],a))},defaultLabelFormatter:function(){var a=this.axis,b=this.value,c=a.categories,d=this.dateTimeLabelFormat,
+e=E.lang.numericSymbols,f=e&&e.length,g,h=a.options.labels.format,a=a.isLog?b:a.tickInterval;if(h)g=Ja(h,this);else if(c)g=b;else if)***^***",
+R"***^***((d)g=cb(d,b);else if(f&&a>=1E3)for(;f--&&g===u;)c=Math.pow(1E3,f+1),a>=c&&e[f]!==null&&(g=Ba(b/c,-1)+e[f]);g===u&&(g=Q(b)>=1E4?Ba(b,0):Ba(b,-1,u,""));return g},getSeriesExtremes:function(){var a=this,b=a.chart;a.hasVisibleSeries=!1;a.dataMin=a.dataMax=a.ignoreMinPadding=a.ignoreMaxPadding=null;a.buildStacks&&a.buildStacks();q(a.series,function(c){if(c.visible||!b.options.chart.ignoreHiddenSeries){var d;
+d=c.options.threshold;var e;a.hasVisibleSeries=!0;a.isLog&&d<=0&&(d=null);if(a.isXAxis){if(d=c.xData,d.length)a.dataMin=L(p(a.dataMin,d[0]),Oa(d)),a.dataMax=t(p(a.dataMax,d[0]),Ca(d))}else{c.getExtremes();e=c.dataMax;c=c.dataMin;if(s(c)&&s(e))a.dataMin=L(p(a.dataMin,c),c),a.dataMax=t(p(a.dataMax,e),e);if(s(d))if(a.dataMin>=d)a.dataMin=d,a.ignoreMinPadding=!0;else if(a.dataMax<d)a.dataMax=d,a.ignoreMaxPadding=!0}}})},translate:function(a,b,c,d,e,f){var g=1,h=0,i=d?this.oldTransA:this.transA,d=d?this.oldMin:
+this.min,j=this.minPixelPadding,e=(this.options.ordinal||this.isLog&&e)&&this.lin2val;if(!i)i=this.transA;if(c)g*=-1,h=this.len;this.reversed&&(g*=-1,h-=g*(this.sector||this.len));b?(a=a*g+h,a-=j,a=a/i+d,e&&(a=this.lin2val(a))):(e&&(a=this.val2lin(a)),f==="between"&&(f=0.5),a=g*(a-d)*i+h+g*j+(ja(f)?i*f*this.pointRange:0));return a},toPixels:function(a,b){return this.translate(a,!1,!this.horiz,null,!0)+(b?0:this.pos)},toValue:function(a,b){return this.translate(a-(b?0:this.pos),!0,!this.horiz,null,
+!0)},getPlotLinePath:function(a,b,c,d,e){var f=this.chart,g=this.left,h=this.top,i,j,k=c&&f.oldChartHeight||f.chartHeight,l=c&&f.oldChartWidth||f.chartWidth,n;i=this.transB;e=p(e,this.translate(a,null,null,c));a=c=v(e+i);i=j=v(k-e-i);if(isNaN(e))n=!0;else if(this.horiz){if(i=h,j=k-this.bottom,a<g||a>g+this.width)n=!0}else if(a=g,c=l-this.right,i<h||i>h+this.height)n=!0;return n&&!d?null:f.renderer.crispLine(["M",a,i,"L",c,j],b||1)},getLinearTickPositions:function(a,b,c){var d,e=ea(U(b/a)*a),f=ea(La(c/
+a)*a),g=[];if(b===c&&ja(b))return[b];for(b=e;b<=f;){g.push(b);b=ea(b+a);if(b===d)break;d=b}return g},getMinorTickPositions:function(){var a=this.options,b=this.tickPositions,c=this.minorTickInterval,d=[],e;if(this.isLog){e=b.length;for(a=1;a<e;a++)d=d.concat(this.getLogTickPositions(c,b[a-1],b[a],!0))}else if(this.isDatetimeAxis&&a.minorTickInterval==="auto")d=d.concat(this.getTimeTicks(this.normalizeTimeTickInterval(c),this.min,this.max,a.startOfWeek)),d[0]<this.min&&d.shift();else for(b=this.min+
+(b[0]-this.min)%c;b<=this.max;b+=c)d.push(b);return d},adjustForMinRange:function(){var a=this.options,b=this.min,c=this.max,d,e=this.dataMax-this.dataMin>=this.minRange,f,g,h,i,j;if(this.isXAxis&&this.minRange===u&&!this.isLog)s(a.min)||s(a.max)?this.minRange=null:(q(this.series,function(a){i=a.xData;for(g=j=a.xIncrement?1:i.length-1;g>0;g--)if(h=i[g]-i[g-1],f===u||h<f)f=h}),this.minRange=L(f*5,this.dataMax-this.dataMin));if(c-b<this.minRange){var k=this.minRange;d=(k-c+b)/2;d=[b-d,p(a.min,b-d)];
+if(e)d[2]=this.dataMin;b=Ca(d);c=[b+k,p(a.max,b+k)];if(e)c[2]=this.dataMax;c=Oa(c);c-b<k&&(d[0]=c-k,d[1]=p(a.min,c-k),b=Ca(d))}this.min=b;this.max=c},setAxisTranslation:function(a){var b=this,c=b.max-b.min,d=b.axisPointRange||0,e,f=0,g=0,h=b.linkedParent,i=!!b.categories,j=b.transA;if(b.isXAxis||i||d)h?(f=h.minPointOffset,g=h.pointRangePadding):q(b.series,function(a){var h=i?1:b.isXAxis?a.pointRange:b.axisPointRange||0,j=a.options.pointPlacement,m=a.closestPointRange;h>c&&(h=0);d=t(d,h);f=t(f,Ga(j)?
+0:h/2);g=t(g,j==="on"?0:h);!a.noSharedTooltip&&s(m)&&(e=s(e)?L(e,m):m)}),h=b.ordinalSlope&&e?b.ordinalSlope/e:1,b.minPointOffset=f*=h,b.pointRangePadding=g*=h,b.pointRange=L(d,c),b.closestPointRange=e;if(a)b.oldTransA=j;b.translationSlope=b.transA=j=b.len/(c+g||1);b.transB=b.horiz?b.left:b.bottom;b.minPixelPadding=j*f},setTickPositions:function(a){var b=this,c=b.chart,d=b.options,e=d.startOnTick,f=d.endOnTick,g=b.isLog,h=b.isDatetimeAxis,i=b.isXAxis,j=b.isLinked,k=b.options.tickPositioner,l=d.maxPadding,
+n=d.minPadding,m=d.tickInterval,o=d.minTickInterval,Y=d.tickPixelInterval,D,J=b.categories;j?(b.linkedParent=c[b.coll][d.linkedTo],c=b.linkedParent.getExtremes(),b.min=p(c.min,c.dataMin),b.max=p(c.max,c.dataMax),d.type!==b.linkedParent.options.type&&ha(11,1)):(b.min=p(b.userMin,d.min,b.dataMin),b.max=p(b.userMax,d.max,b.dataMax));if(g)!a&&L(b.min,p(b.dataMin,b.min))<=0&&ha(10,1),b.min=ea(za(b.min)),b.max=ea(za(b.max));if(b.range&&s(b.max))b.userMin=b.min=t(b.min,b.max-b.range),b.userMax=b.max,b.range=
+null;b.beforePadding&&b.beforePadding();b.adjustForMinRange();if(!J&&!b.axisPointRange&&!b.usePercentage&&!j&&s(b.min)&&s(b.max)&&(c=b.max-b.min)){if(!s(d.min)&&!s(b.userMin)&&n&&(b.dataMin<0||!b.ignoreMinPadding))b.min-=c*n;if(!s(d.max)&&!s(b.userMax)&&l&&(b.dataMax>0||!b.ignoreMaxPadding))b.max+=c*l}if(ja(d.floor))b.min=t(b.min,d.floor);if(ja(d.ceiling))b.max=L(b.max,d.ceiling);b.min===b.max||b.min===void 0||b.max===void 0?b.tickInterval=1:j&&!m&&Y===b.linkedParent.options.tickPixelInterval?b.tickInterval=
+b.linkedParent.tickInterval:(b.tickInterval=p(m,J?1:(b.max-b.min)*Y/t(b.len,Y)),!s(m)&&b.len<Y&&!this.isRadial&&!this.isLog&&!J&&e&&f&&(D=!0,b.tickInterval/=4));i&&!a&&q(b.series,function(a){a.processData(b.min!==b.oldMin||b.max!==b.oldMax)});b.setAxisTranslation(!0);b.beforeSetTickPositions&&b.beforeSetTickPositions();if(b.postProcessTickInterval)b.tickInterval=b.postProcessTickInterval(b.tickInterval);if(b.pointRange)b.tickInterval=t(b.pointRange,b.tickInterval);if(!m&&b.tickInterval<o)b.tickInterval=
+o;if(!h&&!g&&!m)b.tickInterval=nb(b.tickInterval,null,mb(b.tickInterval),p(d.allowDecimals,!(b.tickInterval>1&&b.tickInterval<5&&b.max>1E3&&b.max<9999)));b.minorTickInterval=d.minorTickInterval==="auto"&&b.tickInterval?b.tickInterval/5:d.minorTickInterval;b.tickPositions=a=d.tickPositions?[].concat(d.tickPositions):k&&k.apply(b,[b.min,b.max]);if(!a)!b.ordinalPositions&&(b.max-b.min)/b.tickInterval>t(2*b.len,200)&&ha(19,!0),a=h?b.getTimeTicks(b.normalizeTimeTickInterval(b.tickInterval,d.units),b.min,
+b.max,d.startOfWeek,b.ordinalPositions,b.closestPointRange,!0):g?b.getLogTickPositions(b.tickInterval,b.min,b.max):b.getLinearTickPositions(b.tickInterval,b.min,b.max),D&&a.splice(1,a.length-2),b.tickPositions=a;if(!j)d=a[0],g=a[a.length-1],h=b.minPointOffset||0,e?b.min=d:b.min-h>d&&a.shift(),f?b.max=g:b.max+h<g&&a.pop(),a.length===0&&s(d)&&a.push((g+d)/2),a.length===1&&(e=Q(b.max)>1E13?1:0.001,b.min-=e,b.max+=e)},setMaxTicks:function(){var a=this.chart,b=a.maxTicks||{},c=this.tickPositions,d=this._maxTicksKey=
+[this.coll,this.pos,this.len].join("-");if(!this.isLinked&&!this.isDatetimeAxis&&c&&c.length>(b[d]||0)&&this.options.alignTicks!==!1)b[d]=c.length;a.maxTicks=b},adjustTickAmount:function(){var a=this._maxTicksKey,b=this.tickPositions,c=this.chart.maxTicks;if(c&&c[a]&&!this.isDatetimeAxis&&!this.categories&&!this.isLinked&&this.options.alignTicks!==!1&&this.min!==u){var d=this.tickAmount,e=b.length;this.tickAmount=a=c[a];if(e<a){for(;b.length<a;)b.push(ea(b[b.length-1]+this.tickInterval));this.transA*=
+(e-1)/(a-1);this.max=b[b.length-1]}if(s(d)&&a!==d)this.isDirty=!0}},setScale:function(){var a=this.stacks,b,c,d,e;this.oldMin=this.min;this.oldMax=this.max;this.oldAxisLength=this.len;this.setAxisSize();e=this.len!==this.oldAxisLength;q(this.series,function(a){if(a.isDirtyData||a.isDirty||a.xAxis.isDirty)d=!0});if(e||d||this.isLinked||this.forceRedraw||this.userMin!==this.oldUserMin||this.userMax!==this.oldUserMax){if(!this.isXAxis)for(b in a)for(c in a[b])a[b][c].total=null,a[b][c].cum=0;this.forceRedraw=
+!1;this.getSeriesExtremes();this.setTickPositions();this.oldUserMin=this.userMin;this.oldUserMax=this.userMax;if(!this.isDirty)this.isDirty=e||this.min!==this.oldMin||this.max!==this.oldMax}else if(!this.isXAxis){if(this.oldStacks)a=this.stacks=this.oldStacks;for(b in a)for(c in a[b])a[b][c].cum=a[b][c].total}this.setMaxTicks()},setExtremes:function(a,b,c,d,e){var f=this,g=f.chart,c=p(c,!0),e=r(e,{min:a,max:b});I(f,"setExtremes",e,function(){f.userMin=a;f.userMax=b;f.eventArgs=e;f.isDirtyExtremes=
+!0;c&&g.redraw(d)})},zoom:function(a,b){var c=this.dataMin,d=this.dataMax,e=this.options;this.allowZoomOutside||(s(c)&&a<=L(c,p(e.min,c))&&(a=u),s(d)&&b>=t(d,p(e.max,d))&&(b=u));this.displayBtn=a!==u||b!==u;this.setExtremes(a,b,!1,u,{trigger:"zoom"});return!0},setAxisSize:function(){var a=this.chart,b=this.options,c=b.offsetLeft||0,d=this.horiz,e=p(b.width,a.plotWidth-c+(b.offsetRight||0)),f=p(b.height,a.plotHeight),g=p(b.top,a.plotTop),b=p(b.left,a.plotLeft+c),c=/%$/;c.test(f)&&(f=parseInt(f,10)/
+100*a.plotHeight);c.test(g)&&(g=parseInt(g,10)/100*a.plotHeight+a.plotTop);this.left=b;this.top=g;this.width=e;this.height=f;this.bottom=a.chartHeight-f-g;this.right=a.chartWidth-e-b;this.len=t(d?e:f,0);this.pos=d?b:g},getExtremes:function(){var a=this.isLog;return{min:a?ea(ka(this.min)):this.min,max:a?ea(ka(this.max)):this.max,dataMin:this.dataMin,dataMax:this.dataMax,userMin:this.userMin,userMax:this.userMax}},getThreshold:function(a){var b=this.isLog,c=b?ka(this.min):this.min,b=b?ka(this.max):
+this.max;c>a||a===null?a=c:b<a&&(a=b);return this.translate(a,0,1,0,1)},autoLabelAlign:function(a){a=(p(a,0)-this.side*90+720)%360;return a>15&&a<165?"right":a>195&&a<345?"left":"center"},getOffset:function(){var a=this,b=a.chart,c=b.renderer,d=a.options,e=a.tickPositions,f=a.ticks,g=a.horiz,h=a.side,i=b.inverted?[1,0,3,2][h]:h,j,k,l=0,n,m=0,o=d.title,Y=d.labels,D=0,J=b.axisOffset,b=b.clipOffset,C=[-1,1,1,-1][h],r,v=1,w=p(Y.maxStaggerLines,5),x,y,A,z,R;a.hasData=j=a.hasVisibleSeries||s(a.min)&&s(a.max)&&
+!!e;a.showAxis=k=j||p(d.showEmpty,!0);a.staggerLines=a.horiz&&Y.staggerLines;if(!a.axisGroup)a.gridGroup=c.g("grid").attr({zIndex:d.gridZIndex||1}).add(),a.axisGroup=c.g("axis").attr({zIndex:d.zIndex||2}).add(),a.labelGroup=c.g("axis-labels").attr({zIndex:Y.zIndex||7}).addClass("highcharts-"+a.coll.toLowerCase()+"-labels").add();if(j||a.isLinked){a.labelAlign=p(Y.align||a.autoLabelAlign(Y.rotation));q(e,function(b){f[b]?f[b].addLabel():f[b]=new Ta(a,b)});i)***^***",
+R"***^***(f(a.horiz&&!a.staggerLines&&w&&!Y.rotation){for(j=
+a.reversed?[].concat(e).reverse():e;v<w;){x=[];y=!1;for(r=0;r<j.length;r++)A=j[r],z=(z=f[A].label&&f[A].label.getBBox())?z.width:0,R=r%v,z&&(A=a.translate(A),x[R]!==u&&A<x[R]&&(y=!0),x[R]=A+z);if(y)v++;else break}if(v>1)a.staggerLines=v}q(e,function(b){if(h===0||h===2||{1:"left",3:"right"}[h]===a.labelAlign)D=t(f[b].getLabelSize(),D)});if(a.staggerLines)D*=a.staggerLines,a.labelOffset=D}else for(r in f)f[r].destroy(),delete f[r];if(o&&o.text&&o.enabled!==!1){if(!a.axisTitle)a.axisTitle=c.text(o.text,
+0,0,o.useHTML).attr({zIndex:7,rotation:o.rotation||0,align:o.textAlign||{low:"left",middle:"center",high:"right"}[o.align]}).addClass("highcharts-"+this.coll.toLowerCase()+"-title").css(o.style).add(a.axisGroup),a.axisTitle.isNew=!0;if(k)l=a.axisTitle.getBBox()[g?"height":"width"],n=o.offset,m=s(n)?0:p(o.margin,g?5:10);a.axisTitle[k?"show":"hide"]()}a.offset=C*p(d.offset,J[h]);c=h===2?a.tickBaseline:0;g=D+m+(D&&C*(g?p(Y.y,a.tickBaseline+8):Y.x)-c);a.axisTitleMargin=p(n,g);J[h]=t(J[h],a.axisTitleMargin+
+l+C*a.offset,g);b[i]=t(b[i],U(d.lineWidth/2)*2)},getLinePath:function(a){var b=this.chart,c=this.opposite,d=this.offset,e=this.horiz,f=this.left+(c?this.width:0)+d,d=b.chartHeight-this.bottom-(c?this.height:0)+d;c&&(a*=-1);return b.renderer.crispLine(["M",e?this.left:f,e?d:this.top,"L",e?b.chartWidth-this.right:f,e?d:b.chartHeight-this.bottom],a)},getTitlePosition:function(){var a=this.horiz,b=this.left,c=this.top,d=this.len,e=this.options.title,f=a?b:c,g=this.opposite,h=this.offset,i=y(e.style.fontSize||
+12),d={low:f+(a?0:d),middle:f+d/2,high:f+(a?d:0)}[e.align],b=(a?c+this.height:b)+(a?1:-1)*(g?-1:1)*this.axisTitleMargin+(this.side===2?i:0);return{x:a?d:b+(g?this.width:0)+h+(e.x||0),y:a?b-(g?this.height:0)+h:d+(e.y||0)}},render:function(){var a=this,b=a.horiz,c=a.reversed,d=a.chart,e=d.renderer,f=a.options,g=a.isLog,h=a.isLinked,i=a.tickPositions,j,k=a.axisTitle,l=a.ticks,n=a.minorTicks,m=a.alternateBands,o=f.stackLabels,p=f.alternateGridColor,D=a.tickmarkOffset,J=f.lineWidth,C=d.hasRendered&&s(a.oldMin)&&
+!isNaN(a.oldMin),r=a.hasData,t=a.showAxis,v,w=f.labels.overflow,x=a.justifyLabels=b&&w!==!1,A;a.labelEdge.length=0;a.justifyToPlot=w==="justify";q([l,n,m],function(a){for(var b in a)a[b].isActive=!1});if(r||h)if(a.minorTickInterval&&!a.categories&&q(a.getMinorTickPositions(),function(b){n[b]||(n[b]=new Ta(a,b,"minor"));C&&n[b].isNew&&n[b].render(null,!0);n[b].render(null,!1,1)}),i.length&&(j=i.slice(),(b&&c||!b&&!c)&&j.reverse(),x&&(j=j.slice(1).concat([j[0]])),q(j,function(b,c){x&&(c=c===j.length-
+1?0:c+1);if(!h||b>=a.min&&b<=a.max)l[b]||(l[b]=new Ta(a,b)),C&&l[b].isNew&&l[b].render(c,!0,0.1),l[b].render(c)}),D&&a.min===0&&(l[-1]||(l[-1]=new Ta(a,-1,null,!0)),l[-1].render(-1))),p&&q(i,function(b,c){if(c%2===0&&b<a.max)m[b]||(m[b]=new K.PlotLineOrBand(a)),v=b+D,A=i[c+1]!==u?i[c+1]+D:a.max,m[b].options={from:g?ka(v):v,to:g?ka(A):A,color:p},m[b].render(),m[b].isActive=!0}),!a._addedPlotLB)q((f.plotLines||[]).concat(f.plotBands||[]),function(b){a.addPlotBandOrLine(b)}),a._addedPlotLB=!0;q([l,n,
+m],function(a){var b,c,e=[],f=va?va.duration||500:0,g=function(){for(c=e.length;c--;)a[e[c]]&&!a[e[c]].isActive&&(a[e[c]].destroy(),delete a[e[c]])};for(b in a)if(!a[b].isActive)a[b].render(b,!1,0),a[b].isActive=!1,e.push(b);a===m||!d.hasRendered||!f?g():f&&setTimeout(g,f)});if(J)b=a.getLinePath(J),a.axisLine?a.axisLine.animate({d:b}):a.axisLine=e.path(b).attr({stroke:f.lineColor,"stroke-width":J,zIndex:7}).add(a.axisGroup),a.axisLine[t?"show":"hide"]();if(k&&t)k[k.isNew?"attr":"animate"](a.getTitlePosition()),
+k.isNew=!1;o&&o.enabled&&a.renderStackTotals();a.isDirty=!1},redraw:function(){this.render();q(this.plotLinesAndBands,function(a){a.render()});q(this.series,function(a){a.isDirty=!0})},destroy:function(a){var b=this,c=b.stacks,d,e=b.plotLinesAndBands;a||X(b);for(d in c)Pa(c[d]),c[d]=null;q([b.ticks,b.minorTicks,b.alternateBands],function(a){Pa(a)});for(a=e.length;a--;)e[a].destroy();q("stackTotalGroup,axisLine,axisTitle,axisGroup,cross,gridGroup,labelGroup".split(","),function(a){b[a]&&(b[a]=b[a].destroy())});
+this.cross&&this.cross.destroy()},drawCrosshair:function(a,b){if(this.crosshair)if((s(b)||!p(this.crosshair.snap,!0))===!1)this.hideCrosshair();else{var c,d=this.crosshair,e=d.animation;p(d.snap,!0)?s(b)&&(c=this.chart.inverted!=this.horiz?b.plotX:this.len-b.plotY):c=this.horiz?a.chartX-this.pos:this.len-a.chartY+this.pos;c=this.isRadial?this.getPlotLinePath(this.isXAxis?b.x:p(b.stackY,b.y)):this.getPlotLinePath(null,null,null,null,c);if(c===null)this.hideCrosshair();else if(this.cross)this.cross.attr({visibility:"visible"})[e?
+"animate":"attr"]({d:c},e);else{e={"stroke-width":d.width||1,stroke:d.color||"#C0C0C0",zIndex:d.zIndex||2};if(d.dashStyle)e.dashstyle=d.dashStyle;this.cross=this.chart.renderer.path(c).attr(e).add()}}},hideCrosshair:function(){this.cross&&this.cross.hide()}};r(na.prototype,{getPlotBandPath:function(a,b){var c=this.getPlotLinePath(b),d=this.getPlotLinePath(a);d&&c?d.push(c[4],c[5],c[1],c[2]):d=null;return d},addPlotBand:function(a){return this.addPlotBandOrLine(a,"plotBands")},addPlotLine:function(a){return this.addPlotBandOrLine(a,
+"plotLines")},addPlotBandOrLine:function(a,b){var c=(new K.PlotLineOrBand(this,a)).render(),d=this.userOptions;c&&(b&&(d[b]=d[b]||[],d[b].push(a)),this.plotLinesAndBands.push(c));return c},removePlotBandOrLine:function(a){for(var b=this.plotLinesAndBands,c=this.options,d=this.userOptions,e=b.length;e--;)b[e].id===a&&b[e].destroy();q([c.plotLines||[],d.plotLines||[],c.plotBands||[],d.plotBands||[]],function(b){for(e=b.length;e--;)b[e].id===a&&la(b,b[e])})}});na.prototype.getTimeTicks=function(a,b,
+c,d){var e=[],f={},g=E.global.useUTC,h,i=new Da(b-Sa),j=a.unitRange,k=a.count;if(s(b)){j>=A.second&&(i.setMilliseconds(0),i.setSeconds(j>=A.minute?0:k*U(i.getSeconds()/k)));if(j>=A.minute)i[Cb](j>=A.hour?0:k*U(i[pb]()/k));if(j>=A.hour)i[Db](j>=A.day?0:k*U(i[qb]()/k));if(j>=A.day)i[sb](j>=A.month?1:k*U(i[Xa]()/k));j>=A.month&&(i[Eb](j>=A.year?0:k*U(i[fb]()/k)),h=i[gb]());j>=A.year&&(h-=h%k,i[Fb](h));if(j===A.week)i[sb](i[Xa]()-i[rb]()+p(d,1));b=1;Sa&&(i=new Da(i.getTime()+Sa));h=i[gb]();for(var d=
+i.getTime(),l=i[fb](),n=i[Xa](),m=(A.day+(g?Sa:i.getTimezoneOffset()*6E4))%A.day;d<c;)e.push(d),j===A.year?d=eb(h+b*k,0):j===A.month?d=eb(h,l+b*k):!g&&(j===A.day||j===A.week)?d=eb(h,l,n+b*k*(j===A.day?1:7)):d+=j*k,b++;e.push(d);q(wb(e,function(a){return j<=A.hour&&a%A.day===m}),function(a){f[a]="day"})}e.info=r(a,{higherRanks:f,totalRange:j*k});return e};na.prototype.normalizeTimeTickInterval=function(a,b){var c=b||[["millisecond",[1,2,5,10,20,25,50,100,200,500]],["second",[1,2,5,10,15,30]],["minute",
+[1,2,5,10,15,30]],["hour",[1,2,3,4,6,8,12]],["day",[1,2]],["week",[1,2]],["month",[1,2,3,4,6]],["year",null]],d=c[c.length-1],e=A[d[0]],f=d[1],g;for(g=0;g<c.length;g++)if(d=c[g],e=A[d[0]],f=d[1],c[g+1]&&a<=(e*f[f.length-1]+A[c[g+1][0]])/2)break;e===A.year&&a<5*e&&(f=[1,2,5]);c=nb(a/e,f,d[0]==="year"?t(mb(a/e),1):1);return{unitRange:e,count:c,unitName:d[0]}};na.prototype.getLogTickPositions=function(a,b,c,d){var e=this.options,f=this.len,g=[];if(!d)this._minorAutoInterval=null;if(a>=0.5)a=v(a),g=this.getLinearTickPositions(a,
+b,c);else if(a>=0.08)for(var f=U(b),h,i,j,k,l,e=a>0.3?[1,2,4]:a>0.15?[1,2,4,6,8]:[1,2,3,4,5,6,7,8,9];f<c+1&&!l;f++){i=e.length;for(h=0;h<i&&!l;h++)j=za(ka(f)*e[h]),j>b&&(!d||k<=c)&&k!==u&&g.push(k),k>c&&(l=!0),k=j}else if(b=ka(b),c=ka(c),a=e[d?"minorTickInterval":"tickInterval"],a=p(a==="auto"?null:a,this._minorAutoInterval,(c-b)*(e.tickPixelInterval/(d?5:1))/((d?f/this.tickPositions.length:f)||1)),a=nb(a,null,mb(a)),g=Va(this.getLinearTickPositions(a,b,c),za),!d)this._minorAutoInterval=a/5;if(!d)this.tickInterval=
+a;return g};var Nb=K.Tooltip=function(){this.init.apply(this,arguments)};Nb.prototype={init:function(a,b){var c=b.borderWidth,d=b.style,e=y(d.padding);this.chart=a;this.options=b;this.crosshairs=[];this.now={x:0,y:0};this.isHidden=!0;this.label=a.renderer.label("",0,0,b.shape||"callout",null,null,b.useHTML,null,"tooltip").attr({padding:e,fill:b.backgroundColor,"stroke-width":c,r:b.borderRadius,zIndex:8}).css(d).css({padding:0}).add().attr({y:-9999});ga||this.label.shadow(b.shadow);this.shared=b.shared},
+destroy:function(){if(this.label)this.label=this.label.destroy();clearTimeout(this.hideTimer);clearTimeout(this.tooltipTimeout)},move:function(a,b,c,d){var e=this,f=e.now,g=e.options.animation!==!1&&!e.isHidden&&(Q(a-f.x)>1||Q(b-f.y)>1),h=e.followPointer||e.len>1;r(f,{x:g?(2*f.x+a)/3:a,y:g?(f.y+b)/2:b,anchorX:h?u:g?(2*f.anchorX+c)/3:c,anchorY:h?u:g?(f.anchorY+d)/2:d});e.label.attr(f);if(g)clearTimeout(this.tooltipTimeout),this.tooltipTimeout=setTimeout(function(){e&&e.move(a,b,c,d)},32)},hide:function(a){var b=
+this,c;clearTimeout(this.hideTimer);if(!this.isHidden)c=this.chart.hoverPoints,this.hideTimer=setTimeout(function(){b.label.fadeOut();b.isHidden=!0},p(a,this.options.hideDelay,500)),c&&q(c,function(a){a.setState()}),this.chart.hoverPoints=null},getAnchor:function(a,b){var c,d=this.chart,e=d.inverted,f=d.plotTop,g=0,h=0,i,a=ra(a);c=a[0].tooltipPos;this.followPointer&&b&&(b.chartX===u&&(b=d.pointer.normalize(b)),c=[b.chartX-d.plotLeft,b.chartY-f]);c||(q(a,function(a){i=a.series.yAxis;g+=a.plotX;h+=
+(a.plotLow?(a.plotLow+a.plotHigh)/2:a.plotY)+(!e&&i?i.top-f:0)}),g/=a.length,h/=a.length,c=[e?d.plotWidth-h:g,this.shared&&!e&&a.length>1&&b?b.chartY-f:e?d.plotHeight-g:h]);return Va(c,v)},getPosition:function(a,b,c){var d=this.chart,e=this.distance,f={},g,h=["y",d.chartHeight,b,c.plotY+d.plotTop],i=["x",d.chartWidth,a,c.plotX+d.plotLeft],j=c.ttBelow||d.inverted&&!c.negative||!d.inverted&&c.negative,k=function(a,b,c,d){var g=c<d-e,b=d+e+c<b,c=d-e-c;d+=e;if(j&&b)f[a]=d;else if(!j&&g)f[a]=c;else if(g)f[a]=
+c;else if(b)f[a]=d;else return!1},l=function(a,b,c,d){if(d<e||d>b-e)return!1;else f[a]=d<c/2?1:d>b-c/2?b-c-2:d-c/2},n=function(a){var b=h;h=i;i=b;g=a},m=function(){k.apply(0,h)!==!1?l.apply(0,i)===!)***^***",
+R"***^***(1&&!g&&(n(!0),m()):g?f.x=f.y=0:(n(!0),m())};(d.inverted||this.len>1)&&n();m();return f},defaultFormatter:function(a){var b=this.points||ra(this),c=b[0].series,d;d=[a.tooltipHeaderFormatter(b[0])];q(b,function(a){c=a.series;d.push(c.tooltipFormatter&&c.tooltipFormatter(a)||a.point.tooltipFormatter(c.tooltipOptions.pointFormat))});
+d.push(a.options.footerFormat||"");return d.join("")},refresh:function(a,b){var c=this.chart,d=this.label,e=this.options,f,g,h={},i,j=[];i=e.formatter||this.defaultFormatter;var h=c.hoverPoints,k,l=this.shared;clearTimeout(this.hideTimer);this.followPointer=ra(a)[0].series.tooltipOptions.followPointer;g=this.getAnchor(a,b);f=g[0];g=g[1];l&&(!a.series||!a.series.noSharedTooltip)?(c.hoverPoints=a,h&&q(h,function(a){a.setState()}),q(a,function(a){a.setState("hover");j.push(a.getLabelConfig())}),h={x:a[0].category,
+y:a[0].y},h.points=j,this.len=j.length,a=a[0]):h=a.getLabelConfig();i=i.call(h,this);h=a.series;this.distance=p(h.tooltipOptions.distance,16);i===!1?this.hide():(this.isHidden&&(bb(d),d.attr("opacity",1).show()),d.attr({text:i}),k=e.borderColor||a.color||h.color||"#606060",d.attr({stroke:k}),this.updatePosition({plotX:f,plotY:g,negative:a.negative,ttBelow:a.ttBelow}),this.isHidden=!1);I(c,"tooltipRefresh",{text:i,x:f+c.plotLeft,y:g+c.plotTop,borderColor:k})},updatePosition:function(a){var b=this.chart,
+c=this.label,c=(this.options.positioner||this.getPosition).call(this,c.width,c.height,a);this.move(v(c.x),v(c.y),a.plotX+b.plotLeft,a.plotY+b.plotTop)},tooltipHeaderFormatter:function(a){var b=a.series,c=b.tooltipOptions,d=c.dateTimeLabelFormats,e=c.xDateFormat,f=b.xAxis,g=f&&f.options.type==="datetime"&&ja(a.key),c=c.headerFormat,f=f&&f.closestPointRange,h;if(g&&!e){if(f)for(h in A){if(A[h]>=f||A[h]<=A.day&&a.key%A[h]>0){e=d[h];break}}else e=d.day;e=e||d.year}g&&e&&(c=c.replace("{point.key}","{point.key:"+
+e+"}"));return Ja(c,{point:a,series:b})}};var pa;$a=x.documentElement.ontouchstart!==u;var Wa=K.Pointer=function(a,b){this.init(a,b)};Wa.prototype={init:function(a,b){var c=b.chart,d=c.events,e=ga?"":c.zoomType,c=a.inverted,f;this.options=b;this.chart=a;this.zoomX=f=/x/.test(e);this.zoomY=e=/y/.test(e);this.zoomHor=f&&!c||e&&c;this.zoomVert=e&&!c||f&&c;this.hasZoom=f||e;this.runChartClick=d&&!!d.click;this.pinchDown=[];this.lastValidTouch={};if(K.Tooltip&&b.tooltip.enabled)a.tooltip=new Nb(a,b.tooltip),
+this.followTouchMove=b.tooltip.followTouchMove;this.setDOMEvents()},normalize:function(a,b){var c,d,a=a||window.event,a=Tb(a);if(!a.target)a.target=a.srcElement;d=a.touches?a.touches.length?a.touches.item(0):a.changedTouches[0]:a;if(!b)this.chartPosition=b=Sb(this.chart.container);d.pageX===u?(c=t(a.x,a.clientX-b.left),d=a.y):(c=d.pageX-b.left,d=d.pageY-b.top);return r(a,{chartX:v(c),chartY:v(d)})},getCoordinates:function(a){var b={xAxis:[],yAxis:[]};q(this.chart.axes,function(c){b[c.isXAxis?"xAxis":
+"yAxis"].push({axis:c,value:c.toValue(a[c.horiz?"chartX":"chartY"])})});return b},getIndex:function(a){var b=this.chart;return b.inverted?b.plotHeight+b.plotTop-a.chartY:a.chartX-b.plotLeft},runPointActions:function(a){var b=this.chart,c=b.series,d=b.tooltip,e,f,g=b.hoverPoint,h=b.hoverSeries,i,j,k=b.chartWidth,l=this.getIndex(a);if(d&&this.options.tooltip.shared&&(!h||!h.noSharedTooltip)){f=[];i=c.length;for(j=0;j<i;j++)if(c[j].visible&&c[j].options.enableMouseTracking!==!1&&!c[j].noSharedTooltip&&
+c[j].singularTooltips!==!0&&c[j].tooltipPoints.length&&(e=c[j].tooltipPoints[l])&&e.series)e._dist=Q(l-e.clientX),k=L(k,e._dist),f.push(e);for(i=f.length;i--;)f[i]._dist>k&&f.splice(i,1);if(f.length&&f[0].clientX!==this.hoverX)d.refresh(f,a),this.hoverX=f[0].clientX}c=h&&h.tooltipOptions.followPointer;if(h&&h.tracker&&!c){if((e=h.tooltipPoints[l])&&e!==g)e.onMouseOver(a)}else d&&c&&!d.isHidden&&(h=d.getAnchor([{}],a),d.updatePosition({plotX:h[0],plotY:h[1]}));if(d&&!this._onDocumentMouseMove)this._onDocumentMouseMove=
+function(a){if(W[pa])W[pa].pointer.onDocumentMouseMove(a)},N(x,"mousemove",this._onDocumentMouseMove);q(b.axes,function(b){b.drawCrosshair(a,p(e,g))})},reset:function(a,b){var c=this.chart,d=c.hoverSeries,e=c.hoverPoint,f=c.tooltip,g=f&&f.shared?c.hoverPoints:e;(a=a&&f&&g)&&ra(g)[0].plotX===u&&(a=!1);if(a)f.refresh(g),e&&e.setState(e.state,!0);else{if(e)e.onMouseOut();if(d)d.onMouseOut();f&&f.hide(b);if(this._onDocumentMouseMove)X(x,"mousemove",this._onDocumentMouseMove),this._onDocumentMouseMove=
+null;q(c.axes,function(a){a.hideCrosshair()});this.hoverX=null}},scaleGroups:function(a,b){var c=this.chart,d;q(c.series,function(e){d=a||e.getPlotBox();e.xAxis&&e.xAxis.zoomEnabled&&(e.group.attr(d),e.markerGroup&&(e.markerGroup.attr(d),e.markerGroup.clip(b?c.clipRect:null)),e.dataLabelsGroup&&e.dataLabelsGroup.attr(d))});c.clipRect.attr(b||c.clipBox)},dragStart:function(a){var b=this.chart;b.mouseIsDown=a.type;b.cancelClick=!1;b.mouseDownX=this.mouseDownX=a.chartX;b.mouseDownY=this.mouseDownY=a.chartY},
+drag:function(a){var b=this.chart,c=b.options.chart,d=a.chartX,e=a.chartY,f=this.zoomHor,g=this.zoomVert,h=b.plotLeft,i=b.plotTop,j=b.plotWidth,k=b.plotHeight,l,n=this.mouseDownX,m=this.mouseDownY,o=c.panKey&&a[c.panKey+"Key"];d<h?d=h:d>h+j&&(d=h+j);e<i?e=i:e>i+k&&(e=i+k);this.hasDragged=Math.sqrt(Math.pow(n-d,2)+Math.pow(m-e,2));if(this.hasDragged>10){l=b.isInsidePlot(n-h,m-i);if(b.hasCartesianSeries&&(this.zoomX||this.zoomY)&&l&&!o&&!this.selectionMarker)this.selectionMarker=b.renderer.rect(h,i,
+f?1:j,g?1:k,0).attr({fill:c.selectionMarkerFill||"rgba(69,114,167,0.25)",zIndex:7}).add();this.selectionMarker&&f&&(d-=n,this.selectionMarker.attr({width:Q(d),x:(d>0?0:d)+n}));this.selectionMarker&&g&&(d=e-m,this.selectionMarker.attr({height:Q(d),y:(d>0?0:d)+m}));l&&!this.selectionMarker&&c.panning&&b.pan(a,c.panning)}},drop:function(a){var b=this.chart,c=this.hasPinched;if(this.selectionMarker){var d={xAxis:[],yAxis:[],originalEvent:a.originalEvent||a},e=this.selectionMarker,f=e.attr?e.attr("x"):
+e.x,g=e.attr?e.attr("y"):e.y,h=e.attr?e.attr("width"):e.width,i=e.attr?e.attr("height"):e.height,j;if(this.hasDragged||c)q(b.axes,function(b){if(b.zoomEnabled){var c=b.horiz,e=a.type==="touchend"?b.minPixelPadding:0,m=b.toValue((c?f:g)+e),c=b.toValue((c?f+h:g+i)-e);!isNaN(m)&&!isNaN(c)&&(d[b.coll].push({axis:b,min:L(m,c),max:t(m,c)}),j=!0)}}),j&&I(b,"selection",d,function(a){b.zoom(r(a,c?{animation:!1}:null))});this.selectionMarker=this.selectionMarker.destroy();c&&this.scaleGroups()}if(b)B(b.container,
+{cursor:b._cursor}),b.cancelClick=this.hasDragged>10,b.mouseIsDown=this.hasDragged=this.hasPinched=!1,this.pinchDown=[]},onContainerMouseDown:function(a){a=this.normalize(a);a.preventDefault&&a.preventDefault();this.dragStart(a)},onDocumentMouseUp:function(a){W[pa]&&W[pa].pointer.drop(a)},onDocumentMouseMove:function(a){var b=this.chart,c=this.chartPosition,d=b.hoverSeries,a=this.normalize(a,c);c&&d&&!this.inClass(a.target,"highcharts-tracker")&&!b.isInsidePlot(a.chartX-b.plotLeft,a.chartY-b.plotTop)&&
+this.reset()},onContainerMouseLeave:function(){var a=W[pa];if(a)a.pointer.reset(),a.pointer.chartPosition=null},onContainerMouseMove:function(a){var b=this.chart;pa=b.index;a=this.normalize(a);a.returnValue=!1;b.mouseIsDown==="mousedown"&&this.drag(a);(this.inClass(a.target,"highcharts-tracker")||b.isInsidePlot(a.chartX-b.plotLeft,a.chartY-b.plotTop))&&!b.openMenu&&this.runPointActions(a)},inClass:function(a,b){for(var c;a;){if(c=F(a,"class"))if(c.indexOf(b)!==-1)return!0;else if(c.indexOf("highcharts-container")!==
+-1)return!1;a=a.parentNode}},onTrackerMouseOut:function(a){var b=this.chart.hoverSeries,c=(a=a.relatedTarget||a.toElement)&&a.point&&a.point.series;if(b&&!b.options.stickyTracking&&!this.inClass(a,"highcharts-tooltip")&&c!==b)b.onMouseOut()},onContainerClick:function(a){var b=this.chart,c=b.hoverPoint,d=b.plotLeft,e=b.plotTop,a=this.normalize(a);a.cancelBubble=!0;b.cancelClick||(c&&this.inClass(a.target,"highcharts-tracker")?(I(c.series,"click",r(a,{point:c})),b.hoverPoint&&c.firePointEvent("click",
+a)):(r(a,this.getCoordinates(a)),b.isInsidePlot(a.chartX-d,a.chartY-e)&&I(b,"click",a)))},setDOMEvents:function(){var a=this,b=a.chart.container;b.onmousedown=function(b){a.onContainerMouseDown(b)};b.onmousemove=function(b){a.onContainerMouseMove(b)};b.onclick=function(b){a.onContainerClick(b)};N(b,"mouseleave",a.onContainerMouseLeave);ab===1&&N(x,"mouseup",a.onDocumentMouseUp);if($a)b.ontouchstart=function(b){a.onContainerTouchStart(b)},b.ontouchmove=function(b){a.onContainerTouchMove(b)},ab===1&&
+N(x,"touchend",a.onDocumentTouchEnd)},destroy:function(){var a;X(this.chart.container,"mouseleave",this.onContainerMouseLeave);ab||(X(x,"mouseup",this.onDocumentMouseUp),X(x,"touchend",this.onDocumentTouchEnd));clearInterval(this.tooltipTimeout);for(a in this)this[a]=null}};r(K.Pointer.prototype,{pinchTranslate:function(a,b,c,d,e,f){(this.zoomHor||this.pinchHor)&&this.pinchTranslateDirection(!0,a,b,c,d,e,f);(this.zoomVert||this.pinchVert)&&this.pinchTranslateDirection(!1,a,b,c,d,e,f)},pinchTranslateDirection:function(a,
+b,c,d,e,f,g,h){var i=this.chart,j=a?"x":"y",k=a?"X":"Y",l="chart"+k,n=a?"width":"height",m=i["plot"+(a?"Left":"Top")],o,p,q=h||1,r=i.inverted,C=i.bounds[a?"h":"v"],t=b.length===1,s=b[0][l],v=c[0][l],u=!t&&b[1][l],w=!t&&c[1][l],x,c=function(){!t&&Q(s-u)>20&&(q=h||Q(v-w)/Q(s-u));p=(m-v)/q+s;o=i["plot"+(a?"Width":"Height")]/q};c();b=p;b<C.min?(b=C.min,x=!0):b+o>C.max&&(b=C.max-o,x=!0);x?(v-=0.8*(v-g[j][0]),t||(w-=0.8*(w-g[j][1])),c()):g[j]=[v,w];r||(f[j]=p-m,f[n]=o);f=r?1/q:q;e[n]=o;e[j]=b;d[r?a?"scaleY":
+"scaleX":"scale"+k]=q;d["translate"+k]=f*m+(v-f*s)},pinch:function(a){var b=this,c=b.chart,d=b.pinchDown,e=b.followTouchMove,f=a.touches,g=f.length,h=b.lastValidTouch,i=b.hasZoom,j=b.selectionMarker,k={},l=g===1&&(b.inClass(a.target,"highcharts-tracker")&&c.runTrackerClick||b.runChartClick),n={};(i||e)&&!l&&a.preventDefault();Va(f,function(a){return b.normalize(a)});if(a.type==="touchstart")q(f,function(a,b){d[b]={chartX:a.chartX,chartY:a.chartY}}),h.x=[d[0].chartX,d[1]&&d[1].cha)***^***",
+R"***^***(rtX],h.y=[d[0].chartY,
+d[1]&&d[1].chartY],q(c.axes,function(a){if(a.zoomEnabled){var b=c.bounds[a.horiz?"h":"v"],d=a.minPixelPadding,e=a.toPixels(p(a.options.min,a.dataMin)),f=a.toPixels(p(a.options.max,a.dataMax)),g=L(e,f),e=t(e,f);b.min=L(a.pos,g-d);b.max=t(a.pos+a.len,e+d)}}),b.res=!0;else if(d.length){if(!j)b.selectionMarker=j=r({destroy:sa},c.plotBox);b.pinchTranslate(d,f,k,j,n,h);b.hasPinched=i;b.scaleGroups(k,n);if(!i&&e&&g===1)this.runPointActions(b.normalize(a));else if(b.res)b.res=!1,this.reset(!1,0)}},onContainerTouchStart:function(a){var b=
+this.chart;pa=b.index;a.touches.length===1?(a=this.normalize(a),b.isInsidePlot(a.chartX-b.plotLeft,a.chartY-b.plotTop)?(this.runPointActions(a),this.pinch(a)):this.reset()):a.touches.length===2&&this.pinch(a)},onContainerTouchMove:function(a){(a.touches.length===1||a.touches.length===2)&&this.pinch(a)},onDocumentTouchEnd:function(a){W[pa]&&W[pa].pointer.drop(a)}});if(G.PointerEvent||G.MSPointerEvent){var ua={},zb=!!G.PointerEvent,Xb=function(){var a,b=[];b.item=function(a){return this[a]};for(a in ua)ua.hasOwnProperty(a)&&
+b.push({pageX:ua[a].pageX,pageY:ua[a].pageY,target:ua[a].target});return b},Ab=function(a,b,c,d){a=a.originalEvent||a;if((a.pointerType==="touch"||a.pointerType===a.MSPOINTER_TYPE_TOUCH)&&W[pa])d(a),d=W[pa].pointer,d[b]({type:c,target:a.currentTarget,preventDefault:sa,touches:Xb()})};r(Wa.prototype,{onContainerPointerDown:function(a){Ab(a,"onContainerTouchStart","touchstart",function(a){ua[a.pointerId]={pageX:a.pageX,pageY:a.pageY,target:a.currentTarget}})},onContainerPointerMove:function(a){Ab(a,
+"onContainerTouchMove","touchmove",function(a){ua[a.pointerId]={pageX:a.pageX,pageY:a.pageY};if(!ua[a.pointerId].target)ua[a.pointerId].target=a.currentTarget})},onDocumentPointerUp:function(a){Ab(a,"onContainerTouchEnd","touchend",function(a){delete ua[a.pointerId]})},batchMSEvents:function(a){a(this.chart.container,zb?"pointerdown":"MSPointerDown",this.onContainerPointerDown);a(this.chart.container,zb?"pointermove":"MSPointerMove",this.onContainerPointerMove);a(x,zb?"pointerup":"MSPointerUp",this.onDocumentPointerUp)}});
+Na(Wa.prototype,"init",function(a,b,c){a.call(this,b,c);(this.hasZoom||this.followTouchMove)&&B(b.container,{"-ms-touch-action":P,"touch-action":P})});Na(Wa.prototype,"setDOMEvents",function(a){a.apply(this);(this.hasZoom||this.followTouchMove)&&this.batchMSEvents(N)});Na(Wa.prototype,"destroy",function(a){this.batchMSEvents(X);a.call(this)})}var lb=K.Legend=function(a,b){this.init(a,b)};lb.prototype={init:function(a,b){var c=this,d=b.itemStyle,e=p(b.padding,8),f=b.itemMarginTop||0;this.options=b;
+if(b.enabled)c.itemStyle=d,c.itemHiddenStyle=w(d,b.itemHiddenStyle),c.itemMarginTop=f,c.padding=e,c.initialItemX=e,c.initialItemY=e-5,c.maxItemWidth=0,c.chart=a,c.itemHeight=0,c.lastLineHeight=0,c.symbolWidth=p(b.symbolWidth,16),c.pages=[],c.render(),N(c.chart,"endResize",function(){c.positionCheckboxes()})},colorizeItem:function(a,b){var c=this.options,d=a.legendItem,e=a.legendLine,f=a.legendSymbol,g=this.itemHiddenStyle.color,c=b?c.itemStyle.color:g,h=b?a.legendColor||a.color||"#CCC":g,g=a.options&&
+a.options.marker,i={fill:h},j;d&&d.css({fill:c,color:c});e&&e.attr({stroke:h});if(f){if(g&&f.isMarker)for(j in i.stroke=h,g=a.convertAttribs(g),g)d=g[j],d!==u&&(i[j]=d);f.attr(i)}},positionItem:function(a){var b=this.options,c=b.symbolPadding,b=!b.rtl,d=a._legendItemPos,e=d[0],d=d[1],f=a.checkbox;a.legendGroup&&a.legendGroup.translate(b?e:this.legendWidth-e-2*c-4,d);if(f)f.x=e,f.y=d},destroyItem:function(a){var b=a.checkbox;q(["legendItem","legendLine","legendSymbol","legendGroup"],function(b){a[b]&&
+(a[b]=a[b].destroy())});b&&Qa(a.checkbox)},destroy:function(){var a=this.group,b=this.box;if(b)this.box=b.destroy();if(a)this.group=a.destroy()},positionCheckboxes:function(a){var b=this.group.alignAttr,c,d=this.clipHeight||this.legendHeight;if(b)c=b.translateY,q(this.allItems,function(e){var f=e.checkbox,g;f&&(g=c+f.y+(a||0)+3,B(f,{left:b.translateX+e.checkboxOffset+f.x-20+"px",top:g+"px",display:g>c-6&&g<c+d-6?"":P}))})},renderTitle:function(){var a=this.padding,b=this.options.title,c=0;if(b.text){if(!this.title)this.title=
+this.chart.renderer.label(b.text,a-3,a-4,null,null,null,null,null,"legend-title").attr({zIndex:1}).css(b.style).add(this.group);a=this.title.getBBox();c=a.height;this.offsetWidth=a.width;this.contentGroup.attr({translateY:c})}this.titleHeight=c},renderItem:function(a){var b=this.chart,c=b.renderer,d=this.options,e=d.layout==="horizontal",f=this.symbolWidth,g=d.symbolPadding,h=this.itemStyle,i=this.itemHiddenStyle,j=this.padding,k=e?p(d.itemDistance,20):0,l=!d.rtl,n=d.width,m=d.itemMarginBottom||0,
+o=this.itemMarginTop,q=this.initialItemX,r=a.legendItem,s=a.series&&a.series.drawLegendSymbol?a.series:a,C=s.options,C=this.createCheckboxForItem&&C&&C.showCheckbox,u=d.useHTML;if(!r){a.legendGroup=c.g("legend-item").attr({zIndex:1}).add(this.scrollGroup);a.legendItem=r=c.text(d.labelFormat?Ja(d.labelFormat,a):d.labelFormatter.call(a),l?f+g:-g,this.baseline||0,u).css(w(a.visible?h:i)).attr({align:l?"left":"right",zIndex:2}).add(a.legendGroup);if(!this.baseline)this.baseline=c.fontMetrics(h.fontSize,
+r).f+3+o,r.attr("y",this.baseline);s.drawLegendSymbol(this,a);this.setItemEvents&&this.setItemEvents(a,r,u,h,i);this.colorizeItem(a,a.visible);C&&this.createCheckboxForItem(a)}c=r.getBBox();f=a.checkboxOffset=d.itemWidth||a.legendItemWidth||f+g+c.width+k+(C?20:0);this.itemHeight=g=v(a.legendItemHeight||c.height);if(e&&this.itemX-q+f>(n||b.chartWidth-2*j-q-d.x))this.itemX=q,this.itemY+=o+this.lastLineHeight+m,this.lastLineHeight=0;this.maxItemWidth=t(this.maxItemWidth,f);this.lastItemY=o+this.itemY+
 m;this.lastLineHeight=t(g,this.lastLineHeight);a._legendItemPos=[this.itemX,this.itemY];e?this.itemX+=f:(this.itemY+=o+g+m,this.lastLineHeight=g);this.offsetWidth=n||t((e?this.itemX-q-k:f)+j,this.offsetWidth)},getAllItems:function(){var a=[];q(this.chart.series,function(b){var c=b.options;if(p(c.showInLegend,!s(c.linkedTo)?u:!1,!0))a=a.concat(b.legendItems||(c.legendType==="point"?b.data:b))});return a},render:function(){var a=this,b=a.chart,c=b.renderer,d=a.group,e,f,g,h,i=a.box,j=a.options,k=a.padding,
 l=j.borderWidth,n=j.backgroundColor;a.itemX=a.initialItemX;a.itemY=a.initialItemY;a.offsetWidth=0;a.lastItemY=0;if(!d)a.group=d=c.g("legend").attr({zIndex:7}).add(),a.contentGroup=c.g().attr({zIndex:1}).add(d),a.scrollGroup=c.g().add(a.contentGroup);a.renderTitle();e=a.getAllItems();ob(e,function(a,b){return(a.options&&a.options.legendIndex||0)-(b.options&&b.options.legendIndex||0)});j.reversed&&e.reverse();a.allItems=e;a.display=f=!!e.length;q(e,function(b){a.renderItem(b)});g=j.width||a.offsetWidth;
 h=a.lastItemY+a.lastLineHeight+a.titleHeight;h=a.handleOverflow(h);if(l||n){g+=k;h+=k;if(i){if(g>0&&h>0)i[i.isNew?"attr":"animate"](i.crisp({width:g,height:h})),i.isNew=!1}else a.box=i=c.rect(0,0,g,h,j.borderRadius,l||0).attr({stroke:j.borderColor,"stroke-width":l||0,fill:n||P}).add(d).shadow(j.shadow),i.isNew=!0;i[f?"show":"hide"]()}a.legendWidth=g;a.legendHeight=h;q(e,function(b){a.positionItem(b)});f&&d.align(r({width:g,height:h},j),!0,"spacingBox");b.isResizing||this.positionCheckboxes()},handleOverflow:function(a){var b=
@@ -2504,8 +6132,8 @@ e=m.length;if(!e||c-m[e-1]>h&&(o||c)!==m[e-1])m.push(o||c),e++;b===r.length-1&&c
 a=f}else if(n)i.attr({height:c.chartHeight}),n.hide(),this.scrollGroup.attr({translateY:1}),this.clipHeight=0;return a},scroll:function(a,b){var c=this.pages,d=c.length,e=this.currentPage+a,f=this.clipHeight,g=this.options.navigation,h=g.activeColor,g=g.inactiveColor,i=this.pager,j=this.padding;e>d&&(e=d);if(e>0)b!==u&&Ra(b,this.chart),this.nav.attr({translateX:j,translateY:f+this.padding+7+this.titleHeight,visibility:"visible"}),this.up.attr({fill:e===1?g:h}).css({cursor:e===1?"default":"pointer"}),
 i.attr({text:e+"/"+d}),this.down.attr({x:18+this.pager.getBBox().width,fill:e===d?g:h}).css({cursor:e===d?"default":"pointer"}),c=-c[e-1]+this.initialItemY,this.scrollGroup.animate({translateY:c}),this.currentPage=e,this.positionCheckboxes(c)}};M=K.LegendSymbolMixin={drawRectangle:function(a,b){var c=a.options.symbolHeight||12;b.legendSymbol=this.chart.renderer.rect(0,a.baseline-5-c/2,a.symbolWidth,c,a.options.symbolRadius||0).attr({zIndex:3}).add(b.legendGroup)},drawLineMarker:function(a){var b=
 this.options,c=b.marker,d;d=a.symbolWidth;var e=this.chart.renderer,f=this.legendGroup,a=a.baseline-v(e.fontMetrics(a.options.itemStyle.fontSize,this.legendItem).b*0.3),g;if(b.lineWidth){g={"stroke-width":b.lineWidth};if(b.dashStyle)g.dashstyle=b.dashStyle;this.legendLine=e.path(["M",0,a,"L",d,a]).attr(g).add(f)}if(c&&c.enabled!==!1)b=c.radius,this.legendSymbol=d=e.symbol(this.symbol,d/2-b,a-b,2*b,2*b).add(f),d.isMarker=!0}};(/Trident\/7\.0/.test(wa)||Ua)&&Na(lb.prototype,"positionItem",function(a,
-b){var c=this,d=function(){b._legendItemPos&&a.call(c,b)};d();setTimeout(d)});Ya.prototype={init:function(a,b){var c,d=a.series;a.series=null;c=w(E,a);c.series=a.series=d;this.userOptions=a;d=c.chart;this.margin=this.splashArray("margin)***^***",
-R"***^***(",d);this.spacing=this.splashArray("spacing",d);var e=d.events;this.bounds={h:{},v:{}};this.callback=b;this.isResizing=0;this.options=c;this.axes=[];this.series=[];this.hasCartesianSeries=d.showAxes;var f=this,g;f.index=W.length;W.push(f);ab++;d.reflow!==!1&&N(f,"load",
+b){var c=this,d=function(){b._legendItemPos&&a.call(c,b)};d();setTimeout(d)});Ya.prototype={init:function(a,b){var c,d=a.series;a.series=null;c=w(E,a);c.series=a.series=d;this.userOptions=a;d=c.chart;this.margin=this.splashArray("margin",d))***^***",
+R"***^***(;this.spacing=this.splashArray("spacing",d);var e=d.events;this.bounds={h:{},v:{}};this.callback=b;this.isResizing=0;this.options=c;this.axes=[];this.series=[];this.hasCartesianSeries=d.showAxes;var f=this,g;f.index=W.length;W.push(f);ab++;d.reflow!==!1&&N(f,"load",
 function(){f.initReflow()});if(e)for(g in e)N(f,g,e[g]);f.xAxis=[];f.yAxis=[];f.animation=ga?!1:p(d.animation,!0);f.pointCount=f.colorCounter=f.symbolCounter=0;f.firstRender()},initSeries:function(a){var b=this.options.chart;(b=H[a.type||b.type||b.defaultSeriesType])||ha(17,!0);b=new b;b.init(this,a);return b},isInsidePlot:function(a,b,c){var d=c?b:a,a=c?a:b;return d>=0&&d<=this.plotWidth&&a>=0&&a<=this.plotHeight},adjustTickAmounts:function(){this.options.chart.alignTicks!==!1&&q(this.axes,function(a){a.adjustTickAmount()});
 this.maxTicks=null},redraw:function(a){var b=this.axes,c=this.series,d=this.pointer,e=this.legend,f=this.isDirtyLegend,g,h,i=this.hasCartesianSeries,j=this.isDirtyBox,k=c.length,l=k,n=this.renderer,m=n.isHidden(),o=[];Ra(a,this);m&&this.cloneRenderTo();for(this.layOutTitles();l--;)if(a=c[l],a.options.stacking&&(g=!0,a.isDirty)){h=!0;break}if(h)for(l=k;l--;)if(a=c[l],a.options.stacking)a.isDirty=!0;q(c,function(a){a.isDirty&&a.options.legendType==="point"&&(f=!0)});if(f&&e.options.enabled)e.render(),
 this.isDirtyLegend=!1;g&&this.getStacks();if(i){if(!this.isResizing)this.maxTicks=null,q(b,function(a){a.setScale()});this.adjustTickAmounts()}this.getMargins();i&&(q(b,function(a){a.isDirty&&(j=!0)}),q(b,function(a){if(a.isDirtyExtremes)a.isDirtyExtremes=!1,o.push(function(){I(a,"afterSetExtremes",r(a.eventArgs,a.getExtremes()));delete a.eventArgs});(j||g)&&a.redraw()}));j&&this.drawChartBox();q(c,function(a){a.isDirty&&a.visible&&(!a.isCartesian||a.xAxis)&&a.redraw()});d&&d.reset(!0);n.draw();I(this,
@@ -2525,8 +6153,8 @@ l=t(0,v(e-j-this.marginBottom));this.plotSizeX=b?l:k;this.plotSizeY=b?k:l;this.p
 this.spacing,b=this.margin;this.plotTop=p(b[0],a[0]);this.marginRight=p(b[1],a[1]);this.marginBottom=p(b[2],a[2]);this.plotLeft=p(b[3],a[3]);this.axisOffset=[0,0,0,0];this.clipOffset=[0,0,0,0]},drawChartBox:function(){var a=this.options.chart,b=this.renderer,c=this.chartWidth,d=this.chartHeight,e=this.chartBackground,f=this.plotBackground,g=this.plotBorder,h=this.plotBGImage,i=a.borderWidth||0,j=a.backgroundColor,k=a.plotBackgroundColor,l=a.plotBackgroundImage,n=a.plotBorderWidth||0,m,o=this.plotLeft,
 p=this.plotTop,q=this.plotWidth,r=this.plotHeight,t=this.plotBox,s=this.clipRect,v=this.clipBox;m=i+(a.shadow?8:0);if(i||j)if(e)e.animate(e.crisp({width:c-m,height:d-m}));else{e={fill:j||P};if(i)e.stroke=a.borderColor,e["stroke-width"]=i;this.chartBackground=b.rect(m/2,m/2,c-m,d-m,a.borderRadius,i).attr(e).addClass("highcharts-background").add().shadow(a.shadow)}if(k)f?f.animate(t):this.plotBackground=b.rect(o,p,q,r,0).attr({fill:k}).add().shadow(a.plotShadow);if(l)h?h.animate(t):this.plotBGImage=
 b.image(l,o,p,q,r).add();s?s.animate({width:v.width,height:v.height}):this.clipRect=b.clipRect(v);if(n)g?g.animate(g.crisp({x:o,y:p,width:q,height:r,strokeWidth:-n})):this.plotBorder=b.rect(o,p,q,r,0,-n).attr({stroke:a.plotBorderColor,"stroke-width":n,fill:P,zIndex:1}).add();this.isDirtyBox=!1},propFromSeries:function(){var a=this,b=a.options.chart,c,d=a.options.series,e,f;q(["inverted","angular","polar"],function(g){c=H[b.type||b.defaultSeriesType];f=a[g]||b[g]||c&&c.prototype[g];for(e=d&&d.length;!f&&
-e--;)(c=H[d[e].type])&&c.prototype[g]&&(f=!0);a[g]=f})},)***^***",
-R"***^***(linkSeries:function(){var a=this,b=a.series;q(b,function(a){a.linkedSeries.length=0});q(b,function(b){var d=b.options.linkedTo;if(Ga(d)&&(d=d===":previous"?a.series[b.index-1]:a.get(d)))d.linkedSeries.push(b),b.linkedParent=d})},renderSeries:function(){q(this.series,function(a){a.translate();a.setTooltipPoints&&a.setTooltipPoints();a.render()})},renderLabels:function(){var a=this,b=a.options.labels;b.items&&q(b.items,function(c){var d=r(b.style,
+e--;)(c=H[d[e].type])&&c.prototype[g]&&(f=!0);a[g]=f})},link)***^***",
+R"***^***(Series:function(){var a=this,b=a.series;q(b,function(a){a.linkedSeries.length=0});q(b,function(b){var d=b.options.linkedTo;if(Ga(d)&&(d=d===":previous"?a.series[b.index-1]:a.get(d)))d.linkedSeries.push(b),b.linkedParent=d})},renderSeries:function(){q(this.series,function(a){a.translate();a.setTooltipPoints&&a.setTooltipPoints();a.render()})},renderLabels:function(){var a=this,b=a.options.labels;b.items&&q(b.items,function(c){var d=r(b.style,
 c.style),e=y(d.left)+a.plotLeft,f=y(d.top)+a.plotTop+12;delete d.left;delete d.top;a.renderer.text(c.html,e,f).attr({zIndex:2}).css(d).add()})},render:function(){var a=this.axes,b=this.renderer,c=this.options;this.setTitle();this.legend=new lb(this,c.legend);this.getStacks();q(a,function(a){a.setScale()});this.getMargins();this.maxTicks=null;q(a,function(a){a.setTickPositions(!0);a.setMaxTicks()});this.adjustTickAmounts();this.getMargins();this.drawChartBox();this.hasCartesianSeries&&q(a,function(a){a.render()});
 if(!this.seriesGroup)this.seriesGroup=b.g("series-group").attr({zIndex:3}).add();this.renderSeries();this.renderLabels();this.showCredits(c.credits);this.hasRendered=!0},showCredits:function(a){if(a.enabled&&!this.credits)this.credits=this.renderer.text(a.text,0,0).on("click",function(){if(a.href)location.href=a.href}).attr({align:a.position.align,zIndex:8}).css(a.style).add().align(a.position)},destroy:function(){var a=this,b=a.axes,c=a.series,d=a.container,e,f=d&&d.parentNode;I(a,"destroy");W[a.index]=
 u;ab--;a.renderTo.removeAttribute("data-highcharts-chart");X(a);for(e=b.length;e--;)b[e]=b[e].destroy();for(e=c.length;e--;)c[e]=c[e].destroy();q("title,subtitle,chartBackground,plotBackground,plotBGImage,plotBorder,seriesGroup,clipRect,credits,pointer,scroller,rangeSelector,legend,resetZoomButton,tooltip,renderer".split(","),function(b){var c=a[b];c&&c.destroy&&(a[b]=c.destroy())});if(d)d.innerHTML="",X(d),f&&Qa(d);for(e in a)delete a[e]},isReadyToRender:function(){var a=this;return!ba&&G==G.top&&
@@ -2545,8 +6173,8 @@ d[this.type].tooltip,a.tooltip);e.marker===null&&delete c.marker;return c},getCy
 0},drawLegendSymbol:M.drawLineMarker,setData:function(a,b,c,d){var e=this,f=e.points,g=f&&f.length||0,h,i=e.options,j=e.chart,k=null,l=e.xAxis,n=l&&!!l.categories,m=e.tooltipPoints,o=i.turboThreshold,r=this.xData,t=this.yData,s=(h=e.pointArrayMap)&&h.length,a=a||[];h=a.length;b=p(b,!0);if(d!==!1&&h&&g===h&&!e.cropped&&!e.hasGroupedData)q(a,function(a,b){f[b].update(a,!1,null,!1)});else{e.xIncrement=null;e.pointRange=n?1:i.pointRange;e.colorCounter=0;q(this.parallelArrays,function(a){e[a+"Data"].length=
 0});if(o&&h>o){for(c=0;k===null&&c<h;)k=a[c],c++;if(ja(k)){n=p(i.pointStart,0);i=p(i.pointInterval,1);for(c=0;c<h;c++)r[c]=n,t[c]=a[c],n+=i;e.xIncrement=n}else if(Ha(k))if(s)for(c=0;c<h;c++)i=a[c],r[c]=i[0],t[c]=i.slice(1,s+1);else for(c=0;c<h;c++)i=a[c],r[c]=i[0],t[c]=i[1];else ha(12)}else for(c=0;c<h;c++)if(a[c]!==u&&(i={series:e},e.pointClass.prototype.applyOptions.apply(i,[a[c]]),e.updateParallelArrays(i,c),n&&i.name))l.names[i.x]=i.name;Ga(t[0])&&ha(14,!0);e.data=[];e.options.data=a;for(c=g;c--;)f[c]&&
 f[c].destroy&&f[c].destroy();if(m)m.length=0;if(l)l.minRange=l.userMinRange;e.isDirty=e.isDirtyData=j.isDirtyBox=!0;c=!1}b&&j.redraw(c)},processData:function(a){var b=this.xData,c=this.yData,d=b.length,e;e=0;var f,g,h=this.xAxis,i,j=this.options;i=j.cropThreshold;var k=0,l=this.isCartesian,n,m;if(l&&!this.isDirty&&!h.isDirty&&!this.yAxis.isDirty&&!a)return!1;if(h)n=h.getExtremes(),m=n.min,n=n.max;if(l&&this.sorted&&(!i||d>i||this.forceCrop))if(b[d-1]<m||b[0]>n)b=[],c=[];else if(b[0]<m||b[d-1]>n)e=
-this.cropData(this.xData,this.yData,m,n),b=e.xData,c=e.yData,e=e.start,f=!0,k=b.length;for(i=b.length-1;i>=0;i--)d=b[i]-b[i-1],!f&&b[i]>m&&b[i]<n&&k++,d>0&&(g===u||d<g)?g=d:d<0&&this.requireSorting&&ha(15);this.cropped=f;this.cropStart=e;this.processedXData=b;this.processedYData=c;this.activePointCount=k;if(j.pointRange===null)this.pointRange=g||1;this.closestP)***^***",
-R"***^***(ointRange=g},cropData:function(a,b,c,d){var e=a.length,f=0,g=e,h=p(this.cropShoulder,1),i;for(i=0;i<e;i++)if(a[i]>=c){f=t(0,i-h);break}for(;i<
+this.cropData(this.xData,this.yData,m,n),b=e.xData,c=e.yData,e=e.start,f=!0,k=b.length;for(i=b.length-1;i>=0;i--)d=b[i]-b[i-1],!f&&b[i]>m&&b[i]<n&&k++,d>0&&(g===u||d<g)?g=d:d<0&&this.requireSorting&&ha(15);this.cropped=f;this.cropStart=e;this.processedXData=b;this.processedYData=c;this.activePointCount=k;if(j.pointRange===null)this.pointRange=g||1;this.closestPoint)***^***",
+R"***^***(Range=g},cropData:function(a,b,c,d){var e=a.length,f=0,g=e,h=p(this.cropShoulder,1),i;for(i=0;i<e;i++)if(a[i]>=c){f=t(0,i-h);break}for(;i<
 e;i++)if(a[i]>d){g=i+h;break}return{xData:a.slice(f,g),yData:b.slice(f,g),start:f,end:g}},generatePoints:function(){var a=this.options.data,b=this.data,c,d=this.processedXData,e=this.processedYData,f=this.pointClass,g=d.length,h=this.cropStart||0,i,j=this.hasGroupedData,k,l=[],n;if(!b&&!j)b=[],b.length=a.length,b=this.data=b;for(n=0;n<g;n++)i=h+n,j?l[n]=(new f).init(this,[d[n]].concat(ra(e[n]))):(b[i]?k=b[i]:a[i]!==u&&(b[i]=k=(new f).init(this,a[i],d[n])),l[n]=k),l[n].index=i;if(b&&(g!==(c=b.length)||
 j))for(n=0;n<c;n++)if(n===h&&!j&&(n+=g),b[n])b[n].destroyElements(),b[n].plotX=u;this.data=b;this.points=l},getExtremes:function(a){var b=this.yAxis,c=this.processedXData,d,e=[],f=0;d=this.xAxis.getExtremes();var g=d.min,h=d.max,i,j,k,l,a=a||this.stackedYData||this.processedYData;d=a.length;for(l=0;l<d;l++)if(j=c[l],k=a[l],i=k!==null&&k!==u&&(!b.isLog||k.length||k>0),j=this.getExtremesFromAll||this.cropped||(c[l+1]||j)>=g&&(c[l-1]||j)<=h,i&&j)if(i=k.length)for(;i--;)k[i]!==null&&(e[f++]=k[i]);else e[f++]=
 k;this.dataMin=p(void 0,Oa(e));this.dataMax=p(void 0,Ca(e))},translate:function(){this.processedXData||this.processData();this.generatePoints();for(var a=this.options,b=a.stacking,c=this.xAxis,d=c.categories,e=this.yAxis,f=this.points,g=f.length,h=!!this.modifyValue,i=a.pointPlacement,j=i==="between"||ja(i),k=a.threshold,a=0;a<g;a++){var l=f[a],n=l.x,m=l.y,o=l.low,q=b&&e.stacks[(this.negStacks&&m<k?"-":"")+this.stackKey];if(e.isLog&&m<=0)l.y=m=null,ha(10);l.plotX=c.translate(n,0,0,0,1,i,this.type===
@@ -2566,8 +6194,8 @@ f=this.chart.renderer.g(b).attr({visibility:c,zIndex:d||0.1}).add(e));f[g?"attr"
 c=a.plotGroup("group","series",f,g,i);a.markerGroup=a.plotGroup("markerGroup","markers",f,g,i);e&&a.animate(!0);a.getAttribs();c.inverted=a.isCartesian?b.inverted:!1;a.drawGraph&&(a.drawGraph(),a.clipNeg());q(a.points,function(a){a.redraw&&a.redraw()});a.drawDataLabels&&a.drawDataLabels();a.visible&&a.drawPoints();a.drawTracker&&a.options.enableMouseTracking!==!1&&a.drawTracker();b.inverted&&a.invertGroups();d.clip!==!1&&!a.sharedClipKey&&!h&&c.clip(b.clipRect);e&&a.animate();if(!h)e?a.animationTimeout=
 setTimeout(function(){a.afterAnimate()},e):a.afterAnimate();a.isDirty=a.isDirtyData=!1;a.hasRendered=!0},redraw:function(){var a=this.chart,b=this.isDirtyData,c=this.group,d=this.xAxis,e=this.yAxis;c&&(a.inverted&&c.attr({width:a.plotWidth,height:a.plotHeight}),c.animate({translateX:p(d&&d.left,a.plotLeft),translateY:p(e&&e.top,a.plotTop)}));this.translate();this.setTooltipPoints&&this.setTooltipPoints(!0);this.render();b&&I(this,"updatedData")}};Gb.prototype={destroy:function(){Pa(this,this.axis)},
 render:function(a){var b=this.options,c=b.format,c=c?Ja(c,this):b.formatter.call(this);this.label?this.label.attr({text:c,visibility:"hidden"}):this.label=this.axis.chart.renderer.text(c,null,null,b.useHTML).css(b.style).attr({align:this.textAlign,rotation:b.rotation,visibility:"hidden"}).add(a)},setOffset:function(a,b){var c=this.axis,d=c.chart,e=d.inverted,f=this.isNegative,g=c.translate(c.usePercentage?100:this.total,0,0,0,1),c=c.translate(0),c=Q(g-c),h=d.xAxis[0].translate(this.x)+a,i=d.plotHeight,
-f={x:e?f?g:g-c:h,y:e?i-h-b:f?i-g-c:i-g,width:e?c:b,height:e?b:c};if(e=this.label)e.align(this.alignOptions,null,f),f=e.alignAttr,e[this.options.crop===!1||d.isInsidePlot(f.x,f.y)?"show":"h)***^***",
-R"***^***(ide"](!0)}};na.prototype.buildStacks=function(){var a=this.series,b=p(this.options.reversedStacks,!0),c=a.length;if(!this.isXAxis){for(this.usePercentage=!1;c--;)a[b?c:a.length-c-1].setStackedPoints();if(this.usePercentage)for(c=0;c<a.length;c++)a[c].setPercentStacks()}};na.prototype.renderStackTotals=function(){var a=
+f={x:e?f?g:g-c:h,y:e?i-h-b:f?i-g-c:i-g,width:e?c:b,height:e?b:c};if(e=this.label)e.align(this.alignOptions,null,f),f=e.alignAttr,e[this.options.crop===!1||d.isInsidePlot(f.x,f.y)?"show":"hide")***^***",
+R"***^***(](!0)}};na.prototype.buildStacks=function(){var a=this.series,b=p(this.options.reversedStacks,!0),c=a.length;if(!this.isXAxis){for(this.usePercentage=!1;c--;)a[b?c:a.length-c-1].setStackedPoints();if(this.usePercentage)for(c=0;c<a.length;c++)a[c].setPercentStacks()}};na.prototype.renderStackTotals=function(){var a=
 this.chart,b=a.renderer,c=this.stacks,d,e,f=this.stackTotalGroup;if(!f)this.stackTotalGroup=f=b.g("stack-labels").attr({visibility:"visible",zIndex:6}).add();f.translate(a.plotLeft,a.plotTop);for(d in c)for(e in a=c[d],a)a[e].render(f)};O.prototype.setStackedPoints=function(){if(this.options.stacking&&!(this.visible!==!0&&this.chart.options.chart.ignoreHiddenSeries!==!1)){var a=this.processedXData,b=this.processedYData,c=[],d=b.length,e=this.options,f=e.threshold,g=e.stack,e=e.stacking,h=this.stackKey,
 i="-"+h,j=this.negStacks,k=this.yAxis,l=k.stacks,n=k.oldStacks,m,o,p,q,r,s;for(q=0;q<d;q++){r=a[q];s=b[q];p=this.index+","+q;o=(m=j&&s<f)?i:h;l[o]||(l[o]={});if(!l[o][r])n[o]&&n[o][r]?(l[o][r]=n[o][r],l[o][r].total=null):l[o][r]=new Gb(k,k.options.stackLabels,m,r,g);o=l[o][r];o.points[p]=[o.cum||0];e==="percent"?(m=m?h:i,j&&l[m]&&l[m][r]?(m=l[m][r],o.total=m.total=t(m.total,o.total)+Q(s)||0):o.total=ea(o.total+(Q(s)||0))):o.total=ea(o.total+(s||0));o.cum=(o.cum||0)+(s||0);o.points[p].push(o.cum);
 c[q]=o.cum}if(e==="percent")k.usePercentage=!0;this.stackedYData=c;k.oldStacks={}}};O.prototype.setPercentStacks=function(){var a=this,b=a.stackKey,c=a.yAxis.stacks,d=a.processedXData;q([b,"-"+b],function(b){var e;for(var f=d.length,g,h;f--;)if(g=d[f],e=(h=c[b]&&c[b][g])&&h.points[a.index+","+f],g=e)h=h.total?100/h.total:0,g[0]=ea(g[0]*h),g[1]=ea(g[1]*h),a.stackedYData[f]=g[1]})};r(Ya.prototype,{addSeries:function(a,b,c){var d,e=this;a&&(b=p(b,!0),I(e,"addSeries",{options:a},function(){d=e.initSeries(a);
@@ -2586,8 +6214,8 @@ getPointSpline:function(a,b,c){var d=b.plotX,e=b.plotY,f=a[c-1],g=a[c+1],h,i,j,k
 ia;ca.areaspline=w(ca.area);qa=qa.prototype;ia=ma(ia,{type:"areaspline",closedStacks:!0,getSegmentPath:qa.getSegmentPath,closeSegment:qa.closeSegment,drawGraph:qa.drawGraph,drawLegendSymbol:M.drawRectangle});H.areaspline=ia;ca.column=w(T,{borderColor:"#FFFFFF",borderRadius:0,groupPadding:0.2,marker:null,pointPadding:0.1,minPointLength:0,cropThreshold:50,pointRange:null,states:{hover:{brightness:0.1,shadow:!1,halo:!1},select:{color:"#C0C0C0",borderColor:"#000000",shadow:!1}},dataLabels:{align:null,
 verticalAlign:null,y:null},stickyTracking:!1,tooltip:{distance:6},threshold:0});ia=ma(O,{type:"column",pointAttrToOptions:{stroke:"borderColor",fill:"color",r:"borderRadius"},cropShoulder:0,trackerGroups:["group","dataLabelsGroup"],negStacks:!0,init:function(){O.prototype.init.apply(this,arguments);var a=this,b=a.chart;b.hasRendered&&q(b.series,function(b){if(b.type===a.type)b.isDirty=!0})},getColumnMetrics:function(){var a=this,b=a.options,c=a.xAxis,d=a.yAxis,e=c.reversed,f,g={},h,i=0;b.grouping===
 !1?i=1:q(a.chart.series,function(b){var c=b.options,e=b.yAxis;if(b.type===a.type&&b.visible&&d.len===e.len&&d.pos===e.pos)c.stacking?(f=b.stackKey,g[f]===u&&(g[f]=i++),h=g[f]):c.grouping!==!1&&(h=i++),b.columnIndex=h});var c=L(Q(c.transA)*(c.ordinalSlope||b.pointRange||c.closestPointRange||c.tickInterval||1),c.len),j=c*b.groupPadding,k=(c-2*j)/i,l=b.pointWidth,b=s(l)?(k-l)/2:k*b.pointPadding,l=p(l,k-2*b);return a.columnMetrics={width:l,offset:b+(j+((e?i-(a.columnIndex||0):a.columnIndex)||0)*k-c/2)*
-(e?-1:1)}},translate:function(){var a=this,b=a.chart,c=a.options,d=a.borderWidth=p(c.borderWidth,a.activePointCount>0.5*a.xAxis.len?0:1),e=a.yAxis,f=a.translatedThreshold=e.getThreshold(c.threshold),g=p(c.minPointLength,5),h=a.getColumnMetrics(),i=h.width,j=a.barW=t(i,1+2*d),k=a.pointXOffset=h.offset,l=-(d%2?0.5:0),n=d%2?0.5:1;b.renderer.isVML&&b.inverted&&(n+=1);c.pointPadding&&(j=La(j));O.prototype.translate.apply(a);q(a.points,function(c){var d=p(c.yBottom,f),h=L(t(-999-d,c.plotY),e.le)***^***",
-R"***^***(n+999+d),
+(e?-1:1)}},translate:function(){var a=this,b=a.chart,c=a.options,d=a.borderWidth=p(c.borderWidth,a.activePointCount>0.5*a.xAxis.len?0:1),e=a.yAxis,f=a.translatedThreshold=e.getThreshold(c.threshold),g=p(c.minPointLength,5),h=a.getColumnMetrics(),i=h.width,j=a.barW=t(i,1+2*d),k=a.pointXOffset=h.offset,l=-(d%2?0.5:0),n=d%2?0.5:1;b.renderer.isVML&&b.inverted&&(n+=1);c.pointPadding&&(j=La(j));O.prototype.translate.apply(a);q(a.points,function(c){var d=p(c.yBottom,f),h=L(t(-999-d,c.plotY),e.len+99)***^***",
+R"***^***(9+d),
 q=c.plotX+k,r=j,s=L(h,d),u;u=t(h,d)-s;Q(u)<g&&g&&(u=g,s=v(Q(s-f)>g?d-g:f-(e.translate(c.y,0,1,0,1)<=f?g:0)));c.barX=q;c.pointWidth=i;c.tooltipPos=b.inverted?[e.len-h,a.xAxis.len-q-r/2]:[q+r/2,h+e.pos-b.plotTop];r=v(q+r)+l;q=v(q)+l;r-=q;d=Q(s)<0.5;u=v(s+u)+n;s=v(s)+n;u-=s;d&&(s-=1,u+=1);c.shapeType="rect";c.shapeArgs={x:q,y:s,width:r,height:u}})},getSymbol:sa,drawLegendSymbol:M.drawRectangle,drawGraph:sa,drawPoints:function(){var a=this,b=this.chart,c=a.options,d=b.renderer,e=c.animationLimit||250,
 f,g;q(a.points,function(h){var i=h.plotY,j=h.graphic;if(i!==u&&!isNaN(i)&&h.y!==null)f=h.shapeArgs,i=s(a.borderWidth)?{"stroke-width":a.borderWidth}:{},g=h.pointAttr[h.selected?"select":""]||a.pointAttr[""],j?(bb(j),j.attr(i)[b.pointCount<e?"animate":"attr"](w(f))):h.graphic=d[h.shapeType](f).attr(g).attr(i).add(a.group).shadow(c.shadow,null,c.stacking&&!c.borderRadius);else if(j)h.graphic=j.destroy()})},animate:function(a){var b=this.yAxis,c=this.options,d=this.chart.inverted,e={};if(ba)a?(e.scaleY=
 0.001,a=L(b.pos+b.len,t(b.pos,b.toPixels(c.threshold))),d?e.translateX=a-b.len:e.translateY=a,this.group.attr(e)):(e.scaleY=1,e[d?"translateX":"translateY"]=b.pos,this.group.animate(e,this.options.animation),this.animate=null)},remove:function(){var a=this,b=a.chart;b.hasRendered&&q(b.series,function(b){if(b.type===a.type)b.isDirty=!0});O.prototype.remove.apply(a,arguments)}});H.column=ia;ca.bar=w(ca.column);qa=ma(ia,{type:"bar",inverted:!0});H.bar=qa;ca.scatter=w(T,{lineWidth:0,tooltip:{headerFormat:'<span style="color:{series.color}">â—</span> <span style="font-size: 10px;"> {series.name}</span><br/>',
@@ -2607,8 +6235,8 @@ O.prototype.alignDataLabel=function(a,b,c,d,e){var f=this.chart,g=f.inverted,h=p
 b.verticalAlign="bottom":b.y=g.plotHeight-j,k=!0;if(k)a.placed=!f,a.align(b,null,e)};if(H.pie)H.pie.prototype.drawDataLabels=function(){var a=this,b=a.data,c,d=a.chart,e=a.options.dataLabels,f=p(e.connectorPadding,10),g=p(e.connectorWidth,1),h=d.plotWidth,i=d.plotHeight,j,k,l=p(e.softConnector,!0),n=e.distance,m=a.center,o=m[2]/2,r=m[1],s=n>0,u,w,x,A=[[],[]],y,B,I,H,z,R=[0,0,0,0],N=function(a,b){return b.y-a.y};if(a.visible&&(e.enabled||a._hasPointLabels)){O.prototype.drawDataLabels.apply(a);q(b,
 function(a){a.dataLabel&&a.visible&&A[a.half].push(a)});for(H=2;H--;){var G=[],M=[],F=A[H],K=F.length,E;if(K){a.sortByAngle(F,H-0.5);for(z=b=0;!b&&F[z];)b=F[z]&&F[z].dataLabel&&(F[z].dataLabel.getBBox().height||21),z++;if(n>0){w=L(r+o+n,d.plotHeight);for(z=t(0,r-o-n);z<=w;z+=b)G.push(z);w=G.length;if(K>w){c=[].concat(F);c.sort(N);for(z=K;z--;)c[z].rank=z;for(z=K;z--;)F[z].rank>=w&&F.splice(z,1);K=F.length}for(z=0;z<K;z++){c=F[z];x=c.labelPos;c=9999;var S,P;for(P=0;P<w;P++)S=Q(G[P]-x[1]),S<c&&(c=S,
 E=P);if(E<z&&G[z]!==null)E=z;else for(w<K-z+E&&G[z]!==null&&(E=w-K+z);G[E]===null;)E++;M.push({i:E,y:G[E]});G[E]=null}M.sort(N)}for(z=0;z<K;z++){c=F[z];x=c.labelPos;u=c.dataLabel;I=c.visible===!1?"hidden":"visible";c=x[1];if(n>0){if(w=M.pop(),E=w.i,B=w.y,c>B&&G[E+1]!==null||c<B&&G[E-1]!==null)B=L(t(0,c),d.plotHeight)}else B=c;y=e.justify?m[0]+(H?-1:1)*(o+n):a.getX(B===r-o-n||B===r+o+n?c:B,H);u._attr={visibility:I,align:x[6]};u._pos={x:y+e.x+({left:f,right:-f}[x[6]]||0),y:B+e.y-10};u.connX=y;u.connY=
-B;if(this.options.size===null)w=u.width,y-w<f?R[3]=t(v(w-y+f),R[3]):y+w>h-f&&(R[1]=t(v(y+w-h+f),R[1])),B-b/2<0?R[0]=t(v(-B+b/2),R[0]):B+b/2>i&&(R[2]=t(v(B+b/2-i),R[2]))}}}if(Ca(R)===0||this.verifyDataLabelOver)***^***",
-R"***^***(flow(R))this.placeDataLabels(),s&&g&&q(this.points,function(b){j=b.connector;x=b.labelPos;if((u=b.dataLabel)&&u._pos)I=u._attr.visibility,y=u.connX,B=u.connY,k=l?["M",y+(x[6]==="left"?5:-5),B,"C",y,B,2*x[2]-x[4],2*x[3]-x[5],x[2],x[3],"L",x[4],x[5]]:["M",y+(x[6]==="left"?5:-5),B,"L",x[2],x[3],
+B;if(this.options.size===null)w=u.width,y-w<f?R[3]=t(v(w-y+f),R[3]):y+w>h-f&&(R[1]=t(v(y+w-h+f),R[1])),B-b/2<0?R[0]=t(v(-B+b/2),R[0]):B+b/2>i&&(R[2]=t(v(B+b/2-i),R[2]))}}}if(Ca(R)===0||this.verifyDataLabelOverflow(R)))***^***",
+R"***^***(this.placeDataLabels(),s&&g&&q(this.points,function(b){j=b.connector;x=b.labelPos;if((u=b.dataLabel)&&u._pos)I=u._attr.visibility,y=u.connX,B=u.connY,k=l?["M",y+(x[6]==="left"?5:-5),B,"C",y,B,2*x[2]-x[4],2*x[3]-x[5],x[2],x[3],"L",x[4],x[5]]:["M",y+(x[6]==="left"?5:-5),B,"L",x[2],x[3],
 "L",x[4],x[5]],j?(j.animate({d:k}),j.attr("visibility",I)):b.connector=j=a.chart.renderer.path(k).attr({"stroke-width":g,stroke:e.connectorColor||b.color||"#606060",visibility:I}).add(a.dataLabelsGroup);else if(j)b.connector=j.destroy()})}},H.pie.prototype.placeDataLabels=function(){q(this.points,function(a){var a=a.dataLabel,b;if(a)(b=a._pos)?(a.attr(a._attr),a[a.moved?"animate":"attr"](b),a.moved=!0):a&&a.attr({y:-999})})},H.pie.prototype.alignDataLabel=sa,H.pie.prototype.verifyDataLabelOverflow=
 function(a){var b=this.center,c=this.options,d=c.center,e=c=c.minSize||80,f;d[0]!==null?e=t(b[2]-t(a[1],a[3]),c):(e=t(b[2]-a[1]-a[3],c),b[0]+=(a[3]-a[1])/2);d[1]!==null?e=t(L(e,b[2]-t(a[0],a[2])),c):(e=t(L(e,b[2]-a[0]-a[2]),c),b[1]+=(a[0]-a[2])/2);e<b[2]?(b[2]=e,this.translate(b),q(this.points,function(a){if(a.dataLabel)a.dataLabel._pos=null}),this.drawDataLabels&&this.drawDataLabels()):f=!0;return f};if(H.column)H.column.prototype.alignDataLabel=function(a,b,c,d,e){var f=this.chart,g=f.inverted,
 h=a.dlBox||a.shapeArgs,i=a.below||a.plotY>p(this.translatedThreshold,f.plotSizeY),j=p(c.inside,!!this.options.stacking);if(h&&(d=w(h),g&&(d={x:f.plotWidth-d.y-d.height,y:f.plotHeight-d.x-d.width,width:d.height,height:d.width}),!j))g?(d.x+=i?0:d.width,d.width=0):(d.y+=i?d.height:0,d.height=0);c.align=p(c.align,!g||j?"center":i?"right":"left");c.verticalAlign=p(c.verticalAlign,g||j?"middle":i?"top":"bottom");O.prototype.alignDataLabel.call(this,a,b,c,d,e)};T=K.TrackerMixin={drawTrackerPoint:function(){var a=
@@ -2627,344 +6255,2985 @@ m.attr(r({fill:ya(this.color||e.color).setOpacity(c.opacity).get()},c.attributes
 I(this,"mouseOver");this.setState("hover");a.hoverSeries=this},onMouseOut:function(){var a=this.options,b=this.chart,c=b.tooltip,d=b.hoverPoint;if(d)d.onMouseOut();this&&a.events.mouseOut&&I(this,"mouseOut");c&&!a.stickyTracking&&(!c.shared||this.noSharedTooltip)&&c.hide();this.setState();b.hoverSeries=null},setState:function(a){var b=this.options,c=this.graph,d=this.graphNeg,e=b.states,b=b.lineWidth,a=a||"";if(this.state!==a)this.state=a,e[a]&&e[a].enabled===!1||(a&&(b=e[a].lineWidth||b+(e[a].lineWidthPlus||
 0)),c&&!c.dashstyle&&(a={"stroke-width":b},c.attr(a),d&&d.attr(a)))},setVisible:function(a,b){var c=this,d=c.chart,e=c.legendItem,f,g=d.options.chart.ignoreHiddenSeries,h=c.visible;f=(c.visible=a=c.userOptions.visible=a===u?!h:a)?"show":"hide";q(["group","dataLabelsGroup","markerGroup","tracker"],function(a){if(c[a])c[a][f]()});if(d.hoverSeries===c)c.onMouseOut();e&&d.legend.colorizeItem(c,a);c.isDirty=!0;c.options.stacking&&q(d.series,function(a){if(a.options.stacking&&a.visible)a.isDirty=!0});q(c.linkedSeries,
 function(b){b.setVisible(a,!1)});if(g)d.isDirtyBox=!0;b!==!1&&d.redraw();I(c,f)},setTooltipPoints:function(a){var b=[],c,d,e=this.xAxis,f=e&&e.getExtremes(),g=e?e.tooltipLen||e.len:this.chart.plotSizeX,h,i,j=[];if(!(this.options.enableMouseTracking===!1||this.singularTooltips)){if(a)this.tooltipPoints=null;q(this.segments||this.points,function(a){b=b.concat(a)});e&&e.reversed&&(b=b.reverse());this.orderTooltipPoints&&this.orderTooltipPoints(b);a=b.length;for(i=0;i<a;i++)if(e=b[i],c=e.x,c>=f.min&&
-c<=f.max){h=b[i+1];c=d===u?0:d+1;for(d=b[i+1]?L(t(0,U((e.clientX+(h?h.wrappedClientX||h.clientX:g))/2)),g):g;c>=0&&c<=d;)j[c++]=e}this.tooltipPoints=j}},show:function(){this.setVisible(!0)},hide:function(){this.setVisible(!1)},select:function(a){this.selected=a=a===u?!this.selected:a;if(this.checkbox)this.checkbox.checked=a;I(this,a?"select":"unselect")},drawTracker:T.drawTrackerGraph});r(K,{Axis:na,Chart:Ya,Color:ya,Point:Fa,Tick:Ta,Renderer:Za,Series:O,)***^***",
-R"***^***(SVGElement:S,SVGRenderer:ta,arrayMin:Oa,arrayMax:Ca,
+c<=f.max){h=b[i+1];c=d===u?0:d+1;for(d=b[i+1]?L(t(0,U((e.clientX+(h?h.wrappedClientX||h.clientX:g))/2)),g):g;c>=0&&c<=d;)j[c++]=e}this.tooltipPoints=j}},show:function(){this.setVisible(!0)},hide:function(){this.setVisible(!1)},select:function(a){this.selected=a=a===u?!this.selected:a;if(this.checkbox)this.checkbox.checked=a;I(this,a?"select":"unselect")},drawTracker:T.drawTrackerGraph});r(K,{Axis:na,Chart:Ya,Color:ya,Point:Fa,Tick:Ta,Renderer:Za,Series:O,SVGEleme)***^***",
+R"***^***(nt:S,SVGRenderer:ta,arrayMin:Oa,arrayMax:Ca,
 charts:W,dateFormat:cb,format:Ja,pathAnim:vb,getOptions:function(){return E},hasBidiBug:Ob,isTouchDevice:Ib,numberFormat:Ba,seriesTypes:H,setOptions:function(a){E=w(!0,E,a);Bb();return E},addEvent:N,removeEvent:X,createElement:$,discardElement:Qa,css:B,each:q,extend:r,map:Va,merge:w,pick:p,splat:ra,extendClass:ma,pInt:y,wrap:Na,svg:ba,canvas:ga,vml:!ba&&!ga,product:"Highcharts",version:"4.0.4"})})();
         </script>
 
-        <script>
-            )***^***"
-    };
+        )***^***"
+    };
+
+    static const std::string s = string_from_cstrs(pieces);
+    return s;
+  }
+}
+}
+
+#include <fstream>
+
+namespace velox {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+struct HtmlReporter : Reporter {
+  HtmlReporter(std::ostream &os)
+      : os_(os), out_(&os_), num_benchmarks(0), max_iters_(0), max_duration_(0),
+        clock_resolution_(0.0), quick_(false), files_good_(true) {}
+
+  // Splits the report for large suites: index_path gets a page listing each benchmark's mean and
+  // each benchmark's data goes in its own file next to it, named after the page with the
+  // benchmark's number, which the page only loads when the benchmark is shown.  The data files
+  // store samples as differences and thin the KDE to what can be drawn.
+  explicit HtmlReporter(const std::string &index_path)
+      : index_file_(index_path), os_(index_file_), out_(&os_), num_benchmarks(0), max_iters_(0),
+        max_duration_(0), clock_resolution_(0.0), quick_(false),
+        data_path_(without_extension(index_path)), files_good_(index_file_.is_open()) {}
+
+  HtmlReporter &operator=(const HtmlReporter &rhs) = delete;
+
+  // Whether the files of a split report have all been opened and written so far.  Check it once
+  // the suite has ended, a report which couldn't be written is otherwise silently incomplete.
+  bool good() const { return files_good_; }
+
+  void suite_starting(const std::string &clock, bool is_steady) override {
+    os_ << template_begin() << "\n";
+
+    os_ << "var clockInfo = {\n";
+    os_ << "    name : '" << js_string_escape(clock) << "',\n";
+    os_ << "    steadiness : '" << (is_steady ? "steady" : "unsteady") << "',\n";
+    os_ << "};\n\n";
+
+    os_ << "var benchmarkData = {\n";
+  }
+
+  void clock_resolution_estimated(FpNs resolution) override { clock_resolution_ = resolution; }
+
+  void quick_mode_enabled() override { quick_ = true; }
+
+  void benchmark_starting(const std::string &name) override { current_benchmark_ = name; }
+
+  // A benchmark's block starts with its measurements, so neither a failed warm up nor
+  // measurements which were never warmed up here (see OfflineAnalysis) leave it unbalanced
+  void measurement_collection_starting(std::uint32_t, FpNs) override {
+    ++num_benchmarks;
+    if (split()) {
+      data_file_.open(data_file_name(data_path_));
+      files_good_ = files_good_ && data_file_.is_open();
+      data_writer_.reset(new BufferedWriter(data_file_));
+      out_ = data_writer_.get();
+      out() << "veloxBenchmarkLoaded('benchmark_" << num_benchmarks << "', {\n";
+    } else {
+      out() << "benchmark_" << num_benchmarks << " : {\n";
+    }
+    out() << "    name : '" << js_string_escape(current_benchmark_) << "',\n";
+  }
+
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    out() << "    shortMeasurements : '" << num_short << " of " << num_measurements
+          << " shorter than ";
+    format_time(out(), min_duration);
+    out() << "',\n";
+  }
+
+  void measurement_collection_ended(const Measurements &measurements,
+                                    const Times &times,
+                                    const SampleSummary &summary,
+                                    const Outliers &outliers) override {
+    assert(!measurements.empty() && !times.empty() && "Measurements are required");
+    assert(measurements.size() == times.size() && "Times should be derived from measurements");
+
+    output_summary(summary);
+    if (!quick_) {
+      output_kde(summary);
+    }
+    output_times(times, summary, outliers);
+    output_raw_measurements(measurements);
+  }
+
+  void autocorrelation_estimated(const Autocorrelation &autocorrelation) override {
+    out() << "    autocorrelation : {\n";
+    out() << "        lag1 : '";
+    format_short(out(), autocorrelation.lag1());
+    out() << "',\n";
+    out() << "        effectiveSampleSize : '"
+          << static_cast<std::uint64_t>(std::round(autocorrelation.effective_sample_size()))
+          << " of " << autocorrelation.sample_size() << "',\n";
+    out() << "        significant : " << (autocorrelation.significant() ? "true" : "false") << "\n";
+    out() << "    },\n";
+  }
+
+  void periodic_interference_estimated(const PeriodicInterference &interference) override {
+    out() << "    periodicInterference : {\n";
+    out() << "        period : '";
+    format_time(out(), interference.period());
+    out() << "',\n";
+    out() << "        varianceExplained : '";
+    format_short(out(), interference.variance_explained() * 100.0);
+    out() << "%',\n";
+    out() << "        significant : " << (interference.significant() ? "true" : "false") << "\n";
+    out() << "    },\n";
+  }
+
+  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
+    out() << "    confidence_level : '";
+    out().write_general(statistics.mean().estimate().confidence_level() * 100, 6);
+    if (statistics.analytic()) {
+      out() << "% CI, approximated analytically in quick mode',\n";
+    } else {
+      out() << "% CI from " << statistics.num_resamples() << " resamples',\n";
+    }
+    out() << "    quick : " << (statistics.analytic() ? "true" : "false") << ",\n";
+
+    const auto time = [](BufferedWriter &out, const FpNs t) { format_time(out, t); };
+    auto format_estimate =
+        [this, &time](const char *const name, const Estimate<FpNs> &e) { format(name, e, time); };
+
+    format_estimate("mean", statistics.mean().estimate());
+    format_estimate("median", statistics.median().estimate());
+    format_estimate("sd", statistics.std_dev().estimate());
+    format_estimate("mad", statistics.median_abs_dev().estimate());
+    format_estimate("lls", statistics.linear_least_squares().estimate());
+    format_estimate("slope", statistics.slope().estimate());
+    format_estimate("overhead", statistics.overhead().estimate());
+    format("r2",
+           statistics.r_squared().estimate(),
+           [](BufferedWriter &out, const double r2) { format_r2(out, r2); });
+
+    const auto &ov = statistics.outlier_variance();
+    out() << "    outlierVariance : {\n";
+    out() << "        fraction : '";
+    format_short(out(), ov.fraction() * 100.0);
+    out() << "%',\n";
+    out() << "        effect : '" << outlier_effect_name(ov.effect()) << "',\n";
+    out() << "        significant : "
+          << (ov.effect() == OutlierEffect::moderate || ov.effect() == OutlierEffect::severe
+                  ? "true"
+                  : "false") << "\n";
+    out() << "    },\n";
+
+    out() << "    flatSampling : " << (statistics.flat_sampling() ? "true" : "false") << ",\n";
+    if (!statistics.flat_sampling()) {
+      output_regression_lines(statistics);
+    }
+
+    out() << "    custom : [";
+    const char *sep = "\n";
+    for (const auto &c : statistics.custom()) {
+      out() << sep << "        {\n";
+      out() << "            name : '" << js_string_escape(c.name()) << "',\n";
+      if (c.unit() == StatisticUnit::time) {
+        format_bounds(c.estimate(),
+                      [](BufferedWriter &out, const double v) { format_time(out, FpNs(v)); },
+                      "            ");
+      } else {
+        format_bounds(c.estimate(),
+                      [](BufferedWriter &out, const double v) { format_short(out, v); },
+                      "            ");
+      }
+      out() << "        }";
+      sep = ",\n";
+    }
+    out() << "\n    ]\n";
+
+    if (!split()) {
+      out() << "},\n";
+      return;
+    }
+
+    out() << "});\n";
+    out_ = &os_;
+    data_writer_.reset();
+    data_file_.close();
+    files_good_ = files_good_ && !data_file_.fail();
+
+    os_ << "benchmark_" << num_benchmarks << " : {\n";
+    os_ << "    name : '" << js_string_escape(current_benchmark_) << "',\n";
+    os_ << "    file : '" << js_string_escape(data_file_name(file_name(data_path_))) << "',\n";
+    os_ << "    meanEstimate : '";
+    format_time(os_, statistics.mean().estimate().point());
+    os_ << "'\n";
+    os_ << "},\n";
+  }
+
+  void load_test_starting(const std::string &name, const LoadConfig &config) override {
+    load_name_ = name;
+    load_description_.str("");
+    load_description_ << (config.arrival_process() == ArrivalProcess::fixed ? "Fixed" : "Poisson")
+                      << " arrivals from " << config.num_threads() << " thread"
+                      << (config.num_threads() == 1 ? "" : "s");
+    load_points_.clear();
+  }
+
+  void load_point_measured(const LoadPoint &point) override {
+    load_points_.push_back(LoadSummary{point.throughput(),
+                                       {point.latency(50),
+                                        point.latency(90),
+                                        point.latency(99),
+                                        point.latency(99.9),
+                                        point.max_latency()},
+                                       point.service_time(50)});
+  }
+
+  void load_test_ended() override {
+    if (load_points_.empty()) {
+      return;
+    }
+
+    static const char *const names[] = {"p50", "p90", "p99", "p99.9", "max"};
+
+    auto max_latency = FpNs(0);
+    for (const auto &p : load_points_) {
+      max_latency = (std::max)(max_latency, p.latencies[4]);
+    }
+    const auto scaler = scaler_for_time(max_latency);
+
+    BufferedWriter load_tests(load_tests_);
+    load_tests << "{\n";
+    load_tests << "    name : '" << js_string_escape(load_name_) << "',\n";
+    load_tests << "    description : '" << load_description_.str() << "',\n";
+    load_tests << "    units : '" << scaler.units() << "',\n";
+    load_tests << "    latencies : [\n";
+    const char *sep = "";
+    for (std::size_t i = 0; i < 5; ++i) {
+      load_tests << "        { name : '" << names[i] << "', data : [";
+      sep = "";
+      for (const auto &p : load_points_) {
+        load_tests << sep << "[" << p.throughput << ", " << scaler.scale(p.latencies[i]) << "]";
+        sep = ", ";
+      }
+      load_tests << "] }" << (i + 1 < 5 ? ",\n" : "\n");
+    }
+    load_tests << "    ],\n";
+
+    load_tests << "    service : [";
+    sep = "";
+    for (const auto &p : load_points_) {
+      load_tests << sep << "[" << p.throughput << ", " << scaler.scale(p.service) << "]";
+      sep = ", ";
+    }
+    load_tests << "]\n";
+    load_tests << "},\n";
+  }
+
+  void suite_ended() override {
+    os_ << "};\n";
+
+    os_ << "var loadTests = [\n" << load_tests_.str() << "];\n";
+
+    if (clock_resolution_.count() > 0.0) {
+      os_ << "clockInfo.resolution = '";
+      format_time(os_, clock_resolution_);
+      os_ << "';\n";
+    }
+
+    os_ << template_end() << "\n";
+    os_.flush();
+    if (split()) {
+      index_file_.flush();
+      files_good_ = files_good_ && !index_file_.fail();
+    }
+  }
+
+private:
+  // The precision of the times in the data files of a split report
+  static const int SIGNIFICANT_DIGITS = 6;
+
+  BufferedWriter &out() { return *out_; }
+
+  bool split() const { return !data_path_.empty(); }
+
+  std::string data_file_name(const std::string &path) const {
+    return path + "_" + std::to_string(num_benchmarks) + ".js";
+  }
+
+  static std::string::size_type file_name_start(const std::string &path) {
+    const auto separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? 0 : separator + 1;
+  }
+
+  static std::string file_name(const std::string &path) {
+    return path.substr(file_name_start(path));
+  }
+
+  static std::string without_extension(const std::string &path) {
+    const auto dot = path.find_last_of('.');
+    return dot == std::string::npos || dot < file_name_start(path) ? path : path.substr(0, dot);
+  }
+
+  template <class E, class F>
+  void format(const char *const name, const E &e, F &&f) {
+    out() << "    " << name << " : {\n";
+    format_bounds(e, f, "        ");
+    out() << "    },\n";
+  }
+
+  template <class E, class F>
+  void format_bounds(const E &e, F &&f, const char *const indent) {
+    out() << indent << "lowerBound : '";
+    f(out(), e.lower_bound());
+    out() << "',\n";
+
+    out() << indent << "estimate : '";
+    f(out(), e.point());
+    out() << " &plusmn; ";
+    f(out(), e.standard_error());
+    out() << "',\n";
+
+    out() << indent << "upperBound : '";
+    f(out(), e.upper_bound());
+    out() << "'\n";
+  }
+
+  void output_summary(const SampleSummary &summary) {
+    out() << "    summary : {\n";
+
+    out() << "        min : '";
+    format_time(out(), summary.min());
+    out() << "',\n";
+
+    out() << "        q1 : '";
+    format_time(out(), summary.quartiles().q1());
+    out() << "',\n";
+
+    out() << "        mean : '";
+    format_time(out(), summary.mean());
+    out() << "',\n";
+
+    out() << "        median : '";
+    format_time(out(), summary.median());
+    out() << "',\n";
+
+    out() << "        q3 : '";
+    format_time(out(), summary.quartiles().q3());
+    out() << "',\n";
+
+    out() << "        max : '";
+    format_time(out(), summary.max());
+    out() << "'\n";
+
+    out() << "    },\n";
+  }
+
+  void output_kde(const SampleSummary &summary) {
+    auto points = kde(summary, DEFAULT_KDE_POINTS);
+
+    const auto max_x =
+        std::max_element(points.begin(), points.end(), [](const Point &lhs, const Point &rhs) {
+                           return lhs.x() < rhs.x();
+                         })->x();
+
+    const auto scaler = scaler_for_time(FpNs(max_x));
+    const auto recip_scale = 1 / scaler.scale();
+
+    for (auto &p : points) {
+      p = Point(p.x() * scaler.scale(), p.y() * recip_scale);
+    }
+
+    const auto min_max_y =
+        std::minmax_element(points.begin(), points.end(), [](const Point &lhs, const Point &rhs) {
+          return lhs.y() < rhs.y();
+        });
+
+    const double min_y = min_max_y.first->y(), max_y = min_max_y.second->y();
+    const double mu = scaler.scale(summary.mean());
+    const double med = scaler.scale(summary.median());
+
+    // Nothing finer than a pixel of a typical chart can be seen
+    if (split()) {
+      points = thin_points(points, (max_y - min_y) / 500.0);
+    }
+
+    out() << "    kde : {\n";
+    out() << "        units : '" << scaler.units() << "',\n";
+    out() << "        meanData : [[" << mu << ", " << min_y << "], [" << mu << ", " << max_y
+          << "]],\n";
+    out() << "        medianData : [[" << med << ", " << min_y << "], [" << med << ", " << max_y
+          << "]],\n";
+    out() << "        data : [";
+
+    const auto coordinate = [this](const double v) {
+      if (split()) {
+        out().write_general(v, SIGNIFICANT_DIGITS);
+      } else {
+        out() << v;
+      }
+    };
+
+    const char *sep = "";
+    for (const auto &p : points) {
+      out() << sep << "[";
+      coordinate(p.x());
+      out() << ",";
+      coordinate(p.y());
+      out() << "]";
+      sep = ", ";
+    }
+    out() << "]\n    },\n";
+  }
+
+  void output_times(const Times &times, const SampleSummary &summary, const Outliers &outliers) {
+    const auto scaler = scaler_for_time(summary.max());
+
+    auto format_outlier_line =
+        [&](const char *const name, const OutlierSeverity severity, const FpNs threshold) {
+      out() << "        " << name << " : [";
+      if (outliers.count(severity)) {
+        out() << "[1, " << scaler.scale(threshold) << "], ";
+        out() << "[" << times.size() << ", " << scaler.scale(threshold) << "]";
+      }
+      out() << "],\n";
+    };
+
+    out() << "    samples : {\n";
+    out() << "        units : '" << scaler.units() << "',\n";
+    format_outlier_line(
+        "highSevereData", OutlierSeverity::high_severe, outliers.thresholds().high_severe());
+    format_outlier_line(
+        "highMildData", OutlierSeverity::high_mild, outliers.thresholds().high_mild());
+    format_outlier_line("lowMildData", OutlierSeverity::low_mild, outliers.thresholds().low_mild());
+    format_outlier_line(
+        "lowSevereData", OutlierSeverity::low_severe, outliers.thresholds().low_severe());
+
+    // One digit per sample, the OutlierSeverity of each point
+    out() << "        severities : '";
+    for (const auto severity : outliers.severities()) {
+      out() << static_cast<char>('0' + static_cast<int>(severity));
+    }
+    out() << "',\n";
+
+    if (split()) {
+      const auto decimals =
+          decimals_for_significant_digits(scaler.scale(summary.max()), SIGNIFICANT_DIGITS);
+      out() << "        decimals : " << decimals << ",\n";
+      out() << "        deltas : ";
+      write_deltas(out(), times, decimals, [&](const FpNs t) { return scaler.scale(t); });
+      out() << "\n    },\n";
+      return;
+    }
+
+    out() << "        data : [";
+
+    const char *sep = "";
+    for (std::size_t i = 0; i < times.size(); ++i) {
+      out() << sep << "[" << i + 1 << "," << scaler.scale(times[i]) << "]";
+      sep = ", ";
+    }
+    out() << "]\n    },\n";
+  }
+
+  void output_raw_measurements(const Measurements &measurements) {
+    // Measurements aren't necessarily taken in increasing order of iterations
+    max_iters_ = 0;
+    max_duration_ = Ns(0);
+    for (const auto &m : measurements) {
+      max_iters_ = (std::max)(max_iters_, m.iters());
+      max_duration_ = (std::max)(max_duration_, m.duration());
+    }
+    const auto scaler = scaler_for_time(max_duration_);
+
+    out() << "    rawMeasurements : {\n";
+    out() << "        units : '" << scaler.units() << "',\n";
+    if (split()) {
+      const auto decimals =
+          decimals_for_significant_digits(scaler.scale(max_duration_), SIGNIFICANT_DIGITS);
+      out() << "        decimals : " << decimals << ",\n";
+      out() << "        iterations : ";
+      write_deltas(out(), measurements, 0, [](const Measurement &m) {
+        return static_cast<double>(m.iters());
+      });
+      out() << ",\n";
+      out() << "        durations : ";
+      write_deltas(out(), measurements, decimals, [&](const Measurement &m) {
+        return scaler.scale(m.duration());
+      });
+      out() << "\n    },\n";
+      return;
+    }
+
+    out() << "        data : [";
+
+    const char *sep = "";
+    for (const auto &m : measurements) {
+      out() << sep << "[" << m.iters() << "," << scaler.scale(m.duration()) << "]";
+      sep = ", ";
+    }
+    out() << "]\n    },\n";
+  }
+
+  // The fitted lines are drawn over the raw measurements, in the same units
+  void output_regression_lines(const EstimatedStatistics &statistics) {
+    const auto scaler = scaler_for_time(max_duration_);
+    const auto x = static_cast<double>(max_iters_);
+    const auto lls = statistics.linear_least_squares().estimate().point();
+    const auto slope = statistics.slope().estimate().point();
+    const auto overhead = statistics.overhead().estimate().point();
+
+    out() << "    regression : {\n";
+    out() << "        throughOrigin : [[0, 0], [" << max_iters_ << ", " << scaler.scale(lls * x)
+          << "]],\n";
+    out() << "        withOverhead : [[0, " << scaler.scale(overhead) << "], [" << max_iters_
+          << ", " << scaler.scale(overhead + slope * x) << "]]\n";
+    out() << "    },\n";
+  }
+
+private:
+  static const std::string &template_begin() {
+    static const char *const pieces[] = {
+R"***^***(
+        <script>
+            )***^***"
+    };
+
+    static const std::string s = detail::html_template_libraries() +
+                                 detail::string_from_cstrs(pieces);
+    return s;
+  }
+
+  static const std::string &template_end() {
+    static const char *const pieces[] = {
+R"***^***(
+
+            //http://bl.ocks.org/mbostock/5577023
+
+            Highcharts.setOptions({
+                colors: ['#a6cee3','#1f78b4','#b2df8a','#33a02c','#fb9a99','#e31a1c',
+                '#fdbf6f','#ff7f00','#cab2d6','#6a3d9a','#ffff99','#b15928']
+            });
+
+            $(function () {
+                 var kdeChart = new Highcharts.Chart({
+                    chart: {
+                        renderTo: 'kde',
+                        zoomType: 'xy'
+                    },
+                    title: {
+                        text: 'Kernel Density Estimate'
+                    },
+                    subtitle: {
+                        text: '<a href="https://github.com/ctrychta/velox">generated by velox</a>'
+                    },
+                    xAxis: {
+                        title: {
+                            text: 'Time'
+                        }
+                    },
+                    yAxis: {
+                        title: {
+                            text: 'Density (arb. unit)'
+                        },
+                        minPadding: 0,
+                        maxPadding: 0
+                    },
+                    tooltip: {
+                        crosshairs: true,
+                        shared: true,
+                    },
+                    series: [{
+                        type: 'spline',
+                        name: 'Probability Density',
+                        id: 'pdf',
+                        marker: {
+                            enabled:false
+                        },
+                        data: []
+                    } , {
+                        type: 'line',
+                        name: 'Mean',
+                        id: 'mean',
+                        marker: {
+                            enabled: false,
+                            states: {
+                                hover: {
+                                    enabled: false
+                                }
+                            }
+                        },
+                        data: []
+                    } , {
+                        type: 'line',
+                        name: 'Median',
+                        id: 'median',
+                        marker: {
+                            enabled:false,
+                            states: {
+                                hover: {
+                                    enabled: false
+                                }
+                            }
+                        },
+                        data: []
+                    }]
+                });
+
+                var samplesChart = new Highcharts.Chart({
+                    chart: {
+                        renderTo: 'samples',
+                        zoomType: 'xy'
+                    },
+                    title: {
+                        text: 'Samples'
+                    },
+                    subtitle: {
+                        text: '<a href="https://github.com/ctrychta/velox">generated by velox</a>'
+                    },
+                    yAxis: {
+                        title: {
+                            text: 'Time'
+                        }
+                    },
+                    series: [{
+                        type: 'scatter',
+                        name: 'Sample',
+                        id: 'sample',
+                        marker: {
+                            enabled:true
+                        },
+                        color: '#a6cee3',
+                        data: []
+                    } , {
+                        type: 'line',
+                        name: 'Q3 + 3 * IQR',
+                        id: 'highSevere',
+                        marker: {
+                            enabled: false,
+                            states: {
+                                hover: {
+                                    enabled: false
+                                }
+                            }
+                        },
+                        color: '#ff7f00',
+                        data: []
+                    } , {
+                        type: 'line',
+                        name: 'Q3 + 1.5 * IQR',
+                        id: 'highMild',
+                        marker: {
+                            enabled: false,
+                            states: {
+                                hover: {
+                                    enabled: false
+                                }
+                            }
+                        },
+                        color: '#fdbf6f',
+                        data: []
+                    } , {
+                        type: 'line',
+                        name: 'Q1 - 1.5 * IQR',
+                        id: 'lowMild',
+                        marker: {
+                            enabled: false,
+                            states: {
+                                hover: {
+                                    enabled: false
+                                }
+                            }
+                        },
+                        color: '#cab2d6',
+                        data: []
+                    } , {
+                        type: 'line',
+                        name: 'Q1 - 3 * IQR',
+                        id: 'lowSevere',
+                        marker: {
+                            enabled: false,
+                            states: {
+                                hover: {
+                                    enabled: false
+                                }
+                            }
+                        },
+                        color: '#6a3d9a',
+                        data: []
+                    }]
+                });
+
+                var rawMeasurementsChart = new Highcharts.Chart({
+                    chart: {
+                        renderTo: 'raw-measurements',
+                        zoomType: 'xy'
+                    },
+                    title: {
+                        text: 'Raw Measurements'
+                    },
+                    subtitle: {
+                        text: '<a href="https://github.com/ctrychta/velox">generated by velox</a>'
+                    },
+                     xAxis: {
+                        title: {
+                            text: 'Iterations'
+                        }
+                    },
+                    yAxis: {
+                        title: {
+                            text: 'Time'
+                        },
+                        minPadding: 0,
+                        maxPadding: 0
+                    },
+                    series: [{
+                        type: 'scatter',
+                        name: 'Measurement',
+                        id: 'measurement',
+                        marker: {
+                            enabled:true
+                        },
+                        color: '#a6cee3',
+                        data: []
+                    } , {
+                        type: 'line',
+                        name: 'Regression',
+                        id: 'regression',
+                        marker: {
+                            enabled: false,
+                            states: {
+                                hover: {
+                                    enabled: false
+                                }
+                            }
+                        },
+                        enableMouseTracking: false,
+                        color: '#e31a1c',
+                        data: []
+                    } , {
+                        type: 'line',
+                        name: 'Regression with overhead',
+                        id: 'fit',
+                        marker: {
+                            enabled: false,
+                            states: {
+                                hover: {
+                                    enabled: false
+                                }
+                            }
+                        },
+                        enableMouseTracking: false,
+                        dashStyle: 'ShortDash',
+                        color: '#33a02c',
+                        data: []
+                    }]
+                });
+
+                function updateData(id) {
+                    $("#benchmarks .current").removeClass("current");
+                    $('#' + id).parent().addClass("current");
+
+                    var benchData = benchmarkData[id];
+
+                    $('#benchmark-name').text(benchData.name);
+
+                    // Set sample summary
+
+                    var idToSummaryValue = {
+                        '#sample-min' : 'min',
+                        '#sample-q1' : 'q1',
+                        '#sample-mean' : 'mean',
+                        '#sample-median' : 'median',
+                        '#sample-q3' : 'q3',
+                        '#sample-max' : 'max'
+                    };
+
+                    for (var id in idToSummaryValue) {
+                        if (!idToSummaryValue.hasOwnProperty(id)) {
+                            continue;
+                        }
+
+                        $(id).html(benchData.summary[idToSummaryValue[id]]);
+                    }
+
+                    var autocorrelation = benchData.autocorrelation || { lag1 : '', effectiveSampleSize : '', significant : false };
+                    $('#sample-lag1').html(autocorrelation.lag1).toggleClass('significant', autocorrelation.significant);
+                    $('#sample-ess').html(autocorrelation.effectiveSampleSize).toggleClass('significant', autocorrelation.significant);
+                    $('#sample-short').html(benchData.shortMeasurements || 'none').toggleClass('significant', !!benchData.shortMeasurements);
+                    var periodic = benchData.periodicInterference || { period : '', varianceExplained : '', significant : false };
+                    $('#sample-periodic').html(periodic.significant ? 'every ' + periodic.period + ' (' + )***^***",
+R"***^***(periodic.varianceExplained + ')' : 'none').toggleClass('significant', periodic.significant);
+
+                    var outlierVariance = benchData.outlierVariance || { fraction : '', effect : '', significant : false };
+                    $('#sample-outlier-variance').html(outlierVariance.fraction + (outlierVariance.effect ? ' (' + outlierVariance.effect + ')' : '')).toggleClass('significant', outlierVariance.significant);
+
+                    // Set bootstrapped statistics
+                    $('#lb-title').prop('title', benchData['confidence_level']);
+                    $('#ub-title').prop('title', benchData['confidence_level']);
+                    $('#analyzed-caption').text(benchData.quick ? 'Approximate Statistics (quick mode)' : 'Bootstrapped Statistics');
+
+                    var stats = ['mean', 'median', 'sd', 'mad', 'lls', 'slope', 'overhead', 'r2'];
+                    for (var i = 0; i < stats.length; ++i) {
+                        var stat = stats[i];
+                        $('#' + stat + '-lb').html(benchData[stat].lowerBound);
+                        $('#' + stat + '-estimate').html(benchData[stat].estimate);
+                        $('#' + stat + '-up').html(benchData[stat].upperBound);
+                    }
+
+                    // The regression statistics are meaningless when every measurement has the same number of iterations
+                    var regressionStats = ['lls', 'slope', 'overhead', 'r2'];
+                    for (var i = 0; i < regressionStats.length; ++i) {
+                        $('#' + regressionStats[i] + '-estimate').parent().toggle(!benchData.flatSampling);
+                    }
+
+                    // Statistics added with VeloxConfig::add_statistic
+                    $('#analyzed-stats tr.custom-stat').remove();
+                    var custom = benchData.custom || [];
+                    for (var i = 0; i < custom.length; ++i) {
+                        $('<tr class="custom-stat">')
+                            .append($('<td>').text(custom[i].name))
+                            .append($('<td>').html(custom[i].lowerBound))
+                            .append($('<td>').html(custom[i].estimate))
+                            .append($('<td>').html(custom[i].upperBound))
+                            .appendTo('#analyzed-stats tbody');
+                    }
+
+                    // Set chart data
+                    function setSeries(series, data) {
+                        series.setData(data.slice(0), false, false, false);
+                    }
+
+                    // Quick mode skips the KDE
+                    var kde = benchData.kde || { units : '', data : [], meanData : [], medianData : [] };
+                    $('#kde').toggle(!!benchData.kde);
+                    setSeries(kdeChart.get('pdf'), kde.data);
+                    setSeries(kdeChart.get('mean'), kde.meanData);
+                    setSeries(kdeChart.get('median'), kde.medianData);
+                    kdeChart.redraw(false);
+
+                    // Colour each outlier like the threshold it crossed
+                    var severityColors = ['#6a3d9a', '#cab2d6', null, '#fdbf6f', '#ff7f00'];
+                    var severities = benchData.samples.severities || '';
+                    var sampleData = $.map(benchData.samples.data, function(point, i) {
+                        var color = severityColors[+(severities.charAt(i) || 2)];
+                        return color ? { x : point[0], y : point[1], color : color } : [point];
+                    });
+                    samplesChart.get('sample').setData(sampleData, false, false, false);
+                    setSeries(samplesChart.get('highSevere'), benchData.samples.highSevereData);
+                    setSeries(samplesChart.get('highMild'), benchData.samples.highMildData);
+                    setSeries(samplesChart.get('lowMild'), benchData.samples.lowMildData);
+                    setSeries(samplesChart.get('lowSevere'), benchData.samples.lowSevereData);
+                    samplesChart.redraw(false);
+
+                    setSeries(rawMeasurementsChart.get('measurement'), benchData.rawMeasurements.data);
+                    var regression = benchData.regression || { throughOrigin : benchData.rawMeasurements.regression || [], withOverhead : [] };
+                    setSeries(rawMeasurementsChart.get('regression'), regression.throughOrigin);
+                    setSeries(rawMeasurementsChart.get('fit'), regression.withOverhead);
+                    rawMeasurementsChart.redraw(false);
+
+                    kdeChart.tooltip.options.formatter = function() {
+                        return 'Time: <strong>' + this.x + ' ' +
+                                kde.units + '</strong><br />Density: <strong>' + this.y + '</strong>';
+                    };
+
+                    kdeChart.xAxis[0].update({
+                        title:{
+                            text: 'Time (' + kde.units + ')'
+                        }
+                    });
+
+                    samplesChart.tooltip.options.formatter = function() {
+                        if (this.series.options.id == 'sample') {
+                            var severityNames = ['low severe outlier', 'low mild outlier', '', 'high mild outlier', 'high severe outlier'];
+                            var severity = severityNames[+((benchData.samples.severities || '').charAt(this.x - 1) || 2)];
+                            return 'Sample: <strong>' + this.x + '</strong><br />Time: <strong>'
+                                + this.y + ' ' + benchData.samples.units + '</strong>'
+                                + (severity ? '<br />' + severity : '');
+                        }
+
+                       return this.series.name + ': <strong>' + this.y + ' ' + benchData.samples.units + '</strong>';
+                    };
+
+                    samplesChart.yAxis[0].update({
+                        title:{
+                            text: 'Time (' + benchData.samples.units + ')'
+                        }
+                    });
+
+                    rawMeasurementsChart.yAxis[0].update({
+                        title:{
+                            text: 'Time (' + benchData.rawMeasurements.units + ')'
+                        }
+                    });
+
+                    rawMeasurementsChart.tooltip.options.formatter = function() {
+                        return 'Iterations: <strong>' + this.x + ' ' + '</strong><br />Time: <strong>' +
+                            this.y + ' ' + benchData.rawMeasurements.units + '</strong>';
+                    };
+                }
+
+                // Split reports keep each benchmark in its own data file which is loaded the first time it is shown
+                var shownBenchmark = null;
+
+                function decodeDeltas(deltas, decimals) {
+                    var value = 0;
+                    return $.map(deltas, function(delta) {
+                        value += delta;
+                        return decimals >= 0 ? value / Math.pow(10, decimals) : value * Math.pow(10, -decimals);
+                    });
+                }
+
+                window.veloxBenchmarkLoaded = function(id, benchData) {
+                    if (benchData.samples.deltas) {
+                        var times = decodeDeltas(benchData.samples.deltas, benchData.samples.decimals);
+                        benchData.samples.data = $.map(times, function(time, i) { return [[i + 1, time]]; });
+                    }
+
+                    var raw = benchData.rawMeasurements;
+                    if (raw.iterations) {
+                        var iterations = decodeDeltas(raw.iterations, 0);
+                        var durations = decodeDeltas(raw.durations, raw.decimals);
+                        raw.data = $.map(iterations, function(n, i) { return [[n, durations[i]]]; });
+                    }
+
+                    benchmarkData[id] = benchData;
+                    if (id === shownBenchmark) {
+                        updateData(id);
+                    }
+                };
+
+                function showBenchmark(id) {
+                    var benchData = benchmarkData[id];
+                    if (!benchData) {
+                        return;
+                    }
+
+                    shownBenchmark = id;
+                    if (!benchData.file) {
+                        updateData(id);
+                        return;
+                    }
+
+                    $("#benchmarks .current").removeClass("current");
+                    $('#' + id).parent().addClass("current");
+                    if (!benchData.loading) {
+                        benchData.loading = true;
+                        var script = document.createElement('script');
+                        script.src = benchData.file;
+                        document.body.appendChild(script);
+                    }
+                }
+
+                for (var b in benchmarkData) {
+                    var link = $('<a/>', {id: b, href: '#', text: benchmarkData[b].name});
+                    if (benchmarkData[b].meanEstimate) {
+                        $('<span class="mean-estimate"/>').text(benchmarkData[b].meanEstimate).appendTo(link);
+                    }
+
+                    $('<li/>', {
+                        html: link
+                    }).appendTo('#benchmarks');
+                }
+
+                $('#benchmarks a').click(function(e) {
+                    e.preventDefault();
+
+                    showBenchmark($(this).attr('id'));
+                });
+                      )***^***",
+R"***^***(
+                $('#clock-name').text(clockInfo.name);
+                $('#steadiness').text(clockInfo.steadiness);
+                if (clockInfo.resolution) {
+                    $('#clock-resolution').text(clockInfo.resolution);
+                    $('#clock-resolution-info').show();
+                }
+                showBenchmark('benchmark_1');
+
+                // Latency against throughput for each load test, one line per percentile
+                var percentileColors = ['#1f78b4', '#33a02c', '#ff7f00', '#e31a1c', '#6a3d9a'];
+                $.each(typeof loadTests === 'undefined' ? [] : loadTests, function(i, test) {
+                    var div = $('<div class="load-test"/>').attr('id', 'load-test-' + i).appendTo('#load-tests');
+                    var series = $.map(test.latencies, function(l, j) {
+                        return { type: 'line', name: l.name, color: percentileColors[j], data: l.data };
+                    });
+                    series.push({ type: 'line', name: 'service time p50', color: '#a6cee3', dashStyle: 'Dash', data: test.service });
+
+                    new Highcharts.Chart({
+                        chart: {
+                            renderTo: div[0],
+                            zoomType: 'xy'
+                        },
+                        title: {
+                            text: 'Load Test: ' + test.name
+                        },
+                        subtitle: {
+                            text: test.description
+                        },
+                        xAxis: {
+                            title: {
+                                text: 'Throughput (requests/s)'
+                            }
+                        },
+                        yAxis: {
+                            title: {
+                                text: 'Latency (' + test.units + ')'
+                            },
+                            min: 0
+                        },
+                        tooltip: {
+                            formatter: function() {
+                                return this.series.name + ': <strong>' + this.y + ' ' + test.units + '</strong><br />Throughput: <strong>' + this.x + ' requests/s</strong>';
+                            }
+                        },
+                        series: series
+                    });
+                });
+            });
+        </script>
+
+        <style type="text/css">
+            body {
+                min-width: 800px;
+                margin:0;
+                padding:0;
+                font-family: "Helvetica Neue", Helvetica, Arial, sans-serif;
+                background-color: #fff;
+            }
+
+            #content {
+                padding: 15px;
+            }
+
+            nav {
+                width:200px;
+                float:left;
+                background-color: #fff;
+                border-radius: 10px;
+                border:1px solid #ddd;
+                margin-bottom:15px;
+            }
+
+            #benchmarks {
+                list-style-type: none;
+                padding: 0;
+                margin:0;
+            }
+
+            #benchmarks a{
+                display:block;
+                padding: 10px 20px;
+                text-decoration: none;
+                font-size:14px;
+                border-top: 1px solid #ddd;
+                box-shadow: rgba(255, 255, 255, 0.2) 0px 0px 1px 0px inset;
+                color: #777879;
+                word-wrap: break-word;
+            }
+
+            #benchmarks li:first-child a {
+                border-top: none;
+                border-top-left-radius: 10px;
+                border-top-right-radius: 10px;
+            }
+
+            #benchmarks li:last-child a {
+                border-bottom-left-radius: 10px;
+                border-bottom-right-radius: 10px;
+            }
+
+            #benchmarks .mean-estimate {
+                display: block;
+                font-size: 12px;
+                color: #999;
+            }
+
+            #benchmarks a:hover{
+                background-color: #f5f5f5;
+            }
+
+            #benchmarks .current a {
+                background-color: #333 ;
+                color: #fff;
+            }
+
+            main {
+                margin-left: 215px;
+            }
+
+            h1 {
+                color: #222;
+                margin:15px 0;
+            }
+
+            caption {
+                font-weight:bold;
+            }
+
+            #sample-summary caption {
+                padding-bottom: 10px;
+            }
+
+            #sample-summary tr td {
+                border-top: 1px solid #D0CDCD;
+            }
+
+            #sample-summary td:nth-child(2) {
+                color: #111;
+                background-color: #F2F2F2;
+            }
+
+            #sample-summary td.significant {
+                color: #e31a1c;
+            }
+
+            #sample-summary, #analyzed-stats {
+                border-collapse: collapse;
+                float:left
+            }
+
+            #analyzed-stats {
+                margin:0 0 0 50px;
+            }
+
+            #analyzed-stats thead th,
+            #analyzed-stats tr td,
+            #sample-summary td {
+                padding: 10px 15px;
+            }
+
+            #analyzed-stats thead th{
+                color: #333;
+                font-weight:normal;
+            }
+
+            #analyzed-stats tr td {
+                border-top: 1px solid #D0CDCD;
+                color: #777;
+            }
+
+            #analyzed-stats td:first-child, #sample-summary td:first-child {
+                color: #333;
+            }
+
+            #analyzed-stats td:nth-child(3) {
+                color: #111;
+                background-color: #F2F2F2;
+            }
+
+            #separator {
+                clear: both;
+                padding-top: 15px;
+            }
+
+            #kde, #samples, #raw-measurements, .load-test {
+                min-width: 600px;
+                margin-bottom:15px;
+                border:1px solid #eee;
+                box-shadow: 0 0 3px rgba(0, 0, 0, 0.05);
+            }
+
+            #kde {
+                height:600px;
+            }
+
+            #samples, #raw-measurements {
+                height: 800px;
+            }
+
+            #info {
+                border-top: 1px solid #E4E4E4;
+                background-color: #F2F2F2;
+                padding: 10px;
+            }
+
+            #info dt {
+                font-weight:bold;
+            }
+
+            #info dd {
+                margin-bottom:5px;
+            }
+
+            #clock-info {
+                color: #9A9FA4;
+                margin-bottom: 0;
+            }
+        </style>
+
+    </head>
+    <body>
+        <div id="content">
+            <nav>
+                <ul id="benchmarks">
+                </ul>
+            </nav>
+
+            <main>
+                <h1 id="benchmark-name"> Benchmark name </h1>
+
+                <table id="sample-summary">
+                    <caption> Sample Summary</caption>
+	                <tbody>
+		                <tr>
+			                <td>min</td>
+			                <td id="sample-min"></td>
+		                </tr>
+		                <tr>
+			                <td>Q1</td>
+			                <td id="sample-q1"></td>
+		                </tr>
+		                <tr>
+			                <td>mean</td>
+			                <td id="sample-mean"></td>
+		                </tr>
+		                <tr>
+			                <td>median</td>
+			                <td id="sample-median"></td>
+		                </tr>
+		                <tr>
+			                <td>Q3</td>
+			                <td id="sample-q3"></td>
+		                </tr>
+		                <tr>
+			                <td>max</td>
+			                <td id="sample-max"></td>
+		                </tr>
+		                <tr>
+			                <td>lag 1 autocorrelation</td>
+			                <td id="sample-lag1"></td>
+		                </tr>
+		                <tr>
+			                <td>effective sample size</td>
+			                <td id="sample-ess"></td>
+		                </tr>
+		                <tr>
+			                <td>short measurements</td>
+			                <td id="sample-short"></td>
+		                </tr>
+		                <tr>
+			                <td>periodic interference</td>
+			                <td id="sample-periodic"></td>
+		                </tr>
+		                <tr>
+			                <td>outlier variance</td>
+			                <td id="sample-outlier-variance"></td>
+		                </tr>
+	                </tbody>
+                </table>
+
+                <table id="analyzed-stats">
+                  <caption id="analyzed-caption">Bootstrapped Statistics</caption>
+	                <thead>
+	                  <th></th>
+	                  <th id="lb-title">lower bound</th>
+		                <th>sample estimate</th>
+		                <th id="ub-title">upper bound</th>
+	                </thead>
+	                <tbody>
+		                <tr>
+			                <td>mean</td>
+			                <td id="mean-lb"></td>
+			                <td id="mean-estimate"></td>
+			                <td id="mean-up"></td>
+		                </tr>
+		                <tr>
+			                <td>median</td>
+			                <td id="median-lb"></td>
+			                <td id="median-estimate"></td>
+			                <td id="median-up"></td>
+		                </tr>
+		                <tr>
+			                <td>SD</td>
+			                <td id="sd-lb"></td>
+			                <td id="sd-estimate"></td>
+			                <td id="sd-up"></td>
+		                </tr>
+		                <tr>
+			                <td>MAD</td>
+			                <td id="mad-lb"></td>
+			                <td id="mad-estimate"></td>
+			                <td id="mad-up"></td>
+		                </tr>
+		                <tr>
+			                <td>LLS</td>
+			                <td id="lls-lb"></td>
+			       )***^***",
+R"***^***(         <td id="lls-estimate"></td>
+			                <td id="lls-up"></td>
+		                </tr>
+		                <tr>
+			                <td>slope</td>
+			                <td id="slope-lb"></td>
+			                <td id="slope-estimate"></td>
+			                <td id="slope-up"></td>
+		                </tr>
+		                <tr>
+			                <td>overhead</td>
+			                <td id="overhead-lb"></td>
+			                <td id="overhead-estimate"></td>
+			                <td id="overhead-up"></td>
+		                </tr>
+		                <tr>
+			                <td>r&sup2;</td>
+			                <td id="r2-lb"></td>
+			                <td id="r2-estimate"></td>
+			                <td id="r2-up"></td>
+		                </tr>
+	                </tbody>
+                </table>
+
+                <div id="separator"></div>
+
+                <div id="kde"></div>
+
+                <div id="samples"></div>
+
+                <div id="raw-measurements"></div>
+                <div id="load-tests"></div>
+            </main>
+        </div>
+        <div id="info">
+            <h3>Statistics</h3>
+            <dl>
+                <dt>Quick mode</dt>
+                <dd>
+                    With VeloxConfig::quick_mode the intervals come from formulas which assume normal, independent measurements instead of the bootstrap: a t interval for the mean, an order statistic interval for the median, a chi-squared interval for the standard deviation and t intervals from the regression residuals for LLS, slope and overhead.  MAD, r^2 and custom statistics are reported without intervals and no KDE is computed.  The results are approximate and only meant for quick comparisons while iterating on a change.
+                </dd>
+                <dt>MAD (Median Absolute Deviation)</dt>
+                <dd>
+                    The interval [median - MAD, median + MAD] contains half of the measured values.  Unlike the standard deviation the MAD is resilient to outliers.
+                </dd>
+                <dt>LLS (Least Linear Squares)</dt>
+                <dd>
+                    An estimate of the time taken to run a single iteration of the benchmarked function which is calculated using  least linear squares regression (through the origin).  This value should be more accurate then some other statistics, such as mean, since it eliminates constant factors (such as measurement overhead).
+                </dd>
+                <dt>slope/overhead</dt>
+                <dd>
+                    A regression with an intercept.  The slope is the time taken by a single iteration and the intercept (overhead) is the fixed cost of each measurement, such as reading the clock or Stopwatch setup, which LLS folds into the time per iteration.  A large overhead means LLS and the per iteration times overestimate the cost of the function.
+                </dd>
+                <dt>r&sup2;</dt>
+                <dd>
+                    A value in the interval [0, 1] which measures the accuracy of the calculated linear regression.  Any value below .99 indicates that the measurements may be suspect (perhaps other processes on the machine are influencing the benchmarks).
+                </dd>
+                <dt>Autocorrelation</dt>
+                <dd>
+                    Measurements are taken one after another so drift caused by thermal throttling, frequency scaling, background work, etc. makes neighbouring measurements correlated.  The bootstrap assumes the measurements are independent, so when the lag 1 autocorrelation is significant (shown in red) the confidence intervals are likely too narrow.  The effective sample size is roughly how many independent measurements the sample is worth.  Use a block bootstrap (VeloxConfig::resample_method) for autocorrelated measurements.  Short measurements lasted less than VeloxConfig::min_measurement_ticks ticks of the clock, so the clock's granularity may distort them.  Periodic interference is a sinusoid in the measurement start times which explains a significant share of the residuals around the fitted line, as caused by timer ticks or periodic background work.  It can line up with the increasing lengths of the linear iteration schedule and bias the slope; a shuffled or low discrepancy schedule (VeloxConfig::iteration_schedule) breaks that alignment.
+                </dd>
+                <dt>Outlier Variance</dt>
+                <dd>
+                    How much of the variance of the sample is caused by outliers rather than by the benchmarked function itself, using the model from Haskell's criterion library.  Moderate (10% or more) and severe (50% or more) effects are shown in red.  On noisy machines VeloxConfig::outlier_policy can exclude or winsorize severe outliers and VeloxConfig::regression_method can use a robust fit for LLS.
+                </dd>
+                <dt>lower/upper bound</dt>
+                <dd>
+                    Confidence intervals calculated using bootstrapping which help determine the accuracy of an estimate.  If the configured confidence_level is .95 (the default) then 95% of the estimates calculated when resampling the data were between the lower and upper bounds.  Lower and upper bounds will be close to the estimated value for high quality estimates.  You can hover over the "lower bound" or "upper bound" column titles to see the confidence level which was used.
+                </dd>
+             </dl>
+             <h3>Charts</h3>
+             <dl>
+                <dt>Kernel Density Estimate</dt>
+                <dd>
+                    Shows the probability of a particular measurement occurring. The higher the probability density line the more likely a measurement is to occur.
+                </dd>
+                <dt>Samples</dt>
+                <dd>
+                    Plots the per iteration time of each measurement (total time / number of iterations).  If any of the values are classified as outliers according to the IQR criteria the relevant lines are shown as well.
+                </dd>
+                <dt>Raw Measurements</dt>
+                <dd>
+                    The raw measurements(number of iterations and duration) which were collected when benchmarking a function.  The solid regression line is created from the calculated LLS value and the dashed line from the slope and overhead.  All points should be on or very near the regression line.  With flat sampling every measurement runs the same number of iterations so there are no regression lines and the regression statistics are hidden.
+                </dd>
+                <dt>Load Tests</dt>
+                <dd>
+                    Latency percentiles against the throughput achieved at each request rate of a load test (Velox::load).  Requests are issued open loop on a fixed or Poisson schedule and latency is measured from when each request should have started, so time spent queued behind slow requests counts (correcting for coordinated omission).  The dashed line is the median service time, measured from when requests actually started, which is all closed loop timing sees.  Latency climbing steeply while throughput stops growing marks the saturation point.
+                </dd>
+             </dl>
+             <p>You can hover over the any of the charts to see exact values and select areas to zoom in.</p>
+             <p id="clock-info">All times measured with <span id="clock-name"></span> which is <span id="steadiness"></span><span id="clock-resolution-info" style="display: none;"> with a resolution of <span id="clock-resolution"></span></span>.</p>
+        </div>
+    </body>
+</html>
+)***^***"
+    };
+
+    static const std::string s = detail::string_from_cstrs(pieces);
+    return s;
+  }
+
+  // The percentiles of one rate of a load test
+  struct LoadSummary {
+    double throughput;
+    FpNs latencies[5];
+    FpNs service;
+  };
+
+private:
+  std::ofstream index_file_;
+  BufferedWriter os_;
+  // Where the current benchmark's data is written, os_ unless the report is split
+  BufferedWriter *out_;
+  std::string current_benchmark_;
+  std::uint32_t num_benchmarks;
+  std::uint64_t max_iters_;
+  Ns max_duration_;
+  FpNs clock_resolution_;
+  bool quick_;
+  std::string load_name_;
+  std::ostringstream load_description_;
+  std::vector<LoadSummary> load_points_;
+  std::ostringstream load_tests_;
+  std::string data_path_;
+  std::ofstream data_file_;
+  std::unique_ptr<BufferedWriter> data_writer_;
+  bool files_good_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+namespace velox {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+struct MultiReporter : Reporter {
+  template <class... Rs>
+  MultiReporter(Rs &... rs) {
+    static_assert(sizeof...(rs), "At least one reporter is required");
+    unused((reporters_.push_back(&rs), 0)...);
+  }
+
+  void suite_starting(const std::string &clock, bool is_steady) override {
+    call(fp(&Reporter::suite_starting), clock, is_steady);
+  }
+
+  void estimate_clock_cost_starting() override {
+    call(fp(&Reporter::estimate_clock_cost_starting));
+  }
+
+  void estimate_clock_cost_ended(FpNs cost) override {
+    call(fp(&Reporter::estimate_clock_cost_ended), cost);
+  }
+
+  void clock_resolution_estimated(FpNs resolution) override {
+    call(fp(&Reporter::clock_resolution_estimated), resolution);
+  }
+
+  void quick_mode_enabled() override { call(fp(&Reporter::quick_mode_enabled)); }
+
+  void merge_refused(const std::string &checkpoint,
+                     const std::string &checkpoint_environment,
+                     const std::string &environment) override {
+    call(fp(&Reporter::merge_refused), checkpoint, checkpoint_environment, environment);
+  }
+
+  void warm_up_starting(Ms ms) override { call(fp(&Reporter::warm_up_starting), ms); }
+
+  void warm_up_ended(const ItersForDurationNs &wu) override {
+    call(fp(&Reporter::warm_up_ended), wu);
+  }
+
+  void warm_up_failed(const ItersForDurationNs &wu) override {
+    call(fp(&Reporter::warm_up_failed), wu);
+  }
+
+  void benchmark_starting(const std::string &name) override {
+    call(fp(&Reporter::benchmark_starting), name);
+  }
+
+  void benchmark_ended() override { call(fp(&Reporter::benchmark_ended)); }
+
+  void measurement_collection_starting(std::uint32_t num_measurements,
+                                       FpNs measurement_time) override {
+    call(fp(&Reporter::measurement_collection_starting), num_measurements, measurement_time);
+  }
+
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    call(fp(&Reporter::measurements_too_short), num_short, num_measurements, min_duration);
+  }
+
+  void measurement_collection_ended(const Measurements &measurements,
+                                    const Times &times,
+                                    const SampleSummary &summary,
+                                    const Outliers &outliers) override {
+    call(fp(&Reporter::measurement_collection_ended), measurements, times, summary, outliers);
+  }
+
+  void autocorrelation_estimated(const Autocorrelation &autocorrelation) override {
+    call(fp(&Reporter::autocorrelation_estimated), autocorrelation);
+  }
+
+  void periodic_interference_estimated(const PeriodicInterference &interference) override {
+    call(fp(&Reporter::periodic_interference_estimated), interference);
+  }
+
+  void estimate_statistics_starting(std::uint32_t num_resamples) override {
+    call(fp(&Reporter::estimate_statistics_starting), num_resamples);
+  }
+
+  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
+    call(fp(&Reporter::estimate_statistics_ended), statistics);
+  }
+
+  void load_test_starting(const std::string &name, const LoadConfig &config) override {
+    call(fp(&Reporter::load_test_starting), name, config);
+  }
+
+  void load_point_measured(const LoadPoint &point) override {
+    call(fp(&Reporter::load_point_measured), point);
+  }
+
+  void load_test_ended() override { call(fp(&Reporter::load_test_ended)); }
+
+  void suite_ended() override { call(fp(&Reporter::suite_ended)); }
+
+private:
+  template <class F>
+  struct FuncPtr {
+    FuncPtr(F f) : f_(f) {}
+
+    template <class... Args>
+    void operator()(Reporter *reporter, const Args &... args) {
+      (reporter->*f_)(args...);
+    }
+
+  private:
+    F f_;
+  };
+
+  template <class F>
+  FuncPtr<F> fp(F f) {
+    return FuncPtr<F>(f);
+  }
+
+  template <class F, class... Args>
+  void call(FuncPtr<F> f, const Args &... args) {
+    for (auto r : reporters_) {
+      f(r, args...);
+    }
+  }
+
+private:
+  std::vector<Reporter *> reporters_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+namespace velox {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// A reporter which turns each event, with copies of its arguments, into a function object so it
+// can be delivered to another reporter later or elsewhere
+struct ForwardingReporter : Reporter {
+  using Event = std::function<void(Reporter &)>;
+
+  void suite_starting(const std::string &clock, bool is_steady) override {
+    record(&Reporter::suite_starting, clock, is_steady);
+  }
+
+  void estimate_clock_cost_starting() override { record(&Reporter::estimate_clock_cost_starting); }
+
+  void estimate_clock_cost_ended(FpNs cost) override {
+    record(&Reporter::estimate_clock_cost_ended, cost);
+  }
+
+  void clock_resolution_estimated(FpNs resolution) override {
+    record(&Reporter::clock_resolution_estimated, resolution);
+  }
+
+  void quick_mode_enabled() override { record(&Reporter::quick_mode_enabled); }
+
+  void merge_refused(const std::string &checkpoint,
+                     const std::string &checkpoint_environment,
+                     const std::string &environment) override {
+    record(&Reporter::merge_refused, checkpoint, checkpoint_environment, environment);
+  }
+
+  void warm_up_starting(Ms ms) override { record(&Reporter::warm_up_starting, ms); }
+
+  void warm_up_ended(const ItersForDurationNs &wu) override {
+    record(&Reporter::warm_up_ended, wu);
+  }
+
+  void warm_up_failed(const ItersForDurationNs &wu) override {
+    record(&Reporter::warm_up_failed, wu);
+  }
+
+  void benchmark_starting(const std::string &name) override {
+    record(&Reporter::benchmark_starting, name);
+  }
+
+  void benchmark_ended() override { record(&Reporter::benchmark_ended); }
+
+  void measurement_collection_starting(std::uint32_t num_measurements,
+                                       FpNs measurement_time) override {
+    record(&Reporter::measurement_collection_starting, num_measurements, measurement_time);
+  }
+
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    record(&Reporter::measurements_too_short, num_short, num_measurements, min_duration);
+  }
+
+  void measurement_collection_ended(const Measurements &measurements,
+                                    const Times &times,
+                                    const SampleSummary &summary,
+                                    const Outliers &outliers) override {
+    record(&Reporter::measurement_collection_ended, measurements, times, summary, outliers);
+  }
+
+  void autocorrelation_estimated(const Autocorrelation &autocorrelation) override {
+    record(&Reporter::autocorrelation_estimated, autocorrelation);
+  }
+
+  void periodic_interference_estimated(const PeriodicInterference &interference) override {
+    record(&Reporter::periodic_interference_estimated, interference);
+  }
+
+  void estimate_statistics_starting(std::uint32_t num_resamples) override {
+    record(&Reporter::estimate_statistics_starting, num_resamples);
+  }
+
+  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
+    record(&Reporter::estimate_statistics_ended, statistics);
+  }
+
+  void load_test_starting(const std::string &name, const LoadConfig &config) override {
+    record(&Reporter::load_test_starting, name, config);
+  }
+
+  void load_point_measured(const LoadPoint &point) override {
+    record(&Reporter::load_point_measured, point);
+  }
+
+  void load_test_ended() override { record(&Reporter::load_test_ended); }
+
+  void suite_ended() override { record(&Reporter::suite_ended); }
+
+protected:
+  // Called with every event, which calls the same function with the same arguments on the
+  // reporter it is given
+  virtual void forward(Event &&event) = 0;
+
+private:
+  template <class... Params, class... Args>
+  void record(void (Reporter::*f)(Params...), const Args &... args) {
+    forward([f, args...](Reporter &r) { (r.*f)(args...); });
+  }
+};
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+namespace velox {
+
+// A bounded lock free queue for exactly one producer thread and one consumer thread.  The
+// capacity is rounded up to a power of two.
+template <class T>
+struct SpscQueue {
+  explicit SpscQueue(const std::size_t capacity)
+      : slots_(round_up_to_power_of_two(capacity)), mask_(slots_.size() - 1), head_(0), tail_(0) {
+    assert(capacity && "Capacity must be at least 1");
+  }
+
+  SpscQueue &operator=(const SpscQueue &rhs) = delete;
+
+  std::size_t capacity() const { return slots_.size(); }
+
+  // Producer only.  Returns false, leaving t untouched, if the queue is full.
+  bool try_push(T &&t) {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == slots_.size()) {
+      return false;
+    }
+
+    slots_[tail & mask_] = std::move(t);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer only.  Returns false if the queue is empty.
+  bool try_pop(T &t) {
+    const auto head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    auto &slot = slots_[head & mask_];
+    t = std::move(slot);
+    slot = T();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  static std::size_t round_up_to_power_of_two(const std::size_t n) {
+    std::size_t p = 1;
+    while (p < n) {
+      p *= 2;
+    }
+    return p;
+  }
+
+private:
+  // The indices are only ever incremented and are kept on separate cache lines so the producer
+  // and consumer don't contend for the line holding both
+  static const std::size_t CACHE_LINE = 64;
+
+  std::vector<T> slots_;
+  std::size_t mask_;
+  char pad0_[CACHE_LINE];
+  std::atomic<std::size_t> head_;
+  char pad1_[CACHE_LINE - sizeof(std::atomic<std::size_t>)];
+  std::atomic<std::size_t> tail_;
+  char pad2_[CACHE_LINE - sizeof(std::atomic<std::size_t>)];
+};
+}
+
+#include <deque>
+
+namespace velox {
+
+namespace {
+  const std::size_t DEFAULT_ASYNC_QUEUE_SIZE = 1024;
+}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Delivers events to another reporter on a background thread so slow output can't stall the
+// benchmarks.  Events are copied into a bounded lock free queue; if the queue is full they wait in
+// a list on the benchmarking thread instead of blocking it.  suite_ended waits for every event to
+// be delivered, so the wrapped reporter may be used once it returns.
+//
+// Events must all come from the same thread.
+struct AsyncReporter : ForwardingReporter {
+  AsyncReporter(Reporter &reporter, const std::size_t queue_size = DEFAULT_ASYNC_QUEUE_SIZE)
+      : reporter_(reporter), queue_(queue_size), done_(false) {}
+
+  AsyncReporter &operator=(const AsyncReporter &rhs) = delete;
+
+  ~AsyncReporter() { stop(); }
+
+  void suite_ended() override {
+    ForwardingReporter::suite_ended();
+    stop();
+  }
+
+protected:
+  void forward(Event &&event) override {
+    start();
+
+    drain_overflow();
+    if (!overflow_.empty() || !queue_.try_push(std::move(event))) {
+      overflow_.push_back(std::move(event));
+    }
+  }
+
+private:
+  void start() {
+    if (!consumer_.joinable()) {
+      done_.store(false, std::memory_order_relaxed);
+      consumer_ = std::thread([this] { consume(); });
+    }
+  }
+
+  // Waits for every event to be delivered
+  void stop() {
+    if (!consumer_.joinable()) {
+      return;
+    }
+
+    while (!overflow_.empty()) {
+      drain_overflow();
+      std::this_thread::yield();
+    }
+
+    done_.store(true, std::memory_order_release);
+    consumer_.join();
+  }
+
+  void drain_overflow() {
+    while (!overflow_.empty() && queue_.try_push(std::move(overflow_.front()))) {
+      overflow_.pop_front();
+    }
+  }
+
+  void consume() {
+    Event event;
+    for (;;) {
+      // Checked before popping so events pushed before done_ was set are always delivered
+      const auto done = done_.load(std::memory_order_acquire);
+
+      if (queue_.try_pop(event)) {
+        event(reporter_);
+      } else if (done) {
+        return;
+      } else {
+        // Sleeping rather than spinning keeps this thread off the cores being benchmarked
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+  }
+
+private:
+  Reporter &reporter_;
+  SpscQueue<Event> queue_;
+  std::deque<Event> overflow_;
+  std::atomic<bool> done_;
+  std::thread consumer_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+namespace velox {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Records events so they can be replayed to another reporter later
+struct RecordingReporter : ForwardingReporter {
+  std::size_t size() const { return events_.size(); }
+
+  // Sends every recorded event to reporter, in the order they were recorded
+  void replay(Reporter &reporter) const {
+    for (const auto &e : events_) {
+      e(reporter);
+    }
+  }
+
+protected:
+  void forward(Event &&event) override { events_.push_back(std::move(event)); }
+
+private:
+  std::vector<Event> events_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+namespace velox {
+
+// Holds the measurements of a suite's benchmarks until they have all been collected, so nothing
+// is analyzed while the machine should be quiet, then analyzes them all concurrently.  The events
+// of each benchmark and load test are recorded and replayed in their original order.
+struct DeferredAnalysis {
+  // Where the events of the next benchmark or load test should be reported
+  RecordingReporter &next() {
+    entries_.emplace_back();
+    return entries_.back().events;
+  }
+
+  // Queues measurements for analysis, reported after the events recorded by the last call to next
+  void analyze_later(Measurements &&measurements) {
+    assert(!entries_.empty() && "next must be called first");
+    entries_.back().measurements = std::move(measurements);
+    entries_.back().pending = true;
+  }
+
+  bool empty() const { return entries_.empty(); }
+
+  // Analyzes every queued benchmark and replays all of the recorded events to reporter
+  void run(const VeloxConfig &config, Reporter &reporter) {
+    // Each analysis bootstraps on three threads of its own
+    const auto hardware_threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    const auto num_workers =
+        (std::min)(static_cast<std::size_t>((hardware_threads + 2) / 3), entries_.size());
+
+    std::atomic<std::size_t> next_entry(0);
+    const auto worker = [&] {
+      for (auto i = next_entry++; i < entries_.size(); i = next_entry++) {
+        auto &e = entries_[i];
+        if (e.pending) {
+          analyze(e.measurements, config, e.events);
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < num_workers; ++i) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : threads) {
+      t.join();
+    }
+
+    for (const auto &e : entries_) {
+      e.events.replay(reporter);
+    }
+
+    entries_.clear();
+  }
+
+private:
+  struct Entry {
+    Entry() : pending(false) {}
+
+    RecordingReporter events;
+    Measurements measurements;
+    bool pending;
+  };
+
+private:
+  std::deque<Entry> entries_;
+};
+}
+
+#include <cerrno>
+#include <istream>
+
+namespace velox {
+
+// One run of one benchmark in a results history
+struct HistoryEntry {
+  HistoryEntry(const std::string &revision,
+               const std::string &benchmark,
+               const Estimate<FpNs> &mean,
+               const FpNs median,
+               const std::size_t sample_size,
+               Measurements raw = Measurements())
+      : revision_(revision), benchmark_(benchmark), mean_(mean), median_(median),
+        sample_size_(sample_size), raw_(std::move(raw)) {}
+
+  // The label given to HistoryReporter, such as a commit hash
+  const std::string &revision() const { return revision_; }
+
+  const std::string &benchmark() const { return benchmark_; }
+
+  const Estimate<FpNs> &mean() const { return mean_; }
+
+  FpNs median() const { return median_; }
+
+  // The number of measurements the estimates came from
+  std::size_t sample_size() const { return sample_size_; }
+
+  // The measurements themselves, empty unless the history stores raw data
+  const Measurements &raw_measurements() const { return raw_; }
+
+private:
+  std::string revision_;
+  std::string benchmark_;
+  Estimate<FpNs> mean_;
+  FpNs median_;
+  std::size_t sample_size_;
+  Measurements raw_;
+};
+
+// Every run of one benchmark in a history, in the order they were recorded
+struct BenchmarkHistory {
+  BenchmarkHistory(const std::string &benchmark) : name_(benchmark) {}
+
+  const std::string &name() const { return name_; }
+
+  const std::vector<HistoryEntry> &entries() const { return entries_; }
+
+  void add(HistoryEntry &&entry) {
+    assert(entry.benchmark() == name_ && "Entry is for a different benchmark");
+    entries_.push_back(std::move(entry));
+  }
+
+private:
+  std::string name_;
+  std::vector<HistoryEntry> entries_;
+};
+
+namespace detail {
+  // Tabs and line breaks separate the fields and entries so they are escaped inside names
+  inline void write_history_field(BufferedWriter &out, const std::string &field) {
+    for (const auto c : field) {
+      switch (c) {
+      case '\\': out << "\\\\"; break;
+      case '\t': out << "\\t"; break;
+      case '\n': out << "\\n"; break;
+      case '\r': out << "\\r"; break;
+      default: out << c; break;
+      }
+    }
+  }
+
+  // Splits a line into its tab separated fields, undoing write_history_field's escapes
+  inline std::vector<std::string> split_history_line(const std::string &line) {
+    std::vector<std::string> fields(1);
+    for (std::size_t i = 0; i < line.size(); ++i) {
+      const auto c = line[i];
+      if (c == '\t') {
+        fields.emplace_back();
+      } else if (c == '\\' && i + 1 < line.size()) {
+        const auto e = line[++i];
+        fields.back() += e == 't' ? '\t' : e == 'n' ? '\n' : e == 'r' ? '\r' : e;
+      } else {
+        fields.back() += c;
+      }
+    }
+    return fields;
+  }
+
+  inline bool parse_history_double(const std::string &s, double &d) {
+    char *end = nullptr;
+    errno = 0;
+    d = std::strtod(s.c_str(), &end);
+    return !s.empty() && *end == '\0' && errno == 0;
+  }
+
+  inline bool parse_history_integer(const char *s, const char **end, long long &n) {
+    char *e = nullptr;
+    errno = 0;
+    n = std::strtoll(s, &e, 10);
+    *end = e;
+    return e != s && errno == 0 && n >= 0;
+  }
+
+  // Raw measurements are written as "iterations:nanoseconds:start" triples separated by commas.
+  // Older histories wrote "iterations:nanoseconds" pairs, which are read with a start of 0.
+  inline bool parse_history_raw(const std::string &s, Measurements &raw) {
+    auto p = s.c_str();
+    while (*p) {
+      long long iters = 0, duration = 0, start = 0;
+      if (!parse_history_integer(p, &p, iters) || *p++ != ':' ||
+          !parse_history_integer(p, &p, duration) ||
+          (*p == ':' && !parse_history_integer(++p, &p, start)) || (*p && *p++ != ',')) {
+        return false;
+      }
+      raw.emplace_back(static_cast<std::uint64_t>(iters), Ns(duration), Ns(start));
+    }
+    return true;
+  }
+
+  inline void write_history_raw(BufferedWriter &out, const Measurements &raw) {
+    const char *sep = "";
+    for (const auto &m : raw) {
+      out << sep << m.iters() << ':' << m.duration().count() << ':' << m.start().count();
+      sep = ",";
+    }
+  }
+
+  // Appends the entry in fields[first, end) to entries if it is well formed
+  inline bool read_history_entry(const std::vector<std::string> &fields,
+                                 const std::size_t first,
+                                 std::vector<HistoryEntry> &entries) {
+    const auto num_fields = fields.size() - (std::min)(first, fields.size());
+    if (num_fields != 9 && num_fields != 10) {
+      return false;
+    }
+
+    const auto field = [&](const std::size_t i) -> const std::string & {
+      return fields[first + i];
+    };
+
+    double mean = 0.0, lb = 0.0, ub = 0.0, se = 0.0, cl = 0.0, median = 0.0;
+    long long size = 0;
+    const char *size_end = nullptr;
+    if (!parse_history_double(field(2), mean) || !parse_history_double(field(3), lb) ||
+        !parse_history_double(field(4), ub) || !parse_history_double(field(5), se) ||
+        !parse_history_double(field(6), cl) || !parse_history_double(field(7), median) ||
+        !parse_history_integer(field(8).c_str(), &size_end, size) || *size_end != '\0' ||
+        !(cl > 0.0 && cl < 1.0)) {
+      return false;
+    }
+
+    Measurements raw;
+    if (num_fields == 10 && !parse_history_raw(field(9), raw)) {
+      return false;
+    }
+
+    entries.emplace_back(field(0),
+                         field(1),
+                         Estimate<FpNs>(FpNs(mean), FpNs(se), FpNs(lb), FpNs(ub), cl),
+                         FpNs(median),
+                         static_cast<std::size_t>(size),
+                         std::move(raw));
+    return true;
+  }
+}
+
+// Writes an entry as one line of a history: tab separated fields of the revision, benchmark, mean
+// with its bounds, standard error and confidence level, median, sample size and, if there are
+// any, the raw measurements.  Times are in nanoseconds and read back exactly.
+inline void write_history_entry(BufferedWriter &out, const HistoryEntry &entry) {
+  detail::write_history_field(out, entry.revision());
+  out << '\t';
+  detail::write_history_field(out, entry.benchmark());
+
+  const auto &mean = entry.mean();
+  out << '\t' << mean.point().count() << '\t' << mean.lower_bound().count() << '\t'
+      << mean.upper_bound().count() << '\t' << mean.standard_error().count() << '\t'
+      << mean.confidence_level() << '\t' << entry.median().count() << '\t'
+      << entry.sample_size();
+
+  if (!entry.raw_measurements().empty()) {
+    out << '\t';
+    detail::write_history_raw(out, entry.raw_measurements());
+  }
+
+  out << '\n';
+}
+
+// Reads a history, grouping the entries by benchmark in the order each benchmark first appears.
+// Blank and malformed lines are skipped, as is a last line without a line break since it was
+// cut short by a crash.
+inline std::vector<BenchmarkHistory> read_history(std::istream &is) {
+  std::vector<BenchmarkHistory> histories;
+  std::vector<HistoryEntry> parsed;
+  std::string line;
+
+  while (std::getline(is, line) && !is.eof()) {
+    if (line.empty() || !detail::read_history_entry(detail::split_history_line(line), 0, parsed)) {
+      continue;
+    }
+
+    auto entry = std::move(parsed.back());
+    parsed.pop_back();
+
+    auto history = std::find_if(histories.begin(),
+                                histories.end(),
+                                [&](const BenchmarkHistory &h) {
+                                  return h.name() == entry.benchmark();
+                                });
+    if (history == histories.end()) {
+      histories.emplace_back(entry.benchmark());
+      history = histories.end() - 1;
+    }
+
+    history->add(std::move(entry));
+  }
+
+  return histories;
+}
+
+inline std::vector<BenchmarkHistory> read_history(const std::string &path) {
+  std::ifstream file(path);
+  return read_history(file);
+}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Appends the mean and median of every benchmark to a history file, labelled with a revision such
+// as a commit hash, so runs of many revisions can be compared with write_trend_report.  The file
+// is only ever appended to.  With store_raw the measurements are kept as well, which makes the
+// history much larger.
+struct HistoryReporter : Reporter {
+  HistoryReporter(const std::string &path, const std::string &revision, bool store_raw = false)
+      : file_(path, std::ios::app), out_(file_), revision_(revision), store_raw_(store_raw),
+        sample_size_(0) {}
+
+  HistoryReporter &operator=(const HistoryReporter &rhs) = delete;
+
+  void benchmark_starting(const std::string &name) override { benchmark_ = name; }
+
+  void measurement_collection_ended(const Measurements &measurements,
+                                    const Times &times,
+                                    const SampleSummary &summary,
+                                    const Outliers &outliers) override {
+    unused(summary, outliers);
+
+    sample_size_ = times.size();
+    if (store_raw_) {
+      measurements_ = measurements;
+    }
+  }
+
+  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
+    write_history_entry(out_,
+                        HistoryEntry(revision_,
+                                     benchmark_,
+                                     statistics.mean().estimate(),
+                                     statistics.median().estimate().point(),
+                                     sample_size_,
+                                     std::move(measurements_)));
+    measurements_.clear();
+  }
+
+  // Each benchmark's entry is written as soon as it ends so a crash loses at most the benchmark
+  // which was running
+  void benchmark_ended() override {
+    out_.flush();
+    file_.flush();
+  }
+
+  void suite_ended() override { benchmark_ended(); }
+
+private:
+  std::ofstream file_;
+  BufferedWriter out_;
+  std::string revision_;
+  bool store_raw_;
+  std::string benchmark_;
+  std::size_t sample_size_;
+  Measurements measurements_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+#include <map>
 
-    static const std::string s = string_from_cstrs(pieces);
-    return s;
+namespace velox {
+
+// A finished benchmark from a checkpoint file: what was reported while measuring it, its
+// measurements and the estimates of its mean and median
+struct CheckpointEntry {
+  CheckpointEntry(const ItersForDurationNs &warm_up,
+                  const FpNs estimated_time,
+                  const FpNs min_duration,
+                  HistoryEntry &&result)
+      : warm_up_(warm_up), estimated_time_(estimated_time), min_duration_(min_duration),
+        result_(std::move(result)) {}
+
+  const std::string &name() const { return result_.benchmark(); }
+
+  const ItersForDurationNs &warm_up() const { return warm_up_; }
+
+  FpNs estimated_time() const { return estimated_time_; }
+
+  // The shortest a measurement could be without the clock's granularity distorting it, 0 unless
+  // some of the measurements were shorter
+  FpNs min_duration() const { return min_duration_; }
+
+  const Measurements &measurements() const { return result_.raw_measurements(); }
+
+  const HistoryEntry &result() const { return result_; }
+
+private:
+  ItersForDurationNs warm_up_;
+  FpNs estimated_time_;
+  FpNs min_duration_;
+  HistoryEntry result_;
+};
+
+// Writes an entry as one line of a checkpoint: the warm up's iterations and duration, the
+// estimated and minimum measurement times followed by the fields of a history entry with the raw
+// measurements and an empty revision
+inline void write_checkpoint_entry(BufferedWriter &out, const CheckpointEntry &entry) {
+  out << entry.warm_up().iters() << '\t' << entry.warm_up().duration().count() << '\t'
+      << entry.estimated_time().count() << '\t' << entry.min_duration().count() << '\t';
+  write_history_entry(out, entry.result());
+}
+
+// Reads the finished benchmarks of a checkpoint in the order they finished, skipping the
+// environment, malformed lines and a last line without a line break, which was cut short when
+// the suite was killed
+inline std::vector<CheckpointEntry> read_checkpoint(std::istream &is) {
+  std::vector<CheckpointEntry> entries;
+  std::vector<HistoryEntry> parsed;
+  std::string line;
+
+  while (std::getline(is, line) && !is.eof()) {
+    const auto fields = detail::split_history_line(line);
+    if (fields.size() < 4 || !detail::read_history_entry(fields, 4, parsed)) {
+      continue;
+    }
+
+    auto result = std::move(parsed.back());
+    parsed.pop_back();
+
+    long long iters = 0, duration = 0;
+    const char *iters_end = nullptr, *duration_end = nullptr;
+    double estimated = 0.0, min_duration = 0.0;
+    if (result.raw_measurements().empty() ||
+        !detail::parse_history_integer(fields[0].c_str(), &iters_end, iters) || *iters_end ||
+        !detail::parse_history_integer(fields[1].c_str(), &duration_end, duration) ||
+        *duration_end || !detail::parse_history_double(fields[2], estimated) ||
+        !detail::parse_history_double(fields[3], min_duration)) {
+      continue;
+    }
+
+    entries.emplace_back(ItersForDurationNs(static_cast<std::uint64_t>(iters), Ns(duration)),
+                         FpNs(estimated),
+                         FpNs(min_duration),
+                         std::move(result));
   }
 
-  static const std::string &template_end() {
-    static const char *const pieces[] = {
-R"***^***(
+  return entries;
+}
 
-            //http://bl.ocks.org/mbostock/5577023
+inline std::vector<CheckpointEntry> read_checkpoint(const std::string &path) {
+  std::ifstream file(path);
+  return read_checkpoint(file);
+}
 
-            Highcharts.setOptions({
-                colors: ['#a6cee3','#1f78b4','#b2df8a','#33a02c','#fb9a99','#e31a1c',
-                '#fdbf6f','#ff7f00','#cab2d6','#6a3d9a','#ffff99','#b15928']
-            });
+namespace {
+  const char *const ENVIRONMENT_LINE = "#environment";
+}
 
-            $(function () {
-                 var kdeChart = new Highcharts.Chart({
-                    chart: {
-                        renderTo: 'kde',
-                        zoomType: 'xy'
-                    },
-                    title: {
-                        text: 'Kernel Density Estimate'
-                    },
-                    subtitle: {
-                        text: '<a href="https://github.com/ctrychta/velox">generated by velox</a>'
-                    },
-                    xAxis: {
-                        title: {
-                            text: 'Time'
-                        }
-                    },
-                    yAxis: {
-                        title: {
-                            text: 'Density (arb. unit)'
-                        },
-                        minPadding: 0,
-                        maxPadding: 0
-                    },
-                    tooltip: {
-                        crosshairs: true,
-                        shared: true,
-                    },
-                    series: [{
-                        type: 'spline',
-                        name: 'Probability Density',
-                        id: 'pdf',
-                        marker: {
-                            enabled:false
-                        },
-                        data: []
-                    } , {
-                        type: 'line',
-                        name: 'Mean',
-                        id: 'mean',
-                        marker: {
-                            enabled: false,
-                            states: {
-                                hover: {
-                                    enabled: false
-                                }
-                            }
-                        },
-                        data: []
-                    } , {
-                        type: 'line',
-                        name: 'Median',
-                        id: 'median',
-                        marker: {
-                            enabled:false,
-                            states: {
-                                hover: {
-                                    enabled: false
-                                }
-                            }
-                        },
-                        data: []
-                    }]
-                });
+// A description of the machine and build which produced some results, which should be the same
+// for results that are compared or combined: the clock, the compiler, the size of a pointer and
+// the number of hardware threads
+inline std::string environment_fingerprint(const std::string &clock, const bool is_steady) {
+  std::ostringstream fingerprint;
+  fingerprint << "clock=" << clock << (is_steady ? " (steady)" : " (unsteady)");
+#if defined(__clang__)
+  fingerprint << "; compiler=clang " << __clang_major__ << "." << __clang_minor__;
+#elif defined(__GNUC__)
+  fingerprint << "; compiler=gcc " << __GNUC__ << "." << __GNUC_MINOR__;
+#elif defined(_MSC_VER)
+  fingerprint << "; compiler=msvc " << _MSC_FULL_VER;
+#endif
+#ifdef NDEBUG
+  fingerprint << "; assertions=off";
+#else
+  fingerprint << "; assertions=on";
+#endif
+  fingerprint << "; pointer=" << sizeof(void *) * 8 << " bits";
+  fingerprint << "; hardware threads=" << std::thread::hardware_concurrency();
+  return fingerprint.str();
+}
+
+// The environment a checkpoint was written in, empty if it doesn't start with one
+inline std::string read_checkpoint_environment(std::istream &is) {
+  std::string line;
+  if (!std::getline(is, line) || is.eof()) {
+    return std::string();
+  }
+
+  const auto fields = detail::split_history_line(line);
+  return fields.size() == 2 && fields[0] == ENVIRONMENT_LINE ? fields[1] : std::string();
+}
+
+inline std::string read_checkpoint_environment(const std::string &path) {
+  std::ifstream file(path);
+  return read_checkpoint_environment(file);
+}
+
+// Reports the events of collecting a finished benchmark's measurements again, so they can be
+// analyzed as if they were new.  The warm up isn't repeated so there are no warm up events.
+inline void replay_measurement(const CheckpointEntry &entry, Reporter &reporter) {
+  const auto &measurements = entry.measurements();
+  reporter.measurement_collection_starting(static_cast<std::uint32_t>(measurements.size()),
+                                           entry.estimated_time());
+
+  const auto num_short = count_short_measurements(measurements, entry.min_duration());
+  if (num_short) {
+    reporter.measurements_too_short(num_short, measurements.size(), entry.min_duration());
+  }
+}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Writes each benchmark to a checkpoint file as soon as its statistics have been estimated.
+// Every entry is written as a single line with one write and flushed, so a suite which is killed
+// leaves at most a partial last line, which is ignored when the checkpoint is read.
+//
+// When resuming, the benchmarks already in the file can be taken with finished.  They aren't
+// written again when their events are reported a second time.  A new file starts with the
+// environment_fingerprint of the run.
+struct CheckpointReporter : Reporter {
+  // An empty path disables the checkpoint.  The benchmarks in the merged checkpoints, such as
+  // those of the shards of a suite, can be taken with finished too and are written to this
+  // checkpoint when they are reported.
+  CheckpointReporter(const std::string &path,
+                     const bool resume,
+                     const std::vector<std::string> &merged = std::vector<std::string>())
+      : new_file_(false), warm_up_(0, Ns(0)), estimated_time_(0.0), min_duration_(0.0) {
+    for (const auto &m : merged) {
+      auto entries = read_checkpoint(m);
+      std::move(entries.begin(), entries.end(), std::back_inserter(finished_));
+    }
+
+    if (!path.empty() && resume) {
+      auto entries = read_checkpoint(path);
+      for (const auto &e : entries) {
+        ++stored_[e.name()];
+      }
+      std::move(entries.begin(), entries.end(), std::back_inserter(finished_));
+    }
+    taken_.assign(finished_.size(), false);
+
+    if (path.empty()) {
+      return;
+    }
+
+    // Starts a new line if the last run was killed in the middle of one
+    std::ifstream existing(path, std::ios::binary | std::ios::ate);
+    const auto empty = !existing || existing.tellg() <= 0;
+    const auto partial_line =
+        resume && !empty && existing.seekg(-1, std::ios::end) && existing.get() != '\n';
+    existing.close();
+
+    new_file_ = !resume || empty;
+    file_.open(path, resume ? std::ios::app : std::ios::trunc);
+    if (partial_line) {
+      file_ << '\n';
+    }
+  }
+
+  CheckpointReporter &operator=(const CheckpointReporter &rhs) = delete;
+
+  // The next finished benchmark with the given name which hasn't been taken yet, or null
+  const CheckpointEntry *finished(const std::string &name) {
+    for (std::size_t i = 0; i < finished_.size(); ++i) {
+      if (!taken_[i] && finished_[i].name() == name) {
+        taken_[i] = true;
+        return &finished_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  // A new checkpoint starts with the environment it was written in
+  void suite_starting(const std::string &clock, bool is_steady) override {
+    if (file_.is_open() && new_file_) {
+      BufferedWriter out(file_);
+      out << ENVIRONMENT_LINE << '\t';
+      detail::write_history_field(out, environment_fingerprint(clock, is_steady));
+      out << '\n';
+      out.flush();
+      file_.flush();
+    }
+  }
+
+  // A replayed benchmark has no warm up events so it keeps the warm up it was stored with
+  void benchmark_starting(const std::string &name) override {
+    name_ = name;
+    const auto stored = std::find_if(finished_.begin(),
+                                     finished_.end(),
+                                     [&](const CheckpointEntry &e) { return e.name() == name; });
+    warm_up_ = stored == finished_.end() ? ItersForDurationNs(0, Ns(0)) : stored->warm_up();
+    measurements_.clear();
+    min_duration_ = FpNs(0);
+  }
+
+  void warm_up_ended(const ItersForDurationNs &wu) override { warm_up_ = wu; }
+
+  void measurement_collection_starting(std::uint32_t num_measurements,
+                                       FpNs measurement_time) override {
+    unused(num_measurements);
+    estimated_time_ = measurement_time;
+  }
+
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    unused(num_short, num_measurements);
+    min_duration_ = min_duration;
+  }
+
+  void measurement_collection_ended(const Measurements &measurements,
+                                    const Times &times,
+                                    const SampleSummary &summary,
+                                    const Outliers &outliers) override {
+    unused(times, summary, outliers);
+    measurements_ = measurements;
+  }
+
+  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
+    if (!file_.is_open()) {
+      return;
+    }
+
+    const auto stored = stored_.find(name_);
+    if (stored != stored_.end() && stored->second) {
+      --stored->second;
+      return;
+    }
+
+    const auto sample_size = measurements_.size();
+    const CheckpointEntry entry(warm_up_,
+                                estimated_time_,
+                                min_duration_,
+                                HistoryEntry("",
+                                             name_,
+                                             statistics.mean().estimate(),
+                                             statistics.median().estimate().point(),
+                                             sample_size,
+                                             std::move(measurements_)));
+
+    std::ostringstream line;
+    {
+      BufferedWriter out(line);
+      write_checkpoint_entry(out, entry);
+    }
+
+    const auto s = line.str();
+    file_.write(s.data(), static_cast<std::streamsize>(s.size()));
+    file_.flush();
+  }
+
+private:
+  std::ofstream file_;
+  bool new_file_;
+  std::vector<CheckpointEntry> finished_;
+  std::vector<bool> taken_;
+  std::map<std::string, std::size_t> stored_;
+  std::string name_;
+  ItersForDurationNs warm_up_;
+  FpNs estimated_time_;
+  FpNs min_duration_;
+  Measurements measurements_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+namespace velox {
+
+// 64 bit FNV-1a, which gives the same value for a name on every platform and run, unlike
+// std::hash
+inline std::uint64_t stable_hash(const std::string &s) {
+  std::uint64_t h = 14695981039346656037ull;
+  for (const auto c : s) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+// Whether a benchmark is run by shard index of count.  Each benchmark is in exactly one shard,
+// chosen by its name so it doesn't depend on the order or number of the other benchmarks.
+inline bool
+in_shard(const std::string &name, const std::uint32_t index, const std::uint32_t count) {
+  assert(count > 0 && index < count && "Shard index must be less than the number of shards");
+  return stable_hash(name) % count == index;
+}
+
+// The checkpoints of the shards of a suite which were written in the given environment (see
+// environment_fingerprint).  Checkpoints without an environment, including files which don't
+// exist, never were.
+inline std::vector<std::string> shards_in_environment(const std::vector<std::string> &checkpoints,
+                                                      const std::string &environment) {
+  std::vector<std::string> matching;
+  for (const auto &c : checkpoints) {
+    if (read_checkpoint_environment(c) == environment) {
+      matching.push_back(c);
+    }
+  }
+  return matching;
+}
+}
+
+namespace velox {
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Keeps the warm up of each benchmark in a file so later runs can check it with a short warm up
+// instead of repeating the full one (see VeloxConfig::warm_up_cache).
+//
+// Every warm up it is told about is appended to the file as a line of the benchmark's name, the
+// iterations and their duration in nanoseconds.  The last line for a benchmark wins and the file
+// is rewritten without the older lines when the suite ends.
+struct WarmUpCache : Reporter {
+  // An empty path disables the cache
+  explicit WarmUpCache(const std::string &path) : path_(path) {
+    if (path_.empty()) {
+      return;
+    }
+
+    std::ifstream existing(path_);
+    std::string line;
+    while (std::getline(existing, line) && !existing.eof()) {
+      const auto fields = detail::split_history_line(line);
+      long long iters = 0, duration = 0;
+      const char *iters_end = nullptr, *duration_end = nullptr;
+      if (fields.size() == 3 &&
+          detail::parse_history_integer(fields[1].c_str(), &iters_end, iters) && !*iters_end &&
+          detail::parse_history_integer(fields[2].c_str(), &duration_end, duration) &&
+          !*duration_end) {
+        set(fields[0], ItersForDurationNs(static_cast<std::uint64_t>(iters), Ns(duration)));
+      }
+    }
+    existing.close();
+
+    file_.open(path_, std::ios::app);
+  }
+
+  WarmUpCache &operator=(const WarmUpCache &rhs) = delete;
+
+  // The stored warm up of a benchmark, or null
+  const ItersForDurationNs *find(const std::string &name) const {
+    const auto it = warm_ups_.find(name);
+    return it == warm_ups_.end() ? nullptr : &it->second;
+  }
+
+  void benchmark_starting(const std::string &name) override { name_ = name; }
+
+  void warm_up_ended(const ItersForDurationNs &wu) override {
+    if (!file_.is_open()) {
+      return;
+    }
+
+    const auto stored = find(name_);
+    if (stored && stored->iters() == wu.iters() && stored->duration() == wu.duration()) {
+      return;
+    }
+
+    set(name_, wu);
+    write(file_, name_, wu);
+    file_.flush();
+  }
+
+  // Replaces the file with one line per benchmark, written to a temporary file first so the
+  // cache is never left half written
+  void suite_ended() override {
+    if (!file_.is_open()) {
+      return;
+    }
+    file_.close();
+
+    const auto temporary = path_ + ".tmp";
+    std::ofstream compacted(temporary, std::ios::trunc);
+    for (const auto &wu : warm_ups_) {
+      write(compacted, wu.first, wu.second);
+    }
+    compacted.close();
+
+    // The old file is kept if the new one couldn't be written in full
+    if (compacted.fail() || !replace_file(temporary, path_)) {
+      std::remove(temporary.c_str());
+    }
+
+    file_.open(path_, std::ios::app);
+  }
+
+private:
+  void set(const std::string &name, const ItersForDurationNs &wu) {
+    const auto it = warm_ups_.find(name);
+    if (it == warm_ups_.end()) {
+      warm_ups_.emplace(name, wu);
+    } else {
+      it->second = wu;
+    }
+  }
+
+  // Renames from over to.  POSIX renames replace an existing file atomically but Windows
+  // refuses to, so there the old file has to be removed first.
+  static bool replace_file(const std::string &from, const std::string &to) {
+    if (std::rename(from.c_str(), to.c_str()) == 0) {
+      return true;
+    }
+#ifdef _WIN32
+    if (std::remove(to.c_str()) != 0) {
+      return false;
+    }
+
+    // The temporary file is all that's left so it's kept even if this fails
+    std::rename(from.c_str(), to.c_str());
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  static void write(std::ostream &os, const std::string &name, const ItersForDurationNs &wu) {
+    BufferedWriter out(os, DOUBLE_BUFFER_SIZE);
+    detail::write_history_field(out, name);
+    out << '\t' << wu.iters() << '\t' << wu.duration().count() << '\n';
+  }
+
+private:
+  std::string path_;
+  std::ofstream file_;
+  std::map<std::string, ItersForDurationNs> warm_ups_;
+  std::string name_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+namespace velox {
+
+namespace detail {
+  // The noise of a series which may contain a few shifts in its level: the median absolute
+  // difference of consecutive values, scaled so it estimates the standard deviation of normal
+  // noise.  Differences only straddle a shift once per changepoint so they barely move it.
+  inline double noise_variance(const std::vector<double> &series) {
+    if (series.size() < 3) {
+      return 0.0;
+    }
+
+    auto diffs = vector_with_capacity<double>(series.size() - 1);
+    for (std::size_t i = 1; i < series.size(); ++i) {
+      diffs.push_back(std::abs(series[i] - series[i - 1]));
+    }
+
+    const auto mid = diffs.begin() + static_cast<std::ptrdiff_t>(diffs.size() / 2);
+    std::nth_element(diffs.begin(), mid, diffs.end());
+
+    // The difference of two independent values has twice their variance
+    const auto sd = 1.4826 * *mid;
+    return sd * sd / 2.0;
+  }
+
+  // Replaces each value with the median of it and its neighbours, which removes single outliers
+  // but keeps the position of every shift that lasts at least two values
+  inline std::vector<double> median_of_three(const std::vector<double> &series) {
+    auto filtered = series;
+    for (std::size_t i = 1; i + 1 < series.size(); ++i) {
+      const auto a = series[i - 1], b = series[i], c = series[i + 1];
+      filtered[i] = (std::max)((std::min)(a, b), (std::min)((std::max)(a, b), c));
+    }
+    return filtered;
+  }
+}
 
-                var samplesChart = new Highcharts.Chart({
-                    chart: {
-                        renderTo: 'samples',
-                        zoomType: 'xy'
-                    },
-                    title: {
-                        text: 'Samples'
-                    },
-                    subtitle: {
-                        text: '<a href="https://github.com/ctrychta/velox">generated by velox</a>'
-                    },
-                    yAxis: {
-                        title: {
-                            text: 'Time'
-                        }
-                    },
-                    series: [{
-                        type: 'scatter',
-                        name: 'Sample',
-                        id: 'sample',
-                        marker: {
-                            enabled:true
-                        },
-                        color: '#a6cee3',
-                        data: []
-                    } , {
-                        type: 'line',
-                        name: 'Q3 + 3 * IQR',
-                        id: 'highSevere',
-                        marker: {
-                            enabled: false,
-                            states: {
-                                hover: {
-                                    enabled: false
-                                }
-                            }
-                        },
-                        color: '#ff7f00',
-                        data: []
-                    } , {
-                        type: 'line',
-                        name: 'Q3 + 1.5 * IQR',
-                        id: 'highMild',
-                        marker: {
-                            enabled: false,
-                            states: {
-                                hover: {
-                                    enabled: false
-                                }
-                            }
-                        },
-                        color: '#fdbf6f',
-                        data: []
-                    } , {
-                        type: 'line',
-                        name: 'Q1 - 1.5 * IQR',
-                        id: 'lowMild',
-                        marker: {
-                            enabled: false,
-                            states: {
-                                hover: {
-                                    enabled: false
-                                }
-                            }
-                        },
-                        color: '#cab2d6',
-                        data: []
-                    } , {
-                        type: 'line',
-                        name: 'Q1 - 3 * IQR',
-                        id: 'lowSevere',
-                        marker: {
-                            enabled: false,
-                            states: {
-                                hover: {
-                                    enabled: false
-                                }
-                            }
-                        },
-                        color: '#6a3d9a',
-                        data: []
-                    }]
-                });
+// Where the level of a series shifts, found with PELT (Killick, Fearnhead & Eckley, 2012) using
+// the cost of a change in the mean of normal noise with the given variance.  Each change must
+// lower the cost by more than the penalty and no segment is shorter than min_segment_length, so
+// a single noisy value can't become a segment of its own.
+//
+// Returns the index of the first value of each segment after the first, in increasing order.
+inline std::vector<std::size_t> detect_changepoints(const std::vector<double> &series,
+                                                    const double variance,
+                                                    const double penalty,
+                                                    const std::size_t min_segment_length = 2) {
+  assert(min_segment_length > 0 && "Segments must contain at least one value");
+  assert(penalty >= 0.0 && "Penalty must not be negative");
+
+  const auto n = series.size();
+  if (n < 2 * min_segment_length || !(variance > 0.0)) {
+    return std::vector<std::size_t>();
+  }
 
-                var rawMeasurementsChart = new Highcharts.Chart({
-                    chart: {
-                        renderTo: 'raw-measurements',
-                        zoomType: 'xy'
-                    },
-                    title: {
-                        text: 'Raw Measurements'
-                    },
-                    subtitle: {
-                        text: '<a href="https://github.com/ctrychta/velox">generated by velox</a>'
-                    },
-                     xAxis: {
-                        title: {
-                            text: 'Iterations'
-                        }
-                    },
-                    yAxis: {
-                        title: {
-                            text: 'Time'
-                        },
-                        minPadding: 0,
-                        maxPadding: 0
-                    },
-                    series: [{
-                        type: 'scatter',
-                        name: 'Measurement',
-                        id: 'measurement',
-                        marker: {
-                            enabled:true
-                        },
-                        color: '#a6cee3',
-                        data: []
-                    } , {
-                        type: 'line',
-                        name: 'Regression',
-                        id: 'regression',
-                        marker: {
-                            enabled: false,
-                            states: {
-                                hover: {
-                                    enabled: false
-                                }
-                            }
-                        },
-                        enableMouseTracking: false,
-                        color: '#e31a1c',
-                        data: []
-                    }]
-                });
+  // Prefix sums of the centred series so a segment's cost takes constant time
+  const auto centre = mean(series);
+  std::vector<double> sums(n + 1, 0.0), squares(n + 1, 0.0);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto v = series[i] - centre;
+    sums[i + 1] = sums[i] + v;
+    squares[i + 1] = squares[i] + v * v;
+  }
 
-                function updateData(id) {
-                    $("#benchmarks .current").removeClass("current");
-                    $('#' + id).parent().addClass("current");
+  const auto cost = [&](const std::size_t first, const std::size_t last) {
+    const auto s = sums[last] - sums[first];
+    const auto ss = squares[last] - squares[first] - s * s / static_cast<double>(last - first);
+    return (std::max)(ss, 0.0) / variance;
+  };
 
-                    var benchData = benchmarkData[id];
+  // best[t] is the cost of the best segmentation of the first t values and previous[t] the start
+  // of its last segment
+  std::vector<double> best(n + 1, 0.0);
+  std::vector<std::size_t> previous(n + 1, 0), candidates(1, 0);
+  best[0] = -penalty;
 
-                    $('#benchmark-name').text(benchData.name);
+  for (auto t = min_segment_length; t <= n; ++t) {
+    if (t >= 2 * min_segment_length) {
+      candidates.push_back(t - min_segment_length);
+    }
 
-                    // Set sample summary
+    auto lowest = best[candidates.front()] + cost(candidates.front(), t);
+    previous[t] = candidates.front();
+    for (const auto c : candidates) {
+      const auto f = best[c] + cost(c, t);
+      if (f < lowest) {
+        lowest = f;
+        previous[t] = c;
+      }
+    }
+    best[t] = lowest + penalty;
+
+    // A start which can't beat the best segmentation now never will
+    candidates.erase(std::remove_if(candidates.begin(),
+                                    candidates.end(),
+                                    [&](const std::size_t c) {
+                                      return best[c] + cost(c, t) > best[t];
+                                    }),
+                     candidates.end());
+  }
 
-                    var idToSummaryValue = {
-                        '#sample-min' : 'min',
-                        '#sample-q1' : 'q1',
-                        '#sample-mean' : 'mean',
-                        '#sample-median' : 'median',
-                        '#sample-q3' : 'q3',
-                        '#sample-max' : 'max'
-                    };
+  std::vector<std::size_t> changepoints;
+  for (auto t = previous[n]; t > 0; t = previous[t]) {
+    changepoints.push_back(t);
+  }
+  std::reverse(changepoints.begin(), changepoints.end());
 
-                    for (var id in idToSummaryValue) {
-                        if (!idToSummaryValue.hasOwnProperty(id)) {
-                            continue;
-                        }
+  return changepoints;
+}
 
-                        $(id).html(benchData.summary[idToSummaryValue[id]]);
-                    }
+// Changepoints with the noise estimated from the series itself and a penalty of 3 log n, which
+// keeps the number of false changepoints in a series of pure noise low.  The series is smoothed
+// with a running median first so a single outlying value isn't reported as a shift and back.
+// standard_errors, the standard errors of the values, are the fallback when the series is too
+// short or too regular to estimate its noise.
+inline std::vector<std::size_t> detect_changepoints(const std::vector<double> &series,
+                                                    const std::vector<double> &standard_errors) {
+  auto variance = detail::noise_variance(series);
 
-                    // Set bootstrapped statistics
-                    $('#lb-title').prop('title', benchData['confidence_level']);
-                    $('#ub-title').prop('title', benchData['confidence_level']);
+  if (!(variance > 0.0) && !standard_errors.empty()) {
+    double sum = 0.0;
+    for (const auto se : standard_errors) {
+      sum += se * se;
+    }
+    variance = sum / static_cast<double>(standard_errors.size());
+  }
 
-                    var stats = ['mean', 'median', 'sd', 'mad', 'lls', 'r2'];
-                    for (var i = 0; i < stats.length; ++i) {
-                        var stat = stats[i];
-                        $('#' + stat + '-lb').html(benchData[stat].lowerBound);
-                        $('#' + stat + '-estimate').html(benchData[stat].estimate);
-                        $('#' + stat + '-up').html(benchData[stat].upperBound);
-                    }
+  const auto n = static_cast<double>((std::max)(series.size(), std::size_t(2)));
+  return detect_changepoints(detail::median_of_three(series), variance, 3.0 * std::log(n));
+}
+}
 
-                    // Set chart data
-                    function setSeries(series, data) {
-                        series.setData(data.slice(0), false, false, false);
-                    }
+namespace velox {
 
-                    setSeries(kdeChart.get('pdf'), benchData.kde.data);
-                    setSeries(kdeChart.get('mean'), benchData.kde.meanData);
-                    setSeries(kdeChart.get('median'), benchData.kde.medianData);
-                    kdeChart.redraw(false);
+namespace detail {
+  inline const std::string &trend_template_begin() {
+    static const char *const pieces[] = {
+R"***^***(        <script>
+            )***^***"
+    };
 
-                    setSeries(samplesChart.get('sample'), benchData.samples.data);
-                    setSeries(samplesChart.get('highSevere'), benchData.samples.highSevereData);
-         )***^***",
-R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.highMildData);
-                    setSeries(samplesChart.get('lowMild'), benchData.samples.lowMildData);
-                    setSeries(samplesChart.get('lowSevere'), benchData.samples.lowSevereData);
-                    samplesChart.redraw(false);
+    static const std::string s = html_template_libraries() + string_from_cstrs(pieces);
+    return s;
+  }
 
-                    setSeries(rawMeasurementsChart.get('measurement'), benchData.rawMeasurements.data);
-                    setSeries(rawMeasurementsChart.get('regression'), benchData.rawMeasurements.regression);
-                    rawMeasurementsChart.redraw(false);
+  inline const std::string &trend_template_end() {
+    static const char *const pieces[] = {
+R"***^***(
 
-                    kdeChart.tooltip.options.formatter = function() {
-                        return 'Time: <strong>' + this.x + ' ' +
-                                benchData.kde.units + '</strong><br />Density: <strong>' + this.y + '</strong>';
-                    };
+            Highcharts.setOptions({
+                colors: ['#a6cee3','#1f78b4','#b2df8a','#33a02c','#fb9a99','#e31a1c',
+                '#fdbf6f','#ff7f00','#cab2d6','#6a3d9a','#ffff99','#b15928']
+            });
 
-                    kdeChart.xAxis[0].update({
-                        title:{
-                            text: 'Time (' + benchData.kde.units + ')'
-                        }
-                    });
+            $(function () {
+                document.title = 'Benchmark Trends - generated by velox';
 
-                    samplesChart.tooltip.options.formatter = function() {
-                        if (this.series.options.id == 'sample') {
-                            return 'Sample: <strong>' + this.x + '</strong><br />Time: <strong>'
-                                + this.y + ' ' + benchData.samples.units + '</strong>';
-                        }
+                var trendChart = null;
 
-                       return this.series.name + ': <strong>' + this.y + ' ' + benchData.samples.units + '</strong>';
-                    };
+                function segmentMean(values, first, last) {
+                    var sum = 0;
+                    for (var i = first; i < last; ++i) {
+                        sum += values[i];
+                    }
+                    return sum / (last - first);
+                }
 
-                    samplesChart.yAxis[0].update({
-                        title:{
-                            text: 'Time (' + benchData.samples.units + ')'
-                        }
+                function showTrend(index) {
+                    var trend = trendData[index];
+
+                    $("#benchmarks .current").removeClass("current");
+                    $('#trend_' + index).parent().addClass("current");
+                    $('#benchmark-name').text(trend.name);
+
+                    // The band is the lower bound with the width of the interval stacked on top of it
+                    var widths = $.map(trend.upper, function(upper, i) { return upper - trend.lower[i]; });
+                    var shiftColor = '#e31a1c';
+                    var plotLines = $.map(trend.changepoints, function(c) {
+                        return {
+                            value: c - 0.5,
+                            color: shiftColor,
+                            dashStyle: 'Dash',
+                            width: 2,
+                            zIndex: 5,
+                            label: { text: trend.revisions[c], style: { color: shiftColor } }
+                        };
                     });
 
-                    rawMeasurementsChart.yAxis[0].update({
-                        title:{
-                            text: 'Time (' + benchData.rawMeasurements.units + ')'
-                        }
+                    if (trendChart) {
+                        trendChart.destroy();
+                    }
+
+                    trendChart = new Highcharts.Chart({
+                        chart: {
+                            renderTo: 'trend',
+                            zoomType: 'x'
+                        },
+                        title: {
+                            text: 'Mean over Revisions'
+                        },
+                        subtitle: {
+                            text: '<a href="https://github.com/ctrychta/velox">generated by velox</a>'
+                        },
+                        xAxis: {
+                            categories: trend.revisions,
+                            title: {
+                                text: 'Revision'
+                            },
+                            plotLines: plotLines
+                        },
+                        yAxis: {
+                            title: {
+                                text: 'Time (' + trend.units + ')'
+                            }
+                        },
+                        plotOptions: {
+                            area: {
+                                stacking: 'normal',
+                                lineWidth: 0,
+                                marker: {
+                                    enabled: false
+                                },
+                                enableMouseTracking: false
+                            }
+                        },
+                        tooltip: {
+                            formatter: function() {
+                                var i = this.point.x;
+                                return 'Revision: <strong>' + trend.revisions[i] + '</strong><br />Mean: <strong>'
+                                    + trend.means[i] + ' ' + trend.units + '</strong><br />' + trend.confidenceLevel
+                                    + ' CI: <strong>[' + trend.lower[i] + ', ' + trend.upper[i] + '] ' + trend.units + '</strong>';
+                            }
+                        },
+                        series: [{
+                            type: 'area',
+                            name: 'confidence interval',
+                            id: 'band',
+                            data: widths,
+                            color: '#a6cee3',
+                            fillOpacity: 0.5
+                        }, {
+                            type: 'area',
+                            linkedTo: 'band',
+                            data: trend.lower,
+                            fillOpacity: 0
+                        }, {
+                            type: 'line',
+                            name: 'mean',
+                            data: trend.means,
+                            color: '#1f78b4'
+                        }]
                     });
 
-                    rawMeasurementsChart.tooltip.options.formatter = function() {
-                        return 'Iterations: <strong>' + this.x + ' ' + '</strong><br />Time: <strong>' +
-                            this.y + ' ' + benchData.rawMeasurements.units + '</strong>';
-                    };
+                    $('#shifts tbody').empty();
+                    $('#shifts').toggle(trend.changepoints.length > 0);
+                    $('#no-shifts').toggle(trend.changepoints.length === 0);
+                    var bounds = [0].concat(trend.changepoints, [trend.means.length]);
+                    for (var i = 1; i + 1 < bounds.length; ++i) {
+                        var before = segmentMean(trend.means, bounds[i - 1], bounds[i]);
+                        var after = segmentMean(trend.means, bounds[i], bounds[i + 1]);
+                        var change = (after - before) / before * 100;
+                        $('<tr>')
+                            .append($('<td>').text(trend.revisions[bounds[i] - 1]))
+                            .append($('<td>').text(trend.revisions[bounds[i]]))
+                            .append($('<td>').text(before.toPrecision(4) + ' ' + trend.units))
+                            .append($('<td>').text(after.toPrecision(4) + ' ' + trend.units))
+                            .append($('<td>').text((change > 0 ? '+' : '') + change.toFixed(1) + '%')
+                                .toggleClass('slower', change > 0))
+                            .appendTo('#shifts tbody');
+                    }
                 }
 
-                for (var b in benchmarkData) {
+                $.each(trendData, function(i, trend) {
+                    var link = $('<a/>', {id: 'trend_' + i, href: '#', text: trend.name});
+                    if (trend.changepoints.length) {
+                        $('<span class="shift-count"/>')
+                            .text(trend.changepoints.length + (trend.changepoints.length === 1 ? ' shift' : ' shifts'))
+                            .appendTo(link);
+                    }
+
                     $('<li/>', {
-                        html: $('<a/>', {id: b, href: '#', text: benchmarkData[b].name})
+                        html: link
                     }).appendTo('#benchmarks');
-                }
+                });
 
                 $('#benchmarks a').click(function(e) {
                     e.preventDefault();
-                    var target = $(e.target);
 
-                    updateData(target.attr('id'));
+                    showTrend(+$(this).attr('id').substring('trend_'.length));
                 });
-
-                $('#clock-name').text(clockInfo.name);
-                $('#steadiness').text(clockInfo.steadiness);
-                updateData('benchmark_1');
+
+                if (trendData.length) {
+                    showTrend(0);
+                }
             });
         </script>
 
@@ -3018,6 +9287,12 @@ R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.h
                 border-bottom-right-radius: 10px;
             }
 
+            #benchmarks .shift-count {
+                display: block;
+                font-size: 12px;
+                color: #e31a1c;
+            }
+
             #benchmarks a:hover{
                 background-color: #f5f5f5;
             }
@@ -3038,346 +9313,185 @@ R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.h
 
             caption {
                 font-weight:bold;
-            }
-
-            #sample-summary caption {
                 padding-bottom: 10px;
             }
 
-            #sample-summary tr td {
-                border-top: 1px solid #D0CDCD;
-            }
-
-            #sample-summary td:nth-child(2) {
-                color: #111;
-                background-color: #F2F2F2;
-            }
-
-            #sample-summary, #analyzed-stats {
-                border-collapse: collapse;
-                float:left
-            }
-
-            #analyzed-stats {
-                margin:0 0 0 50px;
-            }
-
-            #analyzed-stats thead th,
-            #analyzed-stats tr td,
-            #sample-summary td {
-                padding: 10px 15px;
-            }
-
-            #analyzed-stats thead th{
-                color: #333;
-                font-weight:normal;
-            }
-
-            #analyzed-stats tr td {
-                border-top: 1px solid #D0CDCD;
-                color: #777;
-            }
-
-            #analyzed-stats td:first-child, #sample-summary td:first-child {
-                color: #333;
-            }
-
-            #analyzed-stats td:nth-child(3) {
-                color: #111;
-                background-color: #F2F2F2;
-            }
-
-            #separator {
-                clear: both;
-                padding-top: 15px;
-            }
-
-            #kde, #samples, #raw-measurements {
+            #trend {
                 min-width: 600px;
+                height: 600px;
                 margin-bottom:15px;
                 border:1px solid #eee;
                 box-shadow: 0 0 3px rgba(0, 0, 0, 0.05);
             }
 
-            #kde {
-                height:600px;
-            }
-
-            #samples, #raw-measurements {
-                height: 800px;
-            }
-
-            #info {
-                border-top: 1px solid #E4E4E4;
-                background-color: #F2F2F2;
-                padding: 10px;
+            #shifts {
+                border-collapse: collapse;
+                margin-bottom:15px;
             }
 
-            #info dt {
-                font-weight:bold;
+            #shifts thead th {
+                color: #333;
+                font-weight:normal;
             }
 
-            #info dd {
-                margin-bottom:5px;
+            #shifts thead th, #shifts tr td {
+                padding: 10px 15px;
             }
 
-            #clock-info {
-                color: #9A9FA4;
-                margin-bottom: 0;
+            #shifts tr td {
+                border-top: 1px solid #D0CDCD;
+                color: #777;
             }
-        </style>
-
-    </head>
-    <body>
-        <div id="content">
-            <nav>
-                <ul id="benchmarks">
-                </ul>
-            </nav>
-
-            <main>
-                <h1 id="benchmark-name"> Benchmark name </h1>
-
-                <table id="sample-summary">
-                    <caption> Sample Summary</caption>
-	                <tbody>
-		                <tr>
-			                <td>min</td>
-			                <td id="sample-min"></td>
-		                </tr>
-		                <tr>
-			                <td>Q1</td>
-			                <td id="sample-q1"></td>
-		                </tr>
-		                <tr>
-			                <td>mean</td>
-			                <td id="sample-mean"></td>
-		                </tr>
-		                <tr>
-			                <td>median</td>
-			                <td id="sample-median"></td>
-		                </tr>
-		                <tr>
-			                <td>Q3</td>
-			                <td id="sample-q3"></td>
-		                </tr>
-		                <tr>
-			                <td>max</td>
-			                <td id="sample-max"></td>
-		                </tr>
-	                </tbody>
-                </table>
-
-                <table id="analyzed-stats">
-                  <caption>Bootstrapped Statistics</caption>
-	                <thead>
-	                  <th></th>
-	                  <th id="lb-title">lower bound</th>
-		                <th>sample estimate</th>
-		                <th id="ub-title">upper bound</th>
-	                </thead>
-	                <tbody>
-		                <tr>
-			                <td>mean</td>
-			                <td id="mean-lb"></td>
-			                <td id="mean-estimate"></td>
-			                <td id="mean-up"></td>
-		                </tr>
-		                <tr>
-			                <td>median</td>
-			                <td id="median-lb"></td>
-			                <td id="median-estimate"></td>
-			                <td id="median-up"></td>
-		                </tr>
-		                <tr>
-			                <td>SD</td>
-			                <td id="sd-lb"></td>
-			                <td id="sd-estimate"></td>
-			                <td id="sd-up"></td>
-		                </tr>
-		                <tr>
-			                <td>MAD</td>
-			                <td id="mad-lb"></td>
-			                <td id="mad-estimate"></td>
-			                <td id="mad-up"></td>
-		                </tr>
-		                <tr>
-			                <td>LLS</td>
-			                <td id="lls-lb"></td>
-			                <td id="lls-estimate"></td>
-			                <td id="lls-up"></td>
-		                </tr>
-		                <tr>
-			                <td>r&sup2;</td>
-			                <td id="r2-lb"></td>
-			       )***^***",
-R"***^***(         <td id="r2-estimate"></td>
-			                <td id="r2-up"></td>
-		                </tr>
-	                </tbody>
-                </table>
-
-                <div id="separator"></div>
-
-                <div id="kde"></div>
-
-                <div id="samples"></div>
-
-                <div id="raw-measurements"></div>
-            </main>
-        </div>
-        <div id="info">
-            <h3>Statistics</h3>
-            <dl>
-                <dt>MAD (Median Absolute Deviation)</dt>
-                <dd>
-                    The interval [median - MAD, median + MAD] contains half of the measured values.  Unlike the standard deviation the MAD is resilient to outliers.
-                </dd>
-                <dt>LLS (Least Linear Squares)</dt>
-                <dd>
-                    An estimate of the time taken to run a single iteration of the benchmarked function which is calculated using  least linear squares regression (through the origin).  This value should be more accurate then some other statistics, such as mean, since it eliminates constant factors (such as measurement overhead).
-                </dd>
-                <dt>r&sup2;</dt>
-                <dd>
-                    A value in the interval [0, 1] which measures the accuracy of the calculated linear regression.  Any value below .99 indicates that the measurements may be suspect (perhaps other processes on the machine are influencing the benchmarks).
-                </dd>
-                <dt>lower/upper bound</dt>
-                <dd>
-                    Confidence intervals calculated using bootstrapping which help determine the accuracy of an estimate.  If the configured confidence_level is .95 (the default) then 95% of the estimates calculated when resampling the data were between the lower and upper bounds.  Lower and upper bounds will be close to the estimated value for high quality estimates.  You can hover over the "lower bound" or "upper bound" column titles to see the confidence level which was used.
-                </dd>
-             </dl>
-             <h3>Charts</h3>
-             <dl>
-                <dt>Kernel Density Estimate</dt>
-                <dd>
-                    Shows the probability of a particular measurement occurring. The higher the probability density line the more likely a measurement is to occur.
-                </dd>
-                <dt>Samples</dt>
-                <dd>
-                    Plots the per iteration time of each measurement (total time / number of iterations).  If any of the values are classified as outliers according to the IQR criteria the relevant lines are shown as well.
-                </dd>
-                <dt>Raw Measurements</dt>
-                <dd>
-                    The raw measurements(number of iterations and duration) which were collected when benchmarking a function.  The regression line is created from the calculated LLS value.  All points should be on or very near the regression line.
-                </dd>
-             </dl>
-             <p>You can hover over the any of the charts to see exact values and select areas to zoom in.</p>
-             <p id="clock-info">All times measured with <span id="clock-name"></span> which is <span id="steadiness"></span>.</p>
-        </div>
-    </body>
-</html>
-)***^***"
-    };
-
-    static const std::string s = string_from_cstrs(pieces);
-    return s;
-  }
-
-private:
-  std::ostream &os_;
-  std::string current_benchmark_;
-  std::uint32_t num_benchmarks;
-};
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
-}
-
-namespace velox {
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wweak-vtables"
-#endif
-struct MultiReporter : Reporter {
-  template <class... Rs>
-  MultiReporter(Rs &... rs) {
-    static_assert(sizeof...(rs), "At least one reporter is required");
-    unused((reporters_.push_back(&rs), 0)...);
-  }
-
-  void suite_starting(const std::string &clock, bool is_steady) override {
-    call(fp(&Reporter::suite_starting), clock, is_steady);
-  }
-
-  void estimate_clock_cost_starting() override {
-    call(fp(&Reporter::estimate_clock_cost_starting));
-  }
 
-  void estimate_clock_cost_ended(FpNs cost) override {
-    call(fp(&Reporter::estimate_clock_cost_ended), cost);
-  }
+            #shifts td.slower {
+                color: #e31a1c;
+            }
 
-  void warm_up_starting(Ms ms) override { call(fp(&Reporter::warm_up_starting), ms); }
+            #info {
+                clear: both;
+                border-top: 1px solid #E4E4E4;
+                background-color: #F2F2F2;
+                padding: 10px;
+            }
 
-  void warm_up_ended(const ItersForDurationNs &wu) override {
-    call(fp(&Reporter::warm_up_ended), wu);
-  }
+            #info dt {
+                font-weight:bold;
+            }
 
-  void warm_up_failed(const ItersForDurationNs &wu) override {
-    call(fp(&Reporter::warm_up_failed), wu);
-  }
+            #info dd {
+                margin-bottom:5px;
+            }
+        </style>
 
-  void benchmark_starting(const std::string &name) override {
-    call(fp(&Reporter::benchmark_starting), name);
-  }
+    </head>
+    <body>
+        <div id="content">
+            <nav>
+                <ul id="benchmarks">
+                </ul>
+            </nav>
 
-  void benchmark_ended() override { call(fp(&Reporter::benchmark_ended)); }
+            <main>
+                <h1 id="be)***^***",
+R"***^***(nchmark-name"> Benchmark name </h1>
+
+                <div id="trend"></div>
+
+                <table id="shifts">
+                    <caption>Shifts</caption>
+                    <thead>
+                        <tr>
+                            <th>last revision before</th>
+                            <th>first revision after</th>
+                            <th>mean before</th>
+                            <th>mean after</th>
+                            <th>change</th>
+                        </tr>
+                    </thead>
+                    <tbody>
+                    </tbody>
+                </table>
+                <p id="no-shifts">No shifts were detected.</p>
+            </main>
+        </div>
+        <div id="info">
+            <h3>Trends</h3>
+            <dl>
+                <dt>Mean over Revisions</dt>
+                <dd>
+                    The mean of each run recorded in the history (HistoryReporter) in the order the runs were recorded, with its confidence interval as a band.  Rerunning a revision adds another point.  Differences between runs that are much larger than the intervals are normal since the intervals only cover the noise within a run, not between runs.
+                </dd>
+                <dt>Shifts</dt>
+                <dd>
+                    The dashed lines mark where the mean shifted, found by PELT changepoint detection.  A shift is only reported when it is large compared to the noise between consecutive runs and lasts at least two runs, so a single slow run isn't one.  The change compares the average of the means between the surrounding shifts.
+                </dd>
+            </dl>
+        </div>
+    </body>
+</html>
+)***^***"
+    };
 
-  void measurement_collection_starting(std::uint32_t num_measurements,
-                                       FpNs measurement_time) override {
-    call(fp(&Reporter::measurement_collection_starting), num_measurements, measurement_time);
+    static const std::string s = string_from_cstrs(pieces);
+    return s;
   }
 
-  void measurement_collection_ended(const Measurements &measurements,
-                                    const Times &times,
-                                    const Outliers &outliers) override {
-    call(fp(&Reporter::measurement_collection_ended), measurements, times, outliers);
-  }
+  // Shifts in the level of a benchmark's means over the history
+  inline std::vector<std::size_t> history_changepoints(const BenchmarkHistory &history) {
+    std::vector<double> means, standard_errors;
+    for (const auto &e : history.entries()) {
+      means.push_back(e.mean().point().count());
+      standard_errors.push_back(e.mean().standard_error().count());
+    }
 
-  void estimate_statistics_starting(std::uint32_t num_resamples) override {
-    call(fp(&Reporter::estimate_statistics_starting), num_resamples);
+    return detect_changepoints(means, standard_errors);
   }
+}
 
-  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
-    call(fp(&Reporter::estimate_statistics_ended), statistics);
-  }
+// Writes an HTML page which plots the mean of each benchmark in a history over its revisions,
+// with the confidence intervals as a band and the revisions where the mean shifted marked
+inline void write_trend_report(std::ostream &os, const std::vector<BenchmarkHistory> &histories) {
+  const int SIGNIFICANT_DIGITS = 6;
 
-  void suite_ended() override { call(fp(&Reporter::suite_ended)); }
+  BufferedWriter out(os);
+  out << detail::trend_template_begin() << "\n";
+  out << "var trendData = [\n";
 
-private:
-  template <class F>
-  struct FuncPtr {
-    FuncPtr(F f) : f_(f) {}
+  for (const auto &history : histories) {
+    const auto &entries = history.entries();
 
-    template <class... Args>
-    void operator()(Reporter *reporter, const Args &... args) {
-      (reporter->*f_)(args...);
+    auto max_mean = FpNs(0);
+    for (const auto &e : entries) {
+      max_mean = (std::max)(max_mean, e.mean().point());
     }
+    const auto scaler = scaler_for_time(max_mean);
+
+    const auto write_times = [&](const char *const name, FpNs (Estimate<FpNs>::*time)() const) {
+      out << "    " << name << " : [";
+      const char *sep = "";
+      for (const auto &e : entries) {
+        out << sep;
+        out.write_general(scaler.scale((e.mean().*time)()), SIGNIFICANT_DIGITS);
+        sep = ", ";
+      }
+      out << "],\n";
+    };
 
-  private:
-    F f_;
-  };
+    out << "{\n";
+    out << "    name : '" << js_string_escape(history.name()) << "',\n";
+    out << "    units : '" << scaler.units() << "',\n";
+    out << "    confidenceLevel : '";
+    out.write_general(entries.empty() ? 0.0 : entries.back().mean().confidence_level() * 100, 6);
+    out << "%',\n";
 
-  template <class F>
-  FuncPtr<F> fp(F f) {
-    return FuncPtr<F>(f);
-  }
+    out << "    revisions : [";
+    const char *sep = "";
+    for (const auto &e : entries) {
+      out << sep << "'" << js_string_escape(e.revision()) << "'";
+      sep = ", ";
+    }
+    out << "],\n";
 
-  template <class F, class... Args>
-  void call(FuncPtr<F> f, const Args &... args) {
-    for (auto r : reporters_) {
-      f(r, args...);
+    write_times("means", &Estimate<FpNs>::point);
+    write_times("lower", &Estimate<FpNs>::lower_bound);
+    write_times("upper", &Estimate<FpNs>::upper_bound);
+
+    out << "    changepoints : [";
+    sep = "";
+    for (const auto c : detail::history_changepoints(history)) {
+      out << sep << c;
+      sep = ", ";
     }
+    out << "]\n";
+    out << "},\n";
   }
 
-private:
-  std::vector<Reporter *> reporters_;
-};
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
+  out << "];\n";
+  out << detail::trend_template_end() << "\n";
+}
 }
 
+#include <set>
 #include <tuple>
 
 namespace velox {
@@ -3385,20 +9499,61 @@ namespace velox {
 template <class C = DefaultClock>
 struct Velox {
   Velox(Reporter &reporter, const VeloxConfig &config = VeloxConfig())
-      : config_(config), reporter_(reporter) {
+      : config_(config), environment_(environment_fingerprint(type_name<C>(), C::is_steady)),
+        merged_shards_(config.force_merge() ? config.merge()
+                                            : shards_in_environment(config.merge(), environment_)),
+        checkpoint_(config.checkpoint(), config.resume(), merged_shards_),
+        warm_up_cache_(config.warm_up_cache()),
+        with_files_(reporter, checkpoint_, warm_up_cache_),
+        reporter_(config.checkpoint().empty() && config.warm_up_cache().empty() ? reporter
+                                                                                : with_files_),
+        clock_resolution_(0.0) {
     reporter_.suite_starting(type_name<C>(), C::is_steady);
+    if (config.quick_mode()) {
+      reporter_.quick_mode_enabled();
+    }
+    // The benchmarks of shards which ran somewhere else are neither merged nor run again here
+    for (const auto &shard : config.merge()) {
+      if (std::find(merged_shards_.begin(), merged_shards_.end(), shard) == merged_shards_.end()) {
+        reporter_.merge_refused(shard, read_checkpoint_environment(shard), environment_);
+        for (const auto &e : read_checkpoint(shard)) {
+          refused_.insert(e.name());
+        }
+      }
+    }
+
+    clock_resolution_ = estimate_clock_resolution<C>();
+    reporter_.clock_resolution_estimated(clock_resolution_);
+
     if (config.estimate_clock_cost()) {
-      estimate_clock_cost<C>(config_, reporter_);
+      estimate_clock_cost<C>(config_, clock_resolution_, reporter_);
     }
   }
 
   Velox &operator=(const Velox &rhs) = delete;
 
-  ~Velox() { reporter_.suite_ended(); }
+  ~Velox() {
+    deferred_.run(config_, reporter_);
+    reporter_.suite_ended();
+  }
 
   template <class F>
   Velox &bench(const std::string &name, F &&f) {
-    benchmark<C>(name, std::forward<F>(f), config_, reporter_);
+    run_benchmark(name, std::forward<F>(f));
+    return *this;
+  }
+
+  // Calls f open loop at each of the configured request rates and reports the latencies.
+  // Checkpoints don't store load tests, so a sharded run skips them and the run merging the
+  // shards runs each of them once.
+  template <class F>
+  Velox &load(const std::string &name, F &&f, const LoadConfig &config) {
+    if (config_.shard_count() > 1) {
+      return *this;
+    }
+
+    auto &reporter = config_.deferred_analysis() ? deferred_.next() : reporter_;
+    load_test<C>(name, std::forward<F>(f), config, reporter);
     return *this;
   }
 
@@ -3455,6 +9610,47 @@ struct Velox {
   }
 
 private:
+  template <class F>
+  void run_benchmark(const std::string &name, F &&f) {
+    if (!in_shard(name, config_.shard_index(), config_.shard_count())) {
+      return;
+    }
+
+    // Benchmarks finished by an earlier run or by the shards being merged are reported again
+    // without running them
+    const auto finished = checkpoint_.finished(name);
+    if (!finished && refused_.count(name)) {
+      return;
+    }
+    const auto cached = warm_up_cache_.find(name);
+
+    if (!config_.deferred_analysis()) {
+      if (finished) {
+        reporter_.benchmark_starting(name);
+        replay_measurement(*finished, reporter_);
+        analyze(finished->measurements(), config_, reporter_);
+        return;
+      }
+
+      benchmark<C>(name, std::forward<F>(f), config_, clock_resolution_, reporter_, cached);
+      return;
+    }
+
+    auto &events = deferred_.next();
+    events.benchmark_starting(name);
+    if (finished) {
+      replay_measurement(*finished, events);
+      deferred_.analyze_later(Measurements(finished->measurements()));
+      return;
+    }
+
+    auto measure_result =
+        measure<C>(std::forward<F>(f), config_, clock_resolution_, events, cached);
+    if (measure_result.second) {
+      deferred_.analyze_later(std::move(measure_result.first));
+    }
+  }
+
   struct Formatter {
     template <class T>
     void operator()(std::ostream &os, const T &t) const {
@@ -3487,10 +9683,7 @@ private:
         IsCallable<F, Stopwatch &, decltype(std::get<Is>(args))...>::value,
         "Function not callable with args.  Perhaps the function is taking non-const references?");
 
-    benchmark<C>(name,
-                 [&f, &args](Stopwatch &sw) { return f(sw, std::get<Is>(args)...); },
-                 config_,
-                 reporter_);
+    run_benchmark(name, [&f, &args](Stopwatch &sw) { return f(sw, std::get<Is>(args)...); });
   }
 
   template <class F, class TupledArgs, std::size_t... Is>
@@ -3500,12 +9693,414 @@ private:
         IsCallable<F, decltype(std::get<Is>(args))...>::value,
         "Function not callable with args.  Perhaps the function is taking non-const references?");
 
-    benchmark<C>(name, [&f, &args] { return f(std::get<Is>(args)...); }, config_, reporter_);
+    run_benchmark(name, [&f, &args] { return f(std::get<Is>(args)...); });
   }
 
 private:
   VeloxConfig config_;
+  std::string environment_;
+  // The shard checkpoints written in this run's environment, or all of them when forced
+  std::vector<std::string> merged_shards_;
+  // The benchmarks in the other shard checkpoints
+  std::set<std::string> refused_;
+  CheckpointReporter checkpoint_;
+  WarmUpCache warm_up_cache_;
+  MultiReporter with_files_;
+  // The reporter passed to the constructor, along with checkpoint_ and warm_up_cache_ when either
+  // of them has a file
   Reporter &reporter_;
+  FpNs clock_resolution_;
+  DeferredAnalysis deferred_;
+};
+}
+
+#include <streambuf>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VELOX_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace velox {
+
+// A read only view of a whole file.  Where mmap is available the file is mapped so a large file
+// is paged in as it is parsed instead of being copied first; elsewhere it is read into memory.
+struct MappedFile {
+  explicit MappedFile(const std::string &path)
+      : is_open_(false), data_(nullptr), size_(0), mapping_(nullptr) {
+#ifdef VELOX_HAS_MMAP
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+
+    struct stat status;
+    if (::fstat(fd, &status) == 0 && status.st_size >= 0) {
+      size_ = static_cast<std::size_t>(status.st_size);
+      is_open_ = true;
+      if (size_) {
+        mapping_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping_ == MAP_FAILED) {
+          mapping_ = nullptr;
+          is_open_ = false;
+          size_ = 0;
+        } else {
+          ::madvise(mapping_, size_, MADV_SEQUENTIAL);
+          data_ = static_cast<const char *>(mapping_);
+        }
+      }
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      return;
+    }
+
+    contents_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    is_open_ = true;
+    data_ = contents_.data();
+    size_ = contents_.size();
+#endif
+  }
+
+  MappedFile(const MappedFile &rhs) = delete;
+  MappedFile &operator=(const MappedFile &rhs) = delete;
+
+  ~MappedFile() {
+#ifdef VELOX_HAS_MMAP
+    if (mapping_) {
+      ::munmap(mapping_, size_);
+    }
+#endif
+  }
+
+  bool is_open() const { return is_open_; }
+
+  // The file's contents, which aren't null terminated
+  const char *data() const { return data_; }
+
+  std::size_t size() const { return size_; }
+
+private:
+  bool is_open_;
+  const char *data_;
+  std::size_t size_;
+  void *mapping_;
+  std::vector<char> contents_;
+};
+
+// Lets a std::istream read from memory, such as a MappedFile, without copying it
+struct MemoryBuffer : std::streambuf {
+  MemoryBuffer(const char *data, const std::size_t size) {
+    const auto first = const_cast<char *>(data);
+    setg(first, first, first + size);
+  }
+
+protected:
+  // Seeking lets a stream be read more than once, e.g. by OfflineAnalysis::add_results
+  pos_type seekoff(const off_type off,
+                   const std::ios_base::seekdir dir,
+                   const std::ios_base::openmode which) override {
+    if (!(which & std::ios_base::in)) {
+      return pos_type(off_type(-1));
+    }
+
+    const auto from = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr()
+                                                                                       : egptr();
+    const auto position = (from - eback()) + off;
+    if (position < 0 || position > egptr() - eback()) {
+      return pos_type(off_type(-1));
+    }
+
+    setg(eback(), eback() + position, egptr());
+    return pos_type(position);
+  }
+
+  pos_type seekpos(const pos_type pos, const std::ios_base::openmode which) override {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+};
+}
+
+namespace velox {
+
+// How the latencies in a log from outside velox are read
+struct LatencyLogConfig {
+  LatencyLogConfig()
+      : column_(0), ns_per_unit_(1.0), batch_(1),
+        num_threads_((std::max)(std::thread::hardware_concurrency(), 1u)) {}
+
+  // The comma separated column of a CSV log which holds the latencies, counting from 0
+  LatencyLogConfig &column(const std::size_t c) {
+    column_ = c;
+    return *this;
+  }
+
+  std::size_t column() const { return column_; }
+
+  // The length of the unit the latencies are in, e.g. 1000 for microseconds
+  LatencyLogConfig &ns_per_unit(const double ns) {
+    assert(ns > 0.0 && "The unit must be positive");
+    ns_per_unit_ = ns;
+    return *this;
+  }
+
+  double ns_per_unit() const { return ns_per_unit_; }
+
+  // The number of consecutive latencies in each measurement.  The default of 1 analyzes every
+  // latency on its own; larger batches make the bootstrap of a long log affordable at the cost
+  // of only seeing the distribution of the batches' means.  A partial last batch is left out.
+  LatencyLogConfig &batch(const std::uint64_t b) {
+    assert(b && "Batches must have at least one latency");
+    batch_ = b;
+    return *this;
+  }
+
+  std::uint64_t batch() const { return batch_; }
+
+  // The number of threads which parse a CSV log, each taking an equal share of its lines
+  LatencyLogConfig &num_threads(const std::uint32_t n) {
+    assert(n && "At least one thread is required");
+    num_threads_ = n;
+    return *this;
+  }
+
+  std::uint32_t num_threads() const { return num_threads_; }
+
+private:
+  std::size_t column_;
+  double ns_per_unit_;
+  std::uint64_t batch_;
+  std::uint32_t num_threads_;
+};
+
+namespace detail {
+  // Converts a latency to whole nanoseconds, rejecting negative and non finite ones
+  inline bool latency_to_ns(const double latency, const double ns_per_unit, Ns &ns) {
+    const auto scaled = std::round(latency * ns_per_unit);
+    if (!(scaled >= 0.0 && scaled < 9.2e18)) {
+      return false;
+    }
+
+    ns = Ns(static_cast<Ns::rep>(scaled));
+    return true;
+  }
+
+  // Parses the number in [first, last), ignoring surrounding spaces.  Mapped files aren't null
+  // terminated so the number is copied before strtod reads it.
+  inline bool parse_latency(const char *first, const char *last, double &d) {
+    while (first != last && (*first == ' ' || *first == '\t')) {
+      ++first;
+    }
+    while (last != first && (last[-1] == ' ' || last[-1] == '\t' || last[-1] == '\r')) {
+      --last;
+    }
+
+    char number[64];
+    const auto length = static_cast<std::size_t>(last - first);
+    if (!length || length >= sizeof(number)) {
+      return false;
+    }
+    std::memcpy(number, first, length);
+    number[length] = '\0';
+
+    char *end = nullptr;
+    d = std::strtod(number, &end);
+    return end == number + length;
+  }
+
+  // Appends the latency in the given column of each line of [first, last).  Lines without one,
+  // such as headers, are skipped.
+  inline void parse_latency_lines(const char *first,
+                                  const char *const last,
+                                  const LatencyLogConfig &config,
+                                  std::vector<Ns> &latencies) {
+    while (first != last) {
+      auto line_end = static_cast<const char *>(
+          std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+      if (!line_end) {
+        line_end = last;
+      }
+
+      auto field = first;
+      for (std::size_t c = 0; c < config.column() && field != line_end; ++c) {
+        const auto comma = static_cast<const char *>(
+            std::memchr(field, ',', static_cast<std::size_t>(line_end - field)));
+        field = comma ? comma + 1 : line_end;
+      }
+      auto field_end = static_cast<const char *>(
+          std::memchr(field, ',', static_cast<std::size_t>(line_end - field)));
+      if (!field_end) {
+        field_end = line_end;
+      }
+
+      double latency = 0.0;
+      Ns ns(0);
+      if (parse_latency(field, field_end, latency) &&
+          latency_to_ns(latency, config.ns_per_unit(), ns)) {
+        latencies.push_back(ns);
+      }
+
+      first = line_end == last ? last : line_end + 1;
+    }
+  }
+
+  // Groups consecutive latencies into measurements of config.batch() iterations
+  inline Measurements batch_latencies(const std::vector<std::vector<Ns>> &chunks,
+                                      const LatencyLogConfig &config) {
+    std::size_t total = 0;
+    for (const auto &c : chunks) {
+      total += c.size();
+    }
+
+    auto measurements = vector_with_capacity<Measurement>(total / config.batch());
+    std::uint64_t in_batch = 0;
+    Ns duration(0);
+    for (const auto &c : chunks) {
+      for (const auto latency : c) {
+        duration += latency;
+        if (++in_batch == config.batch()) {
+          measurements.emplace_back(in_batch, duration);
+          in_batch = 0;
+          duration = Ns(0);
+        }
+      }
+    }
+
+    return measurements;
+  }
+}
+
+// Reads a CSV log with a latency on each line.  The log is split into one share of lines per
+// thread and the shares are parsed concurrently.
+inline Measurements
+read_latency_csv(const char *const data, const std::size_t size, const LatencyLogConfig &config) {
+  const auto last = data + size;
+  const auto num_chunks = (std::max)(
+      std::size_t(1), (std::min)(static_cast<std::size_t>(config.num_threads()), size / 4096));
+
+  // Each share ends at the line break after its nominal end
+  std::vector<const char *> bounds{data};
+  for (std::size_t i = 1; i < num_chunks; ++i) {
+    auto bound = (std::max)(bounds.back(), data + size / num_chunks * i);
+    const auto line_end = static_cast<const char *>(
+        std::memchr(bound, '\n', static_cast<std::size_t>(last - bound)));
+    bounds.push_back(line_end ? line_end + 1 : last);
+  }
+  bounds.push_back(last);
+
+  std::vector<std::vector<Ns>> chunks(num_chunks);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < num_chunks; ++i) {
+    threads.emplace_back([&, i] {
+      detail::parse_latency_lines(bounds[i], bounds[i + 1], config, chunks[i]);
+    });
+  }
+  detail::parse_latency_lines(bounds[0], bounds[1], config, chunks[0]);
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  return detail::batch_latencies(chunks, config);
+}
+
+// Reads a log of latencies stored as 64 bit unsigned integers in the machine's byte order.  A
+// partial value at the end is ignored.
+inline Measurements read_latency_binary(const char *const data,
+                                        const std::size_t size,
+                                        const LatencyLogConfig &config) {
+  const auto count = size / sizeof(std::uint64_t);
+  std::vector<std::vector<Ns>> chunks(1);
+  chunks[0].reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    std::uint64_t latency = 0;
+    std::memcpy(&latency, data + i * sizeof(latency), sizeof(latency));
+
+    Ns ns(0);
+    if (detail::latency_to_ns(static_cast<double>(latency), config.ns_per_unit(), ns)) {
+      chunks[0].push_back(ns);
+    }
+  }
+
+  return detail::batch_latencies(chunks, config);
+}
+
+// Analyzes measurements which were collected earlier, such as a suite's checkpoint or latencies
+// logged by a service, without measuring anything.  The benchmarks are analyzed concurrently
+// when run is called and reported in the order they were added, so the statistics can be
+// estimated again with a different configuration and given to any reporter.
+struct OfflineAnalysis {
+  // A benchmark from a checkpoint, reported along with what was reported while its measurements
+  // were collected
+  void add(const CheckpointEntry &entry) {
+    auto &events = deferred_.next();
+    events.benchmark_starting(entry.name());
+    replay_measurement(entry, events);
+    deferred_.analyze_later(Measurements(entry.measurements()));
+  }
+
+  // Measurements from outside velox, e.g. from read_latency_csv, which have no warm up
+  void add(const std::string &name, Measurements &&measurements) {
+    FpNs total(0);
+    for (const auto &m : measurements) {
+      total += m.duration();
+    }
+
+    auto &events = deferred_.next();
+    events.benchmark_starting(name);
+    events.measurement_collection_starting(static_cast<std::uint32_t>(measurements.size()),
+                                           total);
+    deferred_.analyze_later(std::move(measurements));
+  }
+
+  // Adds every benchmark in a checkpoint or, failing that, the latest run with raw measurements
+  // of every benchmark in a history (see HistoryReporter).  Returns whether any were found.
+  bool add_results(std::istream &is) {
+    const auto entries = read_checkpoint(is);
+    for (const auto &e : entries) {
+      add(e);
+    }
+    if (!entries.empty()) {
+      return true;
+    }
+
+    is.clear();
+    is.seekg(0);
+
+    auto found = false;
+    for (const auto &history : read_history(is)) {
+      const auto &runs = history.entries();
+      const auto latest = std::find_if(runs.rbegin(), runs.rend(), [](const HistoryEntry &e) {
+        return !e.raw_measurements().empty();
+      });
+      if (latest != runs.rend()) {
+        add(history.name(), Measurements(latest->raw_measurements()));
+        found = true;
+      }
+    }
+    return found;
+  }
+
+  bool empty() const { return deferred_.empty(); }
+
+  // Reports everything which was added as one suite
+  void run(const VeloxConfig &config, Reporter &reporter) {
+    reporter.suite_starting("stored measurements", true);
+    if (config.quick_mode()) {
+      reporter.quick_mode_enabled();
+    }
+
+    deferred_.run(config, reporter);
+    reporter.suite_ended();
+  }
+
+private:
+  DeferredAnalysis deferred_;
 };
 }
 
@@ -0,0 +1,77 @@
+// Measures how quickly the reporters turn one benchmark's results into output
+
+#include "velox.h"
+#include "recording_reporter.h"
+
+#include <iostream>
+#include <random>
+#include <sstream>
+
+namespace {
+// Discards everything written to it so only the cost of producing the output is measured
+struct NullBuffer : std::streambuf {
+protected:
+  int_type overflow(const int_type c) override { return traits_type::not_eof(c); }
+
+  std::streamsize xsputn(const char *, const std::streamsize n) override { return n; }
+};
+
+velox::Measurements synthetic_measurements() {
+  std::mt19937 rng(1);
+  std::normal_distribution<double> noise(100.0, 5.0);
+
+  velox::Measurements measurements;
+  for (std::uint64_t i = 1; i <= 100; ++i) {
+    const auto ns = static_cast<velox::Ns::rep>(static_cast<double>(i) * noise(rng));
+    measurements.emplace_back(i, velox::Ns(ns));
+  }
+  return measurements;
+}
+}
+
+int main() {
+  // The events of one fully analysed benchmark, replayed into the reporters being measured
+  velox::RecordingReporter events;
+  events.benchmark_starting("synthetic");
+  velox::analyze(synthetic_measurements(), velox::VeloxConfig().num_resamples(10000), events);
+
+  NullBuffer null_buffer;
+  std::ostream null_stream(&null_buffer);
+
+  std::mt19937_64 rng(2);
+  std::uniform_real_distribution<double> dist(0.0, 1e6);
+  std::vector<double> doubles(1000);
+  for (auto &d : doubles) {
+    d = dist(rng);
+  }
+
+  velox::TextReporter text_reporter(std::cout);
+  velox::Velox<> v(text_reporter);
+
+  v.bench("html report of one benchmark", [&](velox::Stopwatch &sw) {
+    velox::HtmlReporter html(null_stream);
+    sw.measure([&] { events.replay(html); });
+  });
+
+  v.bench("text report of one benchmark", [&](velox::Stopwatch &sw) {
+    velox::TextReporter text(null_stream);
+    sw.measure([&] { events.replay(text); });
+  });
+
+  v.bench("1000 doubles with BufferedWriter", [&](velox::Stopwatch &sw) {
+    velox::BufferedWriter out(null_stream);
+    sw.measure([&] {
+      for (const auto d : doubles) {
+        out << d << ',';
+      }
+    });
+  });
+
+  v.bench("1000 doubles with std::ostream", [&](velox::Stopwatch &sw) {
+    sw.measure([&] {
+      for (const auto d : doubles) {
+        null_stream << d << ',';
+      }
+    });
+  });
+}
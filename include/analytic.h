@@ -0,0 +1,167 @@
+#ifndef VELOX_ANALYTIC_H_INCLUDED
+#define VELOX_ANALYTIC_H_INCLUDED
+
+#include "util.h"
+#include "stats.h"
+#include "measurement.h"
+#include "sample_summary.h"
+#include "robust.h"
+#include "bootstrap.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace velox {
+
+// Confidence intervals from textbook formulas instead of the bootstrap.  They assume roughly
+// normal, independent measurements so they are only approximate for benchmarks, but cost next
+// to nothing which makes them useful for VeloxConfig::quick_mode.
+
+namespace detail {
+  // An estimate without an interval, for statistics with no cheap analytic one
+  template <class T>
+  Estimate<T> point_estimate(const T p, const double cl) {
+    return Estimate<T>(p, T(0), p, p, cl);
+  }
+
+  inline Estimate<FpNs>
+  t_estimate(const FpNs p, const FpNs se, const double df, const double cl) {
+    if (!(df > 0.0)) {
+      return point_estimate(p, cl);
+    }
+
+    const auto t = student_t_quantile(0.5 * (1.0 + cl), df);
+    return Estimate<FpNs>(p, se, p - se * t, p + se * t, cl);
+  }
+}
+
+// Student's t interval for the mean
+inline Estimate<FpNs> mean_t_interval(const SampleSummary &summary, const double cl) {
+  const auto n = static_cast<double>(summary.size());
+  return detail::t_estimate(summary.mean(), summary.std_dev() / std::sqrt(n), n - 1.0, cl);
+}
+
+// Distribution free interval for the median between the order statistics whose ranks are
+// binomial(n, 1/2) quantiles.  The standard error is the width of the interval scaled to a
+// normal one.
+inline Estimate<FpNs> median_order_statistic_interval(const SampleSummary &summary,
+                                                      const double cl) {
+  const auto &sorted = summary.sorted();
+  const auto n = sorted.size();
+  const auto alpha = 0.5 * (1.0 - cl);
+
+  // The largest count j with P(B < j) <= alpha, the interval is [x(j), x(n - j + 1)].  The
+  // cumulative probability is summed as j grows so large samples stay linear.
+  std::size_t j = 0;
+  auto below_next = binomial_half_pmf(0, n);
+  while (j + 1 <= n / 2 && below_next <= alpha) {
+    ++j;
+    below_next += binomial_half_pmf(j, n);
+  }
+
+  const auto lb = sorted[j ? j - 1 : 0], ub = sorted[n - (j ? j : 1)];
+  const auto z = normal_quantile(0.5 * (1.0 + cl));
+  return Estimate<FpNs>(summary.median(), (ub - lb) / (2.0 * z), lb, ub, cl);
+}
+
+// Chi-squared interval for the standard deviation
+inline Estimate<FpNs> std_dev_chi_squared_interval(const SampleSummary &summary,
+                                                   const double cl) {
+  const auto sd = summary.std_dev();
+  const auto df = static_cast<double>(summary.size()) - 1.0;
+  if (!(df > 0.0)) {
+    return detail::point_estimate(sd, cl);
+  }
+
+  const auto lo = chi_squared_quantile(0.5 * (1.0 + cl), df);
+  const auto hi = chi_squared_quantile(0.5 * (1.0 - cl), df);
+  return Estimate<FpNs>(sd,
+                        sd / std::sqrt(2.0 * df),
+                        sd * std::sqrt(df / lo),
+                        hi > 0.0 ? sd * std::sqrt(df / hi) : sd * 1e9,
+                        cl);
+}
+
+// Quick mode's replacement for estimate_statistics.  Means, medians and standard deviations get
+// t, order statistic and chi-squared intervals, LLS, slope and overhead get t intervals from the
+// residuals around the fitted lines and the other statistics are points without intervals.  As
+// with estimate_statistics the outlier variance comes from the sample before any outlier policy.
+inline EstimatedStatistics estimate_statistics_analytic(const Measurements &measurements,
+                                                        const SampleSummary &summary,
+                                                        const VeloxConfig &config,
+                                                        const OutlierVariance &outlier_variance) {
+  const auto cl = config.confidence_level();
+  const auto regression = config.regression_method();
+  const auto points = measurements_to_points(measurements);
+  const auto n = static_cast<double>(points.size());
+
+  const auto flat = is_flat(measurements);
+
+  const auto mean = mean_t_interval(summary, cl);
+
+  std::vector<double> buffer;
+  const auto mad = FpNs(median_abs_dev_of_sorted_destructive(FpRange(summary.sorted()), buffer));
+
+  const auto lls_point = fit_slope(points, regression);
+  const auto line = fit_line(points, regression);
+
+  double sx = 0.0, sxx = 0.0;
+  for (const auto &p : points) {
+    sx += p.x();
+    sxx += p.x() * p.x();
+  }
+  const auto mx = sx / n;
+  const auto centred_sxx = sxx - n * mx * mx;
+
+  double sse_origin = 0.0, sse_line = 0.0;
+  for (const auto &p : points) {
+    const auto e0 = p.y() - lls_point * p.x(), e1 = p.y() - line(p.x());
+    sse_origin += e0 * e0;
+    sse_line += e1 * e1;
+  }
+
+  const auto lls = detail::t_estimate(
+      FpNs(lls_point), FpNs(std::sqrt(sse_origin / (n - 1.0) / sxx)), n - 1.0, cl);
+
+  const auto line_valid = !flat && n > 2.0 && centred_sxx > 0.0;
+  const auto s2 = line_valid ? sse_line / (n - 2.0) : 0.0;
+  const auto slope =
+      line_valid ? detail::t_estimate(
+                       FpNs(line.slope()), FpNs(std::sqrt(s2 / centred_sxx)), n - 2.0, cl)
+                 : lls;
+  const auto overhead =
+      line_valid ? detail::t_estimate(FpNs(line.intercept()),
+                                      FpNs(std::sqrt(s2 * (1.0 / n + mx * mx / centred_sxx))),
+                                      n - 2.0,
+                                      cl)
+                 : detail::point_estimate(FpNs(line.intercept()), cl);
+
+  const auto &customs = config.statistics();
+  auto custom_estimates = vector_with_capacity<CustomEstimate>(customs.size());
+  for (const auto &c : customs) {
+    custom_estimates.emplace_back(c, detail::point_estimate(c(summary.sorted()), cl));
+  }
+
+  return EstimatedStatistics(mean,
+                             median_order_statistic_interval(summary, cl),
+                             std_dev_chi_squared_interval(summary, cl),
+                             detail::point_estimate(mad, cl),
+                             lls,
+                             detail::point_estimate(r_squared(points, lls_point), cl),
+                             slope,
+                             overhead,
+                             outlier_variance,
+                             0,
+                             flat,
+                             true,
+                             std::move(custom_estimates));
+}
+
+inline EstimatedStatistics estimate_statistics_analytic(const Measurements &measurements,
+                                                        const SampleSummary &summary,
+                                                        const VeloxConfig &config) {
+  return estimate_statistics_analytic(measurements, summary, config, OutlierVariance(summary));
+}
+}
+
+#endif // VELOX_ANALYTIC_H_INCLUDED
@@ -0,0 +1,109 @@
+#ifndef VELOX_ASYNC_REPORTER_H_INCLUDED
+#define VELOX_ASYNC_REPORTER_H_INCLUDED
+
+#include "forwarding_reporter.h"
+#include "spsc_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <thread>
+
+namespace velox {
+
+namespace {
+  const std::size_t DEFAULT_ASYNC_QUEUE_SIZE = 1024;
+}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Delivers events to another reporter on a background thread so slow output can't stall the
+// benchmarks.  Events are copied into a bounded lock free queue; if the queue is full they wait in
+// a list on the benchmarking thread instead of blocking it.  suite_ended waits for every event to
+// be delivered, so the wrapped reporter may be used once it returns.
+//
+// Events must all come from the same thread.
+struct AsyncReporter : ForwardingReporter {
+  AsyncReporter(Reporter &reporter, const std::size_t queue_size = DEFAULT_ASYNC_QUEUE_SIZE)
+      : reporter_(reporter), queue_(queue_size), done_(false) {}
+
+  AsyncReporter &operator=(const AsyncReporter &rhs) = delete;
+
+  ~AsyncReporter() { stop(); }
+
+  void suite_ended() override {
+    ForwardingReporter::suite_ended();
+    stop();
+  }
+
+protected:
+  void forward(Event &&event) override {
+    start();
+
+    drain_overflow();
+    if (!overflow_.empty() || !queue_.try_push(std::move(event))) {
+      overflow_.push_back(std::move(event));
+    }
+  }
+
+private:
+  void start() {
+    if (!consumer_.joinable()) {
+      done_.store(false, std::memory_order_relaxed);
+      consumer_ = std::thread([this] { consume(); });
+    }
+  }
+
+  // Waits for every event to be delivered
+  void stop() {
+    if (!consumer_.joinable()) {
+      return;
+    }
+
+    while (!overflow_.empty()) {
+      drain_overflow();
+      std::this_thread::yield();
+    }
+
+    done_.store(true, std::memory_order_release);
+    consumer_.join();
+  }
+
+  void drain_overflow() {
+    while (!overflow_.empty() && queue_.try_push(std::move(overflow_.front()))) {
+      overflow_.pop_front();
+    }
+  }
+
+  void consume() {
+    Event event;
+    for (;;) {
+      // Checked before popping so events pushed before done_ was set are always delivered
+      const auto done = done_.load(std::memory_order_acquire);
+
+      if (queue_.try_pop(event)) {
+        event(reporter_);
+      } else if (done) {
+        return;
+      } else {
+        // Sleeping rather than spinning keeps this thread off the cores being benchmarked
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+  }
+
+private:
+  Reporter &reporter_;
+  SpscQueue<Event> queue_;
+  std::deque<Event> overflow_;
+  std::atomic<bool> done_;
+  std::thread consumer_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+#endif // VELOX_ASYNC_REPORTER_H_INCLUDED
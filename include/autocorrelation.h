@@ -0,0 +1,181 @@
+#ifndef VELOX_AUTOCORRELATION_H_INCLUDED
+#define VELOX_AUTOCORRELATION_H_INCLUDED
+
+#include "util.h"
+#include "fp_range.h"
+#include "stats.h"
+#include "velox_config.h"
+
+#include <cmath>
+#include <vector>
+
+namespace velox {
+
+// Autocovariances of the series at lags 0 through max_lag (inclusive)
+inline std::vector<double> autocovariances(const Times &series, const std::size_t max_lag) {
+  const auto n = series.size();
+  assert(n && "Autocovariance calculation requires at least one value");
+
+  const auto m = mean(FpRange(series));
+  auto acv = vector_with_capacity<double>(max_lag + 1);
+
+  for (std::size_t k = 0; k <= max_lag; ++k) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i + k < n; ++i) {
+      sum += (series[i].count() - m) * (series[i + k].count() - m);
+    }
+    acv.push_back(sum / static_cast<double>(n));
+  }
+
+  return acv;
+}
+
+namespace detail {
+  // Flat-top lag window from Politis & White (2004)
+  inline double flat_top(const double t) {
+    const auto a = std::abs(t);
+    if (a <= 0.5) {
+      return 1.0;
+    } else if (a <= 1.0) {
+      return 2.0 * (1.0 - a);
+    }
+    return 0.0;
+  }
+
+  // The long run variance and its weighted sum of |k| * R(k) using the flat-top window with the
+  // bandwidth picked by the rule of Politis & White (2004)
+  struct LongRunVariance {
+    LongRunVariance(const Times &series) : r0_(0.0), g0_(0.0), g_(0.0) {
+      const auto n = series.size();
+      const auto log_n = std::log10(static_cast<double>(n));
+      const auto kn = static_cast<std::size_t>((std::max)(5.0, std::ceil(std::sqrt(log_n))));
+      const auto m_max = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(n)))) +
+                         kn;
+      const auto max_lag = (std::min)(m_max + kn, n - 1);
+
+      const auto acv = autocovariances(series, max_lag);
+      r0_ = acv[0];
+
+      if (!(r0_ > 0.0)) {
+        return;
+      }
+
+      // The smallest lag after which kn autocorrelations in a row are insignificant
+      const auto threshold = 2.0 * std::sqrt(log_n / static_cast<double>(n));
+      std::size_t m_hat = 0, run = 0;
+      for (std::size_t k = 1; k <= max_lag && run < kn; ++k) {
+        if (std::abs(acv[k] / r0_) < threshold) {
+          ++run;
+        } else {
+          run = 0;
+          m_hat = k;
+        }
+      }
+
+      const auto big_m = (std::min)((std::min)(2 * m_hat, m_max), max_lag);
+
+      g0_ = r0_;
+      for (std::size_t k = 1; k <= big_m; ++k) {
+        const auto w =
+            flat_top(static_cast<double>(k) / static_cast<double>(big_m)) * acv[k];
+        g0_ += 2.0 * w;
+        g_ += 2.0 * static_cast<double>(k) * w;
+      }
+    }
+
+    double r0() const { return r0_; }
+
+    double g0() const { return g0_; }
+
+    double g() const { return g_; }
+
+  private:
+    double r0_;
+    double g0_;
+    double g_;
+  };
+}
+
+// Automatic block length selection for the block bootstraps
+// Politis & White (2004) with the correction from Patton, Politis & White (2009)
+// Returns 1 for ResampleMethod::iid or when the series doesn't appear to be autocorrelated
+inline double optimal_block_length(const Times &series, const ResampleMethod method) {
+  const auto n = series.size();
+  if (method == ResampleMethod::iid || n < 4) {
+    return 1.0;
+  }
+
+  const detail::LongRunVariance lrv(series);
+  if (!(lrv.g0() > 0.0)) {
+    return 1.0;
+  }
+
+  const auto d = (method == ResampleMethod::stationary ? 2.0 : 4.0 / 3.0) * lrv.g0() * lrv.g0();
+  const auto b = std::cbrt(2.0 * lrv.g() * lrv.g() / d * static_cast<double>(n));
+
+  const auto nd = static_cast<double>(n);
+  const auto b_max = std::ceil((std::min)(3.0 * std::sqrt(nd), nd / 3.0));
+
+  return (std::min)((std::max)(b, 1.0), b_max);
+}
+
+// A diagnostic of how badly the measurements violate the iid assumption of the ordinary
+// bootstrap.  Measurements are taken in order so drift from thermal throttling, frequency
+// scaling, etc. shows up as positive autocorrelation.
+struct Autocorrelation {
+  Autocorrelation(const Times &times, const VeloxConfig &config)
+      : sample_size_(times.size()), lag1_(0.0),
+        critical_value_(1.96 / std::sqrt(static_cast<double>(times.size()))),
+        effective_sample_size_(static_cast<double>(times.size())),
+        method_(config.resample_method()), block_length_(1.0) {
+    assert(!times.empty() && "times must not be empty");
+
+    if (times.size() < 2) {
+      return;
+    }
+
+    const detail::LongRunVariance lrv(times);
+    if (!(lrv.r0() > 0.0)) {
+      return;
+    }
+
+    lag1_ = autocovariances(times, 1)[1] / lrv.r0();
+
+    if (lrv.g0() > 0.0) {
+      const auto n = static_cast<double>(sample_size_);
+      effective_sample_size_ = (std::min)((std::max)(n * lrv.r0() / lrv.g0(), 1.0), n);
+    }
+
+    block_length_ = config.block_length() > 0.0 ? config.block_length()
+                                                : optimal_block_length(times, method_);
+  }
+
+  std::size_t sample_size() const { return sample_size_; }
+
+  // The lag 1 autocorrelation of the per iteration times
+  double lag1() const { return lag1_; }
+
+  // Autocorrelations larger than this are significant at the 95% level for an iid sample
+  double critical_value() const { return critical_value_; }
+
+  bool significant() const { return std::abs(lag1_) > critical_value_; }
+
+  // The number of independent measurements the measurements are worth when estimating the mean
+  double effective_sample_size() const { return effective_sample_size_; }
+
+  ResampleMethod resample_method() const { return method_; }
+
+  // The block length used when resampling, 1 for ResampleMethod::iid
+  double block_length() const { return method_ == ResampleMethod::iid ? 1.0 : block_length_; }
+
+private:
+  std::size_t sample_size_;
+  double lag1_;
+  double critical_value_;
+  double effective_sample_size_;
+  ResampleMethod method_;
+  double block_length_;
+};
+}
+
+#endif // VELOX_AUTOCORRELATION_H_INCLUDED
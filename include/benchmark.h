@@ -4,8 +4,15 @@
 #include "util.h"
 #include "stopwatch.h"
 #include "outliers.h"
+#include "robust.h"
+#include "analytic.h"
+#include "schedule.h"
+#include "clock_resolution.h"
 #include "iters_for_duration.h"
 
+#include <numeric>
+#include <random>
+
 namespace velox {
 
 template <class C, class F>
@@ -41,14 +48,14 @@ struct Benchmark {
     return sm.elapsed();
   }
 
-  Measurements bench(const std::uint32_t num_measurements, const std::uint64_t base_iters) {
-    auto measurements = vector_with_capacity<Measurement>(num_measurements);
+  Measurements bench(const Schedule &schedule) {
+    auto measurements = vector_with_capacity<Measurement>(schedule.size());
 
-    std::uint64_t iters = base_iters;
-    std::generate_n(std::back_inserter(measurements), num_measurements, [this, base_iters, &iters] {
-      iters += base_iters;
-      return Measurement(iters, run(iters));
-    });
+    const auto first = C::now();
+    for (const auto iters : schedule) {
+      const auto start = std::chrono::duration_cast<Ns>(C::now() - first);
+      measurements.emplace_back(iters, run(iters), start);
+    }
 
     return measurements;
   }
@@ -67,13 +74,46 @@ inline Times times_from_measurements(const Measurements &measurements) {
   return ts;
 }
 
+// The time per iteration of a warm up
+inline double time_per_iteration(const ItersForDurationNs &wu) {
+  return static_cast<double>(wu.duration().count()) / static_cast<double>(wu.iters());
+}
+
+// Warms up for the configured time, or when cached, the warm up of an earlier run, is given only
+// long enough to check it still holds
 template <class C, class F>
-std::pair<Measurements, bool> measure(F &&f, const VeloxConfig &config, Reporter &reporter) {
+std::pair<ItersForDurationNs, bool> warm_up(Benchmark<C, F> &b,
+                                            const VeloxConfig &config,
+                                            const ItersForDurationNs *const cached,
+                                            Reporter &reporter) {
+  if (cached && cached->iters() && cached->duration().count()) {
+    reporter.warm_up_starting(config.verification_warm_up_time());
+
+    const auto verification = b.warm_up(config.verification_warm_up_time());
+    if (verification.second && verification.first.duration().count()) {
+      // Compared as a ratio so faster and slower functions are treated alike
+      const auto stored = time_per_iteration(*cached);
+      const auto verified = time_per_iteration(verification.first);
+      if ((std::max)(stored, verified) <=
+          (1.0 + config.warm_up_tolerance()) * (std::min)(stored, verified)) {
+        return {*cached, true};
+      }
+    }
+  }
+
   reporter.warm_up_starting(config.warm_up_time());
+  return b.warm_up(config.warm_up_time());
+}
 
+template <class C, class F>
+std::pair<Measurements, bool> measure(F &&f,
+                                      const VeloxConfig &config,
+                                      const FpNs clock_resolution,
+                                      Reporter &reporter,
+                                      const ItersForDurationNs *const cached = nullptr) {
   Benchmark<C, F> b(f);
 
-  const auto wu_result = b.warm_up(config.warm_up_time());
+  const auto wu_result = warm_up(b, config, cached, reporter);
   const auto &wu = wu_result.first;
 
   if (!wu_result.second || !wu.duration().count()) {
@@ -83,58 +123,124 @@ std::pair<Measurements, bool> measure(F &&f, const VeloxConfig &config, Reporter
 
   reporter.warm_up_ended(wu);
 
-  const auto mean_execution_time = static_cast<double>(wu.duration().count()) / wu.iters();
+  const auto mean_execution_time = time_per_iteration(wu);
   const auto mt =
       static_cast<double>(std::chrono::duration_cast<Ns>(config.measurement_time()).count());
-  const auto nm = config.num_measurements();
-  const auto base_iters = static_cast<std::uint64_t>(
-      std::ceil(2.0 * mt / mean_execution_time / static_cast<double>(nm * (nm + 1))));
-  const auto total_iters = [&config, &base_iters]() -> std::uint64_t {
-    std::uint64_t sum = 0;
-    auto iters = base_iters;
-    for (std::uint32_t i = 0; i < config.num_measurements(); ++i) {
-      iters += base_iters;
-      sum += iters;
+  const auto flat = use_flat_sampling(config, FpNs(mean_execution_time));
+  const auto nm = flat ? config.flat_num_measurements() : config.num_measurements();
+  // The minimum is capped at each measurement's even share of the measurement time so a coarse
+  // clock can't stretch the run without bound.  Measurements which are still too short are
+  // reported below.
+  const auto min_duration = clock_resolution * config.min_measurement_ticks();
+  const auto min_iters = min_iters_for_duration((std::min)(min_duration, FpNs(mt / nm)),
+                                                FpNs(mean_execution_time));
+
+  const auto schedule = [&]() -> Schedule {
+    if (flat) {
+      // The measurement time split evenly between the measurements
+      const auto iters = static_cast<std::uint64_t>(mt / mean_execution_time / nm);
+      return Schedule(nm, (std::max)(iters, min_iters));
     }
-    return sum;
+
+    // Every schedule's shortest measurement is at least twice the base iterations
+    const auto base_iters = (std::max)(
+        static_cast<std::uint64_t>(
+            std::ceil(2.0 * mt / mean_execution_time / static_cast<double>(nm * (nm + 1)))),
+        (min_iters + 1) / 2);
+    return iteration_schedule(nm, base_iters, config.iteration_schedule(), std::random_device{}());
   }();
+  const auto total_iters = std::accumulate(schedule.begin(), schedule.end(), std::uint64_t(0));
 
-  const auto estimated_time = FpNs{total_iters * mean_execution_time};
+  const auto estimated_time = FpNs{static_cast<double>(total_iters) * mean_execution_time};
 
   reporter.measurement_collection_starting(nm, estimated_time);
 
-  return {b.bench(nm, base_iters), true};
+  auto measurements = b.bench(schedule);
+
+  const auto num_short = count_short_measurements(measurements, min_duration);
+  if (num_short) {
+    reporter.measurements_too_short(num_short, measurements.size(), min_duration);
+  }
+
+  return {std::move(measurements), true};
+}
+
+// Everything after the measurements have been collected, which doesn't need a quiet machine
+inline void
+analyze(const Measurements &measurements, const VeloxConfig &config, Reporter &reporter) {
+  const auto times = times_from_measurements(measurements);
+  const SampleSummary summary(times);
+  const Outliers outliers(times, summary);
+
+  reporter.measurement_collection_ended(measurements, times, summary, outliers);
+
+  reporter.autocorrelation_estimated(Autocorrelation(times, config));
+  reporter.periodic_interference_estimated(PeriodicInterference(measurements));
+
+  reporter.estimate_statistics_starting(config.quick_mode() ? 0 : config.num_resamples());
+
+  // How much the outliers affect the sample is judged before the policy removes them
+  const OutlierVariance outlier_variance(summary);
+  const auto statistics = [&]() -> EstimatedStatistics {
+    if (config.outlier_policy() == OutlierPolicy::keep) {
+      return config.quick_mode()
+                 ? estimate_statistics_analytic(measurements, summary, config, outlier_variance)
+                 : estimate_statistics(measurements, times, summary, config, outlier_variance);
+    }
+
+    const auto analyzed =
+        apply_outlier_policy(measurements, times, outliers, config.outlier_policy());
+    const SampleSummary analyzed_summary(analyzed.times());
+    return config.quick_mode()
+               ? estimate_statistics_analytic(
+                     analyzed.measurements(), analyzed_summary, config, outlier_variance)
+               : estimate_statistics(analyzed.measurements(),
+                                     analyzed.times(),
+                                     analyzed_summary,
+                                     config,
+                                     outlier_variance);
+  }();
+
+  reporter.estimate_statistics_ended(statistics);
+  reporter.benchmark_ended();
 }
 
 template <class C, class F>
-void benchmark(const std::string &name, F &&f, const VeloxConfig &config, Reporter &reporter) {
+void benchmark(const std::string &name,
+               F &&f,
+               const VeloxConfig &config,
+               const FpNs clock_resolution,
+               Reporter &reporter,
+               const ItersForDurationNs *const cached = nullptr) {
   reporter.benchmark_starting(name);
 
-  const auto measure_result = measure<C>(std::forward<F>(f), config, reporter);
+  const auto measure_result =
+      measure<C>(std::forward<F>(f), config, clock_resolution, reporter, cached);
   if (!measure_result.second) {
     return;
   }
 
-  const auto &measurements = measure_result.first;
-  const auto times = times_from_measurements(measurements);
-  const Outliers outliers(times);
-
-  reporter.measurement_collection_ended(measurements, times, outliers);
+  analyze(measure_result.first, config, reporter);
+}
 
-  reporter.estimate_statistics_starting(config.num_resamples());
+template <class C, class F>
+void load_test(const std::string &name, F &&f, const LoadConfig &config, Reporter &reporter) {
+  reporter.load_test_starting(name, config);
 
-  const auto statistics =
-      estimate_statistics(measurements, times, config.num_resamples(), config.confidence_level());
+  for (const auto rate : config.rates()) {
+    reporter.load_point_measured(run_load<C>(f, rate, config));
+  }
 
-  reporter.estimate_statistics_ended(statistics);
-  reporter.benchmark_ended();
+  reporter.load_test_ended();
 }
 
 template <class C>
-FpNs estimate_clock_cost(const VeloxConfig &config, Reporter &reporter) {
+FpNs estimate_clock_cost(const VeloxConfig &config,
+                         const FpNs clock_resolution,
+                         Reporter &reporter) {
   reporter.estimate_clock_cost_starting();
 
-  const auto measure_result = measure<C>([]() { C::now(); }, config, reporter);
+  const auto measure_result = measure<C>([]() { C::now(); }, config, clock_resolution, reporter);
   const auto cost =
       measure_result.second ? median(times_from_measurements(measure_result.first)) : FpNs{0.0};
 
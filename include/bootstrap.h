@@ -6,9 +6,16 @@
 #include "stats.h"
 #include "regression.h"
 #include "measurement.h"
+#include "quantile_sketch.h"
+#include "velox_config.h"
+#include "autocorrelation.h"
+#include "custom_statistic.h"
+#include "sample_summary.h"
+#include "robust.h"
 
 #include <random>
 #include <future>
+#include <functional>
 
 namespace velox {
 
@@ -37,40 +44,324 @@ private:
   double confidence_level_;
 };
 
-inline Estimate<FpNs> make_estimate(const FpNs p, Times bootstrap, const double cl) {
-  std::sort(bootstrap.begin(), bootstrap.end());
+// The percentiles of a bootstrap distribution which bound a confidence interval
+struct IntervalPercentiles {
+  IntervalPercentiles(const double lower_p, const double upper_p)
+      : lower_(lower_p), upper_(upper_p) {}
+
+  double lower() const { return lower_; }
+
+  double upper() const { return upper_; }
+
+private:
+  double lower_;
+  double upper_;
+};
+
+inline IntervalPercentiles percentile_interval(const double cl) {
+  return IntervalPercentiles(50.0 * (1.0 - cl), 50.0 * (1.0 + cl));
+}
+
+// Efron's bias-corrected and accelerated interval
+// http://en.wikipedia.org/wiki/Bootstrapping_%28statistics%29#Methods_for_bootstrap_confidence_intervals
+// proportion_below is the fraction of the bootstrap distribution below the point estimate and
+// acceleration is usually calculated with jackknife_acceleration
+inline IntervalPercentiles bca_interval(const double proportion_below,
+                                        const double acceleration,
+                                        const std::uint64_t num_resamples,
+                                        const double cl) {
+  // Keep the bias correction finite when the point estimate is outside the bootstrap
+  // distribution
+  const auto half = 0.5 / static_cast<double>(num_resamples);
+  const auto z0 = normal_quantile((std::min)((std::max)(proportion_below, half), 1.0 - half));
+
+  const auto adjust = [z0, acceleration](const double alpha) -> double {
+    const auto z = z0 + normal_quantile(alpha);
+    const auto p = 100.0 * normal_cdf(z0 + z / (1.0 - acceleration * z));
+    return (std::min)((std::max)(p, 1e-9), 100.0);
+  };
+
+  return IntervalPercentiles(adjust(0.5 * (1.0 - cl)), adjust(0.5 * (1.0 + cl)));
+}
+
+// Acceleration for bca_interval estimated from the leave one out values of the statistic
+template <class T, class F>
+double jackknife_acceleration(const std::vector<T> &sample, F &&statistic) {
+  if (sample.size() < 3) {
+    return 0.0;
+  }
+
+  auto buffer = vector_with_capacity<T>(sample.size() - 1);
+  auto estimates = vector_with_capacity<double>(sample.size());
+
+  for (auto it = sample.begin(); it != sample.end(); ++it) {
+    buffer.assign(sample.begin(), it);
+    buffer.insert(buffer.end(), it + 1, sample.end());
+    estimates.push_back(statistic(static_cast<const std::vector<T> &>(buffer)));
+  }
+
+  const auto m = mean(estimates);
+  double num = 0.0, den = 0.0;
+  for (const auto e : estimates) {
+    const auto d = m - e;
+    num += d * d * d;
+    den += d * d;
+  }
+
+  if (!(den > 0.0)) {
+    return 0.0;
+  }
+
+  return num / (6.0 * std::pow(den, 1.5));
+}
+
+// Fraction of the sorted values less than t, with values equal to t counting as half
+template <class T>
+double proportion_below_of_sorted(const std::vector<T> &sorted, const T t) {
+  assert(!sorted.empty() && "Samples requires at least one value");
+
+  const auto range = std::equal_range(sorted.begin(), sorted.end(), t);
+  const auto below = range.first - sorted.begin();
+  const auto equal = range.second - range.first;
+
+  return (static_cast<double>(below) + static_cast<double>(equal) / 2.0) /
+         static_cast<double>(sorted.size());
+}
+
+inline Estimate<FpNs> make_estimate_of_sorted(const FpNs p,
+                                              const Times &bootstrap,
+                                              const IntervalPercentiles &interval,
+                                              const double cl) {
   const FpRange r(bootstrap);
 
   return Estimate<FpNs>(p,
                         FpNs(std_dev(r)),
-                        FpNs(percentile_of_sorted(r, 50.0 * (1.0 - cl))),
-                        FpNs(percentile_of_sorted(r, 50.0 * (1.0 + cl))),
+                        FpNs(percentile_of_sorted(r, interval.lower())),
+                        FpNs(percentile_of_sorted(r, interval.upper())),
                         cl);
 }
 
+inline Estimate<double> make_estimate_of_sorted(const double p,
+                                                const std::vector<double> &bootstrap,
+                                                const IntervalPercentiles &interval,
+                                                const double cl) {
+  return Estimate<double>(p,
+                          std_dev(bootstrap),
+                          percentile_of_sorted(bootstrap, interval.lower()),
+                          percentile_of_sorted(bootstrap, interval.upper()),
+                          cl);
+}
+
+inline Estimate<FpNs> make_estimate(const FpNs p, Times bootstrap, const double cl) {
+  std::sort(bootstrap.begin(), bootstrap.end());
+  return make_estimate_of_sorted(p, bootstrap, percentile_interval(cl), cl);
+}
+
 inline Estimate<double>
 make_estimate(const double p, std::vector<double> bootstrap, const double cl) {
   std::sort(bootstrap.begin(), bootstrap.end());
+  return make_estimate_of_sorted(p, bootstrap, percentile_interval(cl), cl);
+}
 
-  return Estimate<double>(p,
-                          std_dev(bootstrap),
-                          percentile_of_sorted(bootstrap, 50.0 * (1.0 - cl)),
-                          percentile_of_sorted(bootstrap, 50.0 * (1.0 + cl)),
-                          cl);
+template <class T>
+Estimate<T> make_estimate(const T p,
+                          const QuantileSketch<T> &bootstrap,
+                          const IntervalPercentiles &interval,
+                          const double cl) {
+  return Estimate<T>(p,
+                     bootstrap.std_dev(),
+                     bootstrap.percentile(interval.lower()),
+                     bootstrap.percentile(interval.upper()),
+                     cl);
+}
+
+template <class T>
+Estimate<T> make_estimate(const T p, const QuantileSketch<T> &bootstrap, const double cl) {
+  return make_estimate(p, bootstrap, percentile_interval(cl), cl);
 }
 
 template <class T>
 struct EstimateAndDistribution {
   EstimateAndDistribution(const Estimate<T> &est, std::vector<T> &&dist)
-      : estimate_(est), distribution_(std::move(dist)) {}
+      : estimate_(est), storage_(DistributionStorage::full), distribution_(std::move(dist)) {}
+
+  EstimateAndDistribution(const Estimate<T> &est, QuantileSketch<T> &&sk)
+      : estimate_(est), storage_(DistributionStorage::sketch), sketch_(std::move(sk)) {}
+
+  EstimateAndDistribution(const Estimate<T> &est)
+      : estimate_(est), storage_(DistributionStorage::none) {}
 
   const Estimate<T> &estimate() const { return estimate_; }
 
-  const std::vector<T> distribution() const { return distribution_; }
+  DistributionStorage storage() const { return storage_; }
+
+  // Every resampled value, empty unless the storage is DistributionStorage::full
+  const std::vector<T> &distribution() const { return distribution_; }
+
+  // Empty unless the storage is DistributionStorage::sketch
+  const QuantileSketch<T> &sketch() const { return sketch_; }
 
 private:
   Estimate<T> estimate_;
+  DistributionStorage storage_;
   std::vector<T> distribution_;
+  QuantileSketch<T> sketch_;
+};
+
+// Collects the bootstrap distribution of a statistic in the representation chosen by
+// VeloxConfig::distribution_storage and turns it into an estimate using
+// VeloxConfig::interval_method
+template <class T>
+struct BootstrapDistribution {
+  BootstrapDistribution(const VeloxConfig &config)
+      : storage_(config.distribution_storage()), method_(config.interval_method()),
+        cl_(config.confidence_level()), sketch_(config.sketch_size()), num_sorted_(0),
+        acceleration_(0.0), has_acceleration_(false) {
+    if (storage_ == DistributionStorage::full) {
+      values_.reserve(config.num_resamples());
+    }
+  }
+
+  void add(const T t) {
+    if (storage_ == DistributionStorage::full) {
+      values_.push_back(t);
+    } else {
+      sketch_.add(t);
+    }
+  }
+
+  // The estimate from the resamples added so far.  acceleration is only called for
+  // IntervalMethod::bca, and only once.
+  template <class F>
+  Estimate<T> estimate(const T point, F &&acceleration) {
+    if (storage_ == DistributionStorage::full) {
+      const auto &sorted = sorted_values();
+      const auto interval =
+          make_interval(proportion_below_of_sorted(sorted, point), sorted.size(), acceleration);
+      return make_estimate_of_sorted(point, sorted, interval, cl_);
+    }
+
+    const auto interval =
+        make_interval(sketch_.proportion_below(point), sketch_.count(), acceleration);
+    return make_estimate(point, sketch_, interval, cl_);
+  }
+
+  template <class F>
+  EstimateAndDistribution<T> finish(const T point, F &&acceleration) {
+    const auto e = estimate(point, acceleration);
+
+    switch (storage_) {
+    case DistributionStorage::full:
+      sorted_.clear();
+      sorted_.shrink_to_fit();
+      return EstimateAndDistribution<T>(e, std::move(values_));
+    case DistributionStorage::sketch:
+      return EstimateAndDistribution<T>(e, std::move(sketch_));
+    case DistributionStorage::none:
+      break;
+    }
+
+    return EstimateAndDistribution<T>(e);
+  }
+
+private:
+  // values_ has to stay in resample order so a sorted copy is kept up to date by merging in
+  // the values added since the last estimate
+  const std::vector<T> &sorted_values() {
+    using Diff = typename std::vector<T>::difference_type;
+    const auto old_size = static_cast<Diff>(sorted_.size());
+
+    sorted_.insert(sorted_.end(), values_.begin() + static_cast<Diff>(num_sorted_), values_.end());
+    std::sort(sorted_.begin() + old_size, sorted_.end());
+    std::inplace_merge(sorted_.begin(), sorted_.begin() + old_size, sorted_.end());
+    num_sorted_ = values_.size();
+    return sorted_;
+  }
+
+  template <class F>
+  IntervalPercentiles
+  make_interval(const double proportion_below, const std::uint64_t n, F &&acceleration) {
+    switch (method_) {
+    case IntervalMethod::percentile:
+      break;
+    case IntervalMethod::bca:
+      if (!has_acceleration_) {
+        acceleration_ = acceleration();
+        has_acceleration_ = true;
+      }
+      return bca_interval(proportion_below, acceleration_, n, cl_);
+    }
+
+    return percentile_interval(cl_);
+  }
+
+private:
+  DistributionStorage storage_;
+  IntervalMethod method_;
+  double cl_;
+  std::vector<T> values_;
+  QuantileSketch<T> sketch_;
+  std::vector<T> sorted_;
+  std::size_t num_sorted_;
+  double acceleration_;
+  bool has_acceleration_;
+};
+
+// Decides when adaptive resampling can stop.  The estimates of every statistic are compared
+// after each chunk of resamples and the bootstrap has converged once none of the confidence
+// interval endpoints moved by more than the tolerance (relative to the interval's width) and none
+// of the standard errors changed by more than the tolerance (relative to the standard error).
+struct ConvergenceCheck {
+  ConvergenceCheck(const double tolerance) : tolerance_(tolerance), has_previous_(false) {}
+
+  template <class T>
+  void add(const Estimate<T> &e) {
+    current_.push_back(sketch_value(e.lower_bound()));
+    current_.push_back(sketch_value(e.upper_bound()));
+    current_.push_back(sketch_value(e.standard_error()));
+  }
+
+  // Compares the estimates added since the last call to the previous ones
+  bool converged() {
+    const auto tiny = 1e-300;
+    auto result = has_previous_ && previous_.size() == current_.size();
+
+    for (std::size_t i = 0; result && i < current_.size(); i += 3) {
+      const auto width = (std::max)(std::abs(current_[i + 1] - current_[i]), tiny);
+      const auto se = (std::max)(std::abs(current_[i + 2]), tiny);
+
+      result = std::abs(current_[i] - previous_[i]) / width <= tolerance_ &&
+               std::abs(current_[i + 1] - previous_[i + 1]) / width <= tolerance_ &&
+               std::abs(current_[i + 2] - previous_[i + 2]) / se <= tolerance_;
+    }
+
+    previous_.swap(current_);
+    current_.clear();
+    has_previous_ = true;
+
+    return result;
+  }
+
+private:
+  double tolerance_;
+  bool has_previous_;
+  std::vector<double> previous_;
+  std::vector<double> current_;
+};
+
+// The estimate of a statistic added with VeloxConfig::add_statistic
+struct CustomEstimate : EstimateAndDistribution<double> {
+  CustomEstimate(const CustomStatistic &statistic, EstimateAndDistribution<double> &&ed)
+      : EstimateAndDistribution<double>(std::move(ed)), name_(statistic.name()),
+        unit_(statistic.unit()) {}
+
+  const std::string &name() const { return name_; }
+
+  StatisticUnit unit() const { return unit_; }
+
+private:
+  std::string name_;
+  StatisticUnit unit_;
 };
 
 struct EstimatedStatistics {
@@ -79,10 +370,19 @@ struct EstimatedStatistics {
                       EstimateAndDistribution<FpNs> &&std_devs,
                       EstimateAndDistribution<FpNs> &&mads,
                       EstimateAndDistribution<FpNs> &&lls,
-                      EstimateAndDistribution<double> &&r2s)
+                      EstimateAndDistribution<double> &&r2s,
+                      EstimateAndDistribution<FpNs> &&slopes,
+                      EstimateAndDistribution<FpNs> &&overheads,
+                      const OutlierVariance &ov,
+                      const std::uint32_t resamples,
+                      const bool flat,
+                      const bool analytic,
+                      std::vector<CustomEstimate> &&customs = std::vector<CustomEstimate>())
       : mean_(std::move(means)), median_(std::move(medians)), std_dev_(std::move(std_devs)),
         median_abs_dev_(std::move(mads)), linear_least_squares_(std::move(lls)),
-        r_squared_(std::move(r2s)) {}
+        r_squared_(std::move(r2s)), slope_(std::move(slopes)), overhead_(std::move(overheads)),
+        outlier_variance_(ov), num_resamples_(resamples), flat_sampling_(flat),
+        analytic_(analytic), custom_(std::move(customs)) {}
 
   const EstimateAndDistribution<FpNs> &mean() const { return mean_; }
 
@@ -98,6 +398,31 @@ struct EstimatedStatistics {
 
   const EstimateAndDistribution<double> &r_squared() const { return r_squared_; }
 
+  // The time per iteration from a regression with an intercept
+  const EstimateAndDistribution<FpNs> &slope() const { return slope_; }
+
+  // The intercept of that regression, the fixed cost of each measurement
+  const EstimateAndDistribution<FpNs> &overhead() const { return overhead_; }
+
+  // How much of the variance of the sample is caused by outliers
+  const OutlierVariance &outlier_variance() const { return outlier_variance_; }
+
+  // The number of resamples which were actually used, which may be less than
+  // VeloxConfig::num_resamples with adaptive resampling
+  std::uint32_t num_resamples() const { return num_resamples_; }
+
+  // Whether every measurement ran the same number of iterations.  The regression statistics are
+  // meaningless then: LLS and slope reduce to the mean of the measurements' times per iteration,
+  // the overhead is 0 and r^2 is 0.
+  bool flat_sampling() const { return flat_sampling_; }
+
+  // Whether the intervals are quick mode's analytic approximations rather than bootstrapped, in
+  // which case num_resamples is 0
+  bool analytic() const { return analytic_; }
+
+  // The statistics added with VeloxConfig::add_statistic, in the order they were added
+  const std::vector<CustomEstimate> &custom() const { return custom_; }
+
 private:
   EstimateAndDistribution<FpNs> mean_;
   EstimateAndDistribution<FpNs> median_;
@@ -105,6 +430,13 @@ private:
   EstimateAndDistribution<FpNs> median_abs_dev_;
   EstimateAndDistribution<FpNs> linear_least_squares_;
   EstimateAndDistribution<double> r_squared_;
+  EstimateAndDistribution<FpNs> slope_;
+  EstimateAndDistribution<FpNs> overhead_;
+  OutlierVariance outlier_variance_;
+  std::uint32_t num_resamples_;
+  bool flat_sampling_;
+  bool analytic_;
+  std::vector<CustomEstimate> custom_;
 };
 
 template <template <class> class D, class T, class S, class F>
@@ -121,73 +453,263 @@ resample(const std::vector<T> &sample, const std::uint32_t num_resamples, const
   }
 }
 
+// Resamples blocks of consecutive values so the resamples keep the autocorrelation of the sample.
+// Blocks wrap around at the end of the sample.
+template <template <class> class D, class T, class S, class F>
+void resample_blocks(const std::vector<T> &sample,
+                     const std::uint32_t num_resamples,
+                     const S seed,
+                     const ResampleMethod method,
+                     const double block_length,
+                     F &&f) {
+  assert(block_length >= 1.0 && "Block length must be at least 1");
+
+  std::mt19937 rng(static_cast<std::mt19937::result_type>(seed));
+  D<std::size_t> distribution(0, sample.size() - 1);
+  std::geometric_distribution<std::size_t> extra_length(1.0 / block_length);
+
+  const auto n = sample.size();
+  const auto fixed_length = static_cast<std::size_t>(std::round(block_length));
+  auto resample = sample;
+
+  for (std::uint32_t i = 0; i < num_resamples; ++i) {
+    std::size_t pos = 0, left_in_block = 0;
+
+    for (auto &r : resample) {
+      if (left_in_block == 0) {
+        pos = distribution(rng);
+        left_in_block =
+            method == ResampleMethod::stationary ? 1 + extra_length(rng) : fixed_length;
+      }
+
+      r = sample[pos];
+      pos = pos + 1 == n ? 0 : pos + 1;
+      --left_in_block;
+    }
+
+    f(resample);
+  }
+}
+
+template <template <class> class D, class T, class S, class F>
+void resample(const std::vector<T> &sample,
+              const std::uint32_t num_resamples,
+              const S seed,
+              const ResampleMethod method,
+              const double block_length,
+              F &&f) {
+  switch (method) {
+  case ResampleMethod::iid:
+    break;
+  case ResampleMethod::moving_block:
+  case ResampleMethod::stationary:
+    if (block_length > 1.0) {
+      resample_blocks<D>(sample, num_resamples, seed, method, block_length, std::forward<F>(f));
+      return;
+    }
+    break;
+  }
+
+  resample<D>(sample, num_resamples, seed, std::forward<F>(f));
+}
+
+// The outlier variance is passed in so it can describe the whole sample when the statistics are
+// estimated from what apply_outlier_policy left of it
 template <template <class> class D = std::uniform_int_distribution>
 inline EstimatedStatistics estimate_statistics(const Measurements &measurements,
                                                const Times &times,
-                                               const std::uint32_t num_resamples,
-                                               const double cl) {
-  auto means = vector_with_capacity<FpNs>(num_resamples);
-  auto medians = vector_with_capacity<FpNs>(num_resamples);
-  auto std_devs = vector_with_capacity<FpNs>(num_resamples);
-  auto mads = vector_with_capacity<FpNs>(num_resamples);
+                                               const SampleSummary &summary,
+                                               const VeloxConfig &config,
+                                               const OutlierVariance &outlier_variance) {
+  const auto max_resamples = config.num_resamples();
+  const auto method = config.resample_method();
+  const auto block_length = config.block_length() > 0.0 ? config.block_length()
+                                                        : optimal_block_length(times, method);
+
+  BootstrapDistribution<FpNs> means(config), medians(config), std_devs(config), mads(config);
 
   const auto points = measurements_to_points(measurements);
-  auto lls = vector_with_capacity<FpNs>(num_resamples);
-  auto r2s = vector_with_capacity<double>(num_resamples);
+  BootstrapDistribution<FpNs> lls(config);
+  BootstrapDistribution<double> r2s(config);
+  BootstrapDistribution<FpNs> slopes(config), overheads(config);
 
   auto mad_buffer = vector_with_capacity<double>(times.size());
 
+  const auto &sorted_sample = summary.sorted();
+  const FpRange r(sorted_sample);
+  const auto mean_point = summary.mean();
+  const auto median_point = summary.median();
+  const auto std_dev_point = summary.std_dev();
+  const auto mad_point = FpNs{median_abs_dev_of_sorted_destructive(r, mad_buffer)};
+
+  const auto flat = is_flat(measurements);
+
+  const auto regression = config.regression_method();
+  const auto lls_point = FpNs{fit_slope(points, regression)};
+  const auto r2_point = r_squared(points, lls_point.count());
+  const auto line = fit_line(points, regression);
+  const auto slope_point = FpNs{line.slope()};
+  const auto overhead_point = FpNs{line.intercept()};
+
+  // Leaving a value out of a sorted sample leaves it sorted so the jackknife can use the
+  // *_of_sorted functions
+  const auto jackknife = [&sorted_sample](double (*f)(const Times &)) {
+    return [&sorted_sample, f] { return jackknife_acceleration(sorted_sample, f); };
+  };
+
+  const auto mean_acceleration =
+      jackknife([](const Times &s) -> double { return mean(FpRange(s)); });
+  const auto median_acceleration =
+      jackknife([](const Times &s) -> double { return median_of_sorted(FpRange(s)); });
+  const auto std_dev_acceleration =
+      jackknife([](const Times &s) -> double { return std_dev(FpRange(s)); });
+  const auto mad_acceleration = jackknife([](const Times &s) -> double {
+    std::vector<double> buffer;
+    return median_abs_dev_of_sorted_destructive(FpRange(s), buffer);
+  });
+  const auto lls_acceleration = [&points, regression] {
+    return jackknife_acceleration(
+        points, [regression](const Points &ps) { return fit_slope(ps, regression); });
+  };
+  const auto r2_acceleration = [&points, regression] {
+    return jackknife_acceleration(points, [regression](const Points &ps) {
+      return r_squared(ps, fit_slope(ps, regression));
+    });
+  };
+  const auto slope_acceleration = [&points, regression] {
+    return jackknife_acceleration(
+        points, [regression](const Points &ps) { return fit_line(ps, regression).slope(); });
+  };
+  const auto overhead_acceleration = [&points, regression] {
+    return jackknife_acceleration(
+        points, [regression](const Points &ps) { return fit_line(ps, regression).intercept(); });
+  };
+
+  const auto &customs = config.statistics();
+  auto custom_points = vector_with_capacity<double>(customs.size());
+  std::vector<BootstrapDistribution<double>> custom_distributions;
+  std::vector<std::function<double()>> custom_accelerations;
+  for (const auto &c : customs) {
+    custom_points.push_back(c(sorted_sample));
+    custom_distributions.emplace_back(config);
+    custom_accelerations.emplace_back(
+        [&sorted_sample, &c] { return jackknife_acceleration(sorted_sample, c); });
+  }
+
   const auto seed = std::random_device{}();
 
-  auto sorted_stat_calcs = std::async(std::launch::async, [&] {
-    resample<D>(times, num_resamples, seed, [&](Times &s) {
-      std::sort(s.begin(), s.end());
-      FpRange r(s);
+  // Without adaptive resampling everything is done in a single chunk
+  const auto chunk_size =
+      config.adaptive_resampling() ? (std::min)(config.resample_chunk_size(), max_resamples)
+                                   : max_resamples;
+  ConvergenceCheck convergence(config.resample_tolerance());
+  std::uint32_t num_resamples = 0;
+
+  for (std::uint32_t chunk = 0; num_resamples < max_resamples; ++chunk) {
+    const auto n = (std::min)(chunk_size, max_resamples - num_resamples);
+    const auto chunk_seed = seed + chunk;
+
+    auto sorted_stat_calcs = std::async(std::launch::async, [&] {
+      resample<D>(times, n, chunk_seed, method, block_length, [&](Times &s) {
+        std::sort(s.begin(), s.end());
+        FpRange sr(s);
+
+        for (std::size_t i = 0; i < customs.size(); ++i) {
+          custom_distributions[i].add(customs[i](s));
+        }
+
+        medians.add(FpNs(median_of_sorted(sr)));
+        mads.add(FpNs(median_abs_dev_of_sorted_destructive(sr, mad_buffer)));
+      });
+    });
 
-      medians.push_back(FpNs(median_of_sorted(r)));
-      mads.push_back(FpNs(median_abs_dev_of_sorted_destructive(r, mad_buffer)));
+    auto stat_calcs = std::async(std::launch::async, [&] {
+      resample<D>(times, n, chunk_seed, method, block_length, [&](const Times &s) {
+        FpRange sr(s);
+        means.add(FpNs(mean(sr)));
+        std_devs.add(FpNs(std_dev(sr)));
+      });
     });
-  });
 
-  auto stat_calcs = std::async(std::launch::async, [&] {
-    resample<D>(times, num_resamples, seed, [&](const Times &s) {
-      FpRange r(s);
-      means.push_back(FpNs(mean(r)));
-      std_devs.push_back(FpNs(std_dev(r)));
+    resample<D>(points, n, chunk_seed, method, block_length, [&](const Points &ps) {
+      const auto s = fit_slope(ps, regression);
+      lls.add(FpNs{s});
+      r2s.add(r_squared(ps, s));
+
+      const auto l = fit_line(ps, regression);
+      slopes.add(FpNs{l.slope()});
+      overheads.add(FpNs{l.intercept()});
     });
-  });
 
-  resample<D>(points, num_resamples, seed, [&](const Points &ps) {
-    const auto s = slope(ps);
-    lls.push_back(FpNs{s});
-    r2s.push_back(r_squared(ps, s));
-  });
+    sorted_stat_calcs.get();
+    stat_calcs.get();
+
+    num_resamples += n;
+
+    if (num_resamples >= max_resamples || num_resamples < config.min_resamples()) {
+      continue;
+    }
+
+    convergence.add(means.estimate(mean_point, mean_acceleration));
+    convergence.add(medians.estimate(median_point, median_acceleration));
+    convergence.add(std_devs.estimate(std_dev_point, std_dev_acceleration));
+    convergence.add(mads.estimate(mad_point, mad_acceleration));
+    convergence.add(lls.estimate(lls_point, lls_acceleration));
+    convergence.add(r2s.estimate(r2_point, r2_acceleration));
+    convergence.add(slopes.estimate(slope_point, slope_acceleration));
+    convergence.add(overheads.estimate(overhead_point, overhead_acceleration));
+    for (std::size_t i = 0; i < customs.size(); ++i) {
+      convergence.add(custom_distributions[i].estimate(custom_points[i], custom_accelerations[i]));
+    }
+
+    if (convergence.converged()) {
+      break;
+    }
+  }
+
+  auto custom_estimates = vector_with_capacity<CustomEstimate>(customs.size());
+  for (std::size_t i = 0; i < customs.size(); ++i) {
+    custom_estimates.emplace_back(
+        customs[i], custom_distributions[i].finish(custom_points[i], custom_accelerations[i]));
+  }
 
-  sorted_stat_calcs.get();
-  stat_calcs.get();
+  return EstimatedStatistics(means.finish(mean_point, mean_acceleration),
+                             medians.finish(median_point, median_acceleration),
+                             std_devs.finish(std_dev_point, std_dev_acceleration),
+                             mads.finish(mad_point, mad_acceleration),
+                             lls.finish(lls_point, lls_acceleration),
+                             r2s.finish(r2_point, r2_acceleration),
+                             slopes.finish(slope_point, slope_acceleration),
+                             overheads.finish(overhead_point, overhead_acceleration),
+                             outlier_variance,
+                             num_resamples,
+                             flat,
+                             false,
+                             std::move(custom_estimates));
+}
 
-  const auto sorted_sample = [&times]() -> Times {
-    auto temp = times;
-    std::sort(temp.begin(), temp.end());
-    return temp;
-  }();
-  const FpRange r(sorted_sample);
-  const auto mean_point = FpNs{mean(r)};
-  const auto median_point = FpNs{median_of_sorted(r)};
-  const auto std_dev_point = FpNs{std_dev(r)};
-  const auto mad_point = FpNs{median_abs_dev_of_sorted_destructive(r, mad_buffer)};
+template <template <class> class D = std::uniform_int_distribution>
+inline EstimatedStatistics estimate_statistics(const Measurements &measurements,
+                                               const Times &times,
+                                               const SampleSummary &summary,
+                                               const VeloxConfig &config) {
+  return estimate_statistics<D>(measurements, times, summary, config, OutlierVariance(summary));
+}
 
-  const auto lls_point = FpNs{slope(points)};
-  const auto r2_point = r_squared(points, lls_point.count());
+template <template <class> class D = std::uniform_int_distribution>
+inline EstimatedStatistics estimate_statistics(const Measurements &measurements,
+                                               const Times &times,
+                                               const VeloxConfig &config) {
+  return estimate_statistics<D>(measurements, times, SampleSummary(times), config);
+}
 
-  return EstimatedStatistics(
-      EstimateAndDistribution<FpNs>(make_estimate(mean_point, means, cl), std::move(means)),
-      EstimateAndDistribution<FpNs>(make_estimate(median_point, medians, cl), std::move(medians)),
-      EstimateAndDistribution<FpNs>(make_estimate(std_dev_point, std_devs, cl),
-                                    std::move(std_devs)),
-      EstimateAndDistribution<FpNs>(make_estimate(mad_point, mads, cl), std::move(mads)),
-      EstimateAndDistribution<FpNs>(make_estimate(lls_point, lls, cl), std::move(lls)),
-      EstimateAndDistribution<double>(make_estimate(r2_point, r2s, cl), std::move(r2s)));
+template <template <class> class D = std::uniform_int_distribution>
+inline EstimatedStatistics estimate_statistics(const Measurements &measurements,
+                                               const Times &times,
+                                               const std::uint32_t num_resamples,
+                                               const double cl) {
+  return estimate_statistics<D>(
+      measurements, times, VeloxConfig().num_resamples(num_resamples).confidence_level(cl));
 }
 }
 
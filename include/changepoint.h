@@ -0,0 +1,143 @@
+#ifndef VELOX_CHANGEPOINT_H_INCLUDED
+#define VELOX_CHANGEPOINT_H_INCLUDED
+
+#include "util.h"
+#include "stats.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+namespace velox {
+
+namespace detail {
+  // The noise of a series which may contain a few shifts in its level: the median absolute
+  // difference of consecutive values, scaled so it estimates the standard deviation of normal
+  // noise.  Differences only straddle a shift once per changepoint so they barely move it.
+  inline double noise_variance(const std::vector<double> &series) {
+    if (series.size() < 3) {
+      return 0.0;
+    }
+
+    auto diffs = vector_with_capacity<double>(series.size() - 1);
+    for (std::size_t i = 1; i < series.size(); ++i) {
+      diffs.push_back(std::abs(series[i] - series[i - 1]));
+    }
+
+    const auto mid = diffs.begin() + static_cast<std::ptrdiff_t>(diffs.size() / 2);
+    std::nth_element(diffs.begin(), mid, diffs.end());
+
+    // The difference of two independent values has twice their variance
+    const auto sd = 1.4826 * *mid;
+    return sd * sd / 2.0;
+  }
+
+  // Replaces each value with the median of it and its neighbours, which removes single outliers
+  // but keeps the position of every shift that lasts at least two values
+  inline std::vector<double> median_of_three(const std::vector<double> &series) {
+    auto filtered = series;
+    for (std::size_t i = 1; i + 1 < series.size(); ++i) {
+      const auto a = series[i - 1], b = series[i], c = series[i + 1];
+      filtered[i] = (std::max)((std::min)(a, b), (std::min)((std::max)(a, b), c));
+    }
+    return filtered;
+  }
+}
+
+// Where the level of a series shifts, found with PELT (Killick, Fearnhead & Eckley, 2012) using
+// the cost of a change in the mean of normal noise with the given variance.  Each change must
+// lower the cost by more than the penalty and no segment is shorter than min_segment_length, so
+// a single noisy value can't become a segment of its own.
+//
+// Returns the index of the first value of each segment after the first, in increasing order.
+inline std::vector<std::size_t> detect_changepoints(const std::vector<double> &series,
+                                                    const double variance,
+                                                    const double penalty,
+                                                    const std::size_t min_segment_length = 2) {
+  assert(min_segment_length > 0 && "Segments must contain at least one value");
+  assert(penalty >= 0.0 && "Penalty must not be negative");
+
+  const auto n = series.size();
+  if (n < 2 * min_segment_length || !(variance > 0.0)) {
+    return std::vector<std::size_t>();
+  }
+
+  // Prefix sums of the centred series so a segment's cost takes constant time
+  const auto centre = mean(series);
+  std::vector<double> sums(n + 1, 0.0), squares(n + 1, 0.0);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto v = series[i] - centre;
+    sums[i + 1] = sums[i] + v;
+    squares[i + 1] = squares[i] + v * v;
+  }
+
+  const auto cost = [&](const std::size_t first, const std::size_t last) {
+    const auto s = sums[last] - sums[first];
+    const auto ss = squares[last] - squares[first] - s * s / static_cast<double>(last - first);
+    return (std::max)(ss, 0.0) / variance;
+  };
+
+  // best[t] is the cost of the best segmentation of the first t values and previous[t] the start
+  // of its last segment
+  std::vector<double> best(n + 1, 0.0);
+  std::vector<std::size_t> previous(n + 1, 0), candidates(1, 0);
+  best[0] = -penalty;
+
+  for (auto t = min_segment_length; t <= n; ++t) {
+    if (t >= 2 * min_segment_length) {
+      candidates.push_back(t - min_segment_length);
+    }
+
+    auto lowest = best[candidates.front()] + cost(candidates.front(), t);
+    previous[t] = candidates.front();
+    for (const auto c : candidates) {
+      const auto f = best[c] + cost(c, t);
+      if (f < lowest) {
+        lowest = f;
+        previous[t] = c;
+      }
+    }
+    best[t] = lowest + penalty;
+
+    // A start which can't beat the best segmentation now never will
+    candidates.erase(std::remove_if(candidates.begin(),
+                                    candidates.end(),
+                                    [&](const std::size_t c) {
+                                      return best[c] + cost(c, t) > best[t];
+                                    }),
+                     candidates.end());
+  }
+
+  std::vector<std::size_t> changepoints;
+  for (auto t = previous[n]; t > 0; t = previous[t]) {
+    changepoints.push_back(t);
+  }
+  std::reverse(changepoints.begin(), changepoints.end());
+
+  return changepoints;
+}
+
+// Changepoints with the noise estimated from the series itself and a penalty of 3 log n, which
+// keeps the number of false changepoints in a series of pure noise low.  The series is smoothed
+// with a running median first so a single outlying value isn't reported as a shift and back.
+// standard_errors, the standard errors of the values, are the fallback when the series is too
+// short or too regular to estimate its noise.
+inline std::vector<std::size_t> detect_changepoints(const std::vector<double> &series,
+                                                    const std::vector<double> &standard_errors) {
+  auto variance = detail::noise_variance(series);
+
+  if (!(variance > 0.0) && !standard_errors.empty()) {
+    double sum = 0.0;
+    for (const auto se : standard_errors) {
+      sum += se * se;
+    }
+    variance = sum / static_cast<double>(standard_errors.size());
+  }
+
+  const auto n = static_cast<double>((std::max)(series.size(), std::size_t(2)));
+  return detect_changepoints(detail::median_of_three(series), variance, 3.0 * std::log(n));
+}
+}
+
+#endif // VELOX_CHANGEPOINT_H_INCLUDED
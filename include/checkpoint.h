@@ -0,0 +1,317 @@
+#ifndef VELOX_CHECKPOINT_H_INCLUDED
+#define VELOX_CHECKPOINT_H_INCLUDED
+
+#include "history.h"
+#include "clock_resolution.h"
+#include "velox_config.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace velox {
+
+// A finished benchmark from a checkpoint file: what was reported while measuring it, its
+// measurements and the estimates of its mean and median
+struct CheckpointEntry {
+  CheckpointEntry(const ItersForDurationNs &warm_up,
+                  const FpNs estimated_time,
+                  const FpNs min_duration,
+                  HistoryEntry &&result)
+      : warm_up_(warm_up), estimated_time_(estimated_time), min_duration_(min_duration),
+        result_(std::move(result)) {}
+
+  const std::string &name() const { return result_.benchmark(); }
+
+  const ItersForDurationNs &warm_up() const { return warm_up_; }
+
+  FpNs estimated_time() const { return estimated_time_; }
+
+  // The shortest a measurement could be without the clock's granularity distorting it, 0 unless
+  // some of the measurements were shorter
+  FpNs min_duration() const { return min_duration_; }
+
+  const Measurements &measurements() const { return result_.raw_measurements(); }
+
+  const HistoryEntry &result() const { return result_; }
+
+private:
+  ItersForDurationNs warm_up_;
+  FpNs estimated_time_;
+  FpNs min_duration_;
+  HistoryEntry result_;
+};
+
+// Writes an entry as one line of a checkpoint: the warm up's iterations and duration, the
+// estimated and minimum measurement times followed by the fields of a history entry with the raw
+// measurements and an empty revision
+inline void write_checkpoint_entry(BufferedWriter &out, const CheckpointEntry &entry) {
+  out << entry.warm_up().iters() << '\t' << entry.warm_up().duration().count() << '\t'
+      << entry.estimated_time().count() << '\t' << entry.min_duration().count() << '\t';
+  write_history_entry(out, entry.result());
+}
+
+// Reads the finished benchmarks of a checkpoint in the order they finished, skipping the
+// environment, malformed lines and a last line without a line break, which was cut short when
+// the suite was killed
+inline std::vector<CheckpointEntry> read_checkpoint(std::istream &is) {
+  std::vector<CheckpointEntry> entries;
+  std::vector<HistoryEntry> parsed;
+  std::string line;
+
+  while (std::getline(is, line) && !is.eof()) {
+    const auto fields = detail::split_history_line(line);
+    if (fields.size() < 4 || !detail::read_history_entry(fields, 4, parsed)) {
+      continue;
+    }
+
+    auto result = std::move(parsed.back());
+    parsed.pop_back();
+
+    long long iters = 0, duration = 0;
+    const char *iters_end = nullptr, *duration_end = nullptr;
+    double estimated = 0.0, min_duration = 0.0;
+    if (result.raw_measurements().empty() ||
+        !detail::parse_history_integer(fields[0].c_str(), &iters_end, iters) || *iters_end ||
+        !detail::parse_history_integer(fields[1].c_str(), &duration_end, duration) ||
+        *duration_end || !detail::parse_history_double(fields[2], estimated) ||
+        !detail::parse_history_double(fields[3], min_duration)) {
+      continue;
+    }
+
+    entries.emplace_back(ItersForDurationNs(static_cast<std::uint64_t>(iters), Ns(duration)),
+                         FpNs(estimated),
+                         FpNs(min_duration),
+                         std::move(result));
+  }
+
+  return entries;
+}
+
+inline std::vector<CheckpointEntry> read_checkpoint(const std::string &path) {
+  std::ifstream file(path);
+  return read_checkpoint(file);
+}
+
+namespace {
+  const char *const ENVIRONMENT_LINE = "#environment";
+}
+
+// A description of the machine and build which produced some results, which should be the same
+// for results that are compared or combined: the clock, the compiler, the size of a pointer and
+// the number of hardware threads
+inline std::string environment_fingerprint(const std::string &clock, const bool is_steady) {
+  std::ostringstream fingerprint;
+  fingerprint << "clock=" << clock << (is_steady ? " (steady)" : " (unsteady)");
+#if defined(__clang__)
+  fingerprint << "; compiler=clang " << __clang_major__ << "." << __clang_minor__;
+#elif defined(__GNUC__)
+  fingerprint << "; compiler=gcc " << __GNUC__ << "." << __GNUC_MINOR__;
+#elif defined(_MSC_VER)
+  fingerprint << "; compiler=msvc " << _MSC_FULL_VER;
+#endif
+#ifdef NDEBUG
+  fingerprint << "; assertions=off";
+#else
+  fingerprint << "; assertions=on";
+#endif
+  fingerprint << "; pointer=" << sizeof(void *) * 8 << " bits";
+  fingerprint << "; hardware threads=" << std::thread::hardware_concurrency();
+  return fingerprint.str();
+}
+
+// The environment a checkpoint was written in, empty if it doesn't start with one
+inline std::string read_checkpoint_environment(std::istream &is) {
+  std::string line;
+  if (!std::getline(is, line) || is.eof()) {
+    return std::string();
+  }
+
+  const auto fields = detail::split_history_line(line);
+  return fields.size() == 2 && fields[0] == ENVIRONMENT_LINE ? fields[1] : std::string();
+}
+
+inline std::string read_checkpoint_environment(const std::string &path) {
+  std::ifstream file(path);
+  return read_checkpoint_environment(file);
+}
+
+// Reports the events of collecting a finished benchmark's measurements again, so they can be
+// analyzed as if they were new.  The warm up isn't repeated so there are no warm up events.
+inline void replay_measurement(const CheckpointEntry &entry, Reporter &reporter) {
+  const auto &measurements = entry.measurements();
+  reporter.measurement_collection_starting(static_cast<std::uint32_t>(measurements.size()),
+                                           entry.estimated_time());
+
+  const auto num_short = count_short_measurements(measurements, entry.min_duration());
+  if (num_short) {
+    reporter.measurements_too_short(num_short, measurements.size(), entry.min_duration());
+  }
+}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Writes each benchmark to a checkpoint file as soon as its statistics have been estimated.
+// Every entry is written as a single line with one write and flushed, so a suite which is killed
+// leaves at most a partial last line, which is ignored when the checkpoint is read.
+//
+// When resuming, the benchmarks already in the file can be taken with finished.  They aren't
+// written again when their events are reported a second time.  A new file starts with the
+// environment_fingerprint of the run.
+struct CheckpointReporter : Reporter {
+  // An empty path disables the checkpoint.  The benchmarks in the merged checkpoints, such as
+  // those of the shards of a suite, can be taken with finished too and are written to this
+  // checkpoint when they are reported.
+  CheckpointReporter(const std::string &path,
+                     const bool resume,
+                     const std::vector<std::string> &merged = std::vector<std::string>())
+      : new_file_(false), warm_up_(0, Ns(0)), estimated_time_(0.0), min_duration_(0.0) {
+    for (const auto &m : merged) {
+      auto entries = read_checkpoint(m);
+      std::move(entries.begin(), entries.end(), std::back_inserter(finished_));
+    }
+
+    if (!path.empty() && resume) {
+      auto entries = read_checkpoint(path);
+      for (const auto &e : entries) {
+        ++stored_[e.name()];
+      }
+      std::move(entries.begin(), entries.end(), std::back_inserter(finished_));
+    }
+    taken_.assign(finished_.size(), false);
+
+    if (path.empty()) {
+      return;
+    }
+
+    // Starts a new line if the last run was killed in the middle of one
+    std::ifstream existing(path, std::ios::binary | std::ios::ate);
+    const auto empty = !existing || existing.tellg() <= 0;
+    const auto partial_line =
+        resume && !empty && existing.seekg(-1, std::ios::end) && existing.get() != '\n';
+    existing.close();
+
+    new_file_ = !resume || empty;
+    file_.open(path, resume ? std::ios::app : std::ios::trunc);
+    if (partial_line) {
+      file_ << '\n';
+    }
+  }
+
+  CheckpointReporter &operator=(const CheckpointReporter &rhs) = delete;
+
+  // The next finished benchmark with the given name which hasn't been taken yet, or null
+  const CheckpointEntry *finished(const std::string &name) {
+    for (std::size_t i = 0; i < finished_.size(); ++i) {
+      if (!taken_[i] && finished_[i].name() == name) {
+        taken_[i] = true;
+        return &finished_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  // A new checkpoint starts with the environment it was written in
+  void suite_starting(const std::string &clock, bool is_steady) override {
+    if (file_.is_open() && new_file_) {
+      BufferedWriter out(file_);
+      out << ENVIRONMENT_LINE << '\t';
+      detail::write_history_field(out, environment_fingerprint(clock, is_steady));
+      out << '\n';
+      out.flush();
+      file_.flush();
+    }
+  }
+
+  // A replayed benchmark has no warm up events so it keeps the warm up it was stored with
+  void benchmark_starting(const std::string &name) override {
+    name_ = name;
+    const auto stored = std::find_if(finished_.begin(),
+                                     finished_.end(),
+                                     [&](const CheckpointEntry &e) { return e.name() == name; });
+    warm_up_ = stored == finished_.end() ? ItersForDurationNs(0, Ns(0)) : stored->warm_up();
+    measurements_.clear();
+    min_duration_ = FpNs(0);
+  }
+
+  void warm_up_ended(const ItersForDurationNs &wu) override { warm_up_ = wu; }
+
+  void measurement_collection_starting(std::uint32_t num_measurements,
+                                       FpNs measurement_time) override {
+    unused(num_measurements);
+    estimated_time_ = measurement_time;
+  }
+
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    unused(num_short, num_measurements);
+    min_duration_ = min_duration;
+  }
+
+  void measurement_collection_ended(const Measurements &measurements,
+                                    const Times &times,
+                                    const SampleSummary &summary,
+                                    const Outliers &outliers) override {
+    unused(times, summary, outliers);
+    measurements_ = measurements;
+  }
+
+  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
+    if (!file_.is_open()) {
+      return;
+    }
+
+    const auto stored = stored_.find(name_);
+    if (stored != stored_.end() && stored->second) {
+      --stored->second;
+      return;
+    }
+
+    const auto sample_size = measurements_.size();
+    const CheckpointEntry entry(warm_up_,
+                                estimated_time_,
+                                min_duration_,
+                                HistoryEntry("",
+                                             name_,
+                                             statistics.mean().estimate(),
+                                             statistics.median().estimate().point(),
+                                             sample_size,
+                                             std::move(measurements_)));
+
+    std::ostringstream line;
+    {
+      BufferedWriter out(line);
+      write_checkpoint_entry(out, entry);
+    }
+
+    const auto s = line.str();
+    file_.write(s.data(), static_cast<std::streamsize>(s.size()));
+    file_.flush();
+  }
+
+private:
+  std::ofstream file_;
+  bool new_file_;
+  std::vector<CheckpointEntry> finished_;
+  std::vector<bool> taken_;
+  std::map<std::string, std::size_t> stored_;
+  std::string name_;
+  ItersForDurationNs warm_up_;
+  FpNs estimated_time_;
+  FpNs min_duration_;
+  Measurements measurements_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+#endif // VELOX_CHECKPOINT_H_INCLUDED
@@ -0,0 +1,77 @@
+#ifndef VELOX_CLOCK_RESOLUTION_H_INCLUDED
+#define VELOX_CLOCK_RESOLUTION_H_INCLUDED
+
+#include "util.h"
+#include "measurement.h"
+#include "stats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace velox {
+
+namespace {
+  const std::uint32_t CLOCK_RESOLUTION_SAMPLES = 1000;
+  const Ms CLOCK_RESOLUTION_MAX_TIME(200);
+}
+
+namespace detail {
+  template <class C>
+  TimePoint<C> next_tick(const TimePoint<C> t) {
+    auto next = C::now();
+    while (next == t) {
+      next = C::now();
+    }
+    return next;
+  }
+}
+
+// The effective granularity of the clock: the median time between the clock's readings
+// changing.  For fine grained clocks this is dominated by the cost of reading the clock, for
+// coarse clocks by the tick length.  Sampling stops early for very coarse clocks.
+template <class C>
+FpNs estimate_clock_resolution() {
+  auto deltas = vector_with_capacity<FpNs>(CLOCK_RESOLUTION_SAMPLES);
+
+  // Start on a tick boundary so the first delta is a whole tick
+  const auto start = detail::next_tick<C>(C::now());
+  auto prev = start;
+
+  while (deltas.size() < CLOCK_RESOLUTION_SAMPLES) {
+    const auto next = detail::next_tick<C>(prev);
+    deltas.push_back(std::chrono::duration_cast<FpNs>(next - prev));
+    prev = next;
+
+    if (next - start > CLOCK_RESOLUTION_MAX_TIME) {
+      break;
+    }
+  }
+
+  return median(deltas);
+}
+
+// The smallest number of iterations which take at least min_duration, given how long one
+// iteration takes
+inline std::uint64_t min_iters_for_duration(const FpNs min_duration,
+                                            const FpNs mean_execution_time) {
+  if (!(mean_execution_time.count() > 0.0)) {
+    return 1;
+  }
+
+  return (std::max)(
+      static_cast<std::uint64_t>(std::ceil(min_duration.count() / mean_execution_time.count())),
+      std::uint64_t(1));
+}
+
+// The number of measurements which took less than min_duration
+inline std::size_t count_short_measurements(const Measurements &measurements,
+                                            const FpNs min_duration) {
+  return static_cast<std::size_t>(
+      std::count_if(measurements.begin(), measurements.end(), [min_duration](const Measurement &m) {
+        return std::chrono::duration_cast<FpNs>(m.duration()) < min_duration;
+      }));
+}
+}
+
+#endif // VELOX_CLOCK_RESOLUTION_H_INCLUDED
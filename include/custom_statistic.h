@@ -0,0 +1,134 @@
+#ifndef VELOX_CUSTOM_STATISTIC_H_INCLUDED
+#define VELOX_CUSTOM_STATISTIC_H_INCLUDED
+
+#include "util.h"
+#include "fp_range.h"
+#include "stats.h"
+
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <string>
+
+namespace velox {
+
+// How the value of a custom statistic is formatted by the reporters
+enum class StatisticUnit {
+  // A time in nanoseconds
+  time,
+  // A dimensionless number
+  ratio
+};
+
+// A named statistic of the per iteration times which is bootstrapped along with the built in
+// statistics, using the same resamples.  The function is always given a sorted sample.
+struct CustomStatistic {
+  using Function = std::function<double(const Times &)>;
+
+  CustomStatistic(const std::string &name, const StatisticUnit unit, Function f)
+      : name_(name), unit_(unit), f_(std::move(f)) {
+    assert(!name_.empty() && "Statistics must be named");
+    assert(f_ && "Statistics must have a function");
+  }
+
+  const std::string &name() const { return name_; }
+
+  StatisticUnit unit() const { return unit_; }
+
+  double operator()(const Times &sorted) const { return f_(sorted); }
+
+private:
+  std::string name_;
+  StatisticUnit unit_;
+  Function f_;
+};
+
+namespace detail {
+  // Sums times[first, last) with independent accumulators so the loop vectorises without
+  // needing to reassociate floating point additions
+  inline double sum_of_slice(const Times &times, const std::size_t first, const std::size_t last) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    auto i = first;
+    for (; i + 4 <= last; i += 4) {
+      s0 += times[i].count();
+      s1 += times[i + 1].count();
+      s2 += times[i + 2].count();
+      s3 += times[i + 3].count();
+    }
+    for (; i < last; ++i) {
+      s0 += times[i].count();
+    }
+    return (s0 + s1) + (s2 + s3);
+  }
+
+  // The sum of the squared deviations from m of times[first, last)
+  inline double sum_of_squares_of_slice(const Times &times,
+                                        const std::size_t first,
+                                        const std::size_t last,
+                                        const double m) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    auto i = first;
+    for (; i + 4 <= last; i += 4) {
+      const auto d0 = times[i].count() - m, d1 = times[i + 1].count() - m;
+      const auto d2 = times[i + 2].count() - m, d3 = times[i + 3].count() - m;
+      s0 += d0 * d0;
+      s1 += d1 * d1;
+      s2 += d2 * d2;
+      s3 += d3 * d3;
+    }
+    for (; i < last; ++i) {
+      const auto d = times[i].count() - m;
+      s0 += d * d;
+    }
+    return (s0 + s1) + (s2 + s3);
+  }
+}
+
+// The p-th percentile of the per iteration times, named like "p99"
+inline CustomStatistic percentile_statistic(const double p) {
+  assert(p > 0.0 && p <= 100.0 && "Percentile must be between 0 and 100");
+
+  std::ostringstream name;
+  name << "p" << p;
+
+  return CustomStatistic(name.str(), StatisticUnit::time, [p](const Times &sorted) {
+    return percentile_of_sorted(FpRange(sorted), p);
+  });
+}
+
+// The mean of the per iteration times after dropping the given proportion of the times from
+// each end
+inline CustomStatistic trimmed_mean_statistic(const double proportion) {
+  assert(proportion >= 0.0 && proportion < 0.5 && "Proportion must be between 0 and .5");
+
+  std::ostringstream name;
+  name << "trimmed mean " << proportion * 100 << "%";
+
+  return CustomStatistic(name.str(), StatisticUnit::time, [proportion](const Times &sorted) {
+    assert(!sorted.empty() && "Trimmed mean requires at least one value");
+
+    const auto n = sorted.size();
+    const auto k = static_cast<std::size_t>(std::floor(static_cast<double>(n) * proportion));
+    const auto first = (std::min)(k, (n - 1) / 2), last = n - first;
+
+    return detail::sum_of_slice(sorted, first, last) / static_cast<double>(last - first);
+  });
+}
+
+// The standard deviation of the per iteration times relative to their mean
+inline CustomStatistic coefficient_of_variation_statistic() {
+  return CustomStatistic("CV", StatisticUnit::ratio, [](const Times &sorted) {
+    const auto n = sorted.size();
+    if (n < 2) {
+      return 0.0;
+    }
+
+    const auto m = detail::sum_of_slice(sorted, 0, n) / static_cast<double>(n);
+    const auto ss = detail::sum_of_squares_of_slice(sorted, 0, n, m);
+    return std::sqrt(ss / static_cast<double>(n - 1)) / m;
+  });
+}
+}
+
+#endif // VELOX_CUSTOM_STATISTIC_H_INCLUDED
@@ -0,0 +1,79 @@
+#ifndef VELOX_DEFERRED_H_INCLUDED
+#define VELOX_DEFERRED_H_INCLUDED
+
+#include "recording_reporter.h"
+#include "benchmark.h"
+
+#include <atomic>
+#include <deque>
+#include <thread>
+
+namespace velox {
+
+// Holds the measurements of a suite's benchmarks until they have all been collected, so nothing
+// is analyzed while the machine should be quiet, then analyzes them all concurrently.  The events
+// of each benchmark and load test are recorded and replayed in their original order.
+struct DeferredAnalysis {
+  // Where the events of the next benchmark or load test should be reported
+  RecordingReporter &next() {
+    entries_.emplace_back();
+    return entries_.back().events;
+  }
+
+  // Queues measurements for analysis, reported after the events recorded by the last call to next
+  void analyze_later(Measurements &&measurements) {
+    assert(!entries_.empty() && "next must be called first");
+    entries_.back().measurements = std::move(measurements);
+    entries_.back().pending = true;
+  }
+
+  bool empty() const { return entries_.empty(); }
+
+  // Analyzes every queued benchmark and replays all of the recorded events to reporter
+  void run(const VeloxConfig &config, Reporter &reporter) {
+    // Each analysis bootstraps on three threads of its own
+    const auto hardware_threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    const auto num_workers =
+        (std::min)(static_cast<std::size_t>((hardware_threads + 2) / 3), entries_.size());
+
+    std::atomic<std::size_t> next_entry(0);
+    const auto worker = [&] {
+      for (auto i = next_entry++; i < entries_.size(); i = next_entry++) {
+        auto &e = entries_[i];
+        if (e.pending) {
+          analyze(e.measurements, config, e.events);
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < num_workers; ++i) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : threads) {
+      t.join();
+    }
+
+    for (const auto &e : entries_) {
+      e.events.replay(reporter);
+    }
+
+    entries_.clear();
+  }
+
+private:
+  struct Entry {
+    Entry() : pending(false) {}
+
+    RecordingReporter events;
+    Measurements measurements;
+    bool pending;
+  };
+
+private:
+  std::deque<Entry> entries_;
+};
+}
+
+#endif // VELOX_DEFERRED_H_INCLUDED
@@ -0,0 +1,441 @@
+#ifndef VELOX_DTOA_H_INCLUDED
+#define VELOX_DTOA_H_INCLUDED
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace velox {
+
+namespace {
+  // Enough for any double written by write_shortest or write_fixed
+  const std::size_t DOUBLE_BUFFER_SIZE = 352;
+}
+
+namespace detail {
+  // A floating point number f * 2^e with a 64-bit significand, from Loitsch's "Printing
+  // Floating-Point Numbers Quickly and Accurately with Integers" (2010)
+  struct DiyFp {
+    DiyFp(const std::uint64_t f_, const int e_) : f(f_), e(e_) {}
+
+    // The product, with the low 64 bits of the significand rounded away
+    static DiyFp mul(const DiyFp &x, const DiyFp &y) {
+      const auto x_lo = x.f & 0xFFFFFFFFu, x_hi = x.f >> 32;
+      const auto y_lo = y.f & 0xFFFFFFFFu, y_hi = y.f >> 32;
+
+      const auto p0 = x_lo * y_lo, p1 = x_lo * y_hi, p2 = x_hi * y_lo, p3 = x_hi * y_hi;
+
+      auto q = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+      q += std::uint64_t(1) << 31;
+
+      return DiyFp(p3 + (p2 >> 32) + (p1 >> 32) + (q >> 32), x.e + y.e + 64);
+    }
+
+    static DiyFp normalize(DiyFp x) {
+      while ((x.f >> 63) == 0) {
+        x.f <<= 1;
+        --x.e;
+      }
+      return x;
+    }
+
+    std::uint64_t f;
+    int e;
+  };
+
+  // A double along with the midpoints between it and its neighbours, all normalized to the
+  // exponent of the upper midpoint
+  struct Boundaries {
+    Boundaries(const double value) : w(0, 0), minus(0, 0), plus(0, 0) {
+      const std::uint64_t hidden_bit = std::uint64_t(1) << 52;
+      const int bias = 1023 + 52;
+
+      std::uint64_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(bits));
+
+      const auto biased_e = static_cast<int>(bits >> 52);
+      const auto fraction = bits & (hidden_bit - 1);
+
+      const auto v = biased_e == 0 ? DiyFp(fraction, 1 - bias)
+                                   : DiyFp(fraction + hidden_bit, biased_e - bias);
+
+      // The gap below a power of two is half the gap above it
+      const auto lower_is_closer = fraction == 0 && biased_e > 1;
+
+      plus = DiyFp::normalize(DiyFp(2 * v.f + 1, v.e - 1));
+
+      const auto m_minus =
+          lower_is_closer ? DiyFp(4 * v.f - 1, v.e - 2) : DiyFp(2 * v.f - 1, v.e - 1);
+      minus = DiyFp(m_minus.f << (m_minus.e - plus.e), plus.e);
+
+      w = DiyFp::normalize(v);
+    }
+
+    DiyFp w;
+    DiyFp minus;
+    DiyFp plus;
+  };
+
+  // The scaled products must have binary exponents in [ALPHA, GAMMA] so their integral parts
+  // fit in 32 bits
+  const int ALPHA = -60;
+  const int GAMMA = -32;
+
+  struct CachedPower {
+    std::uint64_t f;
+    int e;
+    int k;
+  };
+
+  // 10^k normalized to a 64-bit significand and binary exponent for a suitable k
+  inline CachedPower cached_power_for_binary_exponent(const int e) {
+    // 10^k for k = -300, -292, ..., 324
+    static const CachedPower powers[] = {
+        {0xAB70FE17C79AC6CA, -1060, -300},
+        {0xFF77B1FCBEBCDC4F, -1034, -292},
+        {0xBE5691EF416BD60C, -1007, -284},
+        {0x8DD01FAD907FFC3C, -980, -276},
+        {0xD3515C2831559A83, -954, -268},
+        {0x9D71AC8FADA6C9B5, -927, -260},
+        {0xEA9C227723EE8BCB, -901, -252},
+        {0xAECC49914078536D, -874, -244},
+        {0x823C12795DB6CE57, -847, -236},
+        {0xC21094364DFB5637, -821, -228},
+        {0x9096EA6F3848984F, -794, -220},
+        {0xD77485CB25823AC7, -768, -212},
+        {0xA086CFCD97BF97F4, -741, -204},
+        {0xEF340A98172AACE5, -715, -196},
+        {0xB23867FB2A35B28E, -688, -188},
+        {0x84C8D4DFD2C63F3B, -661, -180},
+        {0xC5DD44271AD3CDBA, -635, -172},
+        {0x936B9FCEBB25C996, -608, -164},
+        {0xDBAC6C247D62A584, -582, -156},
+        {0xA3AB66580D5FDAF6, -555, -148},
+        {0xF3E2F893DEC3F126, -529, -140},
+        {0xB5B5ADA8AAFF80B8, -502, -132},
+        {0x87625F056C7C4A8B, -475, -124},
+        {0xC9BCFF6034C13053, -449, -116},
+        {0x964E858C91BA2655, -422, -108},
+        {0xDFF9772470297EBD, -396, -100},
+        {0xA6DFBD9FB8E5B88F, -369, -92},
+        {0xF8A95FCF88747D94, -343, -84},
+        {0xB94470938FA89BCF, -316, -76},
+        {0x8A08F0F8BF0F156B, -289, -68},
+        {0xCDB02555653131B6, -263, -60},
+        {0x993FE2C6D07B7FAC, -236, -52},
+        {0xE45C10C42A2B3B06, -210, -44},
+        {0xAA242499697392D3, -183, -36},
+        {0xFD87B5F28300CA0E, -157, -28},
+        {0xBCE5086492111AEB, -130, -20},
+        {0x8CBCCC096F5088CC, -103, -12},
+        {0xD1B71758E219652C, -77, -4},
+        {0x9C40000000000000, -50, 4},
+        {0xE8D4A51000000000, -24, 12},
+        {0xAD78EBC5AC620000, 3, 20},
+        {0x813F3978F8940984, 30, 28},
+        {0xC097CE7BC90715B3, 56, 36},
+        {0x8F7E32CE7BEA5C70, 83, 44},
+        {0xD5D238A4ABE98068, 109, 52},
+        {0x9F4F2726179A2245, 136, 60},
+        {0xED63A231D4C4FB27, 162, 68},
+        {0xB0DE65388CC8ADA8, 189, 76},
+        {0x83C7088E1AAB65DB, 216, 84},
+        {0xC45D1DF942711D9A, 242, 92},
+        {0x924D692CA61BE758, 269, 100},
+        {0xDA01EE641A708DEA, 295, 108},
+        {0xA26DA3999AEF774A, 322, 116},
+        {0xF209787BB47D6B85, 348, 124},
+        {0xB454E4A179DD1877, 375, 132},
+        {0x865B86925B9BC5C2, 402, 140},
+        {0xC83553C5C8965D3D, 428, 148},
+        {0x952AB45CFA97A0B3, 455, 156},
+        {0xDE469FBD99A05FE3, 481, 164},
+        {0xA59BC234DB398C25, 508, 172},
+        {0xF6C69A72A3989F5C, 534, 180},
+        {0xB7DCBF5354E9BECE, 561, 188},
+        {0x88FCF317F22241E2, 588, 196},
+        {0xCC20CE9BD35C78A5, 614, 204},
+        {0x98165AF37B2153DF, 641, 212},
+        {0xE2A0B5DC971F303A, 667, 220},
+        {0xA8D9D1535CE3B396, 694, 228},
+        {0xFB9B7CD9A4A7443C, 720, 236},
+        {0xBB764C4CA7A44410, 747, 244},
+        {0x8BAB8EEFB6409C1A, 774, 252},
+        {0xD01FEF10A657842C, 800, 260},
+        {0x9B10A4E5E9913129, 827, 268},
+        {0xE7109BFBA19C0C9D, 853, 276},
+        {0xAC2820D9623BF429, 880, 284},
+        {0x80444B5E7AA7CF85, 907, 292},
+        {0xBF21E44003ACDD2D, 933, 300},
+        {0x8E679C2F5E44FF8F, 960, 308},
+        {0xD433179D9C8CB841, 986, 316},
+        {0x9E19DB92B4E31BA9, 1013, 324},
+    };
+
+    const int min_decimal_exponent = -300, decimal_step = 8;
+
+    // k = ceil((ALPHA - e - 1) * log10(2))
+    const auto f = ALPHA - e - 1;
+    const auto k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0);
+
+    const auto index = static_cast<std::size_t>(
+        (-min_decimal_exponent + k + (decimal_step - 1)) / decimal_step);
+    assert(index < sizeof(powers) / sizeof(powers[0]) && "Exponent is out of range");
+
+    const auto &cached = powers[index];
+    assert(ALPHA <= cached.e + e + 64 && cached.e + e + 64 <= GAMMA && "Bad cached power");
+    return cached;
+  }
+
+  inline std::uint32_t largest_power_of_ten_not_above(const std::uint32_t n, int &digits) {
+    std::uint32_t p = 1;
+    digits = 1;
+    while (digits < 10 && n / 10 >= p) {
+      p *= 10;
+      ++digits;
+    }
+    return p;
+  }
+
+  // Moves the last digit towards w while the result stays within the rounding interval
+  inline void grisu2_round(char *const buffer,
+                           const std::size_t length,
+                           const std::uint64_t dist,
+                           const std::uint64_t delta,
+                           std::uint64_t rest,
+                           const std::uint64_t ten_k) {
+    while (rest < dist && delta - rest >= ten_k &&
+           (rest + ten_k < dist || dist - rest > rest + ten_k - dist)) {
+      --buffer[length - 1];
+      rest += ten_k;
+    }
+  }
+
+  // Generates the shortest digits of a number in [m_minus, m_plus] closest to w
+  inline void grisu2_digits(char *const buffer,
+                            std::size_t &length,
+                            int &decimal_exponent,
+                            const DiyFp &m_minus,
+                            const DiyFp &w,
+                            const DiyFp &m_plus) {
+    auto delta = m_plus.f - m_minus.f;
+    auto dist = m_plus.f - w.f;
+
+    const auto shift = static_cast<unsigned>(-m_plus.e);
+    const auto one = std::uint64_t(1) << shift;
+
+    auto p1 = static_cast<std::uint32_t>(m_plus.f >> shift);
+    auto p2 = m_plus.f & (one - 1);
+
+    int n = 0;
+    auto pow10 = largest_power_of_ten_not_above(p1, n);
+
+    while (n > 0) {
+      buffer[length++] = static_cast<char>('0' + p1 / pow10);
+      p1 %= pow10;
+      --n;
+
+      const auto rest = (std::uint64_t(p1) << shift) + p2;
+      if (rest <= delta) {
+        decimal_exponent += n;
+        grisu2_round(buffer, length, dist, delta, rest, std::uint64_t(pow10) << shift);
+        return;
+      }
+
+      pow10 /= 10;
+    }
+
+    int m = 0;
+    for (;;) {
+      p2 *= 10;
+      buffer[length++] = static_cast<char>('0' + (p2 >> shift));
+      p2 &= one - 1;
+      ++m;
+
+      delta *= 10;
+      dist *= 10;
+      if (p2 <= delta) {
+        break;
+      }
+    }
+
+    decimal_exponent -= m;
+    grisu2_round(buffer, length, dist, delta, p2, one);
+  }
+
+  // The digits and decimal exponent of the shortest decimal which rounds to value, which must
+  // be finite and positive.  Grisu2 finds the shortest representation for all but about 0.1% of
+  // doubles and for those it finds one a digit longer which still round trips.
+  inline void grisu2(char *const buffer,
+                     std::size_t &length,
+                     int &decimal_exponent,
+                     const double value) {
+    const Boundaries b(value);
+    const auto cached = cached_power_for_binary_exponent(b.plus.e);
+    const DiyFp c(cached.f, cached.e);
+
+    const auto w = DiyFp::mul(b.w, c);
+    const auto w_minus = DiyFp::mul(b.minus, c);
+    const auto w_plus = DiyFp::mul(b.plus, c);
+
+    // Shrink the interval by an ulp on each side to allow for the error of the products
+    const DiyFp m_minus(w_minus.f + 1, w_minus.e);
+    const DiyFp m_plus(w_plus.f - 1, w_plus.e);
+
+    length = 0;
+    decimal_exponent = -cached.k;
+    grisu2_digits(buffer, length, decimal_exponent, m_minus, w, m_plus);
+  }
+
+  inline char *write_digits(char *out, const char *const digits, const std::size_t n) {
+    std::memcpy(out, digits, n);
+    return out + n;
+  }
+
+  inline char *write_zeros(char *out, const int n) {
+    for (int i = 0; i < n; ++i) {
+      *out++ = '0';
+    }
+    return out;
+  }
+
+  inline char *write_non_finite(char *out, const double value) {
+    if (std::isnan(value)) {
+      return write_digits(out, "nan", 3);
+    }
+
+    if (value < 0.0) {
+      *out++ = '-';
+    }
+    return write_digits(out, "inf", 3);
+  }
+}
+
+// Writes the shortest decimal which reads back as value, laid out the way JavaScript's
+// Number.prototype.toString would, and returns the end of what was written.  out must have room
+// for DOUBLE_BUFFER_SIZE characters.
+inline char *write_shortest(char *out, const double value) {
+  if (!std::isfinite(value)) {
+    return detail::write_non_finite(out, value);
+  }
+
+  if (std::signbit(value)) {
+    *out++ = '-';
+  }
+
+  if (std::fpclassify(value) == FP_ZERO) {
+    *out++ = '0';
+    return out;
+  }
+
+  char digits[20];
+  std::size_t length = 0;
+  int decimal_exponent = 0;
+  detail::grisu2(digits, length, decimal_exponent, std::abs(value));
+
+  // The value is 0.digits * 10^point
+  const auto len = static_cast<int>(length);
+  const auto point = len + decimal_exponent;
+
+  if (len <= point && point <= 21) {
+    out = detail::write_digits(out, digits, length);
+    return detail::write_zeros(out, point - len);
+  }
+
+  if (0 < point && point <= 21) {
+    const auto integral = static_cast<std::size_t>(point);
+    out = detail::write_digits(out, digits, integral);
+    *out++ = '.';
+    return detail::write_digits(out, digits + integral, length - integral);
+  }
+
+  if (-6 < point && point <= 0) {
+    *out++ = '0';
+    *out++ = '.';
+    out = detail::write_zeros(out, -point);
+    return detail::write_digits(out, digits, length);
+  }
+
+  *out++ = digits[0];
+  if (length > 1) {
+    *out++ = '.';
+    out = detail::write_digits(out, digits + 1, length - 1);
+  }
+
+  auto exponent = point - 1;
+  *out++ = 'e';
+  *out++ = exponent < 0 ? '-' : '+';
+  exponent = std::abs(exponent);
+  if (exponent >= 100) {
+    *out++ = static_cast<char>('0' + exponent / 100);
+    exponent %= 100;
+    *out++ = static_cast<char>('0' + exponent / 10);
+  } else if (exponent >= 10) {
+    *out++ = static_cast<char>('0' + exponent / 10);
+  }
+  *out++ = static_cast<char>('0' + exponent % 10);
+  return out;
+}
+
+// Writes value with precision digits after the decimal point, exactly as printf's "%.*f" would,
+// and returns the end of what was written.  Values which fit in 53 bits once scaled are converted
+// with integer arithmetic unless they are too close to a tie to round reliably.  out must have
+// room for DOUBLE_BUFFER_SIZE characters.
+inline char *write_fixed(char *out, const double value, const int precision) {
+  assert(precision >= 0 && precision <= 9 && "Precision must be between 0 and 9");
+
+  static const double powers_of_ten[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+  if (!std::isfinite(value)) {
+    return detail::write_non_finite(out, value);
+  }
+
+  const auto scale = powers_of_ten[precision];
+  const auto scaled = std::abs(value) * scale;
+  const auto integral = std::floor(scaled);
+  const auto fraction = scaled - integral;
+
+  // The product is within half an ulp of the exact value, which only matters near a tie
+  if (scaled >= 9007199254740992.0 || std::abs(fraction - 0.5) <= scaled * 1e-15) {
+    const auto n = std::snprintf(out, DOUBLE_BUFFER_SIZE, "%.*f", precision, value);
+    assert(n > 0 && static_cast<std::size_t>(n) < DOUBLE_BUFFER_SIZE && "Buffer too small");
+    return out + n;
+  }
+
+  const auto units = static_cast<std::uint64_t>(integral) + (fraction > 0.5 ? 1u : 0u);
+
+  if (std::signbit(value)) {
+    *out++ = '-';
+  }
+
+  const auto divisor = static_cast<std::uint64_t>(scale);
+  auto whole = units / divisor;
+  auto fractional = units % divisor;
+
+  char digits[20];
+  std::size_t n = 0;
+  do {
+    digits[n++] = static_cast<char>('0' + whole % 10);
+    whole /= 10;
+  } while (whole);
+
+  while (n) {
+    *out++ = digits[--n];
+  }
+
+  if (precision > 0) {
+    *out++ = '.';
+    for (auto i = precision; i > 0; --i) {
+      out[i - 1] = static_cast<char>('0' + fractional % 10);
+      fractional /= 10;
+    }
+    out += precision;
+  }
+
+  return out;
+}
+}
+
+#endif // VELOX_DTOA_H_INCLUDED
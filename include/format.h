@@ -2,70 +2,69 @@
 #define VELOX_FORMAT_H_INCLUDED
 
 #include "util.h"
+#include "writer.h"
 
+#include <cmath>
 #include <ostream>
 #include <string>
-#include <iomanip>
 
 namespace velox {
 
-struct StreamFormatRestorer {
-  StreamFormatRestorer(std::ostream &os)
-      : os_(os), flags_(os.flags()), precision_(os.precision()) {}
-
-  StreamFormatRestorer &operator=(const StreamFormatRestorer &rhs) = delete;
-
-  ~StreamFormatRestorer() {
-    os_.flags(flags_);
-    os_.precision(precision_);
-  }
-
-private:
-  std::ostream &os_;
-  std::ios_base::fmtflags flags_;
-  std::streamsize precision_;
-};
-
-inline void format_r2(std::ostream &os, const double n) {
-  const StreamFormatRestorer restorer(os);
-  os << std::setprecision(7) << n;
+inline void format_r2(BufferedWriter &out, const double n) {
+  out.write_general(n, 7);
 }
 
-inline void format_short(std::ostream &os, const double n) {
-  const StreamFormatRestorer restorer(os);
-
-  os.setf(std::ios_base::fixed);
-
+inline void format_short(BufferedWriter &out, const double n) {
   if (n < 10.0) {
-    os << std::setprecision(4) << n;
+    out.write_fixed(n, 4);
   } else if (n < 100) {
-    os << std::setprecision(3) << n;
+    out.write_fixed(n, 3);
   } else if (n < 1000) {
-    os << std::setprecision(2) << n;
+    out.write_fixed(n, 2);
   } else {
-    os << std::setprecision(1) << n;
+    out.write_fixed(n, 1);
   }
 }
 
-inline void format_time(std::ostream &os, const FpNs ns) {
-  if (ns < Ns(1)) {
-    format_short(os, ns.count() * 1e3);
-    os << " ps";
+inline void format_time(BufferedWriter &out, const FpNs ns) {
+  // Differences such as the overhead of a regression can be negative
+  if (ns < FpNs(0)) {
+    out << "-";
+    format_time(out, -ns);
+  } else if (ns < Ns(1)) {
+    format_short(out, ns.count() * 1e3);
+    out << " ps";
   } else if (ns < std::chrono::microseconds(1)) {
-    format_short(os, ns.count());
-    os << " ns";
+    format_short(out, ns.count());
+    out << " ns";
   } else if (ns < std::chrono::milliseconds(1)) {
-    format_short(os, ns.count() / 1e3);
-    os << " us";
+    format_short(out, ns.count() / 1e3);
+    out << " us";
   } else if (ns < std::chrono::seconds(1)) {
-    format_short(os, ns.count() / 1e6);
-    os << " ms";
+    format_short(out, ns.count() / 1e6);
+    out << " ms";
   } else {
-    format_short(os, ns.count() / 1e9);
-    os << " s";
+    format_short(out, ns.count() / 1e9);
+    out << " s";
   }
 }
 
+// Stream versions of the above for output which isn't otherwise buffered
+inline void format_r2(std::ostream &os, const double n) {
+  BufferedWriter out(os, 0);
+  format_r2(out, n);
+}
+
+inline void format_short(std::ostream &os, const double n) {
+  BufferedWriter out(os, 0);
+  format_short(out, n);
+}
+
+inline void format_time(std::ostream &os, const FpNs ns) {
+  BufferedWriter out(os, 0);
+  format_time(out, ns);
+}
+
 struct TimeScaler {
   TimeScaler(const std::string &time_units, const double scale_factor)
       : units_(time_units), scale_(scale_factor) {}
@@ -95,6 +94,35 @@ inline TimeScaler scaler_for_time(const FpNs ns) {
   }
 }
 
+// The number of decimals which keeps digits significant digits of values no larger than max,
+// negative when the last significant digit is to the left of the decimal point
+inline int decimals_for_significant_digits(const double max, const int digits) {
+  if (!(max > 0.0)) {
+    return 0;
+  }
+
+  return digits - 1 - static_cast<int>(std::floor(std::log10(max)));
+}
+
+// Writes values rounded to a number of decimals as a JavaScript array of integers: the first
+// value and then the difference from each value to the next, all multiplied by 10^decimals.
+// Successive samples are similar so the differences are much shorter than the values.
+template <class Values, class F>
+void write_deltas(BufferedWriter &out, const Values &values, const int decimals, F &&value) {
+  const auto scale = std::pow(10.0, decimals);
+
+  out << "[";
+  const char *sep = "";
+  long long previous = 0;
+  for (const auto &v : values) {
+    const auto current = std::llround(value(v) * scale);
+    out << sep << current - previous;
+    previous = current;
+    sep = ",";
+  }
+  out << "]";
+}
+
 inline std::string js_string_escape(const std::string &s) {
   std::string escaped;
   escaped.reserve(s.size());
@@ -0,0 +1,119 @@
+#ifndef VELOX_FORWARDING_REPORTER_H_INCLUDED
+#define VELOX_FORWARDING_REPORTER_H_INCLUDED
+
+#include "reporter.h"
+
+#include <functional>
+
+namespace velox {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// A reporter which turns each event, with copies of its arguments, into a function object so it
+// can be delivered to another reporter later or elsewhere
+struct ForwardingReporter : Reporter {
+  using Event = std::function<void(Reporter &)>;
+
+  void suite_starting(const std::string &clock, bool is_steady) override {
+    record(&Reporter::suite_starting, clock, is_steady);
+  }
+
+  void estimate_clock_cost_starting() override { record(&Reporter::estimate_clock_cost_starting); }
+
+  void estimate_clock_cost_ended(FpNs cost) override {
+    record(&Reporter::estimate_clock_cost_ended, cost);
+  }
+
+  void clock_resolution_estimated(FpNs resolution) override {
+    record(&Reporter::clock_resolution_estimated, resolution);
+  }
+
+  void quick_mode_enabled() override { record(&Reporter::quick_mode_enabled); }
+
+  void merge_refused(const std::string &checkpoint,
+                     const std::string &checkpoint_environment,
+                     const std::string &environment) override {
+    record(&Reporter::merge_refused, checkpoint, checkpoint_environment, environment);
+  }
+
+  void warm_up_starting(Ms ms) override { record(&Reporter::warm_up_starting, ms); }
+
+  void warm_up_ended(const ItersForDurationNs &wu) override {
+    record(&Reporter::warm_up_ended, wu);
+  }
+
+  void warm_up_failed(const ItersForDurationNs &wu) override {
+    record(&Reporter::warm_up_failed, wu);
+  }
+
+  void benchmark_starting(const std::string &name) override {
+    record(&Reporter::benchmark_starting, name);
+  }
+
+  void benchmark_ended() override { record(&Reporter::benchmark_ended); }
+
+  void measurement_collection_starting(std::uint32_t num_measurements,
+                                       FpNs measurement_time) override {
+    record(&Reporter::measurement_collection_starting, num_measurements, measurement_time);
+  }
+
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    record(&Reporter::measurements_too_short, num_short, num_measurements, min_duration);
+  }
+
+  void measurement_collection_ended(const Measurements &measurements,
+                                    const Times &times,
+                                    const SampleSummary &summary,
+                                    const Outliers &outliers) override {
+    record(&Reporter::measurement_collection_ended, measurements, times, summary, outliers);
+  }
+
+  void autocorrelation_estimated(const Autocorrelation &autocorrelation) override {
+    record(&Reporter::autocorrelation_estimated, autocorrelation);
+  }
+
+  void periodic_interference_estimated(const PeriodicInterference &interference) override {
+    record(&Reporter::periodic_interference_estimated, interference);
+  }
+
+  void estimate_statistics_starting(std::uint32_t num_resamples) override {
+    record(&Reporter::estimate_statistics_starting, num_resamples);
+  }
+
+  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
+    record(&Reporter::estimate_statistics_ended, statistics);
+  }
+
+  void load_test_starting(const std::string &name, const LoadConfig &config) override {
+    record(&Reporter::load_test_starting, name, config);
+  }
+
+  void load_point_measured(const LoadPoint &point) override {
+    record(&Reporter::load_point_measured, point);
+  }
+
+  void load_test_ended() override { record(&Reporter::load_test_ended); }
+
+  void suite_ended() override { record(&Reporter::suite_ended); }
+
+protected:
+  // Called with every event, which calls the same function with the same arguments on the
+  // reporter it is given
+  virtual void forward(Event &&event) = 0;
+
+private:
+  template <class... Params, class... Args>
+  void record(void (Reporter::*f)(Params...), const Args &... args) {
+    forward([f, args...](Reporter &r) { (r.*f)(args...); });
+  }
+};
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+#endif // VELOX_FORWARDING_REPORTER_H_INCLUDED
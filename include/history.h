@@ -0,0 +1,301 @@
+#ifndef VELOX_HISTORY_H_INCLUDED
+#define VELOX_HISTORY_H_INCLUDED
+
+#include "reporter.h"
+#include "writer.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace velox {
+
+// One run of one benchmark in a results history
+struct HistoryEntry {
+  HistoryEntry(const std::string &revision,
+               const std::string &benchmark,
+               const Estimate<FpNs> &mean,
+               const FpNs median,
+               const std::size_t sample_size,
+               Measurements raw = Measurements())
+      : revision_(revision), benchmark_(benchmark), mean_(mean), median_(median),
+        sample_size_(sample_size), raw_(std::move(raw)) {}
+
+  // The label given to HistoryReporter, such as a commit hash
+  const std::string &revision() const { return revision_; }
+
+  const std::string &benchmark() const { return benchmark_; }
+
+  const Estimate<FpNs> &mean() const { return mean_; }
+
+  FpNs median() const { return median_; }
+
+  // The number of measurements the estimates came from
+  std::size_t sample_size() const { return sample_size_; }
+
+  // The measurements themselves, empty unless the history stores raw data
+  const Measurements &raw_measurements() const { return raw_; }
+
+private:
+  std::string revision_;
+  std::string benchmark_;
+  Estimate<FpNs> mean_;
+  FpNs median_;
+  std::size_t sample_size_;
+  Measurements raw_;
+};
+
+// Every run of one benchmark in a history, in the order they were recorded
+struct BenchmarkHistory {
+  BenchmarkHistory(const std::string &benchmark) : name_(benchmark) {}
+
+  const std::string &name() const { return name_; }
+
+  const std::vector<HistoryEntry> &entries() const { return entries_; }
+
+  void add(HistoryEntry &&entry) {
+    assert(entry.benchmark() == name_ && "Entry is for a different benchmark");
+    entries_.push_back(std::move(entry));
+  }
+
+private:
+  std::string name_;
+  std::vector<HistoryEntry> entries_;
+};
+
+namespace detail {
+  // Tabs and line breaks separate the fields and entries so they are escaped inside names
+  inline void write_history_field(BufferedWriter &out, const std::string &field) {
+    for (const auto c : field) {
+      switch (c) {
+      case '\\': out << "\\\\"; break;
+      case '\t': out << "\\t"; break;
+      case '\n': out << "\\n"; break;
+      case '\r': out << "\\r"; break;
+      default: out << c; break;
+      }
+    }
+  }
+
+  // Splits a line into its tab separated fields, undoing write_history_field's escapes
+  inline std::vector<std::string> split_history_line(const std::string &line) {
+    std::vector<std::string> fields(1);
+    for (std::size_t i = 0; i < line.size(); ++i) {
+      const auto c = line[i];
+      if (c == '\t') {
+        fields.emplace_back();
+      } else if (c == '\\' && i + 1 < line.size()) {
+        const auto e = line[++i];
+        fields.back() += e == 't' ? '\t' : e == 'n' ? '\n' : e == 'r' ? '\r' : e;
+      } else {
+        fields.back() += c;
+      }
+    }
+    return fields;
+  }
+
+  inline bool parse_history_double(const std::string &s, double &d) {
+    char *end = nullptr;
+    errno = 0;
+    d = std::strtod(s.c_str(), &end);
+    return !s.empty() && *end == '\0' && errno == 0;
+  }
+
+  inline bool parse_history_integer(const char *s, const char **end, long long &n) {
+    char *e = nullptr;
+    errno = 0;
+    n = std::strtoll(s, &e, 10);
+    *end = e;
+    return e != s && errno == 0 && n >= 0;
+  }
+
+  // Raw measurements are written as "iterations:nanoseconds:start" triples separated by commas.
+  // Older histories wrote "iterations:nanoseconds" pairs, which are read with a start of 0.
+  inline bool parse_history_raw(const std::string &s, Measurements &raw) {
+    auto p = s.c_str();
+    while (*p) {
+      long long iters = 0, duration = 0, start = 0;
+      if (!parse_history_integer(p, &p, iters) || *p++ != ':' ||
+          !parse_history_integer(p, &p, duration) ||
+          (*p == ':' && !parse_history_integer(++p, &p, start)) || (*p && *p++ != ',')) {
+        return false;
+      }
+      raw.emplace_back(static_cast<std::uint64_t>(iters), Ns(duration), Ns(start));
+    }
+    return true;
+  }
+
+  inline void write_history_raw(BufferedWriter &out, const Measurements &raw) {
+    const char *sep = "";
+    for (const auto &m : raw) {
+      out << sep << m.iters() << ':' << m.duration().count() << ':' << m.start().count();
+      sep = ",";
+    }
+  }
+
+  // Appends the entry in fields[first, end) to entries if it is well formed
+  inline bool read_history_entry(const std::vector<std::string> &fields,
+                                 const std::size_t first,
+                                 std::vector<HistoryEntry> &entries) {
+    const auto num_fields = fields.size() - (std::min)(first, fields.size());
+    if (num_fields != 9 && num_fields != 10) {
+      return false;
+    }
+
+    const auto field = [&](const std::size_t i) -> const std::string & {
+      return fields[first + i];
+    };
+
+    double mean = 0.0, lb = 0.0, ub = 0.0, se = 0.0, cl = 0.0, median = 0.0;
+    long long size = 0;
+    const char *size_end = nullptr;
+    if (!parse_history_double(field(2), mean) || !parse_history_double(field(3), lb) ||
+        !parse_history_double(field(4), ub) || !parse_history_double(field(5), se) ||
+        !parse_history_double(field(6), cl) || !parse_history_double(field(7), median) ||
+        !parse_history_integer(field(8).c_str(), &size_end, size) || *size_end != '\0' ||
+        !(cl > 0.0 && cl < 1.0)) {
+      return false;
+    }
+
+    Measurements raw;
+    if (num_fields == 10 && !parse_history_raw(field(9), raw)) {
+      return false;
+    }
+
+    entries.emplace_back(field(0),
+                         field(1),
+                         Estimate<FpNs>(FpNs(mean), FpNs(se), FpNs(lb), FpNs(ub), cl),
+                         FpNs(median),
+                         static_cast<std::size_t>(size),
+                         std::move(raw));
+    return true;
+  }
+}
+
+// Writes an entry as one line of a history: tab separated fields of the revision, benchmark, mean
+// with its bounds, standard error and confidence level, median, sample size and, if there are
+// any, the raw measurements.  Times are in nanoseconds and read back exactly.
+inline void write_history_entry(BufferedWriter &out, const HistoryEntry &entry) {
+  detail::write_history_field(out, entry.revision());
+  out << '\t';
+  detail::write_history_field(out, entry.benchmark());
+
+  const auto &mean = entry.mean();
+  out << '\t' << mean.point().count() << '\t' << mean.lower_bound().count() << '\t'
+      << mean.upper_bound().count() << '\t' << mean.standard_error().count() << '\t'
+      << mean.confidence_level() << '\t' << entry.median().count() << '\t'
+      << entry.sample_size();
+
+  if (!entry.raw_measurements().empty()) {
+    out << '\t';
+    detail::write_history_raw(out, entry.raw_measurements());
+  }
+
+  out << '\n';
+}
+
+// Reads a history, grouping the entries by benchmark in the order each benchmark first appears.
+// Blank and malformed lines are skipped, as is a last line without a line break since it was
+// cut short by a crash.
+inline std::vector<BenchmarkHistory> read_history(std::istream &is) {
+  std::vector<BenchmarkHistory> histories;
+  std::vector<HistoryEntry> parsed;
+  std::string line;
+
+  while (std::getline(is, line) && !is.eof()) {
+    if (line.empty() || !detail::read_history_entry(detail::split_history_line(line), 0, parsed)) {
+      continue;
+    }
+
+    auto entry = std::move(parsed.back());
+    parsed.pop_back();
+
+    auto history = std::find_if(histories.begin(),
+                                histories.end(),
+                                [&](const BenchmarkHistory &h) {
+                                  return h.name() == entry.benchmark();
+                                });
+    if (history == histories.end()) {
+      histories.emplace_back(entry.benchmark());
+      history = histories.end() - 1;
+    }
+
+    history->add(std::move(entry));
+  }
+
+  return histories;
+}
+
+inline std::vector<BenchmarkHistory> read_history(const std::string &path) {
+  std::ifstream file(path);
+  return read_history(file);
+}
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Appends the mean and median of every benchmark to a history file, labelled with a revision such
+// as a commit hash, so runs of many revisions can be compared with write_trend_report.  The file
+// is only ever appended to.  With store_raw the measurements are kept as well, which makes the
+// history much larger.
+struct HistoryReporter : Reporter {
+  HistoryReporter(const std::string &path, const std::string &revision, bool store_raw = false)
+      : file_(path, std::ios::app), out_(file_), revision_(revision), store_raw_(store_raw),
+        sample_size_(0) {}
+
+  HistoryReporter &operator=(const HistoryReporter &rhs) = delete;
+
+  void benchmark_starting(const std::string &name) override { benchmark_ = name; }
+
+  void measurement_collection_ended(const Measurements &measurements,
+                                    const Times &times,
+                                    const SampleSummary &summary,
+                                    const Outliers &outliers) override {
+    unused(summary, outliers);
+
+    sample_size_ = times.size();
+    if (store_raw_) {
+      measurements_ = measurements;
+    }
+  }
+
+  void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
+    write_history_entry(out_,
+                        HistoryEntry(revision_,
+                                     benchmark_,
+                                     statistics.mean().estimate(),
+                                     statistics.median().estimate().point(),
+                                     sample_size_,
+                                     std::move(measurements_)));
+    measurements_.clear();
+  }
+
+  // Each benchmark's entry is written as soon as it ends so a crash loses at most the benchmark
+  // which was running
+  void benchmark_ended() override {
+    out_.flush();
+    file_.flush();
+  }
+
+  void suite_ended() override { benchmark_ended(); }
+
+private:
+  std::ofstream file_;
+  BufferedWriter out_;
+  std::string revision_;
+  bool store_raw_;
+  std::string benchmark_;
+  std::size_t sample_size_;
+  Measurements measurements_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+#endif // VELOX_HISTORY_H_INCLUDED
@@ -2,6 +2,11 @@
 #define VELOX_HTML_REPORTER_H_INCLUDED
 
 #include "reporter.h"
+#include "html_template.h"
+
+#include <fstream>
+#include <memory>
+#include <sstream>
 
 namespace velox {
 #ifdef __clang__
@@ -9,10 +14,25 @@ namespace velox {
 #pragma clang diagnostic ignored "-Wweak-vtables"
 #endif
 struct HtmlReporter : Reporter {
-  HtmlReporter(std::ostream &os) : os_(os), num_benchmarks(0) {}
+  HtmlReporter(std::ostream &os)
+      : os_(os), out_(&os_), num_benchmarks(0), max_iters_(0), max_duration_(0),
+        clock_resolution_(0.0), quick_(false), files_good_(true) {}
+
+  // Splits the report for large suites: index_path gets a page listing each benchmark's mean and
+  // each benchmark's data goes in its own file next to it, named after the page with the
+  // benchmark's number, which the page only loads when the benchmark is shown.  The data files
+  // store samples as differences and thin the KDE to what can be drawn.
+  explicit HtmlReporter(const std::string &index_path)
+      : index_file_(index_path), os_(index_file_), out_(&os_), num_benchmarks(0), max_iters_(0),
+        max_duration_(0), clock_resolution_(0.0), quick_(false),
+        data_path_(without_extension(index_path)), files_good_(index_file_.is_open()) {}
 
   HtmlReporter &operator=(const HtmlReporter &rhs) = delete;
 
+  // Whether the files of a split report have all been opened and written so far.  Check it once
+  // the suite has ended, a report which couldn't be written is otherwise silently incomplete.
+  bool good() const { return files_good_; }
+
   void suite_starting(const std::string &clock, bool is_steady) override {
     os_ << template_begin() << "\n";
 
@@ -24,100 +44,318 @@ struct HtmlReporter : Reporter {
     os_ << "var benchmarkData = {\n";
   }
 
+  void clock_resolution_estimated(FpNs resolution) override { clock_resolution_ = resolution; }
+
+  void quick_mode_enabled() override { quick_ = true; }
+
   void benchmark_starting(const std::string &name) override { current_benchmark_ = name; }
 
-  void warm_up_ended(const ItersForDurationNs &) override {
-    os_ << "benchmark_" << ++num_benchmarks << " : {\n";
-    os_ << "    name : '" << js_string_escape(current_benchmark_) << "',\n";
+  // A benchmark's block starts with its measurements, so neither a failed warm up nor
+  // measurements which were never warmed up here (see OfflineAnalysis) leave it unbalanced
+  void measurement_collection_starting(std::uint32_t, FpNs) override {
+    ++num_benchmarks;
+    if (split()) {
+      data_file_.open(data_file_name(data_path_));
+      files_good_ = files_good_ && data_file_.is_open();
+      data_writer_.reset(new BufferedWriter(data_file_));
+      out_ = data_writer_.get();
+      out() << "veloxBenchmarkLoaded('benchmark_" << num_benchmarks << "', {\n";
+    } else {
+      out() << "benchmark_" << num_benchmarks << " : {\n";
+    }
+    out() << "    name : '" << js_string_escape(current_benchmark_) << "',\n";
+  }
+
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    out() << "    shortMeasurements : '" << num_short << " of " << num_measurements
+          << " shorter than ";
+    format_time(out(), min_duration);
+    out() << "',\n";
   }
 
   void measurement_collection_ended(const Measurements &measurements,
                                     const Times &times,
+                                    const SampleSummary &summary,
                                     const Outliers &outliers) override {
     assert(!measurements.empty() && !times.empty() && "Measurements are required");
     assert(measurements.size() == times.size() && "Times should be derived from measurements");
 
-    output_summary(times, outliers);
-    output_kde(times);
-    output_times(times, outliers);
+    output_summary(summary);
+    if (!quick_) {
+      output_kde(summary);
+    }
+    output_times(times, summary, outliers);
     output_raw_measurements(measurements);
   }
 
+  void autocorrelation_estimated(const Autocorrelation &autocorrelation) override {
+    out() << "    autocorrelation : {\n";
+    out() << "        lag1 : '";
+    format_short(out(), autocorrelation.lag1());
+    out() << "',\n";
+    out() << "        effectiveSampleSize : '"
+          << static_cast<std::uint64_t>(std::round(autocorrelation.effective_sample_size()))
+          << " of " << autocorrelation.sample_size() << "',\n";
+    out() << "        significant : " << (autocorrelation.significant() ? "true" : "false") << "\n";
+    out() << "    },\n";
+  }
+
+  void periodic_interference_estimated(const PeriodicInterference &interference) override {
+    out() << "    periodicInterference : {\n";
+    out() << "        period : '";
+    format_time(out(), interference.period());
+    out() << "',\n";
+    out() << "        varianceExplained : '";
+    format_short(out(), interference.variance_explained() * 100.0);
+    out() << "%',\n";
+    out() << "        significant : " << (interference.significant() ? "true" : "false") << "\n";
+    out() << "    },\n";
+  }
+
   void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
-    os_ << "    confidence_level : '" << statistics.mean().estimate().confidence_level() * 100
-        << "% CI',\n";
+    out() << "    confidence_level : '";
+    out().write_general(statistics.mean().estimate().confidence_level() * 100, 6);
+    if (statistics.analytic()) {
+      out() << "% CI, approximated analytically in quick mode',\n";
+    } else {
+      out() << "% CI from " << statistics.num_resamples() << " resamples',\n";
+    }
+    out() << "    quick : " << (statistics.analytic() ? "true" : "false") << ",\n";
 
+    const auto time = [](BufferedWriter &out, const FpNs t) { format_time(out, t); };
     auto format_estimate =
-        [this](const char *const name, const Estimate<FpNs> &e) { format(name, e, format_time); };
+        [this, &time](const char *const name, const Estimate<FpNs> &e) { format(name, e, time); };
 
     format_estimate("mean", statistics.mean().estimate());
     format_estimate("median", statistics.median().estimate());
     format_estimate("sd", statistics.std_dev().estimate());
     format_estimate("mad", statistics.median_abs_dev().estimate());
     format_estimate("lls", statistics.linear_least_squares().estimate());
-    format("r2", statistics.r_squared().estimate(), format_r2);
+    format_estimate("slope", statistics.slope().estimate());
+    format_estimate("overhead", statistics.overhead().estimate());
+    format("r2",
+           statistics.r_squared().estimate(),
+           [](BufferedWriter &out, const double r2) { format_r2(out, r2); });
+
+    const auto &ov = statistics.outlier_variance();
+    out() << "    outlierVariance : {\n";
+    out() << "        fraction : '";
+    format_short(out(), ov.fraction() * 100.0);
+    out() << "%',\n";
+    out() << "        effect : '" << outlier_effect_name(ov.effect()) << "',\n";
+    out() << "        significant : "
+          << (ov.effect() == OutlierEffect::moderate || ov.effect() == OutlierEffect::severe
+                  ? "true"
+                  : "false") << "\n";
+    out() << "    },\n";
+
+    out() << "    flatSampling : " << (statistics.flat_sampling() ? "true" : "false") << ",\n";
+    if (!statistics.flat_sampling()) {
+      output_regression_lines(statistics);
+    }
+
+    out() << "    custom : [";
+    const char *sep = "\n";
+    for (const auto &c : statistics.custom()) {
+      out() << sep << "        {\n";
+      out() << "            name : '" << js_string_escape(c.name()) << "',\n";
+      if (c.unit() == StatisticUnit::time) {
+        format_bounds(c.estimate(),
+                      [](BufferedWriter &out, const double v) { format_time(out, FpNs(v)); },
+                      "            ");
+      } else {
+        format_bounds(c.estimate(),
+                      [](BufferedWriter &out, const double v) { format_short(out, v); },
+                      "            ");
+      }
+      out() << "        }";
+      sep = ",\n";
+    }
+    out() << "\n    ]\n";
+
+    if (!split()) {
+      out() << "},\n";
+      return;
+    }
+
+    out() << "});\n";
+    out_ = &os_;
+    data_writer_.reset();
+    data_file_.close();
+    files_good_ = files_good_ && !data_file_.fail();
+
+    os_ << "benchmark_" << num_benchmarks << " : {\n";
+    os_ << "    name : '" << js_string_escape(current_benchmark_) << "',\n";
+    os_ << "    file : '" << js_string_escape(data_file_name(file_name(data_path_))) << "',\n";
+    os_ << "    meanEstimate : '";
+    format_time(os_, statistics.mean().estimate().point());
+    os_ << "'\n";
     os_ << "},\n";
   }
 
+  void load_test_starting(const std::string &name, const LoadConfig &config) override {
+    load_name_ = name;
+    load_description_.str("");
+    load_description_ << (config.arrival_process() == ArrivalProcess::fixed ? "Fixed" : "Poisson")
+                      << " arrivals from " << config.num_threads() << " thread"
+                      << (config.num_threads() == 1 ? "" : "s");
+    load_points_.clear();
+  }
+
+  void load_point_measured(const LoadPoint &point) override {
+    load_points_.push_back(LoadSummary{point.throughput(),
+                                       {point.latency(50),
+                                        point.latency(90),
+                                        point.latency(99),
+                                        point.latency(99.9),
+                                        point.max_latency()},
+                                       point.service_time(50)});
+  }
+
+  void load_test_ended() override {
+    if (load_points_.empty()) {
+      return;
+    }
+
+    static const char *const names[] = {"p50", "p90", "p99", "p99.9", "max"};
+
+    auto max_latency = FpNs(0);
+    for (const auto &p : load_points_) {
+      max_latency = (std::max)(max_latency, p.latencies[4]);
+    }
+    const auto scaler = scaler_for_time(max_latency);
+
+    BufferedWriter load_tests(load_tests_);
+    load_tests << "{\n";
+    load_tests << "    name : '" << js_string_escape(load_name_) << "',\n";
+    load_tests << "    description : '" << load_description_.str() << "',\n";
+    load_tests << "    units : '" << scaler.units() << "',\n";
+    load_tests << "    latencies : [\n";
+    const char *sep = "";
+    for (std::size_t i = 0; i < 5; ++i) {
+      load_tests << "        { name : '" << names[i] << "', data : [";
+      sep = "";
+      for (const auto &p : load_points_) {
+        load_tests << sep << "[" << p.throughput << ", " << scaler.scale(p.latencies[i]) << "]";
+        sep = ", ";
+      }
+      load_tests << "] }" << (i + 1 < 5 ? ",\n" : "\n");
+    }
+    load_tests << "    ],\n";
+
+    load_tests << "    service : [";
+    sep = "";
+    for (const auto &p : load_points_) {
+      load_tests << sep << "[" << p.throughput << ", " << scaler.scale(p.service) << "]";
+      sep = ", ";
+    }
+    load_tests << "]\n";
+    load_tests << "},\n";
+  }
+
   void suite_ended() override {
     os_ << "};\n";
+
+    os_ << "var loadTests = [\n" << load_tests_.str() << "];\n";
+
+    if (clock_resolution_.count() > 0.0) {
+      os_ << "clockInfo.resolution = '";
+      format_time(os_, clock_resolution_);
+      os_ << "';\n";
+    }
+
     os_ << template_end() << "\n";
+    os_.flush();
+    if (split()) {
+      index_file_.flush();
+      files_good_ = files_good_ && !index_file_.fail();
+    }
   }
 
 private:
-  template <class E, class F>
-  void format(const char *const name, const E &e, F &&f) {
-    os_ << "    " << name << " : {\n";
+  // The precision of the times in the data files of a split report
+  static const int SIGNIFICANT_DIGITS = 6;
+
+  BufferedWriter &out() { return *out_; }
+
+  bool split() const { return !data_path_.empty(); }
+
+  std::string data_file_name(const std::string &path) const {
+    return path + "_" + std::to_string(num_benchmarks) + ".js";
+  }
 
-    os_ << "        lowerBound : '";
-    f(os_, e.lower_bound());
-    os_ << "',\n";
+  static std::string::size_type file_name_start(const std::string &path) {
+    const auto separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? 0 : separator + 1;
+  }
 
-    os_ << "        estimate : '";
-    f(os_, e.point());
-    os_ << " &plusmn; ";
-    f(os_, e.standard_error());
-    os_ << "',\n";
+  static std::string file_name(const std::string &path) {
+    return path.substr(file_name_start(path));
+  }
+
+  static std::string without_extension(const std::string &path) {
+    const auto dot = path.find_last_of('.');
+    return dot == std::string::npos || dot < file_name_start(path) ? path : path.substr(0, dot);
+  }
 
-    os_ << "        upperBound : '";
-    f(os_, e.upper_bound());
-    os_ << "'\n    },\n";
+  template <class E, class F>
+  void format(const char *const name, const E &e, F &&f) {
+    out() << "    " << name << " : {\n";
+    format_bounds(e, f, "        ");
+    out() << "    },\n";
   }
 
-  void output_summary(const Times &times, const Outliers &outliers) {
-    const auto mm = std::minmax_element(times.begin(), times.end());
+  template <class E, class F>
+  void format_bounds(const E &e, F &&f, const char *const indent) {
+    out() << indent << "lowerBound : '";
+    f(out(), e.lower_bound());
+    out() << "',\n";
+
+    out() << indent << "estimate : '";
+    f(out(), e.point());
+    out() << " &plusmn; ";
+    f(out(), e.standard_error());
+    out() << "',\n";
+
+    out() << indent << "upperBound : '";
+    f(out(), e.upper_bound());
+    out() << "'\n";
+  }
 
-    os_ << "    summary : {\n";
+  void output_summary(const SampleSummary &summary) {
+    out() << "    summary : {\n";
 
-    os_ << "        min : '";
-    format_time(os_, *mm.first);
-    os_ << "',\n";
+    out() << "        min : '";
+    format_time(out(), summary.min());
+    out() << "',\n";
 
-    os_ << "        q1 : '";
-    format_time(os_, outliers.quartiles().q1());
-    os_ << "',\n";
+    out() << "        q1 : '";
+    format_time(out(), summary.quartiles().q1());
+    out() << "',\n";
 
-    os_ << "        mean : '";
-    format_time(os_, FpNs(mean(FpRange(times))));
-    os_ << "',\n";
+    out() << "        mean : '";
+    format_time(out(), summary.mean());
+    out() << "',\n";
 
-    os_ << "        median : '";
-    format_time(os_, median(times));
-    os_ << "',\n";
+    out() << "        median : '";
+    format_time(out(), summary.median());
+    out() << "',\n";
 
-    os_ << "        q3 : '";
-    format_time(os_, outliers.quartiles().q3());
-    os_ << "',\n";
+    out() << "        q3 : '";
+    format_time(out(), summary.quartiles().q3());
+    out() << "',\n";
 
-    os_ << "        max : '";
-    format_time(os_, *mm.second);
-    os_ << "'\n";
+    out() << "        max : '";
+    format_time(out(), summary.max());
+    out() << "'\n";
 
-    os_ << "    },\n";
+    out() << "    },\n";
   }
 
-  void output_kde(const Times &times) {
-    auto points = kde(times, DEFAULT_KDE_POINTS);
+  void output_kde(const SampleSummary &summary) {
+    auto points = kde(summary, DEFAULT_KDE_POINTS);
 
     const auto max_x =
         std::max_element(points.begin(), points.end(), [](const Point &lhs, const Point &rhs) {
@@ -137,92 +375,155 @@ private:
         });
 
     const double min_y = min_max_y.first->y(), max_y = min_max_y.second->y();
-    const double mu = mean(FpRange(times)) * scaler.scale();
-    const double med = median(FpRange(times)) * scaler.scale();
+    const double mu = scaler.scale(summary.mean());
+    const double med = scaler.scale(summary.median());
 
-    os_ << "    kde : {\n";
-    os_ << "        units : '" << scaler.units() << "',\n";
-    os_ << "        meanData : [[" << mu << ", " << min_y << "], [" << mu << ", " << max_y
-        << "]],\n";
-    os_ << "        medianData : [[" << med << ", " << min_y << "], [" << med << ", " << max_y
-        << "]],\n";
-    os_ << "        data : [";
+    // Nothing finer than a pixel of a typical chart can be seen
+    if (split()) {
+      points = thin_points(points, (max_y - min_y) / 500.0);
+    }
+
+    out() << "    kde : {\n";
+    out() << "        units : '" << scaler.units() << "',\n";
+    out() << "        meanData : [[" << mu << ", " << min_y << "], [" << mu << ", " << max_y
+          << "]],\n";
+    out() << "        medianData : [[" << med << ", " << min_y << "], [" << med << ", " << max_y
+          << "]],\n";
+    out() << "        data : [";
+
+    const auto coordinate = [this](const double v) {
+      if (split()) {
+        out().write_general(v, SIGNIFICANT_DIGITS);
+      } else {
+        out() << v;
+      }
+    };
 
     const char *sep = "";
     for (const auto &p : points) {
-      os_ << sep << "[" << p.x() << "," << p.y() << "]";
+      out() << sep << "[";
+      coordinate(p.x());
+      out() << ",";
+      coordinate(p.y());
+      out() << "]";
       sep = ", ";
     }
-    os_ << "]\n    },\n";
+    out() << "]\n    },\n";
   }
 
-  void output_times(const Times &times, const Outliers &outliers) {
-    const auto max_time = *std::max_element(times.begin(), times.end());
-    const auto scaler = scaler_for_time(max_time);
+  void output_times(const Times &times, const SampleSummary &summary, const Outliers &outliers) {
+    const auto scaler = scaler_for_time(summary.max());
 
     auto format_outlier_line =
-        [&](const char *const name, const Times &outs, const FpNs threshold) {
-      os_ << "        " << name << " : [";
-      if (!outs.empty()) {
-        os_ << "[1, " << scaler.scale(threshold) << "], ";
-        os_ << "[" << times.size() << ", " << scaler.scale(threshold) << "]";
+        [&](const char *const name, const OutlierSeverity severity, const FpNs threshold) {
+      out() << "        " << name << " : [";
+      if (outliers.count(severity)) {
+        out() << "[1, " << scaler.scale(threshold) << "], ";
+        out() << "[" << times.size() << ", " << scaler.scale(threshold) << "]";
       }
-      os_ << "],\n";
+      out() << "],\n";
     };
 
-    os_ << "    samples : {\n";
-    os_ << "        units : '" << scaler.units() << "',\n";
+    out() << "    samples : {\n";
+    out() << "        units : '" << scaler.units() << "',\n";
+    format_outlier_line(
+        "highSevereData", OutlierSeverity::high_severe, outliers.thresholds().high_severe());
     format_outlier_line(
-        "highSevereData", outliers.high_severe(), outliers.thresholds().high_severe());
-    format_outlier_line("highMildData", outliers.high_mild(), outliers.thresholds().high_mild());
-    format_outlier_line("lowMildData", outliers.low_mild(), outliers.thresholds().low_mild());
-    format_outlier_line("lowSevereData", outliers.low_severe(), outliers.thresholds().low_severe());
-    os_ << "        data : [";
+        "highMildData", OutlierSeverity::high_mild, outliers.thresholds().high_mild());
+    format_outlier_line("lowMildData", OutlierSeverity::low_mild, outliers.thresholds().low_mild());
+    format_outlier_line(
+        "lowSevereData", OutlierSeverity::low_severe, outliers.thresholds().low_severe());
+
+    // One digit per sample, the OutlierSeverity of each point
+    out() << "        severities : '";
+    for (const auto severity : outliers.severities()) {
+      out() << static_cast<char>('0' + static_cast<int>(severity));
+    }
+    out() << "',\n";
+
+    if (split()) {
+      const auto decimals =
+          decimals_for_significant_digits(scaler.scale(summary.max()), SIGNIFICANT_DIGITS);
+      out() << "        decimals : " << decimals << ",\n";
+      out() << "        deltas : ";
+      write_deltas(out(), times, decimals, [&](const FpNs t) { return scaler.scale(t); });
+      out() << "\n    },\n";
+      return;
+    }
+
+    out() << "        data : [";
 
     const char *sep = "";
     for (std::size_t i = 0; i < times.size(); ++i) {
-      os_ << sep << "[" << i + 1 << "," << scaler.scale(times[i]) << "]";
+      out() << sep << "[" << i + 1 << "," << scaler.scale(times[i]) << "]";
       sep = ", ";
     }
-    os_ << "]\n    },\n";
+    out() << "]\n    },\n";
   }
 
   void output_raw_measurements(const Measurements &measurements) {
-    const auto scaler = scaler_for_time(measurements.back().duration());
-    const auto points = measurements_to_points(measurements);
-
-    const auto sl = slope(points);
+    // Measurements aren't necessarily taken in increasing order of iterations
+    max_iters_ = 0;
+    max_duration_ = Ns(0);
+    for (const auto &m : measurements) {
+      max_iters_ = (std::max)(max_iters_, m.iters());
+      max_duration_ = (std::max)(max_duration_, m.duration());
+    }
+    const auto scaler = scaler_for_time(max_duration_);
+
+    out() << "    rawMeasurements : {\n";
+    out() << "        units : '" << scaler.units() << "',\n";
+    if (split()) {
+      const auto decimals =
+          decimals_for_significant_digits(scaler.scale(max_duration_), SIGNIFICANT_DIGITS);
+      out() << "        decimals : " << decimals << ",\n";
+      out() << "        iterations : ";
+      write_deltas(out(), measurements, 0, [](const Measurement &m) {
+        return static_cast<double>(m.iters());
+      });
+      out() << ",\n";
+      out() << "        durations : ";
+      write_deltas(out(), measurements, decimals, [&](const Measurement &m) {
+        return scaler.scale(m.duration());
+      });
+      out() << "\n    },\n";
+      return;
+    }
 
-    os_ << "    rawMeasurements : {\n";
-    os_ << "        units : '" << scaler.units() << "',\n";
-    os_ << "        regression : [[0, 0], [" << measurements.back().iters() << ", "
-        << scaler.scale(FpNs{static_cast<double>(measurements.back().iters()) * sl}) << "]],\n";
-    os_ << "        data : [";
+    out() << "        data : [";
 
     const char *sep = "";
     for (const auto &m : measurements) {
-      os_ << sep << "[" << m.iters() << "," << scaler.scale(m.duration()) << "]";
+      out() << sep << "[" << m.iters() << "," << scaler.scale(m.duration()) << "]";
       sep = ", ";
     }
-    os_ << "]\n    },\n";
+    out() << "]\n    },\n";
   }
 
-private:
-  template <std::size_t N>
-  static std::string string_from_cstrs(const char *const (&cstrs)[N]) {
-    std::string s;
-    for (auto cstr : cstrs) {
-      s += cstr;
-    }
-    return s;
+  // The fitted lines are drawn over the raw measurements, in the same units
+  void output_regression_lines(const EstimatedStatistics &statistics) {
+    const auto scaler = scaler_for_time(max_duration_);
+    const auto x = static_cast<double>(max_iters_);
+    const auto lls = statistics.linear_least_squares().estimate().point();
+    const auto slope = statistics.slope().estimate().point();
+    const auto overhead = statistics.overhead().estimate().point();
+
+    out() << "    regression : {\n";
+    out() << "        throughOrigin : [[0, 0], [" << max_iters_ << ", " << scaler.scale(lls * x)
+          << "]],\n";
+    out() << "        withOverhead : [[0, " << scaler.scale(overhead) << "], [" << max_iters_
+          << ", " << scaler.scale(overhead + slope * x) << "]]\n";
+    out() << "    },\n";
   }
 
+private:
   static const std::string &template_begin() {
     static const char *const pieces[] = {
 #include "html_template_begin.tpl"
     };
 
-    static const std::string s = string_from_cstrs(pieces);
+    static const std::string s = detail::html_template_libraries() +
+                                 detail::string_from_cstrs(pieces);
     return s;
   }
 
@@ -231,14 +532,36 @@ private:
 #include "html_template_end.tpl"
     };
 
-    static const std::string s = string_from_cstrs(pieces);
+    static const std::string s = detail::string_from_cstrs(pieces);
     return s;
   }
 
+  // The percentiles of one rate of a load test
+  struct LoadSummary {
+    double throughput;
+    FpNs latencies[5];
+    FpNs service;
+  };
+
 private:
-  std::ostream &os_;
+  std::ofstream index_file_;
+  BufferedWriter os_;
+  // Where the current benchmark's data is written, os_ unless the report is split
+  BufferedWriter *out_;
   std::string current_benchmark_;
   std::uint32_t num_benchmarks;
+  std::uint64_t max_iters_;
+  Ns max_duration_;
+  FpNs clock_resolution_;
+  bool quick_;
+  std::string load_name_;
+  std::ostringstream load_description_;
+  std::vector<LoadSummary> load_points_;
+  std::ostringstream load_tests_;
+  std::string data_path_;
+  std::ofstream data_file_;
+  std::unique_ptr<BufferedWriter> data_writer_;
+  bool files_good_;
 };
 #ifdef __clang__
 #pragma clang diagnostic pop
@@ -0,0 +1,32 @@
+#ifndef VELOX_HTML_TEMPLATE_H_INCLUDED
+#define VELOX_HTML_TEMPLATE_H_INCLUDED
+
+#include <cstddef>
+#include <string>
+
+namespace velox {
+
+namespace detail {
+  template <std::size_t N>
+  std::string string_from_cstrs(const char *const (&cstrs)[N]) {
+    std::string s;
+    for (auto cstr : cstrs) {
+      s += cstr;
+    }
+    return s;
+  }
+
+  // The start of every HTML page velox writes, up to and including the scripts for jQuery and
+  // Highcharts
+  inline const std::string &html_template_libraries() {
+    static const char *const pieces[] = {
+#include "html_template_libraries.tpl"
+    };
+
+    static const std::string s = string_from_cstrs(pieces);
+    return s;
+  }
+}
+}
+
+#endif // VELOX_HTML_TEMPLATE_H_INCLUDED
@@ -203,6 +203,22 @@ R"***^***(
                         enableMouseTracking: false,
                         color: '#e31a1c',
                         data: []
+                    } , {
+                        type: 'line',
+                        name: 'Regression with overhead',
+                        id: 'fit',
+                        marker: {
+                            enabled: false,
+                            states: {
+                                hover: {
+                                    enabled: false
+                                }
+                            }
+                        },
+                        enableMouseTracking: false,
+                        dashStyle: 'ShortDash',
+                        color: '#33a02c',
+                        data: []
                     }]
                 });
                 
@@ -233,11 +249,23 @@ R"***^***(
                         $(id).html(benchData.summary[idToSummaryValue[id]]);
                     }
                     
+                    var autocorrelation = benchData.autocorrelation || { lag1 : '', effectiveSampleSize : '', significant : false };
+                    $('#sample-lag1').html(autocorrelation.lag1).toggleClass('significant', autocorrelation.significant);
+                    $('#sample-ess').html(autocorrelation.effectiveSampleSize).toggleClass('significant', autocorrelation.significant);
+                    $('#sample-short').html(benchData.shortMeasurements || 'none').toggleClass('significant', !!benchData.shortMeasurements);
+                    var periodic = benchData.periodicInterference || { period : '', varianceExplained : '', significant : false };
+                    $('#sample-periodic').html(periodic.significant ? 'every ' + periodic.period + ' (' + )***^***",
+R"***^***(periodic.varianceExplained + ')' : 'none').toggleClass('significant', periodic.significant);
+                    
+                    var outlierVariance = benchData.outlierVariance || { fraction : '', effect : '', significant : false };
+                    $('#sample-outlier-variance').html(outlierVariance.fraction + (outlierVariance.effect ? ' (' + outlierVariance.effect + ')' : '')).toggleClass('significant', outlierVariance.significant);
+                    
                     // Set bootstrapped statistics
                     $('#lb-title').prop('title', benchData['confidence_level']);
                     $('#ub-title').prop('title', benchData['confidence_level']);
+                    $('#analyzed-caption').text(benchData.quick ? 'Approximate Statistics (quick mode)' : 'Bootstrapped Statistics');
                     
-                    var stats = ['mean', 'median', 'sd', 'mad', 'lls', 'r2'];
+                    var stats = ['mean', 'median', 'sd', 'mad', 'lls', 'slope', 'overhead', 'r2'];
                     for (var i = 0; i < stats.length; ++i) {
                         var stat = stats[i];
                         $('#' + stat + '-lb').html(benchData[stat].lowerBound);
@@ -245,43 +273,75 @@ R"***^***(
                         $('#' + stat + '-up').html(benchData[stat].upperBound);
                     }
                     
+                    // The regression statistics are meaningless when every measurement has the same number of iterations
+                    var regressionStats = ['lls', 'slope', 'overhead', 'r2'];
+                    for (var i = 0; i < regressionStats.length; ++i) {
+                        $('#' + regressionStats[i] + '-estimate').parent().toggle(!benchData.flatSampling);
+                    }
+                    
+                    // Statistics added with VeloxConfig::add_statistic
+                    $('#analyzed-stats tr.custom-stat').remove();
+                    var custom = benchData.custom || [];
+                    for (var i = 0; i < custom.length; ++i) {
+                        $('<tr class="custom-stat">')
+                            .append($('<td>').text(custom[i].name))
+                            .append($('<td>').html(custom[i].lowerBound))
+                            .append($('<td>').html(custom[i].estimate))
+                            .append($('<td>').html(custom[i].upperBound))
+                            .appendTo('#analyzed-stats tbody');
+                    }
+                    
                     // Set chart data
                     function setSeries(series, data) {
                         series.setData(data.slice(0), false, false, false);
                     }
                     
-                    setSeries(kdeChart.get('pdf'), benchData.kde.data);
-                    setSeries(kdeChart.get('mean'), benchData.kde.meanData);
-                    setSeries(kdeChart.get('median'), benchData.kde.medianData);
+                    // Quick mode skips the KDE
+                    var kde = benchData.kde || { units : '', data : [], meanData : [], medianData : [] };
+                    $('#kde').toggle(!!benchData.kde);
+                    setSeries(kdeChart.get('pdf'), kde.data);
+                    setSeries(kdeChart.get('mean'), kde.meanData);
+                    setSeries(kdeChart.get('median'), kde.medianData);
                     kdeChart.redraw(false);
                     
-                    setSeries(samplesChart.get('sample'), benchData.samples.data);
+                    // Colour each outlier like the threshold it crossed
+                    var severityColors = ['#6a3d9a', '#cab2d6', null, '#fdbf6f', '#ff7f00'];
+                    var severities = benchData.samples.severities || '';
+                    var sampleData = $.map(benchData.samples.data, function(point, i) {
+                        var color = severityColors[+(severities.charAt(i) || 2)];
+                        return color ? { x : point[0], y : point[1], color : color } : [point];
+                    });
+                    samplesChart.get('sample').setData(sampleData, false, false, false);
                     setSeries(samplesChart.get('highSevere'), benchData.samples.highSevereData);
-         )***^***",
-R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.highMildData);
+                    setSeries(samplesChart.get('highMild'), benchData.samples.highMildData);
                     setSeries(samplesChart.get('lowMild'), benchData.samples.lowMildData);
                     setSeries(samplesChart.get('lowSevere'), benchData.samples.lowSevereData);
                     samplesChart.redraw(false);
                     
                     setSeries(rawMeasurementsChart.get('measurement'), benchData.rawMeasurements.data);
-                    setSeries(rawMeasurementsChart.get('regression'), benchData.rawMeasurements.regression);
+                    var regression = benchData.regression || { throughOrigin : benchData.rawMeasurements.regression || [], withOverhead : [] };
+                    setSeries(rawMeasurementsChart.get('regression'), regression.throughOrigin);
+                    setSeries(rawMeasurementsChart.get('fit'), regression.withOverhead);
                     rawMeasurementsChart.redraw(false);
                     
                     kdeChart.tooltip.options.formatter = function() {
                         return 'Time: <strong>' + this.x + ' ' + 
-                                benchData.kde.units + '</strong><br />Density: <strong>' + this.y + '</strong>';
+                                kde.units + '</strong><br />Density: <strong>' + this.y + '</strong>';
                     };
                     
                     kdeChart.xAxis[0].update({
                         title:{
-                            text: 'Time (' + benchData.kde.units + ')'
+                            text: 'Time (' + kde.units + ')'
                         }
                     });
                     
                     samplesChart.tooltip.options.formatter = function() {
                         if (this.series.options.id == 'sample') {
+                            var severityNames = ['low severe outlier', 'low mild outlier', '', 'high mild outlier', 'high severe outlier'];
+                            var severity = severityNames[+((benchData.samples.severities || '').charAt(this.x - 1) || 2)];
                             return 'Sample: <strong>' + this.x + '</strong><br />Time: <strong>' 
-                                + this.y + ' ' + benchData.samples.units + '</strong>';
+                                + this.y + ' ' + benchData.samples.units + '</strong>'
+                                + (severity ? '<br />' + severity : '');
                         }
                        
                        return this.series.name + ': <strong>' + this.y + ' ' + benchData.samples.units + '</strong>';
@@ -305,22 +365,123 @@ R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.h
                     };
                 }
             
+                // Split reports keep each benchmark in its own data file which is loaded the first time it is shown
+                var shownBenchmark = null;
+                
+                function decodeDeltas(deltas, decimals) {
+                    var value = 0;
+                    return $.map(deltas, function(delta) {
+                        value += delta;
+                        return decimals >= 0 ? value / Math.pow(10, decimals) : value * Math.pow(10, -decimals);
+                    });
+                }
+                
+                window.veloxBenchmarkLoaded = function(id, benchData) {
+                    if (benchData.samples.deltas) {
+                        var times = decodeDeltas(benchData.samples.deltas, benchData.samples.decimals);
+                        benchData.samples.data = $.map(times, function(time, i) { return [[i + 1, time]]; });
+                    }
+                    
+                    var raw = benchData.rawMeasurements;
+                    if (raw.iterations) {
+                        var iterations = decodeDeltas(raw.iterations, 0);
+                        var durations = decodeDeltas(raw.durations, raw.decimals);
+                        raw.data = $.map(iterations, function(n, i) { return [[n, durations[i]]]; });
+                    }
+                    
+                    benchmarkData[id] = benchData;
+                    if (id === shownBenchmark) {
+                        updateData(id);
+                    }
+                };
+                
+                function showBenchmark(id) {
+                    var benchData = benchmarkData[id];
+                    if (!benchData) {
+                        return;
+                    }
+                    
+                    shownBenchmark = id;
+                    if (!benchData.file) {
+                        updateData(id);
+                        return;
+                    }
+                    
+                    $("#benchmarks .current").removeClass("current");
+                    $('#' + id).parent().addClass("current");
+                    if (!benchData.loading) {
+                        benchData.loading = true;
+                        var script = document.createElement('script');
+                        script.src = benchData.file;
+                        document.body.appendChild(script);
+                    }
+                }
+            
                 for (var b in benchmarkData) {
+                    var link = $('<a/>', {id: b, href: '#', text: benchmarkData[b].name});
+                    if (benchmarkData[b].meanEstimate) {
+                        $('<span class="mean-estimate"/>').text(benchmarkData[b].meanEstimate).appendTo(link);
+                    }
+                    
                     $('<li/>', {
-                        html: $('<a/>', {id: b, href: '#', text: benchmarkData[b].name}) 
+                        html: link
                     }).appendTo('#benchmarks');
                 }  
                 
                 $('#benchmarks a').click(function(e) {
                     e.preventDefault();
-                    var target = $(e.target);
                     
-                    updateData(target.attr('id'));
+                    showBenchmark($(this).attr('id'));
                 });
-                            
+                      )***^***",
+R"***^***(      
                 $('#clock-name').text(clockInfo.name);
                 $('#steadiness').text(clockInfo.steadiness);   
-                updateData('benchmark_1');
+                if (clockInfo.resolution) {
+                    $('#clock-resolution').text(clockInfo.resolution);
+                    $('#clock-resolution-info').show();
+                }
+                showBenchmark('benchmark_1');
+                
+                // Latency against throughput for each load test, one line per percentile
+                var percentileColors = ['#1f78b4', '#33a02c', '#ff7f00', '#e31a1c', '#6a3d9a'];
+                $.each(typeof loadTests === 'undefined' ? [] : loadTests, function(i, test) {
+                    var div = $('<div class="load-test"/>').attr('id', 'load-test-' + i).appendTo('#load-tests');
+                    var series = $.map(test.latencies, function(l, j) {
+                        return { type: 'line', name: l.name, color: percentileColors[j], data: l.data };
+                    });
+                    series.push({ type: 'line', name: 'service time p50', color: '#a6cee3', dashStyle: 'Dash', data: test.service });
+                    
+                    new Highcharts.Chart({
+                        chart: {
+                            renderTo: div[0],
+                            zoomType: 'xy'
+                        },
+                        title: {
+                            text: 'Load Test: ' + test.name
+                        },
+                        subtitle: {
+                            text: test.description
+                        },
+                        xAxis: {
+                            title: {
+                                text: 'Throughput (requests/s)'
+                            }
+                        },
+                        yAxis: {
+                            title: {
+                                text: 'Latency (' + test.units + ')'
+                            },
+                            min: 0
+                        },
+                        tooltip: {
+                            formatter: function() {
+                                return this.series.name + ': <strong>' + this.y + ' ' + test.units + '</strong><br />Throughput: <strong>' + this.x + ' requests/s</strong>';
+                            }
+                        },
+                        series: series
+                    });
+                });
             });
         </script>
         
@@ -374,6 +535,12 @@ R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.h
                 border-bottom-right-radius: 10px;
             }
 
+            #benchmarks .mean-estimate {
+                display: block;
+                font-size: 12px;
+                color: #999;
+            }
+
             #benchmarks a:hover{
                 background-color: #f5f5f5;
             }
@@ -409,6 +576,10 @@ R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.h
                 background-color: #F2F2F2;
             }
 
+            #sample-summary td.significant {
+                color: #e31a1c;
+            }
+
             #sample-summary, #analyzed-stats {
                 border-collapse: collapse;
                 float:left
@@ -448,7 +619,7 @@ R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.h
                 padding-top: 15px;
             }
 
-            #kde, #samples, #raw-measurements {
+            #kde, #samples, #raw-measurements, .load-test {
                 min-width: 600px;
                 margin-bottom:15px;
                 border:1px solid #eee;
@@ -521,11 +692,31 @@ R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.h
 			                <td>max</td>
 			                <td id="sample-max"></td>
 		                </tr>
+		                <tr>
+			                <td>lag 1 autocorrelation</td>
+			                <td id="sample-lag1"></td>
+		                </tr>
+		                <tr>
+			                <td>effective sample size</td>
+			                <td id="sample-ess"></td>
+		                </tr>
+		                <tr>
+			                <td>short measurements</td>
+			                <td id="sample-short"></td>
+		                </tr>
+		                <tr>
+			                <td>periodic interference</td>
+			                <td id="sample-periodic"></td>
+		                </tr>
+		                <tr>
+			                <td>outlier variance</td>
+			                <td id="sample-outlier-variance"></td>
+		                </tr>
 	                </tbody>
                 </table>
                             
                 <table id="analyzed-stats">
-                  <caption>Bootstrapped Statistics</caption>
+                  <caption id="analyzed-caption">Bootstrapped Statistics</caption>
 	                <thead>
 	                  <th></th>
 	                  <th id="lb-title">lower bound</th>
@@ -560,14 +751,26 @@ R"***^***(           setSeries(samplesChart.get('highMild'), benchData.samples.h
 		                <tr>
 			                <td>LLS</td>
 			                <td id="lls-lb"></td>
-			                <td id="lls-estimate"></td>
+			       )***^***",
+R"***^***(         <td id="lls-estimate"></td>
 			                <td id="lls-up"></td>
 		                </tr>
+		                <tr>
+			                <td>slope</td>
+			                <td id="slope-lb"></td>
+			                <td id="slope-estimate"></td>
+			                <td id="slope-up"></td>
+		                </tr>
+		                <tr>
+			                <td>overhead</td>
+			                <td id="overhead-lb"></td>
+			                <td id="overhead-estimate"></td>
+			                <td id="overhead-up"></td>
+		                </tr>
 		                <tr>
 			                <td>r&sup2;</td>
 			                <td id="r2-lb"></td>
-			       )***^***",
-R"***^***(         <td id="r2-estimate"></td>
+			                <td id="r2-estimate"></td>
 			                <td id="r2-up"></td>
 		                </tr>
 	                </tbody>
@@ -580,11 +783,16 @@ R"***^***(         <td id="r2-estimate"></td>
                 <div id="samples"></div>
                 
                 <div id="raw-measurements"></div>
+                <div id="load-tests"></div>
             </main>
         </div>
         <div id="info">
             <h3>Statistics</h3>          
             <dl>
+                <dt>Quick mode</dt>
+                <dd>
+                    With VeloxConfig::quick_mode the intervals come from formulas which assume normal, independent measurements instead of the bootstrap: a t interval for the mean, an order statistic interval for the median, a chi-squared interval for the standard deviation and t intervals from the regression residuals for LLS, slope and overhead.  MAD, r^2 and custom statistics are reported without intervals and no KDE is computed.  The results are approximate and only meant for quick comparisons while iterating on a change.
+                </dd>
                 <dt>MAD (Median Absolute Deviation)</dt>
                 <dd>
                     The interval [median - MAD, median + MAD] contains half of the measured values.  Unlike the standard deviation the MAD is resilient to outliers.
@@ -593,10 +801,22 @@ R"***^***(         <td id="r2-estimate"></td>
                 <dd>
                     An estimate of the time taken to run a single iteration of the benchmarked function which is calculated using  least linear squares regression (through the origin).  This value should be more accurate then some other statistics, such as mean, since it eliminates constant factors (such as measurement overhead). 
                 </dd>
+                <dt>slope/overhead</dt>
+                <dd>
+                    A regression with an intercept.  The slope is the time taken by a single iteration and the intercept (overhead) is the fixed cost of each measurement, such as reading the clock or Stopwatch setup, which LLS folds into the time per iteration.  A large overhead means LLS and the per iteration times overestimate the cost of the function.
+                </dd>
                 <dt>r&sup2;</dt>
                 <dd>
                     A value in the interval [0, 1] which measures the accuracy of the calculated linear regression.  Any value below .99 indicates that the measurements may be suspect (perhaps other processes on the machine are influencing the benchmarks).
                 </dd>
+                <dt>Autocorrelation</dt>
+                <dd>
+                    Measurements are taken one after another so drift caused by thermal throttling, frequency scaling, background work, etc. makes neighbouring measurements correlated.  The bootstrap assumes the measurements are independent, so when the lag 1 autocorrelation is significant (shown in red) the confidence intervals are likely too narrow.  The effective sample size is roughly how many independent measurements the sample is worth.  Use a block bootstrap (VeloxConfig::resample_method) for autocorrelated measurements.  Short measurements lasted less than VeloxConfig::min_measurement_ticks ticks of the clock, so the clock's granularity may distort them.  Periodic interference is a sinusoid in the measurement start times which explains a significant share of the residuals around the fitted line, as caused by timer ticks or periodic background work.  It can line up with the increasing lengths of the linear iteration schedule and bias the slope; a shuffled or low discrepancy schedule (VeloxConfig::iteration_schedule) breaks that alignment.
+                </dd>
+                <dt>Outlier Variance</dt>
+                <dd>
+                    How much of the variance of the sample is caused by outliers rather than by the benchmarked function itself, using the model from Haskell's criterion library.  Moderate (10% or more) and severe (50% or more) effects are shown in red.  On noisy machines VeloxConfig::outlier_policy can exclude or winsorize severe outliers and VeloxConfig::regression_method can use a robust fit for LLS.
+                </dd>
                 <dt>lower/upper bound</dt>
                 <dd>
                     Confidence intervals calculated using bootstrapping which help determine the accuracy of an estimate.  If the configured confidence_level is .95 (the default) then 95% of the estimates calculated when resampling the data were between the lower and upper bounds.  Lower and upper bounds will be close to the estimated value for high quality estimates.  You can hover over the "lower bound" or "upper bound" column titles to see the confidence level which was used.   
@@ -614,11 +834,15 @@ R"***^***(         <td id="r2-estimate"></td>
                 </dd>
                 <dt>Raw Measurements</dt>
                 <dd>
-                    The raw measurements(number of iterations and duration) which were collected when benchmarking a function.  The regression line is created from the calculated LLS value.  All points should be on or very near the regression line.
+                    The raw measurements(number of iterations and duration) which were collected when benchmarking a function.  The solid regression line is created from the calculated LLS value and the dashed line from the slope and overhead.  All points should be on or very near the regression line.  With flat sampling every measurement runs the same number of iterations so there are no regression lines and the regression statistics are hidden.
+                </dd>
+                <dt>Load Tests</dt>
+                <dd>
+                    Latency percentiles against the throughput achieved at each request rate of a load test (Velox::load).  Requests are issued open loop on a fixed or Poisson schedule and latency is measured from when each request should have started, so time spent queued behind slow requests counts (correcting for coordinated omission).  The dashed line is the median service time, measured from when requests actually started, which is all closed loop timing sees.  Latency climbing steeply while throughput stops growing marks the saturation point.
                 </dd>
              </dl>
              <p>You can hover over the any of the charts to see exact values and select areas to zoom in.</p>
-             <p id="clock-info">All times measured with <span id="clock-name"></span> which is <span id="steadiness"></span>.</p>
+             <p id="clock-info">All times measured with <span id="clock-name"></span> which is <span id="steadiness"></span><span id="clock-resolution-info" style="display: none;"> with a resolution of <span id="clock-resolution"></span></span>.</p>
         </div>
     </body>
 </html>
@@ -0,0 +1,2 @@
+R"***^***(        <script>
+            )***^***"
@@ -0,0 +1,323 @@
+R"***^***(
+
+            Highcharts.setOptions({
+                colors: ['#a6cee3','#1f78b4','#b2df8a','#33a02c','#fb9a99','#e31a1c',
+                '#fdbf6f','#ff7f00','#cab2d6','#6a3d9a','#ffff99','#b15928']
+            });
+
+            $(function () {
+                document.title = 'Benchmark Trends - generated by velox';
+
+                var trendChart = null;
+
+                function segmentMean(values, first, last) {
+                    var sum = 0;
+                    for (var i = first; i < last; ++i) {
+                        sum += values[i];
+                    }
+                    return sum / (last - first);
+                }
+
+                function showTrend(index) {
+                    var trend = trendData[index];
+
+                    $("#benchmarks .current").removeClass("current");
+                    $('#trend_' + index).parent().addClass("current");
+                    $('#benchmark-name').text(trend.name);
+
+                    // The band is the lower bound with the width of the interval stacked on top of it
+                    var widths = $.map(trend.upper, function(upper, i) { return upper - trend.lower[i]; });
+                    var shiftColor = '#e31a1c';
+                    var plotLines = $.map(trend.changepoints, function(c) {
+                        return {
+                            value: c - 0.5,
+                            color: shiftColor,
+                            dashStyle: 'Dash',
+                            width: 2,
+                            zIndex: 5,
+                            label: { text: trend.revisions[c], style: { color: shiftColor } }
+                        };
+                    });
+
+                    if (trendChart) {
+                        trendChart.destroy();
+                    }
+
+                    trendChart = new Highcharts.Chart({
+                        chart: {
+                            renderTo: 'trend',
+                            zoomType: 'x'
+                        },
+                        title: {
+                            text: 'Mean over Revisions'
+                        },
+                        subtitle: {
+                            text: '<a href="https://github.com/ctrychta/velox">generated by velox</a>'
+                        },
+                        xAxis: {
+                            categories: trend.revisions,
+                            title: {
+                                text: 'Revision'
+                            },
+                            plotLines: plotLines
+                        },
+                        yAxis: {
+                            title: {
+                                text: 'Time (' + trend.units + ')'
+                            }
+                        },
+                        plotOptions: {
+                            area: {
+                                stacking: 'normal',
+                                lineWidth: 0,
+                                marker: {
+                                    enabled: false
+                                },
+                                enableMouseTracking: false
+                            }
+                        },
+                        tooltip: {
+                            formatter: function() {
+                                var i = this.point.x;
+                                return 'Revision: <strong>' + trend.revisions[i] + '</strong><br />Mean: <strong>'
+                                    + trend.means[i] + ' ' + trend.units + '</strong><br />' + trend.confidenceLevel
+                                    + ' CI: <strong>[' + trend.lower[i] + ', ' + trend.upper[i] + '] ' + trend.units + '</strong>';
+                            }
+                        },
+                        series: [{
+                            type: 'area',
+                            name: 'confidence interval',
+                            id: 'band',
+                            data: widths,
+                            color: '#a6cee3',
+                            fillOpacity: 0.5
+                        }, {
+                            type: 'area',
+                            linkedTo: 'band',
+                            data: trend.lower,
+                            fillOpacity: 0
+                        }, {
+                            type: 'line',
+                            name: 'mean',
+                            data: trend.means,
+                            color: '#1f78b4'
+                        }]
+                    });
+
+                    $('#shifts tbody').empty();
+                    $('#shifts').toggle(trend.changepoints.length > 0);
+                    $('#no-shifts').toggle(trend.changepoints.length === 0);
+                    var bounds = [0].concat(trend.changepoints, [trend.means.length]);
+                    for (var i = 1; i + 1 < bounds.length; ++i) {
+                        var before = segmentMean(trend.means, bounds[i - 1], bounds[i]);
+                        var after = segmentMean(trend.means, bounds[i], bounds[i + 1]);
+                        var change = (after - before) / before * 100;
+                        $('<tr>')
+                            .append($('<td>').text(trend.revisions[bounds[i] - 1]))
+                            .append($('<td>').text(trend.revisions[bounds[i]]))
+                            .append($('<td>').text(before.toPrecision(4) + ' ' + trend.units))
+                            .append($('<td>').text(after.toPrecision(4) + ' ' + trend.units))
+                            .append($('<td>').text((change > 0 ? '+' : '') + change.toFixed(1) + '%')
+                                .toggleClass('slower', change > 0))
+                            .appendTo('#shifts tbody');
+                    }
+                }
+
+                $.each(trendData, function(i, trend) {
+                    var link = $('<a/>', {id: 'trend_' + i, href: '#', text: trend.name});
+                    if (trend.changepoints.length) {
+                        $('<span class="shift-count"/>')
+                            .text(trend.changepoints.length + (trend.changepoints.length === 1 ? ' shift' : ' shifts'))
+                            .appendTo(link);
+                    }
+
+                    $('<li/>', {
+                        html: link
+                    }).appendTo('#benchmarks');
+                });
+
+                $('#benchmarks a').click(function(e) {
+                    e.preventDefault();
+
+                    showTrend(+$(this).attr('id').substring('trend_'.length));
+                });
+
+                if (trendData.length) {
+                    showTrend(0);
+                }
+            });
+        </script>
+
+        <style type="text/css">
+            body {
+                min-width: 800px;
+                margin:0;
+                padding:0;
+                font-family: "Helvetica Neue", Helvetica, Arial, sans-serif;
+                background-color: #fff;
+            }
+
+            #content {
+                padding: 15px;
+            }
+
+            nav {
+                width:200px;
+                float:left;
+                background-color: #fff;
+                border-radius: 10px;
+                border:1px solid #ddd;
+                margin-bottom:15px;
+            }
+
+            #benchmarks {
+                list-style-type: none;
+                padding: 0;
+                margin:0;
+            }
+
+            #benchmarks a{
+                display:block;
+                padding: 10px 20px;
+                text-decoration: none;
+                font-size:14px;
+                border-top: 1px solid #ddd;
+                box-shadow: rgba(255, 255, 255, 0.2) 0px 0px 1px 0px inset;
+                color: #777879;
+                word-wrap: break-word;
+            }
+
+            #benchmarks li:first-child a {
+                border-top: none;
+                border-top-left-radius: 10px;
+                border-top-right-radius: 10px;
+            }
+
+            #benchmarks li:last-child a {
+                border-bottom-left-radius: 10px;
+                border-bottom-right-radius: 10px;
+            }
+
+            #benchmarks .shift-count {
+                display: block;
+                font-size: 12px;
+                color: #e31a1c;
+            }
+
+            #benchmarks a:hover{
+                background-color: #f5f5f5;
+            }
+
+            #benchmarks .current a {
+                background-color: #333 ;
+                color: #fff;
+            }
+
+            main {
+                margin-left: 215px;
+            }
+
+            h1 {
+                color: #222;
+                margin:15px 0;
+            }
+
+            caption {
+                font-weight:bold;
+                padding-bottom: 10px;
+            }
+
+            #trend {
+                min-width: 600px;
+                height: 600px;
+                margin-bottom:15px;
+                border:1px solid #eee;
+                box-shadow: 0 0 3px rgba(0, 0, 0, 0.05);
+            }
+
+            #shifts {
+                border-collapse: collapse;
+                margin-bottom:15px;
+            }
+
+            #shifts thead th {
+                color: #333;
+                font-weight:normal;
+            }
+
+            #shifts thead th, #shifts tr td {
+                padding: 10px 15px;
+            }
+
+            #shifts tr td {
+                border-top: 1px solid #D0CDCD;
+                color: #777;
+            }
+
+            #shifts td.slower {
+                color: #e31a1c;
+            }
+
+            #info {
+                clear: both;
+                border-top: 1px solid #E4E4E4;
+                background-color: #F2F2F2;
+                padding: 10px;
+            }
+
+            #info dt {
+                font-weight:bold;
+            }
+
+            #info dd {
+                margin-bottom:5px;
+            }
+        </style>
+
+    </head>
+    <body>
+        <div id="content">
+            <nav>
+                <ul id="benchmarks">
+                </ul>
+            </nav>
+
+            <main>
+                <h1 id="be)***^***",
+R"***^***(nchmark-name"> Benchmark name </h1>
+
+                <div id="trend"></div>
+
+                <table id="shifts">
+                    <caption>Shifts</caption>
+                    <thead>
+                        <tr>
+                            <th>last revision before</th>
+                            <th>first revision after</th>
+                            <th>mean before</th>
+                            <th>mean after</th>
+                            <th>change</th>
+                        </tr>
+                    </thead>
+                    <tbody>
+                    </tbody>
+                </table>
+                <p id="no-shifts">No shifts were detected.</p>
+            </main>
+        </div>
+        <div id="info">
+            <h3>Trends</h3>
+            <dl>
+                <dt>Mean over Revisions</dt>
+                <dd>
+                    The mean of each run recorded in the history (HistoryReporter) in the order the runs were recorded, with its confidence interval as a band.  Rerunning a revision adds another point.  Differences between runs that are much larger than the intervals are normal since the intervals only cover the noise within a run, not between runs.
+                </dd>
+                <dt>Shifts</dt>
+                <dd>
+                    The dashed lines mark where the mean shifted, found by PELT changepoint detection.  A shift is only reported when it is large compared to the noise between consecutive runs and lasts at least two runs, so a single slow run isn't one.  The change compares the average of the means between the surrounding shifts.
+                </dd>
+            </dl>
+        </div>
+    </body>
+</html>
+)***^***"
@@ -4,14 +4,32 @@
 #include "fp_range.h"
 #include "stats.h"
 #include "point.h"
+#include "sample_summary.h"
 
+#include <algorithm>
 #include <cmath>
+#include <complex>
 #include <cstdint>
+#include <cstring>
+#include <vector>
 
 namespace velox {
 
 namespace {
   const std::uint32_t DEFAULT_KDE_POINTS = 400;
+
+  // kde picks kde_exact when times.size() * num_points is at most this
+  const std::uint64_t KDE_EXACT_MAX_WORK = 1 << 17;
+
+  // and kde_binned once there are at least this many times, kde_truncated otherwise
+  const std::size_t KDE_BINNED_MIN_SIZE = 10000;
+
+  // Kernels are treated as 0 beyond this many bandwidths, where they are below 1e-14
+  const double KDE_TRUNCATION = 8.0;
+
+  // The grid used by kde_binned is at least this fine, up to KDE_MAX_GRID_SIZE points
+  const double KDE_BINS_PER_BANDWIDTH = 8.0;
+  const std::size_t KDE_MAX_GRID_SIZE = 1 << 16;
 }
 
 inline double snpdf(const double x) {
@@ -38,22 +56,122 @@ void linspace(const double start, const double stop, const std::uint32_t n, F &&
   f(stop);
 }
 
+inline double bandwidth_scott(const SampleSummary &summary) {
+  const auto sd = summary.std_dev().count();
+  const auto adjusted_iqr = summary.quartiles().iqr().count() / 1.34;
+  return 1.06 * (std::min)(sd, adjusted_iqr) * std::pow(static_cast<double>(summary.size()), -.2);
+}
+
 inline double bandwidth_scott(const Times &times) {
-  const auto sd = std_dev(FpRange(times));
-  const auto adjusted_iqr = quartiles(FpRange(times)).iqr() / 1.34;
-  return 1.06 * (std::min)(sd, adjusted_iqr) * std::pow(static_cast<double>(times.size()), -.2);
+  return bandwidth_scott(SampleSummary(times));
 }
 
-inline Points kde(const Times &times, const std::uint32_t num_points) {
-  assert(!times.empty() && "times must not be empty");
+namespace detail {
+  // The range the density is evaluated over, shared by every kde implementation
+  struct KdeRange {
+    KdeRange(const SampleSummary &summary) : bw_(bandwidth_scott(summary)) {
+      const auto adjustment = 3.0;
+      start_ = summary.min().count() - adjustment * bw_;
+      stop_ = summary.max().count() + adjustment * bw_;
+    }
 
-  const auto n = static_cast<double>(times.size());
-  const auto bw = bandwidth_scott(times);
+    double bandwidth() const { return bw_; }
+
+    double start() const { return start_; }
+
+    double stop() const { return stop_; }
+
+  private:
+    double bw_;
+    double start_;
+    double stop_;
+  };
+
+  // exp(x) for -700 <= x <= 0 without branches or calls into libm so loops over it vectorise.
+  // The relative error is about 1e-14.
+  inline double exp_nonpositive(const double x) {
+    const auto log2e = 1.4426950408889634;
+    const auto ln2_hi = 6.93147180369123816490e-01;
+    const auto ln2_lo = 1.90821492927058770002e-10;
+
+    const auto clamped = (std::max)(x, -700.0);
+
+    // x = k ln(2) + r with |r| <= ln(2) / 2.  Truncating rounds towards 0 so subtracting .5
+    // rounds to the nearest integer for x <= 0.
+    const auto k = static_cast<std::int64_t>(clamped * log2e - 0.5);
+    const auto kd = static_cast<double>(k);
+    const auto r = (clamped - kd * ln2_hi) - kd * ln2_lo;
+
+    // Taylor series, the first omitted term is below 1e-14
+    auto p = 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+
+    // 2^k built directly from its exponent bits
+    const auto bits = static_cast<std::uint64_t>(k + 1023) << 52;
+    double scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+
+    return p * scale;
+  }
+
+  // In place iterative radix-2 FFT, data.size() must be a power of 2
+  inline void fft(std::vector<std::complex<double>> &data, const bool inverse) {
+    const auto n = data.size();
+    assert(n && (n & (n - 1)) == 0 && "FFT size must be a power of 2");
+
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+      auto bit = n >> 1;
+      for (; j & bit; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
 
-  const auto adjustment = 3.0;
-  const auto mm = std::minmax_element(times.begin(), times.end());
-  const auto start = mm.first->count() - adjustment * bw;
-  const auto stop = mm.second->count() + adjustment * bw;
+      if (i < j) {
+        std::swap(data[i], data[j]);
+      }
+    }
+
+    const auto PI = 3.14159265358979323846;
+    for (std::size_t len = 2; len <= n; len <<= 1) {
+      const auto angle = (inverse ? 2.0 : -2.0) * PI / static_cast<double>(len);
+      const std::complex<double> step(std::cos(angle), std::sin(angle));
+
+      for (std::size_t i = 0; i < n; i += len) {
+        std::complex<double> w(1.0, 0.0);
+        for (std::size_t j = 0; j < len / 2; ++j) {
+          const auto u = data[i + j];
+          const auto v = data[i + j + len / 2] * w;
+          data[i + j] = u + v;
+          data[i + j + len / 2] = u - v;
+          w *= step;
+        }
+      }
+    }
+
+    if (inverse) {
+      for (auto &d : data) {
+        d /= static_cast<double>(n);
+      }
+    }
+  }
+}
+
+// The kernels are evaluated for every pair of time and output point
+inline Points kde_exact(const SampleSummary &summary, const std::uint32_t num_points) {
+  const auto &times = summary.sorted();
+  const auto n = static_cast<double>(times.size());
+  const detail::KdeRange range(summary);
+  const auto bw = range.bandwidth();
 
   const auto kde_calc = [&times, &n, &bw](double x) -> double {
     double sum = 0.0;
@@ -66,12 +184,153 @@ inline Points kde(const Times &times, const std::uint32_t num_points) {
 
   auto points = vector_with_capacity<Point>(num_points);
 
-  linspace(start, stop, num_points, [&kde_calc, &points](double x) {
+  linspace(range.start(), range.stop(), num_points, [&kde_calc, &points](double x) {
     points.emplace_back(x, kde_calc(x));
   });
 
   return points;
 }
+
+// Sorts the times so each output point only evaluates the kernels of the times within
+// KDE_TRUNCATION bandwidths of it, using detail::exp_nonpositive over the window
+inline Points kde_truncated(const SampleSummary &summary, const std::uint32_t num_points) {
+  const detail::KdeRange range(summary);
+  const auto bw = range.bandwidth();
+  if (!(bw > 0.0)) {
+    return kde_exact(summary, num_points);
+  }
+
+  const auto &sorted = summary.sorted();
+
+  const auto PI = 3.14159265358979323846;
+  const auto norm = 1.0 / std::sqrt(2.0 * PI) / static_cast<double>(sorted.size()) / bw;
+  const auto cutoff = KDE_TRUNCATION * bw;
+  const auto recip_bw = 1.0 / bw;
+
+  std::size_t lo = 0, hi = 0;
+  auto points = vector_with_capacity<Point>(num_points);
+
+  linspace(range.start(), range.stop(), num_points, [&](double x) {
+    while (lo < sorted.size() && sorted[lo].count() < x - cutoff) {
+      ++lo;
+    }
+    hi = (std::max)(hi, lo);
+    while (hi < sorted.size() && sorted[hi].count() <= x + cutoff) {
+      ++hi;
+    }
+
+    double sum = 0.0;
+    for (auto i = lo; i < hi; ++i) {
+      const auto z = (x - sorted[i].count()) * recip_bw;
+      sum += detail::exp_nonpositive(-0.5 * z * z);
+    }
+
+    points.emplace_back(x, sum * norm);
+  });
+
+  return points;
+}
+
+// Linearly bins the times onto a grid at least KDE_BINS_PER_BANDWIDTH times finer than the
+// bandwidth which contains the output points, then convolves the bin counts with the kernel
+// using an FFT.  The cost no longer depends on the product of the number of times and points.
+inline Points kde_binned(const SampleSummary &summary, const std::uint32_t num_points) {
+  const detail::KdeRange range(summary);
+  const auto bw = range.bandwidth();
+  if (!(bw > 0.0) || num_points < 2) {
+    return kde_exact(summary, num_points);
+  }
+
+  const auto &times = summary.sorted();
+
+  const auto start = range.start(), stop = range.stop();
+  const auto intervals = static_cast<std::size_t>(num_points - 1);
+
+  // Every output point is a grid point
+  const auto step_per_point = (stop - start) / static_cast<double>(intervals);
+  const auto max_refinement = (std::max)(KDE_MAX_GRID_SIZE / intervals, std::size_t(1));
+  const auto refinement = (std::min)(
+      static_cast<std::size_t>(std::ceil(step_per_point / (bw / KDE_BINS_PER_BANDWIDTH))),
+      max_refinement);
+  const auto grid_size = intervals * (std::max)(refinement, std::size_t(1)) + 1;
+  const auto delta = (stop - start) / static_cast<double>(grid_size - 1);
+
+  // Kernel values beyond KDE_TRUNCATION bandwidths are negligible
+  const auto kernel_radius = (std::min)(
+      static_cast<std::size_t>(std::ceil(KDE_TRUNCATION * bw / delta)), grid_size - 1);
+
+  std::size_t fft_size = 1;
+  while (fft_size < grid_size + kernel_radius) {
+    fft_size <<= 1;
+  }
+
+  std::vector<std::complex<double>> bins(fft_size), kernel(fft_size);
+
+  for (const auto &t : times) {
+    const auto pos = (t.count() - start) / delta;
+    const auto i = (std::min)(static_cast<std::size_t>((std::max)(pos, 0.0)), grid_size - 2);
+    const auto f = (std::min)((std::max)(pos - static_cast<double>(i), 0.0), 1.0);
+    bins[i] += 1.0 - f;
+    bins[i + 1] += f;
+  }
+
+  for (std::size_t j = 0; j <= kernel_radius; ++j) {
+    const auto k = snpdf(static_cast<double>(j) * delta / bw);
+    kernel[j] = k;
+    if (j) {
+      kernel[fft_size - j] = k;
+    }
+  }
+
+  detail::fft(bins, false);
+  detail::fft(kernel, false);
+  for (std::size_t i = 0; i < fft_size; ++i) {
+    bins[i] *= kernel[i];
+  }
+  detail::fft(bins, true);
+
+  const auto norm = 1.0 / static_cast<double>(times.size()) / bw;
+  const auto grid_step = (grid_size - 1) / intervals;
+
+  auto points = vector_with_capacity<Point>(num_points);
+  std::size_t i = 0;
+  linspace(start, stop, num_points, [&](double x) {
+    // Rounding in the FFT can leave tiny negative densities far from the data
+    points.emplace_back(x, (std::max)(bins[i * grid_step].real() * norm, 0.0));
+    ++i;
+  });
+
+  return points;
+}
+
+// Picks the kde implementation by the amount of work the exact one would do
+inline Points kde(const SampleSummary &summary, const std::uint32_t num_points) {
+  const auto work = std::uint64_t{summary.size()} * num_points;
+
+  if (work <= KDE_EXACT_MAX_WORK) {
+    return kde_exact(summary, num_points);
+  } else if (summary.size() < KDE_BINNED_MIN_SIZE) {
+    return kde_truncated(summary, num_points);
+  }
+
+  return kde_binned(summary, num_points);
+}
+
+inline Points kde_exact(const Times &times, const std::uint32_t num_points) {
+  return kde_exact(SampleSummary(times), num_points);
+}
+
+inline Points kde_truncated(const Times &times, const std::uint32_t num_points) {
+  return kde_truncated(SampleSummary(times), num_points);
+}
+
+inline Points kde_binned(const Times &times, const std::uint32_t num_points) {
+  return kde_binned(SampleSummary(times), num_points);
+}
+
+inline Points kde(const Times &times, const std::uint32_t num_points) {
+  return kde(SampleSummary(times), num_points);
+}
 }
 
 #endif // VELOX_KDE_H_INCLUDED
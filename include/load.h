@@ -0,0 +1,215 @@
+#ifndef VELOX_LOAD_H_INCLUDED
+#define VELOX_LOAD_H_INCLUDED
+
+#include "util.h"
+#include "stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace velox {
+
+// When the requests of a load test are issued
+enum class ArrivalProcess {
+  // Evenly spaced at the target rate
+  fixed,
+  // Exponentially distributed gaps with the target rate as the mean, like independent users
+  poisson
+};
+
+// Settings for Velox::load
+struct LoadConfig {
+  LoadConfig()
+      : duration_(1000), num_threads_(1), arrival_process_(ArrivalProcess::poisson),
+        seed_(std::random_device{}()) {}
+
+  // The request rates to sweep, in requests per second
+  LoadConfig &rates(const std::vector<double> &rates) {
+    assert(std::all_of(rates.begin(), rates.end(), [](double r) { return r > 0.0; }) &&
+           "Rates must be positive");
+    rates_ = rates;
+    return *this;
+  }
+
+  const std::vector<double> &rates() const { return rates_; }
+
+  // How long to issue requests for at each rate
+  LoadConfig &duration(const Ms ms) {
+    assert(ms.count() > 0 && "Duration must be positive");
+    duration_ = ms;
+    return *this;
+  }
+
+  Ms duration() const { return duration_; }
+
+  // The number of threads issuing requests.  The function must be safe to call concurrently when
+  // there is more than one.
+  LoadConfig &num_threads(const std::uint32_t n) {
+    assert(n && "At least one thread is required");
+    num_threads_ = n;
+    return *this;
+  }
+
+  std::uint32_t num_threads() const { return num_threads_; }
+
+  LoadConfig &arrival_process(const ArrivalProcess process) {
+    arrival_process_ = process;
+    return *this;
+  }
+
+  ArrivalProcess arrival_process() const { return arrival_process_; }
+
+  // Seed for the Poisson arrivals, random by default
+  LoadConfig &seed(const std::uint32_t s) {
+    seed_ = s;
+    return *this;
+  }
+
+  std::uint32_t seed() const { return seed_; }
+
+private:
+  std::vector<double> rates_;
+  Ms duration_;
+  std::uint32_t num_threads_;
+  ArrivalProcess arrival_process_;
+  std::uint32_t seed_;
+};
+
+// When each request should start, relative to the start of the load test
+inline std::vector<Ns> arrival_offsets(const double rate,
+                                       const Ms duration,
+                                       const ArrivalProcess process,
+                                       const std::uint32_t seed) {
+  assert(rate > 0.0 && "Rate must be positive");
+
+  const auto end = std::chrono::duration_cast<FpNs>(duration).count();
+  const auto gap = 1e9 / rate;
+
+  std::mt19937 rng(seed);
+  std::exponential_distribution<double> exponential(1.0);
+
+  auto offsets = vector_with_capacity<Ns>(static_cast<std::size_t>(end / gap) + 1);
+  for (auto t = 0.0; t < end;) {
+    offsets.push_back(Ns(static_cast<Ns::rep>(t)));
+    t += process == ArrivalProcess::fixed ? gap : gap * exponential(rng);
+  }
+
+  return offsets;
+}
+
+// The results of issuing requests at one rate.  Latencies are measured from when each request
+// was supposed to start so requests which were held up by slow earlier requests count the time
+// they waited, which corrects for coordinated omission.  Service times are measured from when
+// the requests actually started, which is what closed loop timing sees.
+struct LoadPoint {
+  LoadPoint(const double target_rate, const double throughput, Times latencies, Times service_times)
+      : target_rate_(target_rate), throughput_(throughput), latencies_(std::move(latencies)),
+        service_times_(std::move(service_times)) {
+    std::sort(latencies_.begin(), latencies_.end());
+    std::sort(service_times_.begin(), service_times_.end());
+  }
+
+  // Requests per second
+  double target_rate() const { return target_rate_; }
+
+  // Completed requests per second
+  double throughput() const { return throughput_; }
+
+  std::size_t num_requests() const { return latencies_.size(); }
+
+  FpNs latency(const double p) const { return percentile_of_sorted(latencies_, p); }
+
+  FpNs service_time(const double p) const { return percentile_of_sorted(service_times_, p); }
+
+  FpNs max_latency() const { return latencies_.back(); }
+
+  // Sorted
+  const Times &latencies() const { return latencies_; }
+
+  // Sorted
+  const Times &service_times() const { return service_times_; }
+
+private:
+  double target_rate_;
+  double throughput_;
+  Times latencies_;
+  Times service_times_;
+};
+
+namespace detail {
+  // Clocks can provide their own wait_until, such as a simulated clock which jumps straight to t
+  template <class C>
+  auto wait_until(const TimePoint<C> t, int) -> decltype(C::wait_until(t), void()) {
+    C::wait_until(t);
+  }
+
+  // Sleeps until shortly before t then spins, sleeping is too coarse to hit t on its own
+  template <class C>
+  void wait_until(const TimePoint<C> t, long) {
+    const auto spin = std::chrono::microseconds(200);
+
+    auto now = C::now();
+    if (t - now > spin) {
+      std::this_thread::sleep_for(t - now - spin);
+    }
+
+    while (C::now() < t) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+// Issues requests at the given rate, calling f once per request.  The threads share one
+// schedule and each picks the next request when it is done with its previous one, so when f
+// can't keep up the requests queue rather than being dropped.
+template <class C, class F>
+LoadPoint run_load(F &&f, const double rate, const LoadConfig &config) {
+  const auto offsets =
+      arrival_offsets(rate, config.duration(), config.arrival_process(), config.seed());
+  const auto n = offsets.size();
+
+  Times latencies(n), service_times(n);
+  std::atomic<std::size_t> next(0);
+  std::vector<TimePoint<C>> last_completions(config.num_threads());
+
+  const auto start = C::now();
+
+  const auto worker = [&](const std::size_t thread) {
+    for (auto i = next++; i < n; i = next++) {
+      const auto intended = start + std::chrono::duration_cast<Duration<C>>(offsets[i]);
+      detail::wait_until<C>(intended, 0);
+
+      const auto actual = C::now();
+      f();
+      const auto done = C::now();
+
+      latencies[i] = std::chrono::duration_cast<FpNs>(done - intended);
+      service_times[i] = std::chrono::duration_cast<FpNs>(done - actual);
+      last_completions[thread] = done;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 1; t < config.num_threads(); ++t) {
+    threads.emplace_back(worker, t);
+  }
+  worker(0);
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  // Poisson arrivals can finish early, so the test lasts at least the configured duration
+  const auto end = *std::max_element(last_completions.begin(), last_completions.end());
+  const auto elapsed = (std::max)(std::chrono::duration_cast<FpNs>(end - start),
+                                  std::chrono::duration_cast<FpNs>(config.duration()));
+  const auto throughput = static_cast<double>(n) / (elapsed.count() / 1e9);
+
+  return LoadPoint(rate, throughput, std::move(latencies), std::move(service_times));
+}
+}
+
+#endif // VELOX_LOAD_H_INCLUDED
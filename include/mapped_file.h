@@ -0,0 +1,120 @@
+#ifndef VELOX_MAPPED_FILE_H_INCLUDED
+#define VELOX_MAPPED_FILE_H_INCLUDED
+
+#include <fstream>
+#include <iterator>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VELOX_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace velox {
+
+// A read only view of a whole file.  Where mmap is available the file is mapped so a large file
+// is paged in as it is parsed instead of being copied first; elsewhere it is read into memory.
+struct MappedFile {
+  explicit MappedFile(const std::string &path)
+      : is_open_(false), data_(nullptr), size_(0), mapping_(nullptr) {
+#ifdef VELOX_HAS_MMAP
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+
+    struct stat status;
+    if (::fstat(fd, &status) == 0 && status.st_size >= 0) {
+      size_ = static_cast<std::size_t>(status.st_size);
+      is_open_ = true;
+      if (size_) {
+        mapping_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping_ == MAP_FAILED) {
+          mapping_ = nullptr;
+          is_open_ = false;
+          size_ = 0;
+        } else {
+          ::madvise(mapping_, size_, MADV_SEQUENTIAL);
+          data_ = static_cast<const char *>(mapping_);
+        }
+      }
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      return;
+    }
+
+    contents_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    is_open_ = true;
+    data_ = contents_.data();
+    size_ = contents_.size();
+#endif
+  }
+
+  MappedFile(const MappedFile &rhs) = delete;
+  MappedFile &operator=(const MappedFile &rhs) = delete;
+
+  ~MappedFile() {
+#ifdef VELOX_HAS_MMAP
+    if (mapping_) {
+      ::munmap(mapping_, size_);
+    }
+#endif
+  }
+
+  bool is_open() const { return is_open_; }
+
+  // The file's contents, which aren't null terminated
+  const char *data() const { return data_; }
+
+  std::size_t size() const { return size_; }
+
+private:
+  bool is_open_;
+  const char *data_;
+  std::size_t size_;
+  void *mapping_;
+  std::vector<char> contents_;
+};
+
+// Lets a std::istream read from memory, such as a MappedFile, without copying it
+struct MemoryBuffer : std::streambuf {
+  MemoryBuffer(const char *data, const std::size_t size) {
+    const auto first = const_cast<char *>(data);
+    setg(first, first, first + size);
+  }
+
+protected:
+  // Seeking lets a stream be read more than once, e.g. by OfflineAnalysis::add_results
+  pos_type seekoff(const off_type off,
+                   const std::ios_base::seekdir dir,
+                   const std::ios_base::openmode which) override {
+    if (!(which & std::ios_base::in)) {
+      return pos_type(off_type(-1));
+    }
+
+    const auto from = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr()
+                                                                                       : egptr();
+    const auto position = (from - eback()) + off;
+    if (position < 0 || position > egptr() - eback()) {
+      return pos_type(off_type(-1));
+    }
+
+    setg(eback(), eback() + position, egptr());
+    return pos_type(position);
+  }
+
+  pos_type seekpos(const pos_type pos, const std::ios_base::openmode which) override {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+};
+}
+
+#endif // VELOX_MAPPED_FILE_H_INCLUDED
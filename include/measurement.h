@@ -3,19 +3,26 @@
 
 #include "point.h"
 
+#include <algorithm>
+
 namespace velox {
 
 struct Measurement {
 
-  Measurement(std::uint64_t iterations, Ns time) : iters_(iterations), duration_(time) {}
+  Measurement(std::uint64_t iterations, Ns time, Ns start_time = Ns(0))
+      : iters_(iterations), duration_(time), start_(start_time) {}
 
   std::uint64_t iters() const { return iters_; }
 
   Ns duration() const { return duration_; }
 
+  // When the measurement started, relative to the start of the first measurement
+  Ns start() const { return start_; }
+
 private:
   std::uint64_t iters_;
   Ns duration_;
+  Ns start_;
 };
 
 using Measurements = std::vector<Measurement>;
@@ -28,6 +35,13 @@ inline Points measurements_to_points(const Measurements &measurements) {
 
   return ps;
 }
+
+// Whether every measurement ran the same number of iterations, as with flat sampling
+inline bool is_flat(const Measurements &measurements) {
+  return std::all_of(measurements.begin(), measurements.end(), [&](const Measurement &m) {
+    return m.iters() == measurements.front().iters();
+  });
+}
 }
 
 #endif // VELOX_MEASUREMENT_H_INCLUDED
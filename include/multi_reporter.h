@@ -27,6 +27,18 @@ struct MultiReporter : Reporter {
     call(fp(&Reporter::estimate_clock_cost_ended), cost);
   }
 
+  void clock_resolution_estimated(FpNs resolution) override {
+    call(fp(&Reporter::clock_resolution_estimated), resolution);
+  }
+
+  void quick_mode_enabled() override { call(fp(&Reporter::quick_mode_enabled)); }
+
+  void merge_refused(const std::string &checkpoint,
+                     const std::string &checkpoint_environment,
+                     const std::string &environment) override {
+    call(fp(&Reporter::merge_refused), checkpoint, checkpoint_environment, environment);
+  }
+
   void warm_up_starting(Ms ms) override { call(fp(&Reporter::warm_up_starting), ms); }
 
   void warm_up_ended(const ItersForDurationNs &wu) override {
@@ -48,10 +60,25 @@ struct MultiReporter : Reporter {
     call(fp(&Reporter::measurement_collection_starting), num_measurements, measurement_time);
   }
 
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    call(fp(&Reporter::measurements_too_short), num_short, num_measurements, min_duration);
+  }
+
   void measurement_collection_ended(const Measurements &measurements,
                                     const Times &times,
+                                    const SampleSummary &summary,
                                     const Outliers &outliers) override {
-    call(fp(&Reporter::measurement_collection_ended), measurements, times, outliers);
+    call(fp(&Reporter::measurement_collection_ended), measurements, times, summary, outliers);
+  }
+
+  void autocorrelation_estimated(const Autocorrelation &autocorrelation) override {
+    call(fp(&Reporter::autocorrelation_estimated), autocorrelation);
+  }
+
+  void periodic_interference_estimated(const PeriodicInterference &interference) override {
+    call(fp(&Reporter::periodic_interference_estimated), interference);
   }
 
   void estimate_statistics_starting(std::uint32_t num_resamples) override {
@@ -62,6 +89,16 @@ struct MultiReporter : Reporter {
     call(fp(&Reporter::estimate_statistics_ended), statistics);
   }
 
+  void load_test_starting(const std::string &name, const LoadConfig &config) override {
+    call(fp(&Reporter::load_test_starting), name, config);
+  }
+
+  void load_point_measured(const LoadPoint &point) override {
+    call(fp(&Reporter::load_point_measured), point);
+  }
+
+  void load_test_ended() override { call(fp(&Reporter::load_test_ended)); }
+
   void suite_ended() override { call(fp(&Reporter::suite_ended)); }
 
 private:
@@ -0,0 +1,297 @@
+#ifndef VELOX_OFFLINE_ANALYSIS_H_INCLUDED
+#define VELOX_OFFLINE_ANALYSIS_H_INCLUDED
+
+#include "checkpoint.h"
+#include "deferred.h"
+#include "history.h"
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace velox {
+
+// How the latencies in a log from outside velox are read
+struct LatencyLogConfig {
+  LatencyLogConfig()
+      : column_(0), ns_per_unit_(1.0), batch_(1),
+        num_threads_((std::max)(std::thread::hardware_concurrency(), 1u)) {}
+
+  // The comma separated column of a CSV log which holds the latencies, counting from 0
+  LatencyLogConfig &column(const std::size_t c) {
+    column_ = c;
+    return *this;
+  }
+
+  std::size_t column() const { return column_; }
+
+  // The length of the unit the latencies are in, e.g. 1000 for microseconds
+  LatencyLogConfig &ns_per_unit(const double ns) {
+    assert(ns > 0.0 && "The unit must be positive");
+    ns_per_unit_ = ns;
+    return *this;
+  }
+
+  double ns_per_unit() const { return ns_per_unit_; }
+
+  // The number of consecutive latencies in each measurement.  The default of 1 analyzes every
+  // latency on its own; larger batches make the bootstrap of a long log affordable at the cost
+  // of only seeing the distribution of the batches' means.  A partial last batch is left out.
+  LatencyLogConfig &batch(const std::uint64_t b) {
+    assert(b && "Batches must have at least one latency");
+    batch_ = b;
+    return *this;
+  }
+
+  std::uint64_t batch() const { return batch_; }
+
+  // The number of threads which parse a CSV log, each taking an equal share of its lines
+  LatencyLogConfig &num_threads(const std::uint32_t n) {
+    assert(n && "At least one thread is required");
+    num_threads_ = n;
+    return *this;
+  }
+
+  std::uint32_t num_threads() const { return num_threads_; }
+
+private:
+  std::size_t column_;
+  double ns_per_unit_;
+  std::uint64_t batch_;
+  std::uint32_t num_threads_;
+};
+
+namespace detail {
+  // Converts a latency to whole nanoseconds, rejecting negative and non finite ones
+  inline bool latency_to_ns(const double latency, const double ns_per_unit, Ns &ns) {
+    const auto scaled = std::round(latency * ns_per_unit);
+    if (!(scaled >= 0.0 && scaled < 9.2e18)) {
+      return false;
+    }
+
+    ns = Ns(static_cast<Ns::rep>(scaled));
+    return true;
+  }
+
+  // Parses the number in [first, last), ignoring surrounding spaces.  Mapped files aren't null
+  // terminated so the number is copied before strtod reads it.
+  inline bool parse_latency(const char *first, const char *last, double &d) {
+    while (first != last && (*first == ' ' || *first == '\t')) {
+      ++first;
+    }
+    while (last != first && (last[-1] == ' ' || last[-1] == '\t' || last[-1] == '\r')) {
+      --last;
+    }
+
+    char number[64];
+    const auto length = static_cast<std::size_t>(last - first);
+    if (!length || length >= sizeof(number)) {
+      return false;
+    }
+    std::memcpy(number, first, length);
+    number[length] = '\0';
+
+    char *end = nullptr;
+    d = std::strtod(number, &end);
+    return end == number + length;
+  }
+
+  // Appends the latency in the given column of each line of [first, last).  Lines without one,
+  // such as headers, are skipped.
+  inline void parse_latency_lines(const char *first,
+                                  const char *const last,
+                                  const LatencyLogConfig &config,
+                                  std::vector<Ns> &latencies) {
+    while (first != last) {
+      auto line_end = static_cast<const char *>(
+          std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+      if (!line_end) {
+        line_end = last;
+      }
+
+      auto field = first;
+      for (std::size_t c = 0; c < config.column() && field != line_end; ++c) {
+        const auto comma = static_cast<const char *>(
+            std::memchr(field, ',', static_cast<std::size_t>(line_end - field)));
+        field = comma ? comma + 1 : line_end;
+      }
+      auto field_end = static_cast<const char *>(
+          std::memchr(field, ',', static_cast<std::size_t>(line_end - field)));
+      if (!field_end) {
+        field_end = line_end;
+      }
+
+      double latency = 0.0;
+      Ns ns(0);
+      if (parse_latency(field, field_end, latency) &&
+          latency_to_ns(latency, config.ns_per_unit(), ns)) {
+        latencies.push_back(ns);
+      }
+
+      first = line_end == last ? last : line_end + 1;
+    }
+  }
+
+  // Groups consecutive latencies into measurements of config.batch() iterations
+  inline Measurements batch_latencies(const std::vector<std::vector<Ns>> &chunks,
+                                      const LatencyLogConfig &config) {
+    std::size_t total = 0;
+    for (const auto &c : chunks) {
+      total += c.size();
+    }
+
+    auto measurements = vector_with_capacity<Measurement>(total / config.batch());
+    std::uint64_t in_batch = 0;
+    Ns duration(0);
+    for (const auto &c : chunks) {
+      for (const auto latency : c) {
+        duration += latency;
+        if (++in_batch == config.batch()) {
+          measurements.emplace_back(in_batch, duration);
+          in_batch = 0;
+          duration = Ns(0);
+        }
+      }
+    }
+
+    return measurements;
+  }
+}
+
+// Reads a CSV log with a latency on each line.  The log is split into one share of lines per
+// thread and the shares are parsed concurrently.
+inline Measurements
+read_latency_csv(const char *const data, const std::size_t size, const LatencyLogConfig &config) {
+  const auto last = data + size;
+  const auto num_chunks = (std::max)(
+      std::size_t(1), (std::min)(static_cast<std::size_t>(config.num_threads()), size / 4096));
+
+  // Each share ends at the line break after its nominal end
+  std::vector<const char *> bounds{data};
+  for (std::size_t i = 1; i < num_chunks; ++i) {
+    auto bound = (std::max)(bounds.back(), data + size / num_chunks * i);
+    const auto line_end = static_cast<const char *>(
+        std::memchr(bound, '\n', static_cast<std::size_t>(last - bound)));
+    bounds.push_back(line_end ? line_end + 1 : last);
+  }
+  bounds.push_back(last);
+
+  std::vector<std::vector<Ns>> chunks(num_chunks);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < num_chunks; ++i) {
+    threads.emplace_back([&, i] {
+      detail::parse_latency_lines(bounds[i], bounds[i + 1], config, chunks[i]);
+    });
+  }
+  detail::parse_latency_lines(bounds[0], bounds[1], config, chunks[0]);
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  return detail::batch_latencies(chunks, config);
+}
+
+// Reads a log of latencies stored as 64 bit unsigned integers in the machine's byte order.  A
+// partial value at the end is ignored.
+inline Measurements read_latency_binary(const char *const data,
+                                        const std::size_t size,
+                                        const LatencyLogConfig &config) {
+  const auto count = size / sizeof(std::uint64_t);
+  std::vector<std::vector<Ns>> chunks(1);
+  chunks[0].reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    std::uint64_t latency = 0;
+    std::memcpy(&latency, data + i * sizeof(latency), sizeof(latency));
+
+    Ns ns(0);
+    if (detail::latency_to_ns(static_cast<double>(latency), config.ns_per_unit(), ns)) {
+      chunks[0].push_back(ns);
+    }
+  }
+
+  return detail::batch_latencies(chunks, config);
+}
+
+// Analyzes measurements which were collected earlier, such as a suite's checkpoint or latencies
+// logged by a service, without measuring anything.  The benchmarks are analyzed concurrently
+// when run is called and reported in the order they were added, so the statistics can be
+// estimated again with a different configuration and given to any reporter.
+struct OfflineAnalysis {
+  // A benchmark from a checkpoint, reported along with what was reported while its measurements
+  // were collected
+  void add(const CheckpointEntry &entry) {
+    auto &events = deferred_.next();
+    events.benchmark_starting(entry.name());
+    replay_measurement(entry, events);
+    deferred_.analyze_later(Measurements(entry.measurements()));
+  }
+
+  // Measurements from outside velox, e.g. from read_latency_csv, which have no warm up
+  void add(const std::string &name, Measurements &&measurements) {
+    FpNs total(0);
+    for (const auto &m : measurements) {
+      total += m.duration();
+    }
+
+    auto &events = deferred_.next();
+    events.benchmark_starting(name);
+    events.measurement_collection_starting(static_cast<std::uint32_t>(measurements.size()),
+                                           total);
+    deferred_.analyze_later(std::move(measurements));
+  }
+
+  // Adds every benchmark in a checkpoint or, failing that, the latest run with raw measurements
+  // of every benchmark in a history (see HistoryReporter).  Returns whether any were found.
+  bool add_results(std::istream &is) {
+    const auto entries = read_checkpoint(is);
+    for (const auto &e : entries) {
+      add(e);
+    }
+    if (!entries.empty()) {
+      return true;
+    }
+
+    is.clear();
+    is.seekg(0);
+
+    auto found = false;
+    for (const auto &history : read_history(is)) {
+      const auto &runs = history.entries();
+      const auto latest = std::find_if(runs.rbegin(), runs.rend(), [](const HistoryEntry &e) {
+        return !e.raw_measurements().empty();
+      });
+      if (latest != runs.rend()) {
+        add(history.name(), Measurements(latest->raw_measurements()));
+        found = true;
+      }
+    }
+    return found;
+  }
+
+  bool empty() const { return deferred_.empty(); }
+
+  // Reports everything which was added as one suite
+  void run(const VeloxConfig &config, Reporter &reporter) {
+    reporter.suite_starting("stored measurements", true);
+    if (config.quick_mode()) {
+      reporter.quick_mode_enabled();
+    }
+
+    deferred_.run(config, reporter);
+    reporter.suite_ended();
+  }
+
+private:
+  DeferredAnalysis deferred_;
+};
+}
+
+#endif // VELOX_OFFLINE_ANALYSIS_H_INCLUDED
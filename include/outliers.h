@@ -3,7 +3,10 @@
 
 #include "util.h"
 #include "stats.h"
+#include "sample_summary.h"
 
+#include <array>
+#include <cstdint>
 #include <vector>
 
 namespace velox {
@@ -28,46 +31,140 @@ private:
   FpNs low_severe_;
 };
 
+// Where a time falls relative to the Thresholds
+enum class OutlierSeverity : std::uint8_t { low_severe, low_mild, normal, high_mild, high_severe };
+
+// The classification of every time, one byte per time in the same order as the times, along with
+// the number of times of each severity
 struct Outliers {
-  Outliers(const Times &times) : quartiles_(::velox::quartiles(times)), thresholds_(quartiles_) {
+  Outliers(const Times &times) : Outliers(times, SampleSummary(times)) {}
+
+  Outliers(const Times &times, const SampleSummary &summary)
+      : quartiles_(summary.quartiles()), thresholds_(quartiles_) {
+    counts_.fill(0);
+    severities_.reserve(times.size());
+
     for (const auto &t : times) {
-      if (t < thresholds_.low_severe()) {
-        low_severe_.push_back(t);
-      } else if (t < thresholds_.low_mild()) {
-        low_mild_.push_back(t);
-      } else if (t > thresholds_.high_severe()) {
-        high_severe_.push_back(t);
-      } else if (t > thresholds_.high_mild()) {
-        high_mild_.push_back(t);
-      } else {
-        normal_.push_back(t);
-      }
+      const auto severity = classify(t);
+      severities_.push_back(severity);
+      ++counts_[static_cast<std::size_t>(severity)];
     }
   }
 
-  const Times &high_severe() const { return high_severe_; }
+  // The severity of times[i]
+  OutlierSeverity severity(const std::size_t i) const { return severities_[i]; }
 
-  const Times &high_mild() const { return high_mild_; }
+  const std::vector<OutlierSeverity> &severities() const { return severities_; }
 
-  const Times &low_mild() const { return low_mild_; }
+  // The number of times with the given severity
+  std::size_t count(const OutlierSeverity severity) const {
+    return counts_[static_cast<std::size_t>(severity)];
+  }
 
-  const Times &low_severe() const { return low_severe_; }
+  // The number of times which aren't OutlierSeverity::normal
+  std::size_t num_outliers() const { return size() - count(OutlierSeverity::normal); }
 
-  const Times &normal() const { return normal_; }
+  std::size_t size() const { return severities_.size(); }
 
   const Quartiles<FpNs> &quartiles() const { return quartiles_; }
 
   const Thresholds &thresholds() const { return thresholds_; }
 
+  OutlierSeverity classify(const FpNs t) const {
+    if (t < thresholds_.low_severe()) {
+      return OutlierSeverity::low_severe;
+    } else if (t < thresholds_.low_mild()) {
+      return OutlierSeverity::low_mild;
+    } else if (t > thresholds_.high_severe()) {
+      return OutlierSeverity::high_severe;
+    } else if (t > thresholds_.high_mild()) {
+      return OutlierSeverity::high_mild;
+    }
+    return OutlierSeverity::normal;
+  }
+
 private:
-  Times high_severe_;
-  Times high_mild_;
-  Times low_mild_;
-  Times low_severe_;
-  Times normal_;
+  std::vector<OutlierSeverity> severities_;
+  std::array<std::size_t, 5> counts_;
   Quartiles<FpNs> quartiles_;
   Thresholds thresholds_;
 };
+
+// How much the outliers inflate the variance of the sample, as categorized by criterion
+enum class OutlierEffect { unaffected, slight, moderate, severe };
+
+inline const char *outlier_effect_name(const OutlierEffect effect) {
+  switch (effect) {
+  case OutlierEffect::unaffected:
+    break;
+  case OutlierEffect::slight:
+    return "slight";
+  case OutlierEffect::moderate:
+    return "moderate";
+  case OutlierEffect::severe:
+    return "severe";
+  }
+
+  return "unaffected";
+}
+
+// The proportion of the sample's variance which is explained by outliers rather than by the
+// function's own variation, using the model from Haskell's criterion library.  The sample is
+// treated as a normal "good" distribution contaminated by a uniform distribution of outliers and
+// the fraction is the smallest share of the variance the contamination could account for.
+struct OutlierVariance {
+  OutlierVariance(const FpNs mean, const FpNs std_dev, const std::size_t sample_size)
+      : fraction_(0.0) {
+    const auto a = static_cast<double>(sample_size);
+    const auto sb2 = std_dev.count() * std_dev.count();
+
+    if (!(sb2 > 0.0) || sample_size == 0) {
+      return;
+    }
+
+    const auto ua = mean.count() / a;
+    const auto ug_min = ua / 2.0;
+    const auto sg = (std::min)(ug_min / 4.0, std_dev.count() / std::sqrt(a));
+    const auto sg2 = sg * sg;
+
+    const auto var_out = [=](const double c) {
+      const auto ac = a - c;
+      return (ac / a) * (sb2 - ac * sg2);
+    };
+
+    const auto c_max = [=](const double x) {
+      const auto k = ua - x;
+      const auto ad = a * k * k;
+      const auto k0 = -a * ad;
+      const auto k1 = sb2 - a * sg2 + ad;
+      const auto det = k1 * k1 - 4.0 * sg2 * k0;
+      return std::floor(-2.0 * k0 / (k1 + std::sqrt(det)));
+    };
+
+    const auto c = (std::min)(c_max(0.0), c_max(ug_min));
+    fraction_ = (std::min)((std::max)((std::min)(var_out(1.0), var_out(c)) / sb2, 0.0), 1.0);
+  }
+
+  explicit OutlierVariance(const SampleSummary &summary)
+      : OutlierVariance(summary.mean(), summary.std_dev(), summary.size()) {}
+
+  // Between 0 and 1
+  double fraction() const { return fraction_; }
+
+  OutlierEffect effect() const {
+    if (fraction_ < 0.01) {
+      return OutlierEffect::unaffected;
+    } else if (fraction_ < 0.1) {
+      return OutlierEffect::slight;
+    } else if (fraction_ < 0.5) {
+      return OutlierEffect::moderate;
+    }
+    return OutlierEffect::severe;
+  }
+
+private:
+  double fraction_;
+};
 }
 
 #endif // VELOX_OUTLIERS_H_INCLUDED
@@ -1,6 +1,7 @@
 #ifndef VELOX_POINT_H_INCLUDED
 #define VELOX_POINT_H_INCLUDED
 
+#include <cmath>
 #include <vector>
 
 namespace velox {
@@ -17,6 +18,36 @@ private:
 };
 
 using Points = std::vector<Point>;
+
+// Drops points of a curve, sorted by x, which lie within max_error (vertically) of the straight
+// line joining the points kept either side of them, so the curve draws the same with fewer points
+inline Points thin_points(const Points &points, const double max_error) {
+  if (points.size() < 3) {
+    return points;
+  }
+
+  Points thinned{points.front()};
+
+  // Extend a segment from the last kept point for as long as it passes close to every point it
+  // skips
+  std::size_t anchor = 0;
+  for (std::size_t end = 2; end < points.size(); ++end) {
+    const auto &a = points[anchor], &b = points[end];
+    const auto slope = (b.y() - a.y()) / (b.x() - a.x());
+
+    for (auto i = anchor + 1; i < end; ++i) {
+      const auto &p = points[i];
+      if (std::abs(a.y() + slope * (p.x() - a.x()) - p.y()) > max_error) {
+        anchor = end - 1;
+        thinned.push_back(points[anchor]);
+        break;
+      }
+    }
+  }
+
+  thinned.push_back(points.back());
+  return thinned;
+}
 }
 
 #endif // VELOX_POINT_H_INCLUDED
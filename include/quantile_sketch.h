@@ -0,0 +1,228 @@
+#ifndef VELOX_QUANTILE_SKETCH_H_INCLUDED
+#define VELOX_QUANTILE_SKETCH_H_INCLUDED
+
+#include "util.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace velox {
+
+namespace {
+  const std::uint32_t DEFAULT_SKETCH_SIZE = 512;
+}
+
+inline double sketch_value(const FpNs ns) {
+  return ns.count();
+}
+
+inline double sketch_value(const double d) {
+  return d;
+}
+
+// A bounded memory summary of a stream of values.
+//
+// Values are buffered in a stack of compactors, each holding at most `size` values.  When a
+// compactor fills up it is sorted and every other value is promoted to the next compactor with
+// twice the weight, in the style of
+// https://en.wikipedia.org/wiki/Quantile_sketch (MRL/KLL sketches).  Until the first compaction
+// the sketch is exact, afterwards the rank error is roughly log2(n / size) / size.
+//
+// The mean and standard deviation are tracked separately and are always exact.
+template <class T>
+struct QuantileSketch {
+  QuantileSketch(const std::uint32_t size = DEFAULT_SKETCH_SIZE)
+      : size_(size), count_(0), mean_(0.0), m2_(0.0) {
+    assert(size_ >= 2 && "Sketch size must be at least 2");
+  }
+
+  void add(const T t) {
+    const auto v = sketch_value(t);
+
+    ++count_;
+    const auto delta = v - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    m2_ += delta * (v - mean_);
+
+    insert(0, v);
+  }
+
+  void merge(const QuantileSketch &rhs) {
+    if (rhs.count_ == 0) {
+      return;
+    }
+
+    const auto n = static_cast<double>(count_ + rhs.count_);
+    const auto delta = rhs.mean_ - mean_;
+    m2_ += rhs.m2_ + delta * delta * static_cast<double>(count_) *
+                         static_cast<double>(rhs.count_) / n;
+    mean_ += delta * static_cast<double>(rhs.count_) / n;
+    count_ += rhs.count_;
+
+    for (std::size_t level = 0; level < rhs.levels_.size(); ++level) {
+      for (const auto v : rhs.levels_[level]) {
+        insert(level, v);
+      }
+    }
+  }
+
+  std::uint64_t count() const { return count_; }
+
+  bool empty() const { return count_ == 0; }
+
+  std::uint32_t size() const { return size_; }
+
+  // Number of values actually retained by the sketch
+  std::size_t retained() const {
+    std::size_t n = 0;
+    for (const auto &l : levels_) {
+      n += l.size();
+    }
+    return n;
+  }
+
+  T mean() const {
+    assert(count_ && "Mean calculation requires at least one value");
+    return T(mean_);
+  }
+
+  T std_dev() const {
+    if (count_ < 2) {
+      return T(0.0);
+    }
+
+    return T(std::sqrt(m2_ / static_cast<double>(count_ - 1)));
+  }
+
+  // Same interpolation as percentile_of_sorted, exact as long as no compaction has happened
+  T percentile(const double p) const {
+    assert(count_ && "Samples requires at least one value");
+    assert(p > 0.0 && p <= 100.0 && "Percentile must be between 0 and 100");
+
+    const auto items = weighted_items();
+
+    std::uint64_t total = 0;
+    for (const auto &i : items) {
+      total += i.second;
+    }
+
+    if (total == 1) {
+      return T(items.front().first);
+    }
+
+    const auto rank = (p / 100.0) * static_cast<double>(total - 1);
+    const auto lrank = std::floor(rank);
+    const auto d = rank - lrank;
+    const auto n = static_cast<std::uint64_t>(lrank);
+
+    const auto lo = value_at_rank(items, n);
+    const auto hi = n + 1 < total ? value_at_rank(items, n + 1) : lo;
+
+    return T(lo + (hi - lo) * d);
+  }
+
+  // Fraction of the values less than t, with values equal to t counting as half
+  double proportion_below(const T t) const {
+    assert(count_ && "Samples requires at least one value");
+
+    const auto v = sketch_value(t);
+    std::uint64_t below = 0, equal = 0, weight = 1;
+
+    for (const auto &l : levels_) {
+      for (const auto x : l) {
+        if (x < v) {
+          below += weight;
+        } else if (!(v < x)) {
+          equal += weight;
+        }
+      }
+      weight *= 2;
+    }
+
+    return (static_cast<double>(below) + static_cast<double>(equal) / 2.0) /
+           static_cast<double>(total_weight());
+  }
+
+private:
+  using WeightedItems = std::vector<std::pair<double, std::uint64_t>>;
+
+  void insert(const std::size_t level, const double v) {
+    if (levels_.size() <= level) {
+      levels_.resize(level + 1);
+    }
+
+    levels_[level].push_back(v);
+
+    if (levels_[level].size() >= size_) {
+      compact(level);
+    }
+  }
+
+  void compact(const std::size_t level) {
+    auto buffer = std::move(levels_[level]);
+    levels_[level].clear();
+
+    std::sort(buffer.begin(), buffer.end());
+
+    // An odd value out stays behind so every promoted value stands for exactly two
+    if (buffer.size() % 2 != 0) {
+      levels_[level].push_back(buffer.back());
+      buffer.pop_back();
+    }
+
+    // Alternate which half survives so the compaction error doesn't accumulate in one direction
+    const std::size_t offset = (count_ + level) % 2;
+    for (std::size_t i = offset; i < buffer.size(); i += 2) {
+      insert(level + 1, buffer[i]);
+    }
+  }
+
+  std::uint64_t total_weight() const {
+    std::uint64_t total = 0, weight = 1;
+    for (const auto &l : levels_) {
+      total += weight * l.size();
+      weight *= 2;
+    }
+    return total;
+  }
+
+  WeightedItems weighted_items() const {
+    WeightedItems items;
+    items.reserve(retained());
+
+    std::uint64_t weight = 1;
+    for (const auto &l : levels_) {
+      for (const auto v : l) {
+        items.emplace_back(v, weight);
+      }
+      weight *= 2;
+    }
+
+    std::sort(items.begin(), items.end());
+    return items;
+  }
+
+  static double value_at_rank(const WeightedItems &items, const std::uint64_t rank) {
+    std::uint64_t cumulative = 0;
+    for (const auto &i : items) {
+      cumulative += i.second;
+      if (rank < cumulative) {
+        return i.first;
+      }
+    }
+
+    return items.back().first;
+  }
+
+private:
+  std::uint32_t size_;
+  std::uint64_t count_;
+  double mean_;
+  double m2_;
+  std::vector<std::vector<double>> levels_;
+};
+}
+
+#endif // VELOX_QUANTILE_SKETCH_H_INCLUDED
@@ -0,0 +1,35 @@
+#ifndef VELOX_RECORDING_REPORTER_H_INCLUDED
+#define VELOX_RECORDING_REPORTER_H_INCLUDED
+
+#include "forwarding_reporter.h"
+
+#include <vector>
+
+namespace velox {
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Records events so they can be replayed to another reporter later
+struct RecordingReporter : ForwardingReporter {
+  std::size_t size() const { return events_.size(); }
+
+  // Sends every recorded event to reporter, in the order they were recorded
+  void replay(Reporter &reporter) const {
+    for (const auto &e : events_) {
+      e(reporter);
+    }
+  }
+
+protected:
+  void forward(Event &&event) override { events_.push_back(std::move(event)); }
+
+private:
+  std::vector<Event> events_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+#endif // VELOX_RECORDING_REPORTER_H_INCLUDED
@@ -2,9 +2,12 @@
 #define VELOX_REGRESSION_H_INCLUDED
 
 #include "point.h"
+#include "stats.h"
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <vector>
 
 namespace velox {
 
@@ -45,6 +48,203 @@ inline double r_squared(const Points &points, const double slope) {
 
   return 1.0 - (residual_sum_of_squares / total_sum_of_squares);
 }
+
+// Huber M-estimate of the slope through the origin found with iteratively reweighted least
+// squares.  Points whose residuals are more than k robust standard deviations (the scaled MAD of
+// the residuals) from the line are down-weighted instead of pulling the slope towards them.
+inline double huber_slope(const Points &points, const double k = 1.345) {
+  assert(!points.empty() && "Regression requires at least one point");
+
+  auto ratios = vector_with_capacity<double>(points.size());
+  for (const auto &p : points) {
+    ratios.push_back(p.y() / p.x());
+  }
+
+  // The median of the per point slopes is a robust starting point
+  auto b = median_destructive(ratios);
+
+  auto abs_residuals = vector_with_capacity<double>(points.size());
+  for (int i = 0; i < 50; ++i) {
+    abs_residuals.clear();
+    for (const auto &p : points) {
+      abs_residuals.push_back(std::abs(p.y() - b * p.x()));
+    }
+
+    const auto scale = 1.4826 * median_destructive(abs_residuals);
+    if (!(scale > 0.0)) {
+      return b;
+    }
+
+    double wxy = 0.0, wxx = 0.0;
+    for (const auto &p : points) {
+      const auto r = std::abs(p.y() - b * p.x());
+      const auto w = r > k * scale ? k * scale / r : 1.0;
+      wxy += w * p.x() * p.y();
+      wxx += w * p.x() * p.x();
+    }
+
+    const auto next = wxy / wxx;
+    const auto converged = std::abs(next - b) <= 1e-10 * std::abs(b);
+    b = next;
+
+    if (converged) {
+      break;
+    }
+  }
+
+  return b;
+}
+
+// Theil-Sen estimate of the slope: the median of the slopes between every pair of points with
+// different x.  Up to ~29% of the points can be arbitrarily bad without affecting it, but it
+// costs O(n^2) per fit.
+inline double theil_sen_slope(const Points &points) {
+  assert(!points.empty() && "Regression requires at least one point");
+
+  std::vector<double> slopes;
+  slopes.reserve(points.size() * (points.size() - 1) / 2);
+
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    for (std::size_t j = i + 1; j < points.size(); ++j) {
+      const auto dx = points[j].x() - points[i].x();
+      if (dx > 0.0 || dx < 0.0) {
+        slopes.push_back((points[j].y() - points[i].y()) / dx);
+      }
+    }
+  }
+
+  return slopes.empty() ? slope(points) : median_destructive(slopes);
+}
+
+// Regression with an intercept
+
+// y = intercept + slope * x
+struct Line {
+  Line(const double b0, const double b1) : intercept_(b0), slope_(b1) {}
+
+  double intercept() const { return intercept_; }
+
+  double slope() const { return slope_; }
+
+  double operator()(const double x) const { return intercept_ + slope_ * x; }
+
+private:
+  double intercept_;
+  double slope_;
+};
+
+namespace detail {
+  // Weighted least squares with an intercept, falls back to a line through the origin when every
+  // x is the same
+  template <class W>
+  Line weighted_ols_line(const Points &points, W &&weight) {
+    double sw = 0.0, sx = 0.0, sy = 0.0;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      const auto w = weight(i);
+      sw += w;
+      sx += w * points[i].x();
+      sy += w * points[i].y();
+    }
+
+    const auto mx = sx / sw, my = sy / sw;
+
+    double sxx = 0.0, sxy = 0.0;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      const auto w = weight(i);
+      const auto dx = points[i].x() - mx;
+      sxx += w * dx * dx;
+      sxy += w * dx * (points[i].y() - my);
+    }
+
+    if (!(sxx > 0.0)) {
+      return Line(0.0, slope(points));
+    }
+
+    const auto b1 = sxy / sxx;
+    return Line(my - b1 * mx, b1);
+  }
+}
+
+// Ordinary least squares.  The intercept is the fixed cost of each measurement (the Stopwatch,
+// clock reads, etc.) and the slope is the time per iteration without it.
+inline Line ols_line(const Points &points) {
+  assert(!points.empty() && "Regression requires at least one point");
+  return detail::weighted_ols_line(points, [](std::size_t) { return 1.0; });
+}
+
+// Huber M-estimate of the line found with iteratively reweighted least squares starting from
+// the OLS line
+inline Line huber_line(const Points &points, const double k = 1.345) {
+  assert(!points.empty() && "Regression requires at least one point");
+
+  auto line = ols_line(points);
+
+  std::vector<double> weights(points.size(), 1.0);
+  auto abs_residuals = vector_with_capacity<double>(points.size());
+
+  for (int i = 0; i < 50; ++i) {
+    abs_residuals.clear();
+    for (const auto &p : points) {
+      abs_residuals.push_back(std::abs(p.y() - line(p.x())));
+    }
+
+    const auto scale = 1.4826 * median_destructive(abs_residuals);
+    if (!(scale > 0.0)) {
+      break;
+    }
+
+    for (std::size_t j = 0; j < points.size(); ++j) {
+      const auto r = std::abs(points[j].y() - line(points[j].x()));
+      weights[j] = r > k * scale ? k * scale / r : 1.0;
+    }
+
+    const auto next = detail::weighted_ols_line(points, [&weights](std::size_t j) {
+      return weights[j];
+    });
+    const auto converged = std::abs(next.slope() - line.slope()) <=
+                               1e-10 * std::abs(line.slope()) &&
+                           std::abs(next.intercept() - line.intercept()) <=
+                               1e-10 * (std::abs(line.intercept()) + std::abs(line.slope()));
+    line = next;
+
+    if (converged) {
+      break;
+    }
+  }
+
+  return line;
+}
+
+// theil_sen_slope with the median of the y - slope * x as the intercept
+inline Line theil_sen_line(const Points &points) {
+  const auto b1 = theil_sen_slope(points);
+
+  auto intercepts = vector_with_capacity<double>(points.size());
+  for (const auto &p : points) {
+    intercepts.push_back(p.y() - b1 * p.x());
+  }
+
+  return Line(median_destructive(intercepts), b1);
+}
+
+// The proportion of the variance of y around its mean explained by the line
+inline double r_squared(const Points &points, const Line &line) {
+  double my = 0.0;
+  for (const auto &p : points) {
+    my += p.y();
+  }
+  my /= static_cast<double>(points.size());
+
+  double residual_sum_of_squares = 0.0, total_sum_of_squares = 0.0;
+  for (const auto &p : points) {
+    const auto r = p.y() - line(p.x());
+    const auto d = p.y() - my;
+    residual_sum_of_squares += r * r;
+    total_sum_of_squares += d * d;
+  }
+
+  return 1.0 - (residual_sum_of_squares / total_sum_of_squares);
+}
 }
 
 #endif // VELOX_REGRESSION_H_INCLUDED
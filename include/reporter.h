@@ -7,6 +7,10 @@
 #include "kde.h"
 #include "format.h"
 #include "point.h"
+#include "autocorrelation.h"
+#include "schedule.h"
+#include "load.h"
+#include "bootstrap.h"
 
 namespace velox {
 #ifdef __clang__
@@ -23,6 +27,18 @@ struct Reporter {
   virtual void estimate_clock_cost_starting() {}
   virtual void estimate_clock_cost_ended(FpNs cost) { unused(cost); }
 
+  virtual void clock_resolution_estimated(FpNs resolution) { unused(resolution); }
+
+  virtual void quick_mode_enabled() {}
+
+  // A shard checkpoint to merge wasn't written in this run's environment, so its benchmarks are
+  // neither merged nor run again
+  virtual void merge_refused(const std::string &checkpoint,
+                             const std::string &checkpoint_environment,
+                             const std::string &environment) {
+    unused(checkpoint, checkpoint_environment, environment);
+  }
+
   virtual void warm_up_starting(Ms ms) { unused(ms); }
   virtual void warm_up_ended(const ItersForDurationNs &wu) { unused(wu); }
   virtual void warm_up_failed(const ItersForDurationNs &wu) { unused(wu); }
@@ -35,10 +51,25 @@ struct Reporter {
     unused(num_measurements, measurement_time);
   }
 
+  virtual void measurements_too_short(std::size_t num_short,
+                                      std::size_t num_measurements,
+                                      FpNs min_duration) {
+    unused(num_short, num_measurements, min_duration);
+  }
+
   virtual void measurement_collection_ended(const Measurements &measurements,
                                             const Times &times,
+                                            const SampleSummary &summary,
                                             const Outliers &outliers) {
-    unused(measurements, times, outliers);
+    unused(measurements, times, summary, outliers);
+  }
+
+  virtual void autocorrelation_estimated(const Autocorrelation &autocorrelation) {
+    unused(autocorrelation);
+  }
+
+  virtual void periodic_interference_estimated(const PeriodicInterference &interference) {
+    unused(interference);
   }
 
   virtual void estimate_statistics_starting(std::uint32_t num_resamples) { unused(num_resamples); }
@@ -47,6 +78,14 @@ struct Reporter {
     unused(statistics);
   }
 
+  virtual void load_test_starting(const std::string &name, const LoadConfig &config) {
+    unused(name, config);
+  }
+
+  virtual void load_point_measured(const LoadPoint &point) { unused(point); }
+
+  virtual void load_test_ended() {}
+
   virtual void suite_ended() {}
 };
 
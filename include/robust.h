@@ -0,0 +1,102 @@
+#ifndef VELOX_ROBUST_H_INCLUDED
+#define VELOX_ROBUST_H_INCLUDED
+
+#include "util.h"
+#include "measurement.h"
+#include "outliers.h"
+#include "regression.h"
+#include "velox_config.h"
+
+#include <cmath>
+
+namespace velox {
+
+// The measurements and times statistics are estimated from once VeloxConfig::outlier_policy has
+// been applied
+struct AnalyzedSample {
+  AnalyzedSample(Measurements &&ms, Times &&ts, const std::size_t num_adjusted)
+      : measurements_(std::move(ms)), times_(std::move(ts)), num_adjusted_(num_adjusted) {}
+
+  const Measurements &measurements() const { return measurements_; }
+
+  const Times &times() const { return times_; }
+
+  // The number of measurements which were excluded or winsorized
+  std::size_t num_adjusted() const { return num_adjusted_; }
+
+private:
+  Measurements measurements_;
+  Times times_;
+  std::size_t num_adjusted_;
+};
+
+inline AnalyzedSample apply_outlier_policy(const Measurements &measurements,
+                                           const Times &times,
+                                           const Outliers &outliers,
+                                           const OutlierPolicy policy) {
+  assert(measurements.size() == times.size() && "Times should be derived from measurements");
+  assert(outliers.size() == times.size() && "Outliers should be classified from times");
+
+  auto ms = vector_with_capacity<Measurement>(measurements.size());
+  auto ts = vector_with_capacity<FpNs>(times.size());
+  std::size_t num_adjusted = 0;
+
+  const auto &thresholds = outliers.thresholds();
+
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    const auto severity = outliers.severity(i);
+    const auto severe =
+        severity == OutlierSeverity::low_severe || severity == OutlierSeverity::high_severe;
+
+    if (!severe || policy == OutlierPolicy::keep) {
+      ms.push_back(measurements[i]);
+      ts.push_back(times[i]);
+      continue;
+    }
+
+    ++num_adjusted;
+
+    if (policy == OutlierPolicy::winsorize) {
+      const auto t = severity == OutlierSeverity::low_severe ? thresholds.low_severe()
+                                                              : thresholds.high_severe();
+      const auto iters = measurements[i].iters();
+      ms.emplace_back(iters,
+                      Ns(static_cast<Ns::rep>(std::round(t.count() * static_cast<double>(iters)))),
+                      measurements[i].start());
+      ts.push_back(t);
+    }
+  }
+
+  return AnalyzedSample(std::move(ms), std::move(ts), num_adjusted);
+}
+
+// The slope fit by the given method
+inline double fit_slope(const Points &points, const RegressionMethod method) {
+  switch (method) {
+  case RegressionMethod::least_squares:
+    break;
+  case RegressionMethod::huber:
+    return huber_slope(points);
+  case RegressionMethod::theil_sen:
+    return theil_sen_slope(points);
+  }
+
+  return slope(points);
+}
+
+// The line with an intercept fit by the given method
+inline Line fit_line(const Points &points, const RegressionMethod method) {
+  switch (method) {
+  case RegressionMethod::least_squares:
+    break;
+  case RegressionMethod::huber:
+    return huber_line(points);
+  case RegressionMethod::theil_sen:
+    return theil_sen_line(points);
+  }
+
+  return ols_line(points);
+}
+}
+
+#endif // VELOX_ROBUST_H_INCLUDED
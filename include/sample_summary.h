@@ -0,0 +1,56 @@
+#ifndef VELOX_SAMPLE_SUMMARY_H_INCLUDED
+#define VELOX_SAMPLE_SUMMARY_H_INCLUDED
+
+#include "util.h"
+#include "fp_range.h"
+#include "stats.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace velox {
+
+// The order independent statistics of a benchmark's per iteration times.  The times are sorted
+// once here and everything which needs a sorted sample, its quartiles or its moments
+// (Outliers, kde, estimate_statistics and the reporters) shares this instead of making its own
+// sorted copy.
+struct SampleSummary {
+  SampleSummary(const Times &times)
+      : sorted_(sorted_copy(times)), quartiles_(quartiles_of_sorted(sorted_)),
+        mean_(::velox::mean(FpRange(sorted_))), std_dev_(::velox::std_dev(FpRange(sorted_))) {}
+
+  // The times in ascending order
+  const Times &sorted() const { return sorted_; }
+
+  std::size_t size() const { return sorted_.size(); }
+
+  FpNs min() const { return sorted_.front(); }
+
+  FpNs max() const { return sorted_.back(); }
+
+  const Quartiles<FpNs> &quartiles() const { return quartiles_; }
+
+  FpNs median() const { return quartiles_.q2(); }
+
+  FpNs mean() const { return FpNs(mean_); }
+
+  FpNs std_dev() const { return FpNs(std_dev_); }
+
+private:
+  static Times sorted_copy(const Times &times) {
+    assert(!times.empty() && "times must not be empty");
+
+    auto sorted = times;
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+  }
+
+private:
+  Times sorted_;
+  Quartiles<FpNs> quartiles_;
+  double mean_;
+  double std_dev_;
+};
+}
+
+#endif // VELOX_SAMPLE_SUMMARY_H_INCLUDED
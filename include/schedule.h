@@ -0,0 +1,249 @@
+#ifndef VELOX_SCHEDULE_H_INCLUDED
+#define VELOX_SCHEDULE_H_INCLUDED
+
+#include "util.h"
+#include "measurement.h"
+#include "regression.h"
+#include "velox_config.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace velox {
+
+// The number of iterations of each measurement, in the order they are taken
+using Schedule = std::vector<std::uint64_t>;
+
+namespace detail {
+  inline Schedule linear_schedule(const std::uint32_t num_measurements,
+                                  const std::uint64_t base_iters) {
+    auto schedule = vector_with_capacity<std::uint64_t>(num_measurements);
+
+    auto iters = base_iters;
+    for (std::uint32_t i = 0; i < num_measurements; ++i) {
+      iters += base_iters;
+      schedule.push_back(iters);
+    }
+
+    return schedule;
+  }
+
+  // Grows by the factor which keeps the total number of iterations the same as the linear
+  // schedule's
+  inline Schedule geometric_schedule(const std::uint32_t num_measurements,
+                                     const std::uint64_t base_iters) {
+    const auto n = static_cast<double>(num_measurements);
+    const auto first = 2.0 * static_cast<double>(base_iters);
+    const auto total = static_cast<double>(base_iters) * (n * (n + 3.0) / 2.0);
+
+    const auto sum_for = [&](const double r) {
+      double sum = 0.0, term = first;
+      for (std::uint32_t i = 0; i < num_measurements; ++i) {
+        sum += term;
+        term *= r;
+      }
+      return sum;
+    };
+
+    double lo = 1.0, hi = 2.0;
+    while (sum_for(hi) < total) {
+      hi *= 2.0;
+    }
+    for (int i = 0; i < 100; ++i) {
+      const auto mid = (lo + hi) / 2.0;
+      (sum_for(mid) < total ? lo : hi) = mid;
+    }
+
+    auto schedule = vector_with_capacity<std::uint64_t>(num_measurements);
+
+    auto term = first;
+    for (std::uint32_t i = 0; i < num_measurements; ++i) {
+      const auto iters = static_cast<std::uint64_t>(std::llround(term));
+      schedule.push_back(schedule.empty() ? iters : (std::max)(iters, schedule.back() + 1));
+      term *= lo;
+    }
+
+    return schedule;
+  }
+
+  inline Schedule low_discrepancy_schedule(const std::uint32_t num_measurements,
+                                           const std::uint64_t base_iters,
+                                           const std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> offset(0.0, 1.0);
+
+    const auto golden = 0.6180339887498949;
+    const auto first = 2.0 * static_cast<double>(base_iters);
+    const auto range = static_cast<double>(num_measurements - 1) * static_cast<double>(base_iters);
+
+    auto schedule = vector_with_capacity<std::uint64_t>(num_measurements);
+
+    auto u = offset(rng);
+    for (std::uint32_t i = 0; i < num_measurements; ++i) {
+      schedule.push_back((std::max)(
+          static_cast<std::uint64_t>(std::llround(first + u * range)), std::uint64_t(1)));
+      u += golden;
+      u -= std::floor(u);
+    }
+
+    return schedule;
+  }
+}
+
+// The iteration counts for the measurements of a benchmark
+inline Schedule iteration_schedule(const std::uint32_t num_measurements,
+                                   const std::uint64_t base_iters,
+                                   const IterationSchedule schedule,
+                                   const std::uint32_t seed) {
+  assert(num_measurements && "At least one measurement must be taken");
+  assert(base_iters && "Must iterate at least once");
+
+  switch (schedule) {
+  case IterationSchedule::linear:
+    break;
+  case IterationSchedule::shuffled_linear: {
+    auto s = detail::linear_schedule(num_measurements, base_iters);
+    std::shuffle(s.begin(), s.end(), std::mt19937(seed));
+    return s;
+  }
+  case IterationSchedule::geometric:
+    return detail::geometric_schedule(num_measurements, base_iters);
+  case IterationSchedule::low_discrepancy:
+    return detail::low_discrepancy_schedule(num_measurements, base_iters, seed);
+  }
+
+  return detail::linear_schedule(num_measurements, base_iters);
+}
+
+// Whether to take every measurement with the same number of iterations, given how long an
+// iteration took during the warm up
+inline bool use_flat_sampling(const VeloxConfig &config, const FpNs mean_execution_time) {
+  switch (config.sampling_mode()) {
+  case SamplingMode::automatic:
+    break;
+  case SamplingMode::linear:
+    return false;
+  case SamplingMode::flat:
+    return true;
+  }
+
+  return mean_execution_time > config.flat_sampling_threshold();
+}
+
+// Looks for interference which repeats with a fixed period by regressing the residuals of the
+// measurements around the line with an intercept against sinusoids of their start times.  The
+// strongest period is reported along with the share of the residual variance it explains and
+// the probability white noise would explain as much at some period (Bonferroni corrected).
+struct PeriodicInterference {
+  PeriodicInterference(const Measurements &measurements)
+      : period_(0.0), amplitude_(0.0), variance_explained_(0.0), p_value_(1.0),
+        sequential_schedule_(
+            !measurements.empty() &&
+            measurements.front().iters() < measurements.back().iters() &&
+            std::is_sorted(measurements.begin(),
+                           measurements.end(),
+                           [](const Measurement &a, const Measurement &b) {
+                             return a.iters() < b.iters();
+                           })) {
+    const auto n = measurements.size();
+    if (n < 8) {
+      return;
+    }
+
+    const auto points = measurements_to_points(measurements);
+    const auto line = ols_line(points);
+
+    auto residuals = vector_with_capacity<double>(n);
+    auto starts = vector_with_capacity<double>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      residuals.push_back(points[i].y() - line(points[i].x()));
+      starts.push_back(static_cast<double>(measurements[i].start().count()));
+    }
+
+    const auto mm = std::minmax_element(starts.begin(), starts.end());
+    const auto span = *mm.second - *mm.first;
+    if (!(span > 0.0)) {
+      return;
+    }
+
+    const auto mr = mean(residuals);
+    double total = 0.0;
+    for (auto &r : residuals) {
+      r -= mr;
+      total += r * r;
+    }
+    if (!(total > 0.0)) {
+      return;
+    }
+
+    // Frequencies from one cycle over the whole run up to about one cycle per two measurements,
+    // oversampled so peaks between the independent frequencies aren't missed
+    const auto PI = 3.14159265358979323846;
+    const std::size_t oversampling = 4;
+    const auto num_independent = n / 2;
+
+    for (std::size_t j = oversampling; j <= num_independent * oversampling; ++j) {
+      const auto w = 2.0 * PI * static_cast<double>(j) / (static_cast<double>(oversampling) * span);
+
+      double cc = 0.0, cs = 0.0, ss = 0.0, rc = 0.0, rs = 0.0;
+      for (std::size_t i = 0; i < n; ++i) {
+        const auto c = std::cos(w * starts[i]), s = std::sin(w * starts[i]);
+        cc += c * c;
+        cs += c * s;
+        ss += s * s;
+        rc += residuals[i] * c;
+        rs += residuals[i] * s;
+      }
+
+      const auto det = cc * ss - cs * cs;
+      if (!(det > 0.0)) {
+        continue;
+      }
+
+      const auto a = (rc * ss - rs * cs) / det;
+      const auto b = (rs * cc - rc * cs) / det;
+      const auto explained = (a * rc + b * rs) / total;
+
+      if (explained > variance_explained_) {
+        variance_explained_ = explained;
+        period_ = FpNs(2.0 * PI / w);
+        amplitude_ = FpNs(std::sqrt(a * a + b * b));
+      }
+    }
+
+    // For white noise the share explained by two regressors at a single frequency is
+    // Beta(1, (n - 3) / 2) distributed
+    const auto single = std::pow(1.0 - (std::min)(variance_explained_, 1.0),
+                                 (static_cast<double>(n) - 3.0) / 2.0);
+    p_value_ = (std::min)(1.0, single * static_cast<double>(num_independent));
+  }
+
+  // The period of the strongest sinusoid in the residuals
+  FpNs period() const { return period_; }
+
+  // The amplitude of that sinusoid, in time per measurement
+  FpNs amplitude() const { return amplitude_; }
+
+  // The share of the residual variance explained by it
+  double variance_explained() const { return variance_explained_; }
+
+  double p_value() const { return p_value_; }
+
+  bool significant() const { return p_value_ < 0.01; }
+
+  // Whether the measurements ran increasing numbers of iterations in the order they were taken,
+  // as with the linear and geometric schedules, so the interference can line up with them
+  bool sequential_schedule() const { return sequential_schedule_; }
+
+private:
+  FpNs period_;
+  FpNs amplitude_;
+  double variance_explained_;
+  double p_value_;
+  bool sequential_schedule_;
+};
+}
+
+#endif // VELOX_SCHEDULE_H_INCLUDED
@@ -0,0 +1,46 @@
+#ifndef VELOX_SHARD_H_INCLUDED
+#define VELOX_SHARD_H_INCLUDED
+
+#include "checkpoint.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace velox {
+
+// 64 bit FNV-1a, which gives the same value for a name on every platform and run, unlike
+// std::hash
+inline std::uint64_t stable_hash(const std::string &s) {
+  std::uint64_t h = 14695981039346656037ull;
+  for (const auto c : s) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+// Whether a benchmark is run by shard index of count.  Each benchmark is in exactly one shard,
+// chosen by its name so it doesn't depend on the order or number of the other benchmarks.
+inline bool
+in_shard(const std::string &name, const std::uint32_t index, const std::uint32_t count) {
+  assert(count > 0 && index < count && "Shard index must be less than the number of shards");
+  return stable_hash(name) % count == index;
+}
+
+// The checkpoints of the shards of a suite which were written in the given environment (see
+// environment_fingerprint).  Checkpoints without an environment, including files which don't
+// exist, never were.
+inline std::vector<std::string> shards_in_environment(const std::vector<std::string> &checkpoints,
+                                                      const std::string &environment) {
+  std::vector<std::string> matching;
+  for (const auto &c : checkpoints) {
+    if (read_checkpoint_environment(c) == environment) {
+      matching.push_back(c);
+    }
+  }
+  return matching;
+}
+}
+
+#endif // VELOX_SHARD_H_INCLUDED
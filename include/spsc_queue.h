@@ -0,0 +1,74 @@
+#ifndef VELOX_SPSC_QUEUE_H_INCLUDED
+#define VELOX_SPSC_QUEUE_H_INCLUDED
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace velox {
+
+// A bounded lock free queue for exactly one producer thread and one consumer thread.  The
+// capacity is rounded up to a power of two.
+template <class T>
+struct SpscQueue {
+  explicit SpscQueue(const std::size_t capacity)
+      : slots_(round_up_to_power_of_two(capacity)), mask_(slots_.size() - 1), head_(0), tail_(0) {
+    assert(capacity && "Capacity must be at least 1");
+  }
+
+  SpscQueue &operator=(const SpscQueue &rhs) = delete;
+
+  std::size_t capacity() const { return slots_.size(); }
+
+  // Producer only.  Returns false, leaving t untouched, if the queue is full.
+  bool try_push(T &&t) {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == slots_.size()) {
+      return false;
+    }
+
+    slots_[tail & mask_] = std::move(t);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer only.  Returns false if the queue is empty.
+  bool try_pop(T &t) {
+    const auto head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    auto &slot = slots_[head & mask_];
+    t = std::move(slot);
+    slot = T();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  static std::size_t round_up_to_power_of_two(const std::size_t n) {
+    std::size_t p = 1;
+    while (p < n) {
+      p *= 2;
+    }
+    return p;
+  }
+
+private:
+  // The indices are only ever incremented and are kept on separate cache lines so the producer
+  // and consumer don't contend for the line holding both
+  static const std::size_t CACHE_LINE = 64;
+
+  std::vector<T> slots_;
+  std::size_t mask_;
+  char pad0_[CACHE_LINE];
+  std::atomic<std::size_t> head_;
+  char pad1_[CACHE_LINE - sizeof(std::atomic<std::size_t>)];
+  std::atomic<std::size_t> tail_;
+  char pad2_[CACHE_LINE - sizeof(std::atomic<std::size_t>)];
+};
+}
+
+#endif // VELOX_SPSC_QUEUE_H_INCLUDED
@@ -56,7 +56,7 @@ VELOX_RVT(Range) percentile_of_sorted(Range &&samples, const double percentile)
 #pragma GCC diagnostic pop
 #endif
   const auto len = last - first - 1;
-  const auto rank = (percentile / 100.0) * len;
+  const auto rank = (percentile / 100.0) * static_cast<double>(len);
   const auto lrank = std::floor(rank);
   const auto d = rank - lrank;
   const auto n = static_cast<std::uint32_t>(lrank);
@@ -117,7 +117,7 @@ VELOX_RVT(Range) variance(Range &&r) {
     v += x * x;
   }
 
-  return v / (len - 1);
+  return v / static_cast<double>(len - 1);
 }
 
 template <class Range>
@@ -142,6 +142,93 @@ VELOX_RVT(Range)
   return median_destructive(abs_devs_buffer) * 1.4826;
 }
 
+// Cumulative distribution function of the standard normal distribution
+inline double normal_cdf(const double x) {
+  return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+// Inverse of normal_cdf using Acklam's rational approximation followed by a step of Halley's
+// method, which is accurate to about 1e-15
+inline double normal_quantile(const double p) {
+  assert(p > 0.0 && p < 1.0 && "p must be between 0 and 1");
+
+  static const double a[] = {-3.969683028665376e+01,
+                             2.209460984245205e+02,
+                             -2.759285104469687e+02,
+                             1.383577518672690e+02,
+                             -3.066479806614716e+01,
+                             2.506628277459239e+00};
+  static const double b[] = {-5.447609879822406e+01,
+                             1.615858368580409e+02,
+                             -1.556989798598866e+02,
+                             6.680131188771972e+01,
+                             -1.328068155288572e+01};
+  static const double c[] = {-7.784894002430293e-03,
+                             -3.223964580411365e-01,
+                             -2.400758277161838e+00,
+                             -2.549732539343734e+00,
+                             4.374664141464968e+00,
+                             2.938163982698783e+00};
+  static const double d[] = {
+      7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00};
+
+  const auto p_low = 0.02425;
+
+  double x;
+  if (p < p_low) {
+    const auto q = std::sqrt(-2.0 * std::log(p));
+    x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+        ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+  } else if (p <= 1.0 - p_low) {
+    const auto q = p - 0.5;
+    const auto r = q * q;
+    x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+        (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+  } else {
+    const auto q = std::sqrt(-2.0 * std::log(1.0 - p));
+    x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+        ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+  }
+
+  // Don't require users to #define _USE_MATH_DEFINES when using msvc so ...
+  const auto PI = 3.14159265358979323846;
+  const auto e = normal_cdf(x) - p;
+  const auto u = e * std::sqrt(2.0 * PI) * std::exp(x * x / 2.0);
+  return x - u / (1.0 + x * u / 2.0);
+}
+
+// Quantile of Student's t distribution with df degrees of freedom using the Cornish-Fisher
+// expansion from Abramowitz & Stegun 26.7.5, which is accurate to about 1e-3 for df >= 4
+inline double student_t_quantile(const double p, const double df) {
+  assert(df > 0.0 && "Degrees of freedom must be positive");
+
+  const auto z = normal_quantile(p);
+  const auto z2 = z * z;
+  const auto g1 = (z2 + 1.0) * z / 4.0;
+  const auto g2 = ((5.0 * z2 + 16.0) * z2 + 3.0) * z / 96.0;
+  const auto g3 = (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) * z / 384.0;
+  const auto g4 = ((((79.0 * z2 + 776.0) * z2 + 1482.0) * z2 - 1920.0) * z2 - 945.0) * z / 92160.0;
+
+  return z + (g1 + (g2 + (g3 + g4 / df) / df) / df) / df;
+}
+
+// Quantile of the chi-squared distribution with df degrees of freedom using the Wilson-Hilferty
+// approximation
+inline double chi_squared_quantile(const double p, const double df) {
+  assert(df > 0.0 && "Degrees of freedom must be positive");
+
+  const auto v = 2.0 / (9.0 * df);
+  const auto c = 1.0 - v + normal_quantile(p) * std::sqrt(v);
+  return df * (std::max)(c, 0.0) * (std::max)(c, 0.0) * (std::max)(c, 0.0);
+}
+
+// Probability that a binomial(n, 1/2) variable is exactly k
+inline double binomial_half_pmf(const std::uint64_t k, const std::uint64_t n) {
+  const auto nd = static_cast<double>(n), kd = static_cast<double>(k);
+  return std::exp(std::lgamma(nd + 1.0) - std::lgamma(kd + 1.0) - std::lgamma(nd - kd + 1.0) +
+                  nd * std::log(0.5));
+}
+
 template <class T>
 struct Quartiles {
   Quartiles(T quartile1, T quartile2, T quartile3)
@@ -161,16 +248,21 @@ private:
   T q3_;
 };
 
+template <class Range>
+Quartiles<VELOX_RVT(Range)> quartiles_of_sorted(Range &&r) {
+  const auto q1 = percentile_of_sorted(r, 25);
+  const auto q2 = percentile_of_sorted(r, 50);
+  const auto q3 = percentile_of_sorted(r, 75);
+
+  return Quartiles<VELOX_RVT(Range)>(q1, q2, q3);
+}
+
 template <class Range>
 Quartiles<VELOX_RVT(Range)> quartiles(Range &&r) {
   std::vector<VELOX_RVT(Range)> temp(adl::adl_begin(r), adl::adl_end(r));
   std::sort(temp.begin(), temp.end());
 
-  const auto q1 = percentile_of_sorted(temp, 25);
-  const auto q2 = percentile_of_sorted(temp, 50);
-  const auto q3 = percentile_of_sorted(temp, 75);
-
-  return Quartiles<VELOX_RVT(Range)>(q1, q2, q3);
+  return quartiles_of_sorted(temp);
 }
 }
 
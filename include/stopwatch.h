@@ -14,6 +14,7 @@ namespace detail {
     virtual ~StopwatchConcept() = default;
     virtual void start() = 0;
     virtual void stop() = 0;
+    virtual void record(Ns elapsed) = 0;
     virtual std::uint64_t iters() const = 0;
   };
 #ifdef __clang__
@@ -22,7 +23,8 @@ namespace detail {
   template <class C>
   struct StopwatchModel final : StopwatchConcept {
 
-    StopwatchModel(const std::uint64_t iterations) : iters_(iterations) {
+    StopwatchModel(const std::uint64_t iterations)
+        : iters_(iterations), recorded_(0), has_recorded_(false) {
       assert(iters_ && "Must iterate at least once");
     }
 
@@ -30,14 +32,24 @@ namespace detail {
 
     void stop() override { stop_time_ = C::now(); }
 
+    void record(const Ns elapsed) override {
+      recorded_ = elapsed;
+      has_recorded_ = true;
+    }
+
     std::uint64_t iters() const override { return iters_; }
 
-    Ns elapsed() const { return std::chrono::duration_cast<Ns>(stop_time_ - start_time_); }
+    Ns elapsed() const {
+      return has_recorded_ ? recorded_
+                           : std::chrono::duration_cast<Ns>(stop_time_ - start_time_);
+    }
 
   private:
     TimePoint<C> start_time_;
     TimePoint<C> stop_time_;
     std::uint64_t iters_;
+    Ns recorded_;
+    bool has_recorded_;
   };
 }
 
@@ -70,6 +82,20 @@ struct Stopwatch {
 #endif
   }
 
+  // For work the Stopwatch can't time itself, such as work finishing on another thread or
+  // batches where only part of each call should count.  f is given the number of iterations to
+  // run and returns how long they took as a std::chrono::duration, measured however it likes.
+  template <class F>
+  void measure_custom(F &&f) {
+#ifndef NDEBUG
+    assert(!measure_called_ && "Measure should only be called once");
+#endif
+    sw_.record(std::chrono::duration_cast<Ns>(std::forward<F>(f)(sw_.iters())));
+#ifndef NDEBUG
+    measure_called_ = true;
+#endif
+  }
+
 private:
   template <class F>
   void run(F &&f, std::false_type) {
@@ -9,7 +9,7 @@ namespace velox {
 #pragma clang diagnostic ignored "-Wweak-vtables"
 #endif
 struct TextReporter : Reporter {
-  TextReporter(std::ostream &os) : os_(os) {}
+  TextReporter(std::ostream &os) : os_(os), num_resamples_(0) {}
 
   TextReporter &operator=(const TextReporter &rhs) = delete;
 
@@ -18,17 +18,45 @@ struct TextReporter : Reporter {
         << "\n";
   }
 
-  void estimate_clock_cost_starting() override { os_ << "Estimating the cost of the clock\n"; }
+  void quick_mode_enabled() override {
+    os_ << "Quick mode: short samples and approximate analytic confidence intervals\n";
+  }
+
+  void merge_refused(const std::string &checkpoint,
+                     const std::string &checkpoint_environment,
+                     const std::string &environment) override {
+    os_ << "Not merging the shards: " << checkpoint << " was written in a different environment\n";
+    os_ << "  > Checkpoint: "
+        << (checkpoint_environment.empty() ? "unknown" : checkpoint_environment) << "\n";
+    os_ << "  > This run:   " << environment << "\n";
+    os_ << "  > Its benchmarks are left out of the report\n\n";
+  }
+
+  void estimate_clock_cost_starting() override {
+    os_ << "Estimating the cost of the clock\n";
+    os_.flush();
+  }
 
   void estimate_clock_cost_ended(FpNs cost) override {
-    os_ << "> Median: " << cost.count() << " ns\n\n";
+    os_ << "> Median: ";
+    os_.write_general(cost.count(), 6);
+    os_ << " ns\n\n";
+  }
+
+  void clock_resolution_estimated(FpNs resolution) override {
+    os_ << "> Clock resolution: ";
+    format_time(os_, resolution);
+    os_ << "\n\n";
   }
 
   void benchmark_starting(const std::string &name) override {
     os_ << "Benchmarking " << name << "\n";
   }
 
-  void warm_up_starting(Ms ms) override { os_ << "> Warming up for " << ms.count() << " ms\n"; }
+  void warm_up_starting(Ms ms) override {
+    os_ << "> Warming up for " << ms.count() << " ms\n";
+    os_.flush();
+  }
 
   void warm_up_failed(const ItersForDurationNs &wu) override {
     os_ << "> Warm up failed\n";
@@ -36,6 +64,7 @@ struct TextReporter : Reporter {
     format_time(os_, wu.duration());
     os_ << "\n";
     os_ << "  > The function is unable to be benchmarked because it takes so little time.\n";
+    os_.flush();
   }
 
   void measurement_collection_starting(std::uint32_t num_measurements,
@@ -44,25 +73,37 @@ struct TextReporter : Reporter {
 
     format_time(os_, measurement_time);
     os_ << "\n";
+    os_.flush();
+  }
+
+  void measurements_too_short(std::size_t num_short,
+                              std::size_t num_measurements,
+                              FpNs min_duration) override {
+    os_ << "> Warning: " << num_short << " of " << num_measurements
+        << " measurements were shorter than ";
+    format_time(os_, min_duration);
+    os_ << ", the clock's resolution may distort them\n";
   }
 
   void measurement_collection_ended(const Measurements &,
                                     const Times &,
+                                    const SampleSummary &,
                                     const Outliers &outliers) override {
-    const auto num_high_severe = outliers.high_severe().size();
-    const auto num_high_mild = outliers.high_mild().size();
-    const auto num_low_mild = outliers.low_mild().size();
-    const auto num_low_severe = outliers.low_severe().size();
-    const auto total = num_high_severe + num_high_mild + num_low_mild + num_low_severe;
+    const auto num_high_severe = outliers.count(OutlierSeverity::high_severe);
+    const auto num_high_mild = outliers.count(OutlierSeverity::high_mild);
+    const auto num_low_mild = outliers.count(OutlierSeverity::low_mild);
+    const auto num_low_severe = outliers.count(OutlierSeverity::low_severe);
+    const auto total = outliers.num_outliers();
 
-    const auto sample_size = total + outliers.normal().size();
+    const auto sample_size = outliers.size();
 
     const auto percent = [sample_size](decltype(total) n) {
       return 100.0 * static_cast<double>(n) / static_cast<double>(sample_size);
     };
 
-    os_ << "> Found " << total << " outliers among " << sample_size << " measurements ("
-        << percent(total) << "%)\n";
+    os_ << "> Found " << total << " outliers among " << sample_size << " measurements (";
+    os_.write_general(percent(total), 6);
+    os_ << "%)\n";
 
     if (total == 0) {
       return;
@@ -73,7 +114,9 @@ struct TextReporter : Reporter {
         return;
       }
 
-      os_ << "  > " << n << " (" << percent(n) << "%) " << type << "\n";
+      os_ << "  > " << n << " (";
+      os_.write_general(percent(n), 6);
+      os_ << "%) " << type << "\n";
     };
 
     print(num_low_severe, "low severe");
@@ -82,33 +125,160 @@ struct TextReporter : Reporter {
     print(num_high_severe, "high severe");
   }
 
+  void autocorrelation_estimated(const Autocorrelation &autocorrelation) override {
+    if (!autocorrelation.significant()) {
+      return;
+    }
+
+    os_ << "> Measurements are autocorrelated (lag 1: ";
+    format_short(os_, autocorrelation.lag1());
+    os_ << ") and are worth about "
+        << static_cast<std::uint64_t>(std::round(autocorrelation.effective_sample_size()))
+        << " independent measurements\n";
+
+    if (autocorrelation.resample_method() == ResampleMethod::iid) {
+      os_ << "  > Confidence intervals are likely too narrow, consider a block bootstrap\n";
+    } else {
+      os_ << "  > Resampling blocks of ";
+      format_short(os_, autocorrelation.block_length());
+      os_ << " measurements\n";
+    }
+  }
+
+  void periodic_interference_estimated(const PeriodicInterference &interference) override {
+    if (!interference.significant()) {
+      return;
+    }
+
+    os_ << "> Measurements show periodic interference every ";
+    format_time(os_, interference.period());
+    os_ << " (";
+    format_short(os_, interference.variance_explained() * 100.0);
+    os_ << "% of the residual variance)\n";
+    if (interference.sequential_schedule()) {
+      os_ << "  > Consider a shuffled or low discrepancy iteration schedule\n";
+    }
+  }
+
   void estimate_statistics_starting(std::uint32_t num_resamples) override {
     os_ << "> estimating statistics\n";
-    os_ << "  > bootstrapping sample with " << num_resamples << " resamples\n";
+    if (num_resamples) {
+      os_ << "  > bootstrapping sample with " << num_resamples << " resamples\n";
+    } else {
+      os_ << "  > approximate analytic intervals (quick mode)\n";
+    }
+    num_resamples_ = num_resamples;
+    os_.flush();
   }
 
   void estimate_statistics_ended(const EstimatedStatistics &statistics) override {
-    auto format_estimate = [this](const Estimate<FpNs> &e) { format(e, format_time); };
+    if (statistics.num_resamples() != num_resamples_) {
+      os_ << "  > converged after " << statistics.num_resamples() << " resamples\n";
+    }
 
-    os_ << "  > mean   ";
+    const auto time = [](BufferedWriter &out, const FpNs t) { format_time(out, t); };
+    auto format_estimate = [this, &time](const Estimate<FpNs> &e) { format(e, time); };
+
+    os_ << "  > mean     ";
     format_estimate(statistics.mean().estimate());
-    os_ << "  > median ";
+    os_ << "  > median   ";
     format_estimate(statistics.median().estimate());
-    os_ << "  > SD     ";
+    os_ << "  > SD       ";
     format_estimate(statistics.std_dev().estimate());
-    os_ << "  > MAD    ";
+    os_ << "  > MAD      ";
     format_estimate(statistics.median_abs_dev().estimate());
-    os_ << "  > LLS    ";
-    format_estimate(statistics.linear_least_squares().estimate());
-    os_ << "  > r^2    ";
-    format(statistics.r_squared().estimate(), format_r2);
+    if (statistics.flat_sampling()) {
+      os_ << "  > flat sampling, no regression statistics\n";
+    } else {
+      os_ << "  > LLS      ";
+      format_estimate(statistics.linear_least_squares().estimate());
+      os_ << "  > slope    ";
+      format_estimate(statistics.slope().estimate());
+      os_ << "  > overhead ";
+      format_estimate(statistics.overhead().estimate());
+      os_ << "  > r^2      ";
+      format(statistics.r_squared().estimate(),
+             [](BufferedWriter &out, const double r2) { format_r2(out, r2); });
+    }
+
+    for (const auto &c : statistics.custom()) {
+      os_ << "  > " << c.name() << std::string(c.name().size() < 8 ? 8 - c.name().size() : 0, ' ')
+          << " ";
+      if (c.unit() == StatisticUnit::time) {
+        format(c.estimate(),
+               [](BufferedWriter &out, const double v) { format_time(out, FpNs(v)); });
+      } else {
+        format(c.estimate(), [](BufferedWriter &out, const double v) { format_short(out, v); });
+      }
+    }
+
+    const auto &ov = statistics.outlier_variance();
+    os_ << "  > variance introduced by outliers: ";
+    format_short(os_, ov.fraction() * 100.0);
+    os_ << "% (" << outlier_effect_name(ov.effect()) << ")\n";
     os_ << "\n";
   }
 
+  void benchmark_ended() override { os_.flush(); }
+
+  void load_test_starting(const std::string &name, const LoadConfig &config) override {
+    os_ << "Load testing " << name << "\n";
+    os_ << "> " << (config.arrival_process() == ArrivalProcess::fixed ? "Fixed" : "Poisson")
+        << " arrivals from " << config.num_threads() << " thread"
+        << (config.num_threads() == 1 ? "" : "s") << " for " << config.duration().count()
+        << " ms per rate\n";
+    os_.flush();
+  }
+
+  void load_point_measured(const LoadPoint &point) override {
+    os_ << "> ";
+    format_short(os_, point.target_rate());
+    os_ << " req/s: ";
+    format_short(os_, point.throughput());
+    os_ << " req/s completed\n";
+
+    os_ << "  > latency p50 ";
+    format_time(os_, point.latency(50));
+    os_ << ", p90 ";
+    format_time(os_, point.latency(90));
+    os_ << ", p99 ";
+    format_time(os_, point.latency(99));
+    os_ << ", p99.9 ";
+    format_time(os_, point.latency(99.9));
+    os_ << ", max ";
+    format_time(os_, point.max_latency());
+    os_ << "\n";
+
+    os_ << "  > service time p50 ";
+    format_time(os_, point.service_time(50));
+    os_ << ", p99 ";
+    format_time(os_, point.service_time(99));
+    os_ << "\n";
+
+    if (point.throughput() < 0.9 * point.target_rate()) {
+      os_ << "  > Unable to keep up with the target rate, requests are queueing\n";
+    }
+    os_.flush();
+  }
+
+  void load_test_ended() override {
+    os_ << "\n";
+    os_.flush();
+  }
+
+  void suite_ended() override { os_.flush(); }
+
 private:
   template <class E, class F>
   void format(const E &e, F &&f) {
     f(os_, e.point());
+
+    // Quick mode has no interval for some statistics
+    if (!num_resamples_ && !(e.lower_bound() < e.upper_bound())) {
+      os_ << " (no interval)\n";
+      return;
+    }
+
     os_ << " +/- ";
     f(os_, e.standard_error());
     os_ << " [";
@@ -116,11 +286,14 @@ private:
     os_ << " ";
     f(os_, e.upper_bound());
     os_ << "] ";
-    os_ << e.confidence_level() * 100 << "% CI\n";
+    os_.write_general(e.confidence_level() * 100, 6);
+    os_ << (num_resamples_ ? "% CI\n" : "% CI (approximate)\n");
   }
 
 private:
-  std::ostream &os_;
+  // Flushed before each phase which takes a while so progress can be followed
+  BufferedWriter os_;
+  std::uint32_t num_resamples_;
 };
 #ifdef __clang__
 #pragma clang diagnostic pop
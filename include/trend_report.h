@@ -0,0 +1,109 @@
+#ifndef VELOX_TREND_REPORT_H_INCLUDED
+#define VELOX_TREND_REPORT_H_INCLUDED
+
+#include "changepoint.h"
+#include "format.h"
+#include "history.h"
+#include "html_template.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace velox {
+
+namespace detail {
+  inline const std::string &trend_template_begin() {
+    static const char *const pieces[] = {
+#include "html_trend_template_begin.tpl"
+    };
+
+    static const std::string s = html_template_libraries() + string_from_cstrs(pieces);
+    return s;
+  }
+
+  inline const std::string &trend_template_end() {
+    static const char *const pieces[] = {
+#include "html_trend_template_end.tpl"
+    };
+
+    static const std::string s = string_from_cstrs(pieces);
+    return s;
+  }
+
+  // Shifts in the level of a benchmark's means over the history
+  inline std::vector<std::size_t> history_changepoints(const BenchmarkHistory &history) {
+    std::vector<double> means, standard_errors;
+    for (const auto &e : history.entries()) {
+      means.push_back(e.mean().point().count());
+      standard_errors.push_back(e.mean().standard_error().count());
+    }
+
+    return detect_changepoints(means, standard_errors);
+  }
+}
+
+// Writes an HTML page which plots the mean of each benchmark in a history over its revisions,
+// with the confidence intervals as a band and the revisions where the mean shifted marked
+inline void write_trend_report(std::ostream &os, const std::vector<BenchmarkHistory> &histories) {
+  const int SIGNIFICANT_DIGITS = 6;
+
+  BufferedWriter out(os);
+  out << detail::trend_template_begin() << "\n";
+  out << "var trendData = [\n";
+
+  for (const auto &history : histories) {
+    const auto &entries = history.entries();
+
+    auto max_mean = FpNs(0);
+    for (const auto &e : entries) {
+      max_mean = (std::max)(max_mean, e.mean().point());
+    }
+    const auto scaler = scaler_for_time(max_mean);
+
+    const auto write_times = [&](const char *const name, FpNs (Estimate<FpNs>::*time)() const) {
+      out << "    " << name << " : [";
+      const char *sep = "";
+      for (const auto &e : entries) {
+        out << sep;
+        out.write_general(scaler.scale((e.mean().*time)()), SIGNIFICANT_DIGITS);
+        sep = ", ";
+      }
+      out << "],\n";
+    };
+
+    out << "{\n";
+    out << "    name : '" << js_string_escape(history.name()) << "',\n";
+    out << "    units : '" << scaler.units() << "',\n";
+    out << "    confidenceLevel : '";
+    out.write_general(entries.empty() ? 0.0 : entries.back().mean().confidence_level() * 100, 6);
+    out << "%',\n";
+
+    out << "    revisions : [";
+    const char *sep = "";
+    for (const auto &e : entries) {
+      out << sep << "'" << js_string_escape(e.revision()) << "'";
+      sep = ", ";
+    }
+    out << "],\n";
+
+    write_times("means", &Estimate<FpNs>::point);
+    write_times("lower", &Estimate<FpNs>::lower_bound);
+    write_times("upper", &Estimate<FpNs>::upper_bound);
+
+    out << "    changepoints : [";
+    sep = "";
+    for (const auto c : detail::history_changepoints(history)) {
+      out << sep << c;
+      sep = ", ";
+    }
+    out << "]\n";
+    out << "},\n";
+  }
+
+  out << "];\n";
+  out << detail::trend_template_end() << "\n";
+}
+}
+
+#endif // VELOX_TREND_REPORT_H_INCLUDED
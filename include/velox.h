@@ -9,12 +9,21 @@
 #include "text_reporter.h"
 #include "html_reporter.h"
 #include "multi_reporter.h"
-
+#include "async_reporter.h"
+#include "deferred.h"
+#include "checkpoint.h"
+#include "shard.h"
+#include "warm_up_cache.h"
+#include "history.h"
+#include "trend_report.h"
+
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <cassert>
 #include <vector>
 #include <initializer_list>
+#include <set>
 #include <tuple>
 
 namespace velox {
@@ -22,20 +31,61 @@ namespace velox {
 template <class C = DefaultClock>
 struct Velox {
   Velox(Reporter &reporter, const VeloxConfig &config = VeloxConfig())
-      : config_(config), reporter_(reporter) {
+      : config_(config), environment_(environment_fingerprint(type_name<C>(), C::is_steady)),
+        merged_shards_(config.force_merge() ? config.merge()
+                                            : shards_in_environment(config.merge(), environment_)),
+        checkpoint_(config.checkpoint(), config.resume(), merged_shards_),
+        warm_up_cache_(config.warm_up_cache()),
+        with_files_(reporter, checkpoint_, warm_up_cache_),
+        reporter_(config.checkpoint().empty() && config.warm_up_cache().empty() ? reporter
+                                                                                : with_files_),
+        clock_resolution_(0.0) {
     reporter_.suite_starting(type_name<C>(), C::is_steady);
+    if (config.quick_mode()) {
+      reporter_.quick_mode_enabled();
+    }
+    // The benchmarks of shards which ran somewhere else are neither merged nor run again here
+    for (const auto &shard : config.merge()) {
+      if (std::find(merged_shards_.begin(), merged_shards_.end(), shard) == merged_shards_.end()) {
+        reporter_.merge_refused(shard, read_checkpoint_environment(shard), environment_);
+        for (const auto &e : read_checkpoint(shard)) {
+          refused_.insert(e.name());
+        }
+      }
+    }
+
+    clock_resolution_ = estimate_clock_resolution<C>();
+    reporter_.clock_resolution_estimated(clock_resolution_);
+
     if (config.estimate_clock_cost()) {
-      estimate_clock_cost<C>(config_, reporter_);
+      estimate_clock_cost<C>(config_, clock_resolution_, reporter_);
     }
   }
 
   Velox &operator=(const Velox &rhs) = delete;
 
-  ~Velox() { reporter_.suite_ended(); }
+  ~Velox() {
+    deferred_.run(config_, reporter_);
+    reporter_.suite_ended();
+  }
 
   template <class F>
   Velox &bench(const std::string &name, F &&f) {
-    benchmark<C>(name, std::forward<F>(f), config_, reporter_);
+    run_benchmark(name, std::forward<F>(f));
+    return *this;
+  }
+
+  // Calls f open loop at each of the configured request rates and reports the latencies.
+  // Checkpoints don't store load tests, so a sharded run skips them and the run merging the
+  // shards runs each of them once.
+  template <class F>
+  Velox &load(const std::string &name, F &&f, const LoadConfig &config) {
+    if (config_.shard_count() > 1) {
+      return *this;
+    }
+
+    auto &reporter = config_.deferred_analysis() ? deferred_.next() : reporter_;
+    load_test<C>(name, std::forward<F>(f), config, reporter);
     return *this;
   }
 
@@ -92,6 +142,47 @@ struct Velox {
   }
 
 private:
+  template <class F>
+  void run_benchmark(const std::string &name, F &&f) {
+    if (!in_shard(name, config_.shard_index(), config_.shard_count())) {
+      return;
+    }
+
+    // Benchmarks finished by an earlier run or by the shards being merged are reported again
+    // without running them
+    const auto finished = checkpoint_.finished(name);
+    if (!finished && refused_.count(name)) {
+      return;
+    }
+    const auto cached = warm_up_cache_.find(name);
+
+    if (!config_.deferred_analysis()) {
+      if (finished) {
+        reporter_.benchmark_starting(name);
+        replay_measurement(*finished, reporter_);
+        analyze(finished->measurements(), config_, reporter_);
+        return;
+      }
+
+      benchmark<C>(name, std::forward<F>(f), config_, clock_resolution_, reporter_, cached);
+      return;
+    }
+
+    auto &events = deferred_.next();
+    events.benchmark_starting(name);
+    if (finished) {
+      replay_measurement(*finished, events);
+      deferred_.analyze_later(Measurements(finished->measurements()));
+      return;
+    }
+
+    auto measure_result =
+        measure<C>(std::forward<F>(f), config_, clock_resolution_, events, cached);
+    if (measure_result.second) {
+      deferred_.analyze_later(std::move(measure_result.first));
+    }
+  }
+
   struct Formatter {
     template <class T>
     void operator()(std::ostream &os, const T &t) const {
@@ -124,10 +215,7 @@ private:
         IsCallable<F, Stopwatch &, decltype(std::get<Is>(args))...>::value,
         "Function not callable with args.  Perhaps the function is taking non-const references?");
 
-    benchmark<C>(name,
-                 [&f, &args](Stopwatch &sw) { return f(sw, std::get<Is>(args)...); },
-                 config_,
-                 reporter_);
+    run_benchmark(name, [&f, &args](Stopwatch &sw) { return f(sw, std::get<Is>(args)...); });
   }
 
   template <class F, class TupledArgs, std::size_t... Is>
@@ -137,12 +225,24 @@ private:
         IsCallable<F, decltype(std::get<Is>(args))...>::value,
         "Function not callable with args.  Perhaps the function is taking non-const references?");
 
-    benchmark<C>(name, [&f, &args] { return f(std::get<Is>(args)...); }, config_, reporter_);
+    run_benchmark(name, [&f, &args] { return f(std::get<Is>(args)...); });
   }
 
 private:
   VeloxConfig config_;
+  std::string environment_;
+  // The shard checkpoints written in this run's environment, or all of them when forced
+  std::vector<std::string> merged_shards_;
+  // The benchmarks in the other shard checkpoints
+  std::set<std::string> refused_;
+  CheckpointReporter checkpoint_;
+  WarmUpCache warm_up_cache_;
+  MultiReporter with_files_;
+  // The reporter passed to the constructor, along with checkpoint_ and warm_up_cache_ when either
+  // of them has a file
   Reporter &reporter_;
+  FpNs clock_resolution_;
+  DeferredAnalysis deferred_;
 };
 }
 
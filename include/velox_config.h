@@ -1,12 +1,106 @@
 #ifndef VELOX_VELOX_CONFIG_H_INCLUDED
 #define VELOX_VELOX_CONFIG_H_INCLUDED
 
+#include "util.h"
+#include "quantile_sketch.h"
+#include "custom_statistic.h"
+
+#include <string>
+#include <vector>
+
 namespace velox {
 
+// How much of each statistic's bootstrap distribution is kept once its estimate has been made
+enum class DistributionStorage {
+  // Every resampled value
+  full,
+  // A fixed size QuantileSketch
+  sketch,
+  // Only the estimate.  A sketch is still used while the estimate is being made.
+  none
+};
+
+// How confidence intervals are calculated from the bootstrap distributions
+enum class IntervalMethod {
+  // The percentiles of the bootstrap distribution
+  percentile,
+  // Efron's bias-corrected and accelerated percentiles with the acceleration estimated by the
+  // jackknife.  These are accurate with far fewer resamples than percentile intervals.
+  bca
+};
+
+// How the measurements are resampled when bootstrapping
+enum class ResampleMethod {
+  // Each measurement is drawn independently, which assumes the measurements are iid
+  iid,
+  // Blocks of a fixed number of consecutive measurements, wrapping around at the end
+  moving_block,
+  // Blocks of consecutive measurements with geometrically distributed lengths
+  stationary
+};
+
+// What estimate_statistics does with the severe outliers (beyond Q1 - 3 * IQR or Q3 + 3 * IQR)
+enum class OutlierPolicy {
+  // Analyze every measurement
+  keep,
+  // Leave out the measurements whose times are severe outliers
+  exclude,
+  // Clamp the times of severe outliers to the severe thresholds
+  winsorize
+};
+
+// How lines are fit to the measurements, both through the origin for the LLS statistic and with
+// an intercept for the slope and overhead statistics
+enum class RegressionMethod {
+  // Least squares
+  least_squares,
+  // Huber M-estimation, which down-weights points far from the line
+  huber,
+  // The median of the slopes between every pair of measurements
+  theil_sen
+};
+
+// The order and number of iterations of the measurements
+enum class IterationSchedule {
+  // 2, 3, 4, ... times the base number of iterations in increasing order
+  linear,
+  // The linear iteration counts in a random order
+  shuffled_linear,
+  // Iteration counts growing by a constant factor, with the same total as linear
+  geometric,
+  // Iteration counts spread evenly over the linear range by a randomly offset golden ratio
+  // sequence, so consecutive measurements differ a lot in length
+  low_discrepancy
+};
+
+// How the number of iterations of each measurement is chosen
+enum class SamplingMode {
+  // Flat sampling when the warm up shows an iteration takes longer than the flat sampling
+  // threshold, linear sampling otherwise
+  automatic,
+  // The iteration counts follow the iteration schedule so the time per iteration can be found
+  // by regression
+  linear,
+  // Every measurement runs the same number of iterations, for functions too slow for the
+  // linear schedule to finish in a reasonable time
+  flat
+};
+
 struct VeloxConfig {
   VeloxConfig()
-      : confidence_level_(0.95), measurement_time_(10000), num_resamples_(100000),
-        num_measurements_(100), warm_up_time_(5000), estimate_clock_cost_(false) {}
+      : confidence_level_(0.95), measurement_time_(0), num_resamples_(0), num_measurements_(0),
+        warm_up_time_(0), verification_warm_up_time_(500),
+        warm_up_tolerance_(0.2), estimate_clock_cost_(false),
+        min_measurement_ticks_(1000),
+        distribution_storage_(DistributionStorage::full), sketch_size_(DEFAULT_SKETCH_SIZE),
+        interval_method_(IntervalMethod::percentile), resample_method_(ResampleMethod::iid),
+        block_length_(0.0), adaptive_resampling_(false), resample_tolerance_(0.01),
+        min_resamples_(2000), resample_chunk_size_(1000), outlier_policy_(OutlierPolicy::keep),
+        regression_method_(RegressionMethod::least_squares),
+        iteration_schedule_(IterationSchedule::linear), sampling_mode_(SamplingMode::automatic),
+        flat_sampling_threshold_(10), flat_num_measurements_(10), quick_mode_(false),
+        deferred_analysis_(false), resume_(false), shard_index_(0), shard_count_(1),
+        force_merge_(false) {}
 
   // Used when calculating the https://en.wikipedia.org/wiki/Confidence_interval
   // of the various statistics
@@ -27,17 +121,31 @@ struct VeloxConfig {
     return *this;
   }
 
-  std::chrono::milliseconds measurement_time() const { return measurement_time_; }
+  // If it isn't set the default depends on quick mode
+  std::chrono::milliseconds measurement_time() const {
+    if (measurement_time_.count()) {
+      return measurement_time_;
+    }
+
+    return Ms(quick_mode_ ? 1000 : 10000);
+  }
 
   // Number of resamples to use for
   // http://en.wikipedia.org/wiki/Bootstrapping_%28statistics%29
+  // If it isn't set the default depends on the interval method
   VeloxConfig &num_resamples(const std::uint32_t n) {
     assert(n && "Must resample at least once");
     num_resamples_ = n;
     return *this;
   }
 
-  std::uint32_t num_resamples() const { return num_resamples_; }
+  std::uint32_t num_resamples() const {
+    if (num_resamples_) {
+      return num_resamples_;
+    }
+
+    return interval_method_ == IntervalMethod::bca ? 10000 : 100000;
+  }
 
   // The number of measurements to take
   VeloxConfig &num_measurements(const std::uint32_t n) {
@@ -46,7 +154,14 @@ struct VeloxConfig {
     return *this;
   }
 
-  std::uint32_t num_measurements() const { return num_measurements_; }
+  // If it isn't set the default depends on quick mode
+  std::uint32_t num_measurements() const {
+    if (num_measurements_) {
+      return num_measurements_;
+    }
+
+    return quick_mode_ ? 20 : 100;
+  }
 
   // How long to warm up for
   VeloxConfig &warm_up_time(const Ms ms) {
@@ -55,7 +170,43 @@ struct VeloxConfig {
     return *this;
   }
 
-  std::chrono::milliseconds warm_up_time() const { return warm_up_time_; }
+  // If it isn't set the default depends on quick mode
+  std::chrono::milliseconds warm_up_time() const {
+    if (warm_up_time_.count()) {
+      return warm_up_time_;
+    }
+
+    return Ms(quick_mode_ ? 500 : 5000);
+  }
+
+  // A file which keeps each benchmark's warm up between runs.  A benchmark found in it only warms
+  // up for verification_warm_up_time, to check the time per iteration is still within
+  // warm_up_tolerance of the stored warm up's, instead of the full warm_up_time.  Empty (the
+  // default) disables it.
+  VeloxConfig &warm_up_cache(const std::string &path) {
+    warm_up_cache_ = path;
+    return *this;
+  }
+
+  const std::string &warm_up_cache() const { return warm_up_cache_; }
+
+  VeloxConfig &verification_warm_up_time(const Ms ms) {
+    assert(ms.count() > 0 && "Must warm up for at least 1 ms");
+    verification_warm_up_time_ = ms;
+    return *this;
+  }
+
+  Ms verification_warm_up_time() const { return verification_warm_up_time_; }
+
+  // How much the verification's time per iteration may differ from the stored one, as a fraction
+  // of the smaller of the two, for the stored warm up to be used.  The default is 0.2.
+  VeloxConfig &warm_up_tolerance(const double tolerance) {
+    assert(tolerance >= 0.0 && "Tolerance must not be negative");
+    warm_up_tolerance_ = tolerance;
+    return *this;
+  }
+
+  double warm_up_tolerance() const { return warm_up_tolerance_; }
 
   // Whether to estimate the clock cost
   // Currently the clock cost is only reported, it is not used in any
@@ -67,13 +218,277 @@ struct VeloxConfig {
 
   bool estimate_clock_cost() const { return estimate_clock_cost_; }
 
+  // The minimum length of each measurement, in multiples of the clock's resolution which is
+  // estimated when the suite starts.  The iteration counts are raised when needed so the clock's
+  // granularity adds at most about 1 / ticks relative error.  0 disables the minimum.
+  //
+  // The minimum is capped at measurement_time / num_measurements, so on a coarse clock the run
+  // takes at most about (num_measurements + 1) / 4 times the measurement time with the linear
+  // schedule, and measurement_time once flat sampling is used.  Measurements which are still
+  // shorter than the minimum are reported with Reporter::measurements_too_short; a longer
+  // measurement_time lets them reach it.
+  VeloxConfig &min_measurement_ticks(const std::uint32_t ticks) {
+    min_measurement_ticks_ = ticks;
+    return *this;
+  }
+
+  std::uint32_t min_measurement_ticks() const { return min_measurement_ticks_; }
+
+  // How much of the bootstrap distributions to keep.  Keeping every resample costs
+  // num_resamples values per statistic per benchmark which adds up quickly for large suites.
+  VeloxConfig &distribution_storage(const DistributionStorage storage) {
+    distribution_storage_ = storage;
+    return *this;
+  }
+
+  DistributionStorage distribution_storage() const { return distribution_storage_; }
+
+  // The number of values each level of a QuantileSketch holds when the bootstrap
+  // distributions aren't fully stored.  Larger sketches give more accurate confidence intervals.
+  VeloxConfig &sketch_size(const std::uint32_t n) {
+    assert(n >= 2 && "Sketch size must be at least 2");
+    sketch_size_ = n;
+    return *this;
+  }
+
+  std::uint32_t sketch_size() const { return sketch_size_; }
+
+  // How the confidence intervals are calculated from the bootstrap distributions
+  VeloxConfig &interval_method(const IntervalMethod method) {
+    interval_method_ = method;
+    return *this;
+  }
+
+  IntervalMethod interval_method() const { return interval_method_; }
+
+  // How to resample the measurements.  The block bootstraps keep runs of consecutive
+  // measurements together so the confidence intervals account for autocorrelation.
+  VeloxConfig &resample_method(const ResampleMethod method) {
+    resample_method_ = method;
+    return *this;
+  }
+
+  ResampleMethod resample_method() const { return resample_method_; }
+
+  // The (mean) block length for the block bootstraps.  0 selects it automatically.
+  VeloxConfig &block_length(const double length) {
+    assert((length >= 1.0 || !(length > 0.0)) && "Block length must be 0 or at least 1");
+    block_length_ = length;
+    return *this;
+  }
+
+  double block_length() const { return block_length_; }
+
+  // Bootstrap in chunks and stop once the confidence intervals and standard errors of every
+  // statistic stop moving, instead of always using num_resamples.  num_resamples is then the
+  // maximum number of resamples.
+  VeloxConfig &adaptive_resampling(const bool adaptive) {
+    adaptive_resampling_ = adaptive;
+    return *this;
+  }
+
+  bool adaptive_resampling() const { return adaptive_resampling_; }
+
+  // How much the estimates may change between chunks for adaptive resampling to stop, relative
+  // to the width of the confidence interval and the standard error
+  VeloxConfig &resample_tolerance(const double tolerance) {
+    assert(tolerance > 0.0 && "Tolerance must be positive");
+    resample_tolerance_ = tolerance;
+    return *this;
+  }
+
+  double resample_tolerance() const { return resample_tolerance_; }
+
+  // The minimum number of resamples to use with adaptive resampling
+  VeloxConfig &min_resamples(const std::uint32_t n) {
+    min_resamples_ = n;
+    return *this;
+  }
+
+  std::uint32_t min_resamples() const { return min_resamples_; }
+
+  // The number of resamples between convergence checks with adaptive resampling
+  VeloxConfig &resample_chunk_size(const std::uint32_t n) {
+    assert(n && "Chunks must contain at least one resample");
+    resample_chunk_size_ = n;
+    return *this;
+  }
+
+  std::uint32_t resample_chunk_size() const { return resample_chunk_size_; }
+
+  // What to do with severe outliers before estimating statistics.  Excluding or winsorizing them
+  // keeps interrupts, page faults, etc. on noisy machines from inflating the mean, SD and LLS.
+  VeloxConfig &outlier_policy(const OutlierPolicy policy) {
+    outlier_policy_ = policy;
+    return *this;
+  }
+
+  OutlierPolicy outlier_policy() const { return outlier_policy_; }
+
+  // How lines are fit to the measurements for the LLS, slope and overhead statistics
+  VeloxConfig &regression_method(const RegressionMethod method) {
+    regression_method_ = method;
+    return *this;
+  }
+
+  RegressionMethod regression_method() const { return regression_method_; }
+
+  // How many iterations each measurement runs, and in what order.  With the linear schedule
+  // periodic interference (timer ticks, housekeeping threads, etc.) can line up with the
+  // increasing measurement lengths and bias the regression.
+  VeloxConfig &iteration_schedule(const IterationSchedule schedule) {
+    iteration_schedule_ = schedule;
+    return *this;
+  }
+
+  IterationSchedule iteration_schedule() const { return iteration_schedule_; }
+
+  // How the number of iterations of each measurement is chosen.  The regression statistics
+  // (LLS, slope, overhead and r^2) are meaningless with flat sampling so only the per iteration
+  // statistics are reported.
+  VeloxConfig &sampling_mode(const SamplingMode mode) {
+    sampling_mode_ = mode;
+    return *this;
+  }
+
+  SamplingMode sampling_mode() const { return sampling_mode_; }
+
+  // With automatic sampling, flat sampling is used when an iteration takes longer than this
+  VeloxConfig &flat_sampling_threshold(const Ms ms) {
+    flat_sampling_threshold_ = ms;
+    return *this;
+  }
+
+  Ms flat_sampling_threshold() const { return flat_sampling_threshold_; }
+
+  // The number of measurements to take with flat sampling, used instead of num_measurements
+  VeloxConfig &flat_num_measurements(const std::uint32_t n) {
+    assert(n > 1 && "At least two samples must be taken");
+    flat_num_measurements_ = n;
+    return *this;
+  }
+
+  std::uint32_t flat_num_measurements() const { return flat_num_measurements_; }
+
+  // Quick mode trades accuracy for speed while iterating on a change: confidence intervals come
+  // from analytic approximations instead of the bootstrap and no KDE is computed.  Enabling it
+  // also shortens the default warm up (500 ms) and measurement time (1 s) and takes 20
+  // measurements by default.  Values which are set explicitly are kept, whatever the order.
+  VeloxConfig &quick_mode(const bool quick) {
+    quick_mode_ = quick;
+    return *this;
+  }
+
+  bool quick_mode() const { return quick_mode_; }
+
+  // Deferred analysis measures every benchmark in the suite before analysing any of them, so the
+  // analysis can't disturb later measurements, and then analyses them in parallel.  Nothing is
+  // reported until the suite ends and custom statistics must be safe to call concurrently.
+  VeloxConfig &deferred_analysis(const bool deferred) {
+    deferred_analysis_ = deferred;
+    return *this;
+  }
+
+  bool deferred_analysis() const { return deferred_analysis_; }
+
+  // Writes each benchmark's measurements and estimates to this file as soon as it has been
+  // analyzed, so a suite which is killed can be resumed.  With deferred analysis that is only
+  // when the suite ends.  Empty (the default) disables it.
+  VeloxConfig &checkpoint(const std::string &path) {
+    checkpoint_ = path;
+    return *this;
+  }
+
+  const std::string &checkpoint() const { return checkpoint_; }
+
+  // Resuming skips the benchmarks already in the checkpoint file and reports them again from
+  // their stored measurements, so the reports cover the whole suite.  Otherwise the checkpoint
+  // file is started afresh.
+  VeloxConfig &resume(const bool r) {
+    resume_ = r;
+    return *this;
+  }
+
+  bool resume() const { return resume_; }
+
+  // Only runs the benchmarks in shard index of count (see in_shard), so a suite can be split
+  // between several identical machines.  Each shard should write a checkpoint which is merged
+  // afterwards.  The default of one shard runs every benchmark.
+  VeloxConfig &shard(const std::uint32_t index, const std::uint32_t count) {
+    assert(count > 0 && index < count && "Shard index must be less than the number of shards");
+    shard_index_ = index;
+    shard_count_ = count;
+    return *this;
+  }
+
+  std::uint32_t shard_index() const { return shard_index_; }
+
+  std::uint32_t shard_count() const { return shard_count_; }
+
+  // Reports the benchmarks in the checkpoints of the shards of a suite from their stored
+  // measurements instead of running them, in the order the benchmarks are registered, so the
+  // reports cover the whole suite.  Benchmarks which aren't in any of the checkpoints are run.
+  // The checkpoints must have been written in the same environment as the merging run (see
+  // environment_fingerprint).  Any other checkpoint is refused, which is reported with
+  // Reporter::merge_refused, and its benchmarks are left out rather than run.
+  VeloxConfig &merge(const std::vector<std::string> &shard_checkpoints) {
+    merge_ = shard_checkpoints;
+    return *this;
+  }
+
+  const std::vector<std::string> &merge() const { return merge_; }
+
+  // Merges the shard checkpoints even if they were written in other environments
+  VeloxConfig &force_merge(const bool f) {
+    force_merge_ = f;
+    return *this;
+  }
+
+  bool force_merge() const { return force_merge_; }
+
+  // Adds a statistic to bootstrap along with the built in ones, e.g. percentile_statistic(99)
+  VeloxConfig &add_statistic(const CustomStatistic &statistic) {
+    statistics_.push_back(statistic);
+    return *this;
+  }
+
+  const std::vector<CustomStatistic> &statistics() const { return statistics_; }
+
 private:
   double confidence_level_;
   Ms measurement_time_;
   std::uint32_t num_resamples_;
   std::uint32_t num_measurements_;
   Ms warm_up_time_;
+  std::string warm_up_cache_;
+  Ms verification_warm_up_time_;
+  double warm_up_tolerance_;
   bool estimate_clock_cost_;
+  std::uint32_t min_measurement_ticks_;
+  DistributionStorage distribution_storage_;
+  std::uint32_t sketch_size_;
+  IntervalMethod interval_method_;
+  ResampleMethod resample_method_;
+  double block_length_;
+  bool adaptive_resampling_;
+  double resample_tolerance_;
+  std::uint32_t min_resamples_;
+  std::uint32_t resample_chunk_size_;
+  OutlierPolicy outlier_policy_;
+  RegressionMethod regression_method_;
+  IterationSchedule iteration_schedule_;
+  SamplingMode sampling_mode_;
+  Ms flat_sampling_threshold_;
+  std::uint32_t flat_num_measurements_;
+  bool quick_mode_;
+  bool deferred_analysis_;
+  std::string checkpoint_;
+  bool resume_;
+  std::uint32_t shard_index_;
+  std::uint32_t shard_count_;
+  std::vector<std::string> merge_;
+  bool force_merge_;
+  std::vector<CustomStatistic> statistics_;
 };
 }
 
@@ -0,0 +1,142 @@
+#ifndef VELOX_WARM_UP_CACHE_H_INCLUDED
+#define VELOX_WARM_UP_CACHE_H_INCLUDED
+
+#include "history.h"
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+
+namespace velox {
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Keeps the warm up of each benchmark in a file so later runs can check it with a short warm up
+// instead of repeating the full one (see VeloxConfig::warm_up_cache).
+//
+// Every warm up it is told about is appended to the file as a line of the benchmark's name, the
+// iterations and their duration in nanoseconds.  The last line for a benchmark wins and the file
+// is rewritten without the older lines when the suite ends.
+struct WarmUpCache : Reporter {
+  // An empty path disables the cache
+  explicit WarmUpCache(const std::string &path) : path_(path) {
+    if (path_.empty()) {
+      return;
+    }
+
+    std::ifstream existing(path_);
+    std::string line;
+    while (std::getline(existing, line) && !existing.eof()) {
+      const auto fields = detail::split_history_line(line);
+      long long iters = 0, duration = 0;
+      const char *iters_end = nullptr, *duration_end = nullptr;
+      if (fields.size() == 3 &&
+          detail::parse_history_integer(fields[1].c_str(), &iters_end, iters) && !*iters_end &&
+          detail::parse_history_integer(fields[2].c_str(), &duration_end, duration) &&
+          !*duration_end) {
+        set(fields[0], ItersForDurationNs(static_cast<std::uint64_t>(iters), Ns(duration)));
+      }
+    }
+    existing.close();
+
+    file_.open(path_, std::ios::app);
+  }
+
+  WarmUpCache &operator=(const WarmUpCache &rhs) = delete;
+
+  // The stored warm up of a benchmark, or null
+  const ItersForDurationNs *find(const std::string &name) const {
+    const auto it = warm_ups_.find(name);
+    return it == warm_ups_.end() ? nullptr : &it->second;
+  }
+
+  void benchmark_starting(const std::string &name) override { name_ = name; }
+
+  void warm_up_ended(const ItersForDurationNs &wu) override {
+    if (!file_.is_open()) {
+      return;
+    }
+
+    const auto stored = find(name_);
+    if (stored && stored->iters() == wu.iters() && stored->duration() == wu.duration()) {
+      return;
+    }
+
+    set(name_, wu);
+    write(file_, name_, wu);
+    file_.flush();
+  }
+
+  // Replaces the file with one line per benchmark, written to a temporary file first so the
+  // cache is never left half written
+  void suite_ended() override {
+    if (!file_.is_open()) {
+      return;
+    }
+    file_.close();
+
+    const auto temporary = path_ + ".tmp";
+    std::ofstream compacted(temporary, std::ios::trunc);
+    for (const auto &wu : warm_ups_) {
+      write(compacted, wu.first, wu.second);
+    }
+    compacted.close();
+
+    // The old file is kept if the new one couldn't be written in full
+    if (compacted.fail() || !replace_file(temporary, path_)) {
+      std::remove(temporary.c_str());
+    }
+
+    file_.open(path_, std::ios::app);
+  }
+
+private:
+  void set(const std::string &name, const ItersForDurationNs &wu) {
+    const auto it = warm_ups_.find(name);
+    if (it == warm_ups_.end()) {
+      warm_ups_.emplace(name, wu);
+    } else {
+      it->second = wu;
+    }
+  }
+
+  // Renames from over to.  POSIX renames replace an existing file atomically but Windows
+  // refuses to, so there the old file has to be removed first.
+  static bool replace_file(const std::string &from, const std::string &to) {
+    if (std::rename(from.c_str(), to.c_str()) == 0) {
+      return true;
+    }
+#ifdef _WIN32
+    if (std::remove(to.c_str()) != 0) {
+      return false;
+    }
+
+    // The temporary file is all that's left so it's kept even if this fails
+    std::rename(from.c_str(), to.c_str());
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  static void write(std::ostream &os, const std::string &name, const ItersForDurationNs &wu) {
+    BufferedWriter out(os, DOUBLE_BUFFER_SIZE);
+    detail::write_history_field(out, name);
+    out << '\t' << wu.iters() << '\t' << wu.duration().count() << '\n';
+  }
+
+private:
+  std::string path_;
+  std::ofstream file_;
+  std::map<std::string, ItersForDurationNs> warm_ups_;
+  std::string name_;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+}
+
+#endif // VELOX_WARM_UP_CACHE_H_INCLUDED
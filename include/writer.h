@@ -0,0 +1,145 @@
+#ifndef VELOX_WRITER_H_INCLUDED
+#define VELOX_WRITER_H_INCLUDED
+
+#include "dtoa.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace velox {
+
+namespace {
+  const std::size_t DEFAULT_WRITER_BUFFER_SIZE = 64 * 1024;
+}
+
+// Collects output in a buffer and hands it to a stream in large blocks.  Numbers are converted
+// without going through the stream so no locale, flags or precision are involved: doubles are
+// written as the shortest decimal which reads back as the same double, or with a fixed number
+// of decimals by write_fixed.
+//
+// The buffer is written to the stream by flush and the destructor.
+struct BufferedWriter {
+  explicit BufferedWriter(std::ostream &os, const std::size_t size = DEFAULT_WRITER_BUFFER_SIZE)
+      : os_(os), buffer_((std::max)(size, DOUBLE_BUFFER_SIZE)), used_(0) {}
+
+  BufferedWriter &operator=(const BufferedWriter &rhs) = delete;
+
+  ~BufferedWriter() { flush(); }
+
+  void flush() {
+    if (used_) {
+      os_.write(buffer_.data(), static_cast<std::streamsize>(used_));
+      used_ = 0;
+    }
+  }
+
+  void write(const char *const s, const std::size_t n) {
+    if (n > buffer_.size() - used_) {
+      flush();
+
+      if (n >= buffer_.size()) {
+        os_.write(s, static_cast<std::streamsize>(n));
+        return;
+      }
+    }
+
+    std::memcpy(buffer_.data() + used_, s, n);
+    used_ += n;
+  }
+
+  // Writes n with precision digits after the decimal point, like printf's "%.*f"
+  void write_fixed(const double n, const int precision) {
+    reserve(DOUBLE_BUFFER_SIZE);
+    used_ = end_offset(velox::write_fixed(buffer_.data() + used_, n, precision));
+  }
+
+  // Writes n with precision significant digits, like a stream's default floating point format
+  void write_general(const double n, const int precision) {
+    reserve(DOUBLE_BUFFER_SIZE);
+    const auto written =
+        std::snprintf(buffer_.data() + used_, DOUBLE_BUFFER_SIZE, "%.*g", precision, n);
+    assert(written > 0 && "Formatting failed");
+    used_ += static_cast<std::size_t>(written);
+  }
+
+  BufferedWriter &operator<<(const char *const s) {
+    write(s, std::strlen(s));
+    return *this;
+  }
+
+  BufferedWriter &operator<<(const std::string &s) {
+    write(s.data(), s.size());
+    return *this;
+  }
+
+  BufferedWriter &operator<<(const char c) {
+    reserve(1);
+    buffer_[used_++] = c;
+    return *this;
+  }
+
+  BufferedWriter &operator<<(const double n) {
+    reserve(DOUBLE_BUFFER_SIZE);
+    used_ = end_offset(write_shortest(buffer_.data() + used_, n));
+    return *this;
+  }
+
+  template <class T>
+  typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value,
+                          BufferedWriter &>::type
+  operator<<(const T n) {
+    write_unsigned(n, false);
+    return *this;
+  }
+
+  template <class T>
+  typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+                          BufferedWriter &>::type
+  operator<<(const T n) {
+    // Negated in unsigned arithmetic so the most negative value doesn't overflow
+    const auto magnitude = static_cast<std::uint64_t>(n);
+    write_unsigned(n < 0 ? ~magnitude + 1 : magnitude, n < 0);
+    return *this;
+  }
+
+private:
+  void reserve(const std::size_t n) {
+    if (n > buffer_.size() - used_) {
+      flush();
+    }
+  }
+
+  std::size_t end_offset(const char *const end) const {
+    return static_cast<std::size_t>(end - buffer_.data());
+  }
+
+  void write_unsigned(std::uint64_t n, const bool negative) {
+    char digits[21];
+    auto first = digits + sizeof(digits);
+    do {
+      *--first = static_cast<char>('0' + n % 10);
+      n /= 10;
+    } while (n);
+
+    if (negative) {
+      *--first = '-';
+    }
+
+    write(first, static_cast<std::size_t>(digits + sizeof(digits) - first));
+  }
+
+private:
+  std::ostream &os_;
+  std::vector<char> buffer_;
+  std::size_t used_;
+};
+}
+
+#endif // VELOX_WRITER_H_INCLUDED
@@ -69,7 +69,9 @@ def main():
 ''')
         fout.write('#ifndef VELOX_AMALGAMATION_H_INCLUDED\n')
         fout.write('#define VELOX_AMALGAMATION_H_INCLUDED\n')
-        amalgamate(fout, os.path.join(INCLUDE_DIR, 'velox.h'))
+        # Offline analysis isn't needed to run benchmarks so velox.h doesn't include it
+        for header in ['velox.h', 'offline_analysis.h']:
+            amalgamate(fout, os.path.join(INCLUDE_DIR, header))
         fout.write('#endif // VELOX_AMALGAMATION_H_INCLUDED\n\n')
 
 if __name__ == "__main__":
@@ -10,12 +10,25 @@ def write_strings(dest, tpl):
     dest.write('\n')
 
 def main():
+    LIBRARIES_END = '<!--*****END OF LIBRARIES*****-->'
     PLACEHOLDER = '/*****PLACEHOLDER FOR benchmarkData*****/'
     with open('html_report_template.html') as f, \
+        open('html_template_libraries.tpl', 'w') as tpl_libraries, \
         open('html_template_begin.tpl', 'w') as tpl_begin, \
         open('html_template_end.tpl', 'w') as tpl_end:
         template = f.read();
+        libraries, template = template.split(LIBRARIES_END)
         template_begin, template_end = template.split(PLACEHOLDER)
+        write_strings(tpl_libraries, libraries);
+        write_strings(tpl_begin, template_begin);
+        write_strings(tpl_end, template_end)
+
+    # The trend report follows the same libraries as the report
+    TREND_PLACEHOLDER = '/*****PLACEHOLDER FOR trendData*****/'
+    with open('html_trend_template.html') as f, \
+        open('html_trend_template_begin.tpl', 'w') as tpl_begin, \
+        open('html_trend_template_end.tpl', 'w') as tpl_end:
+        template_begin, template_end = f.read().split(TREND_PLACEHOLDER)
         write_strings(tpl_begin, template_begin);
         write_strings(tpl_end, template_end)
 
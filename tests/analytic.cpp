@@ -0,0 +1,106 @@
+#include "analytic.h"
+#include "test_helpers.h"
+
+#include <random>
+
+using namespace velox;
+
+namespace {
+Times analytic_test_times() {
+  std::mt19937 rng(11);
+  std::normal_distribution<double> distribution(100.0, 10.0);
+
+  Times times;
+  for (int i = 0; i < 30; ++i) {
+    times.push_back(FpNs(distribution(rng)));
+  }
+  return times;
+}
+}
+
+TEST_CASE("mean t interval") {
+  const Times times{FpNs(1), FpNs(2), FpNs(3), FpNs(4), FpNs(5)};
+  const auto e = mean_t_interval(SampleSummary(times), 0.95);
+
+  // sd = sqrt(2.5), t(.975, 4) = 2.776
+  REQUIRE(e.point().count() == Approx(3.0));
+  REQUIRE(e.standard_error().count() == Approx(std::sqrt(2.5 / 5.0)));
+  REQUIRE(e.lower_bound().count() == Approx(3.0 - 2.776445 * std::sqrt(0.5)).epsilon(0.005));
+  REQUIRE(e.upper_bound().count() == Approx(3.0 + 2.776445 * std::sqrt(0.5)).epsilon(0.005));
+}
+
+TEST_CASE("median order statistic interval") {
+  Times times;
+  for (int i = 1; i <= 20; ++i) {
+    times.push_back(FpNs(i));
+  }
+
+  // P(B <= 5) = .0207 <= .025 < P(B <= 6) so the interval is [x(6), x(15)]
+  const auto e = median_order_statistic_interval(SampleSummary(times), 0.95);
+  REQUIRE(e.point().count() == Approx(10.5));
+  REQUIRE(e.lower_bound().count() == Approx(6.0));
+  REQUIRE(e.upper_bound().count() == Approx(15.0));
+
+  // Too few values for the confidence level covers the whole sample
+  const Times few{FpNs(3), FpNs(1), FpNs(2)};
+  const auto f = median_order_statistic_interval(SampleSummary(few), 0.95);
+  REQUIRE(f.lower_bound().count() == Approx(1.0));
+  REQUIRE(f.upper_bound().count() == Approx(3.0));
+}
+
+TEST_CASE("estimate_statistics_analytic") {
+  const auto times = analytic_test_times();
+
+  Measurements measurements;
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    const std::uint64_t iters = i + 2;
+    measurements.emplace_back(
+        iters, Ns(static_cast<Ns::rep>(std::round(times[i].count() * static_cast<double>(iters)))));
+  }
+
+  const auto config =
+      VeloxConfig().quick_mode(true).add_statistic(percentile_statistic(90)).num_resamples(2000);
+  const SampleSummary summary(times);
+
+  const auto quick = estimate_statistics_analytic(measurements, summary, config);
+  const auto boot = estimate_statistics(measurements, times, summary, config);
+
+  REQUIRE(quick.analytic());
+  REQUIRE(!boot.analytic());
+  REQUIRE(quick.num_resamples() == 0);
+  REQUIRE(quick.custom().size() == 1);
+
+  // The analytic intervals should be close to the bootstrapped ones for normal data
+  const auto close = [](const Estimate<FpNs> &a, const Estimate<FpNs> &b) {
+    const auto width = b.upper_bound().count() - b.lower_bound().count();
+    REQUIRE(a.point().count() == Approx(b.point().count()).epsilon(0.01));
+    REQUIRE(std::abs(a.lower_bound().count() - b.lower_bound().count()) < width / 2.0);
+    REQUIRE(std::abs(a.upper_bound().count() - b.upper_bound().count()) < width / 2.0);
+  };
+
+  close(quick.mean().estimate(), boot.mean().estimate());
+  close(quick.median().estimate(), boot.median().estimate());
+  close(quick.std_dev().estimate(), boot.std_dev().estimate());
+  close(quick.linear_least_squares().estimate(), boot.linear_least_squares().estimate());
+  close(quick.slope().estimate(), boot.slope().estimate());
+}
+
+TEST_CASE("quick mode config") {
+  const auto config = VeloxConfig().quick_mode(true);
+
+  REQUIRE(config.quick_mode());
+  REQUIRE(config.num_measurements() == 20);
+  REQUIRE(config.measurement_time() == Ms(1000));
+
+  REQUIRE(config.warm_up_time() == Ms(500));
+  REQUIRE(VeloxConfig().num_measurements() == 100);
+
+  // Explicit settings win whichever order the setters are called in
+  const auto after = VeloxConfig().quick_mode(true).warm_up_time(Ms(2000)).num_measurements(50);
+  const auto before = VeloxConfig().warm_up_time(Ms(2000)).num_measurements(50).quick_mode(true);
+  for (const auto &c : {after, before}) {
+    REQUIRE(c.warm_up_time() == Ms(2000));
+    REQUIRE(c.num_measurements() == 50);
+    REQUIRE(c.measurement_time() == Ms(1000));
+  }
+}
@@ -0,0 +1,112 @@
+#include "async_reporter.h"
+#include "recording_reporter.h"
+#include "test_helpers.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velox;
+
+TEST_CASE("spsc queue") {
+  SpscQueue<int> queue(3);
+  REQUIRE(queue.capacity() == 4);
+
+  int i = 0;
+  REQUIRE(!queue.try_pop(i));
+
+  for (int j = 0; j < 4; ++j) {
+    auto value = j;
+    REQUIRE(queue.try_push(std::move(value)));
+  }
+  REQUIRE(!queue.try_push(4));
+
+  REQUIRE(queue.try_pop(i));
+  REQUIRE(i == 0);
+  REQUIRE(queue.try_push(4));
+
+  for (int j = 1; j < 5; ++j) {
+    REQUIRE(queue.try_pop(i));
+    REQUIRE(i == j);
+  }
+  REQUIRE(!queue.try_pop(i));
+}
+
+TEST_CASE("spsc queue across threads") {
+  const int n = 100000;
+  SpscQueue<int> queue(16);
+
+  std::thread producer([&] {
+    for (int i = 0; i < n; ++i) {
+      auto value = i;
+      while (!queue.try_push(std::move(value))) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::vector<int> received;
+  int i = 0;
+  while (received.size() < n) {
+    if (queue.try_pop(i)) {
+      received.push_back(i);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  bool in_order = true;
+  for (int j = 0; j < n; ++j) {
+    in_order = in_order && received[static_cast<std::size_t>(j)] == j;
+  }
+  REQUIRE(in_order);
+}
+
+namespace {
+struct SlowReporter : Reporter {
+  void benchmark_starting(const std::string &name) override {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    names.push_back(name);
+    threads.push_back(std::this_thread::get_id());
+  }
+
+  void suite_ended() override { ++suites_ended; }
+
+  std::vector<std::string> names;
+  std::vector<std::thread::id> threads;
+  int suites_ended = 0;
+};
+}
+
+TEST_CASE("async reporter delivers every event in order by suite_ended") {
+  SlowReporter slow;
+  AsyncReporter async(slow, 4);
+
+  std::vector<std::string> expected;
+  for (int i = 0; i < 100; ++i) {
+    expected.push_back(std::to_string(i));
+    async.benchmark_starting(expected.back());
+  }
+  async.suite_ended();
+
+  REQUIRE(slow.names == expected);
+  REQUIRE(slow.suites_ended == 1);
+  REQUIRE(slow.threads.front() != std::this_thread::get_id());
+
+  // A second suite restarts the delivery thread
+  async.benchmark_starting("again");
+  async.suite_ended();
+  REQUIRE(slow.names.back() == "again");
+  REQUIRE(slow.suites_ended == 2);
+}
+
+TEST_CASE("async reporter flushes when destroyed") {
+  RecordingReporter recording;
+  {
+    AsyncReporter async(recording);
+    async.warm_up_starting(Ms(1));
+    async.benchmark_ended();
+  }
+  REQUIRE(recording.size() == 2);
+}
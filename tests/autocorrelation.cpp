@@ -0,0 +1,74 @@
+#include "autocorrelation.h"
+#include "test_helpers.h"
+
+#include <random>
+
+using namespace velox;
+
+namespace {
+Times ar1(const double phi, const std::size_t n) {
+  std::mt19937 rng(3);
+  std::normal_distribution<double> noise(0.0, 1.0);
+
+  Times series;
+  double x = 0.0;
+  for (std::size_t i = 0; i < n; ++i) {
+    x = phi * x + noise(rng);
+    series.push_back(FpNs(100.0 + x));
+  }
+  return series;
+}
+}
+
+TEST_CASE("autocovariances") {
+  // R: acf(c(1, 3, 2, 5, 4), type="covariance", plot=FALSE, lag.max=2, demean=TRUE)
+  const Times series{FpNs{1}, FpNs{3}, FpNs{2}, FpNs{5}, FpNs{4}};
+  const auto acv = autocovariances(series, 2);
+
+  REQUIRE(acv.size() == 3);
+  CHECK(acv[0] == Approx(2.0));
+  CHECK(acv[1] == Approx(0.0));
+  CHECK(acv[2] == Approx(0.2));
+}
+
+TEST_CASE("autocorrelation of white noise") {
+  const auto series = ar1(0.0, 500);
+  const Autocorrelation ac(series, VeloxConfig().resample_method(ResampleMethod::stationary));
+
+  CHECK(!ac.significant());
+  CHECK(std::abs(ac.lag1()) < ac.critical_value());
+  CHECK(ac.effective_sample_size() > 350);
+  CHECK(ac.block_length() < 3);
+}
+
+TEST_CASE("autocorrelation of drifting measurements") {
+  const auto series = ar1(0.8, 500);
+
+  const Autocorrelation iid(series, VeloxConfig());
+  CHECK(iid.significant());
+  CHECK(iid.lag1() == Approx(0.8).epsilon(.1));
+  CHECK(iid.effective_sample_size() < 100);
+  CHECK(iid.block_length() == Approx(1.0));
+
+  const Autocorrelation stationary(series,
+                                   VeloxConfig().resample_method(ResampleMethod::stationary));
+  CHECK(stationary.block_length() > 5);
+  CHECK(stationary.block_length() <= std::ceil(3.0 * std::sqrt(500.0)));
+
+  const Autocorrelation fixed(
+      series, VeloxConfig().resample_method(ResampleMethod::moving_block).block_length(4));
+  CHECK(fixed.block_length() == Approx(4.0));
+}
+
+TEST_CASE("optimal block length") {
+  const auto series = ar1(0.8, 500);
+
+  CHECK(optimal_block_length(series, ResampleMethod::iid) == Approx(1.0));
+  // The blocks of the circular block bootstrap are about 1.5^(1/3) times longer than the mean
+  // block length of the stationary bootstrap
+  CHECK(optimal_block_length(series, ResampleMethod::moving_block) ==
+        Approx(std::cbrt(1.5) * optimal_block_length(series, ResampleMethod::stationary)));
+
+  const Times constant{FpNs{1}, FpNs{1}, FpNs{1}, FpNs{1}, FpNs{1}};
+  CHECK(optimal_block_length(constant, ResampleMethod::stationary) == Approx(1.0));
+}
@@ -3,6 +3,8 @@
 
 #include <sstream>
 #include <algorithm>
+#include <random>
+#include <functional>
 
 using namespace velox;
 
@@ -102,3 +104,367 @@ TEST_CASE("estimate_statistics") {
   REQUIRE(.98952 == Approx(r2.estimate().upper_bound()));
   REQUIRE(0.95 == Approx(r2.estimate().confidence_level()));
 }
+
+TEST_CASE("estimate_statistics distribution storage") {
+  const Measurements measurements{{1, Ns{5}}, {2, Ns{50}}, {3, Ns{67}}, {4, Ns{71}}, {5, Ns{81}}};
+  const Times sample{FpNs{5}, FpNs{50}, FpNs{67}, FpNs{71}, FpNs{80}, FpNs{81}};
+
+  const auto config = VeloxConfig().num_resamples(3).confidence_level(.95);
+  const auto full = estimate_statistics<TestDistribution>(measurements, sample, config);
+
+  // The sketch is exact as long as it never has to compact so the estimates should match
+  const auto sketched = estimate_statistics<TestDistribution>(
+      measurements, sample, VeloxConfig(config).distribution_storage(DistributionStorage::sketch));
+
+  REQUIRE(sketched.mean().storage() == DistributionStorage::sketch);
+  REQUIRE(sketched.mean().distribution().empty());
+  REQUIRE(sketched.mean().sketch().count() == 3);
+  REQUIRE(full.mean().estimate().lower_bound().count() ==
+          Approx(sketched.mean().estimate().lower_bound().count()));
+  REQUIRE(full.mean().estimate().upper_bound().count() ==
+          Approx(sketched.mean().estimate().upper_bound().count()));
+  REQUIRE(full.mean().estimate().standard_error().count() ==
+          Approx(sketched.mean().estimate().standard_error().count()));
+  REQUIRE(full.r_squared().estimate().lower_bound() ==
+          Approx(sketched.r_squared().estimate().lower_bound()));
+
+  const auto estimate_only = estimate_statistics<TestDistribution>(
+      measurements, sample, VeloxConfig(config).distribution_storage(DistributionStorage::none));
+
+  REQUIRE(estimate_only.median().storage() == DistributionStorage::none);
+  REQUIRE(estimate_only.median().distribution().empty());
+  REQUIRE(estimate_only.median().sketch().empty());
+  REQUIRE(full.median().estimate().upper_bound().count() ==
+          Approx(estimate_only.median().estimate().upper_bound().count()));
+}
+
+TEST_CASE("bca interval") {
+  // No bias and no acceleration is the percentile interval
+  const auto unadjusted = bca_interval(.5, 0.0, 1000, .95);
+  REQUIRE(unadjusted.lower() == Approx(2.5));
+  REQUIRE(unadjusted.upper() == Approx(97.5));
+
+  // A point estimate above most of the distribution shifts the interval up
+  const auto biased = bca_interval(.6, 0.0, 1000, .95);
+  REQUIRE(biased.lower() > 2.5);
+  REQUIRE(biased.upper() > 97.5);
+
+  // The exponential distribution is skewed right so its mean has positive acceleration
+  const std::vector<double> sample{0.1, 0.2, 0.3, 0.5, 0.8, 1.3, 2.1, 3.4, 5.5};
+  REQUIRE(jackknife_acceleration(sample, [](const std::vector<double> &s) { return mean(s); }) >
+          0.0);
+}
+
+TEST_CASE("bca interval coverage") {
+  // Check how often the intervals miss the true mean of skewed distributions.  Percentile
+  // intervals mostly miss on one side while BCa intervals should miss about equally often on
+  // both sides, even with a small number of resamples.
+  std::mt19937 rng(1234);
+  const auto cl = .9;
+  const std::uint32_t trials = 400, n = 20, num_resamples = 1000;
+
+  struct Misses {
+    std::uint32_t low;
+    std::uint32_t high;
+  };
+
+  const auto simulate = [&](std::function<double()> draw, const double true_mean) {
+    Misses bca{0, 0}, pct{0, 0};
+
+    const auto count = [true_mean](Misses &m, const Estimate<double> &e) {
+      if (true_mean < e.lower_bound()) {
+        ++m.low;
+      } else if (true_mean > e.upper_bound()) {
+        ++m.high;
+      }
+    };
+
+    for (std::uint32_t t = 0; t < trials; ++t) {
+      std::vector<double> sample;
+      std::generate_n(std::back_inserter(sample), n, draw);
+
+      std::vector<double> means;
+      resample<std::uniform_int_distribution>(sample, num_resamples, rng(), [&](
+          const std::vector<double> &s) { means.push_back(mean(s)); });
+      std::sort(means.begin(), means.end());
+
+      const auto point = mean(sample);
+      const auto a =
+          jackknife_acceleration(sample, [](const std::vector<double> &s) { return mean(s); });
+      const auto interval =
+          bca_interval(proportion_below_of_sorted(means, point), a, num_resamples, cl);
+
+      count(bca, make_estimate_of_sorted(point, means, interval, cl));
+      count(pct, make_estimate_of_sorted(point, means, percentile_interval(cl), cl));
+    }
+
+    const auto coverage = 1.0 - static_cast<double>(bca.low + bca.high) / trials;
+    CHECK(std::abs(coverage - cl) < .06);
+
+    const auto imbalance = [](const Misses &m) {
+      return std::abs(static_cast<int>(m.high) - static_cast<int>(m.low));
+    };
+    CHECK(imbalance(bca) < imbalance(pct));
+  };
+
+  std::exponential_distribution<double> exponential(1.0);
+  simulate([&] { return exponential(rng); }, 1.0);
+
+  std::lognormal_distribution<double> lognormal(0.0, .75);
+  simulate([&] { return lognormal(rng); }, std::exp(.75 * .75 / 2));
+}
+
+TEST_CASE("estimate_statistics bca") {
+  REQUIRE(VeloxConfig().num_resamples() == 100000);
+  REQUIRE(VeloxConfig().interval_method(IntervalMethod::bca).num_resamples() == 10000);
+  REQUIRE(VeloxConfig().num_resamples(5).interval_method(IntervalMethod::bca).num_resamples() ==
+          5);
+
+  const Measurements measurements{{1, Ns{5}}, {2, Ns{50}}, {3, Ns{67}}, {4, Ns{71}}, {5, Ns{81}}};
+  const Times sample{FpNs{5}, FpNs{50}, FpNs{67}, FpNs{71}, FpNs{80}, FpNs{81}};
+
+  const auto e = estimate_statistics<TestDistribution>(
+      measurements,
+      sample,
+      VeloxConfig().num_resamples(3).interval_method(IntervalMethod::bca));
+
+  // The distributions are the same, only the intervals change
+  const std::vector<FpNs> expected_mean{FpNs{67.16667}, FpNs{74.33333}, FpNs{57.33333}};
+  REQUIRE(FpRange(expected_mean) == FpRange(e.mean().distribution()));
+
+  const auto &mean_estimate = e.mean().estimate();
+  REQUIRE(59.0 == Approx(mean_estimate.point().count()));
+  REQUIRE(mean_estimate.lower_bound() <= mean_estimate.upper_bound());
+  REQUIRE(57.33333 <= mean_estimate.lower_bound().count());
+  REQUIRE(mean_estimate.upper_bound().count() <= 74.33333);
+}
+
+TEST_CASE("resample blocks") {
+  const std::vector<int> sample{1, 2, 3, 4, 5, 6};
+
+  // Blocks as long as the sample are rotations of it
+  resample_blocks<std::uniform_int_distribution>(
+      sample, 10, 0, ResampleMethod::moving_block, 6.0, [&](const std::vector<int> &s) {
+        REQUIRE(s.size() == sample.size());
+        for (std::size_t i = 1; i < s.size(); ++i) {
+          REQUIRE(s[i] == s[i - 1] % 6 + 1);
+        }
+      });
+
+  // Blocks of 3 always consist of consecutive values
+  resample_blocks<std::uniform_int_distribution>(
+      sample, 10, 0, ResampleMethod::moving_block, 3.0, [&](const std::vector<int> &s) {
+        REQUIRE(s[1] == s[0] % 6 + 1);
+        REQUIRE(s[2] == s[1] % 6 + 1);
+        REQUIRE(s[4] == s[3] % 6 + 1);
+        REQUIRE(s[5] == s[4] % 6 + 1);
+      });
+}
+
+TEST_CASE("block bootstrap widens intervals for autocorrelated measurements") {
+  std::mt19937 rng(3);
+  std::normal_distribution<double> noise(0.0, 1.0);
+
+  Measurements measurements;
+  Times times;
+  double drift = 0.0;
+  for (std::uint64_t i = 1; i <= 200; ++i) {
+    drift = .9 * drift + noise(rng);
+    const auto per_iter = 1000.0 + 20 * drift;
+    measurements.emplace_back(i, Ns(static_cast<Ns::rep>(static_cast<double>(i) * per_iter)));
+    times.push_back(FpNs(static_cast<double>(measurements.back().duration().count()) /
+                         static_cast<double>(i)));
+  }
+  const auto config = VeloxConfig().num_resamples(2000);
+
+  const auto iid = estimate_statistics(measurements, times, config);
+  const auto blocks = estimate_statistics(
+      measurements, times, VeloxConfig(config).resample_method(ResampleMethod::stationary));
+
+  REQUIRE(blocks.mean().estimate().standard_error() >
+          1.5 * iid.mean().estimate().standard_error());
+  REQUIRE(blocks.mean().estimate().point().count() ==
+          Approx(iid.mean().estimate().point().count()));
+}
+
+TEST_CASE("adaptive resampling") {
+  const Measurements measurements{{1, Ns{105}},
+                                  {2, Ns{198}},
+                                  {3, Ns{310}},
+                                  {4, Ns{395}},
+                                  {5, Ns{512}},
+                                  {6, Ns{590}},
+                                  {7, Ns{703}},
+                                  {8, Ns{811}}};
+  Times times;
+  for (const auto &m : measurements) {
+    times.push_back(FpNs(static_cast<double>(m.duration().count()) /
+                         static_cast<double>(m.iters())));
+  }
+
+  const auto fixed = estimate_statistics(measurements, times, VeloxConfig().num_resamples(3000));
+  REQUIRE(fixed.num_resamples() == 3000);
+  REQUIRE(fixed.mean().distribution().size() == 3000);
+
+  // A loose tolerance converges as soon as it's allowed to
+  const auto loose = estimate_statistics(measurements,
+                                         times,
+                                         VeloxConfig()
+                                             .num_resamples(50000)
+                                             .adaptive_resampling(true)
+                                             .resample_tolerance(1e6)
+                                             .min_resamples(2000)
+                                             .resample_chunk_size(500));
+  REQUIRE(loose.num_resamples() == 2500);
+  REQUIRE(loose.mean().distribution().size() == 2500);
+  REQUIRE(loose.r_squared().distribution().size() == 2500);
+
+  // An impossible tolerance runs to the maximum
+  const auto strict = estimate_statistics(measurements,
+                                          times,
+                                          VeloxConfig()
+                                              .num_resamples(3000)
+                                              .adaptive_resampling(true)
+                                              .resample_tolerance(1e-12)
+                                              .min_resamples(1000)
+                                              .resample_chunk_size(1000));
+  REQUIRE(strict.num_resamples() == 3000);
+
+  // A reasonable tolerance stops somewhere in between with a sensible interval
+  const auto adaptive = estimate_statistics(
+      measurements,
+      times,
+      VeloxConfig().num_resamples(200000).adaptive_resampling(true).resample_tolerance(.05));
+  REQUIRE(adaptive.num_resamples() >= 2000);
+  REQUIRE(adaptive.num_resamples() < 200000);
+  REQUIRE(adaptive.mean().estimate().lower_bound() <= adaptive.mean().estimate().point());
+  REQUIRE(adaptive.mean().estimate().point() <= adaptive.mean().estimate().upper_bound());
+}
+
+TEST_CASE("estimate_statistics custom statistics") {
+  const Measurements measurements{{1, Ns{105}},
+                                  {2, Ns{198}},
+                                  {3, Ns{310}},
+                                  {4, Ns{395}},
+                                  {5, Ns{512}},
+                                  {6, Ns{590}},
+                                  {7, Ns{703}},
+                                  {8, Ns{811}}};
+  Times times;
+  for (const auto &m : measurements) {
+    times.push_back(FpNs(static_cast<double>(m.duration().count()) /
+                         static_cast<double>(m.iters())));
+  }
+
+  const auto config = VeloxConfig()
+                          .num_resamples(2000)
+                          .add_statistic(percentile_statistic(90))
+                          .add_statistic(coefficient_of_variation_statistic());
+  const auto statistics = estimate_statistics(measurements, times, config);
+
+  REQUIRE(statistics.custom().size() == 2);
+
+  const auto &p90 = statistics.custom()[0];
+  REQUIRE(p90.name() == "p90");
+  REQUIRE(p90.unit() == StatisticUnit::time);
+  REQUIRE(p90.distribution().size() == 2000);
+  REQUIRE(p90.estimate().point() == Approx(percentile(FpRange(times), 90)));
+  REQUIRE(p90.estimate().lower_bound() <= p90.estimate().upper_bound());
+  REQUIRE(p90.estimate().upper_bound() <= std::max_element(times.begin(), times.end())->count());
+
+  const auto &cv = statistics.custom()[1];
+  REQUIRE(cv.name() == "CV");
+  REQUIRE(cv.estimate().point() == Approx(std_dev(FpRange(times)) / mean(FpRange(times))));
+  REQUIRE(cv.estimate().lower_bound() >= 0.0);
+
+  REQUIRE(estimate_statistics(measurements, times, VeloxConfig().num_resamples(100))
+              .custom()
+              .empty());
+}
+
+TEST_CASE("estimate_statistics regression method") {
+  Measurements measurements;
+  for (std::uint64_t i = 1; i <= 20; ++i) {
+    measurements.emplace_back(i, Ns(static_cast<Ns::rep>(i * (100 + (i * 7) % 5))));
+  }
+  measurements[15] = Measurement(16, Ns(16 * 100 + 9000));
+
+  Times times;
+  for (const auto &m : measurements) {
+    times.push_back(FpNs(static_cast<double>(m.duration().count()) /
+                         static_cast<double>(m.iters())));
+  }
+
+  const auto ls = estimate_statistics(measurements, times, VeloxConfig().num_resamples(500));
+  const auto huber = estimate_statistics(
+      measurements,
+      times,
+      VeloxConfig().num_resamples(500).regression_method(RegressionMethod::huber));
+
+  REQUIRE(ls.linear_least_squares().estimate().point().count() > 120.0);
+  REQUIRE(huber.linear_least_squares().estimate().point().count() == Approx(102.0).epsilon(0.02));
+  REQUIRE(huber.linear_least_squares().estimate().upper_bound().count() < 110.0);
+
+  // The interrupted measurement is a large share of the variance whichever line is fit
+  const auto fraction = OutlierVariance(SampleSummary(times)).fraction();
+  REQUIRE(fraction > 0.1);
+  REQUIRE(ls.outlier_variance().fraction() == Approx(fraction));
+  REQUIRE(huber.outlier_variance().fraction() == Approx(fraction));
+}
+
+TEST_CASE("estimate_statistics slope and overhead") {
+  Measurements measurements;
+  for (std::uint64_t i = 1; i <= 30; ++i) {
+    measurements.emplace_back(i * 10,
+                              Ns(static_cast<Ns::rep>(5000 + i * 10 * 100 + (i % 4) * 10)));
+  }
+
+  Times times;
+  for (const auto &m : measurements) {
+    times.push_back(FpNs(static_cast<double>(m.duration().count()) /
+                         static_cast<double>(m.iters())));
+  }
+
+  const auto statistics =
+      estimate_statistics(measurements, times, VeloxConfig().num_resamples(500));
+
+  const auto &slope = statistics.slope().estimate();
+  const auto &overhead = statistics.overhead().estimate();
+  REQUIRE(slope.point().count() == Approx(100.0).epsilon(0.01));
+  REQUIRE(slope.lower_bound() <= slope.point());
+  REQUIRE(slope.point() <= slope.upper_bound());
+  REQUIRE(overhead.point().count() == Approx(5015.0).epsilon(0.01));
+  REQUIRE(overhead.lower_bound() <= overhead.point());
+  REQUIRE(overhead.point() <= overhead.upper_bound());
+
+  // The overhead is folded into LLS
+  REQUIRE(statistics.linear_least_squares().estimate().point().count() > 110.0);
+}
+
+TEST_CASE("estimate_statistics flat sampling") {
+  Measurements measurements;
+  for (std::uint64_t i = 1; i <= 10; ++i) {
+    measurements.emplace_back(4, Ns(static_cast<Ns::rep>(4000 + (i % 3) * 40)));
+  }
+
+  Times times;
+  for (const auto &m : measurements) {
+    times.push_back(FpNs(static_cast<double>(m.duration().count()) /
+                         static_cast<double>(m.iters())));
+  }
+
+  for (const auto method :
+       {RegressionMethod::least_squares, RegressionMethod::huber, RegressionMethod::theil_sen}) {
+    const auto statistics = estimate_statistics(
+        measurements, times, VeloxConfig().num_resamples(200).regression_method(method));
+
+    REQUIRE(statistics.flat_sampling());
+    REQUIRE(statistics.mean().estimate().point().count() == Approx(1010.0));
+    REQUIRE(statistics.slope().estimate().point().count() == Approx(1010.0).epsilon(0.01));
+    REQUIRE(statistics.overhead().estimate().point().count() == Approx(0.0));
+  }
+
+  measurements[0] = Measurement(5, Ns(5000));
+  REQUIRE(!estimate_statistics(measurements, times, VeloxConfig().num_resamples(100))
+               .flat_sampling());
+}
@@ -0,0 +1,65 @@
+#include "changepoint.h"
+#include "test_helpers.h"
+
+#include <random>
+
+using namespace velox;
+
+namespace {
+std::vector<double> noisy_levels(const std::vector<std::pair<std::size_t, double>> &levels) {
+  std::mt19937 rng(5);
+  std::normal_distribution<double> noise(0.0, 1.0);
+
+  std::vector<double> series;
+  for (const auto &l : levels) {
+    for (std::size_t i = 0; i < l.first; ++i) {
+      series.push_back(l.second + noise(rng));
+    }
+  }
+  return series;
+}
+}
+
+TEST_CASE("changepoints with a known variance") {
+  const std::vector<double> series{0, 0, 0, 0, 10, 10, 10, 10, 10, 8, 8, 8};
+  const std::vector<std::size_t> expected{4, 9};
+  REQUIRE(detect_changepoints(series, 1.0, 5.0) == expected);
+
+  // A larger penalty only keeps the biggest shift
+  REQUIRE(detect_changepoints(series, 1.0, 10.0) == std::vector<std::size_t>{4});
+  REQUIRE(detect_changepoints(series, 1.0, 1000.0).empty());
+}
+
+TEST_CASE("changepoints need segments of the minimum length") {
+  const std::vector<double> series{0, 0, 0, 0, 0, 10, 0, 0, 0, 0};
+  REQUIRE(detect_changepoints(series, 1.0, 10.0, 1) == (std::vector<std::size_t>{5, 6}));
+  // The spike has to share its segment with one of its neighbours
+  const auto two = detect_changepoints(series, 1.0, 10.0, 2);
+  REQUIRE(two.size() == 2);
+  REQUIRE(two[1] == two[0] + 2);
+  REQUIRE(detect_changepoints(series, 1.0, 20.0, 3).empty());
+
+  REQUIRE(detect_changepoints(std::vector<double>{1, 5, 9}, 1.0, 1.0).empty());
+  REQUIRE(detect_changepoints(std::vector<double>(), 1.0, 1.0).empty());
+}
+
+TEST_CASE("changepoints of noisy series") {
+  const auto flat = noisy_levels({{200, 100.0}});
+  REQUIRE(detect_changepoints(flat, std::vector<double>()).empty());
+
+  auto spike = flat;
+  spike[100] += 50.0;
+  REQUIRE(detect_changepoints(spike, std::vector<double>()).empty());
+
+  const auto steps = noisy_levels({{60, 100.0}, {80, 104.0}, {60, 98.0}});
+  REQUIRE(detect_changepoints(steps, std::vector<double>()) ==
+          (std::vector<std::size_t>{60, 140}));
+}
+
+TEST_CASE("changepoints fall back to the standard errors") {
+  // Most consecutive values are equal so the noise can't be estimated from the series
+  const std::vector<double> series{5, 5, 5, 5, 5, 8, 8, 8, 8, 8};
+  REQUIRE(detect_changepoints(series, std::vector<double>(10, 0.5)) ==
+          std::vector<std::size_t>{5});
+  REQUIRE(detect_changepoints(series, std::vector<double>()).empty());
+}
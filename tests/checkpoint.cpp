@@ -0,0 +1,103 @@
+#include "velox.h"
+#include "test_helpers.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace velox;
+
+namespace {
+CheckpointEntry entry(const std::string &name, const std::uint64_t iters) {
+  Measurements raw{Measurement(iters, Ns(100), Ns(0)), Measurement(2 * iters, Ns(210), Ns(150))};
+  return CheckpointEntry(
+      ItersForDurationNs(7, Ns(700)),
+      FpNs(300.5),
+      FpNs(0),
+      HistoryEntry("",
+                   name,
+                   Estimate<FpNs>(FpNs(10), FpNs(1), FpNs(8), FpNs(12), .95),
+                   FpNs(9.5),
+                   raw.size(),
+                   std::move(raw)));
+}
+}
+
+TEST_CASE("checkpoint round trip") {
+  std::ostringstream os;
+  {
+    BufferedWriter out(os);
+    write_checkpoint_entry(out, entry("a", 1));
+    write_checkpoint_entry(out, entry("b\tc", 3));
+  }
+
+  // The last line was cut short
+  const auto written = os.str();
+  std::istringstream is(written + written.substr(0, written.find('\n') - 5));
+  const auto entries = read_checkpoint(is);
+
+  REQUIRE(entries.size() == 2);
+  CHECK(entries[0].name() == "a");
+  CHECK(entries[1].name() == "b\tc");
+  CHECK(entries[1].warm_up().iters() == 7);
+  CHECK(entries[1].warm_up().duration() == Ns(700));
+  CHECK(entries[1].estimated_time().count() == 300.5);
+  CHECK(entries[1].result().mean().point().count() == 10.0);
+  CHECK(entries[1].result().median().count() == 9.5);
+  REQUIRE(entries[1].measurements().size() == 2);
+  CHECK(entries[1].measurements()[1].iters() == 6);
+  CHECK(entries[1].measurements()[1].duration() == Ns(210));
+  CHECK(entries[1].measurements()[1].start() == Ns(150));
+}
+
+TEST_CASE("resuming skips finished benchmarks") {
+  const TemporaryFile temporary("velox_checkpoint_test");
+  const auto &path = temporary.path();
+
+  auto noop = [] { optimization_barrier(0); };
+
+  // A run which was killed after its first benchmark, in the middle of writing the second
+  {
+    LoggingReporter reporter;
+    Velox<> v(reporter, quick_config().checkpoint(path));
+    v.bench("a", noop);
+  }
+  {
+    std::ofstream file(path, std::ios::app);
+    file << "1\t2\t3";
+  }
+  // The environment, the first benchmark and the partial line
+  REQUIRE(lines_in(path) == 3);
+  CHECK(read_checkpoint_environment(path) == environment_fingerprint(type_name<DefaultClock>(),
+                                                                     DefaultClock::is_steady));
+
+  std::size_t a_calls = 0;
+  LoggingReporter reporter;
+  {
+    Velox<> v(reporter, quick_config().checkpoint(path).resume(true));
+    v.bench("a", [&] { ++a_calls; });
+    v.bench("b", noop);
+  }
+
+  CHECK(a_calls == 0);
+  CHECK(reporter.names == (std::vector<std::string>{"a", "b"}));
+  CHECK(reporter.warm_ups == 1);
+  CHECK(reporter.means.size() == 2);
+
+  const auto entries = read_checkpoint(path);
+  REQUIRE(entries.size() == 2);
+  CHECK(entries[0].name() == "a");
+  CHECK(entries[1].name() == "b");
+
+  // Without resume the checkpoint starts again
+  {
+    LoggingReporter fresh;
+    Velox<> v(fresh, quick_config().checkpoint(path).deferred_analysis(true));
+    v.bench("b", noop);
+  }
+  const auto restarted = read_checkpoint(path);
+
+  REQUIRE(restarted.size() == 1);
+  CHECK(restarted[0].name() == "b");
+}
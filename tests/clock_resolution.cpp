@@ -0,0 +1,74 @@
+#include "velox.h"
+#include "test_helpers.h"
+
+using namespace velox;
+
+namespace {
+// Advances 7 ns every time it is read but only ticks every 100 ns
+struct CoarseClock {
+  using duration = std::chrono::nanoseconds;
+  using time_point = std::chrono::time_point<CoarseClock, duration>;
+  using rep = duration::rep;
+  using period = duration::period;
+  static const bool is_steady = true;
+
+  static time_point now() {
+    static rep ns = 0;
+    ns += 7;
+    return time_point(duration(ns / 100 * 100));
+  }
+};
+
+struct ShortReporter : Reporter {
+  void measurements_too_short(std::size_t n, std::size_t, FpNs) override { num_short = n; }
+
+  std::size_t num_short = 0;
+};
+}
+
+TEST_CASE("estimate clock resolution") {
+  REQUIRE(estimate_clock_resolution<CoarseClock>().count() == Approx(100.0));
+
+  const auto resolution = estimate_clock_resolution<DefaultClock>();
+  REQUIRE(resolution.count() > 0.0);
+  REQUIRE(resolution < FpNs(Ms(20)));
+}
+
+TEST_CASE("min iters for duration") {
+  REQUIRE(min_iters_for_duration(FpNs(1000.0), FpNs(10.0)) == 100);
+  REQUIRE(min_iters_for_duration(FpNs(1001.0), FpNs(10.0)) == 101);
+  REQUIRE(min_iters_for_duration(FpNs(0.0), FpNs(10.0)) == 1);
+  REQUIRE(min_iters_for_duration(FpNs(1000.0), FpNs(0.0)) == 1);
+}
+
+TEST_CASE("count short measurements") {
+  const Measurements ms{Measurement(2, Ns(50)), Measurement(4, Ns(100)), Measurement(6, Ns(150))};
+
+  REQUIRE(count_short_measurements(ms, FpNs(0.0)) == 0);
+  REQUIRE(count_short_measurements(ms, FpNs(100.0)) == 1);
+  REQUIRE(count_short_measurements(ms, FpNs(200.0)) == 3);
+}
+
+TEST_CASE("the minimum measurement duration is capped by the measurement time") {
+  // A 15 ms clock would ask for 15 s measurements
+  const auto resolution = FpNs(Ms(15));
+  const auto config =
+      VeloxConfig().warm_up_time(Ms(10)).measurement_time(Ms(100)).num_measurements(10);
+
+  ShortReporter reporter;
+  const auto result = measure<AdjustableClock>(
+      [] { AdjustableClock::add_ticks(1000); }, config, resolution, reporter);
+  REQUIRE(result.second);
+
+  Ns total(0);
+  for (const auto &m : result.first) {
+    // Each measurement gets at least its share of the measurement time
+    CHECK(m.duration() >= Ns(Ms(10)));
+    total += m.duration();
+  }
+
+  // About (10 + 1) / 4 times the measurement time, depending on how closely the warm up
+  // estimated the function's speed, rather than the minutes the full minimum would take
+  CHECK(total.count() < Ns(Ms(500)).count());
+  CHECK(reporter.num_short == result.first.size());
+}
@@ -0,0 +1,52 @@
+#include "custom_statistic.h"
+#include "stats.h"
+#include "test_helpers.h"
+
+using namespace velox;
+
+namespace {
+Times sorted_times(std::vector<double> ds) {
+  std::sort(ds.begin(), ds.end());
+
+  Times times;
+  for (const auto d : ds) {
+    times.push_back(FpNs(d));
+  }
+  return times;
+}
+}
+
+TEST_CASE("percentile statistic") {
+  const auto times = sorted_times({86, 74, 79, 79, 81, 90, 62, 70, 88});
+
+  const auto p90 = percentile_statistic(90);
+  REQUIRE(p90.name() == "p90");
+  REQUIRE(p90.unit() == StatisticUnit::time);
+  REQUIRE(p90(times) == Approx(percentile_of_sorted(FpRange(times), 90)));
+
+  const auto p999 = percentile_statistic(99.9);
+  REQUIRE(p999.name() == "p99.9");
+  REQUIRE(p999(times) == Approx(percentile_of_sorted(FpRange(times), 99.9)));
+}
+
+TEST_CASE("trimmed mean statistic") {
+  // 10 values so 10% trims exactly one from each end
+  const auto times = sorted_times({1000, 2, 3, 4, 5, 6, 7, 8, 9, -1000});
+
+  REQUIRE(trimmed_mean_statistic(0.0)(times) == Approx(mean(FpRange(times))));
+  REQUIRE(trimmed_mean_statistic(0.1)(times) == Approx(5.5));
+  REQUIRE(trimmed_mean_statistic(0.1).name() == "trimmed mean 10%");
+
+  // Never trims everything away
+  REQUIRE(trimmed_mean_statistic(0.49)(sorted_times({1, 2, 30})) == Approx(2.0));
+  REQUIRE(trimmed_mean_statistic(0.49)(sorted_times({1, 2, 4, 30})) == Approx(3.0));
+}
+
+TEST_CASE("coefficient of variation statistic") {
+  const auto times = sorted_times({86, 74, 79, 79, 81, 90, 62, 70, 88});
+  const auto cv = coefficient_of_variation_statistic();
+
+  REQUIRE(cv.unit() == StatisticUnit::ratio);
+  REQUIRE(cv(times) == Approx(std_dev(FpRange(times)) / mean(FpRange(times))));
+  REQUIRE(cv(sorted_times({5})) == Approx(0.0));
+}
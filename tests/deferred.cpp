@@ -0,0 +1,68 @@
+#include "deferred.h"
+#include "test_helpers.h"
+
+#include <string>
+#include <vector>
+
+using namespace velox;
+
+namespace {
+Measurements linear_measurements(const std::uint64_t n, const Ns::rep per_iter) {
+  Measurements ms;
+  for (std::uint64_t i = 1; i <= n; ++i) {
+    ms.emplace_back(i, Ns(static_cast<Ns::rep>(i) * per_iter));
+  }
+  return ms;
+}
+}
+
+TEST_CASE("recording reporter replays events in order") {
+  RecordingReporter recording;
+  recording.benchmark_starting("a");
+  recording.load_test_ended();
+  recording.benchmark_ended();
+
+  REQUIRE(recording.size() == 3);
+
+  LoggingReporter logging;
+  recording.replay(logging);
+  recording.replay(logging);
+
+  const std::vector<std::string> expected{"start a", "load", "end", "start a", "load", "end"};
+  REQUIRE(logging.log == expected);
+}
+
+TEST_CASE("deferred analysis reports benchmarks in the order they were measured") {
+  const auto config = VeloxConfig().num_resamples(100);
+  DeferredAnalysis deferred;
+  REQUIRE(deferred.empty());
+
+  for (const auto &name : {"a", "b", "c"}) {
+    deferred.next().benchmark_starting(name);
+    deferred.analyze_later(linear_measurements(20, name[0] == 'b' ? 200 : 100));
+  }
+  deferred.next().load_test_ended();
+  deferred.next().benchmark_starting("failed");
+
+  LoggingReporter logging;
+  deferred.run(config, logging);
+  REQUIRE(deferred.empty());
+
+  const std::vector<std::string> expected{"start a",
+                                          "measured 20",
+                                          "end",
+                                          "start b",
+                                          "measured 20",
+                                          "end",
+                                          "start c",
+                                          "measured 20",
+                                          "end",
+                                          "load",
+                                          "start failed"};
+  REQUIRE(logging.log == expected);
+
+  REQUIRE(logging.means.size() == 3);
+  REQUIRE(logging.means[0] == Approx(100.0));
+  REQUIRE(logging.means[1] == Approx(200.0));
+  REQUIRE(logging.means[2] == Approx(100.0));
+}
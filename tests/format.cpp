@@ -75,6 +75,12 @@ TEST_CASE("format_time") {
     format_time(ss, FpNs{87678348746.2295});
     REQUIRE("87.678 s" == ss.str());
   }
+
+  {
+    std::stringstream ss;
+    format_time(ss, FpNs{-2534921.412});
+    REQUIRE("-2.5349 ms" == ss.str());
+  }
 }
 
 TEST_CASE("scaler_for_time") {
@@ -119,3 +125,26 @@ TEST_CASE("js_string_escape") {
   const std::string expected("a\\'b\\\"c\\\\d");
   REQUIRE(expected == js_string_escape(unescaped));
 }
+
+TEST_CASE("decimals_for_significant_digits") {
+  REQUIRE(decimals_for_significant_digits(247.0, 6) == 3);
+  REQUIRE(decimals_for_significant_digits(0.5, 6) == 6);
+  REQUIRE(decimals_for_significant_digits(1234567.0, 6) == -1);
+  REQUIRE(decimals_for_significant_digits(0.0, 6) == 0);
+}
+
+TEST_CASE("write_deltas") {
+  const std::vector<double> values{1.5, 1.75, 1.25, 100.0};
+
+  std::stringstream ss;
+  {
+    BufferedWriter out(ss);
+    write_deltas(out, values, 2, [](const double v) { return v; });
+    out << " ";
+    write_deltas(out, values, -1, [](const double v) { return v; });
+    out << " ";
+    write_deltas(out, std::vector<double>(), 0, [](const double v) { return v; });
+  }
+
+  REQUIRE(ss.str() == "[150,25,-50,9875] [0,0,0,10] []");
+}
@@ -0,0 +1,147 @@
+#include "history.h"
+#include "trend_report.h"
+#include "benchmark.h"
+#include "test_helpers.h"
+
+#include <sstream>
+#include <string>
+
+using namespace velox;
+
+namespace {
+HistoryEntry entry(const std::string &revision, const std::string &benchmark, const double mean) {
+  return HistoryEntry(revision,
+                      benchmark,
+                      Estimate<FpNs>(FpNs(mean), FpNs(0.5), FpNs(mean - 1), FpNs(mean + 1), .95),
+                      FpNs(mean - 0.25),
+                      100);
+}
+
+std::string history_of(const std::vector<HistoryEntry> &entries) {
+  std::ostringstream os;
+  {
+    BufferedWriter out(os);
+    for (const auto &e : entries) {
+      write_history_entry(out, e);
+    }
+  }
+  return os.str();
+}
+}
+
+TEST_CASE("history round trip") {
+  Measurements raw{Measurement(1, Ns(120)), Measurement(2, Ns(230))};
+  HistoryEntry with_raw("abc\t1",
+                        "name\\with\nescapes",
+                        Estimate<FpNs>(FpNs(0.1), FpNs(1e-3), FpNs(0.09), FpNs(0.11), .99),
+                        FpNs(1.0 / 3.0),
+                        2,
+                        raw);
+
+  std::istringstream is(history_of({entry("r1", "a", 10.0), with_raw, entry("r2", "a", 12.5)}));
+  const auto histories = read_history(is);
+
+  REQUIRE(histories.size() == 2);
+  REQUIRE(histories[0].name() == "a");
+  REQUIRE(histories[0].entries().size() == 2);
+  CHECK(histories[0].entries()[0].revision() == "r1");
+  CHECK(histories[0].entries()[1].revision() == "r2");
+  CHECK(histories[0].entries()[1].mean().point() == FpNs(12.5));
+  CHECK(histories[0].entries()[1].raw_measurements().empty());
+
+  REQUIRE(histories[1].entries().size() == 1);
+  const auto &e = histories[1].entries()[0];
+  CHECK(e.revision() == "abc\t1");
+  CHECK(e.benchmark() == "name\\with\nescapes");
+  CHECK(e.mean().point().count() == 0.1);
+  CHECK(e.mean().standard_error().count() == 1e-3);
+  CHECK(e.mean().lower_bound().count() == 0.09);
+  CHECK(e.mean().upper_bound().count() == 0.11);
+  CHECK(e.mean().confidence_level() == .99);
+  CHECK(e.median().count() == 1.0 / 3.0);
+  CHECK(e.sample_size() == 2);
+  REQUIRE(e.raw_measurements().size() == 2);
+  CHECK(e.raw_measurements()[1].iters() == 2);
+  CHECK(e.raw_measurements()[1].duration() == Ns(230));
+}
+
+TEST_CASE("history skips malformed lines") {
+  const auto good = history_of({entry("r1", "a", 10.0)});
+  std::istringstream is("\n" + good + "r0\ta\t1\t2\n" + good.substr(0, good.size() - 5) + "\n" +
+                        "r0\ta\t1\t0\t2\t0.1\t1.5\t1\t10\t1:x\n" + good);
+
+  const auto histories = read_history(is);
+  REQUIRE(histories.size() == 1);
+  REQUIRE(histories[0].entries().size() == 2);
+}
+
+TEST_CASE("history with raw measurements as pairs") {
+  // Raw measurements were first written without their start times
+  std::istringstream is("r1\ta\t10\t9\t11\t0.5\t0.95\t10\t2\t1:100,2:210\n"
+                        "r2\ta\t10\t9\t11\t0.5\t0.95\t10\t2\t1:100:0,2:210:150\n"
+                        "r3\ta\t10\t9\t11\t0.5\t0.95\t10\t2\t1:100:\n");
+
+  const auto histories = read_history(is);
+  REQUIRE(histories.size() == 1);
+  const auto &entries = histories[0].entries();
+  REQUIRE(entries.size() == 2);
+
+  const auto &pairs = entries[0].raw_measurements();
+  REQUIRE(pairs.size() == 2);
+  CHECK(pairs[1].iters() == 2);
+  CHECK(pairs[1].duration() == Ns(210));
+  CHECK(pairs[1].start() == Ns(0));
+
+  const auto &triples = entries[1].raw_measurements();
+  REQUIRE(triples.size() == 2);
+  CHECK(triples[1].start() == Ns(150));
+}
+
+TEST_CASE("history reporter appends each benchmark") {
+  const TemporaryFile temporary("velox_history_test");
+  const auto &path = temporary.path();
+
+  const auto config = VeloxConfig().num_resamples(100);
+  Measurements measurements;
+  for (std::uint64_t i = 1; i <= 20; ++i) {
+    measurements.emplace_back(i, Ns(static_cast<Ns::rep>(i) * 100));
+  }
+
+  for (const auto &revision : {"r1", "r2"}) {
+    HistoryReporter reporter(path, revision, revision[1] == '2');
+    reporter.benchmark_starting("a");
+    analyze(measurements, config, reporter);
+    reporter.benchmark_ended();
+  }
+
+  const auto histories = read_history(path);
+
+  REQUIRE(histories.size() == 1);
+  const auto &entries = histories[0].entries();
+  REQUIRE(entries.size() == 2);
+  CHECK(entries[0].revision() == "r1");
+  CHECK(entries[0].mean().point().count() == Approx(100.0));
+  CHECK(entries[0].median().count() == Approx(100.0));
+  CHECK(entries[0].sample_size() == 20);
+  CHECK(entries[0].raw_measurements().empty());
+  CHECK(entries[1].revision() == "r2");
+  CHECK(entries[1].raw_measurements().size() == 20);
+}
+
+TEST_CASE("trend report") {
+  BenchmarkHistory history("it's");
+  const double means[] = {10, 11, 10, 11, 10, 11, 20, 21, 20, 21, 20, 21};
+  for (std::size_t i = 0; i < 12; ++i) {
+    history.add(entry("r" + std::to_string(i), "it's", means[i]));
+  }
+
+  std::ostringstream os;
+  write_trend_report(os, {history});
+  const auto html = os.str();
+
+  CHECK(html.find("name : 'it\\'s'") != std::string::npos);
+  CHECK(html.find("revisions : ['r0', 'r1', 'r2'") != std::string::npos);
+  CHECK(html.find("means : [10, 11, 10") != std::string::npos);
+  CHECK(html.find("changepoints : [6]") != std::string::npos);
+  CHECK(html.find("</html>") != std::string::npos);
+}
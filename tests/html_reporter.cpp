@@ -0,0 +1,56 @@
+#include "velox.h"
+#include "test_helpers.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace velox;
+
+namespace {
+std::string contents(const std::string &path) {
+  std::ifstream file(path);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+std::string file_name(const std::string &path) {
+  const auto separator = path.find_last_of("/\\");
+  return separator == std::string::npos ? path : path.substr(separator + 1);
+}
+}
+
+TEST_CASE("split html report") {
+  const TemporaryFile index("velox_split_report", ".html");
+  const TemporaryFile first(index, "_1.js"), second(index, "_2.js");
+
+  HtmlReporter html(index.path());
+  {
+    const auto config = VeloxConfig()
+                            .warm_up_time(Ms(10))
+                            .measurement_time(Ms(20))
+                            .num_measurements(10)
+                            .num_resamples(100);
+    Velox<> v(html, config);
+    v.bench("first benchmark", [] { optimization_barrier(0); });
+    v.bench("second benchmark", [] { optimization_barrier(1); });
+  }
+  REQUIRE(html.good());
+
+  const auto page = contents(index.path());
+  CHECK(page.find("file : '" + file_name(first.path()) + "'") != std::string::npos);
+  CHECK(page.find("file : '" + file_name(second.path()) + "'") != std::string::npos);
+  CHECK(page.find("name : 'first benchmark'") != std::string::npos);
+
+  const auto first_data = contents(first.path());
+  CHECK(first_data.find("veloxBenchmarkLoaded('benchmark_1'") == 0);
+  CHECK(first_data.find("name : 'first benchmark'") != std::string::npos);
+
+  const auto second_data = contents(second.path());
+  CHECK(second_data.find("veloxBenchmarkLoaded('benchmark_2'") == 0);
+  CHECK(second_data.find("name : 'second benchmark'") != std::string::npos);
+}
+
+TEST_CASE("split html report which can't be written") {
+  HtmlReporter html("velox_no_such_directory/report.html");
+  CHECK_FALSE(html.good());
+}
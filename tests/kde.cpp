@@ -1,6 +1,8 @@
 #include "kde.h"
 #include "test_helpers.h"
 
+#include <random>
+
 using namespace velox;
 
 TEST_CASE("standard normal probability density function") {
@@ -70,3 +72,83 @@ TEST_CASE("kde") {
                                     {8.4399, .00082}};
   REQUIRE(expected == points);
 }
+
+namespace {
+// A bimodal sample with a long tail, like a benchmark which occasionally gets descheduled
+Times kde_test_sample(const std::size_t n) {
+  std::mt19937 rng(7);
+  std::normal_distribution<double> fast(100.0, 5.0), slow(130.0, 10.0);
+  std::exponential_distribution<double> tail(1.0 / 50.0);
+  std::uniform_real_distribution<double> which(0.0, 1.0);
+
+  Times times;
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto w = which(rng);
+    times.push_back(FpNs(w < .7 ? fast(rng) : w < .95 ? slow(rng) : 150.0 + tail(rng)));
+  }
+  return times;
+}
+
+double max_abs_difference(const Points &lhs, const Points &rhs) {
+  REQUIRE(lhs.size() == rhs.size());
+
+  double diff = 0.0;
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    REQUIRE(lhs[i].x() == Approx(rhs[i].x()));
+    diff = (std::max)(diff, std::abs(lhs[i].y() - rhs[i].y()));
+  }
+  return diff;
+}
+
+double max_density(const Points &points) {
+  double m = 0.0;
+  for (const auto &p : points) {
+    m = (std::max)(m, p.y());
+  }
+  return m;
+}
+}
+
+TEST_CASE("exp nonpositive") {
+  for (double x = -700.0; x <= 0.0; x += 0.37) {
+    REQUIRE(std::abs(detail::exp_nonpositive(x) - std::exp(x)) <= 1e-13 * std::exp(x));
+  }
+  REQUIRE(detail::exp_nonpositive(0.0) == Approx(1.0));
+}
+
+TEST_CASE("kde truncated matches exact") {
+  const auto sample = kde_test_sample(3000);
+
+  const auto exact = kde_exact(sample, DEFAULT_KDE_POINTS);
+  const auto truncated = kde_truncated(sample, DEFAULT_KDE_POINTS);
+
+  REQUIRE(max_abs_difference(exact, truncated) <= 1e-9 * max_density(exact));
+}
+
+TEST_CASE("kde binned matches exact") {
+  for (const auto n : {std::size_t(50), std::size_t(2000), std::size_t(20000)}) {
+    const auto sample = kde_test_sample(n);
+
+    const auto exact = kde_exact(sample, DEFAULT_KDE_POINTS);
+    const auto binned = kde_binned(sample, DEFAULT_KDE_POINTS);
+
+    REQUIRE(max_abs_difference(exact, binned) <= 1e-3 * max_density(exact));
+  }
+}
+
+TEST_CASE("kde picks an implementation by size") {
+  const std::vector<FpNs> small{FpNs{1}, FpNs{2}, FpNs{3}, FpNs{4}, FpNs{5}};
+  REQUIRE(max_abs_difference(kde(small, 8), kde_exact(small, 8)) == 0.0);
+
+  const auto medium = kde_test_sample(2000);
+  REQUIRE(max_abs_difference(kde(medium, DEFAULT_KDE_POINTS),
+                             kde_truncated(medium, DEFAULT_KDE_POINTS)) == 0.0);
+
+  const auto large = kde_test_sample(KDE_BINNED_MIN_SIZE);
+  REQUIRE(max_abs_difference(kde(large, DEFAULT_KDE_POINTS),
+                             kde_binned(large, DEFAULT_KDE_POINTS)) == 0.0);
+
+  // A sample without any spread can't be binned
+  const Times constant(20000, FpNs{5});
+  REQUIRE(kde(constant, DEFAULT_KDE_POINTS).size() == DEFAULT_KDE_POINTS);
+}
@@ -0,0 +1,94 @@
+#include "load.h"
+#include "test_helpers.h"
+
+using namespace velox;
+
+TEST_CASE("fixed arrivals") {
+  const auto offsets = arrival_offsets(1000.0, Ms(10), ArrivalProcess::fixed, 0);
+
+  REQUIRE(offsets.size() == 10);
+  for (std::size_t i = 0; i < offsets.size(); ++i) {
+    REQUIRE(offsets[i].count() == static_cast<Ns::rep>(i * 1000000));
+  }
+}
+
+TEST_CASE("poisson arrivals") {
+  const auto offsets = arrival_offsets(10000.0, Ms(1000), ArrivalProcess::poisson, 5);
+
+  REQUIRE(static_cast<double>(offsets.size()) == Approx(10000.0).epsilon(0.05));
+  REQUIRE(std::is_sorted(offsets.begin(), offsets.end()));
+  REQUIRE(offsets == arrival_offsets(10000.0, Ms(1000), ArrivalProcess::poisson, 5));
+
+  // Exponential gaps have a standard deviation equal to their mean
+  Times gaps;
+  for (std::size_t i = 1; i < offsets.size(); ++i) {
+    gaps.push_back(FpNs(static_cast<double>((offsets[i] - offsets[i - 1]).count())));
+  }
+  REQUIRE(mean(FpRange(gaps)) == Approx(100000.0).epsilon(0.05));
+  REQUIRE(std_dev(FpRange(gaps)) == Approx(100000.0).epsilon(0.1));
+}
+
+TEST_CASE("load point") {
+  const LoadPoint point(100.0, 90.0, {FpNs(3), FpNs(1), FpNs(2)}, {FpNs(2), FpNs(1), FpNs(1)});
+
+  REQUIRE(point.num_requests() == 3);
+  REQUIRE(point.latency(50).count() == Approx(2.0));
+  REQUIRE(point.max_latency().count() == Approx(3.0));
+  REQUIRE(point.service_time(50).count() == Approx(1.0));
+  REQUIRE(std::is_sorted(point.latencies().begin(), point.latencies().end()));
+}
+
+// AdjustableClock only moves when a request takes time or run_load waits for the next one, so
+// the latencies are exact
+TEST_CASE("run load") {
+  std::atomic<int> calls(0);
+  const auto config =
+      LoadConfig().duration(Ms(100)).num_threads(1).arrival_process(ArrivalProcess::fixed);
+  const auto point = run_load<AdjustableClock>(
+      [&calls] {
+        ++calls;
+        AdjustableClock::add_ticks(100000);
+      },
+      1000.0,
+      config);
+
+  REQUIRE(calls == 100);
+  REQUIRE(point.num_requests() == 100);
+  REQUIRE(point.throughput() == Approx(1000.0));
+  REQUIRE(point.latency(50).count() == Approx(100000.0));
+  REQUIRE(point.max_latency().count() == Approx(100000.0));
+}
+
+TEST_CASE("run load corrects for coordinated omission") {
+  // One request stalls for 50 ms, the ones scheduled behind it have to wait
+  std::atomic<int> calls(0);
+  const auto config =
+      LoadConfig().duration(Ms(200)).num_threads(1).arrival_process(ArrivalProcess::fixed);
+  const auto point = run_load<AdjustableClock>(
+      [&calls] {
+        AdjustableClock::add_ticks(++calls == 50 ? 50000000 : 100000);
+      },
+      1000.0,
+      config);
+
+  REQUIRE(point.num_requests() == 200);
+
+  // Closed loop timing only sees the one slow call
+  REQUIRE(point.service_time(90).count() == Approx(100000.0));
+  REQUIRE(point.max_latency().count() == Approx(50e6));
+
+  // Roughly 50 requests were queued behind it
+  REQUIRE(point.latency(90) > FpNs(Ms(10)));
+  REQUIRE(point.latency(50).count() == Approx(100000.0));
+}
+
+TEST_CASE("run load on a real clock") {
+  std::atomic<int> calls(0);
+  const auto config =
+      LoadConfig().duration(Ms(20)).num_threads(2).arrival_process(ArrivalProcess::fixed);
+  const auto point = run_load<DefaultClock>([&calls] { ++calls; }, 1000.0, config);
+
+  REQUIRE(calls == 20);
+  REQUIRE(point.num_requests() == 20);
+  REQUIRE(point.throughput() > 0.0);
+}
@@ -0,0 +1,87 @@
+// Built without assertions, like a release build, so checks which have to hold there are tested
+#ifndef NDEBUG
+#error "These tests must be built with NDEBUG defined"
+#endif
+
+#include "velox.h"
+#include "test_helpers.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace velox;
+
+namespace {
+const std::vector<std::string> names{"a", "b", "c", "d", "e", "f"};
+
+// Replaces the environment a checkpoint starts with
+void rewrite_environment(const std::string &path, const std::string &environment) {
+  std::stringstream rest;
+  {
+    std::ifstream file(path);
+    std::string first;
+    std::getline(file, first);
+    rest << file.rdbuf();
+  }
+
+  std::ofstream file(path, std::ios::trunc);
+  file << "#environment\t" << environment << "\n" << rest.str();
+}
+
+std::size_t merge(const std::vector<std::string> &paths,
+                  VeloxConfig config,
+                  LoggingReporter &reporter) {
+  std::size_t calls = 0;
+  Velox<> v(reporter, config.merge(paths));
+  for (const auto &name : names) {
+    v.bench(name, [&] { optimization_barrier(++calls); });
+  }
+  return calls;
+}
+}
+
+TEST_CASE("shards from another environment aren't merged without assertions") {
+  const TemporaryFile first("velox_merge_release_test"), second("velox_merge_release_test");
+  const std::vector<std::string> paths{first.path(), second.path()};
+
+  for (std::uint32_t index = 0; index < 2; ++index) {
+    LoggingReporter reporter;
+    Velox<> v(reporter, quick_config().shard(index, 2).checkpoint(paths[index]));
+    for (const auto &name : names) {
+      v.bench(name, [] { optimization_barrier(0); });
+    }
+  }
+
+  {
+    LoggingReporter matching;
+    CHECK(merge(paths, quick_config(), matching) == 0);
+    CHECK(matching.refused.empty());
+  }
+
+  rewrite_environment(paths[1], "somewhere else");
+
+  {
+    // The matching shard is merged and the other one's benchmarks are left out, not run again
+    LoggingReporter refused;
+    CHECK(merge(paths, quick_config(), refused) == 0);
+    for (const auto &name : names) {
+      const auto reported = std::find(refused.names.begin(), refused.names.end(), name);
+      CHECK((reported != refused.names.end()) == in_shard(name, 0, 2));
+    }
+    REQUIRE(refused.refused.size() == 1);
+    CHECK(refused.refused[0] == paths[1]);
+    CHECK(refused.refused_environment == "somewhere else");
+    CHECK(refused.this_environment == environment_fingerprint(type_name<DefaultClock>(),
+                                                              DefaultClock::is_steady));
+  }
+
+  {
+    LoggingReporter forced;
+    CHECK(merge(paths, quick_config().force_merge(true), forced) == 0);
+    CHECK(forced.refused.empty());
+    CHECK(forced.names == names);
+  }
+}
@@ -0,0 +1,180 @@
+#include "offline_analysis.h"
+#include "velox.h"
+#include "test_helpers.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace velox;
+
+namespace {
+std::vector<Ns::rep> durations(const Measurements &measurements) {
+  std::vector<Ns::rep> ds;
+  for (const auto &m : measurements) {
+    ds.push_back(m.duration().count());
+  }
+  return ds;
+}
+}
+
+TEST_CASE("mapped file") {
+  const TemporaryFile temporary("velox_mapped_file_test", ".txt");
+  const auto &path = temporary.path();
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << "first\nsecond\n";
+  }
+
+  {
+    MappedFile mapped(path);
+    REQUIRE(mapped.is_open());
+    CHECK(std::string(mapped.data(), mapped.size()) == "first\nsecond\n");
+
+    MemoryBuffer buffer(mapped.data(), mapped.size());
+    std::istream is(&buffer);
+    std::string line;
+    REQUIRE(std::getline(is, line));
+    REQUIRE(std::getline(is, line));
+    CHECK(line == "second");
+
+    is.clear();
+    REQUIRE(is.seekg(1));
+    REQUIRE(std::getline(is, line));
+    CHECK(line == "irst");
+    CHECK(is.seekg(-2, std::ios::end).tellg() == 11);
+    CHECK_FALSE(is.seekg(100));
+  }
+
+  const TemporaryFile missing("velox_mapped_file_test", ".txt");
+  CHECK_FALSE(MappedFile(missing.path()).is_open());
+}
+
+TEST_CASE("latency csv") {
+  const std::string csv = "request,latency\n"
+                          "a, 1.5\r\n"
+                          "b,2\n"
+                          "c,oops\n"
+                          "d,-1\n"
+                          "\n"
+                          "e,3e1";
+
+  const auto config = LatencyLogConfig().column(1).ns_per_unit(1000);
+  const auto measurements = read_latency_csv(csv.data(), csv.size(), config);
+  CHECK(durations(measurements) == (std::vector<Ns::rep>{1500, 2000, 30000}));
+  CHECK(is_flat(measurements));
+  CHECK(measurements[0].iters() == 1);
+
+  CHECK(read_latency_csv(csv.data(), csv.size(), LatencyLogConfig()).empty());
+  CHECK(read_latency_csv(nullptr, 0, config).empty());
+
+  const auto batched = read_latency_csv(csv.data(), csv.size(), LatencyLogConfig(config).batch(2));
+  REQUIRE(batched.size() == 1);
+  CHECK(batched[0].iters() == 2);
+  CHECK(batched[0].duration() == Ns(3500));
+}
+
+TEST_CASE("latency csv parsed in parallel") {
+  std::string csv;
+  std::vector<Ns::rep> expected;
+  for (Ns::rep i = 0; i < 20000; ++i) {
+    csv += std::to_string(i) + "\n";
+    expected.push_back(i);
+  }
+
+  for (const std::uint32_t threads : {1u, 2u, 3u, 7u}) {
+    const auto config = LatencyLogConfig().num_threads(threads);
+    CHECK(durations(read_latency_csv(csv.data(), csv.size(), config)) == expected);
+  }
+}
+
+TEST_CASE("latency binary") {
+  const std::uint64_t latencies[] = {10, 20, 30};
+  std::string binary(reinterpret_cast<const char *>(latencies), sizeof(latencies));
+  binary += "xyz";
+
+  const auto measurements = read_latency_binary(binary.data(), binary.size(), LatencyLogConfig());
+  CHECK(durations(measurements) == (std::vector<Ns::rep>{10, 20, 30}));
+}
+
+TEST_CASE("offline analysis of a checkpoint") {
+  const TemporaryFile temporary("velox_offline_test");
+  const auto &path = temporary.path();
+  auto noop = [] { optimization_barrier(0); };
+  {
+    LoggingReporter reporter;
+    Velox<> v(reporter, quick_config().checkpoint(path));
+    v.bench("a", noop);
+    v.bench("b", noop);
+  }
+
+  LoggingReporter reporter;
+  {
+    MappedFile mapped(path);
+    MemoryBuffer buffer(mapped.data(), mapped.size());
+    std::istream is(&buffer);
+
+    OfflineAnalysis analysis;
+    REQUIRE(analysis.add_results(is));
+
+    std::istringstream latencies("1\n2\n3\n4\n5\n6\n7\n8\n9\n10\n");
+    CHECK_FALSE(analysis.add_results(latencies));
+
+    const auto csv = latencies.str();
+    analysis.add("latencies", read_latency_csv(csv.data(), csv.size(), LatencyLogConfig()));
+    analysis.run(quick_config().confidence_level(.99), reporter);
+  }
+
+  CHECK(reporter.suite == "stored measurements");
+  CHECK(reporter.names == (std::vector<std::string>{"a", "b", "latencies"}));
+  // Nothing is warmed up again
+  CHECK(reporter.warm_ups == 0);
+  CHECK(reporter.sizes.size() == 3);
+  CHECK(reporter.sizes[2] == 10);
+  REQUIRE(reporter.means.size() == 3);
+  CHECK(reporter.means[2] == Approx(5.5));
+  CHECK(reporter.ended);
+}
+
+TEST_CASE("offline analysis of a history with raw measurements") {
+  const TemporaryFile temporary("velox_offline_test");
+  {
+    std::ofstream file(temporary.path());
+    BufferedWriter out(file);
+    const Estimate<FpNs> mean(FpNs(10), FpNs(1), FpNs(8), FpNs(12), .95);
+    write_history_entry(out, HistoryEntry("r1", "a", mean, FpNs(10), 3, Measurements{
+        Measurement(1, Ns(1)), Measurement(1, Ns(2)), Measurement(1, Ns(3))}));
+    write_history_entry(out, HistoryEntry("r2", "a", mean, FpNs(10), 3));
+    write_history_entry(out, HistoryEntry("r2", "b", mean, FpNs(10), 3));
+  }
+
+  // Read the way velox_analyze reads it, which has to go back to the start after looking for a
+  // checkpoint
+  const MappedFile mapped(temporary.path());
+  MemoryBuffer buffer(mapped.data(), mapped.size());
+  std::istream is(&buffer);
+  OfflineAnalysis analysis;
+  REQUIRE(analysis.add_results(is));
+
+  LoggingReporter reporter;
+  analysis.run(quick_config(), reporter);
+  CHECK(reporter.names == (std::vector<std::string>{"a"}));
+  REQUIRE(reporter.means.size() == 1);
+  CHECK(reporter.means[0] == Approx(2.0));
+}
+
+TEST_CASE("offline analysis of a latency log in an html report") {
+  const std::string csv = "1\n2\n3\n4\n5\n6\n7\n8\n9\n10\n";
+  OfflineAnalysis analysis;
+  analysis.add("latencies", read_latency_csv(csv.data(), csv.size(), LatencyLogConfig()));
+
+  std::ostringstream os;
+  HtmlReporter html(os);
+  analysis.run(quick_config(), html);
+
+  const auto page = os.str();
+  CHECK(page.find("benchmark_1 : {") != std::string::npos);
+  CHECK(page.find("name : 'latencies'") != std::string::npos);
+  CHECK(page.find("benchmark_2") == std::string::npos);
+}
@@ -42,9 +42,27 @@ TEST_CASE("outliers") {
   REQUIRE(thresholds.low_mild().count() == Approx(-1.396842));
   REQUIRE(thresholds.low_severe().count() == Approx(-3.2139045));
 
-  REQUIRE(outliers.high_severe() == high_severe);
-  REQUIRE(outliers.high_mild() == high_mild);
-  REQUIRE(outliers.low_mild() == low_mild);
-  REQUIRE(outliers.low_severe() == low_severe);
-  REQUIRE(outliers.normal() == normal);
+  REQUIRE(outliers.size() == sample.size());
+  REQUIRE(outliers.count(OutlierSeverity::high_severe) == high_severe.size());
+  REQUIRE(outliers.count(OutlierSeverity::high_mild) == high_mild.size());
+  REQUIRE(outliers.count(OutlierSeverity::low_mild) == low_mild.size());
+  REQUIRE(outliers.count(OutlierSeverity::low_severe) == low_severe.size());
+  REQUIRE(outliers.count(OutlierSeverity::normal) == normal.size());
+  REQUIRE(outliers.num_outliers() == 4);
+
+  // The severities are in the same order as the sample
+  const std::vector<OutlierSeverity> expected{OutlierSeverity::high_severe,
+                                              OutlierSeverity::high_mild,
+                                              OutlierSeverity::low_mild,
+                                              OutlierSeverity::low_severe,
+                                              OutlierSeverity::normal,
+                                              OutlierSeverity::normal,
+                                              OutlierSeverity::normal,
+                                              OutlierSeverity::normal,
+                                              OutlierSeverity::normal,
+                                              OutlierSeverity::normal};
+  REQUIRE(outliers.severities() == expected);
+  for (std::size_t i = 0; i < sample.size(); ++i) {
+    REQUIRE(outliers.severity(i) == outliers.classify(sample[i]));
+  }
 }
@@ -0,0 +1,42 @@
+#include "point.h"
+#include "kde.h"
+#include "test_helpers.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace velox;
+
+TEST_CASE("thin_points") {
+  // Collinear points are dropped, corners are kept
+  const Points line{Point(0, 0), Point(1, 1), Point(2, 2), Point(3, 3), Point(4, 2), Point(5, 1)};
+  const auto thinned = thin_points(line, 1e-9);
+
+  REQUIRE(thinned.size() == 3);
+  REQUIRE(thinned[0].x() == Approx(0.0));
+  REQUIRE(thinned[1].x() == Approx(3.0));
+  REQUIRE(thinned[2].x() == Approx(5.0));
+
+  // Every dropped point is within the tolerance of the thinned curve
+  Points curve;
+  for (int i = 0; i < 400; ++i) {
+    const auto x = i / 40.0;
+    curve.emplace_back(x, snpdf(x - 5.0));
+  }
+
+  const auto tolerance = snpdf(0) / 500.0;
+  const auto thinned_curve = thin_points(curve, tolerance);
+  REQUIRE(thinned_curve.size() < curve.size() / 2);
+
+  std::size_t segment = 0;
+  double worst = 0.0;
+  for (const auto &p : curve) {
+    while (thinned_curve[segment + 1].x() < p.x()) {
+      ++segment;
+    }
+    const auto &a = thinned_curve[segment], &b = thinned_curve[segment + 1];
+    const auto y = a.y() + (b.y() - a.y()) * (p.x() - a.x()) / (b.x() - a.x());
+    worst = (std::max)(worst, std::abs(y - p.y()));
+  }
+  REQUIRE(worst <= tolerance);
+}
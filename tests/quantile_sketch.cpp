@@ -0,0 +1,74 @@
+#include "quantile_sketch.h"
+#include "stats.h"
+#include "test_helpers.h"
+
+#include <random>
+
+using namespace velox;
+
+TEST_CASE("quantile sketch exact before compaction") {
+  const std::vector<double> sample{86, 74, 79, 79, 81};
+
+  QuantileSketch<double> sketch(16);
+  for (const auto d : sample) {
+    sketch.add(d);
+  }
+
+  auto sorted = sample;
+  std::sort(sorted.begin(), sorted.end());
+
+  REQUIRE(sketch.count() == 5);
+  REQUIRE(sketch.retained() == 5);
+  REQUIRE(sketch.mean() == Approx(mean(sample)));
+  REQUIRE(sketch.std_dev() == Approx(std_dev(sample)));
+  REQUIRE(sketch.percentile(2.5) == Approx(percentile_of_sorted(sorted, 2.5)));
+  REQUIRE(sketch.percentile(50) == Approx(percentile_of_sorted(sorted, 50)));
+  REQUIRE(sketch.percentile(90) == Approx(percentile_of_sorted(sorted, 90)));
+  REQUIRE(sketch.percentile(100) == Approx(percentile_of_sorted(sorted, 100)));
+}
+
+TEST_CASE("quantile sketch bounded memory") {
+  std::mt19937 rng(42);
+  std::normal_distribution<double> normal(1000.0, 50.0);
+
+  const std::uint32_t n = 100000;
+  auto sample = vector_with_capacity<double>(n);
+
+  QuantileSketch<FpNs> sketch(256);
+  for (std::uint32_t i = 0; i < n; ++i) {
+    const auto d = normal(rng);
+    sample.push_back(d);
+    sketch.add(FpNs(d));
+  }
+
+  std::sort(sample.begin(), sample.end());
+
+  REQUIRE(sketch.count() == n);
+  REQUIRE(sketch.retained() < 256 * 12);
+  REQUIRE(sketch.mean().count() == Approx(mean(sample)));
+  REQUIRE(sketch.std_dev().count() == Approx(std_dev(sample)));
+
+  for (const auto p : {2.5, 25.0, 50.0, 75.0, 97.5}) {
+    const auto v = sketch.percentile(p).count();
+    const auto rank = std::lower_bound(sample.begin(), sample.end(), v) - sample.begin();
+    const auto actual_p = 100.0 * static_cast<double>(rank) / static_cast<double>(n);
+    CHECK(std::abs(actual_p - p) < 1.0);
+  }
+}
+
+TEST_CASE("quantile sketch merge") {
+  QuantileSketch<double> lhs(8), rhs(8), all(8);
+
+  for (int i = 0; i < 100; ++i) {
+    const auto d = static_cast<double>(i);
+    (i % 2 == 0 ? lhs : rhs).add(d);
+    all.add(d);
+  }
+
+  lhs.merge(rhs);
+
+  REQUIRE(lhs.count() == all.count());
+  REQUIRE(lhs.mean() == Approx(all.mean()));
+  REQUIRE(lhs.std_dev() == Approx(all.std_dev()));
+  REQUIRE(std::abs(lhs.percentile(50) - 49.5) < 10);
+}
@@ -309,3 +309,48 @@ TEST_CASE("regression 3") {
   REQUIRE(0.002068 == Approx(sl));
   REQUIRE(0.99966 == Approx(r2));
 }
+
+TEST_CASE("regression with intercept") {
+  Points points;
+  for (int i = 1; i <= 20; ++i) {
+    points.emplace_back(i, 50.0 + 3.0 * i + (i % 2 ? 0.5 : -0.5));
+  }
+
+  const auto line = ols_line(points);
+  REQUIRE(line.slope() == Approx(3.0).epsilon(0.01));
+  REQUIRE(line.intercept() == Approx(50.0).epsilon(0.01));
+  REQUIRE(line(10.0) == Approx(line.intercept() + 10.0 * line.slope()));
+  REQUIRE(r_squared(points, line) > 0.99);
+
+  // Through the origin folds the intercept into the slope
+  REQUIRE(slope(points) > 5.0);
+
+  const auto huber = huber_line(points);
+  REQUIRE(huber.slope() == Approx(3.0).epsilon(0.01));
+  REQUIRE(huber.intercept() == Approx(50.0).epsilon(0.02));
+
+  const auto theil_sen = theil_sen_line(points);
+  REQUIRE(theil_sen.slope() == Approx(3.0).epsilon(0.01));
+  REQUIRE(theil_sen.intercept() == Approx(50.0).epsilon(0.02));
+}
+
+TEST_CASE("robust regression with intercept") {
+  Points points;
+  for (int i = 1; i <= 20; ++i) {
+    points.emplace_back(i, 50.0 + 3.0 * i + (i % 2 ? 0.5 : -0.5));
+  }
+  points[17] = Point(18, 500.0);
+
+  REQUIRE(std::abs(ols_line(points).slope() - 3.0) > 1.0);
+  REQUIRE(huber_line(points).slope() == Approx(3.0).epsilon(0.05));
+  REQUIRE(theil_sen_line(points).slope() == Approx(3.0).epsilon(0.05));
+  REQUIRE(theil_sen_line(points).intercept() == Approx(50.0).epsilon(0.05));
+}
+
+TEST_CASE("regression with intercept identical x") {
+  const Points points{Point{2, 4}, Point{2, 6}};
+  const auto line = ols_line(points);
+
+  REQUIRE(line.intercept() == Approx(0.0));
+  REQUIRE(line.slope() == Approx(slope(points)));
+}
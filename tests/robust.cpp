@@ -0,0 +1,125 @@
+#include "robust.h"
+#include "velox.h"
+#include "test_helpers.h"
+
+using namespace velox;
+
+namespace {
+Measurements robust_test_measurements() {
+  Measurements ms;
+  for (std::uint64_t i = 1; i <= 20; ++i) {
+    ms.emplace_back(i, Ns(static_cast<Ns::rep>(i * (100 + (i * 7) % 5))));
+  }
+
+  // Interrupted twice
+  ms[7] = Measurement(8, Ns(8 * 100 + 5000));
+  ms[15] = Measurement(16, Ns(16 * 100 + 9000));
+  return ms;
+}
+
+Times robust_test_times(const Measurements &ms) {
+  Times times;
+  for (const auto &m : ms) {
+    times.push_back(
+        FpNs(static_cast<double>(m.duration().count()) / static_cast<double>(m.iters())));
+  }
+  return times;
+}
+
+struct StatisticsReporter : Reporter {
+  void estimate_statistics_ended(const EstimatedStatistics &s) override {
+    outlier_variance = s.outlier_variance().fraction();
+  }
+
+  double outlier_variance = -1.0;
+};
+}
+
+TEST_CASE("apply outlier policy") {
+  const auto ms = robust_test_measurements();
+  const auto times = robust_test_times(ms);
+  const Outliers outliers(times);
+
+  REQUIRE(outliers.severity(7) == OutlierSeverity::high_severe);
+  REQUIRE(outliers.severity(15) == OutlierSeverity::high_severe);
+  REQUIRE(outliers.num_outliers() == 2);
+
+  const auto kept = apply_outlier_policy(ms, times, outliers, OutlierPolicy::keep);
+  REQUIRE(kept.times() == times);
+  REQUIRE(kept.measurements().size() == ms.size());
+  REQUIRE(kept.num_adjusted() == 0);
+
+  const auto excluded = apply_outlier_policy(ms, times, outliers, OutlierPolicy::exclude);
+  REQUIRE(excluded.times().size() == 18);
+  REQUIRE(excluded.measurements().size() == 18);
+  REQUIRE(excluded.num_adjusted() == 2);
+  REQUIRE(excluded.measurements()[7].iters() == 9);
+
+  const auto winsorized = apply_outlier_policy(ms, times, outliers, OutlierPolicy::winsorize);
+  REQUIRE(winsorized.times().size() == 20);
+  REQUIRE(winsorized.num_adjusted() == 2);
+  REQUIRE(winsorized.times()[7] == outliers.thresholds().high_severe());
+  REQUIRE(winsorized.times()[15] == outliers.thresholds().high_severe());
+  REQUIRE(static_cast<double>(winsorized.measurements()[15].duration().count()) ==
+          Approx(outliers.thresholds().high_severe().count() * 16).epsilon(1e-3));
+  REQUIRE(winsorized.times()[3] == times[3]);
+}
+
+TEST_CASE("robust slopes") {
+  Points line;
+  for (int i = 1; i <= 20; ++i) {
+    line.emplace_back(i, 3.0 * i);
+  }
+
+  REQUIRE(fit_slope(line, RegressionMethod::least_squares) == Approx(3.0));
+  REQUIRE(fit_slope(line, RegressionMethod::huber) == Approx(3.0));
+  REQUIRE(fit_slope(line, RegressionMethod::theil_sen) == Approx(3.0));
+
+  const auto points = measurements_to_points(robust_test_measurements());
+
+  // The interrupted measurements drag least squares well away from ~102 ns per iteration
+  REQUIRE(slope(points) > 130.0);
+  REQUIRE(huber_slope(points) == Approx(102.0).epsilon(0.02));
+  REQUIRE(theil_sen_slope(points) == Approx(102.0).epsilon(0.02));
+}
+
+TEST_CASE("outlier variance") {
+  const OutlierVariance tight(FpNs(100), FpNs(0.1), 100);
+  REQUIRE(tight.fraction() < 0.01);
+  REQUIRE(tight.effect() == OutlierEffect::unaffected);
+
+  const OutlierVariance noisy(FpNs(100), FpNs(50), 100);
+  REQUIRE(noisy.fraction() > 0.5);
+  REQUIRE(noisy.effect() == OutlierEffect::severe);
+
+  const OutlierVariance none(FpNs(100), FpNs(0), 100);
+  REQUIRE(none.fraction() == 0.0);
+
+  // More variance can only be explained by more outliers
+  double previous = 0.0;
+  for (const auto sd : {0.5, 1.0, 2.0, 5.0, 10.0, 20.0}) {
+    const OutlierVariance ov(FpNs(100), FpNs(sd), 100);
+    REQUIRE(ov.fraction() >= previous);
+    previous = ov.fraction();
+  }
+  REQUIRE(std::string(outlier_effect_name(OutlierEffect::moderate)) == "moderate");
+}
+
+TEST_CASE("outlier variance describes the sample before the outlier policy") {
+  const auto ms = robust_test_measurements();
+  const auto times = robust_test_times(ms);
+  const Outliers outliers(times);
+
+  const auto whole = OutlierVariance(SampleSummary(times)).fraction();
+  const auto excluded = apply_outlier_policy(ms, times, outliers, OutlierPolicy::exclude);
+  REQUIRE(OutlierVariance(SampleSummary(excluded.times())).fraction() < whole);
+
+  for (const auto policy : {OutlierPolicy::exclude, OutlierPolicy::winsorize}) {
+    for (const auto quick : {false, true}) {
+      StatisticsReporter reporter;
+      analyze(ms, VeloxConfig().num_resamples(100).outlier_policy(policy).quick_mode(quick),
+              reporter);
+      CHECK(reporter.outlier_variance == Approx(whole));
+    }
+  }
+}
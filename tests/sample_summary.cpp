@@ -0,0 +1,46 @@
+#include "sample_summary.h"
+#include "outliers.h"
+#include "test_helpers.h"
+
+using namespace velox;
+
+TEST_CASE("sample summary") {
+  const Times times{FpNs(86), FpNs(74), FpNs(79), FpNs(79), FpNs(81), FpNs(90), FpNs(62)};
+  const SampleSummary summary(times);
+
+  const Times sorted{FpNs(62), FpNs(74), FpNs(79), FpNs(79), FpNs(81), FpNs(86), FpNs(90)};
+  REQUIRE(summary.sorted() == sorted);
+  REQUIRE(summary.size() == 7);
+  REQUIRE(summary.min() == FpNs(62));
+  REQUIRE(summary.max() == FpNs(90));
+  REQUIRE(summary.median() == FpNs(79));
+  REQUIRE(summary.mean().count() == Approx(mean(FpRange(times))));
+  REQUIRE(summary.std_dev().count() == Approx(std_dev(FpRange(times))));
+
+  const auto qs = quartiles(times);
+  REQUIRE(summary.quartiles().q1().count() == Approx(qs.q1().count()));
+  REQUIRE(summary.quartiles().q2().count() == Approx(qs.q2().count()));
+  REQUIRE(summary.quartiles().q3().count() == Approx(qs.q3().count()));
+}
+
+TEST_CASE("sample summary single value") {
+  const SampleSummary summary(Times{FpNs(5)});
+
+  REQUIRE(summary.min() == FpNs(5));
+  REQUIRE(summary.max() == FpNs(5));
+  REQUIRE(summary.median() == FpNs(5));
+  REQUIRE(summary.std_dev() == FpNs(0));
+  REQUIRE(summary.quartiles().iqr() == FpNs(0));
+}
+
+TEST_CASE("outliers from a sample summary") {
+  const Times times{FpNs(10), FpNs(11), FpNs(12), FpNs(11), FpNs(13), FpNs(50), FpNs(-30)};
+  const SampleSummary summary(times);
+
+  const Outliers from_summary(times, summary);
+  const Outliers from_times(times);
+
+  REQUIRE(from_summary.severities() == from_times.severities());
+  REQUIRE(from_summary.count(OutlierSeverity::high_severe) == 1);
+  REQUIRE(from_summary.count(OutlierSeverity::low_severe) == 1);
+}
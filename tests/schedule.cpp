@@ -0,0 +1,155 @@
+#include "schedule.h"
+#include "text_reporter.h"
+#include "test_helpers.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+using namespace velox;
+
+namespace {
+std::uint64_t total(const Schedule &s) {
+  return std::accumulate(s.begin(), s.end(), std::uint64_t(0));
+}
+}
+
+TEST_CASE("linear schedule") {
+  REQUIRE(iteration_schedule(4, 3, IterationSchedule::linear, 0) == (Schedule{6, 9, 12, 15}));
+}
+
+TEST_CASE("shuffled linear schedule") {
+  const auto linear = iteration_schedule(100, 7, IterationSchedule::linear, 0);
+  auto shuffled = iteration_schedule(100, 7, IterationSchedule::shuffled_linear, 42);
+
+  REQUIRE(shuffled != linear);
+  REQUIRE(shuffled == iteration_schedule(100, 7, IterationSchedule::shuffled_linear, 42));
+
+  std::sort(shuffled.begin(), shuffled.end());
+  REQUIRE(shuffled == linear);
+}
+
+TEST_CASE("geometric schedule") {
+  const auto linear = iteration_schedule(100, 10, IterationSchedule::linear, 0);
+  const auto geometric = iteration_schedule(100, 10, IterationSchedule::geometric, 0);
+
+  REQUIRE(geometric.size() == 100);
+  REQUIRE(geometric.front() == 20);
+  REQUIRE(std::adjacent_find(geometric.begin(), geometric.end(),
+                             std::greater_equal<std::uint64_t>()) == geometric.end());
+  REQUIRE(static_cast<double>(total(geometric)) ==
+          Approx(static_cast<double>(total(linear))).epsilon(0.001));
+}
+
+TEST_CASE("low discrepancy schedule") {
+  const auto linear = iteration_schedule(100, 10, IterationSchedule::linear, 0);
+  const auto ld = iteration_schedule(100, 10, IterationSchedule::low_discrepancy, 7);
+
+  REQUIRE(ld.size() == 100);
+  REQUIRE(*std::min_element(ld.begin(), ld.end()) >= linear.front());
+  REQUIRE(*std::max_element(ld.begin(), ld.end()) <= linear.back());
+  REQUIRE(static_cast<double>(total(ld)) ==
+          Approx(static_cast<double>(total(linear))).epsilon(0.05));
+
+  // Every tenth of the range gets about a tenth of the measurements
+  std::vector<int> deciles(10);
+  for (const auto i : ld) {
+    ++deciles[(std::min)((i - 20) / 99, std::size_t(9))];
+  }
+  for (const auto d : deciles) {
+    REQUIRE(d >= 8);
+    REQUIRE(d <= 12);
+  }
+}
+
+TEST_CASE("periodic interference") {
+  const auto PI = 3.14159265358979323846;
+
+  std::mt19937 rng(3);
+  std::normal_distribution<double> noise_distribution(0.0, 10.0);
+
+  Measurements periodic, quiet;
+  for (std::uint64_t i = 0; i < 100; ++i) {
+    const auto iters = 2 + i % 7;
+    const auto start = Ns(static_cast<Ns::rep>(i * 1000));
+    const auto noise = noise_distribution(rng);
+    const auto wave = 200.0 * std::sin(2.0 * PI * static_cast<double>(i) / 12.5);
+
+    periodic.emplace_back(
+        iters, Ns(static_cast<Ns::rep>(static_cast<double>(iters) * 100 + noise + wave)), start);
+    quiet.emplace_back(iters, Ns(static_cast<Ns::rep>(static_cast<double>(iters) * 100 + noise)),
+                       start);
+  }
+
+  const PeriodicInterference p(periodic);
+  REQUIRE(p.significant());
+  REQUIRE(p.period().count() == Approx(12500.0).epsilon(0.02));
+  REQUIRE(p.amplitude().count() == Approx(200.0).epsilon(0.05));
+  REQUIRE(p.variance_explained() > 0.9);
+
+  const PeriodicInterference q(quiet);
+  REQUIRE(!q.significant());
+
+  // The iterations above are out of order, as a shuffled schedule's would be
+  REQUIRE(!p.sequential_schedule());
+  auto sorted = periodic;
+  std::stable_sort(sorted.begin(), sorted.end(), [](const Measurement &a, const Measurement &b) {
+    return a.iters() < b.iters();
+  });
+  REQUIRE(PeriodicInterference(sorted).sequential_schedule());
+
+  // Without start times there is nothing to look for
+  Measurements unstarted;
+  for (const auto &m : periodic) {
+    unstarted.emplace_back(m.iters(), m.duration());
+  }
+  REQUIRE(!PeriodicInterference(unstarted).significant());
+}
+
+TEST_CASE("use flat sampling") {
+  VeloxConfig config;
+  config.flat_sampling_threshold(Ms(10));
+
+  REQUIRE(!use_flat_sampling(config, FpNs(Ms(1))));
+  REQUIRE(use_flat_sampling(config, FpNs(Ms(20))));
+
+  config.sampling_mode(SamplingMode::linear);
+  REQUIRE(!use_flat_sampling(config, FpNs(Ms(20))));
+
+  config.sampling_mode(SamplingMode::flat);
+  REQUIRE(use_flat_sampling(config, FpNs(Ms(1))));
+}
+
+TEST_CASE("schedule advice only for sequential schedules") {
+  const auto advice = [](const Measurements &measurements) {
+    std::ostringstream os;
+    {
+      TextReporter reporter(os);
+      reporter.periodic_interference_estimated(PeriodicInterference(measurements));
+    }
+    return os.str().find("Consider a shuffled") != std::string::npos;
+  };
+
+  const auto PI = 3.14159265358979323846;
+  Measurements sequential, shuffled;
+  for (std::uint64_t i = 0; i < 100; ++i) {
+    const auto wave = 200.0 * std::sin(2.0 * PI * static_cast<double>(i) / 12.5);
+    const auto start = Ns(static_cast<Ns::rep>(i * 1000));
+
+    const auto in_order = 2 + i;
+    sequential.emplace_back(
+        in_order, Ns(static_cast<Ns::rep>(static_cast<double>(in_order) * 100 + wave)), start);
+
+    const auto out_of_order = 2 + (i * 37) % 100;
+    shuffled.emplace_back(
+        out_of_order,
+        Ns(static_cast<Ns::rep>(static_cast<double>(out_of_order) * 100 + wave)),
+        start);
+  }
+
+  REQUIRE(PeriodicInterference(sequential).significant());
+  REQUIRE(PeriodicInterference(shuffled).significant());
+  CHECK(advice(sequential));
+  CHECK(!advice(shuffled));
+}
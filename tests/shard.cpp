@@ -0,0 +1,136 @@
+#include "velox.h"
+#include "test_helpers.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace velox;
+
+namespace {
+const std::vector<std::string> names{"a", "b", "c", "d", "e", "f", "g", "h"};
+}
+
+TEST_CASE("stable hash") {
+  // The FNV-1a test vectors
+  CHECK(stable_hash("") == 0xcbf29ce484222325ull);
+  CHECK(stable_hash("a") == 0xaf63dc4c8601ec8cull);
+  CHECK(stable_hash("foobar") == 0x85944171f73967e8ull);
+}
+
+TEST_CASE("every benchmark is in exactly one shard") {
+  const std::uint32_t count = 3;
+  std::vector<std::size_t> shard_sizes(count);
+  for (std::size_t i = 0; i < 300; ++i) {
+    const auto name = "benchmark " + std::to_string(i);
+
+    std::size_t shards = 0;
+    for (std::uint32_t index = 0; index < count; ++index) {
+      if (in_shard(name, index, count)) {
+        ++shards;
+        ++shard_sizes[index];
+      }
+    }
+    CHECK(shards == 1);
+  }
+
+  for (const auto size : shard_sizes) {
+    CHECK(size > 70);
+  }
+
+  CHECK(in_shard("a", 0, 1));
+}
+
+TEST_CASE("merging shards reports the whole suite") {
+  const TemporaryFile first("velox_shard_test"), second("velox_shard_test");
+  const std::vector<std::string> paths{first.path(), second.path()};
+
+  auto noop = [] { optimization_barrier(0); };
+
+  std::vector<std::string> run;
+  for (std::uint32_t index = 0; index < 2; ++index) {
+    LoggingReporter reporter;
+    {
+      Velox<> v(reporter, quick_config().shard(index, 2).checkpoint(paths[index]));
+      for (const auto &name : names) {
+        v.bench(name, noop);
+      }
+    }
+
+    for (const auto &name : reporter.names) {
+      CHECK(in_shard(name, index, 2));
+    }
+    run.insert(run.end(), reporter.names.begin(), reporter.names.end());
+  }
+  CHECK(run.size() == names.size());
+  const auto environment =
+      environment_fingerprint(type_name<DefaultClock>(), DefaultClock::is_steady);
+  CHECK(shards_in_environment(paths, environment) == paths);
+
+  const TemporaryFile merged_path("velox_shard_test");
+  std::size_t calls = 0;
+  LoggingReporter merged;
+  {
+    Velox<> v(merged, quick_config().merge(paths).checkpoint(merged_path.path()));
+    for (const auto &name : names) {
+      v.bench(name, [&] { ++calls; });
+    }
+    v.bench("not in a shard", noop);
+  }
+
+  CHECK(calls == 0);
+  auto expected = names;
+  expected.push_back("not in a shard");
+  CHECK(merged.names == expected);
+  // Only the benchmark which wasn't in a shard is warmed up, the others keep their shard's warm up
+  CHECK(merged.warm_ups == 1);
+  auto stored = read_checkpoint(paths[0]);
+  const auto second_shard = read_checkpoint(paths[1]);
+  stored.insert(stored.end(), second_shard.begin(), second_shard.end());
+  const auto merged_entries = read_checkpoint(merged_path.path());
+  CHECK(merged_entries.size() == expected.size());
+  for (const auto &e : merged_entries) {
+    for (const auto &s : stored) {
+      if (s.name() == e.name()) {
+        CHECK(e.warm_up().iters() == s.warm_up().iters());
+        CHECK(e.warm_up().duration() == s.warm_up().duration());
+      }
+    }
+  }
+  CHECK(merged.means.size() == expected.size());
+
+  // A shard from another environment doesn't match
+  {
+    std::ofstream file(paths[1], std::ios::trunc);
+    file << "#environment\tsomewhere else\n";
+  }
+  CHECK((shards_in_environment(paths, environment) == std::vector<std::string>{paths[0]}));
+  const TemporaryFile missing("velox_shard_test");
+  CHECK((shards_in_environment({paths[0], missing.path()}, environment) ==
+         std::vector<std::string>{paths[0]}));
+}
+
+TEST_CASE("load tests only run when the suite isn't sharded") {
+  const auto config =
+      LoadConfig().rates({1000.0}).duration(Ms(10)).arrival_process(ArrivalProcess::fixed);
+
+  const TemporaryFile first("velox_shard_test"), second("velox_shard_test");
+  const std::vector<std::string> paths{first.path(), second.path()};
+
+  std::size_t calls = 0;
+  for (std::uint32_t index = 0; index < 2; ++index) {
+    LoggingReporter reporter;
+    Velox<> v(reporter, quick_config().shard(index, 2).checkpoint(paths[index]));
+    v.load("load", [&] { optimization_barrier(++calls); }, config);
+  }
+  CHECK(calls == 0);
+
+  // The merge runs it once
+  LoggingReporter merged;
+  {
+    Velox<> v(merged, quick_config().merge(paths));
+    v.load("load", [&] { optimization_barrier(++calls); }, config);
+  }
+  CHECK(calls == 10);
+  CHECK(merged.load_tests == 1);
+}
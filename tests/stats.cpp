@@ -888,3 +888,29 @@ TEST_CASE("Stat functions uniform 50") {
   CHECK(r.quartiles_.q3() == Approx(0.001796008));
   CHECK(r.quartiles_.iqr() == Approx(0.0008773994));
 }
+
+TEST_CASE("normal distribution") {
+  CHECK(normal_cdf(0) == Approx(.5));
+  CHECK(normal_cdf(1.959964) == Approx(.975));
+  CHECK(normal_cdf(-1.644854) == Approx(.05));
+
+  CHECK(normal_quantile(.5) == Approx(0).epsilon(1e-12));
+  CHECK(normal_quantile(.975) == Approx(1.959964));
+  CHECK(normal_quantile(.05) == Approx(-1.644854));
+  CHECK(normal_quantile(1e-6) == Approx(-4.753424));
+  CHECK(normal_quantile(.999) == Approx(3.090232));
+}
+
+TEST_CASE("t, chi-squared and binomial distributions") {
+  CHECK(student_t_quantile(.975, 19) == Approx(2.093024).epsilon(1e-3));
+  CHECK(student_t_quantile(.975, 9) == Approx(2.262157).epsilon(1e-3));
+  CHECK(student_t_quantile(.05, 29) == Approx(-1.699127).epsilon(1e-3));
+  CHECK(student_t_quantile(.975, 1e9) == Approx(1.959964));
+
+  CHECK(chi_squared_quantile(.975, 19) == Approx(32.85233).epsilon(1e-3));
+  CHECK(chi_squared_quantile(.025, 19) == Approx(8.906516).epsilon(1e-2));
+
+  CHECK(binomial_half_pmf(0, 1) == Approx(.5));
+  CHECK(binomial_half_pmf(10, 20) == Approx(0.1761971));
+  CHECK(binomial_half_pmf(20, 20) == Approx(9.536743e-7));
+}
@@ -18,3 +18,18 @@ TEST_CASE("stopwatch explicit measure") {
   REQUIRE(sm.iters() == 10);
   REQUIRE(sm.elapsed().count() == 50);
 }
+
+TEST_CASE("stopwatch custom measure") {
+  detail::StopwatchModel<AdjustableClock> sm(10);
+  std::uint64_t iters = 0;
+  Stopwatch sw(sm, [&iters](Stopwatch &s) {
+    AdjustableClock::add_ticks(1000);
+    s.measure_custom([&iters](const std::uint64_t n) {
+      iters = n;
+      return std::chrono::microseconds(n * 3);
+    });
+  });
+
+  REQUIRE(iters == 10);
+  REQUIRE(sm.elapsed().count() == 30000);
+}
@@ -4,8 +4,16 @@
 #include "util.h"
 #include "fp_range.h"
 #include "point.h"
+#include "reporter.h"
+#include "velox_config.h"
 #include "catch_without_warnings.h"
 
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
 namespace Catch {
 template <>
 inline std::string toString<velox::FpNs>(const velox::FpNs &ns) {
@@ -60,6 +68,35 @@ inline bool operator==(const Point &lhs, const Point &rhs) {
 }
 }
 
+// Removes a file when the test ends, even if it fails
+struct TemporaryFile {
+  // A file in the working directory whose name other tests, even ones running at the same time,
+  // won't use
+  explicit TemporaryFile(const std::string &prefix, const std::string &extension = ".tsv")
+      : stem_(prefix + "_" + std::to_string(std::random_device{}()) + "_" +
+              std::to_string(counter()++)),
+        path_(stem_ + extension) {}
+
+  // A file named after another one, such as the data files of a split HTML report
+  TemporaryFile(const TemporaryFile &base, const std::string &suffix)
+      : stem_(base.stem_ + suffix), path_(stem_) {}
+
+  TemporaryFile &operator=(const TemporaryFile &rhs) = delete;
+
+  ~TemporaryFile() { std::remove(path_.c_str()); }
+
+  const std::string &path() const { return path_; }
+
+private:
+  static unsigned &counter() {
+    static unsigned c = 0;
+    return c;
+  }
+
+  std::string stem_;
+  std::string path_;
+};
+
 struct AdjustableClock {
   using duration = std::chrono::nanoseconds;
   using time_point = std::chrono::time_point<AdjustableClock, duration>;
@@ -71,6 +108,11 @@ struct AdjustableClock {
 
   static void add_ticks(std::uint32_t ticks) { current_tick() += ticks; }
 
+  // Waiting in a load test jumps straight to t
+  static void wait_until(const time_point t) {
+    current_tick() = (std::max)(current_tick(), t.time_since_epoch().count());
+  }
+
 private:
   static rep &current_tick() {
     static rep tick = 0;
@@ -78,4 +120,86 @@ private:
   }
 };
 
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+// Keeps what tests of whole suites check from the events it is given
+struct LoggingReporter : velox::Reporter {
+  void suite_starting(const std::string &clock, bool) override { suite = clock; }
+
+  void merge_refused(const std::string &checkpoint,
+                     const std::string &checkpoint_environment,
+                     const std::string &environment) override {
+    refused.push_back(checkpoint);
+    refused_environment = checkpoint_environment;
+    this_environment = environment;
+  }
+
+  void benchmark_starting(const std::string &name) override {
+    names.push_back(name);
+    log.push_back("start " + name);
+  }
+
+  void warm_up_starting(velox::Ms ms) override { warm_up_times.push_back(ms.count()); }
+
+  void warm_up_ended(const velox::ItersForDurationNs &) override { ++warm_ups; }
+
+  void measurement_collection_ended(const velox::Measurements &measurements,
+                                    const velox::Times &,
+                                    const velox::SampleSummary &,
+                                    const velox::Outliers &) override {
+    sizes.push_back(measurements.size());
+    log.push_back("measured " + std::to_string(measurements.size()));
+  }
+
+  void estimate_statistics_ended(const velox::EstimatedStatistics &statistics) override {
+    means.push_back(statistics.mean().estimate().point().count());
+  }
+
+  void benchmark_ended() override { log.push_back("end"); }
+
+  void load_test_ended() override {
+    ++load_tests;
+    log.push_back("load");
+  }
+
+  void suite_ended() override { ended = true; }
+
+  std::string suite;
+  std::vector<std::string> refused;
+  std::string refused_environment;
+  std::string this_environment;
+  std::vector<std::string> names;
+  // The order benchmarks and load tests started, were measured and ended in
+  std::vector<std::string> log;
+  std::vector<velox::Ms::rep> warm_up_times;
+  std::size_t warm_ups = 0;
+  std::vector<std::size_t> sizes;
+  std::vector<double> means;
+  std::size_t load_tests = 0;
+  bool ended = false;
+};
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+// Short enough for tests which run whole benchmarks
+inline velox::VeloxConfig quick_config() {
+  return velox::VeloxConfig()
+      .warm_up_time(velox::Ms(10))
+      .measurement_time(velox::Ms(20))
+      .num_measurements(10)
+      .num_resamples(100);
+}
+
+inline std::size_t lines_in(const std::string &path) {
+  std::ifstream file(path);
+  std::size_t n = 0;
+  for (std::string line; std::getline(file, line);) {
+    ++n;
+  }
+  return n;
+}
+
 #endif
@@ -0,0 +1,156 @@
+#include "velox.h"
+#include "test_helpers.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+using namespace velox;
+
+namespace {
+void busy() {
+  std::uint64_t x = 0;
+  for (std::uint64_t i = 0; i < 1000; ++i) {
+    optimization_barrier(x += i);
+  }
+}
+}
+
+TEST_CASE("warm up cache keeps the last warm up of each benchmark") {
+  const TemporaryFile temporary("velox_warm_up_cache_test");
+  const auto &path = temporary.path();
+
+  {
+    WarmUpCache cache(path);
+    REQUIRE(cache.find("a") == nullptr);
+
+    cache.benchmark_starting("a");
+    cache.warm_up_ended(ItersForDurationNs(8, Ns(800)));
+    cache.benchmark_starting("b\tc");
+    cache.warm_up_ended(ItersForDurationNs(4, Ns(100)));
+    cache.benchmark_starting("a");
+    cache.warm_up_ended(ItersForDurationNs(16, Ns(1700)));
+
+    REQUIRE(cache.find("a") != nullptr);
+    CHECK(cache.find("a")->iters() == 16);
+  }
+  REQUIRE(lines_in(path) == 3);
+
+  {
+    // The last line wins
+    WarmUpCache cache(path);
+    REQUIRE(cache.find("a") != nullptr);
+    CHECK(cache.find("a")->iters() == 16);
+    CHECK(cache.find("a")->duration() == Ns(1700));
+    REQUIRE(cache.find("b\tc") != nullptr);
+    CHECK(cache.find("b\tc")->iters() == 4);
+
+    cache.suite_ended();
+  }
+  const auto compacted = lines_in(path);
+
+  // Disabled without a path
+  WarmUpCache disabled("");
+  disabled.benchmark_starting("a");
+  disabled.warm_up_ended(ItersForDurationNs(1, Ns(1)));
+  disabled.suite_ended();
+  CHECK(disabled.find("a") == nullptr);
+
+  CHECK(compacted == 2);
+}
+
+#ifndef _WIN32
+TEST_CASE("warm up cache keeps its file when compacting fails") {
+  const TemporaryFile temporary("velox_warm_up_cache_test");
+  const auto &path = temporary.path();
+
+  {
+    WarmUpCache cache(path);
+    cache.benchmark_starting("a");
+    cache.warm_up_ended(ItersForDurationNs(8, Ns(800)));
+    cache.warm_up_ended(ItersForDurationNs(16, Ns(1700)));
+  }
+  REQUIRE(lines_in(path) == 2);
+
+  // A directory in the way of the temporary file stops it being written
+  const auto blocked = path + ".tmp";
+  REQUIRE(mkdir(blocked.c_str(), 0700) == 0);
+
+  {
+    WarmUpCache cache(path);
+    cache.suite_ended();
+    REQUIRE(cache.find("a") != nullptr);
+    CHECK(cache.find("a")->iters() == 16);
+  }
+  std::remove(blocked.c_str());
+
+  CHECK(lines_in(path) == 2);
+  WarmUpCache reread(path);
+  REQUIRE(reread.find("a") != nullptr);
+  CHECK(reread.find("a")->iters() == 16);
+}
+#endif
+
+TEST_CASE("warm up verifies a cached warm up") {
+  auto f = [] { busy(); };
+  const auto config =
+      VeloxConfig().warm_up_time(Ms(40)).verification_warm_up_time(Ms(4)).warm_up_tolerance(10.0);
+  Benchmark<DefaultClock, decltype(f)> b(f);
+
+  const auto fresh = b.warm_up(Ms(20));
+  REQUIRE(fresh.second);
+
+  LoggingReporter close;
+  const auto verified = warm_up(b, config, &fresh.first, close);
+  REQUIRE(verified.second);
+  CHECK(verified.first.iters() == fresh.first.iters());
+  CHECK(verified.first.duration() == fresh.first.duration());
+  CHECK(close.warm_up_times == std::vector<Ms::rep>{4});
+
+  // A warm up from a much slower version of the function has to be repeated
+  const ItersForDurationNs slow(1, std::chrono::duration_cast<Ns>(Ms(1000)));
+  LoggingReporter far;
+  const auto repeated = warm_up(b, config, &slow, far);
+  REQUIRE(repeated.second);
+  CHECK(repeated.first.iters() > 1);
+  CHECK(far.warm_up_times == (std::vector<Ms::rep>{4, 40}));
+
+  LoggingReporter uncached;
+  warm_up(b, config, nullptr, uncached);
+  CHECK(uncached.warm_up_times == std::vector<Ms::rep>{40});
+}
+
+TEST_CASE("velox uses the warm up cache") {
+  const TemporaryFile temporary("velox_warm_up_cache_test");
+  const auto &path = temporary.path();
+
+  const auto config = VeloxConfig()
+                          .warm_up_time(Ms(40))
+                          .verification_warm_up_time(Ms(4))
+                          .warm_up_tolerance(10.0)
+                          .measurement_time(Ms(20))
+                          .num_measurements(10)
+                          .num_resamples(100)
+                          .warm_up_cache(path);
+
+  LoggingReporter first, second;
+  {
+    Velox<> v(first, config);
+    v.bench("busy", busy);
+  }
+  {
+    Velox<> v(second, config);
+    v.bench("busy", busy);
+    v.bench("new", busy);
+  }
+  const auto lines = lines_in(path);
+
+  CHECK(first.warm_up_times == std::vector<Ms::rep>{40});
+  CHECK(second.warm_up_times == (std::vector<Ms::rep>{4, 40}));
+  CHECK(lines == 2);
+}
@@ -0,0 +1,127 @@
+#include "writer.h"
+#include "test_helpers.h"
+
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <sstream>
+
+using namespace velox;
+
+namespace {
+std::string shortest(const double d) {
+  char buffer[DOUBLE_BUFFER_SIZE];
+  return std::string(buffer, write_shortest(buffer, d));
+}
+
+std::string fixed(const double d, const int precision) {
+  char buffer[DOUBLE_BUFFER_SIZE];
+  return std::string(buffer, write_fixed(buffer, d, precision));
+}
+
+std::string printf_fixed(const double d, const int precision) {
+  char buffer[DOUBLE_BUFFER_SIZE];
+  std::snprintf(buffer, sizeof(buffer), "%.*f", precision, d);
+  return buffer;
+}
+}
+
+TEST_CASE("write_shortest") {
+  REQUIRE(shortest(0.0) == "0");
+  REQUIRE(shortest(-0.0) == "-0");
+  REQUIRE(shortest(1.0) == "1");
+  REQUIRE(shortest(-2.5) == "-2.5");
+  REQUIRE(shortest(0.1) == "0.1");
+  REQUIRE(shortest(0.3) == "0.3");
+  REQUIRE(shortest(100.0) == "100");
+  REQUIRE(shortest(123.456) == "123.456");
+  REQUIRE(shortest(0.000001) == "0.000001");
+  REQUIRE(shortest(1e-7) == "1e-7");
+  REQUIRE(shortest(1.5e21) == "1.5e+21");
+  REQUIRE(shortest(1e20) == "100000000000000000000");
+  REQUIRE(shortest(5e-324) == "5e-324");
+  REQUIRE(shortest(std::numeric_limits<double>::max()) == "1.7976931348623157e+308");
+  REQUIRE(shortest(std::numeric_limits<double>::infinity()) == "inf");
+  REQUIRE(shortest(-std::numeric_limits<double>::infinity()) == "-inf");
+  REQUIRE(shortest(std::numeric_limits<double>::quiet_NaN()) == "nan");
+}
+
+TEST_CASE("write_shortest round trips") {
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+
+  std::size_t mismatches = 0;
+  for (int i = 0; i < 100000; ++i) {
+    // Alternate between arbitrary bit patterns and ordinary magnitudes
+    auto d = dist(rng);
+    if (i % 2) {
+      const auto bits = rng();
+      std::memcpy(&d, &bits, sizeof(d));
+      if (!std::isfinite(d)) {
+        continue;
+      }
+    }
+
+    const auto s = shortest(d);
+    const auto back = std::strtod(s.c_str(), nullptr);
+    if (std::memcmp(&back, &d, sizeof(d)) != 0) {
+      ++mismatches;
+    }
+  }
+
+  REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("write_fixed") {
+  REQUIRE(fixed(0.1234567, 4) == "0.1235");
+  REQUIRE(fixed(-0.1234567, 4) == "-0.1235");
+  REQUIRE(fixed(1000.0, 1) == "1000.0");
+  REQUIRE(fixed(2.5, 0) == "2");
+  REQUIRE(fixed(1e300, 1) == printf_fixed(1e300, 1));
+  REQUIRE(fixed(-0.00001, 2) == "-0.00");
+
+  std::mt19937_64 rng(7);
+  std::uniform_real_distribution<double> dist(-1e5, 1e5);
+
+  std::size_t mismatches = 0;
+  for (int i = 0; i < 20000; ++i) {
+    // Values with few decimals land on or near ties, where the fast path must defer to printf
+    auto d = dist(rng);
+    if (i % 2) {
+      d = std::round(d * 1e3) / 1e3 + 5e-4;
+    }
+
+    for (int precision = 0; precision <= 9; ++precision) {
+      if (fixed(d, precision) != printf_fixed(d, precision)) {
+        ++mismatches;
+      }
+    }
+  }
+
+  REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("buffered writer") {
+  std::ostringstream ss;
+  {
+    BufferedWriter out(ss, 1024);
+    out << "a" << std::string("bc") << 'd' << 12u << -34 << std::numeric_limits<std::uint64_t>::max()
+        << std::numeric_limits<std::int64_t>::min() << 0.5;
+    out.write_fixed(1.25, 1);
+    out << " ";
+    out.write_general(1.0 / 3.0, 6);
+
+    // Nothing reaches the stream until the buffer fills or is flushed
+    REQUIRE(ss.str().empty());
+    out.flush();
+    REQUIRE(ss.str() == "abcd12-3418446744073709551615-92233720368547758080.51.2 0.333333");
+
+    // Writes larger than the buffer go straight to the stream
+    out << std::string(2048, 'x');
+    REQUIRE(ss.str().size() == 64 + 2048);
+
+    out << "end";
+  }
+
+  REQUIRE(ss.str().substr(ss.str().size() - 3) == "end");
+}
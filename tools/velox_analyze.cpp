@@ -0,0 +1,172 @@
+// Estimates velox's statistics from measurements which were collected earlier: a suite's
+// checkpoint, a history with raw measurements or latencies logged by a service
+
+#include "velox.h"
+#include "offline_analysis.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+const char *const USAGE =
+    "usage: velox_analyze [options] file...\n"
+    "\n"
+    "Analyzes stored measurements without measuring anything and writes the results as text.\n"
+    "\n"
+    "input:\n"
+    "  --format velox|csv|binary    velox reads checkpoints and histories with raw measurements,\n"
+    "                               csv and binary read latency logs (default velox)\n"
+    "  --column N                   the CSV column with the latencies, from 0 (default 0)\n"
+    "  --unit ns|us|ms|s            the unit of the latencies (default ns)\n"
+    "  --batch N                    latencies in each measurement (default 1)\n"
+    "  --threads N                  threads parsing each CSV log (default all)\n"
+    "\n"
+    "analysis:\n"
+    "  --confidence-level CL        between 0 and 1 (default 0.95)\n"
+    "  --resamples N                bootstrap resamples\n"
+    "  --interval percentile|bca    how confidence intervals are calculated\n"
+    "  --outliers keep|exclude|winsorize\n"
+    "                               what to do with severe outliers (default keep)\n"
+    "  --quick                      analytic confidence intervals instead of the bootstrap\n"
+    "\n"
+    "output:\n"
+    "  --html PATH                  writes an HTML report as well\n";
+
+int usage_error(const std::string &message) {
+  std::cerr << "velox_analyze: " << message << "\n\n" << USAGE;
+  return 1;
+}
+
+bool parse_unsigned(const char *s, std::uint32_t &n) {
+  char *end = nullptr;
+  const auto value = std::strtoul(s, &end, 10);
+  n = static_cast<std::uint32_t>(value);
+  return *s && !*end && value > 0 && value <= 0xffffffffu;
+}
+}
+
+int main(int argc, char **argv) {
+  std::string format = "velox", html_path;
+  velox::LatencyLogConfig log_config;
+  velox::VeloxConfig config;
+  std::vector<std::string> paths;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const auto has_value = i + 1 < argc;
+    const char *const value = has_value ? argv[i + 1] : "";
+    std::uint32_t n = 0;
+
+    if (arg == "--help" || arg == "-h") {
+      std::cout << USAGE;
+      return 0;
+    } else if (arg == "--quick") {
+      config.quick_mode(true);
+      continue;
+    } else if (arg.compare(0, 2, "--") != 0) {
+      paths.push_back(arg);
+      continue;
+    } else if (!has_value) {
+      return usage_error(arg + " needs a value");
+    }
+
+    ++i;
+    if (arg == "--format" && (!std::strcmp(value, "velox") || !std::strcmp(value, "csv") ||
+                              !std::strcmp(value, "binary"))) {
+      format = value;
+    } else if (arg == "--column" && parse_unsigned(value, n)) {
+      log_config.column(n);
+    } else if (arg == "--column" && !std::strcmp(value, "0")) {
+      log_config.column(0);
+    } else if (arg == "--unit" && !std::strcmp(value, "ns")) {
+      log_config.ns_per_unit(1.0);
+    } else if (arg == "--unit" && !std::strcmp(value, "us")) {
+      log_config.ns_per_unit(1e3);
+    } else if (arg == "--unit" && !std::strcmp(value, "ms")) {
+      log_config.ns_per_unit(1e6);
+    } else if (arg == "--unit" && !std::strcmp(value, "s")) {
+      log_config.ns_per_unit(1e9);
+    } else if (arg == "--batch" && parse_unsigned(value, n)) {
+      log_config.batch(n);
+    } else if (arg == "--threads" && parse_unsigned(value, n)) {
+      log_config.num_threads(n);
+    } else if (arg == "--confidence-level") {
+      char *end = nullptr;
+      const auto cl = std::strtod(value, &end);
+      if (*end || !(cl > 0.0 && cl < 1.0)) {
+        return usage_error("the confidence level must be between 0 and 1");
+      }
+      config.confidence_level(cl);
+    } else if (arg == "--resamples" && parse_unsigned(value, n)) {
+      config.num_resamples(n);
+    } else if (arg == "--interval" && !std::strcmp(value, "percentile")) {
+      config.interval_method(velox::IntervalMethod::percentile);
+    } else if (arg == "--interval" && !std::strcmp(value, "bca")) {
+      config.interval_method(velox::IntervalMethod::bca);
+    } else if (arg == "--outliers" && !std::strcmp(value, "keep")) {
+      config.outlier_policy(velox::OutlierPolicy::keep);
+    } else if (arg == "--outliers" && !std::strcmp(value, "exclude")) {
+      config.outlier_policy(velox::OutlierPolicy::exclude);
+    } else if (arg == "--outliers" && !std::strcmp(value, "winsorize")) {
+      config.outlier_policy(velox::OutlierPolicy::winsorize);
+    } else if (arg == "--html") {
+      html_path = value;
+    } else {
+      return usage_error("invalid option " + arg + " " + value);
+    }
+  }
+
+  if (paths.empty()) {
+    return usage_error("no files to analyze");
+  }
+
+  velox::OfflineAnalysis analysis;
+  for (const auto &path : paths) {
+    const velox::MappedFile file(path);
+    if (!file.is_open()) {
+      std::cerr << "velox_analyze: can't read " << path << "\n";
+      return 1;
+    }
+
+    if (format == "velox") {
+      velox::MemoryBuffer buffer(file.data(), file.size());
+      std::istream is(&buffer);
+      if (!analysis.add_results(is)) {
+        std::cerr << "velox_analyze: " << path << " has no stored measurements\n";
+        return 1;
+      }
+      continue;
+    }
+
+    auto measurements = format == "csv"
+                            ? velox::read_latency_csv(file.data(), file.size(), log_config)
+                            : velox::read_latency_binary(file.data(), file.size(), log_config);
+    if (measurements.empty()) {
+      std::cerr << "velox_analyze: " << path << " has no latencies\n";
+      return 1;
+    }
+    analysis.add(path, std::move(measurements));
+  }
+
+  velox::TextReporter text(std::cout);
+  if (html_path.empty()) {
+    analysis.run(config, text);
+    return 0;
+  }
+
+  std::ofstream html_file(html_path);
+  if (!html_file) {
+    std::cerr << "velox_analyze: can't write " << html_path << "\n";
+    return 1;
+  }
+
+  velox::HtmlReporter html(html_file);
+  velox::MultiReporter reporter(text, html);
+  analysis.run(config, reporter);
+  return 0;
+}